@@ -150,7 +150,7 @@ void PeriodicEdgesCL::AccumulateMFR( int lvl)
 
 
 MultiGridCL::MultiGridCL (const MGBuilderCL& Builder)
-    : _TriangVertex( *this), _TriangEdge( *this), _TriangFace( *this), _TriangTetra( *this), _version(0)
+    : _TriangVertex( *this), _TriangEdge( *this), _TriangFace( *this), _TriangTetra( *this), _version(0), _coord_version(0), _scheduling( ColoringSchedulingC)
 {
     Builder.build(this);
     FinalizeModify();
@@ -160,6 +160,13 @@ MultiGridCL::MultiGridCL (const MGBuilderCL& Builder)
 #endif
 }
 
+MultiGridCL::~MultiGridCL ()
+{
+    ClearTriangCache();
+    for (std::map<int, ColorClassesCL*>::iterator it= _colors.begin(), end= _colors.end(); it != end; ++it)
+        delete it->second;
+}
+
 void MultiGridCL::ClearTriangCache ()
 {
     _TriangVertex.clear();
@@ -167,9 +174,15 @@ void MultiGridCL::ClearTriangCache ()
     _TriangFace.clear();
     _TriangTetra.clear();
 
+    // The color classes are updated incrementally by GetColorClasses.
     for (std::map<int, ColorClassesCL*>::iterator it= _colors.begin(), end= _colors.end(); it != end; ++it)
+        it->second->Invalidate();
+    for (std::map<int, TetraGeometryCL*>::iterator it= _geometry.begin(), end= _geometry.end(); it != end; ++it)
+        delete it->second;
+    _geometry.clear();
+    for (std::map<int, OwnerPartitionCL*>::iterator it= _partitions.begin(), end= _partitions.end(); it != end; ++it)
         delete it->second;
-    _colors.clear();
+    _partitions.clear();
 }
 
 void MultiGridCL::CloseGrid(Uint Level)
@@ -434,6 +447,11 @@ void MultiGridCL::RefineGrid (Uint Level)
     const Uint nextLevel(Level+1);
     if ( Level==GetLastLevel() ) AppendLevel();
 
+#if !defined( _PAR) && defined( _OPENMP)
+    if (omp_get_max_threads() > 1)
+        RefineTetrasConcurrently( Level);
+    else
+#endif
     for (TetraIterator tIt(_Tetras[Level].begin()), tEnd(_Tetras[Level].end()); tIt!=tEnd; ++tIt)
     {
         if ( tIt->IsMarkEqRule() ) continue;
@@ -480,6 +498,124 @@ void MultiGridCL::RefineGrid (Uint Level)
 }
 
 
+#if !defined( _PAR) && defined( _OPENMP)
+/// The tetras to be refined are cut into blocks, which are partitioned into classes of blocks
+/// without common vertices. All simplices, which the refinement of a tetra creates or finds in
+/// the recycle-bins, are vertices of the tetra or belong to its edges and faces. Thus, the blocks
+/// in a class are refined concurrently. The new simplices are collected in lists per thread, which are
+/// appended to the containers of the next level in the order of the threads; the new vertices
+/// and tetras are numbered in this order. The topology equals the one of the serial
+/// refinement; only the order of the new simplices in the containers and their ids differ.
+void MultiGridCL::RefineTetrasConcurrently (Uint Level)
+{
+    const Uint nextLevel( Level+1);
+
+    std::vector<TetraCL*> todo;
+    for (TetraIterator tIt(_Tetras[Level].begin()), tEnd(_Tetras[Level].end()); tIt!=tEnd; ++tIt)
+    {
+        if ( tIt->IsMarkEqRule() ) continue;
+
+        tIt->SetRefRule( tIt->GetRefMark() );
+        if ( tIt->IsMarkedForNoRef() )
+        {
+            if ( tIt->_Children )
+                { delete tIt->_Children; tIt->_Children=0; }
+        }
+        else
+            todo.push_back( &*tIt);
+    }
+    if (todo.empty()) return;
+
+    // number the vertices of the tetras in todo
+    std::vector<const VertexCL*> verts;
+    verts.reserve( NumVertsC*todo.size());
+    for (size_t i= 0; i < todo.size(); ++i)
+        for (Uint j= 0; j < NumVertsC; ++j)
+            verts.push_back( todo[i]->GetVertex( j));
+    std::sort( verts.begin(), verts.end());
+    verts.erase( std::unique( verts.begin(), verts.end()), verts.end());
+    std::vector<size_t> tetra_verts( NumVertsC*todo.size());
+    for (size_t i= 0; i < todo.size(); ++i)
+        for (Uint j= 0; j < NumVertsC; ++j)
+            tetra_verts[NumVertsC*i + j]= std::lower_bound( verts.begin(), verts.end(), todo[i]->GetVertex( j)) - verts.begin();
+
+    // The tetras in todo are cut into blocks of consecutive tetras; the blocks are refined as a whole to preserve the locality of the serial refinement.
+    // In each round, the remaining blocks, which have no common vertex with a block chosen before in this round, form a class.
+    const size_t block_size= 128,
+                 num_blocks= (todo.size() + block_size - 1)/block_size;
+    std::vector<std::vector<size_t> > classes;
+    std::vector<int> round( verts.size(), -1);
+    std::vector<size_t> rest( num_blocks), next;
+    for (size_t b= 0; b < num_blocks; ++b)
+        rest[b]= b;
+    while (!rest.empty()) {
+        const int c= classes.size();
+        classes.push_back( std::vector<size_t>());
+        next.clear();
+        for (size_t k= 0; k < rest.size(); ++k) {
+            const size_t* const v_begin= &tetra_verts[0] + NumVertsC*block_size*rest[k],
+                        * const v_end=   &tetra_verts[0] + NumVertsC*std::min( block_size*(rest[k] + 1), todo.size());
+            const size_t* v= v_begin;
+            while (v != v_end && round[*v] != c)
+                ++v;
+            if (v != v_end)
+                next.push_back( rest[k]);
+            else {
+                for (v= v_begin; v != v_end; ++v)
+                    round[*v]= c;
+                classes.back().push_back( rest[k]);
+            }
+        }
+        rest.swap( next);
+    }
+
+    const int num_threads= omp_get_max_threads();
+    TetraCL::ResizeLinkPtrs( num_threads);
+    std::vector<VertexLevelCont> new_verts(  num_threads, VertexLevelCont( _Vertices[nextLevel].get_allocator()));
+    std::vector<EdgeLevelCont>   new_edges(  num_threads, EdgeLevelCont(   _Edges[nextLevel].get_allocator()));
+    std::vector<FaceLevelCont>   new_faces(  num_threads, FaceLevelCont(   _Faces[nextLevel].get_allocator()));
+    std::vector<TetraLevelCont>  new_tetras( num_threads, TetraLevelCont(  _Tetras[nextLevel].get_allocator()));
+    const Ulint first_vert_id= IdCL<VertexCL>::GetCounter(),
+                first_tetra_id= IdCL<TetraCL>::GetCounter();
+
+#   pragma omp parallel
+    {
+        const int t_id= omp_get_thread_num();
+        for (size_t c= 0; c < classes.size(); ++c) {
+            const std::vector<size_t>& cl= classes[c];
+#ifndef DROPS_WIN
+            size_t i;
+#else
+            int i;
+#endif
+#           pragma omp for schedule( static)
+            for (i= 0; i < cl.size(); ++i)
+                for (size_t k= block_size*cl[i], k_end= std::min( k + block_size, todo.size()); k < k_end; ++k) {
+                    const RefRuleCL& refrule( todo[k]->GetRefData() );
+                    todo[k]->CollectEdges           (refrule, new_verts[t_id], new_edges[t_id], _Bnd);
+                    todo[k]->CollectFaces           (refrule, new_faces[t_id]);
+                    todo[k]->CollectAndLinkChildren (refrule, new_tetras[t_id]);
+                }
+        }
+    }
+
+    Ulint vert_id= first_vert_id,
+          tetra_id= first_tetra_id;
+    for (int t= 0; t < num_threads; ++t) {
+        for (VertexIterator it= new_verts[t].begin(); it != new_verts[t].end(); ++it)
+            it->_Id= IdCL<VertexCL>( vert_id++);
+        for (TetraIterator it= new_tetras[t].begin(); it != new_tetras[t].end(); ++it)
+            it->_Id= IdCL<TetraCL>( tetra_id++);
+        _Vertices[nextLevel].splice( _Vertices[nextLevel].end(), new_verts[t]);
+        _Edges[nextLevel].splice(    _Edges[nextLevel].end(),    new_edges[t]);
+        _Faces[nextLevel].splice(    _Faces[nextLevel].end(),    new_faces[t]);
+        _Tetras[nextLevel].splice(   _Tetras[nextLevel].end(),   new_tetras[t]);
+    }
+    IdCL<VertexCL>::ResetCounter( vert_id);
+    IdCL<TetraCL>::ResetCounter( tetra_id);
+}
+#endif
+
 void MultiGridCL::Refine()
 {
 #ifndef _PAR
@@ -575,6 +711,7 @@ void MultiGridCL::Scale( double s)
     for (VertexIterator it= GetAllVertexBegin(), end= GetAllVertexEnd();
         it!=end; ++it)
         it->_Coord*= s;
+    IncrementCoordVersion();
 }
 
 void MultiGridCL::Transform( Point3DCL (*mapping)(const Point3DCL&))
@@ -582,6 +719,7 @@ void MultiGridCL::Transform( Point3DCL (*mapping)(const Point3DCL&))
     for (VertexIterator it= GetAllVertexBegin(), end= GetAllVertexEnd();
         it!=end; ++it)
         it->_Coord= mapping(it->_Coord);
+    IncrementCoordVersion();
 }
 
 class VertPtrLessCL : public std::binary_function<const VertexCL*, const VertexCL* , bool>
@@ -1250,12 +1388,95 @@ std::string PrioToString(Uint prio)
 #endif
 
 
+namespace {
+
+/// \brief Number of bits per coordinate of the keys on the space-filling curves.
+const Uint sfc_bits= (8*sizeof( size_t))/3 > 21 ? 21 : (8*sizeof( size_t))/3;
+
+/// \brief Map x to integer coordinates in [0, 2^sfc_bits) in the bounding box.
+void
+quantize (const Point3DCL& x, const Point3DCL& bbox_min, const Point3DCL& bbox_max, size_t X[3])
+{
+    const size_t maxcoord= (size_t( 1) << sfc_bits) - 1;
+    for (Uint i= 0; i < 3; ++i) {
+        const double w= bbox_max[i] - bbox_min[i];
+        const double t= w > 0. ? (x[i] - bbox_min[i])/w : 0.;
+        X[i]= t <= 0. ? 0 : (t >= 1. ? maxcoord : static_cast<size_t>( t*maxcoord));
+    }
+}
+
+/// \brief Interleave the bits of X; the most significant bit is taken from X[0].
+size_t
+interleave (const size_t X[3])
+{
+    size_t key= 0;
+    for (Uint b= sfc_bits; b > 0; --b)
+        for (Uint i= 0; i < 3; ++i)
+            key= (key << 1) | ((X[i] >> (b - 1)) & 1);
+    return key;
+}
+
+} // end of anonymous namespace
+
+size_t
+morton_key (const Point3DCL& x, const Point3DCL& bbox_min, const Point3DCL& bbox_max)
+{
+    size_t X[3];
+    quantize( x, bbox_min, bbox_max, X);
+    return interleave( X);
+}
+
+size_t
+hilbert_key (const Point3DCL& x, const Point3DCL& bbox_min, const Point3DCL& bbox_max)
+/// The integer coordinates are transformed into the "transposed" Hilbert index
+/// with Skilling's algorithm (AIP Conf. Proc. 707, 2004); interleaving its bits
+/// yields the position on the curve.
+{
+    size_t X[3];
+    quantize( x, bbox_min, bbox_max, X);
+
+    const size_t M= size_t( 1) << (sfc_bits - 1);
+    // Inverse undo excess work
+    for (size_t Q= M; Q > 1; Q>>= 1) {
+        const size_t P= Q - 1;
+        for (Uint i= 0; i < 3; ++i)
+            if (X[i] & Q)
+                X[0]^= P; // invert
+            else { // exchange
+                const size_t t= (X[0] ^ X[i]) & P;
+                X[0]^= t;
+                X[i]^= t;
+            }
+    }
+    // Gray encode
+    for (Uint i= 1; i < 3; ++i)
+        X[i]^= X[i - 1];
+    size_t t= 0;
+    for (size_t Q= M; Q > 1; Q>>= 1)
+        if (X[2] & Q)
+            t^= Q - 1;
+    for (Uint i= 0; i < 3; ++i)
+        X[i]^= t;
+
+    return interleave( X);
+}
+
+ColorClassesCL::ColorClassesCL (MultiGridCL::const_TriangTetraIteratorCL begin,
+                                MultiGridCL::const_TriangTetraIteratorCL end, match_fun match, const BndCondCL& Bnd)
+    : sys_( UnknownTableCL::AcquireSystem()), valid_( false), num_recolored_( 0), num_rounds_( 0), time_( 0.)
+{
+    compute_color_classes( begin, end, match, Bnd);
+}
+
+ColorClassesCL::~ColorClassesCL ()
+{
+    UnknownTableCL::ReleaseSystem( sys_);
+}
+
 void ColorClassesCL::compute_neighbors (MultiGridCL::const_TriangTetraIteratorCL begin,
-                                        MultiGridCL::const_TriangTetraIteratorCL end,
+                                        MultiGridCL::const_TriangTetraIteratorCL end, const TetraNumVecT& todo,
                                         std::vector<TetraNumVecT>& neighbors, match_fun match, const BndCondCL& Bnd)
 {
-    const size_t num_tetra= std::distance( begin, end);
-
     typedef std::tr1::unordered_map<const VertexCL*, TetraNumVecT> VertexMapT;
     VertexMapT vertexMap;
     // Collect all tetras, that have vertex v in vertexMap[v].
@@ -1292,40 +1513,185 @@ void ColorClassesCL::compute_neighbors (MultiGridCL::const_TriangTetraIteratorCL
     	if (!listper2.empty()) throw DROPSErrCL ( "ColorClassesCL::compute_neighbors : Periodic boundaries do not match!");
     }
 
-    // For every tetra j, store all neighboring tetras in neighbors[j].
-    typedef std::set<size_t> TetraNumSetT;
-    std::vector<TetraNumSetT> neighborsets( num_tetra);
-#   pragma omp parallel
-    {
+    // For every tetra j in todo, store all neighboring tetras except j in neighbors[j].
+    const VertexMapT& cVertexMap= vertexMap;
+    neighbors.resize( std::distance( begin, end));
+#ifndef DROPS_WIN
+    size_t k;
+#else
+    int k;
+#endif
+#   pragma omp parallel for
+    for (k= 0; k < todo.size(); ++k) {
+        const size_t j= todo[k];
+        TetraNumVecT& neigh= neighbors[j];
+        neigh.clear();
+        for (int i= 0; i < 4; ++i) {
+            const TetraNumVecT& tetra_nums= cVertexMap.find( (begin + j)->GetVertex( i))->second;
+            neigh.insert( neigh.end(), tetra_nums.begin(), tetra_nums.end());
+        }
+        std::sort( neigh.begin(), neigh.end());
+        neigh.erase( std::unique( neigh.begin(), neigh.end()), neigh.end());
+        neigh.erase( std::lower_bound( neigh.begin(), neigh.end(), j));
+    }
+}
+
+namespace {
+
+/// \brief Pseudo-random priority of the tetra with number j for the algorithm of Jones and Plassmann.
+inline Ulint jp_priority (size_t j)
+{
+    Ulint h= j + 0x9e3779b9ul;
+    h^= h >> 16; h*= 0x85ebca6bul; h^= h >> 13; h*= 0xc2b2ae35ul; h^= h >> 16;
+    return h;
+}
+
+/// \brief True, if tetra i must be colored before its neighbor j; ties of the priorities are broken by the number.
+inline bool jp_precedes (size_t i, size_t j, const std::vector<Ulint>& prio)
+{
+    return prio[i] > prio[j] || (prio[i] == prio[j] && i > j);
+}
+
+/// \brief The smallest color, which is not used by the neighbors; used is a buffer, in which all entries are false.
+inline int first_free_color (const std::vector<size_t>& neighbors, const std::vector<int>& color, std::vector<bool>& used)
+{
+    for (std::vector<size_t>::const_iterator it= neighbors.begin(); it != neighbors.end(); ++it)
+        if (color[*it] >= 0) {
+            if (color[*it] >= static_cast<int>( used.size()))
+                used.resize( color[*it] + 1, false);
+            used[color[*it]]= true;
+        }
+    const int c= std::find( used.begin(), used.end(), false) - used.begin();
+    for (std::vector<size_t>::const_iterator it= neighbors.begin(); it != neighbors.end(); ++it)
+        if (color[*it] >= 0)
+            used[color[*it]]= false;
+    return c;
+}
+
+} // end of anonymous namespace
+
+void ColorClassesCL::color_jones_plassmann (const std::vector<TetraNumVecT>& neighbors, const TetraNumVecT& todo, std::vector<int>& color)
+{
+    // wait[j] is the number of uncolored neighbors of j, which precede j. If it is zero, j is ready to be colored.
+    // The ready tetras form an independent set: Of two uncolored neighbors, only the one, which precedes the other, can be ready.
+    // Thus, they can be colored concurrently. The result does not depend on the number of threads.
+    std::vector<int> wait( color.size(), 0);
+    std::vector<Ulint> prio( color.size());
 #ifndef DROPS_WIN
-        size_t j;
+    size_t k;
 #else
-        int j;
+    int k;
 #endif
+#   pragma omp parallel
+    {
 #       pragma omp for
-        for (j= 0; j < num_tetra; ++j)
-            for (int i= 0; i < 4; ++i) {
-                const TetraNumVecT& tetra_nums= vertexMap[(begin + j)->GetVertex( i)];
-                neighborsets[j].insert( tetra_nums.begin(), tetra_nums.end());
-            }
+        for (k= 0; k < prio.size(); ++k)
+            prio[k]= jp_priority( k);
 #       pragma omp for
-        for (j= 0; j < num_tetra; ++j) {
-            neighbors[j].resize( neighborsets[j].size());
-            std::copy( neighborsets[j].begin(), neighborsets[j].end(), neighbors[j].begin());
+        for (k= 0; k < todo.size(); ++k) {
+            const size_t j= todo[k];
+            for (TetraNumVecT::const_iterator it= neighbors[j].begin(); it != neighbors[j].end(); ++it)
+                if (color[*it] < 0 && jp_precedes( *it, j, prio))
+                    ++wait[j];
+        }
+    }
+    TetraNumVecT ready, next;
+    for (size_t k= 0; k < todo.size(); ++k)
+        if (wait[todo[k]] == 0)
+            ready.push_back( todo[k]);
+
+    for (num_rounds_= 0; !ready.empty(); ++num_rounds_) {
+        next.clear();
+#       pragma omp parallel
+        {
+            std::vector<bool> used;
+            TetraNumVecT my_next;
+#           pragma omp for
+            for (k= 0; k < ready.size(); ++k)
+                color[ready[k]]= first_free_color( neighbors[ready[k]], color, used);
+#           pragma omp for
+            for (k= 0; k < ready.size(); ++k) {
+                const size_t j= ready[k];
+                for (TetraNumVecT::const_iterator it= neighbors[j].begin(); it != neighbors[j].end(); ++it)
+                    if (color[*it] < 0 && jp_precedes( j, *it, prio)) {
+#                       pragma omp atomic
+                        --wait[*it];
+                        my_next.push_back( *it);
+                    }
+            }
+#           pragma omp critical
+            next.insert( next.end(), my_next.begin(), my_next.end());
+        }
+        // Keep the tetras, which became ready; a tetra may have been reached from several ready tetras.
+        ready.clear();
+        for (TetraNumVecT::const_iterator it= next.begin(); it != next.end(); ++it)
+            if (wait[*it] == 0) {
+                ready.push_back( *it);
+                wait[*it]= -1;
+            }
+    }
+}
+
+void ColorClassesCL::balance (const std::vector<TetraNumVecT>& neighbors, const TetraNumVecT& todo, std::vector<int>& color)
+{
+    int num_col= 0;
+    for (size_t j= 0; j < color.size(); ++j)
+        num_col= std::max( num_col, color[j] + 1);
+    if (num_col < 2)
+        return;
+    std::vector<size_t> size( num_col, 0);
+    for (size_t j= 0; j < color.size(); ++j)
+        ++size[color[j]];
+    const size_t target= (color.size() + num_col - 1)/num_col;
+
+    std::vector<char> used( num_col);
+    for (TetraNumVecT::const_iterator jt= todo.begin(); jt != todo.end(); ++jt) {
+        const size_t j= *jt;
+        if (size[color[j]] <= target)
+            continue;
+        std::fill( used.begin(), used.end(), 0);
+        for (TetraNumVecT::const_iterator it= neighbors[j].begin(); it != neighbors[j].end(); ++it)
+            used[color[*it]]= 1;
+        int best= color[j];
+        for (int c= 0; c < num_col; ++c)
+            if (!used[c] && size[c] < size[best])
+                best= c;
+        if (size[best] < target) {
+            --size[color[j]];
+            ++size[best];
+            color[j]= best;
         }
     }
 }
 
-void ColorClassesCL::fill_pointer_arrays (
-    const std::list<ColorFreqT>& color_list, const std::vector<int>& color,
+void ColorClassesCL::fill_pointer_arrays (std::vector<int>& color,
     MultiGridCL::const_TriangTetraIteratorCL begin, MultiGridCL::const_TriangTetraIteratorCL end)
 {
-    colors_.resize( color_list.size());
-    for (std::list<ColorFreqT>::const_iterator it= color_list.begin(); it != color_list.end(); ++it)
-        colors_[it->first].reserve( it->second);
     const size_t num_tetra= std::distance( begin, end);
-    for (size_t j= 0; j < num_tetra; ++j)
-        colors_[color[j]].push_back( &*(begin + j));
+    // Remove empty color classes.
+    std::vector<size_t> size;
+    for (size_t j= 0; j < num_tetra; ++j) {
+        if (color[j] >= static_cast<int>( size.size()))
+            size.resize( color[j] + 1, 0);
+        ++size[color[j]];
+    }
+    std::vector<int> new_color( size.size());
+    int num_col= 0;
+    for (size_t c= 0; c < size.size(); ++c)
+        new_color[c]= size[c] > 0 ? num_col++ : -1;
+
+    colors_.clear();
+    colors_.resize( num_col);
+    for (size_t c= 0; c < size.size(); ++c)
+        if (size[c] > 0)
+            colors_[new_color[c]].reserve( size[c]);
+    for (size_t j= 0; j < num_tetra; ++j) {
+        color[j]= new_color[color[j]];
+        TetraCL& t= const_cast<TetraCL&>( *(begin + j));
+        t.Unknowns.Prepare( sys_);
+        t.Unknowns( sys_)= color[j];
+        colors_[color[j]].push_back( &t);
+    }
 
 #ifndef DROPS_WIN
     size_t j;
@@ -1350,49 +1716,49 @@ void ColorClassesCL::compute_color_classes (MultiGridCL::const_TriangTetraIterat
 
     const size_t num_tetra= std::distance( begin, end);
 
-    // Build the adjacency lists (a vector of neighbors for each tetra).
-    std::vector<TetraNumVecT> neighbors( num_tetra);
-    compute_neighbors( begin, end, neighbors, match, Bnd);
-
-    // Color the tetras
+    // Keep the colors of the tetras, which were colored by the last computation. The
+    // tetras of colors_ are not dereferenced, as they might have been deleted.
     std::vector<int> color( num_tetra, -1); // Color of each tetra
-    std::list<ColorFreqT> color_frequency;  // list of colors together with number of their occurrence
-    std::vector<int> used_colors; // list of the colors of all neighbors (multiple occurrences of the same color or -1 are allowed)
+    TetraNumVecT todo;                      // the tetras to be colored
     for (size_t j= 0; j < num_tetra; ++j) {
-        for (TetraNumVecT::iterator neigh_it= neighbors[j].begin(); neigh_it != neighbors[j].end(); ++neigh_it)
-            used_colors.push_back( color[*neigh_it]);
-        bool color_found= false;
-        std::list<ColorFreqT>::iterator it;
-        for (it= color_frequency.begin(); it != color_frequency.end(); ++it)
-            if (find( used_colors.begin(), used_colors.end(), it->first) == used_colors.end()) {
-                color_found= true;
-                break;
-            }
-        if (color_found) {
-            color[j]= it->first;
-            ++it->second;
-            // Move color to the end: LRU-policy for evenly used colors.
-            color_frequency.splice( color_frequency.end(), color_frequency, it);
-        }
-        else {
-            color_frequency.push_back( std::make_pair( color_frequency.size(), 1)); // Add new color with one use
-            color[j]= color_frequency.back().first;
-        }
-        used_colors.clear();
+        const TetraCL* t= &*(begin + j);
+        const IdxT c= t->Unknowns( sys_);
+        if (c < colors_.size() && std::binary_search( colors_[c].begin(), colors_[c].end(), t))
+            color[j]= c;
+        else
+            todo.push_back( j);
     }
+    num_recolored_= todo.size();
+
+    // Build the adjacency lists (a vector of neighbors for each tetra).
+    std::vector<TetraNumVecT> neighbors;
+    compute_neighbors( begin, end, todo, neighbors, match, Bnd);
+
+    // Color the tetras and balance the sizes of the color classes.
+    color_jones_plassmann( neighbors, todo, color);
+    balance( neighbors, todo, color);
     neighbors.clear();
 
     // Build arrays of pointers for the colors
-    fill_pointer_arrays( color_frequency, color, begin, end);
-    color.clear();
-
-    // for (size_t j= 0; j < num_colors(); ++j)
-    //     std::cout << "Color " << j << " has " << colors_[j].size() << " tetras." << std::endl;
-    // std::cout << std::endl;
+    fill_pointer_arrays( color, begin, end);
+    valid_= true;
 
     timer.Stop();
-    const double duration= timer.GetTime();
-    std::cout << "Creation of the tetra-coloring took " << duration << " seconds, " << num_colors() << " colors used." << '\n';
+    time_= timer.GetTime();
+    WriteStats( std::cout);
+}
+
+void ColorClassesCL::WriteStats (std::ostream& os) const
+{
+    size_t num_tetra= 0, min_size= num_colors() > 0 ? colors_[0].size() : 0, max_size= 0;
+    for (const_iterator it= begin(); it != end(); ++it) {
+        num_tetra+= it->size();
+        min_size= std::min( min_size, it->size());
+        max_size= std::max( max_size, it->size());
+    }
+    os << "Creation of the tetra-coloring took " << time_ << " seconds, " << num_colors() << " colors used, "
+       << num_recolored_ << " of " << num_tetra << " tetras colored in " << num_rounds_ << " rounds, "
+       << "class sizes: " << min_size << " to " << max_size << ".\n";
 }
 
 const ColorClassesCL& MultiGridCL::GetColorClasses (int Level, match_fun match, const BndCondCL& Bnd) const
@@ -1400,10 +1766,186 @@ const ColorClassesCL& MultiGridCL::GetColorClasses (int Level, match_fun match,
     if (Level < 0)
         Level+= GetNumLevel();
 
-    if (_colors.find( Level) == _colors.end())
-        _colors[Level]= new ColorClassesCL( GetTriangTetraBegin( Level), GetTriangTetraEnd( Level), match, Bnd);
+    std::map<int, ColorClassesCL*>::iterator it= _colors.find( Level);
+    if (it == _colors.end())
+        it= _colors.insert( std::make_pair( Level, new ColorClassesCL( GetTriangTetraBegin( Level), GetTriangTetraEnd( Level), match, Bnd))).first;
+    else if (!it->second->IsValid())
+        it->second->compute_color_classes( GetTriangTetraBegin( Level), GetTriangTetraEnd( Level), match, Bnd);
+
+    return *it->second;
+}
+
+OwnerPartitionCL::OwnerPartitionCL (MultiGridCL::const_TriangTetraIteratorCL begin,
+                                    MultiGridCL::const_TriangTetraIteratorCL end, Uint num_parts, match_fun match, const BndCondCL& Bnd)
+    : interface_colors_( 0)
+{
+#   ifdef _PAR
+        ParTimerCL timer;
+#   else
+        TimerCL timer;
+#   endif
+        timer.Start();
+
+    const size_t num_tetra= std::distance( begin, end);
+    num_parts= std::max( num_parts, Uint( 1));
+
+    // Sort the tetras along the Hilbert curve through their barycenters.
+    std::vector<Point3DCL> bary( num_tetra);
+    Point3DCL bbox_min( std::numeric_limits<double>::max()), bbox_max( -std::numeric_limits<double>::max());
+    for (size_t j= 0; j < num_tetra; ++j) {
+        bary[j]= GetBaryCenter( *(begin + j));
+        for (Uint i= 0; i < 3; ++i) {
+            bbox_min[i]= std::min( bbox_min[i], bary[j][i]);
+            bbox_max[i]= std::max( bbox_max[i], bary[j][i]);
+        }
+    }
+    typedef std::pair<size_t, size_t> KeyT; // (key, tetra)
+    std::vector<KeyT> keys( num_tetra);
+#ifndef DROPS_WIN
+    size_t j;
+#else
+    int j;
+#endif
+#   pragma omp parallel for
+    for (j= 0; j < num_tetra; ++j)
+        keys[j]= std::make_pair( hilbert_key( bary[j], bbox_min, bbox_max), size_t( j));
+    std::sort( keys.begin(), keys.end());
+
+    // The k-th tetra on the curve belongs to subdomain k*num_parts/num_tetra. A vertex is
+    // owned by a subdomain, if all of its tetras are in the subdomain; otherwise, it is marked by -1.
+    std::vector<Uint> part( num_tetra);
+    for (size_t k= 0; k < num_tetra; ++k)
+        part[keys[k].second]= (k*num_parts)/num_tetra;
+    typedef std::tr1::unordered_map<const VertexCL*, int> VertexMapT;
+    VertexMapT owner;
+    for (size_t j= 0; j < num_tetra; ++j)
+        for (Uint i= 0; i < 4; ++i) {
+            const VertexCL* v= (begin + j)->GetVertex( i);
+            std::pair<VertexMapT::iterator, bool> ins= owner.insert( std::make_pair( v, int( part[j])));
+            if (!ins.second && ins.first->second != int( part[j]))
+                ins.first->second= -1;
+            else if (match && (Bnd.GetBC( *v) == Per1BC || Bnd.GetBC( *v) == Per2BC))
+                ins.first->second= -1;
+        }
+
+    interior_.resize( num_parts);
+    for (size_t k= 0; k < num_tetra; ++k) {
+        const TetraCL& t= *(begin + keys[k].second);
+        bool interior= true;
+        for (Uint i= 0; i < 4 && interior; ++i)
+            interior= owner[t.GetVertex( i)] >= 0;
+        if (interior)
+            interior_[part[keys[k].second]].push_back( &t);
+        else
+            interface_.push_back( &t);
+    }
+
+    const TetraCL** p= interface_.empty() ? 0 : &interface_[0];
+    interface_colors_= new ColorClassesCL( MultiGridCL::const_TriangTetraIteratorCL( p),
+        MultiGridCL::const_TriangTetraIteratorCL( p + interface_.size()), match, Bnd);
+
+    timer.Stop();
+    time_= timer.GetTime();
+}
+
+OwnerPartitionCL::~OwnerPartitionCL ()
+{
+    delete interface_colors_;
+}
+
+void OwnerPartitionCL::WriteStats (std::ostream& os) const
+{
+    size_t min_size= num_parts() > 0 ? interior_[0].size() : 0, max_size= 0;
+    for (const_iterator it= begin(); it != end(); ++it) {
+        min_size= std::min( min_size, it->size());
+        max_size= std::max( max_size, it->size());
+    }
+    os << "Creation of the owner-partition took " << time_ << " seconds, " << num_parts() << " subdomains with "
+       << min_size << " to " << max_size << " interior tetras, " << num_interface() << " interface tetras in "
+       << interface_colors().num_colors() << " colors.\n";
+}
+
+AccumulationSchedulingT accumulation_scheduling_from_string (const std::string& name)
+{
+    if (name == "Coloring")      return ColoringSchedulingC;
+    if (name == "OwnerComputes") return OwnerComputesSchedulingC;
+    throw DROPSErrCL( "accumulation_scheduling_from_string: Unknown scheduling '" + name + "'.\n");
+}
+
+const OwnerPartitionCL& MultiGridCL::GetOwnerPartition (int Level, Uint num_parts, match_fun match, const BndCondCL& Bnd) const
+{
+    if (Level < 0)
+        Level+= GetNumLevel();
+
+    std::map<int, OwnerPartitionCL*>::iterator it= _partitions.find( Level);
+    if (it != _partitions.end() && it->second->num_parts() != std::max( num_parts, Uint( 1))) {
+        delete it->second;
+        _partitions.erase( it);
+        it= _partitions.end();
+    }
+    if (it == _partitions.end())
+        it= _partitions.insert( std::make_pair( Level,
+            new OwnerPartitionCL( GetTriangTetraBegin( Level), GetTriangTetraEnd( Level), num_parts, match, Bnd))).first;
+
+    return *it->second;
+}
+
+const TetraGeometryCL& MultiGridCL::GetTetraGeometry (int Level) const
+{
+    if (Level < 0)
+        Level+= GetNumLevel();
+
+    std::map<int, TetraGeometryCL*>::iterator it= _geometry.find( Level);
+    if (it == _geometry.end())
+        it= _geometry.insert( std::make_pair( Level, new TetraGeometryCL( *this, Level))).first;
+    else if (!it->second->IsValid( *this))
+        it->second->compute( *this, Level);
+
+    return *it->second;
+}
+
+TetraGeometryCL::TetraGeometryCL (const MultiGridCL& mg, int lvl)
+    : sys_( UnknownTableCL::AcquireSystem())
+{
+    compute( mg, lvl);
+}
+
+TetraGeometryCL::~TetraGeometryCL ()
+{
+    UnknownTableCL::ReleaseSystem( sys_);
+}
+
+void TetraGeometryCL::compute (const MultiGridCL& mg, int lvl)
+{
+    level_= lvl;
+    version_= mg.GetVersion();
+    coord_version_= mg.GetCoordVersion();
+
+    tetra_.clear();
+    for (MultiGridCL::const_TriangTetraIteratorCL it= mg.GetTriangTetraBegin( lvl), end= mg.GetTriangTetraEnd( lvl); it != end; ++it) {
+        TetraCL& t= const_cast<TetraCL&>( *it);
+        t.Unknowns.Prepare( sys_);
+        t.Unknowns( sys_)= tetra_.size();
+        tetra_.push_back( &t);
+    }
+    const size_t n= tetra_.size();
+    T_.resize( 9*n);
+    det_.resize( n);
 
-    return *_colors[Level];
+    SMatrixCL<3,3> T;
+    double det;
+#ifndef DROPS_WIN
+    size_t i;
+#else
+    int i;
+#endif
+#   pragma omp parallel for private( T, det)
+    for (i= 0; i < n; ++i) {
+        DROPS::GetTrafoTr( T, det, *tetra_[i]);
+        for (Uint k= 0; k < 9; ++k)
+            T_[k*n + i]= T[k];
+        det_[i]= det;
+    }
 }
 
 } // end of namespace DROPS
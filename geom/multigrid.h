@@ -147,6 +147,17 @@ class LbIteratorCL;
 #endif
 
 class ColorClassesCL; ///< forward declaration of the partitioning of the tetras in a triangulation into color classes
+class TetraGeometryCL; ///< forward declaration of the cached affine transformations of the tetras in a triangulation
+class OwnerPartitionCL; ///< forward declaration of the partitioning of the tetras in a triangulation into subdomains for the threads
+
+/// \brief Scheduling of the OpenMP-parallel accumulation, cf. accumulate in num/accumulator.h.
+enum AccumulationSchedulingT {
+    ColoringSchedulingC,     ///< one parallel loop per color class of all tetras
+    OwnerComputesSchedulingC ///< the threads visit their subdomains without synchronization, then the interface tetras are visited per color class
+};
+
+/// \brief Returns the scheduling for the names "Coloring" and "OwnerComputes"; throws for other names.
+AccumulationSchedulingT accumulation_scheduling_from_string (const std::string& name);
 
 class MultiGridCL
 {
@@ -199,8 +210,12 @@ class MultiGridCL
     TriangTetraCL  _TriangTetra;
 
     size_t         _version;                        // each modification of the multigrid increments this number
+    size_t         _coord_version;                  // each change of the vertex coordinates increments this number
 
     mutable std::map<int, ColorClassesCL*> _colors; // map: level -> Color-classes of the tetra for that level
+    mutable std::map<int, TetraGeometryCL*> _geometry; // map: level -> transformations of the tetras of that level
+    mutable std::map<int, OwnerPartitionCL*> _partitions; // map: level -> subdomains of the tetras of that level
+    AccumulationSchedulingT _scheduling;            // scheduling used by accumulate, if none is given
 
 #ifdef _PAR
     bool killedGhostTetra_;                         // are there ghost tetras, that are marked for removement, but has not been removed so far
@@ -221,6 +236,9 @@ class MultiGridCL
     void CloseGrid     (Uint);
     void UnrefineGrid  (Uint);
     void RefineGrid    (Uint);
+#if !defined( _PAR) && defined( _OPENMP)
+    void RefineTetrasConcurrently (Uint); ///< OpenMP-parallel part of RefineGrid
+#endif
 
     void BuildIndependentTetras( Uint Level) const;
 
@@ -228,8 +246,7 @@ class MultiGridCL
     MultiGridCL (const MGBuilderCL& Builder);
     MultiGridCL (const MultiGridCL&); // Dummy
     // default ctor
-    ~MultiGridCL () // avoid leaking the ColorClasses.
-    { ClearTriangCache (); }
+    ~MultiGridCL (); // avoid leaking the ColorClasses, the TetraGeometry and the OwnerPartitions.
 #ifdef _PAR
     bool KilledGhosts()      const              /// Check if there are ghost tetras, that are marked for removement, but has not been removed so far
         { return killedGhostTetra_; }
@@ -304,6 +321,8 @@ class MultiGridCL
 
     void   IncrementVersion() {++_version; }                    ///< Increment version of the multigrid
     size_t GetVersion() const { return _version; }              ///< Get version of the multigrid
+    void   IncrementCoordVersion() {++_coord_version; }         ///< To be called after the vertex-coordinates were changed, e.g. by ALE-methods
+    size_t GetCoordVersion() const { return _coord_version; }   ///< Get version of the vertex-coordinates
 
     void Refine();                                              // in parallel mode, this function uses a parallel version for refinement!
 
@@ -321,6 +340,14 @@ class MultiGridCL
 #endif
 
     const ColorClassesCL& GetColorClasses (int Level, match_fun match, const BndCondCL& Bnd) const;
+    /// \brief The partitioning of the tetras of the given level into num_parts subdomains; it is computed on the first call after a modification of the multigrid.
+    const OwnerPartitionCL& GetOwnerPartition (int Level, Uint num_parts, match_fun match, const BndCondCL& Bnd) const;
+    /// \brief Scheduling of the parallel accumulations on this multigrid, which do not specify one; the default is ColoringSchedulingC.
+    void SetAccumulationScheduling (AccumulationSchedulingT sched) { _scheduling= sched; }
+    AccumulationSchedulingT GetAccumulationScheduling () const { return _scheduling; }
+    /// \brief The transformations of the tetras in the triangulation of the given level; they are computed on the first call for the current version and coordinate-version.
+    /// Not thread-safe; call it before a parallel region.
+    const TetraGeometryCL& GetTetraGeometry (int Level= -1) const;
 
     bool IsSane (std::ostream&, int Level=-1) const;
 };
@@ -360,6 +387,17 @@ class PeriodicEdgesCL
 };
 
 /// \brief Storage of independend set of tetrahedra for assembling
+///
+/// The tetras are colored OpenMP-parallel by the algorithm of Jones and Plassmann: In each
+/// round, the uncolored tetras, which have a larger (pseudo-random) priority than all of their
+/// uncolored neighbors, form an independent set; they receive the smallest color not used by
+/// their neighbors. The coloring does not depend on the number of threads. Afterwards, tetras are moved from large to small color classes, such that
+/// the classes have similar sizes.
+///
+/// The color of each tetra is stored as its unknown-index in a system number, which is reserved
+/// in the UnknownTableCL. If the triangulation changed, e.g. by MultiGridCL::Refine, compute_color_classes
+/// keeps the colors of the tetras, which were already colored, and colors only the new tetras.
+/// This is correct, as two tetras, which are not new, are neighbors iff they were neighbors before.
 class ColorClassesCL
 {
   public:
@@ -368,29 +406,164 @@ class ColorClassesCL
 
   private:
     std::vector<ColorClassT> colors_;
+    Uint   sys_;           ///< system number for the colors of the tetras
+    bool   valid_;         ///< false, if the triangulation may have changed since the last computation
+    size_t num_recolored_; ///< number of tetras colored by the last computation
+    size_t num_rounds_;    ///< number of rounds of the Jones-Plassmann algorithm in the last computation
+    double time_;          ///< duration of the last computation in seconds
 
     typedef std::vector<size_t> TetraNumVecT;
-    typedef std::pair<size_t, size_t> ColorFreqT;
 
+    /// \brief Computes the neighbors of the tetras in todo; neighbors[j] is empty for all other tetras j.
     void compute_neighbors (MultiGridCL::const_TriangTetraIteratorCL begin,
-                            MultiGridCL::const_TriangTetraIteratorCL end,
+                            MultiGridCL::const_TriangTetraIteratorCL end, const TetraNumVecT& todo,
                             std::vector<TetraNumVecT>& neighbors, match_fun match, const BndCondCL& Bnd);
-    void fill_pointer_arrays (const std::list<ColorFreqT>& color_list,
-        const std::vector<int>& color,
+    /// \brief Colors the tetras in todo, all other tetras must already have a color.
+    void color_jones_plassmann (const std::vector<TetraNumVecT>& neighbors, const TetraNumVecT& todo, std::vector<int>& color);
+    /// \brief Moves the tetras in todo from large to small color classes, if their neighbors permit it.
+    void balance (const std::vector<TetraNumVecT>& neighbors, const TetraNumVecT& todo, std::vector<int>& color);
+    /// \brief Removes empty color classes, stores the colors on the tetras and builds the arrays of pointers.
+    void fill_pointer_arrays (std::vector<int>& color,
         MultiGridCL::const_TriangTetraIteratorCL begin,
         MultiGridCL::const_TriangTetraIteratorCL end);
 
+    ColorClassesCL (const ColorClassesCL&);            // not defined
+    ColorClassesCL& operator= (const ColorClassesCL&); // not defined
+
   public:
     ColorClassesCL (MultiGridCL::const_TriangTetraIteratorCL begin,
-                    MultiGridCL::const_TriangTetraIteratorCL end, match_fun match, const BndCondCL& Bnd)
-    { compute_color_classes( begin, end, match, Bnd); }
+                    MultiGridCL::const_TriangTetraIteratorCL end, match_fun match, const BndCondCL& Bnd);
+    ~ColorClassesCL ();
 
+    /// \brief Colors the tetras in [begin, end); the colors of tetras, which were colored before, are kept.
     void compute_color_classes (MultiGridCL::const_TriangTetraIteratorCL begin,
                                 MultiGridCL::const_TriangTetraIteratorCL end, match_fun match, const BndCondCL& Bnd);
 
+    /// \brief To be called, if the triangulation may have changed; the next MultiGridCL::GetColorClasses updates the coloring.
+    void Invalidate () { valid_= false; }
+    bool IsValid () const { return valid_; }
+
     size_t num_colors () const { return colors_.size(); }
     const_iterator begin () const { return colors_.begin(); }
     const_iterator end   () const { return colors_.end(); }
+
+    /// \brief Number of tetras, which were colored by the last computation.
+    size_t num_recolored () const { return num_recolored_; }
+    /// \brief Duration of the last computation in seconds.
+    double GetTime () const { return time_; }
+    /// \brief Writes the time, the number of colors and the sizes of the color classes.
+    void WriteStats (std::ostream& os) const;
+};
+
+/// \brief Partitioning of the tetras of a triangulation into subdomains for owner-computes assembly.
+///
+/// The tetras are sorted along the Hilbert curve through their barycenters and split into
+/// num_parts contiguous subdomains of equal size. A tetra is interior, if all of its vertices
+/// belong only to tetras of its own subdomain. Interior tetras of different subdomains do not
+/// share a vertex; thus, each subdomain can be visited by one thread without synchronization.
+/// The remaining interface tetras are partitioned into color classes. Vertices on periodic
+/// boundaries are treated as interface vertices.
+class OwnerPartitionCL
+{
+  public:
+    typedef ColorClassesCL::ColorClassT TetraVecT;
+    typedef std::vector<TetraVecT>::const_iterator const_iterator;
+
+  private:
+    std::vector<TetraVecT> interior_;  ///< interior tetras of each subdomain in the order of the Hilbert curve
+    TetraVecT       interface_;        ///< tetras with vertices in several subdomains
+    ColorClassesCL* interface_colors_; ///< color classes of interface_
+    double          time_;             ///< duration of the computation in seconds
+
+    OwnerPartitionCL (const OwnerPartitionCL&);            // not defined
+    OwnerPartitionCL& operator= (const OwnerPartitionCL&); // not defined
+
+  public:
+    OwnerPartitionCL (MultiGridCL::const_TriangTetraIteratorCL begin,
+                      MultiGridCL::const_TriangTetraIteratorCL end, Uint num_parts, match_fun match, const BndCondCL& Bnd);
+    ~OwnerPartitionCL ();
+
+    Uint num_parts () const { return interior_.size(); }
+    /// \brief Sequence of the interior tetras of the subdomains.
+    const_iterator begin () const { return interior_.begin(); }
+    const_iterator end   () const { return interior_.end(); }
+    /// \brief Number of interface tetras.
+    size_t num_interface () const { return interface_.size(); }
+    /// \brief Color classes of the interface tetras.
+    const ColorClassesCL& interface_colors () const { return *interface_colors_; }
+
+    /// \brief Writes the time, the sizes of the subdomains and the number of interface tetras.
+    void WriteStats (std::ostream& os) const;
+};
+
+/// \brief Cached affine transformations of the tetras in a triangulation.
+///
+/// For each tetra, the result of GetTrafoTr (the transposed inverse of the Jacobian of the
+/// transformation from the reference tetra, and its determinant) is stored. The data is stored
+/// component-wise (structure of arrays), i.e. T(i,j) of all tetras is contiguous, which allows
+/// for vectorized loops over many tetras. The row of a tetra is stored as its unknown-index in a
+/// system number, which the cache reserves in the UnknownTableCL.
+///
+/// The object is obtained by MultiGridCL::GetTetraGeometry; it is rebuilt, if the multigrid or the
+/// vertex-coordinates changed.
+class TetraGeometryCL
+{
+  private:
+    Uint   sys_;           ///< system number for the rows of the tetras
+    Uint   level_;         ///< level of the triangulation
+    size_t version_;       ///< version of the multigrid
+    size_t coord_version_; ///< version of the vertex-coordinates
+
+    std::vector<const TetraCL*> tetra_; ///< tetra of each row
+    std::vector<double> T_;             ///< T(i,j) of row r is T_[(3*i + j)*NumTetra() + r]
+    std::vector<double> det_;           ///< determinant of the Jacobian of each row
+
+    TetraGeometryCL (const TetraGeometryCL&);            // not defined
+    TetraGeometryCL& operator= (const TetraGeometryCL&); // not defined
+
+  public:
+    TetraGeometryCL (const MultiGridCL& mg, int lvl);
+    ~TetraGeometryCL ();
+
+    /// \brief Recompute the transformations of all tetras in the triangulation.
+    void compute (const MultiGridCL& mg, int lvl);
+    /// \brief True, iff the data is up to date with respect to mg.
+    bool IsValid (const MultiGridCL& mg) const
+    { return version_ == mg.GetVersion() && coord_version_ == mg.GetCoordVersion(); }
+
+    Uint   GetLevel () const { return level_; }
+    size_t NumTetra () const { return tetra_.size(); }
+    const TetraCL& GetTetra (size_t row) const { return *tetra_[row]; }
+    /// \brief The row of t; NoIdx, if t is not in the triangulation.
+    IdxT GetRow (const TetraCL& t) const {
+        const IdxT row= t.Unknowns( sys_);
+        return row < tetra_.size() && tetra_[row] == &t ? row : NoIdx;
+    }
+
+    /// \brief Component T(i,j) for all rows.
+    const double* GetT (Uint i, Uint j) const { return &T_[(3*i + j)*tetra_.size()]; }
+    /// \brief Determinants for all rows.
+    const double* GetDet () const { return &det_[0]; }
+
+    /// \brief Same as the function GetTrafoTr for the tetra in the given row.
+    void GetTrafoTr (SMatrixCL<3,3>& T, double& det, size_t row) const {
+        const size_t n= tetra_.size();
+        for (Uint k= 0; k < 9; ++k)
+            T[k]= T_[k*n + row];
+        det= det_[row];
+    }
+    /// \brief Same as the function GetTrafoTr; tetras, which are not in the triangulation, are computed on the fly.
+    inline void GetTrafoTr (SMatrixCL<3,3>& T, double& det, const TetraCL& t) const;
+    /// \brief Absolute value of the determinant, i.e. 6*t.GetVolume().
+    double GetAbsDet (const TetraCL& t) const {
+        const IdxT row= GetRow( t);
+        return row != NoIdx ? std::fabs( det_[row]) : t.GetVolume()*6.;
+    }
+
+    /// \brief Memory used by the cache in bytes.
+    size_t GetMemory () const {
+        return tetra_.capacity()*sizeof( const TetraCL*) + (T_.capacity() + det_.capacity())*sizeof( double);
+    }
 };
 
 
@@ -443,6 +616,9 @@ for (DROPS::TriangEdgeCL::const_iterator it( mg.GetTriangEdgeBegin( lvl)), end__
 #define DROPS_FOR_TRIANG_FACE( mg, lvl, it) \
 for (DROPS::TriangFaceCL::iterator it( mg.GetTriangFaceBegin( lvl)), end__( mg.GetTriangFaceEnd( lvl)); it != end__; ++it)
 
+#define DROPS_FOR_TRIANG_CONST_FACE( mg, lvl, it) \
+for (DROPS::TriangFaceCL::const_iterator it( mg.GetTriangFaceBegin( lvl)), end__( mg.GetTriangFaceEnd( lvl)); it != end__; ++it)
+
 #define DROPS_FOR_ALL_TRIANG_CONST_FACE( mg, lvl, it) \
 for (DROPS::TriangFaceCL::const_iterator FaceCL* it( mg.GetTriangFaceBegin( lvl)), end__( mg.GetTriangFaceEnd( lvl)); it != end__; ++it)
 
@@ -643,6 +819,23 @@ inline void GetTrafoTr( SMatrixCL<3,3>& T, double& det, const TetraCL& t)
     T(2,2)= (M[0][0]*M[1][1] - M[1][0]*M[0][1])/det;
 }
 
+inline void TetraGeometryCL::GetTrafoTr (SMatrixCL<3,3>& T, double& det, const TetraCL& t) const
+{
+    const IdxT row= GetRow( t);
+    if (row != NoIdx)
+        GetTrafoTr( T, det, row);
+    else
+        DROPS::GetTrafoTr( T, det, t);
+}
+
+/// \brief Key of x on the Morton curve; bbox_min and bbox_max define the bounding box of all points.
+size_t
+morton_key (const Point3DCL& x, const Point3DCL& bbox_min, const Point3DCL& bbox_max);
+
+/// \brief Key of x on the Hilbert curve; bbox_min and bbox_max define the bounding box of all points.
+size_t
+hilbert_key (const Point3DCL& x, const Point3DCL& bbox_min, const Point3DCL& bbox_max);
+
 
 void MarkAll (MultiGridCL&);
 void UnMarkAll (MultiGridCL&);
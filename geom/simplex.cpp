@@ -52,8 +52,16 @@ TypeT TetraCL::_dddT=0;
 //
 // static members of TetraCL
 //
-SArrayCL<EdgeCL*, NumAllEdgesC> TetraCL::_ePtrs(static_cast<EdgeCL*>(0));
-SArrayCL<FaceCL*, NumAllFacesC> TetraCL::_fPtrs(static_cast<FaceCL*>(0));
+std::vector<TetraCL::EdgePtrsT> TetraCL::_ePtrs( 1, TetraCL::EdgePtrsT( static_cast<EdgeCL*>(0)));
+std::vector<TetraCL::FacePtrsT> TetraCL::_fPtrs( 1, TetraCL::FacePtrsT( static_cast<FaceCL*>(0)));
+
+void TetraCL::ResizeLinkPtrs (Uint num_threads)
+{
+    if (num_threads > _ePtrs.size()) {
+        _ePtrs.resize( num_threads, EdgePtrsT( static_cast<EdgeCL*>(0)));
+        _fPtrs.resize( num_threads, FacePtrsT( static_cast<FaceCL*>(0)));
+    }
+}
 
 // V e r t e x C L
 #ifdef _PAR
@@ -658,13 +666,14 @@ void TetraCL::CollectEdges (const RefRuleCL& refrule,
                             VertContT& vertcont, EdgeContT& edgecont,
                             const BoundaryCL& Bnd)
 /**
-The edges for new refinement are stored in the static TetraCL::ePtrs array.
+The edges for new refinement are stored in the static TetraCL::ePtrs array of the calling thread.
 First look for them in the recycle bin (maybe they were created before),
 if the edge cannot be found, create it.
 */
 /// \todo (of): Ist auf verschiedenen Prozessen tatsaechlich die Reihenfolge der Subedges eindeutig???
 {
     const Uint nextLevel= GetLevel()+1;
+    EdgePtrsT& ePtrs= _ePtrs[LinkPtrsIdx()];
 
     // Collect obvious edges
     for (Uint edge=0; edge<NumEdgesC; ++edge)
@@ -677,33 +686,33 @@ if the edge cannot be found, create it.
         {
             if ( ep->IsRefined() )
             {
-                _ePtrs[SubEdge(edge, 0)]= vp0->FindEdge(ep->GetMidVertex());
-                _ePtrs[SubEdge(edge, 1)]= ep->GetMidVertex()->FindEdge(vp1);
-                Assert(_ePtrs[SubEdge(edge, 0)], DROPSErrCL("CollectEdges: SubEdge 0 not found."), DebugRefineEasyC);
-                Assert(_ePtrs[SubEdge(edge, 1)], DROPSErrCL("CollectEdges: SubEdge 1 not found."), DebugRefineEasyC);
+                ePtrs[SubEdge(edge, 0)]= vp0->FindEdge(ep->GetMidVertex());
+                ePtrs[SubEdge(edge, 1)]= ep->GetMidVertex()->FindEdge(vp1);
+                Assert(ePtrs[SubEdge(edge, 0)], DROPSErrCL("CollectEdges: SubEdge 0 not found."), DebugRefineEasyC);
+                Assert(ePtrs[SubEdge(edge, 1)], DROPSErrCL("CollectEdges: SubEdge 1 not found."), DebugRefineEasyC);
             }
             else
             {
                 ep->BuildSubEdges(edgecont, vertcont, Bnd);
 
                 EdgeContT::iterator sub= edgecont.end();
-                _ePtrs[SubEdge(edge, 1)]= &*(--sub);
+                ePtrs[SubEdge(edge, 1)]= &*(--sub);
                 sub->RecycleMe();
-                _ePtrs[SubEdge(edge, 0)]= &*(--sub);
+                ePtrs[SubEdge(edge, 0)]= &*(--sub);
                 sub->RecycleMe();
 #ifdef _PAR
                 // if new edges are created on the proc-boundary, identify them with DDD
                 if (ParMultiGridCL::IsOnProcBnd( ep))
                 {
-                    ParMultiGridCL::IdentifyEdge( _ePtrs[SubEdge(edge, 0)], ep, 0);
-                    ParMultiGridCL::IdentifyEdge( _ePtrs[SubEdge(edge, 1)], ep, 1);
+                    ParMultiGridCL::IdentifyEdge( ePtrs[SubEdge(edge, 0)], ep, 0);
+                    ParMultiGridCL::IdentifyEdge( ePtrs[SubEdge(edge, 1)], ep, 1);
                 }
 #endif
             }
         }
         else
         {
-            _ePtrs[edge]= ep;
+            ePtrs[edge]= ep;
         }
     }
 
@@ -716,7 +725,7 @@ if the edge cannot be found, create it.
         VertexCL* const vp0  = GetVertMidVert(VertOfEdge(edge, 0));
         VertexCL* const vp1  = GetVertMidVert(VertOfEdge(edge, 1));
 
-        if ( !(_ePtrs[edge]=vp0->FindEdge(vp1)) )
+        if ( !(ePtrs[edge]=vp0->FindEdge(vp1)) )
         {
             if ( IsDiagonal(edge) )
                 edgecont.push_back( EdgeCL(vp0, vp1, nextLevel) );
@@ -729,34 +738,35 @@ if the edge cannot be found, create it.
                     ParMultiGridCL::IdentifyEdge( &edgecont.back(), GetFace(ParFaceOfEdge(edge)), vp0, vp1);
 #endif
             }
-            _ePtrs[edge] = &edgecont.back();
-            _ePtrs[edge]->RecycleMe();
+            ePtrs[edge] = &edgecont.back();
+            ePtrs[edge]->RecycleMe();
         }
     }
 }
 
 void TetraCL::CollectFaces (const RefRuleCL& refrule, FaceContT& facecont)
 /**
-The faces for new refinement are stored in the static TetraCL::fPtrs array.
+The faces for new refinement are stored in the static TetraCL::fPtrs array of the calling thread.
 First look for them in the recycle bin (maybe they were created before),
 if the face cannot be found, create it and link boundary, if necessary.
 */
 ///\todo (of) Ist lokale Subface-Nummerierung auf verschiedenen Prozessen eindeutig??
 {
     const Uint nextLevel= GetLevel()+1;
+    FacePtrsT& fPtrs= _fPtrs[LinkPtrsIdx()];
 
     for (Uint i=0; i<refrule.FaceNum; ++i)
     {
         const Uint face= refrule.Faces[i];
 
         if (IsParentFace(face))
-            _fPtrs[face]= _Faces[face];
+            fPtrs[face]= _Faces[face];
         else
         {
                   VertexCL* const vp0= GetVertMidVert(VertOfFace(face, 0));
             const VertexCL* const vp1= GetVertMidVert(VertOfFace(face, 1));
             const VertexCL* const vp2= GetVertMidVert(VertOfFace(face, 2));
-            if (!(_fPtrs[face]= vp0->FindFace(vp1, vp2) ) )
+            if (!(fPtrs[face]= vp0->FindFace(vp1, vp2) ) )
             {
                 if ( IsSubFace(face) )
                 {
@@ -772,8 +782,8 @@ if the face cannot be found, create it and link boundary, if necessary.
                 else
                     facecont.push_back( FaceCL(nextLevel) );
 
-                _fPtrs[face] = &facecont.back();
-                _fPtrs[face]->RecycleMe(vp0, vp1, vp2);
+                fPtrs[face] = &facecont.back();
+                fPtrs[face]->RecycleMe(vp0, vp1, vp2);
             }
         }
     }
@@ -580,9 +580,11 @@ class TetraCL
     typedef MG_TetraContT::LevelCont                        TetraContT;                 ///< container for children for linking purpose
 
   private:
-    // static arrays for computations
-    static SArrayCL<EdgeCL*, NumAllEdgesC> _ePtrs;                      // EdgePointers for linking edges within refinement
-    static SArrayCL<FaceCL*, NumAllFacesC> _fPtrs;                      // FacePointers for linking faces within refinement
+    typedef SArrayCL<EdgeCL*, NumAllEdgesC> EdgePtrsT;
+    typedef SArrayCL<FaceCL*, NumAllFacesC> FacePtrsT;
+    // static arrays for computations; one per OpenMP-thread, as MultiGridCL::RefineGrid refines tetras concurrently
+    static std::vector<EdgePtrsT> _ePtrs;                               // EdgePointers for linking edges within refinement
+    static std::vector<FacePtrsT> _fPtrs;                               // FacePointers for linking faces within refinement
 
     IdCL<TetraCL> _Id;                                                  // id-number (locally numbered on one proc)
     Usint          _RefRule;                                            // actual refinement of the tetrahedron
@@ -656,6 +658,8 @@ class TetraCL
     // building children
     void        CollectEdges           (const RefRuleCL&, VertContT&, EdgeContT&, const BoundaryCL&);   ///< build or unrecycle edges that are needed for refinement
     void        CollectFaces           (const RefRuleCL&, FaceContT&);                                  ///< build or unrecycle faces that are needed for refinement
+    static void ResizeLinkPtrs         (Uint num_threads);                                              ///< provide _ePtrs and _fPtrs for num_threads threads
+    static Uint LinkPtrsIdx            ();                                                              ///< index of the _ePtrs and _fPtrs of the calling thread
     inline void LinkEdges              (const ChildDataCL&);                                            ///< link edges from "_ePtrs" to the tetra according to the ChildDataCL
     inline void LinkFaces              (const ChildDataCL&);                                            ///< link faces from "_fPtrs" to the tetra according to the ChildDataCL
     void CollectAndLinkChildren (const RefRuleCL&, TetraContT&);                                 ///< build, unrecycle and link children
@@ -887,11 +891,11 @@ inline const TetraCL* RecycleBinCL::FindTetra (const VertexCL* v1, const VertexC
 
 #ifndef _PAR
 inline VertexCL::VertexCL (const Point3DCL& Coord, Uint FirstLevel, IdCL<VertexCL> id)
-    : _Id(id), _Coord(Coord), _BndVerts(0), _Bin(0),_RemoveMark(false), _Level(FirstLevel)
+    : _Id(id), _Coord(Coord), _BndVerts(0), _Bin(0),_RemoveMark(false), _Level(FirstLevel), Unknowns( 0)
 {}
 #else
 inline VertexCL::VertexCL (const Point3DCL& Coord, Uint FirstLevel, IdCL<VertexCL> id)
-    : _Id(id), _Coord(Coord), _BndVerts(0), _Bin(0),_RemoveMark(false)/*, ProcSysNum(0)*/
+    : _Id(id), _Coord(Coord), _BndVerts(0), _Bin(0),_RemoveMark(false), Unknowns( 0)/*, ProcSysNum(0)*/
 {
 	DynamicDataInterfaceExtraCL::HdrConstructor(&_dddH, _dddT, PrioMaster, FirstLevel);
 #if DROPSDebugC&DebugSubscribeC
@@ -985,14 +989,14 @@ inline bool VertexCL::HasBnd(const BndPointCL& BndVert) const
 
 #ifndef _PAR
 inline EdgeCL::EdgeCL (VertexCL* vp0, VertexCL* vp1, Uint Level, BndIdxT bnd0, BndIdxT bnd1, short int MFR)
-    : _MidVertex(0), _MFR(MFR), _localMFR(MFR), _RemoveMark(false), _Level(Level)
+    : _MidVertex(0), _MFR(MFR), _localMFR(MFR), _RemoveMark(false), _Level(Level), Unknowns( 1)
 {
     _Vertices[0]= vp0; _Vertices[1]= vp1;
     _Bnd[0]= bnd0; _Bnd[1]= bnd1;
 }
 #else
 inline EdgeCL::EdgeCL (VertexCL* vp0, VertexCL* vp1, Uint Level, BndIdxT bnd0, BndIdxT bnd1, short int MFR)
-    : _MidVertex(0), _MFR(MFR), _localMFR(MFR), _RemoveMark(false), _AccMFR(MFR)/*, ProcSysNum(0)*/
+    : _MidVertex(0), _MFR(MFR), _localMFR(MFR), _RemoveMark(false), _AccMFR(MFR), Unknowns( 1)/*, ProcSysNum(0)*/
 {
     _Vertices[0]= vp0; _Vertices[1]= vp1;
     _Bnd[0]= bnd0; _Bnd[1]= bnd1;
@@ -1059,10 +1063,10 @@ inline bool EdgeCL::IsExclusive( Priority prio) const
 // ********** FaceCL **********
 #ifndef _PAR
 inline FaceCL::FaceCL (Uint Level, BndIdxT bnd)
-    : _Bnd(bnd), _RemoveMark(false), _Level(Level) {}
+    : _Bnd(bnd), _RemoveMark(false), _Level(Level), Unknowns( 2) {}
 #else
 inline FaceCL::FaceCL (Uint Level, BndIdxT bnd)
-    : _Bnd(bnd), _RemoveMark(false), _lbNoNeigh(-1)
+    : _Bnd(bnd), _RemoveMark(false), _lbNoNeigh(-1), Unknowns( 2)
 {
 	DynamicDataInterfaceExtraCL::HdrConstructor(&_dddH, _dddT, PrioMaster, Level);
 #if DROPSDebugC&DebugSubscribeC
@@ -1150,7 +1154,7 @@ inline const TetraCL* FaceCL::GetTetra (Uint Level, Uint side) const
 inline TetraCL::TetraCL (VertexCL* vp0, VertexCL* vp1, VertexCL* vp2, VertexCL* vp3, TetraCL* Parent, IdCL<TetraCL> id)
     : _Id(id), _RefRule(UnRefRuleC), _RefMark(NoRefMarkC),
       _Level(Parent==0 ? 0 : Parent->GetLevel()+1),
-      _Parent(Parent), _Children(0)
+      _Parent(Parent), _Children(0), Unknowns( 3)
 {
     _Vertices[0] = vp0; _Vertices[1] = vp1;
     _Vertices[2] = vp2; _Vertices[3] = vp3;
@@ -1158,7 +1162,7 @@ inline TetraCL::TetraCL (VertexCL* vp0, VertexCL* vp1, VertexCL* vp2, VertexCL*
 #else
 inline TetraCL::TetraCL (VertexCL* vp0, VertexCL* vp1, VertexCL* vp2, VertexCL* vp3, TetraCL* Parent, IdCL<TetraCL> id)
     : _Id(id), _RefRule(UnRefRuleC), _RefMark(NoRefMarkC), _lbNr(-1),
-      _Parent(Parent), _Children(0)/*, ProcSysNum(0)*/
+      _Parent(Parent), _Children(0), Unknowns( 3)/*, ProcSysNum(0)*/
 {
     _Vertices[0] = vp0; _Vertices[1] = vp1;
     _Vertices[2] = vp2; _Vertices[3] = vp3;
@@ -1170,7 +1174,7 @@ inline TetraCL::TetraCL (VertexCL* vp0, VertexCL* vp1, VertexCL* vp2, VertexCL*
 
 inline TetraCL::TetraCL (VertexCL* vp0, VertexCL* vp1, VertexCL* vp2, VertexCL* vp3, TetraCL* Parent, Uint lvl, IdCL<TetraCL> id)
     : _Id(id), _RefRule(UnRefRuleC), _RefMark(NoRefMarkC), _lbNr(-1),
-      _Parent( Parent), _Children(0)/*, ProcSysNum(0)*/
+      _Parent( Parent), _Children(0), Unknowns( 3)/*, ProcSysNum(0)*/
 {
     Assert(!Parent && Parent->GetLevel()!=lvl-1, DROPSErrCL("TetraCL::TetraCL: Parent and given level does not match"), DebugRefineEasyC);
     _Vertices[0] = vp0; _Vertices[1] = vp1;
@@ -1260,20 +1264,31 @@ inline void TetraCL::Close()
     }
 }
 
+inline Uint TetraCL::LinkPtrsIdx ()
+{
+#ifdef _OPENMP
+    return omp_get_thread_num();
+#else
+    return 0;
+#endif
+}
+
 inline void TetraCL::LinkEdges (const ChildDataCL& childdat)
 {
+    const EdgePtrsT& ePtrs= _ePtrs[LinkPtrsIdx()];
     for (Uint edge=0; edge<NumEdgesC; ++edge)
     {
-        Assert(!_ePtrs[childdat.Edges[edge]]->IsMarkedForRemovement(),"TetraCL::LinkEdge, link edge that is marked for removement", ~0);
-        _Edges[edge]= _ePtrs[childdat.Edges[edge]];
+        Assert(!ePtrs[childdat.Edges[edge]]->IsMarkedForRemovement(),"TetraCL::LinkEdge, link edge that is marked for removement", ~0);
+        _Edges[edge]= ePtrs[childdat.Edges[edge]];
     }
 }
 
 inline void TetraCL::LinkFaces (const ChildDataCL& childdat)
 {
+    const FacePtrsT& fPtrs= _fPtrs[LinkPtrsIdx()];
     for (Uint face=0; face<NumFacesC; ++face)
     {
-        _Faces[face]= _fPtrs[childdat.Faces[face]];
+        _Faces[face]= fPtrs[childdat.Faces[face]];
         _Faces[face]->LinkTetra(this);
     }
 }
@@ -132,14 +132,11 @@ SortedVertexPolicyCL::sort_vertexes (VertexContT& vertexes, VertexContT& cut_ver
     const Uint lattice_num_vertexes= lat_.vertex_size();
     const PrincipalLatticeCL::const_vertex_iterator lattice_vertex_begin= lat_.vertex_begin();
 
-    std::valarray<byte> ls_sign;
-    copy_levelset_sign( ls_, ls_sign);
-
     // Count signs
     Uint num_sign_arr[3]= { 0, 0, 0 };
     Uint* const num_sign= num_sign_arr + 1; // num_sign[i] == number of verts with sign i
     for (Uint i= 0; i < lattice_num_vertexes; ++i)
-        ++num_sign[ls_sign[i]];
+        ++num_sign[ls_sign_[i]];
     const Uint num_zero_vertexes= num_sign[0] + cut_vertexes.size();
 
     vertexes.resize( num_sign[-1] + num_sign[1] + num_zero_vertexes);
@@ -153,7 +150,7 @@ SortedVertexPolicyCL::sort_vertexes (VertexContT& vertexes, VertexContT& cut_ver
     cursor[0]= num_sign[-1];
     cursor[1]= num_sign[-1] + num_zero_vertexes;
     for (Uint i= 0; i < lattice_num_vertexes; ++i) {
-        Uint& cur= cursor[ls_sign[i]];
+        Uint& cur= cursor[ls_sign_[i]];
         new_pos[i]= cur;
         vertexes[cur]= lattice_vertex_begin[i];
         ++cur;
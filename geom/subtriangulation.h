@@ -101,6 +101,14 @@ class TetraPartitionCL
     Uint        pos_vertex_begin_; ///< begin of the subsequence of vertexes of positive tetras
     Uint        neg_vertex_end_;   ///< end of the subsequence of of vertexes of negative tetras
 
+    /// Work space of make_partition; kept between calls to avoid the reallocation for each tetra of the triangulation.
+    ///@{
+    std::valarray<byte> ls_sign_;      ///< signs of the level set function on the lattice vertexes
+    TetraContT          pos_tetras_;   ///< temporary container for the positive tetras
+    VertexContT         cut_vertexes_; ///< genuine edge cuts, see VertexCutMergingPolicyT
+    std::vector<Uint>   edge_cuts_;    ///< memoized edge cuts, see MergeCutPolicyCL
+    ///@}
+
     template <class VertexCutMergingPolicyT>
       const TetraT ///< Create a single sub-tetra and its vertexes
       make_sub_tetra (const RefTetraPartitionCL::TetraT& ref_tet, const PrincipalLatticeCL::TetraT& lattice_tet,
@@ -168,6 +176,15 @@ class SurfacePatchCL
 
     VertexContT vertexes_;
 
+    /// Work space of make_patch; kept between calls to avoid the reallocation for each tetra of the triangulation.
+    ///@{
+    std::valarray<byte>              ls_sign_;          ///< signs of the level set function on the lattice vertexes
+    VertexContT                      cut_vertexes_;     ///< genuine edge cuts, see VertexCutMergingPolicyT
+    std::vector<Uint>                edge_cuts_;        ///< memoized edge cuts, see MergeCutPolicyCL
+    std::vector<Uint>                copied_vertexes_;  ///< lookup-table for copied zero-vertexes from the lattice
+    std::vector<RenumberVertexPairT> zero_vertex_uses_; ///< used to renumber the zero_vertexes
+    ///@}
+
     template <class VertexCutMergingPolicyT>
       const TriangleT ///< Create a single sub-triangle and its vertexes
       make_sub_triangle (const RefTetraPatchCL::TriangleT& ref_tri, const PrincipalLatticeCL::TetraT& lattice_tet,
@@ -213,7 +230,7 @@ class UnorderedVertexPolicyCL
     typedef LatticePartitionTypesNS::VertexContT VertexContT;
 
   public:
-    UnorderedVertexPolicyCL (const PrincipalLatticeCL&, const std::valarray<double>&,
+    UnorderedVertexPolicyCL (const PrincipalLatticeCL&, const std::valarray<byte>&,
         TetraContT::iterator, TetraContT::iterator, Uint) {}
 
     /// \brief Append the cut_vertexes to vertexes.
@@ -228,15 +245,15 @@ class SortedVertexPolicyCL
     typedef LatticePartitionTypesNS::TetraContT  TetraContT;
     typedef LatticePartitionTypesNS::VertexContT VertexContT;
 
-    const PrincipalLatticeCL&    lat_;
-    const std::valarray<double>& ls_;
-    const TetraContT::iterator   tetra_begin_,
-                                 tetra_end_;
+    const PrincipalLatticeCL&  lat_;
+    const std::valarray<byte>& ls_sign_; ///< signs of the level set function on the lattice vertexes
+    const TetraContT::iterator tetra_begin_,
+                               tetra_end_;
 
   public:
-    SortedVertexPolicyCL (const PrincipalLatticeCL& lat, const std::valarray<double>& ls,
+    SortedVertexPolicyCL (const PrincipalLatticeCL& lat, const std::valarray<byte>& ls_sign,
         TetraContT::iterator tetra_begin, TetraContT::iterator tetra_end, Uint)
-        : lat_( lat), ls_( ls), tetra_begin_( tetra_begin), tetra_end_(tetra_end) {}
+        : lat_( lat), ls_sign_( ls_sign), tetra_begin_( tetra_begin), tetra_end_(tetra_end) {}
 
     /// \brief Sort the vertexes and update the vertex numbers in the tetras.
     void sort_vertexes (VertexContT& vertexes, VertexContT& cut_vertexes,
@@ -256,9 +273,9 @@ class PartitionedVertexPolicyCL
     Uint                       pos_tetra_begin_;
 
   public:
-    PartitionedVertexPolicyCL (const PrincipalLatticeCL& lat, const std::valarray<double>& ls,
+    PartitionedVertexPolicyCL (const PrincipalLatticeCL& lat, const std::valarray<byte>& ls_sign,
         TetraContT::iterator tetra_begin, TetraContT::iterator tetra_end, Uint pos_tetra_begin)
-        : pol_( lat, ls, tetra_begin, tetra_end, pos_tetra_begin),
+        : pol_( lat, ls_sign, tetra_begin, tetra_end, pos_tetra_begin),
           tetra_begin_( tetra_begin), tetra_end_( tetra_end), pos_tetra_begin_( pos_tetra_begin) {}
 
     /// \brief Sort the vertexes and update the vertex numbers in the tetras: Special care must be taken for the duplicated vertexes
@@ -273,11 +290,12 @@ class DuplicateCutPolicyCL
     typedef LatticePartitionTypesNS::VertexContT VertexContT;
 
     const PrincipalLatticeCL::const_vertex_iterator lattice_vertexes_;
-    VertexContT vertexes_;
+    VertexContT& vertexes_;
 
   public:
-    DuplicateCutPolicyCL (PrincipalLatticeCL::const_vertex_iterator lattice_vertexes)
-        : lattice_vertexes_( lattice_vertexes) {}
+    /// The cut vertexes are stored in vertexes, which is cleared. The edge_cuts are not used.
+    DuplicateCutPolicyCL (const PrincipalLatticeCL& lat, VertexContT& vertexes, std::vector<Uint>&)
+        : lattice_vertexes_( lat.vertex_begin()), vertexes_( vertexes) { vertexes_.resize( 0); }
 
     ///\brief Add the cut vertex and return its number.
     Uint operator() (Uint v0, Uint v1, double ls0, double ls1) {
@@ -290,39 +308,44 @@ class DuplicateCutPolicyCL
 };
 
 ///\brief A cut-vertex is added to the list of vertexes only by the first tetra, on which it is discovered: cuts are memoized for each edge.
+///
+/// The cuts are memoized in a dense table with one entry per lattice vertex v0, which holds the cuts on the edges (v0, v1) with v0 < v1. As a vertex of the principal lattice has at most 14 neighbors, the lookup is a short linear search and no hashing or allocation per cut is needed.
 class MergeCutPolicyCL
 {
   private:
     typedef LatticePartitionTypesNS::VertexContT VertexContT;
 
-    struct UintPairHasherCL
-    {
-        size_t operator() (const std::pair<Uint, Uint>& p) const
-            { return p.first << (4*sizeof(Uint)) ^ p.second; } // for less than 2^(sizeof(Uint)/2) vertices this is a bijection
-    };
-
-    typedef std::pair<Uint, Uint> EdgeT;
-    typedef DROPS_STD_UNORDERED_MAP<EdgeT, Uint, UintPairHasherCL> EdgeToCutMapT;
+    static const Uint MaxNeighborsC= 14;                ///< maximal number of neighbors of a vertex in the principal lattice
+    static const Uint EntrySizeC= 1 + 2*MaxNeighborsC; ///< number of cuts, followed by the pairs (v1, number of the cut vertex)
 
     const PrincipalLatticeCL::const_vertex_iterator lattice_vertexes_;
-    VertexContT vertexes_;
-    EdgeToCutMapT edge_to_cut_;
+    VertexContT&       vertexes_;
+    std::vector<Uint>& edge_cuts_;
 
   public:
-    MergeCutPolicyCL (PrincipalLatticeCL::const_vertex_iterator lattice_vertexes)
-        : lattice_vertexes_( lattice_vertexes) {}
+    /// The cut vertexes are stored in vertexes, which is cleared; edge_cuts is the memory of the lookup-table.
+    MergeCutPolicyCL (const PrincipalLatticeCL& lat, VertexContT& vertexes, std::vector<Uint>& edge_cuts)
+        : lattice_vertexes_( lat.vertex_begin()), vertexes_( vertexes), edge_cuts_( edge_cuts) {
+        vertexes_.resize( 0);
+        edge_cuts_.resize( lat.vertex_size()*EntrySizeC);
+        for (Uint i= 0; i < lat.vertex_size(); ++i)
+            edge_cuts_[i*EntrySizeC]= 0;
+    }
 
     ///\brief Return the number of the cut vertex, if it is already memoized, otherwise add it and return its number.
     Uint operator() (Uint v0, Uint v1, double ls0, double ls1) {
-        const EdgeT e= v0 < v1 ? std::make_pair( v0, v1) : std::make_pair( v1, v0);
-        EdgeToCutMapT::const_iterator e_it= edge_to_cut_.find( e);
-        if (e_it != edge_to_cut_.end())
-            return e_it->second;
-        else {
-            const double edge_bary1_cut= ls0/(ls0 - ls1); // the root of the level set function on the edge
-            vertexes_.push_back( ConvexComb( edge_bary1_cut, lattice_vertexes_[v0], lattice_vertexes_[v1]));
-            return edge_to_cut_[e]= vertexes_.size() - 1;
-        }
+        Uint* const entry= &edge_cuts_[std::min( v0, v1)*EntrySizeC];
+        const Uint w= std::max( v0, v1);
+        for (Uint i= 0; i < entry[0]; ++i)
+            if (entry[1 + 2*i] == w)
+                return entry[2 + 2*i];
+
+        Assert( entry[0] < MaxNeighborsC, DROPSErrCL( "MergeCutPolicyCL::operator(): Too many neighbors.\n"), DebugNumericC);
+        const double edge_bary1_cut= ls0/(ls0 - ls1); // the root of the level set function on the edge
+        vertexes_.push_back( ConvexComb( edge_bary1_cut, lattice_vertexes_[v0], lattice_vertexes_[v1]));
+        Uint* const cut= entry + 1 + 2*entry[0]++;
+        cut[0]= w;
+        return cut[1]= vertexes_.size() - 1;
     }
 
     VertexContT& cut_vertex_container () { return vertexes_; }
@@ -44,7 +44,8 @@ template <class GridFunT>
 inline void
 copy_levelset_sign (const std::valarray<double>& src, std::valarray<byte>& dst)
 {
-    dst.resize( src.size());
+    if (dst.size() != src.size()) // valarray::resize always reallocates
+        dst.resize( src.size());
     std::transform( Addr( src), Addr( src) + src.size(), Addr( dst), sign);
 }
 
@@ -93,25 +94,24 @@ template <class VertexPartitionPolicyT,
     pos_tetra_begin_= 0;
     vertexes_.resize( 0);
 
-    std::valarray<byte> ls_sign;
-    copy_levelset_sign( ls, ls_sign);
+    copy_levelset_sign( ls, ls_sign_);
 
-    VertexCutMergingPolicyT edgecut( lat.vertex_begin()); // Stores the genuine cuts.
+    VertexCutMergingPolicyT edgecut( lat, cut_vertexes_, edge_cuts_); // Stores the genuine cuts.
 
-    TetraContT loc_tetras; // temporary container for the positive tetras.
+    pos_tetras_.resize( 0);
     double loc_ls[4];
     byte   loc_ls_sign[4];
     for (PrincipalLatticeCL::const_tetra_iterator lattice_tet= lat.tetra_begin(), lattice_end= lat.tetra_end(); lattice_tet != lattice_end; ++lattice_tet) {
-        copy_local_level_set_values( ls, ls_sign, *lattice_tet, loc_ls, loc_ls_sign);
+        copy_local_level_set_values( ls, ls_sign_, *lattice_tet, loc_ls, loc_ls_sign);
         const RefTetraPartitionCL& cut= RefTetraPartitionCL::instance( loc_ls_sign);
         for (RefTetraPartitionCL::const_tetra_iterator it= cut.tetra_begin(), end= cut.tetra_end(); it != end; ++it)
-            (cut.sign( it) == -1 ? tetras_ : loc_tetras).push_back( make_sub_tetra(
+            (cut.sign( it) == -1 ? tetras_ : pos_tetras_).push_back( make_sub_tetra(
                 *it, *lattice_tet, loc_ls, lattice_num_vertexes, edgecut));
     }
     pos_tetra_begin_= tetras_.size();
-    std::copy( loc_tetras. begin(), loc_tetras.end(), std::back_inserter( tetras_));
+    tetras_.insert( tetras_.end(), pos_tetras_.begin(), pos_tetras_.end());
 
-    VertexPartitionPolicyT vertex_order_policy( lat, ls, tetras_.begin(), tetras_.end(), pos_tetra_begin_);
+    VertexPartitionPolicyT vertex_order_policy( lat, ls_sign_, tetras_.begin(), tetras_.end(), pos_tetra_begin_);
     vertex_order_policy.sort_vertexes( vertexes_, edgecut.cut_vertex_container(), pos_vertex_begin_, neg_vertex_end_);
 }
 
@@ -155,35 +155,35 @@ template <class VertexCutMergingPolicyT>
 {
     triangles_.resize( 0);
     is_boundary_triangle_.resize( 0);
+    vertexes_.resize( 0);
 
-    std::valarray<byte> ls_sign;
-    copy_levelset_sign( ls, ls_sign);
+    copy_levelset_sign( ls, ls_sign_);
 
-    VertexCutMergingPolicyT edgecut( lat.vertex_begin());
+    VertexCutMergingPolicyT edgecut( lat, cut_vertexes_, edge_cuts_);
 
-    std::vector<Uint> copied_vertexes; // lookup-table for copied zero-vertexes from the lattice
-    std::vector<RenumberVertexPairT> zero_vertex_uses; // used to renumber the zero_vertexes
+    copied_vertexes_.resize( 0);
+    zero_vertex_uses_.resize( 0);
 
     double loc_ls[4];
     byte   loc_ls_sign[4];
     for (PrincipalLatticeCL::const_tetra_iterator lattice_tet= lat.tetra_begin(), lattice_end= lat.tetra_end();
         lattice_tet != lattice_end; ++lattice_tet) {
-        copy_local_level_set_values( ls, ls_sign, *lattice_tet, loc_ls, loc_ls_sign);
+        copy_local_level_set_values( ls, ls_sign_, *lattice_tet, loc_ls, loc_ls_sign);
         const RefTetraPatchCL& cut= RefTetraPatchCL::instance( loc_ls_sign);
         if (cut.empty()) continue;
         for (RefTetraPatchCL::const_triangle_iterator it= cut.triangle_begin(), end= cut.triangle_end(); it != end; ++it) {
             triangles_.push_back( make_sub_triangle(
-                *it, *lattice_tet, lat, loc_ls, copied_vertexes, zero_vertex_uses, edgecut));
+                *it, *lattice_tet, lat, loc_ls, copied_vertexes_, zero_vertex_uses_, edgecut));
             is_boundary_triangle_.push_back( cut.is_boundary_triangle());
         }
     }
 
     // Renumber the zero vertexes in the triangles, as they will be at offset #edge-cuts in vertexes_.
     const Uint num_genuine_cuts= edgecut.cut_vertex_container().size();
-    for (std::vector<RenumberVertexPairT>::const_iterator it= zero_vertex_uses.begin(); it != zero_vertex_uses.end(); ++it)
+    for (std::vector<RenumberVertexPairT>::const_iterator it= zero_vertex_uses_.begin(); it != zero_vertex_uses_.end(); ++it)
         triangles_[it->first][it->second]+= num_genuine_cuts;
-    // Prepend the edge-cuts to vertexes_
-    std::copy( vertexes_.begin(), vertexes_.end(), std::back_inserter( edgecut.cut_vertex_container()));
+    // Prepend the edge-cuts to vertexes_; the swap hands the memory of the zero vertexes to cut_vertexes_ for the next call.
+    edgecut.cut_vertex_container().insert( edgecut.cut_vertex_container().end(), vertexes_.begin(), vertexes_.end());
     vertexes_.swap( edgecut.cut_vertex_container());
 }
 
@@ -68,11 +68,20 @@ class AdapTriangCL
     double GetValue( scalar_fun_ptr dist, const VertexCL& v)  { return dist( v.GetCoord() ); }
     double GetValue( scalar_fun_ptr dist, const EdgeCL& e)    { return dist( GetBaryCenter( e) ); }
     double GetValue( scalar_fun_ptr dist, const TetraCL& t)   { return dist( GetBaryCenter( t) ); }
+    /// \brief Values in the 4 vertices, the 6 edges and the barycenter of t
+    template <class DistFctT>
+    void GetValues( const DistFctT& dist, const TetraCL& t, double val[11]);
+    void GetValues( const std::pair<const RepairSetCL*, size_t>& dist, const TetraCL& t, double val[11]);
     //@}
 
+    /// \brief Mark the tetras of the finest triangulation for refinement/removement; returns true, if a tetra was marked.
+    template <class DistFctT>
+    bool MarkTetras( DistFctT&);
     /// \brief On step of the grid change
     template <class DistFctT>
     bool ModifyGridStep( DistFctT&, bool lb=true);
+    /// \brief All grid changes of UpdateTriang with a single repair of the FE-functions by the observers
+    bool ModifyGridDeferred( const LevelsetP2CL& lset, int max_steps, int& steps);
 
     /// \name Call handlers (MGObserverCL) to manipulate FE-functions
     // @{
@@ -106,6 +115,32 @@ class AdapTriangCL
 #endif
     }
 
+    /// \brief True, if all observers support the deferred repair
+    bool observers_support_deferred_repair () const {
+        for (ObserverContT::const_iterator obs= observer_.begin(); obs != observer_.end(); ++obs)
+            if (!(*obs)->supports_deferred_repair())
+                return false;
+        return true;
+    }
+
+    /// \brief Tell Observer, that the MG will be refined several times and the repair is done once afterwards
+    void notify_pre_refine_deferred (RepairSetCL& repair) {
+        for (ObserverContT::iterator obs= observer_.begin(); obs != observer_.end(); ++obs)
+            (*obs)->pre_refine_deferred( repair);
+    }
+
+    /// \brief Tell Observer, that the last refinement of the sequence has been done and the functions will be repaired
+    void notify_pre_repair_deferred (RepairSetCL& repair) {
+        for (ObserverContT::iterator obs= observer_.begin(); obs != observer_.end(); ++obs)
+            (*obs)->pre_repair_deferred( repair);
+    }
+
+    /// \brief Tell Observer, that the functions have been repaired
+    void notify_post_refine_deferred () {
+        for (ObserverContT::iterator obs= observer_.begin(); obs != observer_.end(); ++obs)
+            (*obs)->post_refine_deferred();
+    }
+
     /// \brief Tell Observer, that a sequence of refinements (and migrations) will take place
     void notify_pre_refine_sequence() {
         for (ObserverContT::iterator obs= observer_.begin(); obs != observer_.end(); ++obs)
@@ -52,31 +52,42 @@ void AdapTriangCL::MakeInitialTriang( DistFctT& Dist)
 }
 
 template <class DistFctT>
-  bool AdapTriangCL::ModifyGridStep( DistFctT& Dist, bool lb)
-/** One step of grid change 
-    \param lb Do a load-balancing?
-    \return true if modifications were necessary,
-    false, if nothing changed. */
+  void AdapTriangCL::GetValues( const DistFctT& Dist, const TetraCL& t, double val[11])
+{
+    for (Uint j=0; j<4; ++j)
+        val[j]= GetValue( Dist, *t.GetVertex( j));
+    for (Uint j=0; j<6; ++j)
+        val[j+4]= GetValue( Dist, *t.GetEdge( j));
+    val[10]= GetValue( Dist, t);
+}
+
+inline void
+  AdapTriangCL::GetValues( const std::pair<const RepairSetCL*, size_t>& Dist, const TetraCL& t, double val[11])
+{
+    LocalP2CL<> lp2;
+    Dist.first->assign_on_tetra( Dist.second, lp2, t);
+    for (Uint j=0; j<10; ++j)
+        val[j]= lp2[j];
+    val[10]= lp2( BaryCoordCL( 0.25));
+}
+
+template <class DistFctT>
+  bool AdapTriangCL::MarkTetras( DistFctT& Dist)
 {
     bool modified= false;
+    double val[11];
     for (MultiGridCL::TriangTetraIteratorCL it= mg_.GetTriangTetraBegin(),
          end= mg_.GetTriangTetraEnd(); it!=end; ++it)
     {
+        GetValues( Dist, *it, val);
         double d= 1e99;
         int num_pos= 0;
-        for (Uint j=0; j<4; ++j)
-        {
-            const double dist= GetValue( Dist, *it->GetVertex( j));
-            if (dist>=0) ++num_pos;
-            d= std::min( d, std::abs( dist));
-        }
-        for (Uint j=0; j<6; ++j)
+        for (Uint j=0; j<10; ++j)
         {
-            const double dist= GetValue( Dist, *it->GetEdge( j));
-            if (dist>=0) ++num_pos;
-            d= std::min( d, std::abs( dist));
+            if (val[j]>=0) ++num_pos;
+            d= std::min( d, std::abs( val[j]));
         }
-        d= std::min( d, std::abs( GetValue( Dist, *it)));
+        d= std::min( d, std::abs( val[10]));
 
         const bool vzw= num_pos!=0 && num_pos!=10; // change of sign
         const Uint l= it->GetLevel();
@@ -93,6 +104,17 @@ template <class DistFctT>
                 it->SetRemoveMark();
         }
     }
+    return modified;
+}
+
+template <class DistFctT>
+  bool AdapTriangCL::ModifyGridStep( DistFctT& Dist, bool lb)
+/** One step of grid change 
+    \param lb Do a load-balancing?
+    \return true if modifications were necessary,
+    false, if nothing changed. */
+{
+    bool modified= MarkTetras( Dist);
 #ifdef _PAR
     modified= ProcCL::GlobalOr(modified);
 #endif
@@ -113,6 +135,35 @@ template <class DistFctT>
     return modified;
 }
 
+inline
+bool AdapTriangCL::ModifyGridDeferred (const LevelsetP2CL& lset, int max_steps, int& steps)
+/** All refinement steps of UpdateTriang are carried out without repairing the
+    FE-functions in between. The tetras are marked according to the level set
+    function on the original triangulation, which is evaluated by a RepairSetCL.
+    The observers register their functions in the same RepairSetCL before the first
+    refinement; all functions are repaired in one traversal of the final triangulation.
+    \param steps number of marking steps
+    \return true, if the triangulation has been modified. */
+{
+    RepairSetCL repair( mg_, lset.Phi.RowIdx->TriangLevel());
+    std::pair<const RepairSetCL*, size_t> dist( &repair, repair.push_back( lset.Phi, lset.GetBndData()));
+    bool modified= false;
+    for (steps= 0; steps < max_steps; ++steps) {
+        if (!MarkTetras( dist))
+            break;
+        if (!modified)
+            notify_pre_refine_deferred( repair);
+        modified= true;
+        mg_.Refine();
+    }
+    if (modified) {
+        notify_pre_repair_deferred( repair);
+        repair.repair();
+        notify_post_refine_deferred();
+    }
+    return modified;
+}
+
 inline
 void AdapTriangCL::UpdateTriang (const LevelsetP2CL& lset)
 /** This function updates the triangulation according to the position of the
@@ -133,6 +184,11 @@ void AdapTriangCL::UpdateTriang (const LevelsetP2CL& lset)
     LevelsetP2CL::const_DiscSolCL sol( lset.GetSolution());
 
     notify_pre_refine_sequence();
+#ifndef _PAR
+    if (observers_support_deferred_repair())
+        modified_= ModifyGridDeferred( lset, 2*min_ref_num, i);
+    else
+#endif
     for (i= 0; i < 2*min_ref_num; ++i) {
         if (!ModifyGridStep(sol, true)){
             break;
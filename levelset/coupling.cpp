@@ -39,7 +39,8 @@ TimeDisc2PhaseCL::TimeDisc2PhaseCL (StokesT& Stokes, LevelsetP2CL& ls, LevelsetM
     cplN_( new VelVecDescCL), old_cplN_( new VelVecDescCL),
     curv_( new VelVecDescCL), old_curv_(new VelVecDescCL),
     rhs_( Stokes.b.RowIdx->NumUnknowns()), ls_rhs_( ls.Phi.RowIdx->NumUnknowns()),
-    mat_( new MLMatrixCL( Stokes.vel_idx.size())), L_( new MatrixCL()), dt_(dt), nonlinear_( nonlinear), lsetmod_( lsetmod)
+    mat_( new MLMatrixCL( Stokes.vel_idx.size())), L_( new MatrixCL()), dt_(dt), nonlinear_( nonlinear),
+    cplIter_( 1), cplConverged_( true), lsetmod_( lsetmod), unmodPhi_( 0)
 {
     Stokes_.SetLevelSet( ls);
     LB_.Data.resize( Stokes.vel_idx.size());
@@ -57,6 +58,124 @@ TimeDisc2PhaseCL::~TimeDisc2PhaseCL()
     delete curv_; delete old_curv_;
 }
 
+// ==============================================
+//              TimeStepControlCL
+// ==============================================
+
+TimeStepControlCL::TimeStepControlCL (TimeDisc2PhaseCL& timedisc, double dt, double dt_min, double dt_max, double tol,
+    double cfl, int target_iter, double t_end)
+  : timedisc_( timedisc), dt_( dt), dt_min_( dt_min), dt_max_( dt_max), tol_( tol), cfl_( cfl), t_end_( t_end),
+    target_iter_( target_iter), dt_cfl_( -1.), t_( 0.), dt_old_( -1.), rejected_( 0)
+{
+    timedisc_.SetUnmodifiedPhi( &phi_new_);
+}
+
+void TimeStepControlCL::InitStep ()
+{
+    StokesT& Stokes= timedisc_.GetStokes();
+    if (dt_cfl_ < 0.)
+        dt_cfl_= Stokes.GetCFLTimeRestriction( timedisc_.GetLset());
+    dt_= std::max( dt_min_, std::min( dt_, cfl_*dt_cfl_));
+    t_= timedisc_.GetTime();
+    dt_= std::min( dt_, t_end_ - t_);
+
+    v_.resize( Stokes.v.Data.size());
+    v_= Stokes.v.Data;
+    p_.resize( Stokes.p.Data.size());
+    p_= Stokes.p.Data;
+    const VectorCL& phi= timedisc_.GetLset().Phi.Data;
+    phi_.resize( phi.size());
+    phi_= phi;
+    phi_new_.resize( 0); // filled by the step
+    timedisc_.SetTimeStep( dt_);
+}
+
+const VectorCL& TimeStepControlCL::NewPhi () const
+{
+    const VectorCL& phi= timedisc_.GetLset().Phi.Data;
+    return phi_new_.size() == phi.size() ? phi_new_ : phi;
+}
+
+double TimeStepControlCL::ErrorEstimate () const
+{
+    const StokesT& Stokes= timedisc_.GetStokes();
+    const LevelsetP2CL& lset= timedisc_.GetLset();
+    const VectorCL& phi= NewPhi();
+    if (dt_old_ <= 0. || dv_old_.size() != v_.size() || v_.size() != Stokes.v.Data.size()
+        || dphi_old_.size() != phi_.size() || phi_.size() != phi.size())
+        return 0.;
+
+    const double r= dt_/dt_old_; // linear extrapolation: x_n + r*(x_n - x_{n-1})
+    double err_v= dt_*supnorm( VectorCL( Stokes.v.Data - v_ - r*dv_old_)),
+           err_phi= 0.;
+    const InterfaceBandCL* band= lset.GetBand();
+    if (band == 0)
+        err_phi= supnorm( VectorCL( phi - phi_ - r*dphi_old_));
+    else {
+        IdxT numb[10];
+        const InterfaceBandCL::TetraVecT& tetras= band->GetTetras();
+        for (InterfaceBandCL::TetraVecT::const_iterator it= tetras.begin(); it != tetras.end(); ++it) {
+            GetLocalNumbP2NoBnd( numb, **it, *lset.Phi.RowIdx);
+            for (int i= 0; i < 10; ++i)
+                err_phi= std::max( err_phi, std::fabs( phi[numb[i]] - phi_[numb[i]] - r*dphi_old_[numb[i]]));
+        }
+    }
+#ifdef _PAR
+    err_v=   ProcCL::GlobalMax( err_v);
+    err_phi= ProcCL::GlobalMax( err_phi);
+#endif
+    return std::max( err_v, err_phi);
+}
+
+void TimeStepControlCL::Restore ()
+{
+    StokesT& Stokes= timedisc_.GetStokes();
+    LevelsetP2CL& lset= timedisc_.GetLset();
+    lset.Phi.Data= phi_;
+    Stokes.v.Data= v_;
+    Stokes.v.t= Stokes.p.t= lset.Phi.t= t_;
+    if (Stokes.UsesXFEM()) { // the extended pressure belongs to the restored level set function
+        Stokes.UpdateXNumbering( &Stokes.pr_idx, lset);
+        Stokes.UpdatePressure( &Stokes.p);
+    }
+    if (Stokes.p.Data.size() == p_.size())
+        Stokes.p.Data= p_;
+    timedisc_.Update();
+}
+
+bool TimeStepControlCL::CommitStep ()
+{
+    const int    iter= timedisc_.GetCouplingIter();
+    const bool   converged= timedisc_.CouplingConverged();
+    const double err= ErrorEstimate();
+
+    double fac= 2.;
+    if (err > 0.)
+        fac= std::min( fac, 0.9*std::sqrt( tol_/err));
+    if (iter > target_iter_)
+        fac= std::min( fac, double( target_iter_)/iter);
+    if (!converged)
+        fac= std::min( fac, 0.5);
+
+    const bool accept= dt_ <= dt_min_*(1. + 1e-12) || (converged && err <= tol_);
+    std::cout << "TimeStepControlCL: dt: " << dt_ << "\tcoupling iterations: " << iter << (converged ? "" : " (not converged)")
+              << "\terror estimate: " << err << "\tCFL-restriction: " << dt_cfl_ << (accept ? "\taccepted" : "\trejected") << std::endl;
+    if (accept) {
+        dt_old_= dt_;
+        dv_old_.resize( v_.size());
+        dv_old_= timedisc_.GetStokes().v.Data - v_;
+        dphi_old_.resize( phi_.size());
+        dphi_old_= NewPhi() - phi_;
+        dt_cfl_= -1.;
+    }
+    else {
+        ++rejected_;
+        Restore();
+    }
+    dt_= std::min( dt_max_, fac*dt_);
+    return accept;
+}
+
 void cplDeltaSquaredPolicyCL::Update( VecDescCL& v)
 {
     if (firststep_) {
@@ -30,6 +30,7 @@
 #include "num/MGsolver.h"
 #include "num/nssolver.h"
 #include <vector>
+#include <limits>
 #ifdef _PAR
 #include "num/parstokessolver.h"
 #endif
@@ -55,14 +56,24 @@ class TimeDisc2PhaseCL
 
     double       dt_;
     const double nonlinear_;
+    int          cplIter_;            // number of coupling iterations of the last step
+    bool         cplConverged_;       // false, if the coupling iteration of the last step did not converge
 
     LevelsetModifyCL& lsetmod_;
+    VectorCL*    unmodPhi_;           // if not zero, receives the level set function before volume correction and reparametrization
 
     VecDescCL    cplLB_;
     MLMatDescCL  LB_;
 
     SchurPreBaseCL* ispc_;             // pointer to preconditioner for the schur complement
 
+    /// \brief Copy the level set function to *unmodPhi_; call after the level set solver and before lsetmod_ is applied.
+    void StoreUnmodifiedPhi() {
+        if (unmodPhi_ == 0) return;
+        unmodPhi_->resize( LvlSet_.Phi.Data.size());
+        *unmodPhi_= LvlSet_.Phi.Data;
+    }
+
   public:
     TimeDisc2PhaseCL( StokesT& Stokes, LevelsetP2CL& ls, LevelsetModifyCL& lsetmod, double dt, double nonlinear=1.);
     virtual ~TimeDisc2PhaseCL();
@@ -84,6 +95,13 @@ class TimeDisc2PhaseCL
     virtual void SetTimeStep (double dt) {dt_= dt;}
     virtual void DoStep( int maxFPiter= -1) = 0;
 
+    /// \brief Number of coupling iterations of the last step; 1 for the schemes without coupling iteration.
+    int  GetCouplingIter()      const { return cplIter_; }
+    /// \brief False, if the coupling iteration of the last step stopped at the maximal number of iterations.
+    bool CouplingConverged()    const { return cplConverged_; }
+    /// \brief The level set function of each step is copied to *phi before the volume correction and the reparametrization; 0 disables the copy.
+    void SetUnmodifiedPhi( VectorCL* phi) { unmodPhi_= phi; }
+
     // update after grid has changed
     virtual void Update() = 0;
     
@@ -173,6 +191,69 @@ class OperatorSplitting2PhaseCL : public TimeDisc2PhaseCL
 
 
 //forward declarations
+/// \brief Adaptive time step for a TimeDisc2PhaseCL-object with rejection of steps.
+/** Before each step, the velocity, the pressure, the level set function and the time are stored. After the step,
+    it is rejected and the stored state is restored, if the coupling iteration did not converge or if the error
+    estimate exceeds the tolerance. The error estimate is the difference of the increment of the step and the
+    increment of the last step scaled with the ratio of the time steps; for the level set function, it is taken on the
+    interface band, and the velocity difference is multiplied with the time step. Thus, both estimate the error of the
+    position of the interface. The level set increments are taken before the volume correction and the reparametrization
+    of LevelsetModifyCL, which are not part of the time discretization error.
+
+    The next time step is the minimum of
+    - the last time step times the growth factor 2,
+    - the time step for the tolerance, assuming a local error of second order,
+    - the time step reduced by the ratio of the targeted and the needed number of coupling iterations,
+    - the CFL-factor times the restriction of InstatStokes2PhaseP2P1CL::GetCFLTimeRestriction for convection, viscosity, gravity and surface tension,
+    - the maximal time step and the time left to the end time.
+
+    Time steps are not reduced below the minimal time step, and such steps are always accepted.
+*/
+class TimeStepControlCL
+{
+  private:
+    TimeDisc2PhaseCL& timedisc_;
+    double   dt_,               ///< time step of the next step
+             dt_min_,
+             dt_max_,
+             tol_,              ///< tolerance for the error estimate
+             cfl_,              ///< factor for the CFL-restriction
+             t_end_;            ///< end time of the simulation
+    int      target_iter_;      ///< targeted number of coupling iterations
+    double   dt_cfl_;           ///< CFL-restriction for the state before the step; negative, if not computed
+    double   t_;                ///< time and solution before the step
+    VectorCL v_, p_, phi_;
+    VectorCL phi_new_;          ///< level set function of the step before volume correction and reparametrization
+    double   dt_old_;           ///< last accepted time step and its increments of velocity and level set function; dt_old_ <= 0, if not available
+    VectorCL dv_old_, dphi_old_;
+    int      rejected_;         ///< number of rejected steps
+
+    /// \brief Level set function of the step before volume correction and reparametrization
+    const VectorCL& NewPhi() const;
+
+    /// \brief Estimate of the error of the step; 0, if there is no last step
+    double ErrorEstimate() const;
+    /// \brief Restore the solution and time before the step
+    void   Restore();
+
+  public:
+    TimeStepControlCL( TimeDisc2PhaseCL& timedisc, double dt, double dt_min, double dt_max, double tol,
+                       double cfl= 0.5, int target_iter= 5, double t_end= std::numeric_limits<double>::max());
+    ~TimeStepControlCL() { timedisc_.SetUnmodifiedPhi( 0); }
+
+    /// \brief Store the solution and set the time step of the time discretization; call before TimeDisc2PhaseCL::DoStep.
+    void InitStep();
+    /// \brief Accept the step of TimeDisc2PhaseCL::DoStep or reject it and restore the solution; the next time step is computed. Returns true, if the step was accepted.
+    bool CommitStep();
+    /// \brief Discard the last step for the error estimate; call together with TimeDisc2PhaseCL::Update, if the grid or the numbering changed.
+    void Update() { dt_old_= -1.; dt_cfl_= -1.; }
+
+    double GetTimeStep() const { return dt_; }
+    int    GetRejected() const { return rejected_; }
+    /// \brief True, if the end time is reached.
+    bool   Finished()    const { return timedisc_.GetTime() >= t_end_ - 1e-12*std::max( 1., std::fabs( t_end_)); }
+};
+
 class cplDeltaSquaredPolicyCL;
 class cplFixedPolicyCL;
 class cplBroydenPolicyCL;
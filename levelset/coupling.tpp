@@ -71,15 +71,13 @@ void LinThetaScheme2PhaseCL<LsetSolverT>::SolveLsNs()
         mat_->LinComb( 1./dt_, Stokes_.M.Data, stk_theta_, Stokes_.A.Data);
     else // semi-implicit treatment of curvature term, cf. Baensch
     {
-        MLMatrixCL mat0;
-        mat0.LinComb( 1./dt_, Stokes_.M.Data, stk_theta_, Stokes_.A.Data);
         // The MatrixBuilderCL's method of determining when to reuse the pattern
         // is not save for matrix LB_
         LB_.Data.clear();
         LB_.Data.resize( Stokes_.A.Data.size());
         LB_.SetIdx( &Stokes_.vel_idx, &Stokes_.vel_idx);
         Stokes_.SetupLB( &LB_, &cplLB_, LvlSet_, Stokes_.v.t);
-        mat_->LinComb( 1., mat0, dt_, LB_.Data);
+        mat_->LinComb( 1./dt_, Stokes_.M.Data, stk_theta_, Stokes_.A.Data, dt_, LB_.Data);
     }
     time.Stop();
     duration=time.GetTime();
@@ -103,6 +101,7 @@ void LinThetaScheme2PhaseCL<LsetSolverT>::SolveLsNs()
     duration=time.GetTime();
     std::cout << "Solving Levelset took " << duration << " sec.\n";
 
+    StoreUnmodifiedPhi();
     lsetmod_.maybeDoVolCorr( LvlSet_);
     lsetmod_.maybeDoReparam( LvlSet_);
 
@@ -566,6 +565,7 @@ void CoupledTimeDisc2PhaseBaseCL<LsetSolverT,RelaxationPolicyT>::EvalLsetNavStok
     duration=time.GetTime();
     std::cout << "Solving Levelset took " << duration << " sec.\n";
 
+    StoreUnmodifiedPhi();
     dphi_ = lsetmod_.maybeDoVolCorr( LvlSet_);
 
     time.Reset();
@@ -641,6 +641,8 @@ void CoupledTimeDisc2PhaseBaseCL<LsetSolverT,RelaxationPolicyT>::DoStep( int max
     ExchangeCL& ExVel  = Stokes_.v.RowIdx->GetEx();
 #endif
     double res_u = 0.0;
+    cplIter_= maxFPiter;
+    cplConverged_= false;
     for (int i=0; i<maxFPiter; ++i)
     {
         std::cout << "~~~~~~~~~~~~~~~~ FP-Iter " << i+1 << '\n';
@@ -649,6 +651,8 @@ void CoupledTimeDisc2PhaseBaseCL<LsetSolverT,RelaxationPolicyT>::DoStep( int max
         if (solver_.GetIter()==0 && lsetsolver_.GetResid()<lsetsolver_.GetTol()) // no change of vel -> no change of Phi
         {
             std::cout << "Convergence after " << i+1 << " fixed point iterations!" << std::endl;
+            cplIter_= i+1;
+            cplConverged_= true;
             break;
         }
         Stokes_.v.Data = v - Stokes_.v.Data;
@@ -668,6 +672,8 @@ void CoupledTimeDisc2PhaseBaseCL<LsetSolverT,RelaxationPolicyT>::DoStep( int max
 
         if (res_u < tol_) {
             std::cout << "Convergence after " << i+1 << " fixed point iterations!" << std::endl;
+            cplIter_= i+1;
+            cplConverged_= true;
             break;
         }
     }
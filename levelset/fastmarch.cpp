@@ -33,12 +33,8 @@
 #ifdef _OPENMP
 #  include <omp.h>
 #endif
-#if __GNUC__ >= 4 && !defined(__INTEL_COMPILER)
-#    include <tr1/unordered_map>
-#else
-#    include <map>
-#endif
 #include <set>
+#include <numeric>
 #ifdef MINPACK
 #  include <cminpack.h>
 #endif
@@ -154,18 +150,24 @@ InitZeroCL::~InitZeroCL()
 //----------------------------------
 
 /** Iterate over all tetrahedra and check, if a child is intersected by the zero level
-    of the level set function
+    of the level set function. The values are replaced by their absolute values only after
+    all tetras have been checked, as the intersection test depends on the signs.
 */
 void InitZeroNoModCL::Perform()
 {
-    InterfaceTriangleCL patch;                              // check for intersection
-    LocalNumbP2CL       n;                                  // local numbering of dof
     const RefRuleCL    RegRef= GetRefRule( RegRefRuleC);    // determine regular children
     const int lvl= base::data_.phi.GetLevel();
+    // the triangulation is created outside of the parallel region
+    const MultiGridCL::TriangTetraIteratorCL begin= data_.mg.GetTriangTetraBegin(lvl);
+    const int num_tetra= std::distance( begin, data_.mg.GetTriangTetraEnd(lvl));
 
-#pragma omp parallel for
-    for ( int i=0; i<std::distance(data_.mg.GetTriangTetraBegin(lvl), data_.mg.GetTriangTetraEnd(lvl)); ++i ){
-        MultiGridCL::TriangTetraIteratorCL it= data_.mg.GetTriangTetraBegin(lvl)+i;
+#pragma omp parallel
+{
+    InterfaceTriangleCL patch;                              // check for intersection
+    LocalNumbP2CL       n;                                  // local numbering of dof
+#pragma omp for
+    for ( int i=0; i<num_tetra; ++i ){
+        MultiGridCL::TriangTetraIteratorCL it= begin+i;
         patch.Init( *it, base::data_.phi, *base::data_.bnd);
         if ( patch.Intersects()){                                       // tetra (*it) is intersected
             n.assign( *it, *base::data_.phi.RowIdx, BndDataCL<>(0));    // create local numbering
@@ -173,234 +175,20 @@ void InitZeroNoModCL::Perform()
                 if (patch.ComputeForChild( ch)){                        // Child ch has an intersection
                     const ChildDataCL data= GetChildData( RegRef.Children[ch]);
                     // mark all vertices as finished
-                    for ( int vert=0; vert<4; ++vert){
-                        IdxT dof= data_.Map( n.num[ data.Vertices[vert]]);
+                    for ( int vert=0; vert<4; ++vert) {
+                        const IdxT dof= data_.Map( n.num[ data.Vertices[vert]]);
 #pragma omp critical
-{
                         base::data_.typ[ dof]= data_.Finished;
-                        base::data_.phi.Data[ dof]= std::abs(base::data_.phi.Data[ dof]);
-}
                     }
                 }
             }
         }
     }
 }
-
-// I N I T  Z E R O  E X A C T  C L
-//---------------------------------
-
-/// \brief The class provides, for each tetra, that is cut by the interface, a set of all levelset-unknowns, that are at most two tetras away. Only levelset-unknowns are considered, that belong to a tetra that is cut by the interface.
-///
-/// Consider the graph with level-set-unknowns (and their respective periodic unknowns) at the interface as vertices. The edges of the graph are tetras.
-/// The class computes, for each vertex, the set of vertices that are at most two edges away.
-/// The algorithm is breadth-first search. This mapping is inverted to provide the desired map.
-/// The work is done in the constructor. The resulting map can be accessed via operator().
-///
-/// The parallelization of this class probably involves a lot of work.
-class TetraNeighborCL
-{
-  public:
-    typedef std::set<IdxT> IdxSetT;
-#if __GNUC__ >= 4 && !defined(__INTEL_COMPILER)
-    typedef std::tr1::unordered_map<const TetraCL*, IdxSetT> TetraToIdxMapT;
-#else
-    typedef std::map<const TetraCL*, IdxSetT> TetraToIdxMapT;
-#endif
-    typedef std::vector<std::pair<const TetraCL*, IdxSetT> > TetraToIdxVecT;
-
-  private:
-    typedef std::set<const TetraCL*> TetraSetT;
-    typedef std::vector<TetraSetT>   IdxToTetraMapT;
-
-    IdxToTetraMapT idx_to_tetra_; ///< Used to accumulate the reverse of the desired mapping; cleared at the end of the constructor.
-    TetraToIdxMapT tetra_to_idx_; ///< A set of levelset-unknowns for each tetra, that is cut by the interface.
-
-    ///
-    /// \brief Updates the neighborhood information: traverse all outgoing edges (=tetras) of idx and add them to their end-vertices.
-    void insert_neighbor_tetras (size_t idx, const TetraCL& t, Uint ls_idx, const IdxToTetraMapT& idx_to_tetra);
-    /// \brief Traverse the edges of the graph and update the vertex-neighborhoods.
-    void ComputeNeighborTetras (const MultiGridCL& mg, const VecDescCL& ls, const BndDataCL<>& lsetbnd, const ReparamDataCL::perMapVecT& mapPerDoF);
-    /// \brief Reverse the map produced by ComputeNeighborTetras().
-    void ComputeIdxToTetraMap ();
-
-  public:
-    TetraNeighborCL (const MultiGridCL& mg, const VecDescCL& ls, const BndDataCL<>& lsetbnd, const ReparamDataCL::perMapVecT& mapPerDoF)
-    {
-        ComputeNeighborTetras ( mg, ls, lsetbnd, mapPerDoF);
-        ComputeIdxToTetraMap ();
-        idx_to_tetra_.clear();
-    }
-
-    /// \brief Accessor to the map from levelset-unknowns to tetras.
-    TetraToIdxMapT& operator() () { return tetra_to_idx_; }
-
-    /// \brief Accessor to the map tetra_to_idx_ as a vector (used for OpenMP purpose)
-    TetraToIdxVecT GetTetraToIdxAsVector() { return Map2Vec(tetra_to_idx_); }
-};
-
-void TetraNeighborCL::insert_neighbor_tetras (size_t idx, const TetraCL& t, Uint ls_idx,
-    const IdxToTetraMapT& idx_to_tetra)
-{
-    IdxT idx_j;
-    for (Uint j= 0; j < 4; ++j) {
-        idx_j= t.GetVertex( j)->Unknowns( ls_idx);
-        idx_to_tetra_[idx].insert( idx_to_tetra[idx_j].begin(), idx_to_tetra[idx_j].end());
-    }
-    for (Uint j= 0; j < 6; ++j) {
-        idx_j= t.GetEdge( j)->Unknowns( ls_idx);
-        idx_to_tetra_[idx].insert( idx_to_tetra[idx_j].begin(), idx_to_tetra[idx_j].end());
-    }
-}
-
-void TetraNeighborCL::ComputeNeighborTetras (const MultiGridCL& mg, const VecDescCL& ls, const BndDataCL<>& lsetbnd, const ReparamDataCL::perMapVecT& mapPerDoF)
-{
-    const DROPS::Uint lvl= ls.GetLevel();
-    const Uint ls_idx= ls.RowIdx->GetIdx();
-    const IdxT ls_size= ls.Data.size();
-
-    DROPS::InterfacePatchCL patch;
-    IdxToTetraMapT idx_to_tetra1( ls_size);
-    idx_to_tetra_.resize( ls_size + mapPerDoF.size());
-
-    // Record for each index, which tetras are immediate neighbors. Do this only around the interface.
-    DROPS_FOR_TRIANG_CONST_TETRA( mg, lvl, it) {
-        patch.Init( *it, ls, lsetbnd);
-        if (!patch.Intersects()) continue;
-
-        for (Uint i= 0; i < 4; ++i)
-            idx_to_tetra1[it->GetVertex( i)->Unknowns( ls_idx)].insert( &*it);
-        for (Uint i= 0; i < 6; ++i)
-            idx_to_tetra1[it->GetEdge( i)->Unknowns( ls_idx)].insert( &*it);
-    }
-
-    // Record now also the neighbors of neighbors. Do this only, if the idx belongs to a tetra that is cut by the interface.
-    IdxT idx;
-    DROPS_FOR_TRIANG_CONST_TETRA( mg, lvl, it) {
-        for (Uint i= 0; i < 4; ++i) {
-            idx= it->GetVertex( i)->Unknowns( ls_idx);
-            if (idx_to_tetra1[idx].empty()) continue; // The vertex has no tetra on an interface.
-            insert_neighbor_tetras( idx, *it, ls_idx, idx_to_tetra1);
-        }
-        for (Uint i= 0; i < 6; ++i) {
-            idx= it->GetEdge( i)->Unknowns( ls_idx);
-            if (idx_to_tetra1[idx].empty()) continue; // The edge has no tetra on an interface.
-            insert_neighbor_tetras( idx, *it, ls_idx, idx_to_tetra1);
-        }
-    }
-
-    // for dof's on periodic boundaries the respective entries of idx_to_tetra_ are copied
-    for (size_t i=0, s= mapPerDoF.size(); i<s; ++i) {
-        const IdxT augm_dof= ls_size + i,
-                        dof= mapPerDoF[i];
-        idx_to_tetra_[augm_dof]= idx_to_tetra_[dof];
-    }
-}
-
-void TetraNeighborCL::ComputeIdxToTetraMap ()
-{
-    for (size_t idx= 0; idx < idx_to_tetra_.size(); ++idx)
-        for (TetraSetT::iterator sit= idx_to_tetra_[idx].begin(); sit != idx_to_tetra_[idx].end(); ++sit)
-            tetra_to_idx_[*sit].insert( idx);
-}
-
-/// \brief Computes the distance d from a point p to the triangle tri_.
-///
-/// The latter is given via the world coordinates of its vertices in the constructor.
-///
-/// The base point l is the point in tri with distance d from p. Although currently not used,
-/// the code to compute l is tested and functional. l is given in barycentric coordinates with respect to tri.
-class ExactDistanceInitCL
-{
-  private:
-    /// \brief Computes the distance d of a point p to the line through v0, v1.  If the base l is not in the segment [v0, v1], returns false.
-    static bool dist (const Point3DCL& v0, const Point3DCL& v1, const Point3DCL& p, double& d /*, Point2DCL& l*/);
-
-    const Point3DCL* tri_; ///< The current triangle to which distances are computed; *no* copies of the points.
-    QRDecompCL<3,2> qr_;
-
-  public:
-    ExactDistanceInitCL (const Point3DCL tri[3]);
-
-    /// \brief Computes the distance d from a point p to the triangle tri_. The latter is given via the world coordinates of its vertices.
-    void dist (/*const Point3DCL tri[3],*/ const Point3DCL& p, double& d /*, SVectorCL<3>& l*/);
-
-    /// \brief Simple tests to check the correctness of local distance computations manually.
-    static void Test ();
-};
-
-ExactDistanceInitCL::ExactDistanceInitCL (const Point3DCL tri[3])
-    : tri_( tri)
-{
-    SMatrixCL<3,2> M( Uninitialized);
-    M.col( 0, tri[1] - tri[0]);
-    M.col( 1, tri[2] - tri[0]);
-    qr_.GetMatrix()= M;
-    qr_.prepare_solve();
-}
-
-void ExactDistanceInitCL::Test ()
-{
-    Point3DCL tri[3];
-    tri[0]= std_basis<3>( 0);
-    tri[1]= std_basis<3>( 1);
-//    tri[2]= std_basis<3>( 2);
-    tri[2]= tri[1]+1e-5*std_basis<3>( 2);
-    ExactDistanceInitCL dist_to_tri( tri);
-
-    Point3DCL p= std_basis<3>( 3);
-    p[0]= .5;
-    p[1]= -1e5;
-//    p= -p;
-    double d;
-    Point3DCL l;
-    dist_to_tri.dist( /*tri,*/ p, d /*, l*/);
-    std::cerr.precision( 20);
-    std::cerr << "p: " << p << " d: " << d << std::endl; // << " l: " << l << std::endl;
-}
-
-bool ExactDistanceInitCL::dist (const Point3DCL& v0, const Point3DCL& v1, const Point3DCL& p, double& d /*, Point2DCL& l*/)
-{
-    const double ll= inner_prod( v1 - v0, p - v0)/(v1 - v0).norm_sq();
-    if (ll >= 0. && 1. - ll >= 0.) {
-        d= ((1. - ll)*v0 + ll*v1 - p).norm(); // l= MakePoint2D( 1. - ll, ll);
-        return true;
-    }
-    return false;
-}
-
-void ExactDistanceInitCL::dist (/*const Point3DCL tri[3],*/ const Point3DCL& p, double& d /*, SVectorCL<3>& l*/)
-{
-//     SMatrixCL<3,2> M;
-//     M.col( 0, tri[1] - tri[0]);
-//     M.col( 1, tri[2] - tri[0]);
-//     QRDecompCL<3, 2> qr( M);*/
-    Point3DCL ll( p - tri_[0]);
-    qr_.Solve( ll); // The first two components are the least-squares-solution, the last is the residual.
-
-    if (ll[0] >= 0. && ll[1] >= 0. && 1. - ll[0] - ll[1] >= 0.) {
-        d= std::fabs( ll[2]); // l= MakePoint3D( 1. - ll[0] - ll[1], ll[0], ll[1]);
-        return;
-    }
-
-    // Compute the distance to the three boundary segments.
-    double tmpd;
-    // Point2DCL ll2;
-    if (ll[1] < 0. && ExactDistanceInitCL::dist( tri_[0], tri_[1], p, tmpd /*, ll2*/)) {
-        d= tmpd; // l= MakePoint3D( ll2[0], ll2[1], 0.);
-        return;
-    }
-    if (ll[0] < 0. && ExactDistanceInitCL::dist( tri_[0], tri_[2], p, tmpd /*, ll2*/)) {
-        d= tmpd; // l= MakePoint3D( ll2[0], 0., ll2[1]);
-        return;
-    }
-    if (1. - ll[0] - ll[1] < 0. && ExactDistanceInitCL::dist( tri_[1], tri_[2], p, tmpd /*, ll2*/)) {
-        d= tmpd; // l= MakePoint3D( 0., ll2[0], ll2[1]);
-        return;
-    }
-
-    // Compute the distance to the vertices.
-    d= std::min( (p - tri_[0]).norm(), std::min( (p - tri_[1]).norm(), (p - tri_[2]).norm()));
+#pragma omp parallel for schedule(static)
+    for ( int dof=0; dof<(int)base::data_.typ.size(); ++dof)
+        if ( base::data_.typ[dof]==data_.Finished)
+            base::data_.phi.Data[dof]= std::abs( base::data_.phi.Data[dof]);
 }
 
 // I N I T  Z E R O  E X A C T  C L
@@ -618,10 +406,14 @@ void InitZeroExactCL::DisplayMem() const
     for ( size_t i=0; i<dofToDistTriang_.size(); ++i)
         memDofToDist+= 8*dofToDistTriang_[i].size();
 
+    const size_t memCSR= 8*(cutTetra_.size() + cutTetraTriangBegin_.size() + dofToCutBegin_.size()
+                            + dofToCut_.size() + dofToTetraBegin_.size() + dofToTetraCSR_.size());
+
     const size_t memByte=   distTriang_.size()*memPerDistTriang     // all distance Triangles
                           + distTriangPos_.size()*memPerTriangPos   // find position of triangle
                           + memDofToTetra                           // dof -> {intersected tera}
-                          + memDofToDist;                           // dof -> {distance Triangles}
+                          + memDofToDist                            // dof -> {distance Triangles}
+                          + memCSR;                                 // adjacencies in CSR format
     double mem=(double)memByte/1024/1024;
 #ifdef _PAR
     mem= ProcCL::GlobalMax(mem);
@@ -667,12 +459,166 @@ void InitZeroExactCL::DetermineDistances()
 }
 }
 
+/** The intersected tetras are distributed statically among the threads. Each thread stores the
+    triangles of its tetras; afterwards, the triangles are concatenated in the order of the threads.*/
+void InitZeroExactCL::BuildDistTriangCSR()
+{
+    const Uint lvl= data_.phi.GetLevel();
+    const MultiGridCL& mg= data_.mg;
+    const MultiGridCL::const_TriangTetraIteratorCL begin= mg.GetTriangTetraBegin( lvl);
+    const int num_tetra= std::distance( begin, mg.GetTriangTetraEnd( lvl));
+
+    const int num_threads= omp_get_max_threads();
+    std::vector<std::vector<const TetraCL*> > cut( num_threads);
+    std::vector<std::vector<size_t> >         triang_begin( num_threads);
+    std::vector<DistTriangVecT>               triang( num_threads);
+#pragma omp parallel
+{
+    const int t= omp_get_thread_num();
+    InterfaceTriangleCL patch;
+#pragma omp for schedule(static)
+    for (int i= 0; i < num_tetra; ++i) {
+        const TetraCL& tet= *(begin + i);
+        patch.Init( tet, data_.phi, *data_.bnd);
+        if (!patch.Intersects()) continue;
+        cut[t].push_back( &tet);
+        triang_begin[t].push_back( triang[t].size());
+        for (int ch= 0; ch < 8; ++ch) {
+            if (!patch.ComputeForChild( ch)) continue; // Child ch has no intersection
+            for (int tri= 0; tri < patch.GetNumTriangles(); ++tri)
+                triang[t].push_back( DistanceTriangCL( &patch.GetPoint( tri)));
+        }
+    }
+}
+    for (int t= 0; t < num_threads; ++t) {
+        for (size_t k= 0; k < cut[t].size(); ++k)
+            cutTetraTriangBegin_.push_back( distTriang_.size() + triang_begin[t][k]);
+        cutTetra_.insert( cutTetra_.end(), cut[t].begin(), cut[t].end());
+        distTriang_.insert( distTriang_.end(), triang[t].begin(), triang[t].end());
+    }
+    cutTetraTriangBegin_.push_back( distTriang_.size());
+}
+
+/** Only dof, which belong to an intersected tetra, obtain tetras in dofToTetraCSR_. The
+    neighbor-neighbor tetras of such a dof are the intersected tetras of the dof of dofToTetraCSR_.
+    \pre BuildDistTriangCSR has been called */
+void InitZeroExactCL::InitDofToTetraCSR()
+{
+    const Uint lvl= data_.phi.GetLevel();
+    const Uint idx= data_.phi.RowIdx->GetIdx();
+    const IdxT size= data_.phi.Data.size();
+    const MultiGridCL& mg= data_.mg;
+    IdxT dof;
+
+    // dof -> intersected tetras
+    dofToCutBegin_.assign( size + 1, 0);
+    for (size_t k= 0; k < cutTetra_.size(); ++k)
+        for (Uint i= 0; i < 10; ++i)
+            ++dofToCutBegin_[((i<4) ? cutTetra_[k]->GetVertex( i)->Unknowns( idx) : cutTetra_[k]->GetEdge( i-4)->Unknowns( idx)) + 1];
+    std::partial_sum( dofToCutBegin_.begin(), dofToCutBegin_.end(), dofToCutBegin_.begin());
+    dofToCut_.resize( dofToCutBegin_[size]);
+    std::vector<size_t> pos( dofToCutBegin_.begin(), dofToCutBegin_.end() - 1);
+    for (size_t k= 0; k < cutTetra_.size(); ++k)
+        for (Uint i= 0; i < 10; ++i) {
+            dof= (i<4) ? cutTetra_[k]->GetVertex( i)->Unknowns( idx) : cutTetra_[k]->GetEdge( i-4)->Unknowns( idx);
+            dofToCut_[pos[dof]++]= k;
+        }
+
+    // dof of an intersected tetra -> tetras
+    dofToTetraBegin_.assign( size + 1, 0);
+    DROPS_FOR_TRIANG_CONST_TETRA( mg, lvl, it)
+        for (Uint i= 0; i < 10; ++i) {
+            dof= (i<4) ? it->GetVertex( i)->Unknowns( idx) : it->GetEdge( i-4)->Unknowns( idx);
+            if (dofToCutBegin_[dof] != dofToCutBegin_[dof + 1])
+                ++dofToTetraBegin_[dof + 1];
+        }
+    std::partial_sum( dofToTetraBegin_.begin(), dofToTetraBegin_.end(), dofToTetraBegin_.begin());
+    dofToTetraCSR_.resize( dofToTetraBegin_[size]);
+    pos.assign( dofToTetraBegin_.begin(), dofToTetraBegin_.end() - 1);
+    DROPS_FOR_TRIANG_CONST_TETRA( mg, lvl, it)
+        for (Uint i= 0; i < 10; ++i) {
+            dof= (i<4) ? it->GetVertex( i)->Unknowns( idx) : it->GetEdge( i-4)->Unknowns( idx);
+            if (dofToCutBegin_[dof] != dofToCutBegin_[dof + 1])
+                dofToTetraCSR_[pos[dof]++]= &*it;
+        }
+}
+
+/** For each (augmented) dof, the distances to the triangles of all neighbor-neighbor tetras are
+    computed concurrently. As the minimum does not depend on the order of the triangles, the result
+    is the same for any number of threads.
+    \pre InitDofToTetraCSR has been called */
+void InitZeroExactCL::DetermineDistancesCSR()
+{
+    const Uint idx= data_.phi.RowIdx->GetIdx();
+    const IdxT size= data_.phi.Data.size();
+    const int augm_size= size + data_.map.size();
+    std::vector<double> dist( augm_size, -1.); // negative, if there is no triangle close to the dof
+
+#pragma omp parallel
+{
+    std::vector<size_t> cut; // neighbor-neighbor tetras of the actual dof
+#pragma omp for schedule(dynamic, 256)
+    for (int augm_dof= 0; augm_dof < augm_size; ++augm_dof) {
+        const IdxT dof= data_.Map( augm_dof);
+        cut.clear();
+        for (size_t j= dofToTetraBegin_[dof]; j < dofToTetraBegin_[dof + 1]; ++j) {
+            const TetraCL& t= *dofToTetraCSR_[j];
+            for (Uint i= 0; i < 10; ++i) {
+                const IdxT dofI= (i<4) ? t.GetVertex( i)->Unknowns( idx) : t.GetEdge( i-4)->Unknowns( idx);
+                cut.insert( cut.end(), dofToCut_.begin() + dofToCutBegin_[dofI], dofToCut_.begin() + dofToCutBegin_[dofI + 1]);
+            }
+        }
+        if (cut.empty()) continue;
+        std::sort( cut.begin(), cut.end());
+        cut.erase( std::unique( cut.begin(), cut.end()), cut.end());
+
+        double distance= std::numeric_limits<double>::max();
+        bool found= false;
+        for (size_t k= 0; k < cut.size(); ++k)
+            for (size_t tri= cutTetraTriangBegin_[cut[k]]; tri < cutTetraTriangBegin_[cut[k] + 1]; ++tri) {
+                distance= std::min( distance, distTriang_[tri].dist( data_.coord[augm_dof]));
+                found= true;
+            }
+        if (found)
+            dist[augm_dof]= distance;
+    }
+}
+
+    // The periodic copies of a dof are handled serially, as they are written to the same dof.
+#pragma omp parallel for
+    for (int dof= 0; dof < (int)size; ++dof)
+        if (dist[dof] >= 0.) {
+            if (data_.typ[dof] != ReparamDataCL::Finished) {
+                data_.phi.Data[dof]= dist[dof];
+                data_.typ[dof]= ReparamDataCL::Finished;
+            }
+            else
+                data_.phi.Data[dof]= std::min( data_.phi.Data[dof], dist[dof]);
+        }
+    for (int augm_dof= size; augm_dof < augm_size; ++augm_dof)
+        if (dist[augm_dof] >= 0.) {
+            const IdxT dof= data_.Map( augm_dof);
+            if (data_.typ[dof] != ReparamDataCL::Finished) {
+                data_.phi.Data[dof]= dist[augm_dof];
+                data_.typ[dof]= ReparamDataCL::Finished;
+            }
+            else
+                data_.phi.Data[dof]= std::min( data_.phi.Data[dof], dist[augm_dof]);
+        }
+}
+
 void InitZeroExactCL::Clean()
 {
     distTriang_.clear();
     distTriangPos_.clear();
     dofToTetra_.clear();
     dofToDistTriang_.clear();
+    cutTetra_.clear();
+    cutTetraTriangBegin_.clear();
+    dofToCutBegin_.clear();
+    dofToCut_.clear();
+    dofToTetraBegin_.clear();
+    dofToTetraCSR_.clear();
 }
 
 /** Note, that the correctness of this method depends on the geometry of the tetras. If
@@ -687,33 +633,9 @@ void InitZeroExactCL::Perform()
     AssociateTriangles();
     DetermineDistances();
 #else
-    // This is the implementation of J. Grande, which is much faster for the sequential version
-    VecDescCL oldv( data_.phi);
-    InterfaceTriangleCL patch;
-    double dd;
-    TetraNeighborCL tetra_to_idx( data_.mg, oldv, *data_.bnd, data_.map);
-    for (TetraNeighborCL::TetraToIdxMapT::iterator it= tetra_to_idx().begin(); it!=tetra_to_idx().end(); ++it) {
-        const TetraCL* t( it->first);
-        patch.Init( *t, oldv, *data_.bnd);
-        for (int ch= 0; ch < 8; ++ch) {
-            if (!patch.ComputeForChild( ch)) continue; // Child ch has no intersection
-
-            TetraNeighborCL::IdxSetT& idxset= it->second;
-            for (int tri= 0; tri < patch.GetNumTriangles(); ++tri) {
-                ExactDistanceInitCL dist_to_tri( &patch.GetPoint( tri));
-                for (TetraNeighborCL::IdxSetT::iterator sit= idxset.begin(); sit!=idxset.end(); ++sit) {
-                    dist_to_tri.dist( data_.coord[*sit], dd);
-                    const int dof= data_.Map(*sit);
-                    if ( data_.typ[dof] != ReparamDataCL::Finished) {
-                        data_.phi.Data[dof]= dd;
-                        data_.typ[dof]= ReparamDataCL::Finished;
-                    }
-                    else
-                        data_.phi.Data[dof]= std::min( data_.phi.Data[dof], dd);
-                }
-            }
-        }
-    }
+    BuildDistTriangCSR();
+    InitDofToTetraCSR();
+    DetermineDistancesCSR();
 #endif
     Clean();
 }
@@ -1007,8 +929,9 @@ void FastmarchingCL::InitClose()
 }
 
 /** Iterate over all neighbors of NrI and check if distance has changed. If a neighbor
-    is not in the close set, put this dof in this set. If NrI is already marked as finished
-    then do nothing
+    is not in the close set, put this dof in this set. If NrI is already in the close set
+    and its distance decreased, the key in the close set is decreased as well. If NrI is
+    already marked as finished then do nothing
     \param NrI dof to be updated
 */
 void FastmarchingCL::Update( const IdxT NrI)
@@ -1037,11 +960,15 @@ void FastmarchingCL::Update( const IdxT NrI)
         minval = std::min(minval, CompValueProj(NrI, num, upd));
     }
 
-    data_.phi.Data[MapNrI] = minval;
     if (data_.typ[MapNrI] != data_.Close) {
         close_.insert( DistIdxT( minval, MapNrI));
         data_.typ[MapNrI] = data_.Close;
     }
+    else if (minval < data_.phi.Data[MapNrI]) { // keep the close set ordered by the actual distances
+        close_.erase( DistIdxT( data_.phi.Data[MapNrI], MapNrI));
+        close_.insert( DistIdxT( minval, MapNrI));
+    }
+    data_.phi.Data[MapNrI] = minval;
 }
 
 /** Compute the projection to an edge or an face
@@ -1089,7 +1016,8 @@ double FastmarchingCL::CompValueProj( IdxT Nr, int num, const IdxT upd[3]) const
 }
 
 /** While some vertices are still marked as Close, determine the distance of these
-    vertices by the FMM
+    vertices by the FMM. In narrow band mode, the marching stops as soon as the nearest
+    close vertex is at least data_.width away from the interface.
 */
 void FastmarchingCL::DetermineDistances()
 {
@@ -1106,7 +1034,10 @@ void FastmarchingCL::DetermineDistances()
         elemClose= std::max( elemClose, close_.size());
 #endif
         // remark: next < size_   =>   Map not needed for next
-        next= close_.GetNearest().second;
+        const DistIdxT nearest= close_.GetNearest();
+        if (data_.NarrowBand() && nearest.first >= data_.width)
+            break; // all remaining vertices are outside the band
+        next= nearest.second;
         data_.typ[next] = data_.Finished;
 
         std::set<IdxT> neighVerts;
@@ -1119,6 +1050,8 @@ void FastmarchingCL::DetermineDistances()
         }
         neigh_[next].clear(); // will not be needed anymore
     }
+    if (data_.NarrowBand())
+        ClipToBand();
 
 #ifdef COUNTMEM
     usedMem_=  elemClose*memPerClose                // elements in close
@@ -1129,6 +1062,18 @@ void FastmarchingCL::DetermineDistances()
 #endif
 }
 
+/** Assign the width of the narrow band to all vertices, which are not marked as finished,
+    and empty the close set.
+*/
+void FastmarchingCL::ClipToBand()
+{
+    close_.clear();
+#pragma omp parallel for schedule(static)
+    for (int i=0; i<(int)data_.typ.size(); ++i)
+        if (data_.typ[i] != data_.Finished)
+            data_.phi.Data[i]= data_.width;
+}
+
 /** Apply the FMM to a level set function*/
 void FastmarchingCL::Perform()
 {
@@ -1141,6 +1086,171 @@ void FastmarchingCL::Perform()
     DetermineDistances();
 }
 
+// F A S T  I T E R A T I V E  C L
+//---------------------------------
+
+/** Same update as FastmarchingCL::Update, but the upwind neighbors are determined by the values
+    instead of the order of acceptance: On each child, the neighbors with a known value are sorted
+    by their values, the initially finished ones first. The projections onto the edge and the face
+    spanned by the two and three smallest ones are used, if the result is not smaller than the
+    values it is computed from. Thus, a vertex is never updated by vertices farther from the
+    interface, and the fixed point does not depend on the vertices outside the narrow band.
+    \param dof the dof to be updated (not augmented)
+    \return minimum of the current value of dof and the values computed on the child tetras
+*/
+double FastIterativeCL::LocalSolve( IdxT dof) const
+{
+    double minval= data_.phi.Data[dof];
+    IdxT upd[3];
+    double key[3];
+    for (Uint n= 0; n < neigh_[dof].size(); ++n) {
+        const ReprTetraT& t= neigh_[dof][n];
+        IdxT self= t[0];
+        int num= 0;
+        for (int j= 0; j < 4; ++j) {
+            const IdxT MapJ= data_.Map( t[j]);
+            if (MapJ == dof)
+                self= t[j];
+            else if (data_.phi.Data[MapJ] < 1e99) { // insertion sort by key
+                const double k= data_.typ[MapJ] == data_.Finished ? -1. : data_.phi.Data[MapJ];
+                int pos= num++;
+                for (; pos > 0 && key[pos - 1] > k; --pos) {
+                    key[pos]= key[pos - 1];
+                    upd[pos]= upd[pos - 1];
+                }
+                key[pos]= k;
+                upd[pos]= t[j];
+            }
+        }
+        for (int j= 0; j < num; ++j)
+            minval= std::min( minval, data_.phi.Data[data_.Map( upd[j])] + (data_.coord[upd[j]] - data_.coord[self]).norm());
+        for (int j= 2; j <= num; ++j) {
+            const double val= CompValueProj( self, j, upd);
+            if (val >= key[j - 1])
+                minval= std::min( minval, val);
+        }
+    }
+    return minval;
+}
+
+/** \pre InitNeigh has to be called and the values of all non-finished vertices must be 1e99.*/
+void FastIterativeCL::InitActive( std::vector<IdxT>& active, std::vector<byte>& isactive) const
+{
+    for (size_t dof= 0; dof < data_.typ.size(); ++dof)
+        if (data_.typ[dof] == data_.Finished)
+            Activate( dof, active, isactive);
+}
+
+/** Append the neighbors of dof, which are neither finished nor active and have a larger value
+    than dof, to active. By LocalSolve, dof cannot decrease the value of the other neighbors.
+*/
+void FastIterativeCL::Activate( IdxT dof, std::vector<IdxT>& active, std::vector<byte>& isactive) const
+{
+    const double val= data_.phi.Data[dof];
+    for (Uint n= 0; n < neigh_[dof].size(); ++n)
+        for (int j= 0; j < 4; ++j) {
+            const IdxT MapJ= data_.Map( neigh_[dof][n][j]);
+            if (data_.typ[MapJ] != data_.Finished && !isactive[MapJ] && data_.phi.Data[MapJ] > val) {
+                isactive[MapJ]= 1;
+                active.push_back( MapJ);
+            }
+        }
+}
+
+/** Mean length of the edges of the child tetras*/
+double FastIterativeCL::MeanEdgeLength() const
+{
+    double sum= 0.;
+    size_t num= 0;
+    for (size_t dof= 0; dof < neigh_.size(); ++dof)
+        for (Uint n= 0; n < neigh_[dof].size(); ++n, ++num)
+            sum+= (data_.coord[neigh_[dof][n][0]] - data_.coord[neigh_[dof][n][1]]).norm();
+    return num == 0 ? 0. : sum/num;
+}
+
+/** Each sweep consists of three phases:
+    -# the new values of the active vertices are computed concurrently from the values of the
+       previous sweep (Jacobi-like); each active vertex is updated once;
+    -# the new values are stored; the vertices, whose value decreased by more than tol_, become
+       pending;
+    -# the pending vertices with a value of at most the smallest pending value plus twice the
+       mean edge length activate their neighbors for the next sweep; the other ones stay pending.
+    Thus, vertices far ahead of the front do not activate their neighbors with values, which
+    will decrease again. In narrow band mode, values not smaller than data_.width are not stored.
+*/
+void FastIterativeCL::DetermineDistances()
+{
+    const IdxT num_dof= data_.phi.Data.size();
+    const double width= data_.NarrowBand() ? data_.width : 1e99;
+    const double delta= 2.*MeanEdgeLength();
+#pragma omp parallel for schedule(static)
+    for (int dof= 0; dof < (int)num_dof; ++dof)
+        if (data_.typ[dof] != data_.Finished)
+            data_.phi.Data[dof]= 1e99;
+
+    std::vector<IdxT> active, pending;
+    std::vector<byte> isactive( num_dof, 0), ispending( num_dof, 0);
+    InitActive( active, isactive);
+
+    std::vector<double> newval;
+    for (sweeps_= 0; !active.empty() || !pending.empty(); ++sweeps_) {
+        newval.resize( active.size());
+#pragma omp parallel for
+        for (int k= 0; k < (int)active.size(); ++k)
+            newval[k]= LocalSolve( active[k]);
+
+        for (size_t k= 0; k < active.size(); ++k) {
+            const IdxT dof= active[k];
+            isactive[dof]= 0;
+            if (newval[k] < width && data_.phi.Data[dof] - newval[k] > tol_) {
+                data_.phi.Data[dof]= newval[k];
+                if (!ispending[dof]) {
+                    ispending[dof]= 1;
+                    pending.push_back( dof);
+                }
+            }
+        }
+
+        double minval= 1e99;
+        for (size_t k= 0; k < pending.size(); ++k)
+            minval= std::min( minval, data_.phi.Data[pending[k]]);
+        active.clear();
+        size_t num_pending= 0;
+        for (size_t k= 0; k < pending.size(); ++k) {
+            const IdxT dof= pending[k];
+            if (data_.phi.Data[dof] <= minval + delta) {
+                ispending[dof]= 0;
+                Activate( dof, active, isactive);
+            }
+            else
+                pending[num_pending++]= dof;
+        }
+        pending.resize( num_pending);
+    }
+
+    // vertices, which have not been reached, are outside the band or not connected to the interface
+#pragma omp parallel for schedule(static)
+    for (int dof= 0; dof < (int)num_dof; ++dof) {
+        if (data_.typ[dof] == data_.Finished)
+            continue;
+        if (data_.phi.Data[dof] < 1e99)
+            data_.typ[dof]= data_.Finished;
+        else
+            data_.phi.Data[dof]= data_.NarrowBand() ? data_.width : std::abs( data_.old[dof]);
+    }
+}
+
+/** Apply the FIM to a level set function*/
+void FastIterativeCL::Perform()
+{
+#ifdef _PAR
+    throw DROPSErrCL("FastIterativeCL: Sorry, the fast iterative method is not yet supported by the parallel version");
+#endif
+    InitNeigh();
+    DetermineDistances();
+    std::cout << " * Fast iterative method took " << sweeps_ << " sweeps" << std::endl;
+}
+
 #ifdef _PAR
 
 // F A S T M A R C H I N G  O N  M A S T E R  C L
@@ -1403,13 +1513,105 @@ void FastmarchingOnMasterCL::Perform()
 }
 #endif      // of _PAR
 
+// F R O N T  T R E E  C L
+//-------------------------
+
+void FrontTreeCL::Clear()
+{
+    delete updater_; updater_= 0;
+    delete tree_;    tree_= 0;
+    numIds_= 0;
+}
+
+void FrontTreeCL::Build( const VectorCL& front, const std::vector<size_t>& ids, size_t numIds)
+/** The builder numbers the points by their position in front; these original indices are
+    replaced by the ids.
+*/
+{
+    Clear();
+    tree_= new TreeT();
+    KDTree::TreeBuilderCL<double, 3> kd_tree_builder( *tree_);
+    kd_tree_builder.build( front);
+    TreeT::index_vec_type& orig= tree_->origidx();
+    for (size_t i=0; i<orig.size(); ++i)
+        orig[i]= ids[ orig[i]];
+    updater_= new UpdaterT( *tree_, numIds);
+    numIds_= numIds;
+    ++builds_;
+}
+
+const FrontTreeCL::TreeT& FrontTreeCL::Update( const VectorCL& front, const std::vector<size_t>& ids, size_t numIds)
+/** Compare the points of the tree with front: Points with new ids are inserted, points with ids
+    not in ids are removed, and points with changed coordinates are moved. Afterwards, the
+    bounding boxes are refitted. If this changes too much or leads to a bad tree, the tree is
+    built from scratch.
+    \param front coordinates of the points, three entries per point
+    \param ids   id of each point, all ids are smaller than numIds
+*/
+{
+    const size_t n= ids.size();
+    if (tree_ == 0 || numIds != numIds_) {
+        Build( front, ids, numIds);
+        std::cout << " * kd-tree of the front built" << std::endl;
+        return *tree_;
+    }
+
+    std::vector<byte> inFront( numIds, 0);
+    std::vector<size_t> insIds, remIds;
+    std::vector<double> insPoints;
+    size_t moved= 0;
+    for (size_t k=0; k<n; ++k) {
+        const size_t id= ids[k];
+        const double* p= &front[3*k];
+        inFront[id]= 1;
+        if (!updater_->contains( id)) {
+            insIds.push_back( id);
+            insPoints.insert( insPoints.end(), p, p+3);
+        }
+        else {
+            const double* q= updater_->point( id);
+            if (p[0] != q[0] || p[1] != q[1] || p[2] != q[2]) {
+                updater_->move( id, p);
+                ++moved;
+            }
+        }
+    }
+    for (size_t id=0; id<numIds; ++id)
+        if (!inFront[id] && updater_->contains( id))
+            remIds.push_back( id);
+
+    // moved points are cheap, inserted and removed points change the structure of the tree
+    if (2*(insIds.size() + remIds.size()) > n) {
+        Build( front, ids, numIds);
+        std::cout << " * kd-tree of the front rebuilt, " << insIds.size() << " inserted and "
+                  << remIds.size() << " removed of " << n << " points" << std::endl;
+        return *tree_;
+    }
+    updater_->remove( remIds);
+    if (!insIds.empty())
+        updater_->insert( insIds, Addr( insPoints));
+    updater_->refit();
+    const double quality= updater_->quality();
+    if (quality < minQuality_) {
+        Build( front, ids, numIds);
+        std::cout << " * kd-tree of the front rebuilt, quality " << quality << std::endl;
+        return *tree_;
+    }
+    ++updates_;
+    std::cout << " * kd-tree of the front updated: " << insIds.size() << " inserted, " << remIds.size()
+              << " removed, " << moved << " moved, quality " << quality << std::endl;
+    return *tree_;
+}
+
 // D I R E C T  D I S T A N C E  C L
 //----------------------------------
 
 void DirectDistanceCL::InitFrontVector()
 /** Count number of frontier vertices and perpendicular feet, put
     the coordinates into the the vector front_ and the value on
-    these points into the vector vals_
+    these points into the vector vals_. The ids of the points are
+    stored in ids_: the augmented dof i of a frontier vertex has
+    the id i, the perpendicular foot of dof i has the id augm_size+i.
 */
 {
     const size_t augm_size= data_.phi.Data.size() + data_.map.size();
@@ -1426,6 +1628,8 @@ void DirectDistanceCL::InitFrontVector()
     // and store distance of each frontier vertex
     front_.resize(0); front_.resize( 3*numFront);
     vals_.resize(0);  vals_.resize( numFront);
+    ids_.resize( numFront);
+    numIds_= augm_size + (data_.UsePerp() ? data_.perpFoot.size() : 0);
     size_t pos=0;
     size_t posDist=0;
     for ( size_t i=0; i<augm_size; ++i){
@@ -1434,6 +1638,7 @@ void DirectDistanceCL::InitFrontVector()
             for ( int j=0; j<3; ++j){
                 front_[ pos++]= data_.coord[i][j];
             }
+            ids_[ posDist]= i;
             vals_[ posDist++]= data_.phi.Data[MapI];
         }
     }
@@ -1442,6 +1647,7 @@ void DirectDistanceCL::InitFrontVector()
             for ( int j=0; j<3; ++j){
                 front_[ pos++]= (*data_.perpFoot[i])[j];
             }
+            ids_[ pos/3-1]= augm_size + i;
             // we do not need to set distance to 0, because std::valarray is initialized by 0
         }
     }
@@ -1454,13 +1660,18 @@ void DirectDistanceCL::InitFrontVector()
 }
 
 void DirectDistanceCL::BuildKDTree()
-/** Take the elements out of front_ and build a kd-tree representing this set
+/** Let frontTree_ represent the elements of front_; a tree kept from the last
+    reparametrization is updated. As the original indices of the tree are the ids,
+    vals_ is addressed by the ids afterwards.
     \pre InitFrontVector has to be called
  */
 {
-    kdTree_= new KDTree::TreeCL<double,3>();
-    KDTree::TreeBuilderCL<double, 3> kd_tree_builder( *kdTree_);
-    kd_tree_builder.build( front_);
+    kdTree_= &frontTree_.Update( front_, ids_, numIds_);
+    VectorCL vals( numIds_);
+    for (size_t k=0; k<ids_.size(); ++k)
+        vals[ ids_[k]]= vals_[k];
+    vals_.resize( numIds_);
+    vals_= vals;
 }
 
 void DirectDistanceCL::DetermineDistances()
@@ -1489,6 +1700,34 @@ void DirectDistanceCL::DetermineDistances()
     }
 }
 
+void DirectDistanceCL::DetermineDistancesInBand()
+/** Same as DetermineDistances, but only the frontier vertices and perpendicular feet in a
+    ball of radius data_.width around each vertex are searched. As the values on the frontier
+    are non-negative, this finds the minimal distance, if it is smaller than data_.width.
+    Otherwise, data_.width is assigned. Far from the interface, the search of the kd-tree
+    ends at its first nodes.
+*/
+{
+#pragma omp parallel for
+    for ( int dof=0; dof<(int)data_.phi.Data.size(); ++dof) {
+        if ( data_.typ[dof]!=ReparamDataCL::Finished && data_.typ[dof]!=ReparamDataCL::Handled) {
+            double newPhi= data_.width;
+            const Point3DCL coord= data_.coord[dof];
+            for (ReparamDataCL::perDirSetT::const_iterator dir= data_.perDir.begin(), end= data_.perDir.end(); dir!=end; ++dir) {
+                const Point3DCL p= coord + *dir;
+                typedef KDTree::SearchNeighborsCL<2,double,3,12> SearcherT;
+                SearcherT searcher( *kdTree_, Addr(p), newPhi);
+                searcher.search();
+                SearcherT::result_type result= searcher.result();
+                for ( size_t n=0; n<result.size(); ++n){
+                    newPhi= std::min( newPhi, result[n].distance() + vals_[ kdTree_->get_orig(result[n].get_idx())]);
+                }
+            }
+            data_.phi.Data[dof]= newPhi;
+        }
+    }
+}
+
 void DirectDistanceCL::DisplayMem() const
 {
     const size_t memFront= front_.size()*8, memVals= vals_.size()*8;
@@ -1506,9 +1745,12 @@ void DirectDistanceCL::Perform()
 {
     InitFrontVector();
     BuildKDTree();
-    DetermineDistances();
+    if (data_.NarrowBand())
+        DetermineDistancesInBand();
+    else
+        DetermineDistances();
     DisplayMem();
-    delete kdTree_; kdTree_=0;
+    kdTree_=0;
 }
 
 // P A R  D I R E C T  D I S T A N C E  C L
@@ -1590,6 +1832,11 @@ void ParDirectDistanceCL::GatherFrontier()
     // local sets are not need any more ...
     base::vals_.resize( allVals.size()); vals_=allVals;
     base::front_.resize( allFront.size()); front_=allFront;
+    // the gathered points are identified by their position
+    base::ids_.resize( vals_.size());
+    for (size_t k=0; k<ids_.size(); ++k)
+        ids_[k]= k;
+    base::numIds_= ids_.size();
 
     Uint numLsetUnk= ProcCL::GlobalSum(data_.phi.Data.size());
     std::cout << " * Lset unk " << numLsetUnk
@@ -1609,7 +1856,7 @@ void ParDirectDistanceCL::Perform()
     GatherFrontier();
     base::BuildKDTree();
     base::DetermineDistances();
-    delete kdTree_; kdTree_=0;
+    kdTree_=0;
 }
 #endif
 
@@ -1622,9 +1869,10 @@ void ParDirectDistanceCL::Perform()
     \param periodic   periodic boundaries are used
     \param bnd        boundary conditions for periodic boundaries
     \param gatherPerp flag if perpendicular foots are to be gathered
+    \param width      width of the narrow band; width<=0 reparametrizes the whole domain
 */
-ReparamCL::ReparamCL( MultiGridCL& mg, VecDescCL& phi, bool gatherPerp, bool periodic, const BndDataCL<>* bnd)
-  : data_( mg, phi, gatherPerp, periodic, bnd)
+ReparamCL::ReparamCL( MultiGridCL& mg, VecDescCL& phi, bool gatherPerp, bool periodic, const BndDataCL<>* bnd, double width)
+  : data_( mg, phi, gatherPerp, periodic, bnd, width)
 {}
 
 /** Clean everything up*/
@@ -1638,11 +1886,15 @@ ReparamCL::~ReparamCL()
     propagate_=0;
 }
 
-/** Assign each dof the sign stored in old*/
+/** Assign each dof the sign stored in old. In narrow band mode, the unsigned distances
+    are clipped to the width of the band first; this also covers the frontier vertices.*/
 void ReparamCL::RestoreSigns()
 {
+    const bool clip= data_.NarrowBand();
 #pragma omp parallel for schedule(static)
     for ( int i=0; i<(int)data_.old.size(); ++i){
+        if ( clip && data_.phi.Data[i]>data_.width)
+            data_.phi.Data[i]= data_.width;
         if ( data_.old[i]<0){
             data_.phi.Data[i]*= -1.;
         }
@@ -1693,14 +1945,16 @@ void ReparamCL::Perform()
     \param periodic      periodic boundaries are used
     \param bnd           boundary conditions for periodic boundaries
     \param perDirections directions of periodicity
+    \param width         width of the narrow band; width<=0 reparametrizes the whole domain
     \return pointer to a reparametrization class
 */
 std::auto_ptr<ReparamCL> ReparamFactoryCL::GetReparam( MultiGridCL& mg,
-        VecDescCL& phi, int method, bool periodic, const BndDataCL<>* bnd, const ReparamDataCL::perDirSetT* perDirections)
+        VecDescCL& phi, int method, bool periodic, const BndDataCL<>* bnd, const ReparamDataCL::perDirSetT* perDirections, double width,
+        FrontTreeCL* frontTree)
 {
     int initMethod= method%10;
     int propMethod= method/10;
-    std::auto_ptr<ReparamCL> reparam(new ReparamCL(mg, phi, propMethod==1, periodic, bnd));
+    std::auto_ptr<ReparamCL> reparam(new ReparamCL(mg, phi, propMethod==1, periodic, bnd, width));
     switch (initMethod) {
         case 0: {
             reparam->initZero_ = new InitZeroNoModCL( reparam->data_);
@@ -1740,7 +1994,7 @@ std::auto_ptr<ReparamCL> ReparamFactoryCL::GetReparam( MultiGridCL& mg,
             reparam->propagate_ = new ParDirectDistanceCL( reparam->data_);
 
 #else
-            reparam->propagate_ = new DirectDistanceCL( reparam->data_);
+            reparam->propagate_ = new DirectDistanceCL( reparam->data_, 100, frontTree);
 #endif
             if (periodic) { // check for periodic directions and append them
                 if (perDirections) {
@@ -1754,6 +2008,10 @@ std::auto_ptr<ReparamCL> ReparamFactoryCL::GetReparam( MultiGridCL& mg,
             }
             break;
         }
+        case 2: {
+            reparam->propagate_ = new FastIterativeCL( reparam->data_);
+            break;
+        }
         default: {
             throw DROPSErrCL("ReparamFactoryCL::GetReparam: Unknown method for Propagate");
         }
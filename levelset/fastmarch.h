@@ -32,6 +32,7 @@
 #include "num/spmat.h"
 #include "num/interfacePatch.h"
 #include "misc/kd-tree/tree.h"
+#include "misc/kd-tree/tree_updater.h"
 #ifdef _PAR
 #  include "parallel/interface.h"
 #  include "parallel/exchange.h"
@@ -73,13 +74,15 @@ class ReparamDataCL
     perMapVecT               map;         ///< mapping of periodic boundary conditions
     perDirSetT               perDir;      ///< set of directions to be considered in case of periodic boundaries (only used by DirectDistanceCL)
 
+    double                   width;       ///< width of the narrow band; distances beyond are clipped to width; width<=0 reparametrizes the whole domain
+
   public:
     // \brief Allocate memory, store references and init coordinates as well as map periodic boundary dofs
-    ReparamDataCL( MultiGridCL& MG, VecDescCL& Phi, bool GatherPerp, bool Periodic=false, const BndDataCL<>* Bnd=0)
+    ReparamDataCL( MultiGridCL& MG, VecDescCL& Phi, bool GatherPerp, bool Periodic=false, const BndDataCL<>* Bnd=0, double Width=-1.)
         : gatherPerp(GatherPerp), mg( MG), phi( Phi), old( phi.Data),
           coord( Phi.Data.size()), typ( Far, Phi.Data.size()), 
           perpFoot( (Point3DCL*)0, GatherPerp ? Phi.Data.size() : 0),
-          per( Periodic), augmIdx( 0), bnd( Bnd), map( 0), perDir( 1, Point3DCL())
+          per( Periodic), augmIdx( 0), bnd( Bnd), map( 0), perDir( 1, Point3DCL()), width( Width)
     { InitPerMap(); InitCoord(); }
     /// \brief Delete all perpendicular feet
     ~ReparamDataCL();
@@ -96,6 +99,8 @@ class ReparamDataCL
     inline bool UsePerp() const { return gatherPerp; }
     /// \brief Assign perpendicular foot
     inline void UpdatePerp( const IdxT, const double, const Point3DCL&);
+    /// \brief Check if only a narrow band around the interface is reparametrized
+    inline bool NarrowBand() const { return width > 0.; }
 };
 
 inline void ReparamDataCL::Normalize( double& b) const
@@ -258,6 +263,16 @@ class InitZeroExactCL : public InitZeroCL
     DofToTetraMapT    dofToTetra_;      ///< Map an index to a set of intersected tetra
     DofToDistTriangT  dofToDistTriang_; ///< Each dof a set of triangles is associated
 
+    /// \name Adjacencies of the OpenMP-parallel implementation in CSR format
+    //@{
+    std::vector<const TetraCL*> cutTetra_;      ///< tetras intersected by the interface
+    std::vector<size_t> cutTetraTriangBegin_;   ///< the triangles of cutTetra_[k] are distTriang_[cutTetraTriangBegin_[k]],...,distTriang_[cutTetraTriangBegin_[k+1]-1]
+    std::vector<size_t> dofToCutBegin_;         ///< the intersected tetras containing dof are cutTetra_[dofToCut_[dofToCutBegin_[dof]]],...
+    std::vector<size_t> dofToCut_;              ///< position of intersected tetras in cutTetra_
+    std::vector<size_t> dofToTetraBegin_;       ///< the tetras containing a dof of an intersected tetra are dofToTetraCSR_[dofToTetraBegin_[dof]],...
+    std::vector<const TetraCL*> dofToTetraCSR_; ///< tetras containing a dof of an intersected tetra
+    //@}
+
     /// \brief Collect all neighbor and neighbor-neighbor tetras of a level set dof
     void InitDofToTetra();
     /// \brief Updates the neighborhood information: traverse all outgoing edges (=tetras) of idx and add them to their end-vertices.
@@ -269,6 +284,13 @@ class InitZeroExactCL : public InitZeroCL
     /// \brief Determine distances of all dof in the vicinity of the interface
     virtual void DetermineDistances();
 
+    /// \brief Build all DistanceTriangCL and cutTetraTriangBegin_ concurrently
+    void BuildDistTriangCSR();
+    /// \brief Build the adjacencies dof -> intersected tetras and dof -> tetras
+    void InitDofToTetraCSR();
+    /// \brief Determine distances of all dof in the vicinity of the interface concurrently
+    void DetermineDistancesCSR();
+
     /// \brief Constructor with a name
     InitZeroExactCL( ReparamDataCL& data, const std::string& name)
         : base( data, name) {}
@@ -438,6 +460,8 @@ class FastmarchingCL : public PropagateCL
         bool empty() const { return List_.empty(); }
         /// \brief Get elements in the list
         size_t size() const { return List_.size(); }
+        /// \brief remove all elements
+        void clear() { List_.clear(); }
     };
 
     typedef PropagateCL base;                       ///< base class
@@ -457,8 +481,14 @@ class FastmarchingCL : public PropagateCL
     void Update( const IdxT);
     /// \brief Compute projection on linearized level set function on child
     double CompValueProj( IdxT Nr, int num, const IdxT upd[3]) const;
-    /// \brief Compute the distances
+    /// \brief Compute the distances; in narrow band mode, the marching stops at data_.width
     void DetermineDistances();
+    /// \brief Clip the values of all vertices not marked as finished to the width of the narrow band
+    void ClipToBand();
+
+    /// \brief Constructor with a name
+    FastmarchingCL( ReparamDataCL& data, const std::string& name)
+        : base( data, name) {}
 
   public:
     FastmarchingCL( ReparamDataCL& data)
@@ -533,6 +563,86 @@ extern "C" int HandlerFinishedScatterEdgeC(OBJT objp, void* buf);
 //@}
 #endif
 
+/// \brief Propagate the values by the fast iterative method (FIM)
+/** Instead of accepting one vertex at a time in the order of the distances as the FMM, the
+    FIM keeps a list of active vertices. In each sweep, the values of all active vertices are
+    updated once and concurrently (Jacobi-like) by the local update of the FMM, for which the
+    upwind neighbors are determined by their values. Only the neighbors of vertices, whose value
+    decreased, are active in the next sweep; vertices far ahead of the front wait, until the front
+    has reached them. The result does not depend on the number of threads.
+*/
+class FastIterativeCL : public FastmarchingCL
+{
+  public:
+    typedef FastmarchingCL base;
+
+  private:
+    double tol_;                                    ///< a vertex activates its neighbors, if its value decreases by more than tol_ in a sweep
+    Uint   sweeps_;                                 ///< number of sweeps of the last call of Perform
+
+    /// \brief Compute the update of the value of dof by its upwind neighbors
+    double LocalSolve( IdxT dof) const;
+    /// \brief Mark the non-finished neighbors of the finished vertices as active
+    void InitActive( std::vector<IdxT>& active, std::vector<byte>& isactive) const;
+    /// \brief Mark the non-finished neighbors of dof with a larger value as active
+    void Activate( IdxT dof, std::vector<IdxT>& active, std::vector<byte>& isactive) const;
+    /// \brief Mean length of the edges of the child tetras
+    double MeanEdgeLength() const;
+    /// \brief Perform sweeps over the active vertices until all values are converged
+    void DetermineDistances();
+
+  public:
+    FastIterativeCL( ReparamDataCL& data, double tol=1e-12)
+        : base( data, "Fast-Iterative-Method"), tol_( tol), sweeps_( 0) {}
+    /// \brief Determine unsigned distances by the fast iterative method
+    void Perform();
+    /// \brief Number of sweeps of the last call of Perform
+    Uint GetSweeps() const { return sweeps_; }
+};
+
+/// \brief kd-tree of the frontier vertices and perpendicular feet used by DirectDistanceCL
+/** The points are identified by ids, which are the original indices of the kd-tree. If an
+    object of this class is kept between two reparametrizations, only the difference of the
+    two point sets is applied to the tree: points are inserted, removed, and moved. The tree
+    is rebuilt, if the number of ids changes, if more than half of the points are inserted
+    or removed, or if the quality of the updated tree drops below minQuality.
+*/
+class FrontTreeCL
+{
+  public:
+    typedef KDTree::TreeCL<double, 3>        TreeT;
+    typedef KDTree::TreeUpdaterCL<double, 3> UpdaterT;
+
+  private:
+    TreeT*    tree_;                    ///< the kd-tree
+    UpdaterT* updater_;                 ///< modifies tree_
+    size_t    numIds_;                  ///< all ids are smaller than numIds_
+    double    minQuality_;              ///< the updated tree is rebuilt, if its quality is smaller
+    Uint      builds_,                  ///< number of builds of the tree
+              updates_;                 ///< number of updates of the tree
+
+    /// \brief Build the tree from scratch
+    void Build( const VectorCL& front, const std::vector<size_t>& ids, size_t numIds);
+
+    FrontTreeCL( const FrontTreeCL&);               ///< not copyable
+    FrontTreeCL& operator=( const FrontTreeCL&);    ///< not copyable
+
+  public:
+    FrontTreeCL( double minQuality= 0.5)
+        : tree_( 0), updater_( 0), numIds_( 0), minQuality_( minQuality), builds_( 0), updates_( 0) {}
+    ~FrontTreeCL() { Clear(); }
+
+    /// \brief Let the tree represent the points front with the given ids
+    const TreeT& Update( const VectorCL& front, const std::vector<size_t>& ids, size_t numIds);
+    /// \brief Delete the tree
+    void Clear();
+    /// \name statistics
+    //@{
+    Uint GetBuilds()  const { return builds_; }
+    Uint GetUpdates() const { return updates_; }
+    //@}
+};
+
 /// \brief Determine distances by direct distance computing to frontier vertices and
 ///        perpendicular feet
 class DirectDistanceCL : public PropagateCL
@@ -541,10 +651,14 @@ class DirectDistanceCL : public PropagateCL
     typedef PropagateCL base;
 
   protected:
-    KDTree::TreeCL<double, 3>* kdTree_;      ///< k-d tree to search for nearest neighbors
+    const KDTree::TreeCL<double, 3>* kdTree_;  ///< k-d tree to search for nearest neighbors
     size_t                     numNeigh_;    ///< number of neighbors
     VectorCL                   front_;       ///< coordinates of frontier vertices and perpendicular feet
-    VectorCL                   vals_;        ///< values of phi on frontier vertices and perpendicular feet
+    VectorCL                   vals_;        ///< values of phi on frontier vertices and perpendicular feet; after BuildKDTree addressed by the ids
+    std::vector<size_t>        ids_;         ///< id of the frontier vertices (augmented dof) and perpendicular feet (number of augmented dof + dof)
+    size_t                     numIds_;      ///< all ids are smaller than numIds_
+    FrontTreeCL                localTree_;   ///< kd-tree, if no tree is kept between the reparametrizations
+    FrontTreeCL&               frontTree_;   ///< kd-tree of front_
 
     /// \brief Initialize the vectors front_ and vals_
     void InitFrontVector();
@@ -552,10 +666,14 @@ class DirectDistanceCL : public PropagateCL
     void BuildKDTree();
     /// \brief Determine distances by using the kd-tree
     void DetermineDistances();
+    /// \brief Determine distances by searching the frontier within the narrow band around each vertex
+    void DetermineDistancesInBand();
 
   public:
-    DirectDistanceCL( ReparamDataCL& data, size_t numNeigh=100)
-        : base( data, "Direct Distance"), kdTree_(0), numNeigh_( numNeigh), front_(0), vals_(0) {}
+    /// \brief If frontTree is given, the kd-tree is kept there for the next reparametrization
+    DirectDistanceCL( ReparamDataCL& data, size_t numNeigh=100, FrontTreeCL* frontTree=0)
+        : base( data, "Direct Distance"), kdTree_(0), numNeigh_( numNeigh), front_(0), vals_(0), numIds_( 0),
+          frontTree_( frontTree ? *frontTree : localTree_) {}
     /// \brief Determine unsigned distances by the direct computing of distances
     virtual void Perform();
     /// \brief Show memory
@@ -630,7 +748,7 @@ class ReparamCL
 
   public:
     /// \brief Constructor
-    ReparamCL( MultiGridCL& mg, VecDescCL& phi, bool gatherPerp, bool periodic=false, const BndDataCL<>* bnd=0);
+    ReparamCL( MultiGridCL& mg, VecDescCL& phi, bool gatherPerp, bool periodic=false, const BndDataCL<>* bnd=0, double width=-1.);
     ~ReparamCL();
     /// \brief Perform the reparametrization
     void Perform();
@@ -648,14 +766,23 @@ class ReparamCL
     <tr><td>  11    </td><td> P1 Scaling        </td><td> Direct distance with KD trees </td></tr>
     <tr><td>  12    </td><td> P1 projection     </td><td> Direct distance with KD trees </td></tr>
     <tr><td>  13    </td><td> Exact Distance    </td><td> Direct distance with KD trees </td></tr>
+    <tr><td>  20    </td><td> No modification   </td><td> Fast iterative method         </td></tr>
+    <tr><td>  21    </td><td> P1 Scaling        </td><td> Fast iterative method         </td></tr>
+    <tr><td>  22    </td><td> P1 projection     </td><td> Fast iterative method         </td></tr>
+    <tr><td>  23    </td><td> Exact Distance    </td><td> Fast iterative method         </td></tr>
     </table>
+    If width>0, only the narrow band of vertices with a distance less than width to the interface
+    is reparametrized; all other values are set to +/-width.
+    If frontTree is given, the direct distance method (1x) keeps its kd-tree there and updates it
+    in the next reparametrization instead of building it from scratch.
 */
 class ReparamFactoryCL
 {
   public:
     ReparamFactoryCL() {}
     /// \brief Construct a reparametrization class
-    static std::auto_ptr<ReparamCL> GetReparam( MultiGridCL& mg, VecDescCL& phi, int method=03, bool periodic=false, const BndDataCL<>* bnd=0, const ReparamDataCL::perDirSetT* perDirections= 0);
+    static std::auto_ptr<ReparamCL> GetReparam( MultiGridCL& mg, VecDescCL& phi, int method=03, bool periodic=false, const BndDataCL<>* bnd=0, const ReparamDataCL::perDirSetT* perDirections= 0, double width= -1.,
+        FrontTreeCL* frontTree= 0);
 };
 
 } // end of namespace DROPS
@@ -230,7 +230,8 @@ void Strategy( StokesProblemT& Stokes, LevelsetP2CL& lset, AdapTriangCL& adap, b
     LsetSolverT *gm = new LsetSolverT
            (/*restart*/100, P.get<int>("Levelset.Iter"), P.get<double>("Levelset.Tol"), *lidx, jacparpc,/*rel*/true, /*acc*/ true, /*modGS*/false, LeftPreconditioning, /*parmod*/true);
 #endif
-    LevelsetModifyCL lsetmod( P.get<int>("Reparam.Freq"), P.get<int>("Reparam.Method"), /*rpm_MaxGrad*/ 1.0, /*rpm_MinGrad*/ 1.0, P.get<double>("Levelset.VolCorrection"), Vol, /*periodic*/ is_periodic);
+    CheckNarrowBand( P.get<double>("Reparam.NarrowBand", -1.), P.get<double>("AdaptRef.Width"));
+    LevelsetModifyCL lsetmod( P.get<int>("Reparam.Freq"), P.get<int>("Reparam.Method"), /*rpm_MaxGrad*/ 1.0, /*rpm_MinGrad*/ 1.0, P.get<double>("Levelset.VolCorrection"), Vol, /*periodic*/ is_periodic, P.get<double>("Reparam.NarrowBand", -1.));
 
     LinThetaScheme2PhaseCL<LsetSolverT>
         cpl( Stokes, lset, *navstokessolver, *gm, lsetmod, P.get<double>("Time.StepSize"), P.get<double>("Stokes.Theta"), P.get<double>("Levelset.Theta"), P.get("NavierStokes.Nonlinear", 0.0), /*implicitCurv*/ true);
@@ -257,10 +258,22 @@ void Strategy( StokesProblemT& Stokes, LevelsetP2CL& lset, AdapTriangCL& adap, b
 //    stokessolverfactory.GetVankaSmoother().SetRelaxation( 0.8);
 
     bool secondSerial= false;
-    for (int step= 1; step<=P.get<int>("Time.NumSteps"); ++step)
+    // adaptive time steps up to the end time of Time.NumSteps steps of size Time.StepSize
+    TimeStepControlCL* stepcontrol= 0;
+    if (P.get("Time.Adaptive.Use", 0))
+        stepcontrol= new TimeStepControlCL( cpl, P.get<double>("Time.StepSize"), P.get("Time.Adaptive.MinStepSize", 1e-6),
+            P.get("Time.Adaptive.MaxStepSize", 1e99), P.get("Time.Adaptive.Tol", 1e-3), P.get("Time.Adaptive.CFL", 0.5),
+            P.get("Time.Adaptive.CouplingIter", 5), Stokes.v.t + P.get<int>("Time.NumSteps")*P.get<double>("Time.StepSize"));
+    for (int step= 1; stepcontrol ? !stepcontrol->Finished() : step<=P.get<int>("Time.NumSteps"); ++step)
     {
         std::cout << "======================================================== Schritt " << step << ":\n";
-        cpl.DoStep( P.get<int>("Coupling.Iter"));
+        if (stepcontrol)
+            do {
+                stepcontrol->InitStep();
+                cpl.DoStep( P.get<int>("Coupling.Iter"));
+            } while (!stepcontrol->CommitStep());
+        else
+            cpl.DoStep( P.get<int>("Coupling.Iter"));
         std::cout << "rel. Volume: " << lset.GetVolume()/Vol << std::endl;
 
         bool doGridMod= P.get<int>("AdaptRef.Freq") && step%P.get<int>("AdaptRef.Freq") == 0;
@@ -269,6 +282,7 @@ void Strategy( StokesProblemT& Stokes, LevelsetP2CL& lset, AdapTriangCL& adap, b
         if (doGridMod) {
             adap.UpdateTriang( lset);
             cpl.Update();
+            if (stepcontrol) stepcontrol->Update();
             if (P.get<std::string>("SerializationFile") != "none") {
                 std::stringstream filename;
                 filename << P.get<std::string>("SerializationFile");
@@ -278,16 +292,20 @@ void Strategy( StokesProblemT& Stokes, LevelsetP2CL& lset, AdapTriangCL& adap, b
                 ser.WriteMG();
                 filename << ".time";
                 std::ofstream serTime( filename.str().c_str());
-                serTime << "Serialization info:\ntime step = " << step << "\t\tt = " << step*P.get<double>("Time.StepSize") << "\n";
+                serTime << "Serialization info:\ntime step = " << step << "\t\tt = " << Stokes.v.t << "\n";
                 serTime.close();
             }
         }
 
         if (step%10==0)
-            ensight.Write( step*P.get<double>("Time.StepSize"));
+            ensight.Write( Stokes.v.t);
     }
 
     std::cout << std::endl;
+    if (stepcontrol) {
+        std::cout << "rejected time steps: " << stepcontrol->GetRejected() << std::endl;
+        delete stepcontrol;
+    }
     delete stokessolver;
     delete navstokessolver;
 }
@@ -369,6 +387,7 @@ int main (int argc, char** argv)
         DROPS::FileBuilderCL filebuilder( P.get<std::string>("DeserializationFile"), &builder);
         mgp= new DROPS::MultiGridCL( filebuilder);
     }
+    mgp->SetAccumulationScheduling( DROPS::accumulation_scheduling_from_string( P.get<std::string>( "Accumulation.Scheduling", "Coloring")));
 
     if (P.get<std::string>("BndCond").size()!=6)
     {
@@ -559,18 +559,28 @@ void LevelsetP2CL::Init( scalar_fun_ptr phi0)
 }
 
 
+LevelsetP2CL::~LevelsetP2CL()
+{
+    if (perDirections) delete perDirections;
+    delete frontTree_;
+}
+
 void LevelsetP2CL::CreateNumbering( Uint level, IdxDescCL* idx, match_fun match)
 {
     idx->CreateNumbering( level, MG_, BndData_, match);
 }
 
 
-void LevelsetP2CL::Reparam( int method, bool Periodic)
+void LevelsetP2CL::Reparam( int method, bool Periodic, double width)
 /** \param method How to perform the reparametrization (see description of ReparamFactoryCL for details)
     \param Periodic: If true, a special variant of the algorithm for periodic boundaries is used.
+    \param width: If positive, only the vertices with a distance less than width to the interface are
+        reparametrized; all other vertices get the value +/-width.
 */
 {
-    std::auto_ptr<ReparamCL> reparam= ReparamFactoryCL::GetReparam( MG_, Phi, method, Periodic, &BndData_, perDirections);
+    if (method/10 == 1 && frontTree_ == 0)
+        frontTree_= new FrontTreeCL();
+    std::auto_ptr<ReparamCL> reparam= ReparamFactoryCL::GetReparam( MG_, Phi, method, Periodic, &BndData_, perDirections, width, frontTree_);
     reparam->Perform();
 }
 
@@ -593,11 +603,27 @@ void LevelsetP2CL::AccumulateBndIntegral( VecDescCL& f) const
     }
     TetraAccumulatorTupleCL accus;
     accus.push_back( accu);
-    accumulate( accus, MG_, Phi.RowIdx->TriangLevel(), Phi.RowIdx->GetMatchingFunction(), Phi.RowIdx->GetBndInfo());
+    const InterfaceBandCL* band= curvDiff_ > 0 ? 0 : GetBand(); // the smoothed level set function has a different zero level
+    if (band != 0 && band->GetLevel() == Phi.RowIdx->TriangLevel())
+        accumulate( accus, MG_, *band, Phi.RowIdx->GetMatchingFunction(), Phi.RowIdx->GetBndInfo());
+    else
+        accumulate( accus, MG_, Phi.RowIdx->TriangLevel(), Phi.RowIdx->GetMatchingFunction(), Phi.RowIdx->GetBndInfo());
 
     delete accu;
 }
 
+const InterfaceBandCL* LevelsetP2CL::GetBand() const
+{
+#ifdef _PAR
+    return 0;
+#else
+    if (!use_band_)
+        return 0;
+    band_.update( MG_, Phi, BndData_);
+    return &band_;
+#endif
+}
+
 double LevelsetP2CL::GetVolume( double translation, int l) const
 {
     if (l==0)
@@ -611,44 +637,142 @@ double LevelsetP2CL::GetVolume( double translation, int l) const
     return Volume;
 }
 
+/// \brief Volume of the negative phase of the translated level set function; used with reduce_tetras.
+/// The quadrature is either composite on a principal lattice or extrapolated.
+/// If a lattice for the area is given, the area of the zero level is computed, too.
+class LevelsetVolumeReductionCL
+{
+  private:
+    const LevelsetP2CL& ls_;
+    double translation_;
+    const PrincipalLatticeCL* lat_;      ///< lattice for the composite quadrature; 0 for the extrapolation
+    const ExtrapolationToZeroCL* extra_; ///< used, if lat_ == 0
+    const PrincipalLatticeCL* area_lat_; ///< lattice for the composite quadrature of the area; 0, if the area is not needed
+
+    std::valarray<double> ls_values_;
+    QuadDomainCL qdom_;
+    LocalP2CL<> loc_phi_;
+    TetraPartitionCL partition_;
+    std::valarray<double> area_ls_values_;
+    QuadDomain2DCL qdom2d_;
+    SurfacePatchCL patch_;
+
+  public:
+    double vol,
+           area;
+
+    LevelsetVolumeReductionCL (const LevelsetP2CL& ls, double translation, const PrincipalLatticeCL* lat, const ExtrapolationToZeroCL* extra,
+        const PrincipalLatticeCL* area_lat= 0)
+        : ls_( ls), translation_( translation), lat_( lat), extra_( extra), area_lat_( area_lat),
+          ls_values_( lat != 0 ? lat->vertex_size() : 0), area_ls_values_( area_lat != 0 && area_lat != lat ? area_lat->vertex_size() : 0),
+          vol( 0.), area( 0.) {}
+
+    void operator() (const TetraCL& t) {
+        loc_phi_.assign( t, ls_.Phi, ls_.GetBndData());
+        loc_phi_+= translation_;
+        if (lat_ != 0) {
+            evaluate_on_vertexes( loc_phi_, *lat_, Addr( ls_values_));
+            partition_.make_partition< SortedVertexPolicyCL,MergeCutPolicyCL>( *lat_, ls_values_);
+            make_CompositeQuad5Domain( qdom_, partition_);
+        }
+        else
+            make_ExtrapolatedQuad5Domain( qdom_, loc_phi_, *extra_);
+        DROPS::GridFunctionCL<> integrand( 1., qdom_.vertex_size());
+        vol+= quad( integrand, t.GetVolume()*6., qdom_, NegTetraC);
+
+        if (area_lat_ != 0) {
+            if (area_lat_ != lat_)
+                evaluate_on_vertexes( loc_phi_, *area_lat_, Addr( area_ls_values_));
+            patch_.make_patch<MergeCutPolicyCL>( *area_lat_, area_lat_ != lat_ ? area_ls_values_ : ls_values_);
+            make_CompositeQuad5Domain2D( qdom2d_, patch_, t);
+            DROPS::GridFunctionCL<> one( 1., qdom2d_.vertex_size());
+            area+= quad_2D( one, qdom2d_);
+        }
+    }
+    void join (const LevelsetVolumeReductionCL& r) { vol+= r.vol; area+= r.area; }
+};
+
+/// \brief Volume of the negative phase; only the tetras of the band are visited, if the translation does not move the zero level out of the band.
+template <class ReductionT>
+double LevelsetP2CL::ReduceVolume( ReductionT& red, double translation) const
+{
+    const InterfaceBandCL* band= GetBand();
+    if (band != 0 && band->GetLevel() == idx.TriangLevel() && band->IsBandFor( translation)) {
+        reduce_tetras( band->GetTetras(), red);
+        return red.vol + band->GetNegVolume();
+    }
+    reduce_tetras( MG_, idx.TriangLevel(), red);
+    return red.vol;
+}
+
 double LevelsetP2CL::GetVolume_Extrapolation( double translation, int l) const
 {
-    double vol = 0.;
-    QuadDomainCL qdom;
     DROPS::ExtrapolationToZeroCL extra( l, DROPS::RombergSubdivisionCL());
     // DROPS::ExtrapolationToZeroCL extra( l, DROPS::HarmonicSubdivisionCL());
-    LocalP2CL<> loc_phi;
-    DROPS_FOR_TRIANG_TETRA( MG_, idx.TriangLevel(), it) {
-        loc_phi.assign(*it,Phi,GetBndData());
-        loc_phi+= translation;
-        make_ExtrapolatedQuad5Domain( qdom, loc_phi, extra);
-        DROPS::GridFunctionCL<> integrand( 1., qdom.vertex_size());
-        vol+=quad( integrand, it->GetVolume()*6., qdom, NegTetraC);
-    }
-    return vol;
+    LevelsetVolumeReductionCL red( *this, translation, 0, &extra);
+    return ReduceVolume( red, translation);
 }
 
 double LevelsetP2CL::GetVolume_Composite( double translation, int l) const
 {
-    const PrincipalLatticeCL& lat= PrincipalLatticeCL::instance ( l);
-    double vol = 0.;
-    std::valarray<double> ls_values (lat.vertex_size());
-    QuadDomainCL qdom;
-    LocalP2CL<> loc_phi;
-    TetraPartitionCL partition;
-    DROPS_FOR_TRIANG_TETRA( MG_, idx.TriangLevel(), it) {
-        loc_phi.assign(*it,Phi,GetBndData());
-        loc_phi+= translation;
-        evaluate_on_vertexes (loc_phi, lat, Addr(ls_values));
-        partition.make_partition< SortedVertexPolicyCL,MergeCutPolicyCL>(lat, ls_values);
-        make_CompositeQuad5Domain( qdom, partition);
-        DROPS::GridFunctionCL<> integrand( 1., qdom.vertex_size());
-        vol+=quad( integrand, it->GetVolume()*6., qdom, NegTetraC);
+    LevelsetVolumeReductionCL red( *this, translation, &PrincipalLatticeCL::instance( l), 0);
+    return ReduceVolume( red, translation);
+}
+
+double LevelsetP2CL::GetVolumeAndArea( double translation, int l, double& area) const
+/** The area of the zero level is computed by the composite quadrature on the principal lattice of
+    order |l|, which is also used for the volume, if l>0.
+*/
+{
+    if (l==0)
+        ++l;
+    const PrincipalLatticeCL& area_lat= PrincipalLatticeCL::instance( std::abs( l));
+    double vol;
+    if (l > 0) {
+        LevelsetVolumeReductionCL red( *this, translation, &area_lat, 0, &area_lat);
+        vol= ReduceVolume( red, translation);
+        area= red.area;
     }
+    else {
+        DROPS::ExtrapolationToZeroCL extra( -l, DROPS::RombergSubdivisionCL());
+        LevelsetVolumeReductionCL red( *this, translation, 0, &extra, &area_lat);
+        vol= ReduceVolume( red, translation);
+        area= red.area;
+    }
+#ifdef _PAR
+    vol=  ProcCL::GlobalSum( vol);
+    area= ProcCL::GlobalSum( area);
+#endif
     return vol;
 }
 
 double LevelsetP2CL::AdjustVolume (double vol, double tol, double surface, int l) const
+/** Newton's method for the translation d with V(d)=vol, where V(d) is the volume of the negative
+    phase of Phi+d: The derivative of V is minus the area of the zero level of Phi+d, which is computed
+    together with the volume. Hence, each step costs one pass over the band of cut tetras, as long as
+    the zero level stays in the band. If Newton's method does not converge quickly, e.g., if the
+    interface vanishes, the safeguarded secant method AdjustVolume_AndersonBjoerck is used.
+*/
+{
+    const double abstol= tol*vol;
+    double d= 0., area;
+    double v= GetVolumeAndArea( d, l, area) - vol;
+    for (int iter= 0; iter < 10; ++iter) {
+        if (std::abs( v) <= abstol)
+            return d;
+        if (area <= 0.)
+            break;
+        const double d_new= d + v/area;
+        double area_new;
+        const double v_new= GetVolumeAndArea( d_new, l, area_new) - vol;
+        if (std::abs( v_new) >= std::abs( v))
+            break;
+        d= d_new; v= v_new; area= area_new;
+    }
+    return AdjustVolume_AndersonBjoerck( vol, tol, surface, l);
+}
+
+double LevelsetP2CL::AdjustVolume_AndersonBjoerck (double vol, double tol, double surface, int l) const
 {
     tol*=vol;
 
@@ -683,24 +807,41 @@ double LevelsetP2CL::AdjustVolume (double vol, double tol, double surface, int l
 }
 
 void LevelsetP2CL::SmoothPhi( VectorCL& SmPhi, double diff) const
+/// The matrices are kept in smooth_ until the multigrid, the numbering or diff change.
+/// As the smoothing is linear, the smoothed function of the last call plus the change of Phi is used as initial guess.
 {
     Comment("Smoothing for curvature calculation\n", DebugDiscretizeC);
-    MatrixCL M, A, C;
-    SetupSmoothSystem( M, A);
-    C.LinComb( 1, M, diff, A);
+    SmoothCacheCL& c= smooth_;
+    if (c.diff != diff || c.mg_version != MG_.GetVersion() || c.coord_version != MG_.GetCoordVersion()
+        || c.numbering_version != Phi.RowIdx->GetNumberingVersion() || c.M.num_rows() != Phi.Data.size()) {
+        MatrixCL A;
+        SetupSmoothSystem( c.M, A);
+        c.C.LinComb( 1, c.M, diff, A);
+        c.diff= diff;
+        c.mg_version= MG_.GetVersion();
+        c.coord_version= MG_.GetCoordVersion();
+        c.numbering_version= Phi.RowIdx->GetNumberingVersion();
+        c.Phi.resize( 0);
+    }
+    else if (c.Phi.size() == Phi.Data.size())
+        SmPhi= c.SmPhi + (Phi.Data - c.Phi);
 #ifndef _PAR
     SSORPcCL pc;
     PCG_SsorCL pcg( pc, 500, 1e-10);
-    pcg.Solve( C, SmPhi, M*Phi.Data);
+    pcg.Solve( c.C, SmPhi, c.M*Phi.Data);
     __UNUSED__ double inf_norm= supnorm( SmPhi-Phi.Data);
 #else
     ParJac0CL  JACPc (idx);
     typedef ParPCGSolverCL<ParJac0CL> JacPCGSolverT;
-    JacPCGSolverT cg( 500, 1e-10, idx, JACPc);
-    cg.Solve( C, SmPhi, M*Phi.Data);
+    JacPCGSolverT pcg( 500, 1e-10, idx, JACPc);
+    pcg.Solve( c.C, SmPhi, c.M*Phi.Data);
     __UNUSED__ const double inf_norm= ProcCL::GlobalMax(supnorm( SmPhi-Phi.Data));
 #endif
-    Comment("||SmPhi - Phi||_oo = " <<inf_norm<< std::endl, DebugDiscretizeC);
+    Comment("||SmPhi - Phi||_oo = " <<inf_norm<< ", iterations: " << pcg.GetIter() << std::endl, DebugDiscretizeC);
+    c.Phi.resize( Phi.Data.size());
+    c.Phi= Phi.Data;
+    c.SmPhi.resize( SmPhi.size());
+    c.SmPhi= SmPhi;
 }
 
 void LevelsetP2CL::SetupSmoothSystem( MatrixCL& M, MatrixCL& A) const
@@ -752,25 +893,32 @@ void LevelsetP2CL::SetupSmoothSystem( MatrixCL& M, MatrixCL& A) const
     Ab.Build();
 }
 
-void LevelsetP2CL::GetMaxMinGradPhi(double& maxGradPhi, double& minGradPhi) const
+/// \brief Maximal norm of the gradient of the level set function in all tetras and minimal norm in the intersected tetras; used with reduce_tetras.
+class GradPhiReductionCL
 {
+  private:
+    const LevelsetP2CL& ls_;
+    const double width_; ///< if positive, only tetras with |phi| < width_ in all dof are considered
     Quad2CL<Point3DCL> Grad[10], GradRef[10];
-    SMatrixCL<3,3> T;
-    double det;
     InterfacePatchCL patch;
 
-    P2DiscCL::GetGradientsOnRef( GradRef);
-    maxGradPhi= -1.;
-    minGradPhi= 1e99;
+  public:
+    double maxGradPhi, minGradPhi;
 
-    double maxNorm;
-    double minNorm;
+    GradPhiReductionCL (const LevelsetP2CL& ls, double width)
+        : ls_( ls), width_( width), maxGradPhi( -1.), minGradPhi( 1e99)
+    { P2DiscCL::GetGradientsOnRef( GradRef); }
 
-    DROPS_FOR_TRIANG_TETRA( MG_, MG_.GetLastLevel(), it)
-    {
-        GetTrafoTr( T, det, *it);
+    void operator() (const TetraCL& t) {
+        patch.Init( t, ls_.Phi, ls_.GetBndData());
+        if (width_ > 0.)
+            for (int v=0; v<10; ++v)
+                if (std::abs( patch.GetPhi(v)) >= width_)
+                    return; // tetra touches the constant part outside the narrow band
+        SMatrixCL<3,3> T;
+        double det;
+        GetTrafoTr( T, det, t);
         P2DiscCL::GetGradients( Grad, GradRef, T); // Gradienten auf aktuellem Tetraeder
-        patch.Init( *it, Phi, BndData_);
 
         // compute maximal norm of grad Phi
         Quad2CL<Point3DCL> gradPhi;
@@ -780,14 +928,26 @@ void LevelsetP2CL::GetMaxMinGradPhi(double& maxGradPhi, double& minGradPhi) cons
         VectorCL normGrad( 5);
         for (int v=0; v<5; ++v) // init normGrad
             normGrad[v]= norm( gradPhi[v]);
-        maxNorm= normGrad.max();
-        minNorm= normGrad.min();
+        const double maxNorm= normGrad.max(),
+                     minNorm= normGrad.min();
         if (maxNorm > maxGradPhi) maxGradPhi= maxNorm;
         if (minNorm < minGradPhi && patch.Intersects()) minGradPhi= minNorm;
     }
+    void join (const GradPhiReductionCL& r) {
+        maxGradPhi= std::max( maxGradPhi, r.maxGradPhi);
+        minGradPhi= std::min( minGradPhi, r.minGradPhi);
+    }
+};
+
+void LevelsetP2CL::GetMaxMinGradPhi(double& maxGradPhi, double& minGradPhi, double width) const
+{
+    GradPhiReductionCL red( *this, width);
+    reduce_tetras( MG_, MG_.GetLastLevel(), red);
+    maxGradPhi= red.maxGradPhi;
+    minGradPhi= red.minGradPhi;
 #ifdef _PAR
-    maxGradPhi= ProcCL::GlobalMax( maxNorm= maxGradPhi);
-    minGradPhi= ProcCL::GlobalMin( minNorm= minGradPhi);
+    maxGradPhi= ProcCL::GlobalMax( maxGradPhi);
+    minGradPhi= ProcCL::GlobalMin( minGradPhi);
 #endif
 }
 
@@ -832,5 +992,34 @@ LevelsetRepairCL::post_refine ()
     phi.Data= loc_phi.Data;
 }
 
+#ifndef _PAR
+void LevelsetRepairCL::pre_refine_deferred (RepairSetCL& repair)
+{
+    field_= repair.push_back( ls_.Phi, ls_.GetBndData());
+}
+
+void LevelsetRepairCL::pre_repair_deferred (RepairSetCL& repair)
+{
+    loc_lidx_= std::auto_ptr<IdxDescCL>( new IdxDescCL( P2_FE));
+    ls_.CreateNumbering( ls_.GetMG().GetLastLevel(), loc_lidx_.get(), ls_.GetMG().GetBnd().GetMatchFun());
+    loc_phi_= std::auto_ptr<VecDescCL>( new VecDescCL( loc_lidx_.get()));
+    repair.set_target( field_, *loc_phi_);
+}
+
+void
+LevelsetRepairCL::post_refine_deferred ()
+/// Replace the FE level-set function by the repaired one
+{
+    VecDescCL& phi= ls_.Phi;
+    phi.Clear( phi.t);
+    ls_.DeleteNumbering( phi.RowIdx);
+    ls_.idx.swap( *loc_lidx_);
+    phi.SetIdx( &ls_.idx);
+    phi.Data= loc_phi_->Data;
+    loc_phi_.reset();
+    loc_lidx_.reset();
+}
+#endif
+
 } // end of namespace DROPS
 
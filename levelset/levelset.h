@@ -49,6 +49,8 @@ namespace DROPS
 
 typedef BndDataCL<double>    LsetBndDataCL;
 
+class FrontTreeCL;
+
 enum SurfaceForceT
 /// different types of surface forces
 {
@@ -87,23 +89,47 @@ class LevelsetP2CL : public ProblemCL< LevelsetCoeffCL, LsetBndDataCL>
     SurfaceForceT       SF_;
 
     SurfaceTensionCL&   sf_;      ///< data for surface tension
+
+    /// \brief Operator of SmoothPhi and the last smoothing. The operator depends only on the multigrid, the numbering and the diffusion.
+    struct SmoothCacheCL
+    {
+        MatrixCL M,                 ///< mass matrix
+                 C;                 ///< M + diff*(stiffness matrix)
+        size_t   mg_version,        ///< versions of the multigrid, the vertex-coordinates and the numbering for M and C
+                 coord_version,
+                 numbering_version;
+        double   diff;
+        VectorCL Phi,               ///< level set function of the last smoothing
+                 SmPhi;             ///< its smoothed function; used for the initial guess
+
+        SmoothCacheCL () : mg_version( 0), coord_version( 0), numbering_version( 0), diff( -1.) {}
+    };
+    mutable SmoothCacheCL smooth_;
+
     void SetupSmoothSystem ( MatrixCL&, MatrixCL&)               const;
     void SmoothPhi( VectorCL& SmPhi, double diff)                const;
     double GetVolume_Composite( double translation, int l)    const;
     double GetVolume_Extrapolation( double translation, int l) const;
+    /// Volume of the negative phase of Phi+translation and area of its zero level; see GetVolume for the parameter l.
+    double GetVolumeAndArea( double translation, int l, double& area) const;
+    /// Volume correction by the secant method and the Anderson-Bjoerck method; used, if Newton's method in AdjustVolume fails.
+    double AdjustVolume_AndersonBjoerck( double vol, double tol, double surf, int l) const;
+    template <class ReductionT>
+    double ReduceVolume( ReductionT& red, double translation) const;
     perDirSetT* perDirections;    ///< periodic directions
+    mutable InterfaceBandCL band_; ///< tetras near the zero level of Phi
+    bool                    use_band_;
+    FrontTreeCL*            frontTree_;    ///< kd-tree of the direct distance reparametrization, kept between the reparametrizations
 
   public:
     MatrixCL            E, H;
 
     LevelsetP2CL( MultiGridCL& mg, const LsetBndDataCL& bnd, SurfaceTensionCL& sf, double SD= 0, double curvDiff= -1)
     : base_( mg, LevelsetCoeffCL(), bnd), idx( P2_FE), curvDiff_( curvDiff), SD_( SD),
-        SF_(SF_ImprovedLB), sf_(sf), perDirections(NULL)
+        SF_(SF_ImprovedLB), sf_(sf), perDirections(NULL), use_band_( true), frontTree_( 0)
     {}
 
-    ~LevelsetP2CL(){
-      if (perDirections) delete perDirections;
-    }
+    ~LevelsetP2CL();
     /// \name Numbering
     ///@{
     void CreateNumbering( Uint level, IdxDescCL* idx, match_fun match= 0);
@@ -117,23 +143,26 @@ class LevelsetP2CL : public ProblemCL< LevelsetCoeffCL, LsetBndDataCL>
     /// \remarks call SetupSystem \em before calling SetTimeStep!
     template<class DiscVelSolT>
     void SetupSystem( const DiscVelSolT&, const double);
-    /// Reparametrization of the level set function.
-    void Reparam( int method=03, bool Periodic= false);
+    /// Reparametrization of the level set function; if width>0, only in the narrow band of this width around the interface.
+    void Reparam( int method=03, bool Periodic= false, double width= -1.);
 
     /// \brief Perform downwind numbering
     template <class DiscVelSolT>
     PermutationT downwind_numbering (const DiscVelSolT& vel, IteratedDownwindCL dw);
+    /// \brief Renumber the level set DoFs by a locality ordering, see DROPS::locality_numbering. Phi is permuted; the permutation is returned.
+    PermutationT locality_numbering (LocalityOrderingT ordering);
 
     /// returns information about level set function and interface.
     template<class DiscVelSolT>
     void   GetInfo( double& maxGradPhi, double& Volume, Point3DCL& bary, Point3DCL& vel, const DiscVelSolT& vel_sol, Point3DCL& minCoord, Point3DCL& maxCoord, double& surfArea) const;
-    /// returns the maximum and minimum of the gradient of phi
-    void   GetMaxMinGradPhi(double& maxGradPhi, double& minGradPhi) const;
+    /// returns the maximum and minimum of the gradient of phi; if width>0, only tetras with |phi| < width in all dof are considered.
+    void   GetMaxMinGradPhi(double& maxGradPhi, double& minGradPhi, double width= -1.) const;
     /// returns approximate volume of domain where level set function is negative. For l > 0 the level set function is evaluated as a linear FE-function on the principal lattice of order l.
     /// l = 1 : integration on the tetra itself. l = 2 integration on the regular refinement.
     /// l < 0 : extrapolation from current level lvl to lvl - l - 1
     double GetVolume( double translation= 0, int l= 2) const;
-    /// volume correction to ensure no loss or gain of mass. The parameter l is passed to GetVolume().
+    /// volume correction to ensure no loss or gain of mass by Newton's method with the interface area as derivative. The parameter l is passed to GetVolume().
+    /// The surface area surf is only used as initial guess, if Newton's method fails.
     double AdjustVolume( double vol, double tol, double surf= 0., int l= 2) const;
     /// Apply smoothing to \a SmPhi, if curvDiff_ > 0
     void MaybeSmooth( VectorCL& SmPhi) const { if (curvDiff_>0) SmoothPhi( SmPhi, curvDiff_); }
@@ -143,6 +172,12 @@ class LevelsetP2CL : public ProblemCL< LevelsetCoeffCL, LsetBndDataCL>
     SurfaceForceT GetSurfaceForce() const { return SF_; }
     /// Discretize surface force
     void   AccumulateBndIntegral( VecDescCL& f) const;
+    /// \brief The tetras near the zero level of Phi; the band is recomputed, if the multigrid or Phi changed since the last call. Returns 0, if the band is disabled.
+    /// The interface-based routines (GetVolume, AccumulateBndIntegral, XFEM-numbering) only visit the band.
+    const InterfaceBandCL* GetBand() const;
+    /// \brief Number of layers of neighbors, which are added to the cut tetras (default: 1); for a negative number, the band is disabled and all tetras are visited.
+    void SetBandLayers( int layers)
+        { use_band_= layers >= 0; if (use_band_) band_.SetLayers( layers); }
     /// Clear all matrices, should be called after grid change to avoid reuse of matrix pattern
     void   ClearMat() { E.clear(); H.clear(); }
     /// \name Evaluate Solution
@@ -171,11 +206,17 @@ class LevelsetP2CL : public ProblemCL< LevelsetCoeffCL, LsetBndDataCL>
 ///  the DOF of the level-set function in order to handle them during the
 ///  refinement and the load-migration.
 /// - In post_refine_sequence the actual work is done.
+///
+/// Sequential, deferred repair: The function is registered in a RepairSetCL in pre_refine_deferred() and
+/// repaired once on the final triangulation.
 class LevelsetRepairCL : public MGObserverCL
 {
   private:
     LevelsetP2CL& ls_;
     std::auto_ptr<RepairP2CL<double> > p2repair_;
+    size_t                   field_;    ///< number of ls_.Phi in the RepairSetCL
+    std::auto_ptr<IdxDescCL> loc_lidx_; ///< numbering on the final triangulation
+    std::auto_ptr<VecDescCL> loc_phi_;  ///< repaired function
 
   public:
     /// \brief Construct a levelset repair class
@@ -187,6 +228,13 @@ class LevelsetRepairCL : public MGObserverCL
 
     void pre_refine_sequence  () {}
     void post_refine_sequence () {}
+
+#ifndef _PAR
+    bool supports_deferred_repair () const { return true; }
+    void pre_refine_deferred  (RepairSetCL&);
+    void pre_repair_deferred  (RepairSetCL&);
+    void post_refine_deferred ();
+#endif
     const IdxDescCL* GetIdxDesc() const { return ls_.Phi.RowIdx; }
 };
 
@@ -204,11 +252,13 @@ private:
 
     int    step_;
     bool   per_;
+    double rpm_NarrowBand_;
 
 public:
-    LevelsetModifyCL( int rpm_Freq, int rpm_Method, double rpm_MaxGrad, double rpm_MinGrad, int lvs_VolCorrection, double Vol, bool periodic=false) :
+    LevelsetModifyCL( int rpm_Freq, int rpm_Method, double rpm_MaxGrad, double rpm_MinGrad, int lvs_VolCorrection, double Vol, bool periodic=false, double rpm_NarrowBand=-1.) :
         rpm_Freq_( rpm_Freq), rpm_Method_( rpm_Method), rpm_MaxGrad_( rpm_MaxGrad),
-        rpm_MinGrad_( rpm_MinGrad), lvs_VolCorrection_( lvs_VolCorrection), Vol_( Vol), step_( 0), per_(periodic) {}
+        rpm_MinGrad_( rpm_MinGrad), lvs_VolCorrection_( lvs_VolCorrection), Vol_( Vol), step_( 0), per_(periodic),
+        rpm_NarrowBand_( rpm_NarrowBand) {}
 
 
     void maybeDoReparam( LevelsetP2CL& lset) {
@@ -217,16 +267,17 @@ public:
 
         double lsetmaxGradPhi, lsetminGradPhi;
 
+        // In narrow band mode, phi is constant outside the band; only the band is checked.
         if (doReparam) {
-            lset.GetMaxMinGradPhi( lsetmaxGradPhi, lsetminGradPhi);
+            lset.GetMaxMinGradPhi( lsetmaxGradPhi, lsetminGradPhi, rpm_NarrowBand_);
             doReparam = (lsetmaxGradPhi > rpm_MaxGrad_ || lsetminGradPhi < rpm_MinGrad_);
         }
 
         // reparam levelset function
         if (doReparam) {
             std::cout << "before reparametrization: minGradPhi " << lsetminGradPhi << "\tmaxGradPhi " << lsetmaxGradPhi << '\n';
-            lset.Reparam( rpm_Method_, per_);
-            lset.GetMaxMinGradPhi( lsetmaxGradPhi, lsetminGradPhi);
+            lset.Reparam( rpm_Method_, per_, rpm_NarrowBand_);
+            lset.GetMaxMinGradPhi( lsetmaxGradPhi, lsetminGradPhi, rpm_NarrowBand_);
             std::cout << "after  reparametrization: minGradPhi " << lsetminGradPhi << "\tmaxGradPhi " << lsetmaxGradPhi << '\n';
             // volume correction after reparametrization
             if (doVolCorr) {
@@ -260,6 +311,14 @@ public:
 
 
 
+/// \brief Throws, if the narrow band of the reparametrization is not wider than the refined zone of AdapTriangCL.
+/// Outside the band, |phi| equals narrow_band; with narrow_band <= adapt_width, every tetra would be refined.
+inline void CheckNarrowBand (double narrow_band, double adapt_width)
+{
+    if (narrow_band > 0. && narrow_band <= adapt_width)
+        throw DROPSErrCL( "CheckNarrowBand: Reparam.NarrowBand must be larger than AdaptRef.Width.\n");
+}
+
 /// marks all tetrahedra in the band |\p DistFct(x)| < \p width for refinement
 void MarkInterface (scalar_fun_ptr DistFct, double width, MultiGridCL&);
 /// marks all tetrahedra in the band |\p lset(x)| < \p width for refinement
@@ -28,84 +28,117 @@
 namespace DROPS
 {
 
+/// \brief Computes the quantities of LevelsetP2CL::GetInfo; used with reduce_tetras.
 template<class DiscVelSolT>
-void LevelsetP2CL::GetInfo( double& maxGradPhi, double& Volume, Point3DCL& bary, Point3DCL& vel, const DiscVelSolT& velsol, Point3DCL& minCoord, Point3DCL& maxCoord, double& surfArea) const
-/**
- * - \p maxGradPhi is the maximal 2-norm of the gradient of the level set function. This can be used as an indicator to decide
- *   whether a reparametrization should be applied.
- * - \p Volume is the volume inside the approximate interface consisting of planar segments.
- * - \p bary is the barycenter of the droplet.
- * - \p vel is the velocity of the barycenter of the droplet.
- * - The entries of \p minCoord store the minimal x, y and z coordinates of the approximative interface, respectively.
- * - The entries of \p maxCoord store the maximal x, y and z coordinates of the approximative interface, respectively.
- * - \p surfArea is the surface area of the approximative interface
- */
+class LevelsetInfoReductionCL
 {
+  private:
+    const LevelsetP2CL& ls_;
+    const DiscVelSolT& velsol_;
+
     Quad2CL<Point3DCL> Grad[10], GradRef[10];
-    SMatrixCL<3,3> T;
-    double det, absdet;
     InterfaceTetraCL tetra;
     InterfaceTriangleCL triangle;
-
-    P2DiscCL::GetGradientsOnRef( GradRef);
-    maxGradPhi= -1.;
-    Volume= 0.;
-    surfArea= 0.;
-    bary[0]= bary[1]= bary[2]= 0;
-    vel[0]= vel[1]= vel[2]= 0;
-    minCoord[0]= minCoord[1]= minCoord[2]= 1e99;
-    maxCoord[0]= maxCoord[1]= maxCoord[2]= -1e99;
-    LocalP2CL<double> ones( 1.);
+    LocalP2CL<double> ones;
     LocalP2CL<Point3DCL> Coord, Vel;
 
-    for (MultiGridCL::const_TriangTetraIteratorCL it=const_cast<const MultiGridCL&>(MG_).GetTriangTetraBegin(), end=const_cast<const MultiGridCL&>(MG_).GetTriangTetraEnd();
-        it!=end; ++it)
-    {
-        GetTrafoTr( T, det, *it);
-        absdet= std::abs( det);
-        P2DiscCL::GetGradients( Grad, GradRef, T); // Gradienten auf aktuellem Tetraeder
+  public:
+    double maxGradPhi, Volume, surfArea;
+    Point3DCL bary, vel, minCoord, maxCoord;
 
-        tetra.Init( *it, Phi, BndData_);
-        triangle.Init( *it, Phi, BndData_);
+    LevelsetInfoReductionCL (const LevelsetP2CL& ls, const DiscVelSolT& velsol)
+        : ls_( ls), velsol_( velsol), ones( 1.), maxGradPhi( -1.), Volume( 0.), surfArea( 0.), bary( 0.), vel( 0.),
+          minCoord( 1e99), maxCoord( -1e99)
+    { P2DiscCL::GetGradientsOnRef( GradRef); }
 
-        // compute maximal norm of grad Phi
-        Quad2CL<Point3DCL> gradPhi;
-        for (int v=0; v<10; ++v) // init gradPhi, Coord
-        {
-            gradPhi+= tetra.GetPhi(v)*Grad[v];
-            Coord[v]= v<4 ? it->GetVertex(v)->GetCoord() : GetBaryCenter( *it->GetEdge(v-4));
+    void operator() (const TetraCL& t);
+    void join (const LevelsetInfoReductionCL& r) {
+        maxGradPhi= std::max( maxGradPhi, r.maxGradPhi);
+        Volume+= r.Volume;
+        surfArea+= r.surfArea;
+        bary+= r.bary;
+        vel+= r.vel;
+        for (int j=0; j<3; ++j) {
+            minCoord[j]= std::min( minCoord[j], r.minCoord[j]);
+            maxCoord[j]= std::max( maxCoord[j], r.maxCoord[j]);
         }
-        Vel.assign( *it, velsol);
-        VectorCL normGrad( 5);
-        for (int v=0; v<5; ++v) // init normGrad
-            normGrad[v]= norm( gradPhi[v]);
-        const double maxNorm= normGrad.max();
-        if (maxNorm > maxGradPhi) maxGradPhi= maxNorm;
-
-        for (int ch=0; ch<8; ++ch)
+    }
+};
+
+template<class DiscVelSolT>
+void LevelsetInfoReductionCL<DiscVelSolT>::operator() (const TetraCL& t)
+{
+    SMatrixCL<3,3> T;
+    double det;
+    GetTrafoTr( T, det, t);
+    const double absdet= std::abs( det);
+    P2DiscCL::GetGradients( Grad, GradRef, T); // Gradienten auf aktuellem Tetraeder
+
+    tetra.Init( t, ls_.Phi, ls_.GetBndData());
+    triangle.Init( t, ls_.Phi, ls_.GetBndData());
+
+    // compute maximal norm of grad Phi
+    Quad2CL<Point3DCL> gradPhi;
+    for (int v=0; v<10; ++v) // init gradPhi, Coord
+    {
+        gradPhi+= tetra.GetPhi(v)*Grad[v];
+        Coord[v]= v<4 ? t.GetVertex(v)->GetCoord() : GetBaryCenter( *t.GetEdge(v-4));
+    }
+    Vel.assign( t, velsol_);
+    VectorCL normGrad( 5);
+    for (int v=0; v<5; ++v) // init normGrad
+        normGrad[v]= norm( gradPhi[v]);
+    const double maxNorm= normGrad.max();
+    if (maxNorm > maxGradPhi) maxGradPhi= maxNorm;
+
+    for (int ch=0; ch<8; ++ch)
+    {
+        // compute volume, barycenter and velocity
+        tetra.ComputeCutForChild(ch);
+        Volume+= tetra.quad( ones, absdet, false);
+        bary+= tetra.quad( Coord, absdet, false);
+        vel+= tetra.quad( Vel, absdet, false);
+
+        // find minimal/maximal coordinates of interface
+        if (!triangle.ComputeForChild(ch)) // no patch for this child
+            continue;
+        for (int tri=0; tri<triangle.GetNumTriangles(); ++tri)
+            surfArea+= triangle.GetAbsDet(tri);
+        for (Uint i=0; i<triangle.GetNumPoints(); ++i)
         {
-            // compute volume, barycenter and velocity
-            tetra.ComputeCutForChild(ch);
-            Volume+= tetra.quad( ones, absdet, false);
-            bary+= tetra.quad( Coord, absdet, false);
-            vel+= tetra.quad( Vel, absdet, false);
-
-            // find minimal/maximal coordinates of interface
-            if (!triangle.ComputeForChild(ch)) // no patch for this child
-                continue;
-            for (int tri=0; tri<triangle.GetNumTriangles(); ++tri)
-                surfArea+= triangle.GetAbsDet(tri);
-            for (Uint i=0; i<triangle.GetNumPoints(); ++i)
+            const Point3DCL p= triangle.GetPoint(i);
+            for (int j=0; j<3; ++j)
             {
-                const Point3DCL p= triangle.GetPoint(i);
-                for (int j=0; j<3; ++j)
-                {
-                    if (p[j] < minCoord[j]) minCoord[j]= p[j];
-                    if (p[j] > maxCoord[j]) maxCoord[j]= p[j];
-                }
+                if (p[j] < minCoord[j]) minCoord[j]= p[j];
+                if (p[j] > maxCoord[j]) maxCoord[j]= p[j];
             }
         }
     }
+}
+
+template<class DiscVelSolT>
+void LevelsetP2CL::GetInfo( double& maxGradPhi, double& Volume, Point3DCL& bary, Point3DCL& vel, const DiscVelSolT& velsol, Point3DCL& minCoord, Point3DCL& maxCoord, double& surfArea) const
+/**
+ * - \p maxGradPhi is the maximal 2-norm of the gradient of the level set function. This can be used as an indicator to decide
+ *   whether a reparametrization should be applied.
+ * - \p Volume is the volume inside the approximate interface consisting of planar segments.
+ * - \p bary is the barycenter of the droplet.
+ * - \p vel is the velocity of the barycenter of the droplet.
+ * - The entries of \p minCoord store the minimal x, y and z coordinates of the approximative interface, respectively.
+ * - The entries of \p maxCoord store the maximal x, y and z coordinates of the approximative interface, respectively.
+ * - \p surfArea is the surface area of the approximative interface
+ */
+{
+    LevelsetInfoReductionCL<DiscVelSolT> red( *this, velsol);
+    reduce_tetras( MG_, /*default-level*/-1, red);
+    maxGradPhi= red.maxGradPhi;
+    Volume=     red.Volume;
+    surfArea=   red.surfArea;
+    bary=       red.bary;
+    vel=        red.vel;
+    minCoord=   red.minCoord;
+    maxCoord=   red.maxCoord;
+
 #ifdef _PAR
     // Globalization of  data
     // -----
@@ -137,10 +170,11 @@ class LevelsetAccumulator_P2CL : public TetraAccumulatorCL
     Quad5CL<double> u_Grad[10]; // fuer u grad v_i
     SMatrixCL<3,3> T;
     LocalNumbP2CL n;
+    const TetraGeometryCL* geom_; ///< cached transformations of the tetras
 
   public:
     LevelsetAccumulator_P2CL( LevelsetP2CL& ls, const DiscVelSolT& vel, double SD, __UNUSED__ double dt)
-      : ls_(ls), vel_(vel), SD_(SD)
+      : ls_(ls), vel_(vel), SD_(SD), geom_( 0)
     { P2DiscCL::GetGradientsOnRef( GradRef); }
 
     ///\brief Initializes matrix-builders and load-vectors
@@ -159,6 +193,7 @@ void LevelsetAccumulator_P2CL<DiscVelSolT>::begin_accumulation ()
     const IdxT num_unks= ls_.Phi.RowIdx->NumUnknowns();
     bE_= new SparseMatBuilderCL<double>(&ls_.E, num_unks, num_unks);
     bH_= new SparseMatBuilderCL<double>(&ls_.H, num_unks, num_unks);
+    geom_= &ls_.GetMG().GetTetraGeometry( ls_.Phi.RowIdx->TriangLevel());
 
 #ifndef _PAR
     __UNUSED__ const IdxT allnum_unks= num_unks;
@@ -190,7 +225,7 @@ void LevelsetAccumulator_P2CL<DiscVelSolT>::visit (const TetraCL& t)
 */
 {
     double det;
-    GetTrafoTr( T, det, t);
+    geom_->GetTrafoTr( T, det, t);
     P2DiscCL::GetGradients( Grad, GradRef, T);
     const double absdet= std::fabs( det),
             h_T= std::pow( absdet, 1./3.);
@@ -230,6 +265,7 @@ template<class DiscVelSolT>
 void LevelsetP2CL::SetupSystem( const DiscVelSolT& vel, __UNUSED__ const double dt)
 /// Setup level set matrices E, H
 {
+    Phi.RowIdx->BuildTetraDoFMap( MG_, BndData_);
     LevelsetAccumulator_P2CL<DiscVelSolT> accu( *this, vel, SD_, dt);
     TetraAccumulatorTupleCL accus;
     accus.push_back( &accu);
@@ -255,5 +291,12 @@ PermutationT LevelsetP2CL::downwind_numbering (const DiscVelSolT& vel, IteratedD
     return p;
 }
 
+inline PermutationT LevelsetP2CL::locality_numbering (LocalityOrderingT ordering)
+{
+    const PermutationT p= DROPS::locality_numbering( MG_, idx, ordering);
+    permute_Vector( Phi.Data, p);
+    return p;
+}
+
 } // end of namespace DROPS
 
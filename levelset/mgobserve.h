@@ -33,6 +33,8 @@
 namespace DROPS
 {
 
+class RepairSetCL;
+
 /// \brief Observer-base-class for the observer-pattern
 ///
 /// AdapTriangCL calls these methods around multigrid-changes. These can be used
@@ -68,6 +70,17 @@ class MGObserverCL
     virtual void pre_refine_sequence  ()= 0;
     /// Called at the end of AdapTriangCL::UpdateTriang().
     virtual void post_refine_sequence ()= 0;
+
+    /// \brief True, if the observer can repair its function once after all refinements of AdapTriangCL::UpdateTriang().
+    /// Then AdapTriangCL calls the following three methods instead of pre_refine() and post_refine().
+    /// The functions of all observers are repaired by a single RepairSetCL.
+    virtual bool supports_deferred_repair () const { return false; }
+    /// Called before the first call of MultiGridCL::Refine() in AdapTriangCL::UpdateTriang(); register the function in the RepairSetCL.
+    virtual void pre_refine_deferred  (RepairSetCL&) {}
+    /// Called after the last call of MultiGridCL::Refine(); create the new numbering and register the target in the RepairSetCL.
+    virtual void pre_repair_deferred  (RepairSetCL&) {}
+    /// Called after RepairSetCL::repair(); replace the function by the repaired one.
+    virtual void post_refine_deferred () {}
 #ifdef _PAR
     /// Get a pointer to the index describer which can be used for loadbalancing
     virtual const IdxDescCL* GetIdxDesc() const= 0;
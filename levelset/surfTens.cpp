@@ -194,7 +194,7 @@ void Strategy( InstatNavierStokes2PhaseP2P1CL& Stokes, const LsetBndDataCL& lsbn
 
         if (P.get<int>("Reparam.Freq") && step%P.get<int>("Reparam.Freq")==0)
         {
-            lset.Reparam( P.get<int>("Reparam.Method"));
+            lset.Reparam( P.get<int>("Reparam.Method"), /*periodic*/ false, P.get<double>("Reparam.NarrowBand", -1.));
             curv.Clear( Stokes.v.t);
             lset.AccumulateBndIntegral( curv);
 
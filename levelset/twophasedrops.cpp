@@ -190,6 +190,18 @@ void Strategy( InstatNavierStokes2PhaseP2P1CL& Stokes, LsetBndDataCL& lsetbnddat
     if (P.get<int>( "Levelset.Downwind.Frequency") > 0)
         lset_downwind= lset.downwind_numbering( Stokes.GetVelSolution(), levelset_downwind);
 
+    // Locality orderings replace the downwind numbering; the permutations are used in the same way for the serialization.
+    if (P.get( "NavStokes.Locality", std::string()) != "") {
+        if (StokesSolverFactoryHelperCL().VelMGUsed( P) || P.get<int>( "NavStokes.Downwind.Frequency") > 0)
+            throw DROPSErrCL( "Strategy: The locality numbering cannot be used together with the multigrid-solver or the downwind-numbering. Sorry.\n");
+        vel_downwind= Stokes.locality_numbering( locality_ordering_from_string( P.get<std::string>( "NavStokes.Locality")));
+    }
+    if (P.get( "Levelset.Locality", std::string()) != "") {
+        if (P.get<int>( "Levelset.Downwind.Frequency") > 0)
+            throw DROPSErrCL( "Strategy: The locality numbering cannot be used together with the downwind-numbering. Sorry.\n");
+        lset_downwind= lset.locality_numbering( locality_ordering_from_string( P.get<std::string>( "Levelset.Locality")));
+    }
+
     DisplayDetailedGeom( MG);
     DisplayUnks(Stokes, lset, MG);
 
@@ -280,7 +292,8 @@ void Strategy( InstatNavierStokes2PhaseP2P1CL& Stokes, LsetBndDataCL& lsetbnddat
            (/*restart*/100, P.get<int>("Levelset.Iter"), P.get<double>("Levelset.Tol"), *lidx, jacparpc,/*rel*/true, /*acc*/ true, /*modGS*/false, LeftPreconditioning, /*parmod*/true);
 #endif
 
-    LevelsetModifyCL lsetmod( P.get<int>("Reparam.Freq"), P.get<int>("Reparam.Method"), P.get<double>("Reparam.MaxGrad"), P.get<double>("Reparam.MinGrad"), P.get<int>("Levelset.VolCorrection"), Vol, is_periodic);
+    CheckNarrowBand( P.get<double>("Reparam.NarrowBand", -1.), P.get<double>("AdaptRef.Width"));
+    LevelsetModifyCL lsetmod( P.get<int>("Reparam.Freq"), P.get<int>("Reparam.Method"), P.get<double>("Reparam.MaxGrad"), P.get<double>("Reparam.MinGrad"), P.get<int>("Levelset.VolCorrection"), Vol, is_periodic, P.get<double>("Reparam.NarrowBand", -1.));
 
     // Time discretisation + coupling
     TimeDisc2PhaseCL* timedisc= CreateTimeDisc(Stokes, lset, navstokessolver, gm, P, lsetmod);
@@ -386,16 +399,31 @@ void Strategy( InstatNavierStokes2PhaseP2P1CL& Stokes, LsetBndDataCL& lsetbnddat
 
     const int nsteps = P.get<int>("Time.NumSteps");
     const double dt = P.get<double>("Time.StepSize");
-    for (int step= 1; step<=nsteps; ++step)
+    // adaptive time steps: the time step size is controlled up to the end time of nsteps steps of size dt
+    TimeStepControlCL* stepcontrol= 0;
+    if (P.get<int>("Time.Adaptive.Use"))
+        stepcontrol= new TimeStepControlCL( *timedisc, dt, P.get<double>("Time.Adaptive.MinStepSize"), P.get<double>("Time.Adaptive.MaxStepSize"),
+            P.get<double>("Time.Adaptive.Tol"), P.get<double>("Time.Adaptive.CFL"), P.get<int>("Time.Adaptive.CouplingIter"), Stokes.v.t + nsteps*dt);
+    for (int step= 1; stepcontrol ? !stepcontrol->Finished() : step<=nsteps; ++step)
     {
         std::cout << "============================================================ step " << step << std::endl;
         const double time_old = Stokes.v.t;
-        const double time_new = Stokes.v.t + dt;
         IFInfo.Update( lset, Stokes.GetVelSolution());
         IFInfo.Write(time_old);
 
         if (P.get("SurfTransp.DoTransp", 0)) surfTransp.InitOld();
-        timedisc->DoStep( P.get<int>("Coupling.Iter"));
+        if (stepcontrol)
+            do {
+                stepcontrol->InitStep();
+                timedisc->DoStep( P.get<int>("Coupling.Iter"));
+            } while (!stepcontrol->CommitStep());
+        else
+            timedisc->DoStep( P.get<int>("Coupling.Iter"));
+        const double time_new = Stokes.v.t;
+        if (stepcontrol) {
+            if (massTransp) massTransp->SetTimeStep( time_new - time_old);
+            surfTransp.SetTimeStep( time_new - time_old);
+        }
         if (massTransp) massTransp->DoStep( time_new);
         if (P.get("SurfTransp.DoTransp", 0)) {
             surfTransp.DoStep( time_new);
@@ -412,6 +440,14 @@ void Strategy( InstatNavierStokes2PhaseP2P1CL& Stokes, LsetBndDataCL& lsetbnddat
             adap.UpdateTriang( lset);
             gridChanged= adap.WasModified();
         }
+        if (gridChanged) { // The new numberings are in the order of CreateNumbering; old permutations do not apply to them.
+            vel_downwind.clear();
+            lset_downwind.clear();
+            if (P.get( "NavStokes.Locality", std::string()) != "")
+                vel_downwind= Stokes.locality_numbering( locality_ordering_from_string( P.get<std::string>( "NavStokes.Locality")));
+            if (P.get( "Levelset.Locality", std::string()) != "")
+                lset_downwind= lset.locality_numbering( locality_ordering_from_string( P.get<std::string>( "Levelset.Locality")));
+        }
         // downwind-numbering for Navier-Stokes
         const bool doNSDownwindNumbering= P.get<int>("NavStokes.Downwind.Frequency")
             && step%P.get<int>("NavStokes.Downwind.Frequency") == 0;
@@ -437,6 +473,7 @@ void Strategy( InstatNavierStokes2PhaseP2P1CL& Stokes, LsetBndDataCL& lsetbnddat
         }
         if (gridChanged || doNSDownwindNumbering || doLsetDownwindNumbering) {
                 timedisc->Update();
+                if (stepcontrol) stepcontrol->Update();
                 if (massTransp) massTransp->Update();
         }
 
@@ -450,6 +487,10 @@ void Strategy( InstatNavierStokes2PhaseP2P1CL& Stokes, LsetBndDataCL& lsetbnddat
     IFInfo.Update( lset, Stokes.GetVelSolution());
     IFInfo.Write(Stokes.v.t);
     std::cout << std::endl;
+    if (stepcontrol) {
+        std::cout << "rejected time steps: " << stepcontrol->GetRejected() << std::endl;
+        delete stepcontrol;
+    }
     delete timedisc;
     delete navstokessolver;
     delete stokessolver;
@@ -478,6 +519,12 @@ void SetMissingParameters(DROPS::ParamCL& P){
     P.put_if_unset<double>("Levelset.Downwind.MaxRelComponentSize", 0.05);
     P.put_if_unset<double>("Levelset.Downwind.WeakEdgeRatio", 0.2);
     P.put_if_unset<double>("Levelset.Downwind.CrosswindLimit", std::cos( M_PI/6.));
+    P.put_if_unset<int>("Time.Adaptive.Use", 0);
+    P.put_if_unset<double>("Time.Adaptive.MinStepSize", 1e-6);
+    P.put_if_unset<double>("Time.Adaptive.MaxStepSize", 1e99);
+    P.put_if_unset<double>("Time.Adaptive.Tol", 1e-3);
+    P.put_if_unset<double>("Time.Adaptive.CFL", 0.5);
+    P.put_if_unset<int>("Time.Adaptive.CouplingIter", 5);
 }
 
 int main (int argc, char** argv)
@@ -564,6 +611,7 @@ int main (int argc, char** argv)
         adap.MakeInitialTriang( * DROPS::ScaMap::getInstance()[InitialLSet]);
 
     std::cout << DROPS::SanityMGOutCL(*mg) << std::endl;
+    mg->SetAccumulationScheduling( DROPS::accumulation_scheduling_from_string( P.get<std::string>( "Accumulation.Scheduling", "Coloring")));
 #ifdef _PAR
     adap.GetLb().GetLB().SetWeightFnct(1);
     if (DROPS::ProcCL::Check( CheckParMultiGrid( adap.GetPMG())))
@@ -27,6 +27,8 @@
 
 #include <vector>
 #include <list>
+#include <limits>
+#include <new>
 #include <cmath>
 #include <iostream>
 #include <valarray>
@@ -1016,25 +1018,220 @@ template <Uint Rows_, Uint Cols_>
     std::copy(buffer+a_.size()+Cols_, buffer+a_.size()+Cols_+Cols_, beta_);
 }
 
+//**************************************************************************
+// Class:   SlabArenaCL                                                    *
+// Purpose: Memory for the nodes of the lists in GlobalListCL. Chunks of   *
+//          equal size are carved from large slabs; there is a separate    *
+//          chain of slabs and a free-list per level.                      *
+// Remarks: Chunks of another size are passed to ::operator new.           *
+//          Each chunk starts with a header, which records the level of    *
+//          its slab: A chunk is always returned to its owning level, even *
+//          if it is deallocated via an allocator of another level.        *
+//**************************************************************************
+class SlabArenaCL
+{
+  private:
+    struct FreeChunkT { FreeChunkT* next; };
+    union ChunkHeaderT { Uint level; double align[2]; }; ///< precedes the memory of each chunk
+    struct LevelStoreT
+    {
+        std::vector<char*> slabs;
+        char*       cur;   ///< next unused chunk in slabs.back()
+        size_t      left;  ///< number of unused chunks in slabs.back()
+        FreeChunkT* free;  ///< recycled chunks
+        size_t      live;  ///< number of chunks in use
+
+        LevelStoreT () : cur( 0), left( 0), free( 0), live( 0) {}
+    };
+
+    size_t                   chunk_size_;      ///< set by the first allocation; includes the header
+    size_t                   chunks_per_slab_;
+    std::vector<LevelStoreT> levels_;
+
+    SlabArenaCL (const SlabArenaCL&);            // not implemented
+    SlabArenaCL& operator= (const SlabArenaCL&); // not implemented
+
+    static size_t round_up (size_t bytes) {
+        const size_t align= 2*sizeof( double) > sizeof( FreeChunkT) ? 2*sizeof( double) : sizeof( FreeChunkT);
+        return (bytes + align - 1)/align*align;
+    }
+    void free_slabs (LevelStoreT& l) {
+        for (size_t i= 0; i < l.slabs.size(); ++i)
+            ::operator delete( l.slabs[i]);
+        l= LevelStoreT();
+    }
+
+    void* allocate_unlocked (size_t bytes, Uint level) {
+        if (chunk_size_ == 0)
+            chunk_size_= sizeof( ChunkHeaderT) + round_up( bytes);
+        if (sizeof( ChunkHeaderT) + round_up( bytes) != chunk_size_)
+            return ::operator new( bytes);
+        if (level >= levels_.size())
+            levels_.resize( level + 1);
+        LevelStoreT& l= levels_[level];
+        ++l.live;
+        ChunkHeaderT* h;
+        if (l.free != 0) {
+            h= reinterpret_cast<ChunkHeaderT*>( l.free);
+            l.free= l.free->next;
+        }
+        else {
+            if (l.left == 0) {
+                l.slabs.push_back( static_cast<char*>( ::operator new( chunks_per_slab_*chunk_size_)));
+                l.cur= l.slabs.back();
+                l.left= chunks_per_slab_;
+            }
+            h= reinterpret_cast<ChunkHeaderT*>( l.cur);
+            l.cur+= chunk_size_;
+            --l.left;
+        }
+        h->level= level;
+        return h + 1;
+    }
+    /// The chunk is returned to the level recorded in its header, not to the level of the deallocating allocator.
+    void deallocate_unlocked (void* p, size_t bytes) {
+        if (sizeof( ChunkHeaderT) + round_up( bytes) != chunk_size_) {
+            ::operator delete( p);
+            return;
+        }
+        ChunkHeaderT* h= static_cast<ChunkHeaderT*>( p) - 1;
+        LevelStoreT& l= levels_[h->level];
+        FreeChunkT* c= reinterpret_cast<FreeChunkT*>( h);
+        c->next= l.free;
+        l.free= c;
+        --l.live;
+    }
+
+  public:
+    explicit SlabArenaCL (size_t chunks_per_slab= 512)
+        : chunk_size_( 0), chunks_per_slab_( chunks_per_slab) {}
+    ~SlabArenaCL () {
+        for (size_t i= 0; i < levels_.size(); ++i)
+            free_slabs( levels_[i]);
+    }
+
+    /// Within a parallel region, the arena is locked; MultiGridCL::RefineGrid fills thread-local lists concurrently.
+    void* allocate (size_t bytes, Uint level) {
+#ifdef _OPENMP
+        if (omp_in_parallel()) {
+            void* ret;
+#           pragma omp critical (SlabArenaCL)
+            ret= allocate_unlocked( bytes, level);
+            return ret;
+        }
+#endif
+        return allocate_unlocked( bytes, level);
+    }
+    void deallocate (void* p, size_t bytes) {
+#ifdef _OPENMP
+        if (omp_in_parallel()) {
+#           pragma omp critical (SlabArenaCL)
+            deallocate_unlocked( p, bytes);
+            return;
+        }
+#endif
+        deallocate_unlocked( p, bytes);
+    }
+    /// \brief Return the slabs of level to the system, if none of its chunks is in use.
+    void release_level (Uint level) {
+        if (level < levels_.size() && levels_[level].live == 0)
+            free_slabs( levels_[level]);
+    }
+
+    /// \brief Number of slabs of all levels.
+    size_t GetNumSlabs () const {
+        size_t n= 0;
+        for (size_t i= 0; i < levels_.size(); ++i)
+            n+= levels_[i].slabs.size();
+        return n;
+    }
+    /// \brief Number of chunks in use.
+    size_t GetNumChunks () const {
+        size_t n= 0;
+        for (size_t i= 0; i < levels_.size(); ++i)
+            n+= levels_[i].live;
+        return n;
+    }
+    /// \brief Memory held by the slabs in bytes.
+    size_t GetMemory () const { return GetNumSlabs()*chunks_per_slab_*chunk_size_; }
+};
+
+//**************************************************************************
+// Class:   SlabAllocatorCL                                                *
+// Purpose: STL-allocator, which takes its memory from a SlabArenaCL.      *
+// Remarks: All allocators of the same arena compare equal, thus nodes can *
+//          be spliced between the lists of different levels.              *
+//**************************************************************************
+template <class T>
+class SlabAllocatorCL
+{
+  public:
+    typedef T              value_type;
+    typedef T*             pointer;
+    typedef const T*       const_pointer;
+    typedef T&             reference;
+    typedef const T&       const_reference;
+    typedef std::size_t    size_type;
+    typedef std::ptrdiff_t difference_type;
+
+    template <class U>
+    struct rebind { typedef SlabAllocatorCL<U> other; };
+
+    SlabArenaCL* arena_;
+    Uint         level_;
+
+    explicit SlabAllocatorCL (SlabArenaCL* arena= 0, Uint level= 0) : arena_( arena), level_( level) {}
+    template <class U>
+    SlabAllocatorCL (const SlabAllocatorCL<U>& a) : arena_( a.arena_), level_( a.level_) {}
+
+    pointer       address (reference x)       const { return &x; }
+    const_pointer address (const_reference x) const { return &x; }
+
+    pointer allocate (size_type n, const void* = 0) {
+        return static_cast<pointer>( arena_ != 0 && n == 1 ? arena_->allocate( sizeof( T), level_)
+                                                           : ::operator new( n*sizeof( T)));
+    }
+    void deallocate (pointer p, size_type n) {
+        if (arena_ != 0 && n == 1)
+            arena_->deallocate( p, sizeof( T));
+        else
+            ::operator delete( p);
+    }
+    size_type max_size () const { return std::numeric_limits<size_type>::max()/sizeof( T); }
+
+    void construct (pointer p, const T& val) { new (static_cast<void*>( p)) T( val); }
+    void destroy (pointer p) { p->~T(); }
+};
+
+template <class T, class U>
+inline bool operator== (const SlabAllocatorCL<T>& a, const SlabAllocatorCL<U>& b) { return a.arena_ == b.arena_; }
+template <class T, class U>
+inline bool operator!= (const SlabAllocatorCL<T>& a, const SlabAllocatorCL<U>& b) { return a.arena_ != b.arena_; }
+
 //**************************************************************************
 // Class:   GlobalListCL                                                   *
 // Purpose: A list that is subdivided in levels. For modifications, it can *
 //          efficiently be split into std::lists per level and then merged *
 //          after modifications.                                           *
 // Remarks: Negative level-indices count backwards from end().             *
+//          The list-nodes live in a SlabArenaCL: Addresses are stable,    *
+//          the elements of a level are stored in contiguous slabs and     *
+//          removed elements are recycled.                                 *
 //**************************************************************************
 template <class T>
 class GlobalListCL
 {
   public:
-    typedef std::list<T>                  Cont;
-    typedef std::list<T>                  LevelCont;
+    typedef SlabAllocatorCL<T>            Allocator;
+    typedef std::list<T, Allocator>       Cont;
+    typedef std::list<T, Allocator>       LevelCont;
     typedef typename Cont::iterator       iterator;
     typedef typename Cont::const_iterator const_iterator;
     typedef typename LevelCont::iterator       LevelIterator;
     typedef typename LevelCont::const_iterator const_LevelIterator;
 
   private:
+    SlabArenaCL                 Arena_;
     Cont                        Data_;
     std::vector<iterator>       LevelStarts_;
     std::vector<const_iterator> const_LevelStarts_;
@@ -1044,9 +1241,18 @@ class GlobalListCL
     int
     StdLevel (int lvl) const { return lvl >= 0 ? lvl : lvl + GetNumLevel(); }
 
+    GlobalListCL (const GlobalListCL&);            // not implemented: the nodes belong to Arena_
+    GlobalListCL& operator= (const GlobalListCL&); // not implemented
+
   public:
-    GlobalListCL (bool modifiable= true) : modifiable_( modifiable) {}
-    // standard dtor
+    GlobalListCL (bool modifiable= true) : Data_( Allocator( &Arena_)), modifiable_( modifiable) {}
+    ~GlobalListCL () {
+        for (Uint lvl= 0; lvl < LevelViews_.size(); ++lvl)
+            delete LevelViews_[lvl];
+    }
+
+    /// \brief The memory of the list-nodes
+    const SlabArenaCL& GetArena () const { return Arena_; }
 
     Uint GetNumLevel () const {
         return modifiable_ ? LevelViews_.size()
@@ -1101,7 +1307,7 @@ template <class T>
         "Inconsistent LevelViews_."), DebugContainerC );
     LevelViews_.resize( GetNumLevel());
     for (Uint lvl= 0, numlvl= GetNumLevel(); lvl < numlvl; ++lvl) {
-        LevelViews_[lvl]= new LevelCont();
+        LevelViews_[lvl]= new LevelCont( Allocator( &Arena_, lvl));
         LevelViews_[lvl]->splice( LevelViews_[lvl]->end(), Data_,
             level_begin( lvl), level_begin( lvl+1));
     }
@@ -1148,7 +1354,7 @@ template <class T>
 {
     Assert( modifiable_, DROPSErrCL("GlobalListCL::AppendLevel: "
         "Data not modifiable."), DebugContainerC );
-    LevelViews_.push_back( new LevelCont());
+    LevelViews_.push_back( new LevelCont( Allocator( &Arena_, LevelViews_.size())));
 }
 
 template <class T>
@@ -1163,6 +1369,7 @@ template <class T>
         "Last level not empty"), DebugContainerC);
     delete LevelViews_.back();
     LevelViews_.pop_back();
+    Arena_.release_level( LevelViews_.size());
 }
 
 //**************************************************************************
@@ -38,6 +38,10 @@
       <li>
         The tree is built by the builder pattern by the class \ref TreeBuilderCL.
       </li>
+      <li>
+        A built tree can be modified by the class \ref TreeUpdaterCL, i.e., points can be
+        inserted, removed, and moved.
+      </li>
       <li>
         Various search operations like search m nearest neighbors, neighbors in a given
         sphere, etc., are implemented by the strategy pattern. The search operations
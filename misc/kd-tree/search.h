@@ -143,7 +143,8 @@ namespace KDTree{
     protected:  // ------- member functions ------- 
         void initialize();                                                          ///< put the first nnn points in the result
         void finalize();                                                            ///< for specific metrics, determine the roots
-        inline void update( const size_t& idx, const T& d) { p_res.update(idx,d); } ///< update the list of nearest neighbors
+        /// \brief update the list of nearest neighbors; the first nnn points are already put in the result by initialize
+        inline void update( const size_t& idx, const T& d) { if ( idx>=p_res.nnn()) p_res.update(idx,d); }
         inline T distance() const { return p_res.distance(); }                      ///< get the distance to the point which is far away
 
     public:  // ------- member functions ------- 
@@ -434,12 +435,16 @@ namespace KDTree{
     }
 
 
-    /** Renormalize the distances. */
+    /** Renormalize the search radius and the distances. */
     template <usint metric, typename T, usint K, int BucketSize>
     void SearchNeighborsCL<metric, T, K, BucketSize>::finalize()
     {
-        if ( metric!=0 && metric!=1)
+        if ( metric!=0 && metric!=1){
             p_res.radius()= std::pow( p_res.radius(), static_cast<T>(1)/static_cast<T>(metric));
+            for ( typename result_type::iterator it( p_res.begin()); it!=p_res.end(); ++it){
+                it->distance()= metric==2 ? std::sqrt(it->distance()) : std::pow(it->distance(), static_cast<T>(1)/static_cast<T>(metric));
+            }
+        }
     }
 
 }
@@ -395,7 +395,7 @@ namespace KDTree{
                         success= true;
                     }
                     else {                                              // try the next dimension
-                        node->sdim() = (d+node->sdim()) % K;
+                        node->sdim() = (node->sdim()+1) % K;
                     }
                 }
                 if ( !success){             // merge the points in the interval [first,last)
@@ -548,7 +548,7 @@ namespace KDTree{
 
         // optimize the data
         p_tree.data().resize( (n-p_skipped)*K);
-        p_tree.origidx().resize( (n-p_skipped)*K);
+        p_tree.origidx().resize( n-p_skipped);
         size_t first_free=0;
         optimize( first_free, p_tree.root());
         
@@ -0,0 +1,432 @@
+/// \file   tree_updater.h
+/// \brief  Incremental modification of a kd-tree
+/// \author LNM RWTH Aachen: Joerg Grande; SC RWTH Aachen:
+
+/*
+ * This file is part of DROPS.
+ *
+ * DROPS is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * DROPS is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with DROPS. If not, see <http://www.gnu.org/licenses/>.
+ *
+ *
+ * Copyright 2011 LNM/SC RWTH Aachen, Germany
+*/
+
+
+#ifndef TREE_UPDATER_H
+#define TREE_UPDATER_H
+
+#include "misc/kd-tree/tree.h"
+#include "misc/kd-tree/node.h"
+#include "misc/kd-tree/bounding_box.h"
+#include "misc/kd-tree/bucket.h"
+#include "misc/kd-tree/kd_tree_utils.h"
+
+namespace DROPS{
+namespace KDTree{
+
+    /// \brief Modify a kd-tree built by \ref TreeBuilderCL \anchor TreeUpdaterCL
+    /** This class inserts and removes points of a kd-tree and moves points to new
+        coordinates. The points are addressed by their original index, i.e., the
+        index returned by \ref TreeCL::get_orig. Original indices must be smaller
+        than the number given to the constructor.
+
+        Inserting a point into a full bucket splits the leaf at the median of the
+        largest spread. Removing a point keeps the data of the tree contiguous by
+        moving the last point of the data array into the gap. Moving points does
+        not change the structure of the tree, hence, the bounding boxes have to be
+        adapted by \ref refit afterwards. Then, the bounding boxes of siblings may
+        overlap, which slows down the search.
+
+        The function \ref quality measures the degradation of the tree compared to a
+        freshly built tree. If it becomes small, the tree should be rebuilt.
+
+        As the builder, this class represents identical points by a single point:
+        If a point is inserted into a full bucket with identical points, it is not
+        stored.
+
+        \tparam T            type of a scalar data entry, e.g., component of a vector
+        \tparam K            dimension of the space
+        \tparam BucketSize   size of buckets
+    */
+    template <typename T, usint K, int BucketSize=12>
+    class TreeUpdaterCL
+    {
+    public:    // ------- type definitions -------
+        typedef TreeCL<T, K, BucketSize>            tree_type;              ///< type of the tree
+        typedef internal::NodeCL<T,K,BucketSize>    node_type;              ///< type of a node
+        typedef internal::BoundingBoxCL<T,K>        bounding_box_type;      ///< type of the bounding box
+        typedef internal::BucketCL<BucketSize>      bucket_type;            ///< type of the bucket
+
+    private:  // ------- member variables -------
+        tree_type&               p_tree;                                    ///< the tree to be modified
+        std::vector<node_type*>  p_leaf;                                    ///< leaf storing the point at a position of the data of the tree
+        std::vector<size_t>      p_pos;                                     ///< position of an original index in the data of the tree; NoIdx, if the point is not stored
+        size_t                   p_skipped;                                 ///< number of inserted points merged into an identical point
+
+    private:  // ------- member functions -------
+        /// \name Helper functions
+        //@{
+        void init_rec( node_type*);                                         ///< set the leaf of all positions in the subtree
+        void refit_rec( node_type*);                                        ///< determine the bounding boxes in the subtree
+        void quality_rec( const node_type*, size_t, size_t&, size_t&, size_t&, T&) const; ///< collect data for the quality
+        void leafBB( node_type*);                                           ///< exact bounding box of a leaf
+        bool split( node_type*, size_t);                                    ///< split a full leaf to insert a point
+        void remove_pos( size_t);                                           ///< remove the point at a position
+        static int num_elems( const bucket_type&);                          ///< number of points in a bucket
+        //@}
+
+        /// \brief dummy declaration to get rid of warnings
+        TreeUpdaterCL<T,K,BucketSize>& operator= ( const TreeUpdaterCL<T,K,BucketSize>&);
+
+    public:  // ------- member functions -------
+        /// \brief Constructor for a tree built with original indices smaller than \a num_orig
+        TreeUpdaterCL( tree_type& tree, size_t num_orig);
+        ~TreeUpdaterCL() {}                                                 ///< Destructor
+
+        /// \brief Check, if the point with original index \a orig is stored
+        bool contains( size_t orig) const { return orig<p_pos.size() && p_pos[orig]!=NoIdx; }
+        /// \brief Coordinates of the stored point with original index \a orig
+        T const * point( size_t orig) const { return p_tree.addr( p_pos[orig]); }
+        /// \brief number of inserted points, which have been merged into an identical point
+        size_t skipped() const { return p_skipped; }
+
+        /// \name modify the tree
+        //@{
+        void insert( const std::vector<size_t>&, T const *);                ///< insert a batch of points
+        void remove( const std::vector<size_t>&);                           ///< remove a batch of points
+        void move( size_t, T const *);                                      ///< assign new coordinates to a point
+        void refit();                                                       ///< determine all bounding boxes
+        //@}
+
+        /// \brief Quality of the tree in (0,1]; approximately 1 for a freshly built tree
+        double quality() const;
+    };
+
+
+
+    /* ******************************************************************** */
+    /*  D E F I N I T I O N   O F   T E M P L A T E   F U N C T I O N S     */
+    /* ******************************************************************** */
+
+    /** Record the leaf and the position of each point stored in the tree.
+        \param tree     a tree built by \ref TreeBuilderCL
+        \param num_orig all original indices of the tree are smaller than num_orig
+    */
+    template <typename T, usint K, int BucketSize>
+    TreeUpdaterCL<T,K,BucketSize>::TreeUpdaterCL( tree_type& tree, size_t num_orig)
+        : p_tree( tree), p_leaf( tree.size(), 0), p_pos( num_orig, NoIdx), p_skipped( 0)
+    {
+        for ( size_t i=0; i<p_tree.size(); ++i)
+            p_pos[p_tree.get_orig( i)]= i;
+        if ( p_tree.root()!=0)
+            init_rec( p_tree.root());
+    }
+
+
+    template <typename T, usint K, int BucketSize>
+    void TreeUpdaterCL<T,K,BucketSize>::init_rec( node_type* node)
+    {
+        if ( node->isLeaf()){
+            const bucket_type& bucket= node->bucket();
+            for ( int i=0; i<BucketSize && bucket[i]!=NoIdx; ++i)
+                p_leaf[bucket[i]]= node;
+        }
+        else {
+            init_rec( node->left());
+            init_rec( node->right());
+        }
+    }
+
+
+    template <typename T, usint K, int BucketSize>
+    inline int TreeUpdaterCL<T,K,BucketSize>::num_elems( const bucket_type& bucket)
+    {
+        int n= 0;
+        while ( n<BucketSize && bucket[n]!=NoIdx)
+            ++n;
+        return n;
+    }
+
+
+    /** Determine the exact bounding box of the points in the bucket of a leaf. The
+        bounding box of an empty leaf is empty, i.e., it does not intersect any sphere
+        and does not enlarge the bounding box of its parent.
+    */
+    template <typename T, usint K, int BucketSize>
+    void TreeUpdaterCL<T,K,BucketSize>::leafBB( node_type* node)
+    {
+        bounding_box_type& bb= node->bounding_box();
+        for ( usint j=0; j<K; ++j){
+            bb[2*j]  =  std::numeric_limits<T>::max();
+            bb[2*j+1]= -std::numeric_limits<T>::max();
+        }
+        const bucket_type& bucket= node->bucket();
+        for ( int i=0; i<BucketSize && bucket[i]!=NoIdx; ++i){
+            T const * p= p_tree.addr( bucket[i]);
+            for ( usint j=0; j<K; ++j){
+                bb[2*j]  = std::min( bb[2*j],   p[j]);
+                bb[2*j+1]= std::max( bb[2*j+1], p[j]);
+            }
+        }
+    }
+
+
+    template <typename T, usint K, int BucketSize>
+    void TreeUpdaterCL<T,K,BucketSize>::refit_rec( node_type* node)
+    {
+        if ( node->isLeaf()){
+            leafBB( node);
+            return;
+        }
+        refit_rec( node->left());
+        refit_rec( node->right());
+        bounding_box_type&       bb      = node->bounding_box();
+        const bounding_box_type& bb_left = node->left()->bounding_box();
+        const bounding_box_type& bb_right= node->right()->bounding_box();
+        for ( usint i=0; i<K; ++i){
+            bb[2*i  ]= std::min( bb_left[2*i],   bb_right[2*i]);
+            bb[2*i+1]= std::max( bb_left[2*i+1], bb_right[2*i+1]);
+        }
+    }
+
+
+    /** The leaf \a node contains BucketSize points. Together with the point at position
+        \a pos, they are divided by the median of the largest spread into two new leaves.
+        If the points cannot be divided in any dimension, they are identical and nothing
+        is changed.
+        \return true iff the leaf has been split
+    */
+    template <typename T, usint K, int BucketSize>
+    bool TreeUpdaterCL<T,K,BucketSize>::split( node_type* node, size_t pos)
+    {
+        std::vector<size_t> idx( BucketSize+1);
+        for ( int i=0; i<BucketSize; ++i)
+            idx[i]= node->bucket()[i];
+        idx[BucketSize]= pos;
+
+        bounding_box_type bb;
+        for ( usint j=0; j<K; ++j){
+            bb[2*j]  =  std::numeric_limits<T>::max();
+            bb[2*j+1]= -std::numeric_limits<T>::max();
+        }
+        for ( size_t i=0; i<idx.size(); ++i)
+            for ( usint j=0; j<K; ++j){
+                bb[2*j]  = std::min( bb[2*j],   p_tree.addr( idx[i])[j]);
+                bb[2*j+1]= std::max( bb[2*j+1], p_tree.addr( idx[i])[j]);
+            }
+        usint sdim= bb.suggestSplitDim();
+        if ( sdim==K)
+            return false;
+
+        for ( usint d=0; d<K; ++d, sdim= (sdim+1)%K){
+            std::vector<T> vals( idx.size());
+            for ( size_t i=0; i<idx.size(); ++i)
+                vals[i]= p_tree.addr( idx[i])[sdim];
+            std::nth_element( vals.begin(), vals.begin()+vals.size()/2, vals.end());
+            const T median= vals[vals.size()/2];
+            size_t num_left= 0;
+            for ( size_t i=0; i<idx.size(); ++i)
+                num_left+= p_tree.addr( idx[i])[sdim]<median;
+            if ( num_left==0 || num_left==idx.size())
+                continue;
+
+            // build the two leaves as the builder does: left are the points smaller than the median
+            node->sdim()= sdim;
+            node->sval()= median;
+            node->left()=  new node_type();
+            node->right()= new node_type();
+            int n_left= 0, n_right= 0;
+            for ( int i=0; i<BucketSize; ++i)
+                node->left()->bucket()[i]= node->right()->bucket()[i]= NoIdx;
+            for ( size_t i=0; i<idx.size(); ++i){
+                node_type* child= p_tree.addr( idx[i])[sdim]<median ? node->left() : node->right();
+                child->bucket()[child==node->left() ? n_left++ : n_right++]= idx[i];
+                p_leaf[idx[i]]= child;
+            }
+            leafBB( node->left());
+            leafBB( node->right());
+            node->bounding_box()= bb;
+            return true;
+        }
+        return false;
+    }
+
+
+    /** Each point is inserted in the leaf, which is found by the split values. The
+        bounding boxes on the path are enlarged. If the bucket is full, the leaf is split.
+        \param orig original indices of the points; they must not be stored in the tree
+        \param data coordinates of the points; point i is located at K*i,...,K*i+(K-1)
+    */
+    template <typename T, usint K, int BucketSize>
+    void TreeUpdaterCL<T,K,BucketSize>::insert( const std::vector<size_t>& orig, T const * data)
+    {
+        typename tree_type::value_vec_type& tree_data= p_tree.data();
+        typename tree_type::index_vec_type& origidx  = p_tree.origidx();
+        for ( size_t i=0; i<orig.size(); ++i){
+            T const * p= data+K*i;
+            const size_t pos= p_tree.size();
+            tree_data.insert( tree_data.end(), p, p+K);
+            origidx.push_back( orig[i]);
+            p_leaf.push_back( 0);
+            p_pos[orig[i]]= pos;
+
+            if ( p_tree.root()==0){                                 // empty tree
+                p_tree.root()= new node_type();
+                for ( int j=0; j<BucketSize; ++j)
+                    p_tree.root()->bucket()[j]= NoIdx;
+                leafBB( p_tree.root());
+            }
+            node_type* node= p_tree.root();
+            for (;;){
+                bounding_box_type& bb= node->bounding_box();
+                for ( usint j=0; j<K; ++j){
+                    bb[2*j]  = std::min( bb[2*j],   p[j]);
+                    bb[2*j+1]= std::max( bb[2*j+1], p[j]);
+                }
+                if ( node->isLeaf())
+                    break;
+                node= p[node->sdim()]<node->sval() ? node->left() : node->right();
+            }
+
+            const int n= num_elems( node->bucket());
+            if ( n<BucketSize){
+                node->bucket()[n]= pos;
+                p_leaf[pos]= node;
+            }
+            else if ( !split( node, pos)){                          // merge identical points
+                tree_data.resize( K*pos);
+                origidx.pop_back();
+                p_leaf.pop_back();
+                p_pos[orig[i]]= NoIdx;
+                ++p_skipped;
+            }
+        }
+    }
+
+
+    /** Remove the point at position \a pos from its bucket. The last point of the data
+        array is moved to position \a pos.
+    */
+    template <typename T, usint K, int BucketSize>
+    void TreeUpdaterCL<T,K,BucketSize>::remove_pos( size_t pos)
+    {
+        bucket_type& bucket= p_leaf[pos]->bucket();
+        const int n= num_elems( bucket);
+        for ( int i=0; i<n; ++i)
+            if ( bucket[i]==pos){
+                bucket[i]= bucket[n-1];
+                bucket[n-1]= NoIdx;
+                break;
+            }
+        p_pos[p_tree.get_orig( pos)]= NoIdx;
+
+        typename tree_type::value_vec_type& tree_data= p_tree.data();
+        typename tree_type::index_vec_type& origidx  = p_tree.origidx();
+        const size_t last= p_tree.size()-1;
+        if ( pos!=last){
+            std::copy( tree_data.begin()+K*last, tree_data.begin()+K*(last+1), tree_data.begin()+K*pos);
+            origidx[pos]= origidx[last];
+            p_pos[origidx[pos]]= pos;
+            p_leaf[pos]= p_leaf[last];
+            bucket_type& last_bucket= p_leaf[pos]->bucket();
+            for ( int i=0; i<BucketSize; ++i)
+                if ( last_bucket[i]==last){
+                    last_bucket[i]= pos;
+                    break;
+                }
+        }
+        tree_data.resize( K*last);
+        origidx.resize( last);
+        p_leaf.resize( last);
+    }
+
+
+    /** The bounding boxes are not shrunk; they still enclose all points.
+        \param orig original indices of the points; indices, which are not stored, are ignored
+    */
+    template <typename T, usint K, int BucketSize>
+    void TreeUpdaterCL<T,K,BucketSize>::remove( const std::vector<size_t>& orig)
+    {
+        for ( size_t i=0; i<orig.size(); ++i)
+            if ( contains( orig[i]))
+                remove_pos( p_pos[orig[i]]);
+    }
+
+
+    /** Only the coordinates are changed. Call \ref refit before searching the tree.
+        \param orig original index of a stored point
+        \param p    new coordinates
+    */
+    template <typename T, usint K, int BucketSize>
+    inline void TreeUpdaterCL<T,K,BucketSize>::move( size_t orig, T const * p)
+    {
+        std::copy( p, p+K, p_tree.data().begin()+K*p_pos[orig]);
+    }
+
+
+    /** Determine the exact bounding boxes of all nodes bottom-up. The split values are not changed. */
+    template <typename T, usint K, int BucketSize>
+    void TreeUpdaterCL<T,K,BucketSize>::refit()
+    {
+        if ( p_tree.root()!=0)
+            refit_rec( p_tree.root());
+    }
+
+
+    /** Traverse the tree and collect the number of leaves, the maximal level of a leaf and,
+        for internal nodes, the overlap of the bounding boxes of the children in the split
+        dimension relative to the extent of the node.
+    */
+    template <typename T, usint K, int BucketSize>
+    void TreeUpdaterCL<T,K,BucketSize>::quality_rec( const node_type* node, size_t level, size_t& num_leaves,
+        size_t& max_level, size_t& num_internal, T& overlap) const
+    {
+        if ( node->isLeaf()){
+            ++num_leaves;
+            max_level= std::max( max_level, level);
+            return;
+        }
+        const usint sdim= node->sdim();
+        const T extent= node->bounding_box()[2*sdim+1]-node->bounding_box()[2*sdim];
+        const T ov= node->left()->bounding_box()[2*sdim+1]-node->right()->bounding_box()[2*sdim];
+        if ( extent>std::numeric_limits<T>::epsilon() && ov>0)
+            overlap+= std::min( ov/extent, static_cast<T>(1));
+        ++num_internal;
+        quality_rec( node->left(),  level+1, num_leaves, max_level, num_internal, overlap);
+        quality_rec( node->right(), level+1, num_leaves, max_level, num_internal, overlap);
+    }
+
+
+    /** The quality is the product of two factors:
+        - the ratio of the height of a balanced tree with full buckets and the height of the tree;
+          the height grows by inserting points;
+        - one minus the mean overlap of the bounding boxes of siblings in the split dimension
+          relative to the extent of the parent; moving points causes overlaps.
+        \pre the bounding boxes are exact, i.e., \ref refit has been called after moving points
+    */
+    template <typename T, usint K, int BucketSize>
+    double TreeUpdaterCL<T,K,BucketSize>::quality() const
+    {
+        if ( p_tree.root()==0 || p_tree.size()<=BucketSize)
+            return 1.;
+        size_t num_leaves= 0, max_level= 0, num_internal= 0;
+        T overlap= 0;
+        quality_rec( p_tree.root(), 0, num_leaves, max_level, num_internal, overlap);
+        const double ideal_level= std::ceil( std::log( std::ceil( double(p_tree.size())/BucketSize))/std::log( 2.));
+        const double height= std::min( 1., (ideal_level+1.)/(max_level+1.));
+        return height*(1. - (num_internal>0 ? double(overlap)/num_internal : 0.));
+    }
+}
+}
+#endif
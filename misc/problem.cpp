@@ -33,11 +33,20 @@ namespace DROPS
 {
 
 const Uint        IdxDescCL::InvalidIdx = std::numeric_limits<Uint>::max();
-std::vector<bool> IdxDescCL::IdxFree;
+
+size_t IdxDescCL::NewNumberingVersion()
+{
+    static size_t version= 0;
+    size_t ret;
+#   pragma omp critical(NewNumberingVersion)
+    ret= ++version;
+    return ret;
+}
 
 IdxDescCL::IdxDescCL( FiniteElementT fe, const BndCondCL& bnd, match_fun match, double omit_bound)
-    : FE_InfoCL( fe), Idx_( GetFreeIdx()), TriangLevel_( 0), NumUnknowns_( 0), Bnd_(bnd), match_(match),
-      extIdx_( omit_bound != -99 ? omit_bound : IsExtended() ? 1./32. : -1.) // default value is 1./32. for XFEM and -1 otherwise
+    : FE_InfoCL( fe), Idx_( UnknownTableCL::AcquireSystem()), TriangLevel_( 0), NumUnknowns_( 0), Bnd_(bnd), match_(match),
+      extIdx_( omit_bound != -99 ? omit_bound : IsExtended() ? 1./32. : -1.), // default value is 1./32. for XFEM and -1 otherwise
+      numbering_version_( NewNumberingVersion())
 {
 #ifdef _PAR
     ex_= new ExchangeCL();
@@ -47,30 +56,19 @@ IdxDescCL::IdxDescCL( FiniteElementT fe, const BndCondCL& bnd, match_fun match,
 IdxDescCL::~IdxDescCL()
 {
     if (Idx_!=InvalidIdx)
-        IdxFree[Idx_]= true;
+        UnknownTableCL::ReleaseSystem( Idx_);
 #ifdef _PAR
     delete ex_;
 #endif
 }
 
-Uint IdxDescCL::GetFreeIdx()
-{
-    size_t sysnum= 0;
-    for (; sysnum<IdxFree.size(); ++sysnum)
-        if (IdxFree[sysnum]) break;
-    if (sysnum>=IdxFree.size())
-        IdxFree.push_back( false);
-    else
-        IdxFree[sysnum]= false;
-    return sysnum;
-}
-
 IdxDescCL::IdxDescCL( const IdxDescCL& orig)
  : FE_InfoCL(orig), Idx_(orig.Idx_), TriangLevel_(orig.TriangLevel_), NumUnknowns_(orig.NumUnknowns_),
-   Bnd_(orig.Bnd_), match_(orig.match_), extIdx_(orig.extIdx_)
+   Bnd_(orig.Bnd_), match_(orig.match_), extIdx_(orig.extIdx_), numbering_version_(orig.numbering_version_)
 {
     // invalidate orig
     const_cast<IdxDescCL&>(orig).Idx_= InvalidIdx;
+    dofmap_.swap( const_cast<IdxDescCL&>(orig).dofmap_);
 #ifdef _PAR
     ex_= new ExchangeCL(*orig.ex_);
 #endif
@@ -87,6 +85,8 @@ void IdxDescCL::swap( IdxDescCL& obj)
     std::swap( Bnd_,         obj.Bnd_);
     std::swap( match_,       obj.match_);
     std::swap( extIdx_,      obj.extIdx_);
+    dofmap_.swap( obj.dofmap_);
+    std::swap( numbering_version_, obj.numbering_version_);
 #ifdef _PAR
     std::swap( ex_,          obj.ex_);
 #endif
@@ -418,6 +418,7 @@ void IdxDescCL::CreateNumbering( Uint level, MultiGridCL& mg, const VecDescCL* l
 /// is performed, too.
 /// After that the extended DoFs are numbered for extended FE.
 {
+    InvalidateTetraDoFMap();
     if (IsOnInterface())
     {
 #ifdef _PAR
@@ -438,10 +439,10 @@ void IdxDescCL::CreateNumbering( Uint level, MultiGridCL& mg, const VecDescCL* l
 #endif
 }
 
-void IdxDescCL::UpdateXNumbering( MultiGridCL& mg, const VecDescCL& lset, const BndDataCL<>& lsetbnd)
+void IdxDescCL::UpdateXNumbering( MultiGridCL& mg, const VecDescCL& lset, const BndDataCL<>& lsetbnd, const InterfaceBandCL* band)
 {
     if (IsExtended()) {
-        NumUnknowns_= extIdx_.UpdateXNumbering( this, mg, lset, lsetbnd, false);
+        NumUnknowns_= extIdx_.UpdateXNumbering( this, mg, lset, lsetbnd, false, band);
 #ifdef _PAR
         ex_->CreateList(mg, this, true, true);
 #endif
@@ -452,9 +453,10 @@ void IdxDescCL::DeleteNumbering(MultiGridCL& MG)
 /// This routine writes NoIdx as unknown-index for all indices of the
 /// given index-description. NumUnknowns will be set to zero.
 {
-    const Uint idxnum = GetIdx();    // idx is the index in UnknownIdxCL
+    const Uint idxnum = GetIdx();    // idx is the index in UnknownTableCL
     const Uint level  = TriangLevel_;
     NumUnknowns_ = 0;
+    InvalidateTetraDoFMap();
 
     // delete memory allocated for indices
     if (NumUnknownsVertex())
@@ -471,7 +473,8 @@ void IdxDescCL::DeleteNumbering(MultiGridCL& MG)
 #endif
 }
 
-IdxT ExtIdxDescCL::UpdateXNumbering( IdxDescCL* Idx, const MultiGridCL& mg, const VecDescCL& lset, const BndDataCL<>& lsetbnd, bool NumberingChanged)
+IdxT ExtIdxDescCL::UpdateXNumbering( IdxDescCL* Idx, const MultiGridCL& mg, const VecDescCL& lset, const BndDataCL<>& lsetbnd, bool NumberingChanged,
+    const InterfaceBandCL* band)
 {
     const Uint sysnum= Idx->GetIdx(),
         level= Idx->TriangLevel(),
@@ -492,8 +495,13 @@ IdxT ExtIdxDescCL::UpdateXNumbering( IdxDescCL* Idx, const MultiGridCL& mg, cons
     }
     LocalP2CL<> locPhi;
 
-    DROPS_FOR_TRIANG_CONST_TETRA( mg, level, it)
+    // Only cut tetras contribute; they are all in a valid band, which is traversed in the order of the triangulation.
+    const bool use_band= band != 0 && band->GetLevel() == level && band->IsValid( mg, lset);
+    const MultiGridCL::const_TriangTetraIteratorCL begin= mg.GetTriangTetraBegin( level);
+    const size_t num_tetras= use_band ? band->size() : mg.GetTriangTetraEnd( level) - begin;
+    for (size_t k= 0; k < num_tetras; ++k)
     {
+        const TetraCL* const it= use_band ? band->GetTetras()[k] : &begin[k];
         const double h3= it->GetVolume()*6,
             h= cbrt( h3), h5= h*h*h3, // h^5
             limit= h5*omit_bound_;
@@ -631,6 +639,7 @@ void permute_fe_basis (MultiGridCL& mg, IdxDescCL& idx, const PermutationT& p)
     const Uint lvl= idx.TriangLevel();
     const Uint num_components= idx.NumUnknownsVertex();
 
+    idx.InvalidateTetraDoFMap();
    if (idx.IsExtended())
         permute_fe_basis_extended_part( idx.GetXidx(), p, num_components);
 
@@ -680,6 +689,37 @@ void permute_fe_basis (MultiGridCL& mg, IdxDescCL& idx, const PermutationT& p)
     }
 }
 
+const Uint TetraDoFMapCL::NoSys_= static_cast<Uint>( -1);
+
+TetraDoFMapCL::~TetraDoFMapCL ()
+{
+    if (sys_ != NoSys_)
+        UnknownTableCL::ReleaseSystem( sys_);
+}
+
+void TetraDoFMapCL::clear ()
+{
+    NumDoF_= 0;
+    bnd_= 0;
+    version_= 0;
+    std::vector<const TetraCL*>().swap( tetra_);
+    std::vector<IdxT>().swap( num_);
+    std::vector<BndIdxT>().swap( bndnum_);
+    std::vector<BndCondT>().swap( bc_);
+}
+
+void TetraDoFMapCL::swap (TetraDoFMapCL& m)
+{
+    std::swap( sys_,     m.sys_);
+    std::swap( NumDoF_,  m.NumDoF_);
+    std::swap( bnd_,     m.bnd_);
+    std::swap( version_, m.version_);
+    tetra_.swap(  m.tetra_);
+    num_.swap(    m.num_);
+    bndnum_.swap( m.bndnum_);
+    bc_.swap(     m.bc_);
+}
+
 void
 LocalNumbP2CL::assign_indices_only (const TetraCL& s, const IdxDescCL& idx)
 {
@@ -120,6 +120,7 @@ template<>
   inline Uint FE_InfoCL::GetNumUnknownsOnSimplex<TetraCL>()  const { return NumUnknownsTetra(); }
 
 class IdxDescCL;     // fwd decl
+class InterfaceBandCL; // fwd decl
 template<class T>
 class VecDescBaseCL; // fwd decl
 
@@ -156,7 +157,10 @@ class ExtIdxDescCL
     /// Has to be called in two situations:
     /// - whenever level set function has changed to account for the moving interface (set \p NumberingChanged=false)
     /// - when numbering of index has changed, i.e. \p CreateNumbering was called before (set \p NumberingChanged=true)
-    IdxT UpdateXNumbering( IdxDescCL*, const MultiGridCL&, const VecDescCL&, const BndDataCL<>& lsetbnd, bool NumberingChanged= false );
+    ///
+    /// If a band for the level set function is given, only its tetras are visited.
+    IdxT UpdateXNumbering( IdxDescCL*, const MultiGridCL&, const VecDescCL&, const BndDataCL<>& lsetbnd, bool NumberingChanged= false,
+        const InterfaceBandCL* band= 0);
     /// \brief Delete extended numbering
     void DeleteXNumbering() { Xidx_.resize(0); Xidx_old_.resize(0); }
 
@@ -202,18 +206,94 @@ extern "C" inline int HandlerScatterUpdateXNumbC(OBJT objp, void* buf) { return
 class ExchangeCL;
 #endif
 
+/// \brief Element-to-DoF connectivity of an IdxDescCL on its triangulation.
+///
+/// For each tetra of the triangulation, the unknown-indices, boundary-segment numbers
+/// and boundary conditions of its 4 (P1-like FE) or 10 (P2-like FE) DoF-positions are
+/// stored contiguously in the layout of LocalNumbP1CL and LocalNumbP2CL. The row of a
+/// tetra is kept in a system of the UnknownTableCL, which the map acquires for itself
+/// on the first build; the unknown-indices of the IdxDescCL are not touched. FE-types
+/// with DoFs on faces or tetras have no map.
+///
+/// The map is built by IdxDescCL::BuildTetraDoFMap for one BndDataCL-like object and is
+/// invalidated, whenever the numbering changes. LocalNumbP1CL::assign and
+/// LocalNumbP2CL::assign copy from it, if it was built for their boundary data.
+class TetraDoFMapCL
+{
+  private:
+    static const Uint           NoSys_;   ///< sys_ of a map, which was never built
+
+    Uint                        sys_;     ///< own system of the map, in which the tetras store their row
+    Uint                        NumDoF_;  ///< number of DoF-positions per tetra; 0 for an invalid map
+    const void*                 bnd_;     ///< address of the boundary data the map was built for
+    size_t                      version_; ///< version of the multigrid the map was built on
+    std::vector<const TetraCL*> tetra_;   ///< tetra of each row
+    std::vector<IdxT>           num_;     ///< unknown-indices, NumDoF_ per row
+    std::vector<BndIdxT>        bndnum_;  ///< boundary-segment numbers, NumDoF_ per row
+    std::vector<BndCondT>       bc_;      ///< boundary conditions, NumDoF_ per row
+
+    TetraDoFMapCL (const TetraDoFMapCL&);            // not implemented
+    TetraDoFMapCL& operator= (const TetraDoFMapCL&); // not implemented
+
+  public:
+    TetraDoFMapCL () : sys_( NoSys_), NumDoF_( 0), bnd_( 0), version_( 0) {}
+    ~TetraDoFMapCL ();
+
+    /// \brief Set up the map for the triangulation of idx; the tetras obtain their row-number in the system of the map.
+    template <class BndDataT>
+      void build (const MultiGridCL& mg, const IdxDescCL& idx, const BndDataT& bnd);
+    /// \brief Invalidate the map and free its arrays. The system is kept for the next build; stale rows on the tetras are rejected by GetRow.
+    void clear ();
+    void swap (TetraDoFMapCL& m);
+
+    /// \brief True, iff the map was built for the boundary data at address bnd.
+    bool IsValid (const void* bnd) const { return NumDoF_ != 0 && bnd == bnd_; }
+    /// \brief True, iff the map was built for the boundary data at address bnd on the given version of the multigrid.
+    bool IsValid (const void* bnd, size_t version) const { return IsValid( bnd) && version == version_; }
+
+    Uint   NumDoF ()   const { return NumDoF_; }
+    size_t NumTetra () const { return tetra_.size(); }
+    const TetraCL& GetTetra (size_t row) const { return *tetra_[row]; }
+    /// \brief Row of tetra s; NoIdx, if s is not in the map.
+    IdxT GetRow (const TetraCL& s) const {
+        if (sys_ == NoSys_ || !s.Unknowns.Exist( sys_))
+            return NoIdx;
+        const IdxT row= s.Unknowns( sys_);
+        return row < tetra_.size() && tetra_[row] == &s ? row : NoIdx;
+    }
+
+    /// \name Contiguous data of a row
+    /// \{
+    const IdxT*     num    (size_t row) const { return &num_[NumDoF_*row]; }
+    const BndIdxT*  bndnum (size_t row) const { return &bndnum_[NumDoF_*row]; }
+    const BndCondT* bc     (size_t row) const { return &bc_[NumDoF_*row]; }
+    /// \}
+
+    /// \brief Copy the first n DoF-positions of a row to the arrays of a LocalNumbP1CL/LocalNumbP2CL.
+    void copy (size_t row, Uint n, IdxT* num, BndIdxT* bndnum, BndCondT* bc) const {
+        std::copy( num_.begin()    + NumDoF_*row, num_.begin()    + NumDoF_*row + n, num);
+        std::copy( bndnum_.begin() + NumDoF_*row, bndnum_.begin() + NumDoF_*row + n, bndnum);
+        std::copy( bc_.begin()     + NumDoF_*row, bc_.begin()     + NumDoF_*row + n, bc);
+    }
+
+    /// \brief Memory used by the map in bytes.
+    size_t GetMemory () const {
+        return tetra_.capacity()*sizeof( const TetraCL*) + num_.capacity()*sizeof( IdxT)
+            + bndnum_.capacity()*sizeof( BndIdxT) + bc_.capacity()*sizeof( BndCondT);
+    }
+};
+
 /// \brief Mapping from the simplices in a triangulation to the components
 ///     of algebraic data-structures.
 ///
 /// Internally, each object of type IdxDescCL has a unique index that is
 /// used to access the unknown-indices that are stored in a helper class
-/// (UnknownIdxCL and UnknownHandleCL) for each simplex. The unknown-indices
+/// (UnknownTableCL and UnknownHandleCL) for each simplex. The unknown-indices
 /// are allocated and numbered by using CreateNumbering.
 class IdxDescCL: public FE_InfoCL
 {
   private:
     static const Uint        InvalidIdx;   ///< Constant representing an invalid index.
-    static std::vector<bool> IdxFree;      ///< Cache for unused indices; reduces memory-usage.
 
     Uint                     Idx_;         ///< The unique index.
     Uint                     TriangLevel_; ///< Triangulation of the index.
@@ -221,12 +301,14 @@ class IdxDescCL: public FE_InfoCL
     BndCondCL                Bnd_;         ///< boundary conditions
     match_fun                match_;       ///< matching function for periodic boundaries
     ExtIdxDescCL             extIdx_;      ///< extended index for XFEM
+    mutable TetraDoFMapCL    dofmap_;      ///< cached element-to-DoF connectivity, see BuildTetraDoFMap
+    mutable size_t           numbering_version_; ///< see GetNumberingVersion
 #ifdef _PAR
     ExchangeCL*              ex_;          ///< exchanging numerical data
 #endif
 
-    /// \brief Returns the lowest index that was not used and reserves it.
-    Uint GetFreeIdx();
+    /// \brief Returns a new, globally unique version number for a numbering.
+    static size_t NewNumberingVersion();
     /// \brief Number unknowns for standard FE.
     void CreateNumbStdFE( Uint level, MultiGridCL& mg);
     /// \brief Number unknowns on the vertices surrounding an interface.
@@ -287,7 +369,8 @@ class IdxDescCL: public FE_InfoCL
     { Bnd_= baseIdx.Bnd_; match_= baseIdx.match_; CreateNumbering( level, mg, lsetp, lsetbnd); }
     /// \brief Update numbering of extended DoFs.
     /// Has to be called whenever level set function has changed to account for the moving interface.
-    void UpdateXNumbering( MultiGridCL& mg, const VecDescCL& lset, const BndDataCL<>& lsetbnd);
+    /// If a band for the level set function is given, only its tetras are visited.
+    void UpdateXNumbering( MultiGridCL& mg, const VecDescCL& lset, const BndDataCL<>& lsetbnd, const InterfaceBandCL* band= 0);
     /// \brief Returns true, if XFEM is used and standard DoF \p dof is extended.
     bool IsExtended( IdxT dof) const
     { return IsExtended() ? extIdx_[dof] != NoIdx : false; }
@@ -295,6 +378,24 @@ class IdxDescCL: public FE_InfoCL
     void DeleteNumbering( MultiGridCL& mg);
     /// \}
 
+    /// \name Element-to-DoF connectivity
+    /// \{
+    /// \brief Build the connectivity of the triangulation for the BndDataCL-like object bnd.
+    /// Nothing is done, if the map is valid for bnd and the current version of mg. As the
+    /// map is only read afterwards, this must be called before a (parallel) assembly.
+    template <class BndDataT>
+      void BuildTetraDoFMap (const MultiGridCL& mg, const BndDataT& bnd) const {
+          if (!dofmap_.IsValid( &bnd, mg.GetVersion()))
+              dofmap_.build( mg, *this, bnd);
+      }
+    /// \brief The cached connectivity; it is used for bnd, iff GetTetraDoFMap().IsValid( &bnd).
+    const TetraDoFMapCL& GetTetraDoFMap () const { return dofmap_; }
+    /// \brief Invalidate the connectivity; called by all routines, which change the numbering.
+    void InvalidateTetraDoFMap () const { dofmap_.clear(); numbering_version_= NewNumberingVersion(); }
+    /// \brief Version of the numbering; it changes with InvalidateTetraDoFMap and is unique among all indices. Data computed for a numbering can be reused, if the version is the same.
+    size_t GetNumberingVersion () const { return numbering_version_; }
+    /// \}
+
 #ifdef _PAR
     /// \brief Get a reference on the ExchangeCL
     ExchangeCL& GetEx() { return *ex_; }
@@ -385,10 +486,10 @@ class MLIdxDescCL : public MLDataCL<IdxDescCL>
     }
     /// \brief Update numbering of extended DoFs on all levels.
     /// Has to be called whenever level set function has changed to account for the moving interface.
-    void UpdateXNumbering( MultiGridCL& mg, const VecDescCL& lset, const BndDataCL<>& lsetbnd)
+    void UpdateXNumbering( MultiGridCL& mg, const VecDescCL& lset, const BndDataCL<>& lsetbnd, const InterfaceBandCL* band= 0)
     {
         for (MLIdxDescCL::iterator it = this->begin(); it != this->end(); ++it)
-            it->UpdateXNumbering( mg, lset, lsetbnd);
+            it->UpdateXNumbering( mg, lset, lsetbnd, band);
     }
     /// \brief Mark unknown-indices as invalid on all levels.
     void DeleteNumbering( MultiGridCL& mg)
@@ -672,6 +773,15 @@ template<class BndDataT>
     BndIdxT bidx= 0;
     const Uint sys= idx.GetIdx();
 
+    const TetraDoFMapCL& map= idx.GetTetraDoFMap();
+    if (map.IsValid( &bnd)) {
+        const IdxT row= map.GetRow( s);
+        if (row != NoIdx) {
+            map.copy( row, NumVertsC, num, bndnum, bc);
+            return;
+        }
+    }
+
     for (Uint i= 0; i < NumVertsC; ++i)
         if (NoBC == (bc[i]= bnd.GetBC( *s.GetVertex( i), bidx))) {
             bndnum[i]= NoBndC;
@@ -704,6 +814,15 @@ template<class BndDataT>
     BndIdxT bidx= 0;
     const Uint sys= idx.GetIdx();
 
+    const TetraDoFMapCL& map= idx.GetTetraDoFMap();
+    if (map.IsValid( &bnd) && map.NumDoF() == NumVertsC + NumEdgesC) {
+        const IdxT row= map.GetRow( s);
+        if (row != NoIdx) {
+            map.copy( row, NumVertsC + NumEdgesC, num, bndnum, bc);
+            return;
+        }
+    }
+
     for (Uint i= 0; i < NumVertsC; ++i)
         if (NoBC == (bc[i]= bnd.GetBC( *s.GetVertex( i), bidx))) {
             bndnum[i]= NoBndC;
@@ -726,6 +845,50 @@ template<class BndDataT>
         }
 }
 
+template <class BndDataT>
+  void
+  TetraDoFMapCL::build (const MultiGridCL& mg, const IdxDescCL& idx, const BndDataT& bnd)
+/// The rows are numbered in the order of the triangulation. FE-types without vertex-DoFs
+/// or with DoFs on faces or tetras yield an invalid map.
+{
+    clear();
+    if (idx.NumUnknownsVertex() == 0 || idx.NumUnknownsFace() != 0 || idx.NumUnknownsTetra() != 0)
+        return;
+
+    if (sys_ == NoSys_)
+        sys_= UnknownTableCL::AcquireSystem();
+    const Uint numdof= idx.NumUnknownsEdge() == 0 ? NumVertsC : NumVertsC + NumEdgesC;
+    DROPS_FOR_TRIANG_CONST_TETRA( mg, idx.TriangLevel(), it)
+        tetra_.push_back( &*it);
+    num_.resize(    numdof*tetra_.size());
+    bndnum_.resize( numdof*tetra_.size());
+    bc_.resize(     numdof*tetra_.size());
+
+    LocalNumbP1CL n1;
+    LocalNumbP2CL n2;
+    for (size_t row= 0; row < tetra_.size(); ++row) {
+        const TetraCL& t= *tetra_[row];
+        if (numdof == NumVertsC) {
+            n1.assign( t, idx, bnd);
+            std::copy( n1.num,    n1.num    + numdof, num_.begin()    + numdof*row);
+            std::copy( n1.bndnum, n1.bndnum + numdof, bndnum_.begin() + numdof*row);
+            std::copy( n1.bc,     n1.bc     + numdof, bc_.begin()     + numdof*row);
+        }
+        else {
+            n2.assign( t, idx, bnd);
+            std::copy( n2.num,    n2.num    + numdof, num_.begin()    + numdof*row);
+            std::copy( n2.bndnum, n2.bndnum + numdof, bndnum_.begin() + numdof*row);
+            std::copy( n2.bc,     n2.bc     + numdof, bc_.begin()     + numdof*row);
+        }
+        TetraCL& tt= const_cast<TetraCL&>( t);
+        tt.Unknowns.Prepare( sys_);
+        tt.Unknowns( sys_)= row;
+    }
+    NumDoF_=  numdof;
+    bnd_=     &bnd;
+    version_= mg.GetVersion();
+}
+
 template<class T>
 void VecDescBaseCL<T>::SetIdx(IdxDescCL* idx)
 /// Prepares the vector for usage with a new index-object for
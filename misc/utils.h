@@ -378,12 +378,20 @@ private:
 
     Ulint _Identity;
 
+    /// The counter is incremented atomically, as MultiGridCL::RefineGrid creates simplices concurrently.
+    static Ulint NextIdent () {
+        Ulint id;
+#       pragma omp atomic capture
+        id= _Counter++;
+        return id;
+    }
+
 public:
-    IdCL () : _Identity(_Counter++) {}
+    IdCL () : _Identity( NextIdent()) {}
     IdCL (Ulint Identity) : _Identity(Identity) {}
     // Default Copy-ctor
 
-    Ulint GetCounter () const { return _Counter; }
+    static Ulint GetCounter () { return _Counter; }
     Ulint GetIdent   () const { return _Identity; }
 
     /// Used by MakeConsistentNumbering().
@@ -189,6 +189,7 @@ class NonlConvSystemAccumulator_P2CL : public TetraAccumulatorCL
     VecDescCL* cplN;
 
     SparseMatBuilderCL<double, SDiagMatrixCL<3> >* mN_;
+    const TetraGeometryCL* geom_; ///< cached transformations of the tetras
 
     LocalNonlConvSystemOnePhase_P2CL local_onephase; ///< used on tetras in a single phase
     LocalNonlConvSystemTwoPhase_P2CL local_twophase; ///< used on intersected tetras
@@ -204,8 +205,13 @@ class NonlConvSystemAccumulator_P2CL : public TetraAccumulatorCL
 
     Point3DCL dirichlet_val[10]; ///< Used to transfer boundary-values from local_setup() update_global_system().
 
+    P2BatchDiscCL::LaneT batch_T[9], batch_absdet, batch_u[10][3]; ///< transformations and velocities of the one-phase tetras of a batch
+    P2BatchDiscCL::LaneT batch_C[10][10]; ///< local matrices of the one-phase tetras of a batch
+
     ///\brief Computes the mapping from local to global data "n", the local matrices in loc and, if required, the Dirichlet-values needed to eliminate the boundary-dof from the global system.
     void local_setup (const TetraCL& tet);
+    ///\brief Computes the Dirichlet-values, if required; used by local_setup and visit_batch.
+    void local_setup_dirichlet (const TetraCL& tet);
     ///\brief Update the global system.
     void update_global_system ();
 
@@ -220,6 +226,9 @@ class NonlConvSystemAccumulator_P2CL : public TetraAccumulatorCL
     void finalize_accumulation();
 
     void visit (const TetraCL& sit);
+    ///\brief Computes the local matrices of the one-phase tetras of a batch at once; the intersected tetras are handled as in visit.
+    void visit_batch (const TetraCL* const* tet, Uint num);
+    bool supports_batch () const { return true; }
 
     TetraAccumulatorCL* clone (int /*tid*/) { return new NonlConvSystemAccumulator_P2CL ( *this); };
 };
@@ -229,7 +238,7 @@ NonlConvSystemAccumulator_P2CL::NonlConvSystemAccumulator_P2CL (const TwoPhaseFl
                                                                 MatrixCL& N_, VecDescCL* cplN_, double t_, bool smoothed_)
     : smoothed(smoothed_), Coeff( Coeff_), BndData( BndData_), MG(MG_),
       vel(vel_), lset( lset_arg), t( t_),
-      RowIdx( RowIdx_), N( N_), cplN( cplN_), 
+      RowIdx( RowIdx_), N( N_), cplN( cplN_), geom_( 0),
       local_twophase( Coeff.rho( 1.0), Coeff.rho( -1.0)),
       local_smoothed_twophase( Coeff.rho)
 {}
@@ -241,6 +250,7 @@ void NonlConvSystemAccumulator_P2CL::begin_accumulation ()
         std::cout << " [smoothed]";
     const size_t num_unks_vel= RowIdx.NumUnknowns();
     mN_= new SparseMatBuilderCL<double, SDiagMatrixCL<3> >( &N, num_unks_vel, num_unks_vel);
+    geom_= &MG.GetTetraGeometry( RowIdx.TriangLevel());
     if (cplN != 0) {
         cplN->Clear( t);
     }
@@ -262,9 +272,60 @@ void NonlConvSystemAccumulator_P2CL::visit (const TetraCL& tet)
     update_global_system();
 }
 
+void NonlConvSystemAccumulator_P2CL::visit_batch (const TetraCL* const* tet, Uint num)
+{
+    IdxT lane[P2BatchDiscCL::BatchC]; // lane of the one-phase tetras; NoIdx for intersected tetras
+    double rho[P2BatchDiscCL::BatchC];
+    for (Uint first= 0; first < num; first+= P2BatchDiscCL::BatchC) {
+        const Uint size= std::min<Uint>( num - first, P2BatchDiscCL::BatchC);
+        Uint lanes= 0;
+        for (Uint k= 0; k < size; ++k) {
+            const TetraCL& tk= *tet[first + k];
+            lane[k]= NoIdx;
+            ls_loc.assign( tk, lset.Phi, lset.GetBndData());
+            if (!equal_signs( ls_loc))
+                continue;
+            geom_->GetTrafoTr( T, det, tk);
+            vel_loc.assign( tk, vel, BndData.Vel);
+            for (Uint m= 0; m < 9; ++m)
+                batch_T[m][lanes]= T[m];
+            batch_absdet[lanes]= std::fabs( det);
+            for (Uint d= 0; d < 10; ++d)
+                for (Uint c= 0; c < 3; ++c)
+                    batch_u[d][c][lanes]= vel_loc[d][c];
+            rho[lanes]= local_twophase.rho( sign( ls_loc[0]));
+            lane[k]= lanes++;
+        }
+        if (lanes > 0) {
+            for (Uint l= lanes; l < P2BatchDiscCL::BatchC; ++l) { // padding
+                for (Uint m= 0; m < 9; ++m)
+                    batch_T[m][l]= 0.;
+                batch_absdet[l]= 0.;
+                for (Uint d= 0; d < 10; ++d)
+                    for (Uint c= 0; c < 3; ++c)
+                        batch_u[d][c][l]= 0.;
+            }
+            P2BatchDiscCL::GetConvection( batch_T, batch_absdet, batch_u, batch_C);
+        }
+        for (Uint k= 0; k < size; ++k) {
+            const TetraCL& tk= *tet[first + k];
+            if (lane[k] == NoIdx)
+                local_setup( tk);
+            else {
+                n.assign( tk, RowIdx, BndData.Vel);
+                for (Uint i= 0; i < 10; ++i)
+                    for (Uint j= 0; j < 10; ++j)
+                        loc.C[i][j]= rho[lane[k]]*batch_C[i][j][lane[k]];
+                local_setup_dirichlet( tk);
+            }
+            update_global_system();
+        }
+    }
+}
+
 void NonlConvSystemAccumulator_P2CL::local_setup (const TetraCL& tet)
 {
-    GetTrafoTr( T, det, tet);
+    geom_->GetTrafoTr( T, det, tet);
     absdet= std::fabs( det);
 
     n.assign( tet, RowIdx, BndData.Vel);
@@ -285,7 +346,11 @@ void NonlConvSystemAccumulator_P2CL::local_setup (const TetraCL& tet)
             local_smoothed_twophase.setup( T, absdet, loc);
         }
     }
-    
+    local_setup_dirichlet( tet);
+}
+
+void NonlConvSystemAccumulator_P2CL::local_setup_dirichlet (const TetraCL& tet)
+{
     if (cplN != 0) {
         for (int i= 0; i < 10; ++i) {
             if (!n.WithUnknowns( i)) {
@@ -320,6 +385,7 @@ void InstatNavierStokes2PhaseP2P1CL::SetupNonlinear_P2(MatrixCL& N, const VelVec
 {
     // TimerCL time;
     // time.Start();
+    RowIdx.BuildTetraDoFMap( MG_, BndData_.Vel);
     NonlConvSystemAccumulator_P2CL accu( Coeff_, MG_, BndData_, *vel, lset, RowIdx, N, cplN, t);
     TetraAccumulatorTupleCL accus;
     accus.push_back( &accu);
@@ -370,4 +436,11 @@ PermutationT InstatNavierStokes2PhaseP2P1CL::downwind_numbering (const LevelsetP
     return p;
 }
 
+PermutationT InstatNavierStokes2PhaseP2P1CL::locality_numbering (LocalityOrderingT ordering)
+{
+    const PermutationT p= DROPS::locality_numbering( GetMG(), vel_idx.GetFinest(), ordering);
+    permute_Vector( v.Data, p, /*blocksize*/ 3);
+    return p;
+}
+
 } // end of namespace DROPS
@@ -75,6 +75,8 @@ class InstatNavierStokes2PhaseP2P1CL : public InstatStokes2PhaseP2P1CL
 
     /// \brief Perform downwind numbering for the velocity FE-space. The permutation is returned.
     PermutationT downwind_numbering (const LevelsetP2CL& lset, IteratedDownwindCL dw);
+    /// \brief Renumber the velocity DoFs by a locality ordering, see DROPS::locality_numbering. The velocity is permuted; the permutation is returned.
+    PermutationT locality_numbering (LocalityOrderingT ordering);
 };
 
 } // end of namespace DROPS
@@ -63,4 +63,15 @@ void CheckMGData( const MLMatrixCL& A, const MLMatrixCL& P)
     }
 }
 
+void SetupGalerkinMGData( MLMatrixCL& A, const MLMatrixCL& P, bool reuse_pattern)
+{
+    Assert( A.size() == P.size(), "SetupGalerkinMGData: different number of levels", DebugNumericC);
+    MLMatrixCL::iterator fine= A.GetFinestIter(), coarse= fine;
+    MLMatrixCL::const_iterator fineP= P.GetFinestIter();
+    for (; fine != A.begin(); --fine, --fineP) {
+        --coarse;
+        galerkin_product( *fineP, *fine, *coarse, reuse_pattern);
+    }
+}
+
 } // end of namespace DROPS
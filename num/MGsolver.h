@@ -88,6 +88,13 @@ class MGSolverCL : public SolverBaseCL
     const bool        residerr_;         ///< controls the error measuring: false : two-norm of dx, true: two-norm of residual
     Uint              smoothSteps_;      ///< number of smoothing steps
     int               usedLevels_;       ///< number of used levels (-1 = all)
+    bool              galerkin_;         ///< true: the coarse matrices are computed as Galerkin products P^T A P from the finest matrix
+    MLMatrixCL        galerkinA_;        ///< finest matrix and Galerkin coarse matrices for galerkin_ == true
+    const MatrixCL*   Afinest_;          ///< finest matrix and versions, from which galerkinA_ was computed
+    size_t            Aversion_, Pversion_;
+
+    /// \brief Returns A, or the finest matrix of A with the Galerkin coarse matrices, if galerkin_ is set.
+    const MLMatrixCL& GetMGData (const MLMatrixCL& A);
 
   public:
     /// constructor for MGSolverCL
@@ -101,15 +108,19 @@ class MGSolverCL : public SolverBaseCL
     MGSolverCL( const SmootherT& sm, DirectSolverT& ds, int maxiter,
                 double tol, const bool residerr= true, Uint smsteps= 1, int lvl= -1 )
         : SolverBaseCL(maxiter,tol), smoother_(sm), directSolver_(ds),
-          residerr_(residerr), smoothSteps_(smsteps), usedLevels_(lvl) {}
+          residerr_(residerr), smoothSteps_(smsteps), usedLevels_(lvl),
+          galerkin_( false), Afinest_( 0), Aversion_( 0), Pversion_( 0) {}
 
     ProlongationT* GetProlongation() { return &P; }
+    /// \brief Compute the coarse matrices as Galerkin products P^T A P from the finest matrix instead of using the assembled ones (default: false).
+    void SetGalerkin (bool galerkin= true) { galerkin_= galerkin; Afinest_= 0; }
+    bool UsesGalerkin () const { return galerkin_; }
     /// solve function: calls the MultiGrid-routine
     void Solve(const MLMatrixCL& A, VectorCL& x, const VectorCL& b)
     {
         _res=  _tol;
         _iter= _maxiter;
-        MG( A, P, smoother_, directSolver_, x, b, _iter, _res, residerr_, smoothSteps_, usedLevels_);
+        MG( galerkin_ ? GetMGData( A) : A, P, smoother_, directSolver_, x, b, _iter, _res, residerr_, smoothSteps_, usedLevels_);
     }
     void Solve(const MatrixCL&, VectorCL&, const VectorCL&)
     {
@@ -121,6 +132,10 @@ class MGSolverCL : public SolverBaseCL
 /// checks multigrid structure
 void CheckMGData( const MLMatrixCL& A, const MLMatrixCL& P);
 
+/// \brief Computes the coarse matrices algebraically as Galerkin products A_H= P^T A_h P, starting with the finest level of A.
+/** If reuse_pattern is true, the sparsity patterns of the coarse matrices from a previous call are reused. */
+void SetupGalerkinMGData( MLMatrixCL& A, const MLMatrixCL& P, bool reuse_pattern= false);
+
 /**
 \brief Multigrid method for saddle point problems, V-cycle, beginning from level 'fine'
 
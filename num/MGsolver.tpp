@@ -95,6 +95,26 @@ void MG(const MLMatrixCL& MGData, const ProlongationT& Prolong, const SmootherCL
     tol= resid;
 }
 
+template<class SmootherT, class DirectSolverT, class ProlongationT>
+const MLMatrixCL& MGSolverCL<SmootherT, DirectSolverT, ProlongationT>::GetMGData (const MLMatrixCL& A)
+{
+    const MatrixCL& fine= A.GetFinest();
+    if (Afinest_ == &fine && Aversion_ == fine.Version() && Pversion_ == P.GetFinest().Version()
+        && galerkinA_.size() == A.size())
+        return galerkinA_;
+
+    // The patterns of the coarse matrices only depend on the pattern of A and on P.
+    const bool reuse_pattern= Afinest_ == &fine && Pversion_ == P.GetFinest().Version() && galerkinA_.size() == A.size()
+        && galerkinA_.GetFinest().PatternVersion() == fine.PatternVersion();
+    galerkinA_.resize( A.size());
+    galerkinA_.GetFinest()= fine;
+    SetupGalerkinMGData( galerkinA_, P, reuse_pattern);
+    Afinest_=  &fine;
+    Aversion_= fine.Version();
+    Pversion_= P.GetFinest().Version();
+    return galerkinA_;
+}
+
 template<class StokesSmootherCL, class StokesDirectSolverCL, class ProlongItT1, class ProlongItT2>
 void StokesMGM( const MLMatrixCL::const_iterator& beginA,  const MLMatrixCL::const_iterator& fineA,
                 const MLMatrixCL::const_iterator& fineB,   const MLMatrixCL::const_iterator& fineBT, 
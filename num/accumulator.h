@@ -50,6 +50,17 @@ class AccumulatorCL
     /// \brief Called exactly once for each element of the visited sequence.
     virtual void visit (const VisitedT& t)= 0;
 
+    /// \brief Maximal number of objects in a batch.
+    enum { BatchSizeC= 8 };
+    /// \brief Called instead of visit for the n <= BatchSizeC objects *t[0], ..., *t[n-1], if all accumulators of the AccumulatorTupleCL support batches.
+    /// The default calls visit for each object. Overriding this allows for computing the local data of several objects at once, e.g. with P2BatchDiscCL.
+    virtual void visit_batch (const VisitedT* const* t, Uint n) {
+        for (Uint i= 0; i < n; ++i)
+            visit( *t[i]);
+    }
+    /// \brief True, if visit_batch is overridden. The result must not depend on the other accumulators being called for each object in between.
+    virtual bool supports_batch () const { return false; }
+
     /// \brief Returns a pointer to a copy of the actual instantiation of this class
     /// \param clone_id the thread-id, in which the clone will run. Useful to locate cloned helper objects.
     virtual AccumulatorCL* clone (int clone_id)= 0;
@@ -64,10 +75,11 @@ typedef AccumulatorCL<TetraCL> TetraAccumulatorCL;
 /// \brief A tuple of accumulators plus the iteration logic.
 ///
 /// The accumulators are stored via pointers to AccumulatorCL.
-/// There are two ways to accumulate: First, a pair of external iterators, defining the sequence of VisitedT-objects to be visited, can be provided. Second, a ColorClassesCL-object can be used. This results in OpenMP-parallel accumulation on each color-class. The accumulators are cloned after begin_accumulation, visit is called OpenMP-parallel, and the clones are destroyed. finalize_accumulation is called only for the original accumulators.
+/// There are three ways to accumulate: First, a pair of external iterators, defining the sequence of VisitedT-objects to be visited, can be provided. Second, a ColorClassesCL-object can be used. This results in OpenMP-parallel accumulation on each color-class. Third, an OwnerPartitionCL-object can be used: Each thread visits the interior tetras of its subdomains without synchronization; afterwards, the interface tetras are visited OpenMP-parallel on each of their color-classes. In the parallel cases, the accumulators are cloned after begin_accumulation, visit is called OpenMP-parallel, and the clones are destroyed. finalize_accumulation is called only for the original accumulators.
 /// It is valid to accumulate an empty AccumulatorTupleCL-object and to accumulate over empty sets of VisitedT.
 ///
 /// For each visited  object t, the accumulators are called in the sequence of their registration.
+/// If all accumulators support batches, the objects are passed in batches of up to AccumulatorCL::BatchSizeC objects to visit_batch instead; the accumulators are called in the sequence of their registration for each batch.
 ///
 /// Accumulators, which are registered with push_back_acquire, are deleted in ~AccumulatorTupleCL.
 template <class VisitedT>
@@ -88,6 +100,11 @@ class AccumulatorTupleCL
     /// \brief Deletes the clones defined from clone_accus; obviously, accus_ is not deleted
     void delete_clones(std::vector<ContainerT>& clones);
 
+    /// \brief True, if all accumulators support batches.
+    bool batched () const;
+    /// \brief Calls the accumulators c for the objects *t[0], ..., *t[n-1]: in batches, if in_batches is true, otherwise for each object.
+    static void visit_sequence (const ContainerT& c, const VisitedT* const* t, size_t n, bool in_batches);
+
   public:
     /// \brief Deletes the objects in deletion_cache_.
     ~AccumulatorTupleCL ();
@@ -101,7 +118,12 @@ class AccumulatorTupleCL
     template <class ExternalIteratorCL>
     void operator() (ExternalIteratorCL begin, ExternalIteratorCL end);
     /// \brief Calls the accumulators for each object by using a ColorClassesCL.
-    void operator() (const ColorClassesCL& colors);
+    void operator() (const ColorClassesCL& colors) { visit_color_classes( colors.begin(), colors.end()); }
+    /// \brief Calls the accumulators for each object in the sequence of color classes [begin, end); the objects of one class are visited in parallel.
+    template <class ColorIteratorT>
+    void visit_color_classes (ColorIteratorT begin, ColorIteratorT end);
+    /// \brief Calls the accumulators for each object by using an OwnerPartitionCL.
+    void operator() (const OwnerPartitionCL& partition);
 };
 
 template <class VisitedT>
@@ -134,6 +156,29 @@ void AccumulatorTupleCL<VisitedT>::delete_clones(std::vector<ContainerT>& clones
             delete clones[i][j];
 }
 
+template<class VisitedT>
+bool AccumulatorTupleCL<VisitedT>::batched () const
+{
+    for (size_t i= 0; i < accus_.size(); ++i)
+        if (!accus_[i]->supports_batch())
+            return false;
+    return !accus_.empty();
+}
+
+template<class VisitedT>
+void AccumulatorTupleCL<VisitedT>::visit_sequence (const ContainerT& c, const VisitedT* const* t, size_t n, bool in_batches)
+{
+    if (in_batches)
+        for (size_t b= 0; b < n; b+= AccumulatorCL<VisitedT>::BatchSizeC) {
+            const Uint m= std::min<size_t>( n - b, AccumulatorCL<VisitedT>::BatchSizeC);
+            for (size_t i= 0; i < c.size(); ++i)
+                c[i]->visit_batch( t + b, m);
+        }
+    else
+        for (size_t j= 0; j < n; ++j)
+            std::for_each( c.begin(), c.end(), std::bind2nd( std::mem_fun( &AccumulatorCL<VisitedT>::visit), *t[j]));
+}
+
 template<class VisitedT>
 AccumulatorTupleCL<VisitedT>::~AccumulatorTupleCL ()
 {
@@ -146,19 +191,37 @@ template <class ExternalIteratorCL>
 void AccumulatorTupleCL<VisitedT>::operator() (ExternalIteratorCL begin, ExternalIteratorCL end)
 {
     begin_iteration();
-    for ( ; begin != end; ++begin)
-        std::for_each( accus_.begin(), accus_.end(), std::bind2nd( std::mem_fun( &AccumulatorCL<VisitedT>::visit), *begin));
+    if (batched()) {
+        const VisitedT* batch[AccumulatorCL<VisitedT>::BatchSizeC];
+        Uint n= 0;
+        for ( ; begin != end; ++begin) {
+            batch[n++]= &*begin;
+            if (n == AccumulatorCL<VisitedT>::BatchSizeC) {
+                visit_sequence( accus_, batch, n, true);
+                n= 0;
+            }
+        }
+        visit_sequence( accus_, batch, n, true);
+    }
+    else
+        for ( ; begin != end; ++begin)
+            std::for_each( accus_.begin(), accus_.end(), std::bind2nd( std::mem_fun( &AccumulatorCL<VisitedT>::visit), *begin));
     finalize_iteration();
 }
 
 template<class VisitedT>
-void AccumulatorTupleCL<VisitedT>::operator() (const ColorClassesCL& colors)
+template <class ColorIteratorT>
+void AccumulatorTupleCL<VisitedT>::visit_color_classes (ColorIteratorT begin, ColorIteratorT end)
 {
     begin_iteration();
 
     std::vector<ContainerT> clones( omp_get_max_threads());
     clone_accus( clones);
-    for (ColorClassesCL::const_iterator cit= colors.begin(); cit != colors.end() ;++cit) {
+    const bool batch= batched();
+    const size_t bs= batch ? AccumulatorCL<VisitedT>::BatchSizeC : 1;
+    for (ColorIteratorT cit= begin; cit != end; ++cit) {
+        if (cit->empty())
+            continue;
 #       pragma omp parallel
         {
             const int t_id= omp_get_thread_num();
@@ -169,8 +232,45 @@ void AccumulatorTupleCL<VisitedT>::operator() (const ColorClassesCL& colors)
             int j;
 #endif
 #           pragma omp for schedule(dynamic)
-            for (j= 0; j < cc.size(); ++j)
-                std::for_each( clones[t_id].begin(), clones[t_id].end(), std::bind2nd( std::mem_fun( &AccumulatorCL<VisitedT>::visit), *cc[j]));
+            for (j= 0; j < cc.size(); j+= bs)
+                visit_sequence( clones[t_id], &cc[j], std::min( bs, cc.size() - j), batch);
+        }
+    }
+    delete_clones(clones);
+
+    finalize_iteration();
+}
+
+template<class VisitedT>
+void AccumulatorTupleCL<VisitedT>::operator() (const OwnerPartitionCL& partition)
+{
+    begin_iteration();
+
+    std::vector<ContainerT> clones( omp_get_max_threads());
+    clone_accus( clones);
+    const bool batch= batched();
+    const size_t bs= batch ? AccumulatorCL<VisitedT>::BatchSizeC : 1;
+    const ColorClassesCL& colors= partition.interface_colors();
+#   pragma omp parallel
+    {
+        const int t_id= omp_get_thread_num();
+#ifndef DROPS_WIN
+        size_t p, j;
+#else
+        int p, j;
+#endif
+        // The interior tetras of different subdomains do not share a vertex.
+#       pragma omp for schedule(dynamic, 1)
+        for (p= 0; p < partition.num_parts(); ++p) {
+            const OwnerPartitionCL::TetraVecT& part= *(partition.begin() + p);
+            if (!part.empty())
+                visit_sequence( clones[t_id], &part[0], part.size(), batch);
+        }
+        for (ColorClassesCL::const_iterator cit= colors.begin(); cit != colors.end(); ++cit) {
+            const ColorClassesCL::ColorClassT& cc= *cit;
+#           pragma omp for schedule(dynamic)
+            for (j= 0; j < cc.size(); j+= bs)
+                visit_sequence( clones[t_id], &cc[j], std::min( bs, cc.size() - j), batch);
         }
     }
     delete_clones(clones);
@@ -187,36 +287,133 @@ namespace AccumulatorImplNS {
 template <class AccuContainerT>
 struct do_accumulateCL
 {
-    static void accumulate (AccuContainerT& accus, const MultiGridCL& mg, int lastlvl, match_fun match, const BndCondCL& Bnd)
+    static void accumulate (AccuContainerT& accus, const MultiGridCL& mg, int lastlvl, match_fun match, const BndCondCL& Bnd,
+        AccumulationSchedulingT sched)
     {
         for (typename AccuContainerT::iterator it= accus.begin(), end= accus.end(); it != end; ++it)
             do_accumulateCL<typename AccuContainerT::value_type>::accumulate(
-                *it, mg, lastlvl++ - accus.size() + 1, match, Bnd);
+                *it, mg, lastlvl++ - accus.size() + 1, match, Bnd, sched);
     }
 };
 
 template <class VisitedT>
 struct do_accumulateCL<AccumulatorTupleCL<VisitedT> >
 {
-    static void accumulate (AccumulatorTupleCL<VisitedT>& accu, const MultiGridCL& mg, int lvl, match_fun match, const BndCondCL& Bnd)
+    static void accumulate (AccumulatorTupleCL<VisitedT>& accu, const MultiGridCL& mg, int lvl, match_fun match, const BndCondCL& Bnd,
+        AccumulationSchedulingT sched)
     {
-        if (omp_get_max_threads() > 1)
-            accu( mg.GetColorClasses( lvl, match, Bnd));
-        else
+        if (omp_get_max_threads() == 1)
             accu( mg.GetTriangTetraBegin( lvl), mg.GetTriangTetraEnd( lvl));
+        else if (sched == OwnerComputesSchedulingC)
+            accu( mg.GetOwnerPartition( lvl, omp_get_max_threads(), match, Bnd));
+        else
+            accu( mg.GetColorClasses( lvl, match, Bnd));
     }
 };
 
+inline const TetraCL& as_tetra (const TetraCL& t) { return t; }
+inline const TetraCL& as_tetra (const TetraCL* t) { return *t; }
+
+/// \brief Implementation of reduce_tetras for the n tetras begin[0], ..., begin[n-1]; the elements are tetras or pointers to tetras.
+template <class RandomAccessIteratorT, class ReductionT>
+  void
+  reduce (RandomAccessIteratorT begin, size_t n, ReductionT& r)
+{
+    if (omp_get_max_threads() == 1) {
+        for (size_t i= 0; i < n; ++i)
+            r( as_tetra( begin[i]));
+        return;
+    }
+
+    std::vector<ReductionT> partial( omp_get_max_threads() - 1, r); // thread 0 uses r
+#   pragma omp parallel
+    {
+        const size_t t= omp_get_thread_num(),
+                     num= omp_get_num_threads();
+        ReductionT& rt= t == 0 ? r : partial[t - 1];
+        for (size_t i= n*t/num, end= n*(t + 1)/num; i < end; ++i)
+            rt( as_tetra( begin[i]));
+    }
+    for (size_t t= 0; t < partial.size(); ++t)
+        r.join( partial[t]);
+}
+
 } // end of namespace DROPS::AccumulatorImplNS
 
 /// \brief Perform the accumulation for one or several AccumulatorTupleCL in an OpenMP-aware manner.
 /// OpenMP is only used if omp_get_max_threads() > 1.
 /// If accus is a container of AccumulatorTupleCL-objects, lvl is interpreted as last (finest) level to be used.
+/// sched selects the scheduling of the parallel accumulation.
+template <class AccumulatorTupleT>
+  inline void
+  accumulate (AccumulatorTupleT& accus, const MultiGridCL& mg, int lvl, match_fun match, const BndCondCL& Bnd,
+      AccumulationSchedulingT sched)
+{
+    AccumulatorImplNS::do_accumulateCL<AccumulatorTupleT>::accumulate( accus, mg, lvl, match, Bnd, sched);
+}
+
+/// \brief As above with the scheduling set by MultiGridCL::SetAccumulationScheduling.
 template <class AccumulatorTupleT>
   inline void
   accumulate (AccumulatorTupleT& accus, const MultiGridCL& mg, int lvl, match_fun match, const BndCondCL& Bnd)
 {
-    AccumulatorImplNS::do_accumulateCL<AccumulatorTupleT>::accumulate( accus, mg, lvl, match, Bnd);
+    AccumulatorImplNS::do_accumulateCL<AccumulatorTupleT>::accumulate( accus, mg, lvl, match, Bnd, mg.GetAccumulationScheduling());
+}
+
+/// \brief OpenMP-parallel reduction over the tetras of the triangulation of level lvl.
+///
+/// ReductionT must be copy-constructible and provide
+/// - void operator() (const TetraCL& t): adds the contribution of t,
+/// - void join (const ReductionT& r): adds the partial result r of another thread, e.g. a sum, a minimum or a vector.
+/// Each thread visits a contiguous block of the triangulation with its own copy of r. The copies are made before the traversal; thus, r must contain the neutral element of the reduction (e.g. 0 for sums, 1e99 for minima). Finally, the partial results are joined into r in the order of the threads; hence, the result does not depend on the scheduling, only on the number of threads. With one thread, r visits all tetras in the order of the triangulation.
+template <class ReductionT>
+  void
+  reduce_tetras (const MultiGridCL& mg, int lvl, ReductionT& r)
+{
+    const MultiGridCL::const_TriangTetraIteratorCL begin= mg.GetTriangTetraBegin( lvl);
+    AccumulatorImplNS::reduce( begin, mg.GetTriangTetraEnd( lvl) - begin, r);
+}
+
+/// \brief OpenMP-parallel reduction over the sequence of tetras, e.g. the tetras of an InterfaceBandCL; see above.
+template <class ReductionT>
+  void
+  reduce_tetras (const ColorClassesCL::ColorClassT& tetras, ReductionT& r)
+{
+    if (!tetras.empty())
+        AccumulatorImplNS::reduce( &tetras[0], tetras.size(), r);
+}
+
+/// \brief Calls f( t) OpenMP-parallel for the tetras t of the triangulation of level lvl; tetras with a common dof are not visited concurrently.
+///
+/// Thus, f can scatter its contributions to the dof of t without synchronization. The color-classes of the MultiGridCL are used. FunT must be copy-constructible and provide void operator() (const TetraCL&). Each thread uses its own copy of f, e.g. as workspace; hence, the results must be written via references or pointers. With one thread, f visits all tetras in the order of the triangulation.
+template <class FunT>
+  void
+  scatter_tetras (const MultiGridCL& mg, int lvl, match_fun match, const BndCondCL& Bnd, FunT& f)
+{
+    if (omp_get_max_threads() == 1) {
+        DROPS_FOR_TRIANG_CONST_TETRA( mg, lvl, it)
+            f( *it);
+        return;
+    }
+
+    const ColorClassesCL& colors= mg.GetColorClasses( lvl, match, Bnd);
+    std::vector<FunT> copies( omp_get_max_threads() - 1, f); // thread 0 uses f
+#   pragma omp parallel
+    {
+        const int t_id= omp_get_thread_num();
+        FunT& ft= t_id == 0 ? f : copies[t_id - 1];
+        for (ColorClassesCL::const_iterator cit= colors.begin(); cit != colors.end(); ++cit) {
+            const ColorClassesCL::ColorClassT& cc= *cit;
+#ifndef DROPS_WIN
+            size_t j;
+#else
+            int j;
+#endif
+#           pragma omp for schedule(dynamic, 8)
+            for (j= 0; j < cc.size(); ++j)
+                ft( *cc[j]);
+        }
+    }
 }
 
 /// \brief An AccumulatorTupleCL for each level.
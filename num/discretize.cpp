@@ -310,6 +310,110 @@ void P2DiscCL::GetGradientsOnRef( Quad5CL<Point3DCL> GRef[10])
         }
 }
 
+//**************************************************************************
+// Class: P2BatchDiscCL                                                    *
+//**************************************************************************
+
+double P2BatchDiscCL::StiffRef[6][10][10];
+double P2BatchDiscCL::ConvRef[10][3][10][10];
+
+namespace {
+    const Uint StiffK[6]= { 0, 1, 2, 0, 0, 1 }, ///< first index of the pairs in StiffRef
+               StiffL[6]= { 0, 1, 2, 1, 2, 2 }; ///< second index of the pairs in StiffRef
+} // end of anonymous namespace
+
+P2BatchDiscCL::P2BatchDiscCL ()
+{
+    // The gradients are linear, thus the quadrature rule of degree 5 is exact for all integrands.
+    Point3DCL GRef[Quad5DataCL::NumNodesC][10];
+    for (Uint q= 0; q < Quad5DataCL::NumNodesC; ++q)
+        for (Uint i= 0; i < 10; ++i)
+            GRef[q][i]= FE_P2CL::DHRef( i, Quad5DataCL::Node[q][1], Quad5DataCL::Node[q][2], Quad5DataCL::Node[q][3]);
+
+    for (Uint p= 0; p < 6; ++p)
+        for (Uint i= 0; i < 10; ++i)
+            for (Uint j= 0; j < 10; ++j) {
+                double s= 0.;
+                for (Uint q= 0; q < Quad5DataCL::NumNodesC; ++q) {
+                    s+= Quad5DataCL::Weight[q]*GRef[q][j][StiffK[p]]*GRef[q][i][StiffL[p]];
+                    if (StiffK[p] != StiffL[p])
+                        s+= Quad5DataCL::Weight[q]*GRef[q][j][StiffL[p]]*GRef[q][i][StiffK[p]];
+                }
+                StiffRef[p][i][j]= s;
+            }
+
+    for (Uint d= 0; d < 10; ++d)
+        for (Uint m= 0; m < 3; ++m)
+            for (Uint i= 0; i < 10; ++i)
+                for (Uint j= 0; j < 10; ++j) {
+                    double s= 0.;
+                    for (Uint q= 0; q < Quad5DataCL::NumNodesC; ++q)
+                        s+= Quad5DataCL::Weight[q]*Quad5DataCL::P2_Val[d][q]*GRef[q][j][m]*Quad5DataCL::P2_Val[i][q];
+                    ConvRef[d][m][i][j]= s;
+                }
+}
+
+namespace {
+    P2BatchDiscCL theP2BatchDiscInitializer_; // The constructor sets up the static arrays; it must follow theQuad5DataInitializer_.
+} // end of anonymous namespace
+
+void P2BatchDiscCL::GetStiffness (const LaneT T[9], const LaneT absdet, LaneT A[10][10])
+{
+    // grad phi_j . grad phi_i = DRef phi_j^T (T^T T) DRef phi_i; G contains the entries of absdet*T^T T.
+    LaneT G[6];
+    for (Uint p= 0; p < 6; ++p)
+        for (Uint l= 0; l < BatchC; ++l)
+            G[p][l]= absdet[l]*(T[StiffK[p]][l]*T[StiffL[p]][l] + T[3 + StiffK[p]][l]*T[3 + StiffL[p]][l]
+                                + T[6 + StiffK[p]][l]*T[6 + StiffL[p]][l]);
+
+    for (Uint i= 0; i < 10; ++i)
+        for (Uint j= 0; j <= i; ++j) {
+            double* const a= A[i][j];
+            for (Uint l= 0; l < BatchC; ++l)
+                a[l]= 0.;
+            for (Uint p= 0; p < 6; ++p) {
+                const double s= StiffRef[p][i][j];
+                for (Uint l= 0; l < BatchC; ++l)
+                    a[l]+= s*G[p][l];
+            }
+            if (i != j)
+                std::memcpy( A[j][i], a, sizeof( LaneT));
+        }
+}
+
+void P2BatchDiscCL::GetMass (const LaneT absdet, LaneT M[10][10])
+{
+    for (Uint i= 0; i < 10; ++i)
+        for (Uint j= 0; j < 10; ++j) {
+            const double s= P2DiscCL::GetMass( i, j);
+            for (Uint l= 0; l < BatchC; ++l)
+                M[i][j][l]= s*absdet[l];
+        }
+}
+
+void P2BatchDiscCL::GetConvection (const LaneT T[9], const LaneT absdet, const LaneT u[10][3], LaneT C[10][10])
+{
+    // u . grad phi_j = (T^T u) . DRef phi_j; V contains absdet*T^T u for each dof.
+    LaneT V[10][3];
+    for (Uint d= 0; d < 10; ++d)
+        for (Uint m= 0; m < 3; ++m)
+            for (Uint l= 0; l < BatchC; ++l)
+                V[d][m][l]= absdet[l]*(T[m][l]*u[d][0][l] + T[3 + m][l]*u[d][1][l] + T[6 + m][l]*u[d][2][l]);
+
+    for (Uint i= 0; i < 10; ++i)
+        for (Uint j= 0; j < 10; ++j) {
+            double* const c= C[i][j];
+            for (Uint l= 0; l < BatchC; ++l)
+                c[l]= 0.;
+            for (Uint d= 0; d < 10; ++d)
+                for (Uint m= 0; m < 3; ++m) {
+                    const double s= ConvRef[d][m][i][j];
+                    for (Uint l= 0; l < BatchC; ++l)
+                        c[l]+= s*V[d][m][l];
+                }
+        }
+}
+
 void P2DiscCL::GetGradientsOnRef( Quad5_2DCL<Point3DCL> GRef[10],
     const BaryCoordCL* const p)
 {
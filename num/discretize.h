@@ -1038,6 +1038,31 @@ class P2DiscCL
     static inline double GetLumpedMass( int i) { return i<4 ? -1./120. : 1./30.; }
 };
 
+/// \brief Local P2-matrices for a batch of tetras in structure-of-arrays layout.
+///
+/// Lane l of a LaneT belongs to the l-th tetra of the batch; e.g. entry (i,j) of the local matrix of the l-th tetra is A[i][j][l].
+/// The loops over the lanes are the innermost ones and have the fixed length BatchC, such that the compiler vectorizes them across the tetras.
+/// Batches with less than BatchC tetras are padded; the padding lanes must hold finite values, e.g. zeros.
+/// The matrices are computed from integrals on the reference tetra, which are set up exactly once on program-startup by the global object in num/discretize.cpp. The results agree with the quadrature based setup on a single tetra up to round-off.
+class P2BatchDiscCL
+{
+  public:
+    P2BatchDiscCL ();
+
+    enum { BatchC= 8 };
+    typedef double LaneT[BatchC];
+
+    static double StiffRef[6][10][10];    ///< \f$\int D_k\hat\phi_j D_l\hat\phi_i\f$ for (k,l)= (0,0), (1,1), (2,2), (0,1), (0,2), (1,2); the mixed pairs are symmetrized.
+    static double ConvRef[10][3][10][10]; ///< ConvRef[d][m][i][j]= \f$\int \hat\phi_d D_m\hat\phi_j \hat\phi_i\f$
+
+    /// \brief Stiffness matrices \f$\int \nabla\phi_j\cdot\nabla\phi_i\f$; T[3*k+m] and absdet are the components of the transformations and the absolute values of their determinants as obtained from GetTrafoTr.
+    static void GetStiffness (const LaneT T[9], const LaneT absdet, LaneT A[10][10]);
+    /// \brief Mass matrices \f$\int \phi_j \phi_i\f$.
+    static void GetMass (const LaneT absdet, LaneT M[10][10]);
+    /// \brief Convection matrices \f$\int (u\cdot\nabla\phi_j) \phi_i\f$ for a P2-velocity u; u[d][k] is component k of the velocity in the d-th dof. The quadrature is exact.
+    static void GetConvection (const LaneT T[9], const LaneT absdet, const LaneT u[10][3], LaneT C[10][10]);
+};
+
 class P2RidgeDiscCL
 /// \brief contains helper functions for the XFEM discretization based on ridge enrichment.
 ///
@@ -30,6 +30,7 @@
 
 #include <tr1/unordered_map>
 #include <tr1/unordered_set>
+#include <numeric>
 
 #include "misc/container.h"
 #include "geom/topo.h"
@@ -151,6 +152,122 @@ class RepairP2CL
     void repair (VecDescCL& new_vd);
 };
 
+/// \brief Repair several P1- and P2-FE-functions after a sequence of refinements in one traversal.
+///
+/// RepairP2CL repairs one function after one call of MultiGridCL::Refine. If the
+/// triangulation is modified by several refinements, e.g. in AdapTriangCL::UpdateTriang,
+/// this class repairs all registered functions once on the final triangulation.
+///
+/// As the refinement-algo never deletes tetras in level 0, the tetras of the original
+/// triangulation are stored as leaves of a copy of the refinement-hierarchy below
+/// each tetra in level 0. A node of this hierarchy is identified by the numbers of the
+/// children (per topo.h) on the path from level 0, which determine the geometry of the
+/// tetra. To locate a dof of a tetra t of the current multigrid, the hierarchy is
+/// descended along the ancestors of t. If t or one of its ancestors is found as a leaf
+/// (cases: unchanged tetra, refinement), the dof is in this leaf. Otherwise, t has been
+/// created by coarsening and the children containing the dof are searched below the
+/// deepest ancestor of t in the hierarchy.
+///
+/// The location of the dof and the values of the P2-basis in it are shared by all
+/// functions; the functions only differ in their P2-coefficients on the leaves. The
+/// tetras of the new triangulation are processed in parallel: Each dof is repaired by
+/// the first tetra in the triangulation, which contains it.
+///
+/// The repaired function is always a quadratic (resp. linear) interpolant of the original
+/// function on the new triangulation. A P1-function is stored as P2-data; its repair
+/// only uses the vertex-dof.
+///
+/// Usage: Construct before the first refinement; register the original functions with
+/// push_back(). After the last refinement, create the new numberings, register the
+/// VecDescCL to be repaired with set_target() and call repair().
+class RepairSetCL
+{
+  private:
+    /// \brief Node of the copy of the refinement-hierarchy.
+    struct NodeT
+    {
+        std::vector<std::pair<Ubyte, size_t> > children; ///< pairs (child number per topo.h, node)
+        size_t leaf;                                      ///< index in leaves_ for leaves, NoIdx for inner nodes
+
+        NodeT () : leaf( NoIdx) {}
+    };
+    typedef std::tr1::unordered_map<const TetraCL*, size_t> RootMapT;
+
+    /// \brief A registered function.
+    struct FieldT
+    {
+        Uint                num_comp; ///< number of components (1 or 3)
+        double              t;        ///< time of the original function
+        std::vector<double> coeff;    ///< P2-coefficient i of component c on leaf l is at coeff[(l*num_comp + c)*10 + i]
+        VecDescCL*          target;   ///< VecDescCL to be repaired or 0
+
+        FieldT (Uint nc, double time, size_t num_leaves)
+            : num_comp( nc), t( time), coeff( num_leaves*nc*10), target( 0) {}
+    };
+
+    RootMapT                    roots_;  ///< nodes of the tetras in level 0
+    std::vector<NodeT>          nodes_;
+    std::vector<const TetraCL*> leaves_; ///< tetras of the original triangulation
+    std::vector<FieldT>         fields_;
+
+    BaryCoordCL p2_dof_[10]; ///< The bary-coordinates of the P2-dof.
+
+    const MultiGridCL& mg_; ///< Multigrid to operate on
+
+    /// \brief The number of the child c in the refinement rule of its parent.
+    static Ubyte child_number (const TetraCL& c) {
+        const TetraCL* p= c.GetParent();
+        return p->GetRefData().Children[std::find( p->GetChildBegin(), p->GetChildEnd(), &c) - p->GetChildBegin()];
+    }
+    /// \brief Child of node n with child number ch per topo.h or NoIdx.
+    size_t find_child (size_t n, Ubyte ch) const;
+    /// \brief Leaf below node n, which contains the bary-coordinates b with respect to n. b is transformed to the leaf.
+    size_t locate (size_t n, BaryCoordCL& b) const;
+    /// \brief Leaves and bary-coordinates therein of the dof i of t with bit i set in mask.
+    void locate_dofs (const TetraCL& t, Uint mask, size_t leaf[10], BaryCoordCL b[10]) const;
+
+    /// \brief Values of the P2-basis in b.
+    static void p2_basis (const BaryCoordCL& b, double phi[10]) {
+        phi[0]= FE_P2CL::H0( b); phi[1]= FE_P2CL::H1( b); phi[2]= FE_P2CL::H2( b); phi[3]= FE_P2CL::H3( b);
+        phi[4]= FE_P2CL::H4( b); phi[5]= FE_P2CL::H5( b); phi[6]= FE_P2CL::H6( b); phi[7]= FE_P2CL::H7( b);
+        phi[8]= FE_P2CL::H8( b); phi[9]= FE_P2CL::H9( b);
+    }
+
+    /// \name Store the P2-coefficients of a local function
+    //@{
+    static void store (double* c, const LocalP2CL<double>& f) {
+        for (Uint i= 0; i < 10; ++i)
+            c[i]= f[i];
+    }
+    static void store (double* c, const LocalP2CL<Point3DCL>& f) {
+        for (Uint j= 0; j < 3; ++j)
+            for (Uint i= 0; i < 10; ++i)
+                c[j*10 + i]= f[i][j];
+    }
+    //@}
+
+  public:
+    /// \brief Saves the refinement-hierarchy of the triangulation lvl.
+    RepairSetCL (const MultiGridCL& mg, Uint lvl);
+
+    /// \brief Register the function old, which must be a P1- or P2-function on the triangulation of the constructor. Returns the number of the function.
+    template <class ValueT>
+      size_t push_back (const VecDescCL& old, const BndDataCL<ValueT>& bnd);
+    /// \brief Number of registered functions.
+    size_t size () const { return fields_.size(); }
+
+    /// \brief Register the VecDescCL, in which the function with number field is repaired.
+    /// new_vd must contain a valid numbering on the current multigrid and a vector of corresponding size.
+    /// P1- and P2-numberings can be used for all functions.
+    void set_target (size_t field, VecDescCL& new_vd);
+
+    /// \brief Compute the P2-interpolant of the scalar function with number field on the tetra t of the current multigrid.
+    void assign_on_tetra (size_t field, LocalP2CL<>& lp2, const TetraCL& t) const;
+
+    /// \brief Interpolate all functions with a target in the dof of their target.
+    void repair () const;
+};
+
 } // end of namespace DROPS
 
 #include "num/fe_repair.tpp"
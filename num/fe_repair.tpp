@@ -226,4 +226,227 @@ template <class ValueT>
     }
 }
 
+
+/// RepairSetCL
+
+inline
+  RepairSetCL::RepairSetCL (const MultiGridCL& mg, Uint lvl)
+        : mg_( mg)
+{
+    for (Uint i= 0; i < NumVertsC; ++i)
+        p2_dof_[i]= std_basis<4>( i + 1);
+    for (Uint i= 0; i < NumEdgesC; ++i)
+        p2_dof_[i + NumVertsC]= 0.5*(std_basis<4>( VertOfEdge( i, 0) + 1) + std_basis<4>( VertOfEdge( i, 1) + 1));
+
+    std::vector<const TetraCL*> path;
+    DROPS_FOR_TRIANG_CONST_TETRA( mg_, lvl, it) {
+        path.clear();
+        for (const TetraCL* t= &*it; t->GetLevel() > 0; t= t->GetParent())
+            path.push_back( t);
+        const TetraCL* root= path.empty() ? &*it : path.back()->GetParent();
+        std::pair<RootMapT::iterator, bool> r= roots_.insert( std::make_pair( root, nodes_.size()));
+        if (r.second)
+            nodes_.push_back( NodeT());
+        size_t n= r.first->second;
+        for (std::vector<const TetraCL*>::reverse_iterator t= path.rbegin(); t != path.rend(); ++t) {
+            const Ubyte ch= child_number( **t);
+            size_t c= find_child( n, ch);
+            if (c == NoIdx) {
+                c= nodes_.size();
+                nodes_[n].children.push_back( std::make_pair( ch, c));
+                nodes_.push_back( NodeT());
+            }
+            n= c;
+        }
+        nodes_[n].leaf= leaves_.size();
+        leaves_.push_back( &*it);
+    }
+}
+
+template <class ValueT>
+  size_t
+  RepairSetCL::push_back (const VecDescCL& old, const BndDataCL<ValueT>& bnd)
+{
+    const Uint num_comp= sizeof( ValueT)/sizeof( double);
+    fields_.push_back( FieldT( num_comp, old.t, leaves_.size()));
+    std::vector<double>& coeff= fields_.back().coeff;
+
+    const bool isP2= old.RowIdx->NumUnknownsEdge() > 0;
+    LocalP1CL<ValueT> lp1;
+    LocalP2CL<ValueT> lp2;
+    for (size_t l= 0; l < leaves_.size(); ++l) {
+        if (isP2)
+            lp2.assign_on_tetra( *leaves_[l], old, bnd);
+        else
+            lp2.assign( lp1.assign( *leaves_[l], old, bnd));
+        store( &coeff[l*num_comp*10], lp2);
+    }
+    return fields_.size() - 1;
+}
+
+inline void
+  RepairSetCL::set_target (size_t field, VecDescCL& new_vd)
+{
+    Assert( fields_[field].num_comp == new_vd.RowIdx->NumUnknownsVertex(),
+        DROPSErrCL( "RepairSetCL::set_target: Wrong number of components.\n"), DebugNumericC);
+    fields_[field].target= &new_vd;
+}
+
+inline size_t
+  RepairSetCL::find_child (size_t n, Ubyte ch) const
+{
+    const std::vector<std::pair<Ubyte, size_t> >& c= nodes_[n].children;
+    for (size_t i= 0; i < c.size(); ++i)
+        if (c[i].first == ch)
+            return c[i].second;
+    return NoIdx;
+}
+
+inline size_t
+  RepairSetCL::locate (size_t n, BaryCoordCL& b) const
+{
+    BaryCoordCL tmp( Uninitialized);
+    while (nodes_[n].leaf == NoIdx) {
+        const std::vector<std::pair<Ubyte, size_t> >& c= nodes_[n].children;
+        size_t i= 0;
+        for (; i < c.size(); ++i) {
+            tmp= parent_to_child_bary( c[i].first)*b;
+            if (contained_in_reference_tetra( tmp, 8*std::numeric_limits<double>::epsilon()))
+                break;
+        }
+        if (i == c.size())
+            throw DROPSErrCL( "RepairSetCL::locate: Could not locate a dof.\n");
+        b= tmp;
+        n= c[i].second;
+    }
+    return nodes_[n].leaf;
+}
+
+inline void
+  RepairSetCL::locate_dofs (const TetraCL& t, Uint mask, size_t leaf[10], BaryCoordCL b[10]) const
+{
+    // Descend along the ancestors of t as long as they are in the hierarchy.
+    const TetraCL* path[64];
+    Uint len= 0;
+    for (const TetraCL* p= &t; p->GetLevel() > 0; p= p->GetParent())
+        path[len++]= p;
+    const TetraCL* root= len == 0 ? &t : path[len - 1]->GetParent();
+    const RootMapT::const_iterator r= roots_.find( root);
+    if (r == roots_.end())
+        throw DROPSErrCL( "RepairSetCL::locate_dofs: Tetra in level 0 without data.\n");
+    size_t n= r->second, c;
+    Uint k= len; // path[k-1] is the next ancestor to be found
+    for (; k > 0 && nodes_[n].leaf == NoIdx && (c= find_child( n, child_number( *path[k - 1]))) != NoIdx; --k)
+        n= c;
+
+    // Transform the dof of t to the ancestor corresponding to n.
+    SMatrixCL<4,4> to_n( 0.);
+    for (Uint i= 0; i < 4; ++i)
+        to_n( i, i)= 1.;
+    for (Uint j= k; j > 0; --j)
+        to_n= to_n*child_to_parent_bary( child_number( *path[j - 1]));
+    for (Uint i= 0; i < 10; ++i)
+        if (mask & (1 << i)) {
+            b[i]= to_n*p2_dof_[i];
+            leaf[i]= locate( n, b[i]);
+        }
+}
+
+inline void
+  RepairSetCL::assign_on_tetra (size_t field, LocalP2CL<>& lp2, const TetraCL& t) const
+{
+    Assert( fields_[field].num_comp == 1, DROPSErrCL( "RepairSetCL::assign_on_tetra: Only for scalar functions.\n"), DebugNumericC);
+    size_t leaf[10];
+    BaryCoordCL b[10];
+    locate_dofs( t, (1 << 10) - 1, leaf, b);
+    const std::vector<double>& coeff= fields_[field].coeff;
+    double phi[10];
+    for (Uint i= 0; i < 10; ++i) {
+        p2_basis( b[i], phi);
+        lp2[i]= std::inner_product( phi, phi + 10, &coeff[leaf[i]*10], 0.);
+    }
+}
+
+inline void
+  RepairSetCL::repair () const
+{
+    std::vector<const FieldT*> fields;
+    for (size_t f= 0; f < fields_.size(); ++f)
+        if (fields_[f].target != 0)
+            fields.push_back( &fields_[f]);
+    if (fields.empty())
+        return;
+    const size_t num_fields= fields.size();
+    const Uint lvl= fields[0]->target->RowIdx->TriangLevel();
+
+    // Each dof is repaired by the first tetra, which contains it. masks[t*num_fields + f] has bit i set, iff tetra t repairs dof i of field f.
+    std::vector<const TetraCL*> tetras;
+    DROPS_FOR_TRIANG_CONST_TETRA( mg_, lvl, it)
+        tetras.push_back( &*it);
+    std::vector<Uint> masks( tetras.size()*num_fields, 0);
+    for (size_t f= 0; f < num_fields; ++f) {
+        const IdxDescCL& idx= *fields[f]->target->RowIdx;
+        Assert( idx.TriangLevel() == lvl, DROPSErrCL( "RepairSetCL::repair: Different levels.\n"), DebugNumericC);
+        const Uint sysnum= idx.GetIdx(),
+                   numdof= idx.NumUnknownsEdge() > 0 ? 10 : NumVertsC;
+        std::vector<bool> repair_needed( fields[f]->target->Data.size(), true);
+        for (size_t t= 0; t < tetras.size(); ++t)
+            for (Uint i= 0; i < numdof; ++i) {
+                const UnknownHandleCL& u= i < NumVertsC ? tetras[t]->GetVertex( i)->Unknowns : tetras[t]->GetEdge( i - NumVertsC)->Unknowns;
+                if (u.Exist( sysnum) && repair_needed[u( sysnum)]) {
+                    repair_needed[u( sysnum)]= false;
+                    masks[t*num_fields + f]|= 1 << i;
+                }
+            }
+    }
+
+    bool located= true;
+#pragma omp parallel
+{
+    size_t leaf[10];
+    BaryCoordCL b[10];
+    double phi[10];
+#ifndef DROPS_WIN
+    size_t t;
+#else
+    int t;
+#endif
+#pragma omp for schedule( dynamic, 256) reduction(&&:located)
+    for (t= 0; t < tetras.size(); ++t) {
+        Uint mask= 0;
+        for (size_t f= 0; f < num_fields; ++f)
+            mask|= masks[t*num_fields + f];
+        if (mask == 0)
+            continue;
+        try {
+            locate_dofs( *tetras[t], mask, leaf, b);
+        }
+        catch (DROPSErrCL&) { // Exceptions must not leave the parallel region.
+            located= false;
+            continue;
+        }
+        for (Uint i= 0; i < 10; ++i) {
+            if (!(mask & (1 << i)))
+                continue;
+            p2_basis( b[i], phi);
+            const UnknownHandleCL& u= i < NumVertsC ? tetras[t]->GetVertex( i)->Unknowns : tetras[t]->GetEdge( i - NumVertsC)->Unknowns;
+            for (size_t f= 0; f < num_fields; ++f) {
+                if (!(masks[t*num_fields + f] & (1 << i)))
+                    continue;
+                const FieldT& field= *fields[f];
+                const IdxT dof= u( field.target->RowIdx->GetIdx());
+                const double* c= &field.coeff[leaf[i]*field.num_comp*10];
+                for (Uint j= 0; j < field.num_comp; ++j, c+= 10) {
+                    field.target->Data[dof + j]= std::inner_product( phi, phi + 10, c, 0.);
+                }
+            }
+        }
+    }
+}
+    if (!located)
+        throw DROPSErrCL( "RepairSetCL::repair: Could not locate all new dof.\n");
+    for (size_t f= 0; f < num_fields; ++f)
+        fields[f]->target->t= fields[f]->t;
+}
+
 } // end of namespace DROPS
@@ -615,9 +615,118 @@ LocalP2CL<double> ProjectIsoP2ChildToParentP1 (LocalP2CL<double> lpin, Uint chil
     return res;
 }
 
+//*****************************************************************************
+//                               InterfaceBandCL
+//*****************************************************************************
 
+void InterfaceBandCL::bernstein_range (const LocalP2CL<>& ls, double& min, double& max)
+{
+    min= max= ls[0];
+    for (Uint i= 1; i < 4; ++i) {
+        min= std::min( min, ls[i]);
+        max= std::max( max, ls[i]);
+    }
+    for (Uint e= 0; e < 6; ++e) { // The Bernstein coefficient of an edge is 2*phi(midpoint) - (phi(v0) + phi(v1))/2.
+        const double b= 2.*ls[e + 4] - 0.5*(ls[VertOfEdge( e, 0)] + ls[VertOfEdge( e, 1)]);
+        min= std::min( min, b);
+        max= std::max( max, b);
+    }
+}
 
+bool InterfaceBandCL::IsValid (const MultiGridCL& mg, const VecDescCL& phi) const
+{
+    return valid_ && level_ == phi.GetLevel()
+        && version_ == mg.GetVersion() && coord_version_ == mg.GetCoordVersion()
+        && phi_.size() == phi.Data.size() && std::equal( Addr( phi_), Addr( phi_) + phi_.size(), Addr( phi.Data));
+}
 
+void InterfaceBandCL::update (const MultiGridCL& mg, const VecDescCL& phi, const BndDataCL<>& bnd)
+{
+    if (IsValid( mg, phi))
+        return;
 
-} // end of namespace DROPS
+    level_= phi.GetLevel();
+    version_= mg.GetVersion();
+    coord_version_= mg.GetCoordVersion();
+    phi_.resize( phi.Data.size());
+    phi_= phi.Data;
+
+    const MultiGridCL::const_TriangTetraIteratorCL begin= mg.GetTriangTetraBegin( level_);
+    const size_t n= mg.GetTriangTetraEnd( level_) - begin;
+    std::vector<byte>   sign( n); // 0 for the tetras in the band, otherwise the sign of phi on the tetra
+    std::vector<double> dist( n); // smallest absolute value of the Bernstein coefficients on the tetras outside of the band
+#   pragma omp parallel
+    {
+        LocalP2CL<> loc_phi;
+        double min, max;
+#ifndef DROPS_WIN
+        size_t i;
+#else
+        int i;
+#endif
+#       pragma omp for
+        for (i= 0; i < n; ++i) {
+            loc_phi.assign( begin[i], phi, bnd);
+            bernstein_range( loc_phi, min, max);
+            sign[i]= min >= InterfacePatchCL::approxZero_ ? 1 : (max <= -InterfacePatchCL::approxZero_ ? -1 : 0);
+            dist[i]= sign[i] == 1 ? min : -max;
+        }
+    }
+
+    // Add the layers of neighbors, which share a vertex with the band.
+    std::vector<const VertexCL*> verts;
+    for (Uint l= 0; l < layers_; ++l) {
+        verts.clear();
+        for (size_t i= 0; i < n; ++i)
+            if (sign[i] == 0)
+                for (Uint j= 0; j < 4; ++j)
+                    verts.push_back( begin[i].GetVertex( j));
+        std::sort( verts.begin(), verts.end());
+        verts.erase( std::unique( verts.begin(), verts.end()), verts.end());
+#ifndef DROPS_WIN
+        size_t i;
+#else
+        int i;
+#endif
+#       pragma omp parallel for
+        for (i= 0; i < n; ++i)
+            for (Uint j= 0; j < 4 && sign[i] != 0; ++j)
+                if (std::binary_search( verts.begin(), verts.end(), begin[i].GetVertex( j)))
+                    sign[i]= 0;
+    }
+
+    tetras_.clear();
+    neg_volume_= 0.;
+    margin_= std::numeric_limits<double>::max();
+    for (size_t i= 0; i < n; ++i) {
+        if (sign[i] == 0)
+            tetras_.push_back( &begin[i]);
+        else {
+            margin_= std::min( margin_, dist[i]);
+            if (sign[i] == -1)
+                neg_volume_+= begin[i].GetVolume();
+        }
+    }
+    valid_= true;
+    colors_valid_= false;
+}
+
+const std::vector<InterfaceBandCL::TetraVecT>& InterfaceBandCL::GetColorClasses (const MultiGridCL& mg, match_fun match, const BndCondCL& Bnd) const
+{
+    if (colors_valid_)
+        return colors_;
+
+    TetraVecT sorted( tetras_);
+    std::sort( sorted.begin(), sorted.end());
+    const ColorClassesCL& colors= mg.GetColorClasses( level_, match, Bnd);
+    colors_.assign( colors.num_colors(), TetraVecT());
+    std::vector<TetraVecT>::iterator c= colors_.begin();
+    for (ColorClassesCL::const_iterator cit= colors.begin(); cit != colors.end(); ++cit, ++c)
+        for (TetraVecT::const_iterator it= cit->begin(); it != cit->end(); ++it)
+            if (std::binary_search( sorted.begin(), sorted.end(), *it))
+                c->push_back( *it);
+    colors_valid_= true;
+    return colors_;
+}
 
+} // end of namespace DROPS
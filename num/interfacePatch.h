@@ -30,6 +30,8 @@
 namespace DROPS
 {
 
+class InterfaceBandCL; // fwd decl
+
 class InterfacePatchCL
 /// Computes approximation of interface.
 /** Computes the planar interface patches, which are the intersection of a child T' of
@@ -39,6 +41,8 @@ class InterfacePatchCL
  *  on each edge of T' where phi changes its sign.
  */
 {
+  friend class InterfaceBandCL;
+
   public:
     typedef SArrayCL<BaryCoordCL,4> SubTetraT;
 
@@ -169,6 +173,82 @@ class InterfaceTriangleCL : public InterfacePatchCL
 };
 
 
+/// \brief The tetras of a triangulation, on which the zero level of a P2 level set function may lie, and optionally some layers of their neighbors.
+///
+/// A tetra is outside of the band, if all Bernstein coefficients of the level set function on it have the same sign; they are
+/// bounded away from zero by InterfacePatchCL::approxZero_. Then the level set function does not vanish on the closed tetra:
+/// InterfacePatchCL::Intersects() is false and all partitions of the principal lattices have only tetras of one sign.
+/// Hence, algorithms, which only need the cut tetras, can iterate over the band instead of the whole triangulation.
+///
+/// The band is computed on the first call of update() for the current version of the multigrid and the current
+/// values of the level set function. The tetras of the band are stored in the order of the triangulation.
+class InterfaceBandCL
+{
+  public:
+    typedef ColorClassesCL::ColorClassT TetraVecT;
+
+  private:
+    Uint     level_;         ///< level of the triangulation
+    size_t   version_;       ///< version of the multigrid
+    size_t   coord_version_; ///< version of the vertex-coordinates
+    Uint     layers_;        ///< number of layers of neighbors of the cut tetras
+    VectorCL phi_;           ///< values of the level set function, for which the band was computed
+    bool     valid_;
+
+    TetraVecT tetras_;     ///< tetras of the band in the order of the triangulation
+    double    neg_volume_; ///< volume of the negative tetras outside of the band
+    double    margin_;     ///< smallest absolute value of the Bernstein coefficients on the tetras outside of the band
+
+    mutable std::vector<TetraVecT> colors_; ///< color classes of tetras_; computed on demand
+    mutable bool                   colors_valid_;
+
+    /// \brief Minimum and maximum of the Bernstein coefficients of the P2-function ls.
+    static void bernstein_range (const LocalP2CL<>& ls, double& min, double& max);
+
+  public:
+    InterfaceBandCL (Uint layers= 1)
+        : level_( 0), version_( 0), coord_version_( 0), layers_( layers), valid_( false),
+          neg_volume_( 0.), margin_( 0.), colors_valid_( false) {}
+
+    /// \brief True, iff the band was computed for the current triangulation of phi and the current values of phi.
+    bool IsValid (const MultiGridCL& mg, const VecDescCL& phi) const;
+    /// \brief Recompute the band, if it is not valid.
+    void update (const MultiGridCL& mg, const VecDescCL& phi, const BndDataCL<>& bnd);
+    /// \brief Set the number of layers of neighbors of the cut tetras; the band is recomputed on the next call of update().
+    void SetLayers (Uint layers) { if (layers != layers_) { layers_= layers; valid_= false; } }
+    Uint GetLayers () const { return layers_; }
+
+    Uint GetLevel () const { return level_; }
+    /// \brief The tetras of the band in the order of the triangulation.
+    const TetraVecT& GetTetras () const { return tetras_; }
+    size_t size () const { return tetras_.size(); }
+    /// \brief Color classes of the tetras of the band; they are obtained from the color classes of the triangulation.
+    /// Not thread-safe; call it before a parallel region.
+    const std::vector<TetraVecT>& GetColorClasses (const MultiGridCL& mg, match_fun match, const BndCondCL& Bnd) const;
+
+    /// \brief Volume of the negative tetras outside of the band.
+    double GetNegVolume () const { return neg_volume_; }
+    /// \brief True, iff the level set function plus translation does not vanish on the tetras outside of the band.
+    /// Then, they have the same sign as for translation 0.
+    bool IsBandFor (double translation) const
+        { return std::abs( translation) + InterfacePatchCL::approxZero_ < margin_; }
+};
+
+/// \brief Visits the tetras of band with accus; the tetras of one color class are visited in parallel.
+/// With one thread, the tetras are visited in the order of the triangulation.
+template <class AccumulatorTupleT>
+  inline void
+  accumulate (AccumulatorTupleT& accus, const MultiGridCL& mg, const InterfaceBandCL& band, match_fun match, const BndCondCL& Bnd)
+{
+    if (omp_get_max_threads() == 1)
+        accus.visit_color_classes( &band.GetTetras(), &band.GetTetras() + 1);
+    else {
+        const std::vector<InterfaceBandCL::TetraVecT>& colors= band.GetColorClasses( mg, match, Bnd);
+        accus.visit_color_classes( colors.begin(), colors.end());
+    }
+}
+
+
 LocalP2CL<double> ProjectIsoP2ChildToParentP1 (LocalP2CL<double> lpin, Uint child);
 
 
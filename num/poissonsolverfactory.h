@@ -158,7 +158,15 @@ PoissonSolverFactoryCL<ProlongationT>::
         GMResSolver_( JACPc_, P.get<int>("Poisson.Restart"), P.get<int>("Poisson.Iter"), P.get<double>("Poisson.Tol"), P.get<double>("Poisson.RelativeErr")),
         GMResSolverSSOR_( SSORPc_, P.get<int>("Poisson.Restart"), P.get<int>("Poisson.Iter"), P.get<double>("Poisson.Tol"), P.get<double>("Poisson.RelativeErr")),
         PCGSolver_( SSORPc_, P.get<int>("Poisson.Iter"), P.get<double>("Poisson.Tol"), P.get<double>("Poisson.RelativeErr"))
-        {}
+{
+    // optional: Galerkin coarse matrices P^T A P instead of the assembled ones
+    const bool galerkin= P.get<int>("Poisson.GalerkinMG", 0) != 0;
+    MGSolversymmJOR_.SetGalerkin( galerkin);
+    MGSolversymmGS_.SetGalerkin( galerkin);
+    MGSolversymmSGS_.SetGalerkin( galerkin);
+    MGSolversymmSOR_.SetGalerkin( galerkin);
+    MGSolversymmSSOR_.SetGalerkin( galerkin);
+}
 
 template <class ProlongationT>
 PoissonSolverBaseCL* PoissonSolverFactoryCL<ProlongationT>::CreatePoissonSolver()
@@ -135,4 +135,166 @@ void MassAccu_P2CL::update_global_system (const LocalNumbP2CL& n, const SMatrixC
                     M( n.num[i]/num_components, n.num[j]/num_components)+= loc( i, j);
 }
 
+
+//=============================================================================
+//  Locality orderings
+//=============================================================================
+
+LocalityOrderingT
+locality_ordering_from_string (const std::string& name)
+{
+    if (name == "RCM")     return RCMOrderingC;
+    if (name == "Morton")  return MortonOrderingC;
+    if (name == "Hilbert") return HilbertOrderingC;
+    throw DROPSErrCL( "locality_ordering_from_string: Unknown ordering '" + name + "'.\n");
+}
+
+namespace {
+
+/// \brief Visit a simplex, which carries the DoF-blocks [unk, unk+num_blocks).
+/// The blocks (and the corresponding extended blocks) are appended to blocks.
+template <class SimplexT>
+void
+append_blocks (const SimplexT& s, const IdxDescCL& idx, Uint num_blocks, std::vector<size_t>& blocks)
+{
+    const Uint sys= idx.GetIdx();
+    const Uint num_components= idx.NumUnknownsVertex();
+    if (num_blocks == 0 || !s.Unknowns.Exist( sys) || s.Unknowns( sys) == NoIdx)
+        return;
+    for (Uint k= 0; k < num_blocks; ++k) {
+        const IdxT dof= s.Unknowns( sys) + k*num_components;
+        blocks.push_back( dof/num_components);
+        if (idx.IsExtended( dof))
+            blocks.push_back( idx.GetXidx()[dof]/num_components);
+    }
+}
+
+/// \brief Collect the DoF-blocks of all simplices of t.
+void
+tetra_blocks (const TetraCL& t, const IdxDescCL& idx, std::vector<size_t>& blocks)
+{
+    const Uint num_components= idx.NumUnknownsVertex();
+    blocks.resize( 0);
+    for (Uint i= 0; i < NumVertsC; ++i)
+        append_blocks( *t.GetVertex( i), idx, 1, blocks);
+    for (Uint i= 0; i < NumEdgesC; ++i)
+        append_blocks( *t.GetEdge( i), idx, idx.NumUnknownsEdge()/num_components, blocks);
+    for (Uint i= 0; i < NumFacesC; ++i)
+        append_blocks( *t.GetFace( i), idx, idx.NumUnknownsFace()/num_components, blocks);
+    append_blocks( t, idx, idx.NumUnknownsTetra()/num_components, blocks);
+}
+
+/// \brief Assign the barycenter of s to its DoF-blocks.
+template <class SimplexT>
+void
+assign_positions (const SimplexT& s, const IdxDescCL& idx, Uint num_blocks, std::vector<Point3DCL>& pos)
+{
+    std::vector<size_t> blocks;
+    append_blocks( s, idx, num_blocks, blocks);
+    if (blocks.empty())
+        return;
+    const Point3DCL b= GetBaryCenter( s);
+    for (size_t i= 0; i < blocks.size(); ++i)
+        pos[blocks[i]]= b;
+}
+
+void
+check_locality_fe (const IdxDescCL& idx, const char* caller)
+{
+    if (idx.NumUnknownsVertex() == 0)
+        throw DROPSErrCL( std::string( caller) + ": FE-types without vertex-DoFs are not supported.\n");
+}
+
+} // end of anonymous namespace
+
+PermutationT
+space_filling_curve_numbering (const std::vector<Point3DCL>& pos, LocalityOrderingT ordering)
+{
+    if (ordering != MortonOrderingC && ordering != HilbertOrderingC)
+        throw DROPSErrCL( "space_filling_curve_numbering: ordering is not a space-filling curve.\n");
+
+    PermutationT p( pos.size());
+    if (pos.empty())
+        return p;
+
+    Point3DCL bbox_min( pos[0]), bbox_max( pos[0]);
+    for (size_t i= 1; i < pos.size(); ++i)
+        for (Uint j= 0; j < 3; ++j) {
+            bbox_min[j]= std::min( bbox_min[j], pos[i][j]);
+            bbox_max[j]= std::max( bbox_max[j], pos[i][j]);
+        }
+
+    typedef std::pair<size_t, size_t> KeyT; // (key, point)
+    std::vector<KeyT> keys( pos.size());
+#pragma omp parallel for
+#ifndef DROPS_WIN
+    for (size_t i= 0; i < pos.size(); ++i)
+#else
+    for (int i= 0; i < (int)pos.size(); ++i)
+#endif
+        keys[i]= std::make_pair( ordering == MortonOrderingC ? morton_key( pos[i], bbox_min, bbox_max)
+                                                             : hilbert_key( pos[i], bbox_min, bbox_max), size_t( i));
+    // Ties are broken by the old number, which keeps coinciding points (e.g. extended DoFs) adjacent.
+    std::sort( keys.begin(), keys.end());
+    for (size_t i= 0; i < keys.size(); ++i)
+        p[keys[i].second]= i;
+    return p;
+}
+
+void
+dof_block_positions (const MultiGridCL& mg, const IdxDescCL& idx, std::vector<Point3DCL>& pos)
+{
+    check_locality_fe( idx, "dof_block_positions");
+    const Uint lvl= idx.TriangLevel();
+    const Uint num_components= idx.NumUnknownsVertex();
+    pos.assign( idx.NumUnknowns()/num_components, Point3DCL());
+
+    DROPS_FOR_TRIANG_CONST_VERTEX( mg, lvl, it)
+        assign_positions( *it, idx, 1, pos);
+    if (idx.NumUnknownsEdge() > 0)
+        DROPS_FOR_TRIANG_CONST_EDGE( mg, lvl, it)
+            assign_positions( *it, idx, idx.NumUnknownsEdge()/num_components, pos);
+    if (idx.NumUnknownsFace() > 0)
+        DROPS_FOR_TRIANG_CONST_FACE( mg, lvl, it)
+            assign_positions( *it, idx, idx.NumUnknownsFace()/num_components, pos);
+    if (idx.NumUnknownsTetra() > 0)
+        DROPS_FOR_TRIANG_CONST_TETRA( mg, lvl, it)
+            assign_positions( *it, idx, idx.NumUnknownsTetra()/num_components, pos);
+}
+
+void
+dof_block_graph (const MultiGridCL& mg, const IdxDescCL& idx, MatrixCL& G)
+{
+    check_locality_fe( idx, "dof_block_graph");
+    const size_t num_blocks= idx.NumUnknowns()/idx.NumUnknownsVertex();
+    SparseMatBuilderCL<double> Gb( &G, num_blocks, num_blocks);
+
+    std::vector<size_t> blocks;
+    DROPS_FOR_TRIANG_CONST_TETRA( mg, idx.TriangLevel(), it) {
+        tetra_blocks( *it, idx, blocks);
+        for (size_t i= 0; i < blocks.size(); ++i)
+            for (size_t j= 0; j < blocks.size(); ++j)
+                Gb( blocks[i], blocks[j])= 1.;
+    }
+    Gb.Build();
+}
+
+PermutationT
+locality_numbering (MultiGridCL& mg, IdxDescCL& idx, LocalityOrderingT ordering)
+{
+    PermutationT p;
+    if (ordering == RCMOrderingC) {
+        MatrixCL G;
+        dof_block_graph( mg, idx, G);
+        reverse_cuthill_mckee( G, p);
+    }
+    else {
+        std::vector<Point3DCL> pos;
+        dof_block_positions( mg, idx, pos);
+        p= space_filling_curve_numbering( pos, ordering);
+    }
+    permute_fe_basis( mg, idx, p);
+    return p;
+}
+
 } // end of namspace DROPS
@@ -277,6 +277,49 @@ class MassAccu_P2CL : public TetraAccumulatorCL
 };
 
 
+//=============================================================================
+//  Locality orderings
+//=============================================================================
+
+/// \brief Orderings of the DoFs, which improve the memory locality of SpMV, Gauss-Seidel sweeps and the scatter in the assembly.
+enum LocalityOrderingT {
+    RCMOrderingC,     ///< reverse Cuthill-McKee ordering of the DoF-graph
+    MortonOrderingC,  ///< DoFs sorted along the Morton (Z-order) curve through their positions
+    HilbertOrderingC  ///< DoFs sorted along the Hilbert curve through their positions
+};
+
+/// \brief Returns the ordering with the name "RCM", "Morton" or "Hilbert".
+LocalityOrderingT
+locality_ordering_from_string (const std::string& name);
+
+/// \brief Returns a permutation, which numbers the points pos in the order of the given space-filling curve.
+/// ordering must be MortonOrderingC or HilbertOrderingC.
+PermutationT
+space_filling_curve_numbering (const std::vector<Point3DCL>& pos, LocalityOrderingT ordering);
+
+/// \brief Compute the position of each DoF-block of idx.
+/// As in permute_fe_basis, blocks of NumUnknownsVertex() unknowns are considered. The
+/// position of a DoF is the barycenter of its simplex. Extended DoFs share the position
+/// of the corresponding standard DoF.
+void
+dof_block_positions (const MultiGridCL& mg, const IdxDescCL& idx, std::vector<Point3DCL>& pos);
+
+/// \brief Setup the adjacency matrix of the DoF-blocks of idx: G_ij == 1, iff the blocks i and j share a tetra.
+/// Extended DoFs are coupled to the corresponding standard DoF and its neighbors.
+void
+dof_block_graph (const MultiGridCL& mg, const IdxDescCL& idx, MatrixCL& G);
+
+/// \brief Renumber the DoF-blocks of idx with the given ordering by permute_fe_basis.
+///
+/// The returned permutation maps the old to the new block numbers. Data that is
+/// already attached to idx must be permuted by the caller, e.g. VecDescCL-objects with
+/// permute_Vector( v.Data, p, idx.NumUnknownsVertex()) and matrices with
+/// permute_rows( p, idx.NumUnknownsVertex()) and permute_columns( p, idx.NumUnknownsVertex()).
+/// A later UpdateXNumbering keeps the standard DoFs and numbers the extended DoFs anew.
+PermutationT
+locality_numbering (MultiGridCL& mg, IdxDescCL& idx, LocalityOrderingT ordering);
+
+
 } // end of namspace DROPS
 
 #include "num/renumber.tpp"
@@ -274,6 +274,7 @@ void
 sort_row_entries (SparseMatBaseCL<T>& M)
 {
     typedef std::pair<T, size_t> PT;
+    M.IncrementPatternVersion();
     for (size_t r= 0; r < M.num_rows(); ++r) {
         std::vector<PT> pv( M.row_beg( r + 1) - M.row_beg( r));
         for (size_t i= M.row_beg( r), j= 0; i < M.row_beg( r + 1); ++i, ++j)
@@ -382,9 +382,9 @@ struct BlockTraitsCL
 
     ///\brief Computes the number of non-zeroes for each row in one block-row
     static inline void row_nnz ( size_t*, size_t, size_t); // not defined
-    ///\brief Inserts one block-row in the form of double-valued rows into the matrix
+    ///\brief Inserts one block-row in the form of double-valued rows into the matrix; returns true, if a column index differs from the previous content of the column-array
     template <class Iter>
-    static inline void insert_block_row (Iter, Iter, const size_t*, size_t*, double*); // not defined
+    static inline bool insert_block_row (Iter, Iter, const size_t*, size_t*, double*); // not defined
     ///\brief Creates a pair for sorting the rows from a key-value pari stored in the hash-map.
     static inline sort_pair_type pair_copy (const std::pair<size_t, double>& p); // not defined
     ///\brief Return an entry, if the sparsity pattern is reused (only for block_type == double).
@@ -404,11 +404,14 @@ struct BlockTraitsCL<double>
     static inline void row_nnz (size_t* row_nnz_ar, size_t row, size_t num_blocks)
         { row_nnz_ar[row]= num_blocks; }
     template <class Iter>
-    static inline void insert_block_row (Iter begin, Iter end, const size_t* rb, size_t* colind, double* val) {
+    static inline bool insert_block_row (Iter begin, Iter end, const size_t* rb, size_t* colind, double* val) {
+        bool changed= false;
         for (size_t j= rb[0]; begin != end; ++begin, ++j) {
+            changed|= colind[j] != begin->first;
             colind[j]= begin->first;
             val[j]= begin->second;
         }
+        return changed;
     }
     static inline sort_pair_type pair_copy (const std::pair<size_t, double>& p)
         { return p; }
@@ -435,10 +438,12 @@ struct BlockTraitsCL< SMatrixCL<Rows, Cols> >
             row_nnz_ar[num_rows*row + k]= num_cols*num_blocks;
     }
     template <class Iter>
-    static inline void insert_block_row (Iter begin, Iter end, const size_t* rb, size_t* colind, double* val) {
+    static inline bool insert_block_row (Iter begin, Iter end, const size_t* rb, size_t* colind, double* val) {
+        bool changed= false;
         for (size_t l= 0 ; begin != end; ++begin, ++l)
             for (size_t i= 0; i < num_rows; ++i)
                 for (size_t j= 0; j < num_cols; ++j) {
+                    changed|= colind[j + l*num_cols + rb[i]] != begin->first*num_cols + j;
                     colind[j + l*num_cols + rb[i]]= begin->first*num_cols + j;
 #if DROPS_SPARSE_MAT_BUILDER_USES_HASH_MAP
                     val   [j + l*num_cols + rb[i]]= (*begin->second)( i, j);
@@ -446,6 +451,7 @@ struct BlockTraitsCL< SMatrixCL<Rows, Cols> >
                     val   [j + l*num_cols + rb[i]]= ( begin->second)( i, j);
 #endif
                 }
+        return changed;
     }
     static inline sort_pair_type pair_copy (std::pair<const size_t, block_type>& p)
         { return std::make_pair( p.first, &p.second); }
@@ -468,9 +474,11 @@ struct BlockTraitsCL< SDiagMatrixCL<Rows> >
             row_nnz_ar[num_rows*row + k]= num_blocks;
     }
     template <class Iter>
-    static inline void insert_block_row (Iter begin, Iter end, const size_t* rb, size_t* colind, double* val) {
+    static inline bool insert_block_row (Iter begin, Iter end, const size_t* rb, size_t* colind, double* val) {
+        bool changed= false;
         for (size_t l= 0 ; begin != end; ++begin, ++l)
             for (size_t i= 0; i < num_rows; ++i) {
+                changed|= colind[l + rb[i]] != begin->first*num_cols + i;
                 colind[l + rb[i]]= begin->first*num_cols + i;
 #if DROPS_SPARSE_MAT_BUILDER_USES_HASH_MAP
                 val   [l + rb[i]]= (*begin->second)( i);
@@ -478,6 +486,7 @@ struct BlockTraitsCL< SDiagMatrixCL<Rows> >
                 val   [l + rb[i]]= ( begin->second)( i);
 #endif
             }
+        return changed;
     }
     static inline sort_pair_type pair_copy (std::pair<const size_t, block_type>& p)
         { return std::make_pair( p.first, &p.second); }
@@ -568,6 +577,13 @@ void SparseMatBuilderCL<T, BlockT>::Build()
     Assert( _rows%BlockTraitT::num_rows == 0, DROPSErrCL( "SparseMatBuilderCL::Build: Number of rows does not match block-structure.\n"), DebugNumericC);
 
     const size_t block_rows= _rows/BlockTraitT::num_rows;
+    // The new pattern is compared with the old one while it is built: If it does not change, the pattern version of the matrix is retained.
+    // Only the row-begins are kept for this; the column indices are compared in place, if the number of nonzeros does not change.
+    const size_t old_pattern= _mat->pattern_version_,
+                 old_nnz= _mat->num_nonzeros();
+    const bool same_dim= _mat->num_rows() == _rows && _mat->num_cols() == _cols;
+    const std::valarray<size_t> old_rowbeg( same_dim ? _mat->_rowbeg : std::valarray<size_t>());
+    int changed= 0;
     _mat->num_rows( _rows);
     _mat->num_cols( _cols);
 
@@ -600,28 +616,68 @@ void SparseMatBuilderCL<T, BlockT>::Build()
 
 #       if DROPS_SPARSE_MAT_BUILDER_USES_HASH_MAP
             std::vector<typename BlockTraitT::sort_pair_type> pv;
-#           pragma omp for
+#           pragma omp for reduction(|:changed)
             for ( i= 0; i < block_rows; ++i) {
                 pv.resize( _coupl[i].size());
                 std::transform( _coupl[i].begin(), _coupl[i].end(), pv.begin(), &BlockTraitT::pair_copy);
                 std::sort( pv.begin(), pv.end(), less1st<typename BlockTraitT::sort_pair_type>());
-                BlockTraitT::insert_block_row( pv.begin(), pv.end(), rb + i*BlockTraitT::num_rows, _mat->raw_col(), _mat->raw_val());
+                changed|= BlockTraitT::insert_block_row( pv.begin(), pv.end(), rb + i*BlockTraitT::num_rows, _mat->raw_col(), _mat->raw_val());
                 // std::cout << _coupl[i].load_factor() << '\t' << std::setfill('0') << std::setw(3) <<_coupl[i].size() << '\n';
             }
 #       else
-            for (size_t i= 0; i < block_rows; ++i)
-                BlockTraitT::insert_block_row( _coupl[i].begin(), _coupl[i].end(), rb + i*BlockTraitT::num_rows, _mat->raw_col(), _mat->raw_val());
+#           pragma omp for reduction(|:changed)
+            for (i= 0; i < block_rows; ++i)
+                changed|= BlockTraitT::insert_block_row( _coupl[i].begin(), _coupl[i].end(), rb + i*BlockTraitT::num_rows, _mat->raw_col(), _mat->raw_val());
 #       endif
     } // end of omp parallel
     delete[] t_sum;
     delete[] _coupl;
     _coupl= 0;
+
+    if (same_dim && old_nnz == _mat->num_nonzeros() && !changed
+        && std::equal( Addr( old_rowbeg), Addr( old_rowbeg) + old_rowbeg.size(), _mat->raw_row()))
+        _mat->pattern_version_= old_pattern;
+}
+
+/// \brief Returns a new, globally unique version number for a sparsity pattern.
+inline size_t NewSparsePatternVersion()
+{
+    static size_t version= 0;
+    size_t ret;
+#   pragma omp critical(NewSparsePatternVersion)
+    ret= ++version;
+    return ret;
 }
 
+/// \brief Merged sparsity pattern of a linear combination of sparse matrices.
+/// For each operand, pos[k][nz] is the position of its nz-th entry in the result. The cache is valid, if the pattern versions of the operands and of the result match.
+struct LinCombCacheCL
+{
+    std::vector<size_t> operand_pattern; ///< pattern versions of the operands
+    size_t pattern;                      ///< pattern version of the result
+    std::vector< std::valarray<size_t> > pos;
+
+    LinCombCacheCL () : pattern( 0) {}
+};
+
+/// \brief Explicit transpose of a sparse matrix; see SparseMatBaseCL::KeepTranspose().
+template <typename T>
+struct TransposeCacheCL
+{
+    SparseMatBaseCL<T>    Mt;      ///< the transpose
+    std::valarray<size_t> src;     ///< Mt.val( nz) is the entry src[nz] of the original matrix
+    size_t                version; ///< version of the original matrix, for which Mt is valid
+    size_t                pattern; ///< pattern version of the original matrix, for which the pattern of Mt and src are valid
+
+    TransposeCacheCL () : version( 0), pattern( 0) {}
+};
+
 ///\brief  SparseMatBaseCL: compressed row storage sparse matrix
 /// Use SparseMatBuilderCL for setting up.
 ///
 /// If the size of _colind plus _val exceeds mmap_threshold, they are allocated as a single chunk with mmap. The memory management of these 2 arrays is encapsulated in the private num_nonzeros(nnz).
+///
+/// Besides version_, which changes with every modification, the matrix carries pattern_version_, which changes only if the sparsity pattern may have changed. Pattern versions are unique among all matrices; matrices with equal pattern version have equal sparsity patterns.
 template <typename T>
 class SparseMatBaseCL
 {
@@ -633,6 +689,11 @@ private:
     size_t nnz_;  ///< number of non-zeros
 
     size_t version_; ///< All modifications increment this. Starts with 1.
+    size_t pattern_version_; ///< Changes with the sparsity pattern; see NewSparsePatternVersion().
+
+    LinCombCacheCL* lincomb_cache_; ///< merged pattern of the last LinComb, which computed *this
+    bool                         keep_transp_;  ///< true, if the transpose is kept in transp_cache_; see KeepTranspose()
+    mutable TransposeCacheCL<T>* transp_cache_; ///< transpose, which is built on demand by GetTranspose()
 
     std::valarray<size_t> _rowbeg; ///< (_rows+1 entries, last entry must be <=_nz) index of first non-zero-entry in _val belonging to the row given as subscript
     std::valarray<size_t> _colind; ///< (nnz_ entries) column-number of corresponding entry in _val
@@ -644,6 +705,11 @@ private:
 
     size_t sizeof_colind_and_val() const{ return nnz_*(sizeof( T) + sizeof( size_t)); }
 
+    /// \brief Linear combination sum_k coeff[k]*M[k]; the merged pattern is cached in lincomb_cache_.
+    SparseMatBaseCL& LinComb_impl (Uint n, const double* coeff, const SparseMatBaseCL<T>* const* M);
+    void lincomb_pattern (Uint n, const SparseMatBaseCL<T>* const* M); ///< compute pattern and lincomb_cache_
+    void lincomb_values  (Uint n, const double* coeff, const SparseMatBaseCL<T>* const* M); ///< recombine values via lincomb_cache_
+
 public:
     typedef T value_type;
 
@@ -677,6 +743,18 @@ public:
 
     void IncrementVersion() { ++version_; }      ///< Increment modification version number
     size_t Version() const  { return version_; } ///< Get modification version number
+    /// \brief Call after the sparsity pattern was modified via raw_col() or raw_row(). Increments the version, too.
+    void IncrementPatternVersion() { pattern_version_= NewSparsePatternVersion(); IncrementVersion(); }
+    size_t PatternVersion() const  { return pattern_version_; } ///< Get the version number of the sparsity pattern
+
+    /// \brief Keep the explicit transpose of the matrix for transp_mul, galerkin_product and BDinvBT (default: false).
+    /// This doubles the memory of the matrix. The transpose is rebuilt, if the version of the matrix changed; hence, after writing values
+    /// via raw_val() or GetFirstVal(), IncrementVersion() must be called.
+    void KeepTranspose (bool keep= true) { keep_transp_= keep; if (!keep) { delete transp_cache_; transp_cache_= 0; } }
+    bool KeepsTranspose () const { return keep_transp_; }
+    /// \brief Returns the transpose of the matrix; only available after KeepTranspose(). It is built on the first call and kept until the matrix changes.
+    /// If only the values changed, the pattern of the transpose is reused.
+    const SparseMatBaseCL& GetTranspose() const;
 
     const size_t* GetFirstCol(size_t i) const { return Addr(_colind) + _rowbeg[i]; }
           size_t* GetFirstCol(size_t i)       { return Addr(_colind) + _rowbeg[i]; }
@@ -688,12 +766,19 @@ public:
     SparseMatBaseCL& operator*= (T c);
     SparseMatBaseCL& operator/= (T c);
 
+    ///\brief The LinComb-functions reuse the merged sparsity pattern of the previous call, if the patterns of the operands did not change.
+    /// In this case only the values are recombined.
+    SparseMatBaseCL& LinComb (double, const SparseMatBaseCL<T>&,
+                              double, const SparseMatBaseCL<T>&);
     SparseMatBaseCL& LinComb (double, const SparseMatBaseCL<T>&,
+                              double, const SparseMatBaseCL<T>&,
                               double, const SparseMatBaseCL<T>&);
     SparseMatBaseCL& LinComb (double, const SparseMatBaseCL<T>&,
+                              double, const SparseMatBaseCL<T>&,
                               double, const SparseMatBaseCL<T>&,
                               double, const SparseMatBaseCL<T>&);
     SparseMatBaseCL& LinComb (double, const SparseMatBaseCL<T>&,
+                              double, const SparseMatBaseCL<T>&,
                               double, const SparseMatBaseCL<T>&,
                               double, const SparseMatBaseCL<T>&,
                               double, const SparseMatBaseCL<T>&);
@@ -708,8 +793,10 @@ public:
     VectorBaseCL<T> GetLumpedDiag()                        const;
     VectorBaseCL<T> GetSchurDiag(const VectorBaseCL<T>& W) const; ///< returns diagonal of B W B^T
 
-    void permute_rows (const PermutationT&);
-    void permute_columns (const PermutationT&);
+    /// \brief Apply the permutation p to the rows; p acts on blocks of blocksize rows, cf. permute_Vector.
+    void permute_rows (const PermutationT& p, Uint blocksize= 1);
+    /// \brief Apply the permutation p to the columns; p acts on blocks of blocksize columns, cf. permute_Vector.
+    void permute_columns (const PermutationT& p, Uint blocksize= 1);
 
     template <class, class>
       friend class SparseMatBuilderCL;
@@ -719,6 +806,7 @@ template <typename T>
   void
   SparseMatBaseCL<T>::num_rows (size_t rows)
 {
+    pattern_version_= NewSparsePatternVersion();
     _rows= rows;
     _rowbeg.resize(rows + 1);
 }
@@ -745,30 +833,35 @@ template <typename T>
 
 template <typename T>
   SparseMatBaseCL<T>::SparseMatBaseCL ()
-    : _rows(0), _cols(0), nnz_( 0), version_(1), _rowbeg( size_t(), 1), _colind(), _val()
+    : _rows(0), _cols(0), nnz_( 0), version_(1), pattern_version_( NewSparsePatternVersion()), lincomb_cache_( 0),
+      keep_transp_( false), transp_cache_( 0), _rowbeg( size_t(), 1), _colind(), _val()
 {}
 
 template <typename T>
   SparseMatBaseCL<T>::SparseMatBaseCL (const SparseMatBaseCL& m)
     : _rows( m._rows), _cols( m._cols), nnz_( m.nnz_), version_( m.version_),
+      pattern_version_( m.pattern_version_), lincomb_cache_( 0), keep_transp_( m.keep_transp_), transp_cache_( 0),
       _rowbeg( m._rowbeg), _colind( m._colind), _val( m._val)
 {}
 
 template <typename T>
   SparseMatBaseCL<T>::~SparseMatBaseCL ()
-{}
+{
+    delete lincomb_cache_;
+    delete transp_cache_;
+}
 
 template <typename T>
   SparseMatBaseCL<T>::SparseMatBaseCL (size_t rows, size_t cols, size_t nnz)
-    : _rows( rows), _cols( cols), nnz_( nnz), version_( 1),
-      _rowbeg( rows+1), _colind( nnz), _val( nnz)
+    : _rows( rows), _cols( cols), nnz_( nnz), version_( 1), pattern_version_( NewSparsePatternVersion()),
+      lincomb_cache_( 0), keep_transp_( false), transp_cache_( 0), _rowbeg( rows+1), _colind( nnz), _val( nnz)
 {}
 
 
 template <typename T>
   SparseMatBaseCL<T>::SparseMatBaseCL(const std::valarray<T>& v)
-      : _rows( v.size()), _cols( v.size()), nnz_( 0), version_( 1),
-        _rowbeg( v.size() + 1), _colind( 0), _val( 0)
+      : _rows( v.size()), _cols( v.size()), nnz_( 0), version_( 1), pattern_version_( NewSparsePatternVersion()),
+        lincomb_cache_( 0), keep_transp_( false), transp_cache_( 0), _rowbeg( v.size() + 1), _colind( 0), _val( 0)
 {
     num_nonzeros( v.size());
     for (size_t i= 0; i < _rows; ++i)
@@ -787,6 +880,8 @@ template <typename T>
     _colind = m._colind;
     _rowbeg = m._rowbeg;
     _val    = m._val;
+    pattern_version_= m.pattern_version_;
+    IncrementVersion();
     return *this;
 }
 
@@ -869,17 +964,57 @@ VectorBaseCL<T> SparseMatBaseCL<T>::GetSchurDiag( const VectorBaseCL<T>& W) cons
 }
 
 
+template <typename T>
+const SparseMatBaseCL<T>& SparseMatBaseCL<T>::GetTranspose() const
+{
+    if (!keep_transp_)
+        throw DROPSErrCL( "SparseMatBaseCL::GetTranspose: The transpose is not kept; call KeepTranspose() first.\n");
+
+#   pragma omp critical(GetTranspose)
+    {
+    if (transp_cache_ == 0)
+        transp_cache_= new TransposeCacheCL<T>;
+    TransposeCacheCL<T>& cache= *transp_cache_;
+    if (cache.version != version_) {
+    if (cache.pattern != pattern_version_) {
+        Comment( "GetTranspose: Creating NEW transpose" << std::endl, DebugNumericC);
+        transpose( *this, cache.Mt, &cache.src);
+        cache.pattern= pattern_version_;
+    }
+    else {
+        Comment( "GetTranspose: Reusing OLD pattern" << std::endl, DebugNumericC);
+        cache.Mt.IncrementVersion();
+        T* val= cache.Mt.raw_val();
+        const size_t* src= Addr( cache.src);
+#ifndef DROPS_WIN
+        size_t nz;
+#else
+        int nz;
+#endif
+#       pragma omp parallel for
+        for (nz= 0; nz < nnz_; ++nz)
+            val[nz]= _val[src[nz]];
+    }
+    cache.version= version_;
+    }
+    } // end of omp critical
+    return transp_cache_->Mt;
+}
+
 template <typename T>
   void
-  SparseMatBaseCL<T>::permute_rows (const PermutationT& p)
+  SparseMatBaseCL<T>::permute_rows (const PermutationT& p, Uint blocksize)
 {
     if (p.empty()) return;
 
-    Assert( num_rows() == p.size(),
+    Assert( num_rows() == p.size()*blocksize,
         DROPSErrCL( "permute_rows: Matrix and Permutation have different dimension.\n"), DebugNumericC);
 
-    IncrementVersion();
-    PermutationT pi( invert_permutation( p));
+    IncrementPatternVersion();
+    PermutationT pi( num_rows());
+    for (size_t i= 0; i < p.size(); ++i)
+        for (Uint c= 0; c < blocksize; ++c)
+            pi[blocksize*p[i] + c]= blocksize*i + c;
     SparseMatBaseCL<T> tmp( *this);
 
     _rowbeg[0]= 0;
@@ -892,16 +1027,16 @@ template <typename T>
 
 template <typename T>
   void
-  SparseMatBaseCL<T>::permute_columns (const PermutationT& p)
+  SparseMatBaseCL<T>::permute_columns (const PermutationT& p, Uint blocksize)
 {
     if (p.empty()) return;
 
-    Assert( num_cols() == p.size(),
+    Assert( num_cols() == p.size()*blocksize,
         DROPSErrCL( "permute_columns: Matrix and Permutation have different dimension.\n"), DebugNumericC);
 
-    IncrementVersion();
+    IncrementPatternVersion();
     for (size_t i= 0; i < nnz_; ++i)
-        _colind[i]= p[_colind[i]];
+        _colind[i]= blocksize*p[_colind[i]/blocksize] + _colind[i]%blocksize;
 
     // Sort the indices in each row. This affects the internal matrix-layout only.
     typedef std::pair<size_t, T> PT;
@@ -1171,59 +1306,85 @@ void ortho( VectorBaseCL<T>& v, const VectorBaseCL<T>& k, const SparseMatBaseCL<
     v-= alpha*k;
 }
 
-/// \brief Compute the linear combination of two sparse matrices efficiently.
-/// The new sparsity pattern is computed by merging the lists of _colind (removing the duplicates) row by row.
+/// \brief Compute the linear combination of n sparse matrices.
+/// If the pattern versions of the operands equal those of the previous call and the pattern of *this was not changed in between, only the values are recombined on the cached merged pattern.
+/// Otherwise, the merged pattern and the position of each operand entry in it are computed and cached.
+/// If *this is one of the operands, the combination is computed in a temporary.
 /// \todo Das alte Pattern wiederzuverwenden, macht mal wieder Aerger:
 ///   Zur Zeit (2.2008) mit der Matrix im NS-Loeser nach Gitteraenderungen, die
 ///   die Anzahl der Unbekannten nicht aendert. Daher schalten wir die
 ///   Wiederverwendung vorerst global aus.
 template <typename T>
-SparseMatBaseCL<T>& SparseMatBaseCL<T>::LinComb (double coeffA, const SparseMatBaseCL<T>& A,
-                                                 double coeffB, const SparseMatBaseCL<T>& B)
+SparseMatBaseCL<T>& SparseMatBaseCL<T>::LinComb_impl (Uint n, const double* coeff, const SparseMatBaseCL<T>* const* M)
 {
-    Assert( A.num_rows()==B.num_rows() && A.num_cols()==B.num_cols(),
+    for (Uint k= 0; k < n; ++k) {
+        Assert( M[0]->num_rows()==M[k]->num_rows() && M[0]->num_cols()==M[k]->num_cols(),
             "LinComb: incompatible dimensions", DebugNumericC);
+        if (M[k] == this) {
+            SparseMatBaseCL<T> tmp;
+            tmp.LinComb_impl( n, coeff, M);
+            return *this= tmp;
+        }
+    }
+
+    bool reuse= lincomb_cache_ != 0 && lincomb_cache_->pattern == pattern_version_
+        && lincomb_cache_->operand_pattern.size() == n;
+    for (Uint k= 0; reuse && k < n; ++k)
+        reuse= lincomb_cache_->operand_pattern[k] == M[k]->PatternVersion();
+
+    if (reuse) {
+        Comment( "LinComb: Reusing OLD pattern" << std::endl, DebugNumericC);
+        IncrementVersion();
+    }
+    else {
+        Comment( "LinComb: Creating NEW matrix" << std::endl, DebugNumericC);
+        lincomb_pattern( n, M);
+    }
+    lincomb_values( n, coeff, M);
+    return *this;
+}
 
+template <typename T>
+void SparseMatBaseCL<T>::lincomb_pattern (Uint n, const SparseMatBaseCL<T>* const* M)
+{
     IncrementVersion();
-    Comment( "LinComb: Creating NEW matrix" << std::endl, DebugNumericC);
-    num_rows( A.num_rows());
-    num_cols( A.num_cols());
+    num_rows( M[0]->num_rows());
+    num_cols( M[0]->num_cols());
     _rowbeg[0]= 0;
+
+    if (lincomb_cache_ == 0)
+        lincomb_cache_= new LinCombCacheCL;
+    LinCombCacheCL& cache= *lincomb_cache_;
+    cache.operand_pattern.resize( n);
+    cache.pos.resize( n);
+    for (Uint k= 0; k < n; ++k) {
+        cache.operand_pattern[k]= M[k]->PatternVersion();
+        cache.pos[k].resize( M[k]->num_nonzeros());
+    }
+
 #ifdef _OPENMP
     size_t* t_sum= new size_t[omp_get_max_threads()];
 #else
     size_t* t_sum= new size_t[1];
 #endif
 
+#ifndef DROPS_WIN
+    size_t row;
+#else
+    int row;
+#endif
+
 #   pragma omp parallel
     {
+        std::vector<size_t> cols;
         // Compute the entries of _rowbeg (that is the number of nonzeros in each row of the result)
-        size_t i;
-        const size_t* rA;
-        const size_t* rB;
-#ifndef DROPS_WIN
-#       pragma omp for
-        for (size_t row= 0; row < A.num_rows(); ++row) 
-#else
 #       pragma omp for
-        for (int row= 0; row < (int)A.num_rows(); ++row) 
-#endif
-        {
-            i= 0;
-            rA= A.GetFirstCol( row);
-            rB= B.GetFirstCol( row);
-            const size_t* const rAend= A.GetFirstCol( row + 1);
-            const size_t* const rBend= B.GetFirstCol( row + 1);
-            for (; rA != rAend && rB != rBend; ++i)
-                if (*rB < *rA)
-                    ++rB;
-                else if (*rA < *rB)
-                    ++rA;
-                else {
-                    ++rA;
-                    ++rB;
-                }
-            _rowbeg[row + 1]= i + (rAend - rA) + (rBend - rB);
+        for (row= 0; row < num_rows(); ++row) {
+            cols.clear();
+            for (Uint k= 0; k < n; ++k)
+                cols.insert( cols.end(), M[k]->GetFirstCol( row), M[k]->GetFirstCol( row + 1));
+            std::sort( cols.begin(), cols.end());
+            _rowbeg[row + 1]= std::unique( cols.begin(), cols.end()) - cols.begin();
         }
 
         inplace_parallel_partial_sum( Addr(_rowbeg), Addr(_rowbeg) + num_rows() + 1, t_sum);
@@ -1231,48 +1392,62 @@ SparseMatBaseCL<T>& SparseMatBaseCL<T>::LinComb (double coeffA, const SparseMatB
 #       pragma omp master
             num_nonzeros( row_beg( num_rows()));
 #       pragma omp barrier
-        // Compute the entries of _colind, _val (actual merge).
-        size_t iA, iB;
+        // Compute the entries of _colind and the positions of the operand entries in the result.
+#       pragma omp for
+        for (row= 0; row < num_rows(); ++row) {
+            size_t* const rbegin= GetFirstCol( row);
+            size_t* const rend= GetFirstCol( row + 1);
+            cols.clear();
+            for (Uint k= 0; k < n; ++k)
+                cols.insert( cols.end(), M[k]->GetFirstCol( row), M[k]->GetFirstCol( row + 1));
+            std::sort( cols.begin(), cols.end());
+            std::unique_copy( cols.begin(), cols.end(), rbegin);
+            for (Uint k= 0; k < n; ++k) {
+                // The columns of M[k] are a sorted subsequence of the result-row.
+                const size_t* r= rbegin;
+                for (size_t nz= M[k]->row_beg( row); nz < M[k]->row_beg( row + 1); ++nz) {
+                    r= std::lower_bound( r, const_cast<const size_t*>( rend), M[k]->col_ind( nz));
+                    cache.pos[k][nz]= r - Addr( _colind);
+                }
+            }
+        }
+    } //end of omp parallel
+    delete [] t_sum;
+    cache.pattern= pattern_version_;
+}
+
+template <typename T>
+void SparseMatBaseCL<T>::lincomb_values (Uint n, const double* coeff, const SparseMatBaseCL<T>* const* M)
+{
+    const LinCombCacheCL& cache= *lincomb_cache_;
 
 #ifndef DROPS_WIN
-        #pragma omp for
-        for (size_t row= 0; row < A.num_rows(); ++row) 
+    size_t row;
 #else
-        #pragma omp for
-        for (int row= 0; row < (int)A.num_rows(); ++row) 
+    int row;
 #endif
-        { // same structure as above
-            i=    row_beg( row);
-            iA= A.row_beg( row);
-            iB= B.row_beg( row);
-            const size_t rAend= A.row_beg( row + 1),
-                         rBend= B.row_beg( row + 1);
-            for (; iA != rAend && iB != rBend; ++i)
-                if (B.col_ind( iB) < A.col_ind( iA)) {
-                    _val[i]= coeffB*B._val[iB];
-                    _colind[i]= B._colind[iB++];
-                }
-                else if (A.col_ind( iA) < B.col_ind( iB)) {
-                    _val[i]= coeffA*A._val[iA];
-                    _colind[i]= A._colind[iA++];
-                }
-                else {
-                    _val[i]= coeffA*A._val[iA++] + coeffB*B._val[iB];
-                    _colind[i]= B._colind[iB++];
-                }
-            // At most one of A or B might have entries left.
-            std::copy( Addr(B._colind) + iB, Addr(B._colind) + rBend,
-                       std::copy( Addr(A._colind) + iA, Addr(A._colind) + rAend, Addr(_colind) + i));
-            for (; iA < rAend; ++iA, ++i)
-                _val[i]= coeffA*A._val[iA];
-            for (; iB < rBend; ++iB, ++i)
-                _val[i]= coeffB*B._val[iB];
+
+#   pragma omp parallel for
+    for (row= 0; row < num_rows(); ++row) {
+        std::fill( GetFirstVal( row), GetFirstVal( row + 1), T());
+        for (Uint k= 0; k < n; ++k) {
+            const size_t* const pos= Addr( cache.pos[k]);
+            const T* const val= M[k]->raw_val();
+            for (size_t nz= M[k]->row_beg( row); nz < M[k]->row_beg( row + 1); ++nz)
+                _val[pos[nz]]+= coeff[k]*val[nz];
         }
-    } //end of omp parallel
-    delete [] t_sum;
-    return *this;
+    }
 }
 
+/// \brief Compute the linear combination of two sparse matrices.
+template <typename T>
+SparseMatBaseCL<T>& SparseMatBaseCL<T>::LinComb (double coeffA, const SparseMatBaseCL<T>& A,
+                                                 double coeffB, const SparseMatBaseCL<T>& B)
+{
+    const double coeff[]= { coeffA, coeffB };
+    const SparseMatBaseCL<T>* const M[]= { &A, &B };
+    return LinComb_impl( 2, coeff, M);
+}
 
 /// \brief Compute the linear combination of three sparse matrices.
 template <typename T>
@@ -1280,9 +1455,9 @@ SparseMatBaseCL<T>& SparseMatBaseCL<T>::LinComb (double coeffA, const SparseMatB
                                                  double coeffB, const SparseMatBaseCL<T>& B,
                                                  double coeffC, const SparseMatBaseCL<T>& C)
 {
-    SparseMatBaseCL<T> tmp;
-    tmp.LinComb( coeffA, A, coeffB, B);
-    return this->LinComb( 1.0, tmp, coeffC, C);
+    const double coeff[]= { coeffA, coeffB, coeffC };
+    const SparseMatBaseCL<T>* const M[]= { &A, &B, &C };
+    return LinComb_impl( 3, coeff, M);
 }
 
 /// \brief Compute the linear combination of four sparse matrices.
@@ -1292,9 +1467,22 @@ SparseMatBaseCL<T>& SparseMatBaseCL<T>::LinComb (double coeffA, const SparseMatB
                                                  double coeffC, const SparseMatBaseCL<T>& C,
                                                  double coeffD, const SparseMatBaseCL<T>& D)
 {
-    SparseMatBaseCL<T> tmp;
-    tmp.LinComb( coeffA, A, coeffB, B, coeffC, C);
-    return this->LinComb( 1.0, tmp, coeffD, D);
+    const double coeff[]= { coeffA, coeffB, coeffC, coeffD };
+    const SparseMatBaseCL<T>* const M[]= { &A, &B, &C, &D };
+    return LinComb_impl( 4, coeff, M);
+}
+
+/// \brief Compute the linear combination of five sparse matrices.
+template <typename T>
+SparseMatBaseCL<T>& SparseMatBaseCL<T>::LinComb (double coeffA, const SparseMatBaseCL<T>& A,
+                                                 double coeffB, const SparseMatBaseCL<T>& B,
+                                                 double coeffC, const SparseMatBaseCL<T>& C,
+                                                 double coeffD, const SparseMatBaseCL<T>& D,
+                                                 double coeffE, const SparseMatBaseCL<T>& E)
+{
+    const double coeff[]= { coeffA, coeffB, coeffC, coeffD, coeffE };
+    const SparseMatBaseCL<T>* const M[]= { &A, &B, &C, &D, &E };
+    return LinComb_impl( 5, coeff, M);
 }
 
 /// \brief Inserts v as column c. The old columns [c, num_cols()) are shifted to the right.
@@ -1311,7 +1499,7 @@ SparseMatBaseCL<T>::insert_col (size_t c, const VectorBaseCL<T>& v)
                  nnz= v.size() - numzero;
     size_t       zerocount= 0,
                  shift= 1;
-    IncrementVersion();
+    IncrementPatternVersion();
     // These will become the new data-arrays of the matrix.
     std::valarray<size_t> rowbeg( num_rows() + 1);
     std::valarray<size_t> colind( num_nonzeros() + nnz);
@@ -1364,17 +1552,32 @@ SparseMatBaseCL<T>::insert_col (size_t c, const VectorBaseCL<T>& v)
 
 
 /// \brief Compute the transpose matrix of M explicitly.
-/// This could be handled more memory-efficient by exploiting
-/// that the column-indices in the rows of M are ascending.
+/// The entries are distributed to the rows of Mt by a counting sort over the column indices of M. As the rows of M are traversed in ascending order, the column indices in the rows of Mt are ascending.
+/// If src is given, it receives for each entry of Mt the position of the corresponding entry in M.
 template <typename T>
 void
-transpose (const SparseMatBaseCL<T>& M, SparseMatBaseCL<T>& Mt)
+transpose (const SparseMatBaseCL<T>& M, SparseMatBaseCL<T>& Mt, std::valarray<size_t>* src= 0)
 {
-    SparseMatBuilderCL<T> Tr( &Mt, M.num_cols(), M.num_rows());
+    Mt.resize( M.num_cols(), M.num_rows(), M.num_nonzeros());
+    size_t* rb= Mt.raw_row();
+    std::fill( rb, rb + M.num_cols() + 1, 0);
+    for (size_t nz= 0; nz < M.num_nonzeros(); ++nz)
+        ++rb[M.col_ind( nz) + 1];
+    std::partial_sum( rb, rb + M.num_cols() + 1, rb);
+
+    if (src != 0)
+        src->resize( M.num_nonzeros());
+    std::vector<size_t> next( rb, rb + M.num_cols());
+    size_t* col= Mt.raw_col();
+    T* val= Mt.raw_val();
     for (size_t i= 0; i< M.num_rows(); ++i)
-        for (size_t nz= M.row_beg( i); nz < M.row_beg( i + 1); ++nz)
-            Tr( M.col_ind( nz), i)= M.val( nz);
-    Tr.Build();
+        for (size_t nz= M.row_beg( i); nz < M.row_beg( i + 1); ++nz) {
+            const size_t pos= next[M.col_ind( nz)]++;
+            col[pos]= i;
+            val[pos]= M.val( nz);
+            if (src != 0)
+                (*src)[pos]= nz;
+        }
 }
 
 
@@ -1400,6 +1603,250 @@ BBTDiag (const SparseMatBaseCL<T>& B /*, const VectorBaseCL<T>& Mdiaginv*/)
 }
 
 
+//*****************************************************************************
+//
+//  Sparse matrix-matrix products
+//
+//*****************************************************************************
+
+/// \brief Row-wise enumeration of the terms of A*B for the SpGEMM-kernels.
+/// For row i, acc( j, v) is called for each term v contributing to (A*B)_ij.
+template <typename T>
+class MatMulRowsCL
+{
+  private:
+    const SparseMatBaseCL<T>& A_;
+    const SparseMatBaseCL<T>& B_;
+
+  public:
+    MatMulRowsCL (const SparseMatBaseCL<T>& A, const SparseMatBaseCL<T>& B)
+        : A_( A), B_( B) {
+        Assert( A.num_cols() == B.num_rows(), "MatMulRowsCL: incompatible dimensions", DebugNumericC);
+    }
+
+    size_t num_rows () const { return A_.num_rows(); }
+    size_t num_cols () const { return B_.num_cols(); }
+
+    template <class AccT>
+    void visit_row (size_t i, AccT& acc) const {
+        for (size_t nzA= A_.row_beg( i); nzA < A_.row_beg( i + 1); ++nzA) {
+            const size_t k= A_.col_ind( nzA);
+            const T a= A_.val( nzA);
+            for (size_t nzB= B_.row_beg( k); nzB < B_.row_beg( k + 1); ++nzB)
+                acc( B_.col_ind( nzB), a*B_.val( nzB));
+        }
+    }
+};
+
+/// \brief Row-wise enumeration of the terms of R*A*P for the SpGEMM-kernels.
+/// The product is evaluated without forming R*A or A*P explicitly.
+template <typename T>
+class TripleProductRowsCL
+{
+  private:
+    const SparseMatBaseCL<T>& R_;
+    const SparseMatBaseCL<T>& A_;
+    const SparseMatBaseCL<T>& P_;
+
+  public:
+    TripleProductRowsCL (const SparseMatBaseCL<T>& R, const SparseMatBaseCL<T>& A, const SparseMatBaseCL<T>& P)
+        : R_( R), A_( A), P_( P) {
+        Assert( R.num_cols() == A.num_rows() && A.num_cols() == P.num_rows(),
+            "TripleProductRowsCL: incompatible dimensions", DebugNumericC);
+    }
+
+    size_t num_rows () const { return R_.num_rows(); }
+    size_t num_cols () const { return P_.num_cols(); }
+
+    template <class AccT>
+    void visit_row (size_t i, AccT& acc) const {
+        for (size_t nzR= R_.row_beg( i); nzR < R_.row_beg( i + 1); ++nzR) {
+            const size_t k= R_.col_ind( nzR);
+            const T r= R_.val( nzR);
+            for (size_t nzA= A_.row_beg( k); nzA < A_.row_beg( k + 1); ++nzA) {
+                const size_t l= A_.col_ind( nzA);
+                const T ra= r*A_.val( nzA);
+                for (size_t nzP= P_.row_beg( l); nzP < P_.row_beg( l + 1); ++nzP)
+                    acc( P_.col_ind( nzP), ra*P_.val( nzP));
+            }
+        }
+    }
+};
+
+/// \brief Collects the column indices of one row of a sparse product (symbolic phase).
+/// The marker array holds for each column the number of the last call of begin_row, in which it was seen.
+/// The number of the call is used instead of the row, as a row may be visited twice.
+template <typename T>
+class SpGEMMPatternAccCL
+{
+  private:
+    std::vector<size_t> marker_;
+    std::vector<size_t> cols_;
+    size_t row_;
+
+  public:
+    SpGEMMPatternAccCL (size_t num_cols)
+        : marker_( num_cols, 0), row_( 0) {}
+
+    void begin_row (size_t) { ++row_; cols_.clear(); }
+    void operator() (size_t j, const T&) {
+        if (marker_[j] != row_) {
+            marker_[j]= row_;
+            cols_.push_back( j);
+        }
+    }
+    std::vector<size_t>& cols () { return cols_; }
+};
+
+/// \brief Accumulates the values of one row of a sparse product in a dense array (numeric phase).
+template <typename T>
+class SpGEMMValueAccCL
+{
+  private:
+    std::vector<T> acc_;
+
+  public:
+    SpGEMMValueAccCL (size_t num_cols)
+        : acc_( num_cols, T()) {}
+
+    void operator() (size_t j, T v) { acc_[j]+= v; }
+    /// \brief Returns the accumulated value in column j and resets it to zero.
+    T extract (size_t j) { const T v= acc_[j]; acc_[j]= T(); return v; }
+};
+
+/// \brief Symbolic phase of a sparse product: C receives the sparsity pattern of the product described by rows.
+/// The values of C are set to zero.
+template <typename T, class RowsT>
+void
+spgemm_pattern (const RowsT& rows, SparseMatBaseCL<T>& C)
+{
+    const size_t num_rows= rows.num_rows();
+    std::vector<size_t> rb( num_rows + 1);
+    rb[0]= 0;
+#ifdef _OPENMP
+    size_t* t_sum= new size_t[omp_get_max_threads()];
+#else
+    size_t* t_sum= new size_t[1];
+#endif
+
+#ifndef DROPS_WIN
+    size_t i;
+#else
+    int i;
+#endif
+
+#   pragma omp parallel
+    {
+        SpGEMMPatternAccCL<T> acc( rows.num_cols());
+#       pragma omp for
+        for (i= 0; i < num_rows; ++i) {
+            acc.begin_row( i);
+            rows.visit_row( i, acc);
+            rb[i + 1]= acc.cols().size();
+        }
+        inplace_parallel_partial_sum( rb.begin(), rb.end(), t_sum);
+#       pragma omp barrier
+#       pragma omp master
+        {
+            C.resize( num_rows, rows.num_cols(), rb[num_rows]);
+            std::copy( rb.begin(), rb.end(), C.raw_row());
+        }
+#       pragma omp barrier
+#       pragma omp for
+        for (i= 0; i < num_rows; ++i) {
+            acc.begin_row( i);
+            rows.visit_row( i, acc);
+            std::sort( acc.cols().begin(), acc.cols().end());
+            std::copy( acc.cols().begin(), acc.cols().end(), C.GetFirstCol( i));
+            std::fill( C.GetFirstVal( i), C.GetFirstVal( i + 1), T());
+        }
+    } // end of omp parallel
+    delete[] t_sum;
+}
+
+/// \brief Numeric phase of a sparse product: The values of C are computed for the existing sparsity pattern of C.
+/// The pattern of C must contain the pattern of the product, e.g. from a previous call of spgemm_pattern.
+template <typename T, class RowsT>
+void
+spgemm_values (const RowsT& rows, SparseMatBaseCL<T>& C)
+{
+    Assert( C.num_rows() == rows.num_rows() && C.num_cols() == rows.num_cols(),
+        "spgemm_values: pattern has incompatible dimensions", DebugNumericC);
+    C.IncrementVersion();
+    const size_t num_rows= rows.num_rows();
+
+#ifndef DROPS_WIN
+    size_t i;
+#else
+    int i;
+#endif
+
+#   pragma omp parallel
+    {
+        SpGEMMValueAccCL<T> acc( rows.num_cols());
+#       pragma omp for
+        for (i= 0; i < num_rows; ++i) {
+            rows.visit_row( i, acc);
+            const size_t* col= C.GetFirstCol( i);
+            T* val= C.GetFirstVal( i);
+            for (size_t nz= C.row_beg( i); nz < C.row_beg( i + 1); ++nz)
+                *val++= acc.extract( *col++);
+        }
+    } // end of omp parallel
+}
+
+/// \brief Computes C= A*B (Gustavson's algorithm, two passes).
+/// If reuse_pattern is true, the sparsity pattern of C is kept and only the values are recomputed.
+template <typename T>
+void
+mat_mul (const SparseMatBaseCL<T>& A, const SparseMatBaseCL<T>& B, SparseMatBaseCL<T>& C, bool reuse_pattern= false)
+{
+    const MatMulRowsCL<T> rows( A, B);
+    if (!reuse_pattern)
+        spgemm_pattern( rows, C);
+    spgemm_values( rows, C);
+}
+
+/// \brief Computes C= R*A*P in one pass over the rows of R.
+/// If reuse_pattern is true, the sparsity pattern of C is kept and only the values are recomputed.
+template <typename T>
+void
+triple_product (const SparseMatBaseCL<T>& R, const SparseMatBaseCL<T>& A, const SparseMatBaseCL<T>& P,
+    SparseMatBaseCL<T>& C, bool reuse_pattern= false)
+{
+    const TripleProductRowsCL<T> rows( R, A, P);
+    if (!reuse_pattern)
+        spgemm_pattern( rows, C);
+    spgemm_values( rows, C);
+}
+
+/// \brief Computes the Galerkin product C= P^T*A*P, e.g. a coarse grid operator.
+/// If reuse_pattern is true, the sparsity pattern of C is kept and only the values are recomputed.
+template <typename T>
+void
+galerkin_product (const SparseMatBaseCL<T>& P, const SparseMatBaseCL<T>& A, SparseMatBaseCL<T>& C, bool reuse_pattern= false)
+{
+    SparseMatBaseCL<T> Pt;
+    if (!P.KeepsTranspose())
+        transpose( P, Pt);
+    triple_product( P.KeepsTranspose() ? P.GetTranspose() : Pt, A, P, C, reuse_pattern);
+}
+
+/// \brief Computes S= B*diag(Dinv)*B^T explicitly, e.g. the Schur complement approximation with Dinv= 1/diag(A).
+/// If reuse_pattern is true, the sparsity pattern of S is kept and only the values are recomputed.
+template <typename T>
+void
+BDinvBT (const SparseMatBaseCL<T>& B, const VectorBaseCL<T>& Dinv, SparseMatBaseCL<T>& S, bool reuse_pattern= false)
+{
+    Assert( B.num_cols() == Dinv.size(), "BDinvBT: incompatible dimensions", DebugNumericC);
+    const SparseMatBaseCL<T> D( Dinv);
+    SparseMatBaseCL<T> Bt;
+    if (!B.KeepsTranspose())
+        transpose( B, Bt);
+    triple_product( B, D, B.KeepsTranspose() ? B.GetTranspose() : Bt, S, reuse_pattern);
+}
+
+
 // y= A*x
 // fails, if num_rows==0.
 // Assumes, that none of the arrays involved do alias.
@@ -1470,11 +1917,16 @@ y_ATx(T* __restrict y,
     } while (--num_rows > 0);
 }
 
+/// \brief Returns A^T*x.
+/// If A keeps its transpose (see SparseMatBaseCL::KeepTranspose()), the product is computed row-wise (and in parallel) with it.
 template <typename _MatEntry, typename _VecEntry>
 VectorBaseCL<_VecEntry> transp_mul (const SparseMatBaseCL<_MatEntry>& A, const VectorBaseCL<_VecEntry>& x)
 {
-    VectorBaseCL<_VecEntry> ret( A.num_cols());
     Assert( A.num_rows()==x.size(), "transp_mul: incompatible dimensions", DebugNumericC);
+    if (A.KeepsTranspose())
+        return A.GetTranspose()*x;
+
+    VectorBaseCL<_VecEntry> ret( A.num_cols());
     y_ATx( &ret[0],
            A.num_rows(),
            A.raw_val(),
@@ -1562,6 +2014,10 @@ class MLSparseMatBaseCL : public MLDataCL<SparseMatBaseCL<T> >
     MLSparseMatBaseCL<T>& LinComb (double ma, const MLSparseMatBaseCL<T>& A,
                                    double mb, const MLSparseMatBaseCL<T>& B,
                                    double mc, const MLSparseMatBaseCL<T>& C);
+    MLSparseMatBaseCL<T>& LinComb (double ma, const MLSparseMatBaseCL<T>& A,
+                                   double mb, const MLSparseMatBaseCL<T>& B,
+                                   double mc, const MLSparseMatBaseCL<T>& C,
+                                   double md, const MLSparseMatBaseCL<T>& D);
 
     VectorBaseCL<T> GetDiag() const { return this->GetFinest().GetDiag(); }
     void clear() { for (ML_iterator it = this->begin(); it != this->end(); ++it) it->clear();}
@@ -1573,12 +2029,10 @@ MLSparseMatBaseCL<T>& MLSparseMatBaseCL<T>::LinComb (double ma, const MLSparseMa
     Assert( A.size()==B.size(), "MLMatrixCL::LinComb: different number of levels", DebugNumericC);
     ML_const_iterator itA = A.begin();
     ML_const_iterator itB = B.begin();
-    SparseMatBaseCL<T> mat;
     this->resize( A.size());
     for (ML_iterator it = this->begin(); it != this->end(); ++it)
     {
-        mat.LinComb( ma, *itA, mb, *itB);
-        *it = mat;
+        it->LinComb( ma, *itA, mb, *itB);
         ++itA;
         ++itB;
     }
@@ -1593,15 +2047,35 @@ MLSparseMatBaseCL<T>& MLSparseMatBaseCL<T>::LinComb (double ma, const MLSparseMa
     ML_const_iterator itA = A.begin();
     ML_const_iterator itB = B.begin();
     ML_const_iterator itC = C.begin();
-    SparseMatBaseCL<T> mat;
     this->resize( A.size());
     for (ML_iterator it = this->begin(); it != this->end(); ++it)
     {
-        mat.LinComb( ma, *itA, mb, *itB, mc, *itC);
-        *it = mat;
+        it->LinComb( ma, *itA, mb, *itB, mc, *itC);
+        ++itA;
+        ++itB;
+        ++itC;
+    }
+    return *this;
+}
+
+template <typename T>
+MLSparseMatBaseCL<T>& MLSparseMatBaseCL<T>::LinComb (double ma, const MLSparseMatBaseCL<T>& A, double mb, const MLSparseMatBaseCL<T>& B, double mc, const MLSparseMatBaseCL<T>& C, double md, const MLSparseMatBaseCL<T>& D)
+{
+    Assert( A.size()==B.size(), "MLMatrixCL::LinComb: different number of levels", DebugNumericC);
+    Assert( A.size()==C.size(), "MLMatrixCL::LinComb: different number of levels", DebugNumericC);
+    Assert( A.size()==D.size(), "MLMatrixCL::LinComb: different number of levels", DebugNumericC);
+    ML_const_iterator itA = A.begin();
+    ML_const_iterator itB = B.begin();
+    ML_const_iterator itC = C.begin();
+    ML_const_iterator itD = D.begin();
+    this->resize( A.size());
+    for (ML_iterator it = this->begin(); it != this->end(); ++it)
+    {
+        it->LinComb( ma, *itA, mb, *itB, mc, *itC, md, *itD);
         ++itA;
         ++itB;
         ++itC;
+        ++itD;
     }
     return *this;
 }
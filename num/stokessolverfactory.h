@@ -398,6 +398,10 @@ StokesSolverFactoryCL<StokesT, ProlongationVelT, ProlongationPT>::
         gcrsolver_( DiagGMResMinCommPc_, 500, 500, 1e-6, true), coarse_blockgcrsolver_(gcrsolver_),
         vankasmoother_( 0, 0.8, &Stokes.pr_idx)
 {
+    // optional: Galerkin coarse matrices P^T A P for the multigrid preconditioners of A, assembled B D^{-1} B^T for BDinvBTPreCL
+    MGSolversymm_.SetGalerkin( P.get<int>("Stokes.GalerkinMG", 0) != 0);
+    MGSolver_.SetGalerkin( P.get<int>("Stokes.GalerkinMG", 0) != 0);
+    bdinvbtispc_.SetExplicit( P.get<int>("Stokes.ExplicitSchur", 0) != 0);
     apc_= CreateAPc();
     spc_= CreateSPc();
 }
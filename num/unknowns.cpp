@@ -31,16 +31,7 @@ namespace DROPS
 {
 
 
-UnknownIdxCL::UnknownIdxCL( const UnknownIdxCL& orig)
-    : _Idx( orig._Idx) {}
-
-
-UnknownIdxCL& UnknownIdxCL::operator=( const UnknownIdxCL& rhs)
-{
-    if(&rhs == this) return *this;
-    _Idx= rhs._Idx;
-    return *this;
-}
+const Uint UnknownTableCL::NoSlot= std::numeric_limits<Uint>::max();
 
 
 } // end of namespace DROPS
@@ -27,6 +27,7 @@
 #define DROPS_UNKNOWNS_H
 
 #include "misc/utils.h"
+#include <algorithm>
 #include <limits>
 #include <vector>
 
@@ -46,82 +47,179 @@ typedef Ulint IdxT;
 const IdxT NoIdx= std::numeric_limits<IdxT>::max();
 
 
-/// Implementation-detail of UnknownHandleCL.
-class UnknownIdxCL
+/// \brief Dense storage of the unknown-indices of the simplices of one type; implementation-detail of UnknownHandleCL.
+///
+/// Each simplex, which carries unknowns, holds a compact slot-number. There is one
+/// table per simplex type (vertex, edge, face, tetra), see Instance(); in each, there
+/// is one array per system number (the index of an IdxDescCL), which is indexed by
+/// the slot-number. Thus, a lookup is a single array access instead of following a
+/// pointer to a separately allocated index-vector on every simplex. Slots of
+/// destroyed simplices are recycled.
+///
+/// The arrays consist of blocks of BlockSizeC indices, which are never moved; thus,
+/// growing a system does not invalidate references to its indices. Within a parallel
+/// region, all modifications of the tables are locked; lookups are not.
+class UnknownTableCL
 {
-  private:
-    std::vector<IdxT> _Idx;
-#ifdef _PAR
-    // This flag array is used for remembering if an unknowns has just been received
-    // or if the unknown has been exist before the refinement and migration
-    // algorithm has been performed. (sorry for the missleading name giving)
-    mutable std::vector<bool> UnkRecieved_;
-#endif
-
   public:
-    UnknownIdxCL( Uint numsys) : _Idx( numsys, NoIdx) {}
-    UnknownIdxCL() {}
-    UnknownIdxCL(const UnknownIdxCL&);
-    ~UnknownIdxCL() {}
-    UnknownIdxCL& operator=( const UnknownIdxCL&);
+    /// \brief Slot-number of a handle without unknowns.
+    static const Uint NoSlot;
+    /// \brief Number of tables: one for each dimension of a simplex.
+    enum { NumTablesC= 4 };
 
-    IdxT& GetIdx( Uint sysnum)
-    {
-        Assert( sysnum<GetNumSystems(), DROPSErrCL("UnknownIdxCL: Sysnum out of range"), DebugUnknownsC);
-        return _Idx[sysnum];
-    }
-    IdxT  GetIdx( Uint sysnum) const
-    {
-        Assert( sysnum<GetNumSystems(), DROPSErrCL("UnknownIdxCL: Sysnum out of range"), DebugUnknownsC);
-        return _Idx[sysnum];
+  private:
+    enum { BlockBitsC= 12, BlockSizeC= 1 << BlockBitsC, ///< slots per block
+           MaxBlocksC= 1 << 16,                         ///< capacity of the block-directory of a system
+           MaxSystemsC= 1024 };                         ///< maximal number of systems at a time
+
+    /// \brief The indices of one system in blocks; the directory is allocated once.
+    struct SystemT {
+        IdxT** blocks;
+        Uint   num_blocks;
+
+        SystemT () : blocks( 0), num_blocks( 0) {}
+    };
+
+    std::vector<SystemT> sys_;        ///< sys_[sysnum]; never resized
+    Uint                 max_sys_;    ///< 1 + the largest system number prepared in this table
+    std::vector<Uint>    free_slots_; ///< recycled slot-numbers
+    Uint                 num_slots_;  ///< number of slots handed out so far
+
+    UnknownTableCL () : sys_( MaxSystemsC), max_sys_( 0), num_slots_( 0) {}
+    UnknownTableCL (const UnknownTableCL&);            // not implemented
+    UnknownTableCL& operator= (const UnknownTableCL&); // not implemented
+
+    static std::vector<bool>& used_systems () { static std::vector<bool> used; return used; } ///< system numbers handed out by AcquireSystem
+
+    void free_system (Uint sysnum) {
+        SystemT& s= sys_[sysnum];
+        for (Uint b= 0; b < s.num_blocks; ++b)
+            delete[] s.blocks[b];
+        delete[] s.blocks;
+        s= SystemT();
     }
-    Uint GetNumSystems()            const { return _Idx.size(); }
 
-    void resize( Uint size, const IdxT defaultIdx= NoIdx)
-    {
-        _Idx.resize(size, defaultIdx);
+    Uint acquire_unlocked () {
+        if (free_slots_.empty()) {
+            if (num_slots_ == MaxBlocksC*Uint( BlockSizeC))
+                throw DROPSErrCL( "UnknownTableCL::Acquire: Too many simplices.\n");
+            return num_slots_++;
+        }
+        const Uint slot= free_slots_.back();
+        free_slots_.pop_back();
+        return slot;
     }
-
-    void push_back(IdxT idx= NoIdx) { _Idx.push_back( idx); }
-
-#ifdef _PAR
-    void SetUnkRecv(IdxT i) const
-    {
-        if (UnkRecieved_.size()<=i)
-            UnkRecieved_.resize(i+1,false);
-        UnkRecieved_[i]=true;
+    void release_unlocked (Uint slot) {
+        for (Uint sys= 0; sys < max_sys_; ++sys)
+            if (IsPrepared( sys, slot))
+                sys_[sys].blocks[slot >> BlockBitsC][slot & (BlockSizeC - 1)]= NoIdx;
+        free_slots_.push_back( slot);
     }
-
-    bool GetUnkRecv(IdxT i) const
-    {
-        if (UnkRecieved_.size()<=i)
-            return false;
-        else
-            return UnkRecieved_[i];
+    void prepare_unlocked (Uint sysnum, Uint slot) {
+        SystemT& s= sys_[sysnum];
+        if (s.blocks == 0)
+            s.blocks= new IdxT*[MaxBlocksC];
+        for (; s.num_blocks <= (slot >> BlockBitsC); ++s.num_blocks) {
+            s.blocks[s.num_blocks]= new IdxT[BlockSizeC];
+            std::fill( s.blocks[s.num_blocks], s.blocks[s.num_blocks] + BlockSizeC, NoIdx);
+        }
+        if (sysnum >= max_sys_)
+            max_sys_= sysnum + 1;
     }
 
-    void ResetUnkRecv()
-    {
-        for (Uint i=0; i<UnkRecieved_.size(); ++i)
-            ResetUnkRecv(i);
-        UnkRecieved_.resize(0);
+  public:
+    /// \brief The table of the simplices of dimension dim. The tables are never destroyed, as the simplices of static multigrids may outlive them otherwise.
+    static UnknownTableCL& Instance (Uint dim) {
+        static UnknownTableCL* tables= new UnknownTableCL[NumTablesC];
+        return tables[dim];
     }
 
-    void ResetUnkRecv( IdxT i )
-    {
-        if (UnkRecieved_.size()<=i)
+    /// \brief Returns an unused slot; all its indices are NoIdx.
+    Uint Acquire () {
+#ifdef _OPENMP
+        if (omp_in_parallel()) {
+            Uint ret;
+#           pragma omp critical (UnknownTableCL)
+            ret= acquire_unlocked();
+            return ret;
+        }
+#endif
+        return acquire_unlocked();
+    }
+    /// \brief Reset all indices of slot to NoIdx and recycle it.
+    void Release (Uint slot) {
+#ifdef _OPENMP
+        if (omp_in_parallel()) {
+#           pragma omp critical (UnknownTableCL)
+            release_unlocked( slot);
             return;
-        UnkRecieved_[i]=false;
+        }
+#endif
+        release_unlocked( slot);
+    }
+    /// \brief Allocate memory for the index of system sysnum in slot. References to other indices stay valid.
+    void Prepare (Uint sysnum, Uint slot) {
+        Assert( sysnum < MaxSystemsC, DROPSErrCL("UnknownTableCL::Prepare: Sysnum out of range"), DebugUnknownsC);
+#ifdef _OPENMP
+        if (omp_in_parallel()) {
+#           pragma omp critical (UnknownTableCL)
+            prepare_unlocked( sysnum, slot);
+            return;
+        }
+#endif
+        prepare_unlocked( sysnum, slot);
+    }
+    /// \brief Returns the lowest unused system number of all tables and reserves it.
+    static Uint AcquireSystem () {
+        Uint sysnum;
+#       pragma omp critical (UnknownTableCL)
+        {
+            std::vector<bool>& used= used_systems();
+            sysnum= std::find( used.begin(), used.end(), false) - used.begin();
+            if (sysnum == used.size())
+                used.push_back( true);
+            else
+                used[sysnum]= true;
+        }
+        if (sysnum >= MaxSystemsC)
+            throw DROPSErrCL( "UnknownTableCL::AcquireSystem: Too many systems.\n");
+        return sysnum;
+    }
+    /// \brief Free the memory of system sysnum in all tables and make the number available again; called by the owner of the system number, e.g. ~IdxDescCL.
+    static void ReleaseSystem (Uint sysnum) {
+#       pragma omp critical (UnknownTableCL)
+        {
+            for (Uint dim= 0; dim < NumTablesC; ++dim)
+                Instance( dim).free_system( sysnum);
+            if (sysnum < used_systems().size())
+                used_systems()[sysnum]= false;
+        }
     }
 
-    bool HasUnkRecv() const
-    {
-        for (Uint i=0; i<UnkRecieved_.size(); ++i)
-            if (UnkRecieved_[i])
-                return true;
-        return false;
+    /// \brief True, iff memory for the index of system sysnum in slot was allocated.
+    bool IsPrepared (Uint sysnum, Uint slot) const
+        { return sysnum < MaxSystemsC && (slot >> BlockBitsC) < sys_[sysnum].num_blocks; }
+    /// \brief Index of system sysnum in slot for writing; the memory must have been allocated by Prepare.
+    IdxT& operator() (Uint sysnum, Uint slot) {
+        Assert( IsPrepared( sysnum, slot), DROPSErrCL("UnknownTableCL: Sysnum out of range"), DebugUnknownsC);
+        return sys_[sysnum].blocks[slot >> BlockBitsC][slot & (BlockSizeC - 1)];
+    }
+    /// \brief Index of system sysnum in slot; NoIdx, if there is none.
+    IdxT operator() (Uint sysnum, Uint slot) const
+        { return IsPrepared( sysnum, slot) ? sys_[sysnum].blocks[slot >> BlockBitsC][slot & (BlockSizeC - 1)] : NoIdx; }
+
+    /// \brief Upper bound for the system numbers prepared in this table.
+    Uint GetMaxSystems () const { return max_sys_; }
+    /// \brief Number of slots in use.
+    Uint GetNumSlots () const { return num_slots_ - free_slots_.size(); }
+    /// \brief Memory used by the index-arrays in bytes.
+    size_t GetMemory () const {
+        size_t mem= free_slots_.capacity()*sizeof( Uint);
+        for (Uint sys= 0; sys < max_sys_; ++sys)
+            if (sys_[sys].blocks != 0)
+                mem+= MaxBlocksC*sizeof( IdxT*) + sys_[sys].num_blocks*BlockSizeC*sizeof( IdxT);
+        return mem;
     }
-#endif
 };
 
 
@@ -131,94 +229,144 @@ class UnknownIdxCL
 /// Every simplex has a public member Unknowns of type UnknownHandleCL,
 /// which behaves as a container of indices (for numerical data) that
 /// can be accessed via a system number.  This class is only a handle
-/// for an UnknownIdxCL.
+/// for a slot in the UnknownTableCL of the dimension of the simplex.
 class UnknownHandleCL
 {
   private:
-    UnknownIdxCL* _unk;
+    Uint _slot;
+    Uint dim_;  ///< dimension of the simplex; selects the UnknownTableCL
+#ifdef _PAR
+    // This flag array is used for remembering if an unknowns has just been received
+    // or if the unknown has been exist before the refinement and migration
+    // algorithm has been performed. (sorry for the missleading name giving)
+    mutable std::vector<bool> UnkRecieved_;
+#endif
 
-  public:
-    UnknownHandleCL() : _unk(0) {}
-    UnknownHandleCL( const UnknownHandleCL& orig)
+    UnknownTableCL& Table() const { return UnknownTableCL::Instance( dim_); }
+
+    void copy_from (const UnknownHandleCL& orig)
     {
-        _unk= orig._unk ? new UnknownIdxCL( *orig._unk)
-                        : 0;
+        dim_= orig.dim_;
+        if (orig._slot == UnknownTableCL::NoSlot) {
+            _slot= UnknownTableCL::NoSlot;
+            return;
+        }
+        _slot= Table().Acquire();
+        for (Uint sys= 0; sys < Table().GetMaxSystems(); ++sys)
+            if (Table().IsPrepared( sys, orig._slot)) {
+                Table().Prepare( sys, _slot);
+                Table()( sys, _slot)= Table()( sys, orig._slot);
+            }
     }
 
+  public:
+    /// \param dim dimension of the simplex, which owns the handle: 0 for vertices, ..., 3 for tetras.
+    explicit UnknownHandleCL( Uint dim) : _slot( UnknownTableCL::NoSlot), dim_( dim) {}
+    UnknownHandleCL( const UnknownHandleCL& orig)
+#ifdef _PAR
+        : UnkRecieved_( orig.UnkRecieved_)
+#endif
+    { copy_from( orig); }
+
     UnknownHandleCL& operator=( const UnknownHandleCL& rhs)
     {
         if (this==&rhs) return *this;
-        delete _unk;
-        _unk= rhs._unk ? new UnknownIdxCL( *rhs._unk)
-                       : 0;
+        Destroy();
+        copy_from( rhs);
+#ifdef _PAR
+        UnkRecieved_= rhs.UnkRecieved_;
+#endif
         return *this;
     }
 
-    ~UnknownHandleCL() { delete _unk; }
+    ~UnknownHandleCL() { Destroy(); }
 
     void Init(Uint numsys= 0)
     {
-        Assert( _unk==0, DROPSErrCL("UnknownHandleCL: Init was called twice"), DebugUnknownsC);
-        _unk= new UnknownIdxCL(numsys);
+        Assert( _slot==UnknownTableCL::NoSlot, DROPSErrCL("UnknownHandleCL: Init was called twice"), DebugUnknownsC);
+        _slot= Table().Acquire();
+        for (Uint sys= 0; sys < numsys; ++sys)
+            Table().Prepare( sys, _slot);
     }
 
-    void Destroy() { delete _unk; _unk= 0; }
+    void Destroy()
+    {
+        if (_slot != UnknownTableCL::NoSlot)
+            Table().Release( _slot);
+        _slot= UnknownTableCL::NoSlot;
+    }
 
-    /// True, iff this instance has already acquired an UnknownIdxCL-object.
-    bool Exist()             const { return _unk; }
+    /// True, iff this instance has already acquired a slot.
+    bool Exist()             const { return _slot != UnknownTableCL::NoSlot; }
     /// True, iff the system sysnum exists and has a valid index-entry.
-    bool Exist( Uint sysnum) const { return _unk && sysnum<_unk->GetNumSystems() && _unk->GetIdx(sysnum) != NoIdx; }
+    bool Exist( Uint sysnum) const { return _slot != UnknownTableCL::NoSlot && static_cast<const UnknownTableCL&>( Table())( sysnum, _slot) != NoIdx; }
 
     /// Effectively deletes the index belonging to system sysnum.
-    void Invalidate( Uint sysnum) { _unk->GetIdx(sysnum)= NoIdx; }
+    void Invalidate( Uint sysnum) { Table()( sysnum, _slot)= NoIdx; }
+
+    /// The slot-number in the UnknownTableCL.
+    Uint GetSlot() const { return _slot; }
+    /// The dimension of the simplex, i.e. the UnknownTableCL of the slot.
+    Uint GetDim()  const { return dim_; }
+    /// Number of systems, for which memory was allocated. Systems with a smaller number may not be allocated.
+    Uint GetNumSystems() const
+    {
+        if (_slot == UnknownTableCL::NoSlot) return 0;
+        Uint n= 0;
+        for (Uint sys= 0; sys < MaxNumSystems(); ++sys)
+            if (Table().IsPrepared( sys, _slot)) n= sys + 1;
+        return n;
+    }
+    /// Upper bound for the system numbers in use by the simplices of this dimension.
+    Uint MaxNumSystems() const { return Table().GetMaxSystems(); }
 
-    UnknownIdxCL* Get() const { return _unk; }
     /// Retrieves the index for sysnum for writing.
-    IdxT&        operator() ( Uint i)       { return _unk->GetIdx(i); }
+    IdxT&        operator() ( Uint i)       { return Table()( i, _slot); }
     /// Retrieves the index for sysnum for reading.
-    IdxT         operator() ( Uint i) const { return _unk->GetIdx(i); }
+    IdxT         operator() ( Uint i) const { return static_cast<const UnknownTableCL&>( Table())( i, _slot); }
 
     /// Allocates memory for a system with number sysnum.  Afterwards, an index
     /// can be stored for sysnum.
     /// The initial index is set to NoIdx. Thus, .Exist( sysnum)==false.
     void Prepare( Uint sysnum)
     {
-        if (!_unk) _unk= new UnknownIdxCL( sysnum+1);
-        else if ( !(sysnum < _unk->GetNumSystems()) )
-            _unk->resize( sysnum+1, NoIdx);
+        if (_slot == UnknownTableCL::NoSlot) _slot= Table().Acquire();
+        Table().Prepare( sysnum, _slot);
     }
 
+
 #ifdef _PAR
     /// Remember if an unknown of an index is just recieved
     void SetUnkRecieved( IdxT i ) const
     {
-        Assert(_unk!=0, DROPSErrCL("UnknownHandleCL: Cannot set UnkRecieved before this class is init"), DebugUnknownsC | DebugParallelC);
-        _unk->SetUnkRecv(i);
+        Assert(_slot!=UnknownTableCL::NoSlot, DROPSErrCL("UnknownHandleCL: Cannot set UnkRecieved before this class is init"), DebugUnknownsC | DebugParallelC);
+        if (UnkRecieved_.size()<=i)
+            UnkRecieved_.resize(i+1,false);
+        UnkRecieved_[i]=true;
     }
     /// Get information if the unknown of the index is recieved
     bool UnkRecieved( IdxT i ) const
     {
-        return _unk && _unk->GetUnkRecv(i);
+        return _slot!=UnknownTableCL::NoSlot && i<UnkRecieved_.size() && UnkRecieved_[i];
     }
     /// Forget about the recieved information about all unknowns
     void ResetUnkRecieved() const
     {
-        if (_unk!=0)
-            _unk->ResetUnkRecv();
+        UnkRecieved_.resize(0);
     }
     /// Forget about the recieved information about one index
     void ResetUnkRecieved( IdxT i) const
     {
-        if (_unk!=0)
-            _unk->ResetUnkRecv(i);
+        if (i<UnkRecieved_.size())
+            UnkRecieved_[i]=false;
     }
     /// For Debugging Purpose: Check if there is an UnkRecv-Flag
     bool HasUnkRecieved() const
     {
-        if (_unk==0)
-            return false;
-        else
-            return _unk->HasUnkRecv();
+        for (Uint i=0; i<UnkRecieved_.size(); ++i)
+            if (UnkRecieved_[i])
+                return true;
+        return false;
     }
 #endif
 };
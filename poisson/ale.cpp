@@ -44,6 +44,7 @@ void ALECL::InitGrid()
         New_Coord[2] = Old_Coord[2];
         sit->ChangeCoord(New_Coord);
     }
+    mg_.IncrementCoordVersion();
 }
 
 void ALECL::MovGrid(double t)
@@ -60,6 +61,7 @@ void ALECL::MovGrid(double t)
         New_Coord[2] = Old_Coord[2];
         sit->ChangeCoord(New_Coord);
     }
+    mg_.IncrementCoordVersion();
 }
 
 } 
\ No newline at end of file
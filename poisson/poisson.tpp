@@ -289,116 +289,166 @@ void PoissonP1CL<Coeff>::SetupVel( VecDescCL& vec, instat_vector_fun_ptr func, d
 }
 
 
+/// \brief Scatters the source term of the sensitivity problem of a tetra; used with scatter_tetras.
+class GradSrcScatterCL
+{
+  private:
+    VecDescCL& src_;
+    const PoissonBndDataCL& BndData_;
+    instat_scalar_fun_ptr T_, dalpha_;
+    double t_;
+    Uint idx_;
+    Quad2CL<> quad_a;
+
+  public:
+    GradSrcScatterCL (VecDescCL& src, const PoissonBndDataCL& BndData, instat_scalar_fun_ptr T, instat_scalar_fun_ptr dalpha, double t)
+        : src_( src), BndData_( BndData), T_( T), dalpha_( dalpha), t_( t), idx_( src.RowIdx->GetIdx()) {}
+
+    void operator() (const TetraCL& tet) {
+        Point3DCL G[4];
+        double det;
+        IdxT UnknownIdx[4];
+
+        P1DiscCL::GetGradients(G,det,tet);
+        const double absdet= std::fabs(det);
+
+        quad_a.assign( tet, dalpha_, t_);
+        const double int_a= quad_a.quad( absdet);
+        Point3DCL gradT;
+
+        for(int i=0; i<4; ++i)
+        {
+          gradT+= G[i]*T_(tet.GetVertex(i)->GetCoord(), t_);
+          UnknownIdx[i]= tet.GetVertex(i)->Unknowns.Exist(idx_) ? tet.GetVertex(i)->Unknowns(idx_)
+                                                                 : NoIdx;
+        }
+
+        for(int i=0; i<4;++i)    // assemble row i
+        {
+          if (tet.GetVertex(i)->Unknowns.Exist(idx_)) // vertex i is not on a Dirichlet boundary
+          {
+            src_.Data[UnknownIdx[i]]-= int_a*inner_prod( gradT, G[i]);
+            if ( BndData_.IsOnNatBnd(*tet.GetVertex(i)) )
+              for (int f=0; f < 3; ++f)
+                if ( tet.IsBndSeg(FaceOfVert(i, f)) )
+                {
+                  Point3DCL n;
+                  tet.GetOuterNormal(FaceOfVert(i, f), n);
+                  src_.Data[UnknownIdx[i]]+= 0.;//
+                    //Quad2D(tet, FaceOfVert(i, f), i, dalpha, t) * inner_prod( gradT, n);
+                }
+          }
+        }
+    }
+};
+
 //Source term for sensitivity problem
 template <class Coeff>
 void PoissonP1CL<Coeff>::SetupGradSrc(VecDescCL& src, instat_scalar_fun_ptr T, instat_scalar_fun_ptr dalpha, double t) const
 ///Special rhs for IA2 sensitivity problem
 {
   src.Clear( t);
-  const Uint lvl = src.GetLevel(),
-             idx = src.RowIdx->GetIdx();
-  Point3DCL G[4];
+  GradSrcScatterCL scatter( src, BndData_, T, dalpha, t);
+  scatter_tetras( MG_, src.GetLevel(), src.RowIdx->GetMatchingFunction(), src.RowIdx->GetBndInfo(), scatter);
+}
 
-  double det;
-  double absdet;
-  IdxT UnknownIdx[4];
-  Quad2CL<> rhs, quad_a;
 
-  for (MultiGridCL::const_TriangTetraIteratorCL
-    sit=const_cast<const MultiGridCL&>(MG_).GetTriangTetraBegin(lvl),
-    send=const_cast<const MultiGridCL&>(MG_).GetTriangTetraEnd(lvl);
-    sit != send; ++sit)
-  {
-    P1DiscCL::GetGradients(G,det,*sit);
-    absdet= std::fabs(det);
+/// \brief Scatters the right-hand side of the gradient problem of a tetra; used with scatter_tetras.
+class L2ProjGradScatterCL
+{
+  private:
+    VecDescCL& r_;
+    const PoissonBndDataCL& BndData_;
+    instat_scalar_fun_ptr T_, Psi_, flux_;
+    double t_;
+    Uint idx_;
 
-    quad_a.assign( *sit, dalpha, t);
-    const double int_a= quad_a.quad( absdet);
-    Point3DCL gradT;
+  public:
+    L2ProjGradScatterCL (VecDescCL& r, const PoissonBndDataCL& BndData, instat_scalar_fun_ptr T, instat_scalar_fun_ptr Psi,
+        instat_scalar_fun_ptr flux, double t)
+        : r_( r), BndData_( BndData), T_( T), Psi_( Psi), flux_( flux), t_( t), idx_( r.RowIdx->GetIdx()) {}
 
-    for(int i=0; i<4; ++i)
-    {
-      gradT+= G[i]*T(sit->GetVertex(i)->GetCoord(), t);
-      UnknownIdx[i]= sit->GetVertex(i)->Unknowns.Exist(idx) ? sit->GetVertex(i)->Unknowns(idx)
-                                                            : NoIdx;
-    }
+    void operator() (const TetraCL& tet) {
+        Point3DCL G[4];
+        double det;
+        IdxT UnknownIdx[4];
+        const double int_vi= 1./24; //1/120+1/4*2/15             NOT SO GOOD
 
-    for(int i=0; i<4;++i)    // assemble row i
-    {
-      if (sit->GetVertex(i)->Unknowns.Exist(idx)) // vertex i is not on a Dirichlet boundary
-      {
-        src.Data[UnknownIdx[i]]-= int_a*inner_prod( gradT, G[i]);
-        if ( BndData_.IsOnNatBnd(*sit->GetVertex(i)) )
-          for (int f=0; f < 3; ++f)
-            if ( sit->IsBndSeg(FaceOfVert(i, f)) )
+        P1DiscCL::GetGradients(G,det,tet);
+        const double absdet= std::fabs(det);
+
+        Point3DCL gradT, gradPsi;
+
+        for(int i=0; i<4; ++i)
+        {
+          gradT+= G[i]*T_(tet.GetVertex(i)->GetCoord(), t_);
+          gradPsi+= G[i]*Psi_(tet.GetVertex(i)->GetCoord(), t_);
+          UnknownIdx[i]= tet.GetVertex(i)->Unknowns.Exist(idx_) ? tet.GetVertex(i)->Unknowns(idx_)
+                                                                 : NoIdx;
+        }
+
+        for(int i=0; i<4;++i)    // assemble row i
+        {
+          if (tet.GetVertex(i)->Unknowns.Exist(idx_)) // vertex i is not on a Dirichlet boundary
+          {
+            r_.Data[UnknownIdx[i]]-= int_vi*inner_prod( gradT, gradPsi)*absdet;
+            if (flux_)
             {
-              Point3DCL n;
-              sit->GetOuterNormal(FaceOfVert(i, f), n);
-              src.Data[UnknownIdx[i]]+= 0.;//
-                //Quad2D(*sit, FaceOfVert(i, f), i, dalpha, t) * inner_prod( gradT, n);
+              if ( BndData_.IsOnNatBnd(*tet.GetVertex(i)) )
+                for (int f=0; f < 3; ++f)
+                  if ( tet.IsBndSeg(FaceOfVert(i, f)) )
+                  {
+                    Point3DCL n;
+                    tet.GetOuterNormal(FaceOfVert(i, f), n);
+                    r_.Data[UnknownIdx[i]]+=
+                      P1DiscCL::Quad2D(tet, FaceOfVert(i, f), Psi_, i,  t_) * flux_(tet.GetVertex(i)->GetCoord(), t_);
+                  }
             }
-      }
+          }
+        }
     }
-  }
-}
-
+};
 
 //Gradient problem for IA2
 template<class Coeff>
 void PoissonP1CL<Coeff>::SetupL2ProjGrad(VecDescCL& r, instat_scalar_fun_ptr T, instat_scalar_fun_ptr Psi, instat_scalar_fun_ptr flux, double t) const
 {
   r.Clear(t);
-  const Uint lvl = r.GetLevel(),
-             idx = r.RowIdx->GetIdx();
-  Point3DCL G[4];
-
-  double det;
-  double absdet;
-  IdxT UnknownIdx[4];
-  const double int_vi= 1./24; //1/120+1/4*2/15             NOT SO GOOD
+  L2ProjGradScatterCL scatter( r, BndData_, T, Psi, flux, t);
+  scatter_tetras( MG_, r.GetLevel(), r.RowIdx->GetMatchingFunction(), r.RowIdx->GetBndInfo(), scatter);
+}
 
-//
+/// \brief Squared L2-error of a P1-solution by a quadrature rule of degree 2; used with reduce_tetras.
+template <class DiscSolT>
+class P1L2ErrorReductionCL
+{
+  private:
+    const DiscSolT& sol_;
+    instat_scalar_fun_ptr Lsg_;
+    double t_;
 
-  for (MultiGridCL::const_TriangTetraIteratorCL
-    sit=const_cast<const MultiGridCL&>(MG_).GetTriangTetraBegin(lvl),
-    send=const_cast<const MultiGridCL&>(MG_).GetTriangTetraEnd(lvl);
-    sit != send; ++sit)
-  {
-    P1DiscCL::GetGradients(G,det,*sit);
-    absdet= std::fabs(det);
+  public:
+    double L2;
 
-    Point3DCL gradT, gradPsi;
+    P1L2ErrorReductionCL (const DiscSolT& sol, instat_scalar_fun_ptr Lsg, double t)
+        : sol_( sol), Lsg_( Lsg), t_( t), L2( 0.) {}
 
-    for(int i=0; i<4; ++i)
-    {
-      gradT+= G[i]*T(sit->GetVertex(i)->GetCoord(), t);
-      gradPsi+= G[i]*Psi(sit->GetVertex(i)->GetCoord(), t);
-      UnknownIdx[i]= sit->GetVertex(i)->Unknowns.Exist(idx) ? sit->GetVertex(i)->Unknowns(idx)
-                                                            : NoIdx;
-    }
+    void operator() (const TetraCL& tet) {
+        double absdet= tet.GetVolume()*6.,
+               sum= 0, diff;
 
-    for(int i=0; i<4;++i)    // assemble row i
-    {
-      if (sit->GetVertex(i)->Unknowns.Exist(idx)) // vertex i is not on a Dirichlet boundary
-      {
-        r.Data[UnknownIdx[i]]-= int_vi*inner_prod( gradT, gradPsi)*absdet;
-        if (flux)
+        for(Uint i=0; i<4; ++i)
         {
-	        if ( BndData_.IsOnNatBnd(*sit->GetVertex(i)) )
-	          for (int f=0; f < 3; ++f)
-	            if ( sit->IsBndSeg(FaceOfVert(i, f)) )
-	           {
-	              Point3DCL n;
-	              sit->GetOuterNormal(FaceOfVert(i, f), n);
-	              r.Data[UnknownIdx[i]]+=
-                  P1DiscCL::Quad2D(*sit, FaceOfVert(i, f), Psi, i,  t) * flux(sit->GetVertex(i)->GetCoord(), t);
-            }
-         }
-
-      }
+          diff= (sol_.val(*tet.GetVertex(i)) - Lsg_(tet.GetVertex(i)->GetCoord(),t_));
+          sum+= diff*diff;
+        }
+        sum/= 120;
+        diff= sol_.val(tet, 0.25, 0.25, 0.25) - Lsg_(GetBaryCenter(tet),t_);
+        sum+= 2./15. * diff*diff;
+        L2+= sum*absdet;
     }
-  }
-}
+    void join (const P1L2ErrorReductionCL& r) { L2+= r.L2; }
+};
 
 //=======================================================================================================
 //
@@ -417,24 +467,9 @@ double PoissonP1CL<Coeff>::CheckSolution(const VecDescCL& lsg,
 
   std::cout << "Difference to exact solution:" << std::endl;
 
-  for (MultiGridCL::const_TriangTetraIteratorCL
-    sit=const_cast<const MultiGridCL&>(MG_).GetTriangTetraBegin(lvl),
-    send=const_cast<const MultiGridCL&>(MG_).GetTriangTetraEnd(lvl);
-    sit != send; ++sit)
-  {
-    double absdet= sit->GetVolume()*6.,
-           sum= 0;
-
-    for(Uint i=0; i<4; ++i)
-    {
-      diff= (sol.val(*sit->GetVertex(i)) - Lsg(sit->GetVertex(i)->GetCoord(),t));
-      sum+= diff*diff;
-    }
-    sum/= 120;
-    diff= sol.val(*sit, 0.25, 0.25, 0.25) - Lsg(GetBaryCenter(*sit),t);
-    sum+= 2./15. * diff*diff;
-    L2+= sum*absdet;
-  }
+  P1L2ErrorReductionCL<const_DiscSolCL> red( sol, Lsg, t);
+  reduce_tetras( MG_, lvl, red);
+  L2= red.L2;
 #ifdef _PAR
   L2= ProcCL::GlobalSum(L2);
 #endif
@@ -1328,24 +1363,9 @@ double PoissonP2CL<Coeff>::CheckSolution(const VecDescCL& lsg, instat_scalar_fun
 
   std::cout << "Difference to exact solution:" << std::endl;
 
-  for (MultiGridCL::const_TriangTetraIteratorCL
-    sit=const_cast<const MultiGridCL&>(MG_).GetTriangTetraBegin(lvl),
-    send=const_cast<const MultiGridCL&>(MG_).GetTriangTetraEnd(lvl);
-    sit != send; ++sit)
-  {
-    double absdet= sit->GetVolume()*6.,
-           sum= 0;
-
-    for(Uint i=0; i<4; ++i)
-    {
-      diff= (sol.val(*sit->GetVertex(i)) - Lsg(sit->GetVertex(i)->GetCoord(),t));
-      sum+= diff*diff;
-    }
-    sum/= 120;
-    diff= sol.val(*sit, 0.25, 0.25, 0.25) - Lsg(GetBaryCenter(*sit),t);
-    sum+= 2./15. * diff*diff;
-    L2+= sum*absdet;
-  }
+  P1L2ErrorReductionCL<const_DiscSolCL> red( sol, Lsg, t);
+  reduce_tetras( MG_, lvl, red);
+  L2= red.L2;
 #ifdef _PAR
   L2= ProcCL::GlobalSum(L2);
 #endif
@@ -128,6 +128,7 @@ void TransportP1CL::SetupInstatSystem (MatrixCL& matA, VecDescCL* cplA,
                     C(&matC, num_unks,  num_unks);// convection
 
     const Uint lvl= RowIdx.TriangLevel();
+    RowIdx.BuildTetraDoFMap( MG_, Bnd_);
     LocalNumbP1CL n;
     double coupA[4][4], coupM[4][4], coupC[4][4];
 
@@ -85,7 +85,8 @@ void SetupSystem2_P2P1( const MultiGridCL& MG, const TwoPhaseFlowCoeffCL& coeff,
         IdxDescCL* RowIdx, IdxDescCL* ColIdx, double t)
 /// Set up matrices B and rhs c
 {
-    System2Accumulator_P2P1CL<TwoPhaseFlowCoeffCL> accu( coeff, BndData, *RowIdx, *ColIdx, *B, c, t);
+    ColIdx->BuildTetraDoFMap( MG, BndData.Vel);
+    System2Accumulator_P2P1CL<TwoPhaseFlowCoeffCL> accu( MG, coeff, BndData, *RowIdx, *ColIdx, *B, c, t);
     TetraAccumulatorTupleCL accus;
     accus.push_back( &accu);
     accumulate( accus, MG, RowIdx->TriangLevel(), RowIdx->GetMatchingFunction(), RowIdx->GetBndInfo());
@@ -152,7 +153,7 @@ class System2Accumulator_P2P1XCL : public System2Accumulator_P2P1CL<TwoPhaseFlow
 System2Accumulator_P2P1XCL::System2Accumulator_P2P1XCL (const TwoPhaseFlowCoeffCL& coeff_arg, const StokesBndDataCL& BndData_arg,
 		const LevelsetP2CL& lset, const IdxDescCL& RowIdx_arg, const IdxDescCL& ColIdx_arg,
 	    MatrixCL& B_arg, VecDescCL* c_arg, double t_arg)
-    :  base_( coeff_arg, BndData_arg, RowIdx_arg, ColIdx_arg, B_arg, c_arg, t_arg), lset_( lset), ls_loc_( 10)
+    :  base_( lset.GetMG(), coeff_arg, BndData_arg, RowIdx_arg, ColIdx_arg, B_arg, c_arg, t_arg), lset_( lset), ls_loc_( 10)
 {
     P2DiscCL::GetGradientsOnRef( GradRefLP1_);
 }
@@ -229,6 +230,7 @@ void System2Accumulator_P2P1XCL::update_global_system ()
 void SetupSystem2_P2P1X( const MultiGridCL& MG, const TwoPhaseFlowCoeffCL& coeff, const StokesBndDataCL& BndData, MatrixCL* B, VecDescCL* c, const LevelsetP2CL& lset, IdxDescCL* RowIdx, IdxDescCL* ColIdx, double t)
 // P2 / P1X FEs (X=extended) for vel/pr
 {
+    ColIdx->BuildTetraDoFMap( MG, BndData.Vel);
     System2Accumulator_P2P1XCL p1x_accu( coeff, BndData, lset, *RowIdx, *ColIdx, *B, c, t);
     TetraAccumulatorTupleCL accus;
     accus.push_back( &p1x_accu);
@@ -752,6 +754,7 @@ class PrMassAccumulator_P1CL : public TetraAccumulatorCL
     MatrixCL& matM;
     IdxDescCL& RowIdx;
     const LevelsetP2CL& lset;
+    const TetraGeometryCL* geom_; ///< cached transformations of the tetras
 
     std::valarray<double>     ls_loc_;
     TetraPartitionCL          partition_;
@@ -788,7 +791,7 @@ class PrMassAccumulator_P1CL : public TetraAccumulatorCL
 
 PrMassAccumulator_P1CL::PrMassAccumulator_P1CL (const MultiGridCL& MG_, const TwoPhaseFlowCoeffCL& Coeff_, MatrixCL& matM_, IdxDescCL& RowIdx_, const LevelsetP2CL& lset_, bool XFEM)
     : MG(MG_), lat( PrincipalLatticeCL::instance( 2)), Coeff(Coeff_), matM(matM_), RowIdx(RowIdx_),
-      lset(lset_), ls_loc_( 10), num_unks_pr(RowIdx_.NumUnknowns()),
+      lset(lset_), geom_( 0), ls_loc_( 10), num_unks_pr(RowIdx_.NumUnknowns()),
       lvl(RowIdx_.TriangLevel()), nu_inv_p(1./Coeff_.mu( 1.0)), nu_inv_n(1./Coeff_.mu( -1.0)), useXFEM( XFEM)
 {
     for(int i= 0; i < 4; ++i) {
@@ -804,6 +807,7 @@ PrMassAccumulator_P1CL::PrMassAccumulator_P1CL (const MultiGridCL& MG_, const Tw
 
 void PrMassAccumulator_P1CL::begin_accumulation ()
 {
+    geom_= &MG.GetTetraGeometry( lvl);
     M_pr = new MatrixBuilderCL(&matM, num_unks_pr,  num_unks_pr);
 }
 
@@ -816,7 +820,7 @@ void PrMassAccumulator_P1CL::finalize_accumulation()
 void PrMassAccumulator_P1CL::visit (const TetraCL& sit)
 {
     const ExtIdxDescCL& Xidx= RowIdx.GetXidx();
-    const double absdet= sit.GetVolume()*6.;
+    const double absdet= geom_->GetAbsDet( sit);
     loc_phi.assign( sit, lset.Phi, lset.GetBndData());
     cut.Init( sit, loc_phi);
     const bool nocut= !cut.Intersects();
@@ -1366,8 +1370,12 @@ class System1Accumulator_P2CL : public TetraAccumulatorCL
     VecDescCL* cplM;
     VecDescCL* b;
 
+    const VecDescCL* old_phi_; ///< if not 0, the contributions for old_phi_ are replaced by those for lset.Phi
+
     SparseMatBuilderCL<double, SMatrixCL<3,3> >* mA_;
     SparseMatBuilderCL<double, SDiagMatrixCL<3> >* mM_;
+    SparseMatBuilderCL<double>* mAupdate_; ///< used instead of mA_ and mM_ to update the entries of an assembled matrix
+    SparseMatBuilderCL<double>* mMupdate_;
 
     LocalSystem1OnePhase_P2CL local_onephase; ///< used on tetras in a single phase
     LocalSystem1TwoPhase_P2CL local_twophase; ///< used on intersected tetras
@@ -1375,6 +1383,7 @@ class System1Accumulator_P2CL : public TetraAccumulatorCL
 
     LocalNumbP2CL n; ///< global numbering of the P2-unknowns
 
+    const TetraGeometryCL* geom_; ///< cached transformations of the tetras
     SMatrixCL<3,3> T;
     double det, absdet;
     LocalP2CL<> ls_loc;
@@ -1382,15 +1391,18 @@ class System1Accumulator_P2CL : public TetraAccumulatorCL
     Quad2CL<Point3DCL> rhs;
     Point3DCL loc_b[10], dirichlet_val[10]; ///< Used to transfer boundary-values from local_setup() update_global_system().
 
-    ///\brief Computes the mapping from local to global data "n", the local matrices in loc and, if required, the Dirichlet-values needed to eliminate the boundary-dof from the global system.
-    void local_setup (const TetraCL& tet);
+    ///\brief Computes the mapping from local to global data "n", the local matrices in loc for the level set function phi and, if required, the Dirichlet-values needed to eliminate the boundary-dof from the global system.
+    void local_setup (const TetraCL& tet, const VecDescCL& phi);
+    ///\brief Negates the local matrices and load vector to subtract them from the global system.
+    void negate_local_system ();
     ///\brief Update the global system.
     void update_global_system ();
 
   public:
+    /// If old_phi is given, the matrices and vectors are not set up, but the contributions of the visited tetras for old_phi are replaced by those for ls.Phi.
     System1Accumulator_P2CL (const TwoPhaseFlowCoeffCL& Coeff, const StokesBndDataCL& BndData_,
         const LevelsetP2CL& ls, IdxDescCL& RowIdx_, MatrixCL& A_, MatrixCL& M_,
-        VecDescCL* b_, VecDescCL* cplA_, VecDescCL* cplM_, double t);
+        VecDescCL* b_, VecDescCL* cplA_, VecDescCL* cplM_, double t, const VecDescCL* old_phi= 0);
 
     ///\brief Initializes matrix-builders and load-vectors
     void begin_accumulation ();
@@ -1404,16 +1416,24 @@ class System1Accumulator_P2CL : public TetraAccumulatorCL
 
 System1Accumulator_P2CL::System1Accumulator_P2CL (const TwoPhaseFlowCoeffCL& Coeff_, const StokesBndDataCL& BndData_,
     const LevelsetP2CL& lset_arg, IdxDescCL& RowIdx_, MatrixCL& A_, MatrixCL& M_,
-    VecDescCL* b_, VecDescCL* cplA_, VecDescCL* cplM_, double t_)
+    VecDescCL* b_, VecDescCL* cplA_, VecDescCL* cplM_, double t_, const VecDescCL* old_phi)
     : Coeff( Coeff_), BndData( BndData_), lset( lset_arg), t( t_),
-      RowIdx( RowIdx_), A( A_), M( M_), cplA( cplA_), cplM( cplM_), b( b_),
-      local_twophase( Coeff.mu( 1.0), Coeff.mu( -1.0), Coeff.rho( 1.0), Coeff.rho( -1.0))
+      RowIdx( RowIdx_), A( A_), M( M_), cplA( cplA_), cplM( cplM_), b( b_), old_phi_( old_phi),
+      mA_( 0), mM_( 0), mAupdate_( 0), mMupdate_( 0),
+      local_twophase( Coeff.mu( 1.0), Coeff.mu( -1.0), Coeff.rho( 1.0), Coeff.rho( -1.0)), geom_( 0)
 {}
 
 void System1Accumulator_P2CL::begin_accumulation ()
 {
-    std::cout << "entering SetupSystem1_P2CL: ";
+    geom_= &lset.GetMG().GetTetraGeometry( RowIdx.TriangLevel());
     const size_t num_unks_vel= RowIdx.NumUnknowns();
+    if (old_phi_ != 0) {
+        std::cout << "updating SetupSystem1_P2CL: ";
+        mAupdate_= new SparseMatBuilderCL<double>( &A, num_unks_vel, num_unks_vel, /*reuse*/ true);
+        mMupdate_= new SparseMatBuilderCL<double>( &M, num_unks_vel, num_unks_vel, /*reuse*/ true);
+        return;
+    }
+    std::cout << "entering SetupSystem1_P2CL: ";
     mA_= new SparseMatBuilderCL<double, SMatrixCL<3,3> >( &A, num_unks_vel, num_unks_vel);
     mM_= new SparseMatBuilderCL<double, SDiagMatrixCL<3> >( &M, num_unks_vel, num_unks_vel);
     if (b != 0) {
@@ -1425,10 +1445,16 @@ void System1Accumulator_P2CL::begin_accumulation ()
 
 void System1Accumulator_P2CL::finalize_accumulation ()
 {
-    mA_->Build();
-    delete mA_;
-    mM_->Build();
-    delete mM_;
+    if (old_phi_ != 0) {
+        delete mAupdate_; mAupdate_= 0;
+        delete mMupdate_; mMupdate_= 0;
+    }
+    else {
+        mA_->Build();
+        delete mA_;
+        mM_->Build();
+        delete mM_;
+    }
 #ifndef _PAR
     std::cout << A.num_nonzeros() << " nonzeros in A, "
               << M.num_nonzeros() << " nonzeros in M!";
@@ -1438,19 +1464,35 @@ void System1Accumulator_P2CL::finalize_accumulation ()
 
 void System1Accumulator_P2CL::visit (const TetraCL& tet)
 {
-    local_setup( tet);
+    if (old_phi_ != 0) { // remove the contribution of the last assembly
+        local_setup( tet, *old_phi_);
+        negate_local_system();
+        update_global_system();
+    }
+    local_setup( tet, lset.Phi);
     update_global_system();
 }
 
-void System1Accumulator_P2CL::local_setup (const TetraCL& tet)
+void System1Accumulator_P2CL::negate_local_system ()
 {
-    GetTrafoTr( T, det, tet);
+    for (int i= 0; i < 10; ++i) {
+        loc_b[i]*= -1.;
+        for (int j= 0; j < 10; ++j) {
+            loc.Ak[i][j]*= -1.;
+            loc.M[i][j]*= -1.;
+        }
+    }
+}
+
+void System1Accumulator_P2CL::local_setup (const TetraCL& tet, const VecDescCL& phi)
+{
+    geom_->GetTrafoTr( T, det, tet);
     absdet= std::fabs( det);
 
     rhs.assign( tet, Coeff.volforce, t);
     n.assign( tet, RowIdx, BndData.Vel);
 
-    ls_loc.assign( tet, lset.Phi, lset.GetBndData());
+    ls_loc.assign( tet, phi, lset.GetBndData());
     if (equal_signs( ls_loc)) {
         local_onephase.mu(  local_twophase.mu(  sign( ls_loc[0])));
         local_onephase.rho( local_twophase.rho( sign( ls_loc[0])));
@@ -1476,15 +1518,20 @@ void System1Accumulator_P2CL::local_setup (const TetraCL& tet)
 
 void System1Accumulator_P2CL::update_global_system ()
 {
-    SparseMatBuilderCL<double, SMatrixCL<3,3> >& mA= *mA_;
-    SparseMatBuilderCL<double, SDiagMatrixCL<3> >& mM= *mM_;
-
     for(int i= 0; i < 10; ++i)    // assemble row Numb[i]
         if (n.WithUnknowns( i)) { // dof i is not on a Dirichlet boundary
             for(int j= 0; j < 10; ++j) {
                 if (n.WithUnknowns( j)) { // dof j is not on a Dirichlet boundary
-                    mA( n.num[i], n.num[j])+= loc.Ak[i][j];
-                    mM( n.num[i], n.num[j])+= SDiagMatrixCL<3>( loc.M[j][i]);
+                    if (mA_ != 0) {
+                        (*mA_)( n.num[i], n.num[j])+= loc.Ak[i][j];
+                        (*mM_)( n.num[i], n.num[j])+= SDiagMatrixCL<3>( loc.M[j][i]);
+                    }
+                    else // the entries exist, as the pattern does not depend on the level set function
+                        for (int k= 0; k < 3; ++k) {
+                            for (int l= 0; l < 3; ++l)
+                                (*mAupdate_)( n.num[i] + k, n.num[j] + l)+= loc.Ak[i][j]( k, l);
+                            (*mMupdate_)( n.num[i] + k, n.num[j] + k)+= loc.M[j][i];
+                        }
                 }
                 else if (b != 0) { // right-hand side for eliminated Dirichlet-values
                     add_to_global_vector( cplA->Data, -loc.Ak[i][j]*dirichlet_val[j], n.num[i]);
@@ -1496,17 +1543,102 @@ void System1Accumulator_P2CL::update_global_system ()
        }
 }
 
+bool System1CacheCL::IsValidFor (const MatrixCL& A, const MatrixCL& M, const VecDescCL* b, const VecDescCL* cplA, const VecDescCL* cplM,
+    const LevelsetP2CL& lset, const IdxDescCL& RowIdx, double t) const
+{
+    return valid_
+        && A_ == &A && A_version_ == A.Version() && M_ == &M && M_version_ == M.Version()
+        && rowidx_ == &RowIdx && numbering_version_ == RowIdx.GetNumberingVersion()
+        && mg_version_ == lset.GetMG().GetVersion() && coord_version_ == lset.GetMG().GetCoordVersion()
+        && b_ == b && cplA_ == cplA && cplM_ == cplM && t_ == t
+        && phi_.RowIdx == lset.Phi.RowIdx && phi_numbering_version_ == lset.Phi.RowIdx->GetNumberingVersion()
+        && phi_.Data.size() == lset.Phi.Data.size();
+}
+
+void System1CacheCL::Store (const MatrixCL& A, const MatrixCL& M, const VecDescCL* b, const VecDescCL* cplA, const VecDescCL* cplM,
+    const LevelsetP2CL& lset, const IdxDescCL& RowIdx, double t)
+{
+    A_= &A; A_version_= A.Version();
+    M_= &M; M_version_= M.Version();
+    rowidx_= &RowIdx; numbering_version_= RowIdx.GetNumberingVersion();
+    mg_version_= lset.GetMG().GetVersion();
+    coord_version_= lset.GetMG().GetCoordVersion();
+    b_= b; cplA_= cplA; cplM_= cplM;
+    t_= t;
+    if (b != 0) {
+        old_b_.resize( b->Data.size());    old_b_= b->Data;
+        old_cplA_.resize( cplA->Data.size()); old_cplA_= cplA->Data;
+        old_cplM_.resize( cplM->Data.size()); old_cplM_= cplM->Data;
+    }
+    phi_.SetIdx( lset.Phi.RowIdx);
+    phi_.Data= lset.Phi.Data;
+    phi_numbering_version_= lset.Phi.RowIdx->GetNumberingVersion();
+    valid_= true;
+}
+
+void System1CacheCL::RestoreVectors (VecDescCL* b, VecDescCL* cplA, VecDescCL* cplM) const
+{
+    if (b == 0)
+        return;
+    // The vectors may coincide, thus the last assembled value is assigned last.
+    cplM->Data= old_cplM_; cplM->t= t_;
+    cplA->Data= old_cplA_; cplA->t= t_;
+    b->Data= old_b_;       b->t= t_;
+}
+
+void System1CacheCL::ChangedTetras (const LevelsetP2CL& lset, const IdxDescCL& RowIdx, std::vector<TetraVecT>& changed) const
+{
+    const MultiGridCL& mg= lset.GetMG();
+    const Uint lvl= RowIdx.TriangLevel();
+    LocalP2CL<> old_loc, new_loc;
+    if (omp_get_max_threads() == 1) { // same order as accumulate
+        changed.assign( 1, TetraVecT());
+        for (MultiGridCL::const_TriangTetraIteratorCL it= mg.GetTriangTetraBegin( lvl), end= mg.GetTriangTetraEnd( lvl); it != end; ++it) {
+            old_loc.assign( *it, phi_, lset.GetBndData());
+            new_loc.assign( *it, lset.Phi, lset.GetBndData());
+            if (!equal_signs( old_loc) || !equal_signs( new_loc) || sign( old_loc[0]) != sign( new_loc[0]))
+                changed[0].push_back( &*it);
+        }
+        return;
+    }
+    const ColorClassesCL& colors= mg.GetColorClasses( lvl, RowIdx.GetMatchingFunction(), RowIdx.GetBndInfo());
+    changed.assign( colors.num_colors(), TetraVecT());
+    std::vector<TetraVecT>::iterator c= changed.begin();
+    for (ColorClassesCL::const_iterator cit= colors.begin(); cit != colors.end(); ++cit, ++c)
+        for (TetraVecT::const_iterator it= cit->begin(); it != cit->end(); ++it) {
+            old_loc.assign( **it, phi_, lset.GetBndData());
+            new_loc.assign( **it, lset.Phi, lset.GetBndData());
+            if (!equal_signs( old_loc) || !equal_signs( new_loc) || sign( old_loc[0]) != sign( new_loc[0]))
+                c->push_back( *it);
+        }
+}
+
 void SetupSystem1_P2( const MultiGridCL& MG_, const TwoPhaseFlowCoeffCL& Coeff_, const StokesBndDataCL& BndData_, MatrixCL& A, MatrixCL& M,
-                      VecDescCL* b, VecDescCL* cplA, VecDescCL* cplM, const LevelsetP2CL& lset, IdxDescCL& RowIdx, double t)
-/// Set up matrices A, M and rhs b (depending on phase bnd)
+                      VecDescCL* b, VecDescCL* cplA, VecDescCL* cplM, const LevelsetP2CL& lset, IdxDescCL& RowIdx, double t,
+                      System1CacheCL* cache= 0)
+/// Set up matrices A, M and rhs b (depending on phase bnd); if cache contains a previous assembly with the same arguments, only the tetras with changed phases are visited.
 {
     // TimerCL time;
     // time.Start();
 
-    System1Accumulator_P2CL accu( Coeff_, BndData_, lset, RowIdx, A, M, b, cplA, cplM, t);
-    TetraAccumulatorTupleCL accus;
-    accus.push_back( &accu);
-    accumulate( accus, MG_, RowIdx.TriangLevel(), RowIdx.GetMatchingFunction(), RowIdx.GetBndInfo());
+    RowIdx.BuildTetraDoFMap( MG_, BndData_.Vel);
+    if (cache != 0 && cache->IsValidFor( A, M, b, cplA, cplM, lset, RowIdx, t)) {
+        std::vector<System1CacheCL::TetraVecT> changed;
+        cache->ChangedTetras( lset, RowIdx, changed);
+        cache->RestoreVectors( b, cplA, cplM);
+        System1Accumulator_P2CL accu( Coeff_, BndData_, lset, RowIdx, A, M, b, cplA, cplM, t, &cache->GetPhi());
+        TetraAccumulatorTupleCL accus;
+        accus.push_back( &accu);
+        accus.visit_color_classes( changed.begin(), changed.end());
+    }
+    else {
+        System1Accumulator_P2CL accu( Coeff_, BndData_, lset, RowIdx, A, M, b, cplA, cplM, t);
+        TetraAccumulatorTupleCL accus;
+        accus.push_back( &accu);
+        accumulate( accus, MG_, RowIdx.TriangLevel(), RowIdx.GetMatchingFunction(), RowIdx.GetBndInfo());
+    }
+    if (cache != 0)
+        cache->Store( A, M, b, cplA, cplM, lset, RowIdx, t);
     // time.Stop();
     // std::cout << "setup: " << time.GetTime() << " seconds" << std::endl;
 }
@@ -1818,7 +1950,8 @@ void InstatStokes2PhaseP2P1CL::SetupSystem1( MLMatDescCL* A, MLMatDescCL* M, Vec
     MLIdxDescCL::iterator it = A->RowIdx->begin();
     for (size_t lvl=0; lvl < A->Data.size(); ++lvl, ++itA, ++itM, ++it)
         if (it->GetFE()==vecP2_FE)
-            SetupSystem1_P2 ( MG_, Coeff_, BndData_, *itA, *itM, lvl == A->Data.size()-1 ? b : 0, cplA, cplM, lset, *it, t);
+            SetupSystem1_P2 ( MG_, Coeff_, BndData_, *itA, *itM, lvl == A->Data.size()-1 ? b : 0, cplA, cplM, lset, *it, t,
+                A->Data.size() == 1 ? &system1_cache_ : 0);
         else if (it->GetFE()==vecP2R_FE)
             SetupSystem1_P2R( MG_, Coeff_, BndData_, *itA, *itM, lvl == A->Data.size()-1 ? b : 0, cplA, cplM, lset, *it, t);
         else
@@ -1835,6 +1968,7 @@ InstatStokes2PhaseP2P1CL::system1_accu (MLTetraAccumulatorTupleCL& accus, MLMatD
     for (size_t lvl= 0; lvl < A->Data.size(); ++lvl, ++itA, ++itM, ++it, ++itaccu)
         switch (it->GetFE()) {
           case vecP2_FE:
+            it->BuildTetraDoFMap( GetMG(), GetBndData().Vel);
             itaccu->push_back_acquire( new System1Accumulator_P2CL( GetCoeff(), GetBndData(), lset,
                 *it, *itA, *itM, lvl == A->Data.size() - 1 ? b : 0, cplA, cplM, t));
             break;
@@ -2158,6 +2292,7 @@ class LBAccumulator_P2CL : public TetraAccumulatorCL
 
     LocalNumbP2CL n; ///< global numbering of the P2-unknowns
 
+    const TetraGeometryCL* geom_; ///< cached transformations of the tetras
     SMatrixCL<3,3> T;
     double det, absdet;
     LocalP2CL<> ls_loc;
@@ -2186,12 +2321,13 @@ class LBAccumulator_P2CL : public TetraAccumulatorCL
 LBAccumulator_P2CL::LBAccumulator_P2CL (const TwoPhaseFlowCoeffCL& Coeff_, const StokesBndDataCL& BndData_,
     const LevelsetP2CL& lset_arg, IdxDescCL& RowIdx_, MatrixCL& A_, VecDescCL* cplA_, double t_)
     : Coeff( Coeff_), BndData( BndData_), lset( lset_arg), t( t_), 
-      RowIdx( RowIdx_), A( A_), cplA( cplA_), local_twophase( Coeff.SurfTens)
+      RowIdx( RowIdx_), A( A_), cplA( cplA_), local_twophase( Coeff.SurfTens), geom_( 0)
 {}
 
 void LBAccumulator_P2CL::begin_accumulation ()
 {
     std::cout << "entering SetupLB: ";
+    geom_= &lset.GetMG().GetTetraGeometry( RowIdx.TriangLevel());
     const size_t num_unks_vel= RowIdx.NumUnknowns();
     mA_= new SparseMatBuilderCL<double, SDiagMatrixCL<3> >( &A, num_unks_vel, num_unks_vel);
     if (cplA != 0) {
@@ -2223,7 +2359,7 @@ void LBAccumulator_P2CL::visit (const TetraCL& tet)
 
 void LBAccumulator_P2CL::local_setup (const TetraCL& tet)
 {
-    GetTrafoTr( T, det, tet);
+    geom_->GetTrafoTr( T, det, tet);
 
     n.assign( tet, RowIdx, BndData.Vel);
     local_twophase.setup( T, ls_loc, tet, locA);
@@ -2260,6 +2396,7 @@ void LBAccumulator_P2CL::update_global_system ()
 void SetupLB_P2( const MultiGridCL& MG_, const TwoPhaseFlowCoeffCL& Coeff_, const StokesBndDataCL& BndData_, MatrixCL& A, VelVecDescCL* cplA, const LevelsetP2CL& lset, IdxDescCL& RowIdx, double t)
 /// Set up the Laplace-Beltrami-matrix
 {
+    RowIdx.BuildTetraDoFMap( MG_, BndData_.Vel);
     LBAccumulator_P2CL accu( Coeff_, BndData_, lset, RowIdx, A, cplA, t);
     TetraAccumulatorTupleCL accus;
     accus.push_back( &accu);
@@ -2297,6 +2434,7 @@ void InstatStokes2PhaseP2P1CL::SetupSystem2( MLMatDescCL* B, VecDescCL* c, const
         std::cout << "entering SetupSystem2: " << itRow->NumUnknowns() << " prs, " << itCol->NumUnknowns() << " vels. ";
 #endif
         VecDescCL* rhsPtr= itB==B->Data.GetFinestIter() ? c : 0; // setup rhs only on finest level
+        itB->KeepTranspose(); // B^T is applied in every iteration of the Stokes solvers
         if (itCol->GetFE()==vecP2_FE)
             switch (GetPrFE())
             {
@@ -2351,10 +2489,12 @@ InstatStokes2PhaseP2P1CL::system2_accu (MLTetraAccumulatorTupleCL& accus, MLMatD
         std::cout << "entering SetupSystem2: " << itRow->NumUnknowns() << " prs, " << itCol->NumUnknowns() << " vels. ";
 #endif
         VecDescCL* rhsPtr= itB==B->Data.GetFinestIter() ? c : 0; // setup rhs only on finest level
-        if (itCol->GetFE()==vecP2_FE)
+        itB->KeepTranspose(); // B^T is applied in every iteration of the Stokes solvers
+        if (itCol->GetFE()==vecP2_FE) {
+            itCol->BuildTetraDoFMap( GetMG(), BndData_.Vel);
             switch (GetPrFE()) {
                 case P1_FE:
-                    itaccu->push_back_acquire( new System2Accumulator_P2P1CL<TwoPhaseFlowCoeffCL>( Coeff_, BndData_, *itRow, *itCol, *itB, rhsPtr, t));
+                    itaccu->push_back_acquire( new System2Accumulator_P2P1CL<TwoPhaseFlowCoeffCL>( GetMG(), Coeff_, BndData_, *itRow, *itCol, *itB, rhsPtr, t));
                     break;
                 case P1X_FE:
                     itaccu->push_back_acquire( new System2Accumulator_P2P1XCL(Coeff_, BndData_, lset, *itRow, *itCol, *itB, rhsPtr, t));
@@ -2362,6 +2502,7 @@ InstatStokes2PhaseP2P1CL::system2_accu (MLTetraAccumulatorTupleCL& accus, MLMatD
                 default:
                     throw DROPSErrCL("InstatStokes2PhaseP2P1CL<Coeff>::SetupSystem2 not implemented for this pressure FE type");
             }
+        }
         else
             throw DROPSErrCL("InstatStokes2PhaseP2P1CL<Coeff>::system2_accu: not implemented for this velocity FE type");
 #ifndef _PAR
@@ -136,6 +136,58 @@ class TwoPhaseFlowCoeffCL
 /// problem class for instationary two-pase Stokes flow
 
 
+/// \brief Data of the last assembly of A, M, b, cplA and cplM by SetupSystem1 with P2-elements on one level.
+/** Between two calls of SetupSystem1, e.g., in the fixed point iterations of a time step, the level set function
+    usually changes only near the interface. The local matrices of a tetra, which is not cut by the zero level, depend
+    on the level set function only by its sign. Hence, they only change on tetras, which are cut by the old or the new
+    zero level, or whose sign changes. If the matrices, the vectors, the numbering, the multigrid and the time are the
+    same as in the last assembly, SetupSystem1 subtracts the old contributions of these tetras and adds the new ones;
+    all other tetras are not visited.
+*/
+class System1CacheCL
+{
+  public:
+    typedef ColorClassesCL::ColorClassT TetraVecT;
+
+  private:
+    bool valid_;
+    const MatrixCL*  A_;              ///< assembled matrices
+    const MatrixCL*  M_;
+    size_t           A_version_,      ///< versions of the matrices after the assembly
+                     M_version_;
+    const IdxDescCL* rowidx_;         ///< numbering of the velocity
+    size_t           numbering_version_,     ///< versions of the numbering of the velocity and of phi_
+                     phi_numbering_version_;
+    size_t           mg_version_,     ///< version of the multigrid
+                     coord_version_;  ///< version of the vertex-coordinates
+    const VecDescCL* b_;              ///< assembled vectors; may be 0
+    const VecDescCL* cplA_;
+    const VecDescCL* cplM_;
+    double           t_;              ///< time of the assembly
+    VectorCL         old_b_,          ///< values of the assembled vectors
+                     old_cplA_,
+                     old_cplM_;
+    VecDescCL        phi_;            ///< level set function of the assembly
+
+  public:
+    System1CacheCL () : valid_( false), A_( 0), M_( 0), rowidx_( 0), b_( 0), cplA_( 0), cplM_( 0) {}
+
+    /// \brief True, iff the assembly with these arguments can be done by updating the last assembly.
+    bool IsValidFor (const MatrixCL& A, const MatrixCL& M, const VecDescCL* b, const VecDescCL* cplA, const VecDescCL* cplM,
+        const LevelsetP2CL& lset, const IdxDescCL& RowIdx, double t) const;
+    /// \brief Remember the data of an assembly.
+    void Store (const MatrixCL& A, const MatrixCL& M, const VecDescCL* b, const VecDescCL* cplA, const VecDescCL* cplM,
+        const LevelsetP2CL& lset, const IdxDescCL& RowIdx, double t);
+    /// \brief Assign the assembled values to the vectors b, cplA and cplM.
+    void RestoreVectors (VecDescCL* b, VecDescCL* cplA, VecDescCL* cplM) const;
+    /// \brief Color classes of the tetras, whose local system differs for the level set function of the last assembly and lset.
+    void ChangedTetras (const LevelsetP2CL& lset, const IdxDescCL& RowIdx, std::vector<TetraVecT>& changed) const;
+    /// \brief Level set function of the last assembly
+    const VecDescCL& GetPhi () const { return phi_; }
+    /// \brief Forget the last assembly
+    void Invalidate () { valid_= false; }
+};
+
 class InstatStokes2PhaseP2P1CL : public ProblemCL<TwoPhaseFlowCoeffCL, StokesBndDataCL>
 {
   public:
@@ -165,6 +217,9 @@ class InstatStokes2PhaseP2P1CL : public ProblemCL<TwoPhaseFlowCoeffCL, StokesBnd
                  prA,
                  prM;
 
+  private:
+    mutable System1CacheCL system1_cache_; ///< last assembly of SetupSystem1 on the finest level
+
   public:
     InstatStokes2PhaseP2P1CL( const MGBuilderCL& mgb, const TwoPhaseFlowCoeffCL& coeff, const BndDataCL& bdata, FiniteElementT prFE= P1_FE, double XFEMstab=0.1, FiniteElementT velFE= vecP2_FE)
         : base_(mgb, coeff, bdata), vel_idx(velFE, 1, bdata.Vel, 0, XFEMstab), pr_idx(prFE, 1, bdata.Pr, 0, XFEMstab) {}
@@ -179,7 +234,7 @@ class InstatStokes2PhaseP2P1CL : public ProblemCL<TwoPhaseFlowCoeffCL, StokesBnd
     /// \brief Only used for XFEM
     void UpdateXNumbering( MLIdxDescCL* idx, const LevelsetP2CL& lset)
         {
-            if (UsesXFEM()) idx->UpdateXNumbering( MG_, lset.Phi, lset.GetBndData());
+            if (UsesXFEM()) idx->UpdateXNumbering( MG_, lset.Phi, lset.GetBndData(), lset.GetBand());
         }
     /// \brief Only used for XFEM
     void UpdatePressure( VecDescCL* p)
@@ -194,7 +249,7 @@ class InstatStokes2PhaseP2P1CL : public ProblemCL<TwoPhaseFlowCoeffCL, StokesBnd
     //@{
     /// Returns whether extended FEM are used for pressure
     bool UsesXFEM() const { return pr_idx.GetFinest().IsExtended(); }
-    /// Set up matrices A, M and rhs b (depending on phase bnd)
+    /// Set up matrices A, M and rhs b (depending on phase bnd); with one level and P2-elements, the last assembly is updated on the tetras, on which the phases changed, see System1CacheCL.
     void SetupSystem1( MLMatDescCL* A, MLMatDescCL* M, VecDescCL* b, VecDescCL* cplA, VecDescCL* cplM, const LevelsetP2CL& lset, double t) const;
     MLTetraAccumulatorTupleCL& system1_accu (MLTetraAccumulatorTupleCL& accus, MLMatDescCL* A, MLMatDescCL* M, VecDescCL* b, VecDescCL* cplA, VecDescCL* cplM, const LevelsetP2CL& lset, double t) const;
     /// Set up rhs b (depending on phase bnd)
@@ -219,7 +274,7 @@ class InstatStokes2PhaseP2P1CL : public ProblemCL<TwoPhaseFlowCoeffCL, StokesBnd
     /// Smooth velocity field
     void SmoothVel( VelVecDescCL*, int num= 1, double tau=0.5);
     /// Clear all matrices, should be called after grid change to avoid reuse of matrix pattern
-    void ClearMat() { A.Data.clear(); B.Data.clear(); M.Data.clear(); prA.Data.clear(); prM.Data.clear(); }
+    void ClearMat() { A.Data.clear(); B.Data.clear(); M.Data.clear(); prA.Data.clear(); prM.Data.clear(); system1_cache_.Invalidate(); }
     /// Set all indices
     void SetIdx();
     /// Set number of used levels
@@ -263,6 +318,9 @@ class VelocityRepairCL : public MGObserverCL
   private:
     InstatStokes2PhaseP2P1CL& stokes_;
     std::auto_ptr<RepairP2CL<Point3DCL> > p2repair_;
+    size_t                   field_;    ///< number of stokes_.v in the RepairSetCL
+    std::auto_ptr<IdxDescCL> loc_vidx_; ///< numbering on the final triangulation
+    std::auto_ptr<VecDescCL> loc_v_;    ///< repaired function
 
   public:
     VelocityRepairCL (InstatStokes2PhaseP2P1CL& stokes)
@@ -271,6 +329,12 @@ class VelocityRepairCL : public MGObserverCL
     void post_refine ();
     void pre_refine_sequence  () {}
     void post_refine_sequence ();
+#ifndef _PAR
+    bool supports_deferred_repair () const { return true; }
+    void pre_refine_deferred  (RepairSetCL&);
+    void pre_repair_deferred  (RepairSetCL&);
+    void post_refine_deferred ();
+#endif
     const IdxDescCL* GetIdxDesc() const { return stokes_.v.RowIdx; }
 };
 
@@ -281,11 +345,17 @@ class VelocityRepairCL : public MGObserverCL
 /// post_refine_sequence(). Holding the P1XRepairCL* in an auto_ptr simplifies the use
 /// of heap-memory: No memory is lost, even if successive calls of pre_refine_sequence()
 /// occur without interleaved post_refine_sequence()-calls.
+/// For the deferred repair, the P1-part is repaired by the RepairSetCL. For P1X-elements, it is
+/// repaired on a P1-numbering and copied in post_refine_deferred(), as the extended numbering
+/// requires the repaired level set function.
 class PressureRepairCL : public MGObserverCL
 {
   private:
     InstatStokes2PhaseP2P1CL& stokes_;
     std::auto_ptr<P1XRepairCL> p1xrepair_;
+    size_t                   field_;    ///< number of stokes_.p in the RepairSetCL
+    std::auto_ptr<IdxDescCL> loc_pidx_; ///< (P1-)numbering on the final triangulation
+    std::auto_ptr<VecDescCL> loc_p_;    ///< repaired function
     const LevelsetP2CL& ls_;
 
   public:
@@ -295,6 +365,12 @@ class PressureRepairCL : public MGObserverCL
     void post_refine ();
     void pre_refine_sequence  ();
     void post_refine_sequence ();
+#ifndef _PAR
+    bool supports_deferred_repair () const { return true; }
+    void pre_refine_deferred  (RepairSetCL&);
+    void pre_repair_deferred  (RepairSetCL&);
+    void post_refine_deferred ();
+#endif
     const IdxDescCL* GetIdxDesc() const { return stokes_.p.RowIdx; }
 };
 
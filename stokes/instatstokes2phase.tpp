@@ -145,6 +145,37 @@ inline void
     v.Data= loc_v.Data;
 }
 
+#ifndef _PAR
+inline void
+  VelocityRepairCL::pre_refine_deferred (RepairSetCL& repair)
+{
+    field_= repair.push_back( stokes_.v, stokes_.GetBndData().Vel);
+}
+
+inline void
+  VelocityRepairCL::pre_repair_deferred (RepairSetCL& repair)
+{
+    loc_vidx_= std::auto_ptr<IdxDescCL>( new IdxDescCL( vecP2_FE));
+    loc_vidx_->CreateNumbering( stokes_.GetMG().GetLastLevel(), stokes_.GetMG(), stokes_.GetBndData().Vel,
+        stokes_.GetMG().GetBnd().GetMatchFun());
+    loc_v_= std::auto_ptr<VecDescCL>( new VecDescCL( loc_vidx_.get()));
+    repair.set_target( field_, *loc_v_);
+}
+
+inline void
+  VelocityRepairCL::post_refine_deferred ()
+{
+    VelVecDescCL& v= stokes_.v;
+    v.Clear( v.t);
+    v.RowIdx->DeleteNumbering( stokes_.GetMG());
+    stokes_.vel_idx.GetFinest().swap( *loc_vidx_);
+    v.SetIdx( &stokes_.vel_idx);
+    v.Data= loc_v_->Data;
+    loc_v_.reset();
+    loc_vidx_.reset();
+}
+#endif
+
 inline void
   VelocityRepairCL::post_refine_sequence ()
   /// Create numbering for all idx level
@@ -209,6 +240,54 @@ inline void
     p.Data= loc_p.Data;
 }
 
+#ifndef _PAR
+inline void
+  PressureRepairCL::pre_refine_deferred (RepairSetCL& repair)
+{
+    field_= repair.push_back( stokes_.p, stokes_.GetBndData().Pr);
+}
+
+inline void
+  PressureRepairCL::pre_repair_deferred (RepairSetCL& repair)
+{
+    loc_pidx_= std::auto_ptr<IdxDescCL>( new IdxDescCL( stokes_.UsesXFEM() ? P1_FE : stokes_.GetPrFE()));
+    loc_pidx_->CreateNumbering( stokes_.GetMG().GetLastLevel(), stokes_.GetMG(), stokes_.GetBndData().Pr,
+        stokes_.GetMG().GetBnd().GetMatchFun());
+    loc_p_= std::auto_ptr<VecDescCL>( new VecDescCL( loc_pidx_.get()));
+    repair.set_target( field_, *loc_p_);
+}
+
+inline void
+  PressureRepairCL::post_refine_deferred ()
+  /// The P1-part is repaired; the extended part is repaired by p1xrepair_ in post_refine_sequence().
+{
+    VecDescCL& p= stokes_.p;
+    MultiGridCL& mg= stokes_.GetMG();
+    p.Clear( p.t);
+    p.RowIdx->DeleteNumbering( mg);
+    if (stokes_.UsesXFEM()) { // The extended numbering requires the repaired level set function.
+        IdxDescCL loc_xidx( stokes_.GetPrFE());
+        loc_xidx.CreateNumbering( mg.GetLastLevel(), mg, stokes_.GetBndData().Pr, mg.GetBnd().GetMatchFun(), &ls_.Phi, &ls_.GetBndData());
+        VectorCL xdata( loc_xidx.NumUnknowns());
+        const Uint idx= loc_pidx_->GetIdx(), xidx= loc_xidx.GetIdx();
+        DROPS_FOR_TRIANG_VERTEX( mg, mg.GetLastLevel(), it)
+            if (it->Unknowns.Exist( idx))
+                xdata[it->Unknowns( xidx)]= loc_p_->Data[it->Unknowns( idx)];
+        loc_pidx_->DeleteNumbering( mg);
+        stokes_.pr_idx.GetFinest().swap( loc_xidx);
+        p.SetIdx( &stokes_.pr_idx);
+        p.Data= xdata;
+    }
+    else {
+        stokes_.pr_idx.GetFinest().swap( *loc_pidx_);
+        p.SetIdx( &stokes_.pr_idx);
+        p.Data= loc_p_->Data;
+    }
+    loc_p_.reset();
+    loc_pidx_.reset();
+}
+#endif
+
 inline void
   PressureRepairCL::pre_refine_sequence ()
 {
@@ -123,6 +123,7 @@ void BDinvBTPreCL::Update() const
     std::cout << "BDinvBTPreCL::Update: old/new versions: " << Lversion_  << '/' << L_->Version()
         << '\t' << Bversion_ << '/' << B_->Version() << '\t' << Mversion_ << '/' << M_->Version()
         << '\t' << Mvelversion_ << '/' << Mvel_->Version() << '\n';
+    const bool sameB= Bs_ != 0 && Bversion_ == B_->Version() && S_.num_rows() > 0; // the pattern of S_ depends only on B
     delete Bs_;
     Bs_= new MatrixCL( *B_);
     Lversion_= L_->Version();
@@ -154,6 +155,8 @@ void BDinvBTPreCL::Update() const
         Dvelinv_[std::slice( 0, tmp.size(), 1)]= tmp;
         Dvelinv_[tmp.size()]= 1.;
     }
+    if (explicit_)
+        BDinvBT( *Bs_, Dvelinv_, S_, sameB);
 }
 
 BDinvBTPreCL::~BDinvBTPreCL() 
@@ -625,6 +625,8 @@ class BDinvBTPreCL: public SchurPreBaseCL
     const IdxDescCL* pr_idx_;                                   ///< Used to determine, how to represent the kernel of BB^T in case of pure Dirichlet-BCs.
     double regularize_;
     bool lumped_;
+    bool explicit_;                                             ///< true: B D^{-1} B^T is assembled as sparse matrix S_ by BDinvBT
+    mutable MatrixCL S_;
 
     void Update () const;
 
@@ -635,7 +637,7 @@ class BDinvBTPreCL: public SchurPreBaseCL
           Lversion_( 0), Bversion_( 0), Mvelversion_( 0), Mversion_( 0), tol_(tol),
           diagVelPc_(Dvelinv_), diagSchurPc_(DSchurinv_), BDinvBT_(0),
           solver_( diagSchurPc_, 200,  tol_, /*relative*/ true), pr_idx_( &pr_idx),
-          regularize_( regularize), lumped_(false) {}
+          regularize_( regularize), lumped_(false), explicit_( false) {}
 
     BDinvBTPreCL (const BDinvBTPreCL & pc)
         : SchurPreBaseCL( pc.kA_, pc.kM_), L_( pc.L_), B_( pc.B_), Mvel_( pc.Mvel_), M_( pc.M_),
@@ -644,7 +646,7 @@ class BDinvBTPreCL: public SchurPreBaseCL
           Dprsqrtinv_( pc.Dprsqrtinv_), Dvelinv_( pc.Dvelinv_), DSchurinv_( pc.DSchurinv_), tol_(pc.tol_),
           diagVelPc_( Dvelinv_), diagSchurPc_( DSchurinv_), BDinvBT_(0),
           solver_( diagSchurPc_, 200, tol_, /*relative*/ true), pr_idx_( pc.pr_idx_),
-          regularize_( pc.regularize_), lumped_( pc.lumped_) {}
+          regularize_( pc.regularize_), lumped_( pc.lumped_), explicit_( pc.explicit_) {}
 
     BDinvBTPreCL& operator= (const BDinvBTPreCL&) {
         throw DROPSErrCL( "BDinvBTPreCL::operator= is not permitted.\n");
@@ -671,6 +673,9 @@ class BDinvBTPreCL: public SchurPreBaseCL
     bool UsesMassLumping() const { return lumped_; }
     /// For lump==true, the lumped diag of the velocity mass matrix is used. Otherwise the diagonal of the velocity convection-diffusion-reaction matrix is considered.
     void SetMassLumping( bool lump) { lumped_= lump; }
+    /// For expl==true, B D^{-1} B^T is assembled as a sparse matrix instead of being applied with B and B^T in each iteration.
+    void SetExplicit( bool expl) { explicit_= expl; Lversion_= 0; }
+    bool IsExplicit() const { return explicit_; }
     /// If lumping is switched on, the lumped diag of the velocity mass matrix is returned. Otherwise the diagonal of the velocity convection-diffusion-reaction matrix is returned.
     VectorCL GetVelDiag() const { 
         if ((L_->Version() != Lversion_) || (Mvel_->Version() != Mvelversion_))
@@ -687,7 +692,10 @@ template <typename Mat, typename Vec>
         Update();
 
     Vec y( b.size());
-    solver_.Solve( *BDinvBT_, y, Vec( Dprsqrtinv_*b));
+    if (explicit_)
+        solver_.Solve( S_, y, Vec( Dprsqrtinv_*b));
+    else
+        solver_.Solve( *BDinvBT_, y, Vec( Dprsqrtinv_*b));
     if (solver_.GetIter() == solver_.GetMaxIter())
         std::cout << "BDinvBTPreCL::Apply: BLBT-solve: " << solver_.GetIter()
                   << '\t' << solver_.GetResid() << '\n';
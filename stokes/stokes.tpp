@@ -236,6 +236,7 @@ template< class CoeffT>
 class StokesSystem1Accumulator_P2CL : public TetraAccumulatorCL
 {
   private:
+    const MultiGridCL& MG;
     const CoeffT& Coeff;
     const StokesBndDataCL& BndData;
     double t;
@@ -247,6 +248,8 @@ class StokesSystem1Accumulator_P2CL : public TetraAccumulatorCL
     VecDescCL* cplM;
     VecDescCL* b;
 
+    const TetraGeometryCL* geom_; ///< cached transformations of the tetras
+
     SparseMatBuilderCL<double, SDiagMatrixCL<3> >* mA_;
     SparseMatBuilderCL<double, SDiagMatrixCL<3> >* mM_;
 
@@ -262,13 +265,18 @@ class StokesSystem1Accumulator_P2CL : public TetraAccumulatorCL
     Quad2CL<Point3DCL> rhs;
     Point3DCL loc_b[10], dirichlet_val[10]; ///< Used to transfer boundary-values from local_setup() update_global_system().
 
+    P2BatchDiscCL::LaneT batch_T[9], batch_absdet; ///< transformations of a batch of tetras
+    P2BatchDiscCL::LaneT batch_A[10][10], batch_M[10][10]; ///< local matrices of a batch of tetras
+
     ///\brief Computes the mapping from local to global data "n", the local matrices in loc and, if required, the Dirichlet-values needed to eliminate the boundary-dof from the global system.
     void local_setup (const TetraCL& tet);
+    ///\brief Computes "n", the local load vector and the Dirichlet-values; used by local_setup and visit_batch. absdet must be set.
+    void local_setup_vectors (const TetraCL& tet);
     ///\brief Update the global system.
     void update_global_system ();
 
   public:
-    StokesSystem1Accumulator_P2CL (const CoeffT& Coeff, const StokesBndDataCL& BndData_,
+    StokesSystem1Accumulator_P2CL (const MultiGridCL& MG_, const CoeffT& Coeff, const StokesBndDataCL& BndData_,
         IdxDescCL& RowIdx_, MatrixCL& A_, MatrixCL& M_,
         VecDescCL* b_, VecDescCL* cplA_, VecDescCL* cplM_, double t);
 
@@ -278,21 +286,25 @@ class StokesSystem1Accumulator_P2CL : public TetraAccumulatorCL
     void finalize_accumulation();
 
     void visit (const TetraCL& sit);
+    ///\brief Computes the local matrices of P2BatchDiscCL::BatchC tetras at once.
+    void visit_batch (const TetraCL* const* tet, Uint num);
+    bool supports_batch () const { return true; }
 
     TetraAccumulatorCL* clone (int /*tid*/) { return new StokesSystem1Accumulator_P2CL ( *this); };
 };
 
 template< class CoeffT>
-StokesSystem1Accumulator_P2CL<CoeffT>::StokesSystem1Accumulator_P2CL (const CoeffT& Coeff_, const StokesBndDataCL& BndData_,
+StokesSystem1Accumulator_P2CL<CoeffT>::StokesSystem1Accumulator_P2CL (const MultiGridCL& MG_, const CoeffT& Coeff_, const StokesBndDataCL& BndData_,
     IdxDescCL& RowIdx_, MatrixCL& A_, MatrixCL& M_,
     VelVecDescCL* b_, VelVecDescCL* cplA_, VelVecDescCL* cplM_, double t_)
-    : Coeff( Coeff_), BndData( BndData_), t( t_),
-      RowIdx( RowIdx_), A( A_), M( M_), cplA( cplA_), cplM( cplM_), b( b_)
+    : MG( MG_), Coeff( Coeff_), BndData( BndData_), t( t_),
+      RowIdx( RowIdx_), A( A_), M( M_), cplA( cplA_), cplM( cplM_), b( b_), geom_( 0)
 {}
 
 template< class CoeffT>
 void StokesSystem1Accumulator_P2CL<CoeffT>::begin_accumulation ()
 {
+    geom_= &MG.GetTetraGeometry( RowIdx.TriangLevel());
     const size_t num_unks_vel= RowIdx.NumUnknowns();
     mA_= new SparseMatBuilderCL<double, SDiagMatrixCL<3> >( &A, num_unks_vel, num_unks_vel);
     mM_= new SparseMatBuilderCL<double, SDiagMatrixCL<3> >( &M, num_unks_vel, num_unks_vel);
@@ -319,19 +331,56 @@ void StokesSystem1Accumulator_P2CL<CoeffT>::visit (const TetraCL& tet)
     update_global_system();
 }
 
+template< class CoeffT>
+void StokesSystem1Accumulator_P2CL<CoeffT>::visit_batch (const TetraCL* const* tet, Uint num)
+{
+    for (Uint first= 0; first < num; first+= P2BatchDiscCL::BatchC) {
+        const Uint lanes= std::min<Uint>( num - first, P2BatchDiscCL::BatchC);
+        for (Uint l= 0; l < P2BatchDiscCL::BatchC; ++l) {
+            if (l < lanes)
+                geom_->GetTrafoTr( T, det, *tet[first + l]);
+            else { // padding
+                T= SMatrixCL<3,3>( 0.);
+                det= 0.;
+            }
+            for (Uint k= 0; k < 9; ++k)
+                batch_T[k][l]= T[k];
+            batch_absdet[l]= std::fabs( det);
+        }
+        P2BatchDiscCL::GetStiffness( batch_T, batch_absdet, batch_A);
+        P2BatchDiscCL::GetMass( batch_absdet, batch_M);
+        for (Uint l= 0; l < lanes; ++l) {
+            for (Uint i= 0; i < 10; ++i)
+                for (Uint j= 0; j < 10; ++j) {
+                    loc.A[i][j]= Coeff.nu*batch_A[i][j][l];
+                    loc.M[i][j]= batch_M[i][j][l];
+                }
+            absdet= batch_absdet[l];
+            local_setup_vectors( *tet[first + l]);
+            update_global_system();
+        }
+    }
+}
+
 template< class CoeffT>
 void StokesSystem1Accumulator_P2CL<CoeffT>::local_setup (const TetraCL& tet)
 {
-    GetTrafoTr( T, det, tet);
+    geom_->GetTrafoTr( T, det, tet);
     absdet= std::fabs( det);
 
-    rhs.assign( tet, Coeff.f, t);
-    n.assign( tet, RowIdx, BndData.Vel);
-
     local_onephase.mu(  Coeff.nu);
     local_onephase.rho( 1.0);
     local_onephase.setup( T, absdet, loc);
 
+    local_setup_vectors( tet);
+}
+
+template< class CoeffT>
+void StokesSystem1Accumulator_P2CL<CoeffT>::local_setup_vectors (const TetraCL& tet)
+{
+    rhs.assign( tet, Coeff.f, t);
+    n.assign( tet, RowIdx, BndData.Vel);
+
     if (b != 0) {
         for (int i= 0; i < 10; ++i) {
             if (!n.WithUnknowns( i)) {
@@ -374,7 +423,8 @@ void SetupSystem1_P2( const MultiGridCL& MG_, const CoeffT& Coeff_, const Stokes
                       VecDescCL* b, VecDescCL* cplA, VecDescCL* cplM, IdxDescCL& RowIdx, double t)
 /// Set up matrices A, M and rhs b (depending on phase bnd)
 {
-    StokesSystem1Accumulator_P2CL<CoeffT> accu( Coeff_, BndData_, RowIdx, A, M, b, cplA, cplM, t);
+    RowIdx.BuildTetraDoFMap( MG_, BndData_.Vel);
+    StokesSystem1Accumulator_P2CL<CoeffT> accu( MG_, Coeff_, BndData_, RowIdx, A, M, b, cplA, cplM, t);
     TetraAccumulatorTupleCL accus;
     accus.push_back( &accu);
     accumulate( accus, MG_, RowIdx.TriangLevel(), RowIdx.GetMatchingFunction(), RowIdx.GetBndInfo());
@@ -405,6 +455,7 @@ template<class CoeffT>
 class System2Accumulator_P2P1CL : public TetraAccumulatorCL
 {
   protected:
+    const MultiGridCL& MG;
     const PrincipalLatticeCL& lat;
     const CoeffT& coeff;
     const StokesBndDataCL& BndData;
@@ -422,6 +473,7 @@ class System2Accumulator_P2P1CL : public TetraAccumulatorCL
     SparseMatBuilderCL<double, SMatrixCL<1,3> >* mB_;
     VecDescCL*                                   c;
 
+    const TetraGeometryCL* geom_; ///< cached transformations of the tetras
     SMatrixCL<3,3> T;
     double         absdet;
 
@@ -436,7 +488,7 @@ class System2Accumulator_P2P1CL : public TetraAccumulatorCL
     void update_global_system ();
 
   public:
-    System2Accumulator_P2P1CL (const CoeffT& coeff_arg, const StokesBndDataCL& BndData_arg,
+    System2Accumulator_P2P1CL (const MultiGridCL& MG_arg, const CoeffT& coeff_arg, const StokesBndDataCL& BndData_arg,
         const IdxDescCL& RowIdx_arg, const IdxDescCL& ColIdx_arg,
         MatrixCL& B_arg, VecDescCL* c_arg, double t_arg);
 
@@ -451,10 +503,10 @@ class System2Accumulator_P2P1CL : public TetraAccumulatorCL
 };
 
 template< class CoeffT>
-System2Accumulator_P2P1CL<CoeffT>::System2Accumulator_P2P1CL ( const CoeffT& coeff_arg, const StokesBndDataCL& BndData_arg,
+System2Accumulator_P2P1CL<CoeffT>::System2Accumulator_P2P1CL ( const MultiGridCL& MG_arg, const CoeffT& coeff_arg, const StokesBndDataCL& BndData_arg,
     const IdxDescCL& RowIdx_arg, const IdxDescCL& ColIdx_arg,
     MatrixCL& B_arg, VecDescCL* c_arg, double t_arg)
-    : lat( PrincipalLatticeCL::instance( 2)), coeff( coeff_arg), BndData( BndData_arg), t( t_arg), RowIdx( RowIdx_arg), ColIdx( ColIdx_arg), B( B_arg)
+    : MG( MG_arg), lat( PrincipalLatticeCL::instance( 2)), coeff( coeff_arg), BndData( BndData_arg), t( t_arg), RowIdx( RowIdx_arg), ColIdx( ColIdx_arg), B( B_arg), geom_( 0)
 {
     c = c_arg;
     P2DiscCL::GetGradientsOnRef( GradRef);
@@ -463,6 +515,7 @@ System2Accumulator_P2P1CL<CoeffT>::System2Accumulator_P2P1CL ( const CoeffT& coe
 template< class CoeffT>
 void System2Accumulator_P2P1CL<CoeffT>::begin_accumulation ()
 {
+    geom_= &MG.GetTetraGeometry( ColIdx.TriangLevel());
     mB_ = new SparseMatBuilderCL<double, SMatrixCL<1,3> > ( &B, RowIdx.NumUnknowns(), ColIdx.NumUnknowns());
     if (c != 0) c->Clear( t);
 }
@@ -478,7 +531,7 @@ template< class CoeffT>
 void System2Accumulator_P2P1CL<CoeffT>::visit (const TetraCL& tet)
 {
     double det;
-    GetTrafoTr( T, det, tet);
+    geom_->GetTrafoTr( T, det, tet);
     P2DiscCL::GetGradients( Grad, GradRef, T);
     absdet= std::fabs( det);
     n.assign( tet, ColIdx, BndData.Vel);
@@ -528,7 +581,8 @@ void SetupSystem2_P2P1( const MultiGridCL& MG, const CoeffT& coeff, const Stokes
         IdxDescCL* RowIdx, IdxDescCL* ColIdx, double t)
 /// Set up matrices B and rhs c
 {
-    System2Accumulator_P2P1CL<CoeffT> accu( coeff, BndData, *RowIdx, *ColIdx, *B, c, t);
+    ColIdx->BuildTetraDoFMap( MG, BndData.Vel);
+    System2Accumulator_P2P1CL<CoeffT> accu( MG, coeff, BndData, *RowIdx, *ColIdx, *B, c, t);
     TetraAccumulatorTupleCL accus;
     accus.push_back( &accu);
     accumulate( accus, MG, RowIdx->TriangLevel(), RowIdx->GetMatchingFunction(), RowIdx->GetBndInfo());
@@ -553,6 +607,7 @@ void StokesP2P1CL<CoeffT>::SetupSystem2( MLMatDescCL* B, VecDescCL* c, double t)
         std::cout << "entering SetupSystem2: " << itRow->NumUnknowns() << " prs, " << itCol->NumUnknowns() << " vels. ";
 #endif
         VecDescCL* rhsPtr= itB==B->Data.GetFinestIter() ? c : 0; // setup rhs only on finest level
+        itB->KeepTranspose(); // B^T is applied in every iteration of the Stokes solvers
         SetupSystem2_P2P1 ( MG_, Coeff_, BndData_, &(*itB), rhsPtr, &(*itRow), &(*itCol), t);
 #ifndef _PAR
         std::cout << itB->num_nonzeros() << " nonzeros in B!" << std::endl;
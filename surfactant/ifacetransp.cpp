@@ -27,6 +27,7 @@
 #include "surfactant/ifacetransp.h"
 #include "levelset/levelset.h"
 #include "num/spmat.h"
+#include "num/accumulator.h"
 #include <cstring>
 #include <cmath>
 
@@ -40,9 +41,18 @@ void Extend (const MultiGridCL& mg, const VecDescCL& x, VecDescCL& xext)
         lvl( x.RowIdx->TriangLevel());
     xext.Data= 0.;
 
-    DROPS_FOR_TRIANG_CONST_VERTEX( mg, lvl, it) {
-        if (it->Unknowns.Exist( xidx) && it->Unknowns.Exist( xextidx))
-            xext.Data[it->Unknowns( xextidx)]= x.Data[it->Unknowns( xidx)];
+    const MultiGridCL::const_TriangVertexIteratorCL begin= mg.GetTriangVertexBegin( lvl);
+    const size_t num_verts= std::distance( begin, mg.GetTriangVertexEnd( lvl));
+#ifndef DROPS_WIN
+    size_t i;
+#else
+    int i;
+#endif
+#   pragma omp parallel for
+    for (i= 0; i < num_verts; ++i) {
+        const VertexCL& v= *(begin + i);
+        if (v.Unknowns.Exist( xidx) && v.Unknowns.Exist( xextidx))
+            xext.Data[v.Unknowns( xextidx)]= x.Data[v.Unknowns( xidx)];
     }
 }
 
@@ -52,9 +62,18 @@ void Restrict (const MultiGridCL& mg, const VecDescCL& xext, VecDescCL& x)
         xextidx( xext.RowIdx->GetIdx()),
         lvl( x.RowIdx->TriangLevel());
 
-    DROPS_FOR_TRIANG_CONST_VERTEX( mg, lvl, it) {
-        if (it->Unknowns.Exist( xidx) && it->Unknowns.Exist( xextidx))
-            x.Data[it->Unknowns( xidx)]= xext.Data[it->Unknowns( xextidx)];
+    const MultiGridCL::const_TriangVertexIteratorCL begin= mg.GetTriangVertexBegin( lvl);
+    const size_t num_verts= std::distance( begin, mg.GetTriangVertexEnd( lvl));
+#ifndef DROPS_WIN
+    size_t i;
+#else
+    int i;
+#endif
+#   pragma omp parallel for
+    for (i= 0; i < num_verts; ++i) {
+        const VertexCL& v= *(begin + i);
+        if (v.Unknowns.Exist( xidx) && v.Unknowns.Exist( xextidx))
+            x.Data[v.Unknowns( xidx)]= xext.Data[v.Unknowns( xextidx)];
     }
 }
 
@@ -81,36 +100,51 @@ void SetupInterfaceMassP1OnTriangle (const LocalP1CL<> p1[4],
     }
 }
 
-void SetupInterfaceMassP1 (const MultiGridCL& MG, MatDescCL* matM, const VecDescCL& ls, const BndDataCL<>& lsetbnd)
+/// \brief Scatters the interface mass matrix of a tetra; used with scatter_tetras.
+class InterfaceMassScatterCL
 {
-    const IdxT num_unks=  matM->RowIdx->NumUnknowns();
-    MatrixBuilderCL M( &matM->Data, num_unks,  num_unks);
-
-    const Uint lvl= matM->GetRowLevel();
-    IdxT Numb[4];
-
-    double det;
+  private:
+    MatrixBuilderCL& M_;
+    const IdxDescCL& idx_;
+    const VecDescCL& ls_;
+    const BndDataCL<>& lsetbnd_;
     LocalP1CL<> p1[4];
-    p1[0][0]= p1[1][1]= p1[2][2]= p1[3][3]= 1.; // P1-Basis-Functions
-    Quad5_2DCL<double> q[4], m;
-
+    Quad5_2DCL<double> q[4];
     InterfaceTriangleCL triangle;
-    DROPS_FOR_TRIANG_CONST_TETRA( MG, lvl, it) {
-        triangle.Init( *it, ls, lsetbnd);
 
-        GetLocalNumbP1NoBnd( Numb, *it, *matM->RowIdx);
+  public:
+    InterfaceMassScatterCL (MatrixBuilderCL& M, const IdxDescCL& idx, const VecDescCL& ls, const BndDataCL<>& lsetbnd)
+        : M_( M), idx_( idx), ls_( ls), lsetbnd_( lsetbnd) {
+        p1[0][0]= p1[1][1]= p1[2][2]= p1[3][3]= 1.; // P1-Basis-Functions
+    }
+
+    void operator() (const TetraCL& t) {
+        IdxT Numb[4];
+        double det;
+        triangle.Init( t, ls_, lsetbnd_);
+
+        GetLocalNumbP1NoBnd( Numb, t, idx_);
         for (int ch= 0; ch < 8; ++ch) {
             if (!triangle.ComputeForChild( ch)) // no patch for this child
                 continue;
 
             det= triangle.GetAbsDet();
-            SetupInterfaceMassP1OnTriangle( p1, q, M, Numb, &triangle.GetBary( 0), det);
+            SetupInterfaceMassP1OnTriangle( p1, q, M_, Numb, &triangle.GetBary( 0), det);
             if (triangle.IsQuadrilateral()) {
                 det*= triangle.GetAreaFrac();
-                SetupInterfaceMassP1OnTriangle( p1, q, M, Numb, &triangle.GetBary( 1), det);
+                SetupInterfaceMassP1OnTriangle( p1, q, M_, Numb, &triangle.GetBary( 1), det);
             }
         }
-   }
+    }
+};
+
+void SetupInterfaceMassP1 (const MultiGridCL& MG, MatDescCL* matM, const VecDescCL& ls, const BndDataCL<>& lsetbnd)
+{
+    const IdxT num_unks=  matM->RowIdx->NumUnknowns();
+    MatrixBuilderCL M( &matM->Data, num_unks,  num_unks);
+
+    InterfaceMassScatterCL scatter( M, *matM->RowIdx, ls, lsetbnd);
+    scatter_tetras( MG, matM->GetRowLevel(), matM->RowIdx->GetMatchingFunction(), matM->RowIdx->GetBndInfo(), scatter);
     M.Build();
 }
 
@@ -128,47 +162,60 @@ void SetupLBP1OnTriangle (InterfaceTriangleCL& triangle, int tri, Point3DCL grad
         }
 }
 
+/// \brief Scatters the Laplace-Beltrami matrix of a tetra; used with scatter_tetras.
+class LBScatterCL
+{
+  private:
+    MatrixBuilderCL& M_;
+    const IdxDescCL& rowidx_;
+    const IdxDescCL& colidx_;
+    const VecDescCL& ls_;
+    const BndDataCL<>& lsetbnd_;
+    InterfaceTriangleCL triangle;
+
+  public:
+    LBScatterCL (MatrixBuilderCL& M, const IdxDescCL& rowidx, const IdxDescCL& colidx, const VecDescCL& ls, const BndDataCL<>& lsetbnd)
+        : M_( M), rowidx_( rowidx), colidx_( colidx), ls_( ls), lsetbnd_( lsetbnd) {}
+
+    void operator() (const TetraCL& t) {
+        triangle.Init( t, ls_, lsetbnd_);
+        if (!triangle.Intersects()) return; // We are not at the phase boundary.
+
+        IdxT numr[4], numc[4];
+        Point3DCL grad[4];
+        double coup[4][4];
+        double dummy;
+        GetLocalNumbP1NoBnd( numr, t, rowidx_);
+        GetLocalNumbP1NoBnd( numc, t, colidx_);
+        P1DiscCL::GetGradients( grad, dummy, t);
+        std::memset( coup, 0, 4*4*sizeof( double));
+
+        for (int ch= 0; ch < 8; ++ch) {
+            triangle.ComputeForChild( ch);
+            for (int tri= 0; tri < triangle.GetNumTriangles(); ++tri)
+                SetupLBP1OnTriangle( triangle, tri, grad, coup);
+        }
+
+        for(int i= 0; i < 4; ++i) {// assemble row Numb[i]
+            if (numr[i] == NoIdx) continue;
+            for(int j= 0; j < 4; ++j) {
+                if (numc[j] == NoIdx) continue;
+                M_( numr[i],   numc[j])+= coup[j][i];
+            }
+        }
+    }
+};
+
 void SetupLBP1 (const MultiGridCL& mg, MatDescCL* mat, const VecDescCL& ls, const BndDataCL<>& lsetbnd, double D)
 {
     const IdxT num_rows= mat->RowIdx->NumUnknowns();
     const IdxT num_cols= mat->ColIdx->NumUnknowns();
     MatrixBuilderCL M( &mat->Data, num_rows, num_cols);
-    const Uint lvl = mat->GetRowLevel();
-
-    IdxT numr[4], numc[4];
 
     std::cout << "entering SetupLBP1: " << num_rows << " rows, " << num_cols << " cols. ";
 
-    Point3DCL grad[4];
-
-    double coup[4][4];
-    double dummy;
-
-    InterfaceTriangleCL triangle;
-
-    DROPS_FOR_TRIANG_CONST_TETRA( mg, lvl, it) {
-    	triangle.Init( *it, ls, lsetbnd);
-        if (triangle.Intersects()) { // We are at the phase boundary.
-            GetLocalNumbP1NoBnd( numr, *it, *mat->RowIdx);
-            GetLocalNumbP1NoBnd( numc, *it, *mat->ColIdx);
-            P1DiscCL::GetGradients( grad, dummy, *it);
-            std::memset( coup, 0, 4*4*sizeof( double));
-
-            for (int ch= 0; ch < 8; ++ch) {
-            	triangle.ComputeForChild( ch);
-                for (int tri= 0; tri < triangle.GetNumTriangles(); ++tri)
-                    SetupLBP1OnTriangle( triangle, tri, grad, coup);
-            }
-
-            for(int i= 0; i < 4; ++i) {// assemble row Numb[i]
-                if (numr[i] == NoIdx) continue;
-                for(int j= 0; j < 4; ++j) {
-                    if (numc[j] == NoIdx) continue;
-                    M( numr[i],   numc[j])+= coup[j][i];
-                }
-            }
-        }
-    }
+    LBScatterCL scatter( M, *mat->RowIdx, *mat->ColIdx, ls, lsetbnd);
+    scatter_tetras( mg, mat->GetRowLevel(), mat->RowIdx->GetMatchingFunction(), mat->RowIdx->GetBndInfo(), scatter);
     M.Build();
     mat->Data*= D; // diffusion coefficient
     std::cout << mat->Data.num_nonzeros() << " nonzeros in A_LB" << std::endl;
@@ -242,33 +289,37 @@ void SetupMixedMassP1OnTriangle (const BaryCoordCL triangle[3], double det,
     }
 }
 
-void SetupMixedMassP1 (const MultiGridCL& mg, MatDescCL* mat, const VecDescCL& ls, const BndDataCL<>& lsetbnd)
+/// \brief Scatters the mixed interface mass matrix of a tetra; used with scatter_tetras.
+class MixedMassScatterCL
 {
-    const IdxT rows= mat->RowIdx->NumUnknowns(),
-               cols= mat->ColIdx->NumUnknowns();
-    MatrixBuilderCL m( &mat->Data, rows, cols);
-    const Uint lvl= mat->GetRowLevel();
-    IdxT rownum[4], colnum[4];
-
-    std::cerr << "entering SetupMixedMassP1: " << rows << " rows, " << cols << " cols. ";
-
+  private:
+    MatrixBuilderCL& m_;
+    const IdxDescCL& rowidx_;
+    const IdxDescCL& colidx_;
+    const VecDescCL& ls_;
+    const BndDataCL<>& lsetbnd_;
     LocalP1CL<> p1[4];
-    p1[0][0]= p1[1][1]= p1[2][2]= p1[3][3]= 1.; // P1-Basis-Functions
     Quad5_2DCL<double> qp1[4];
-
-    double coup[4][4];
     InterfaceTriangleCL triangle;
 
-    DROPS_FOR_TRIANG_CONST_TETRA( mg, lvl, it) {
-    	triangle.Init( *it, ls, lsetbnd);
-        if (!triangle.Intersects()) continue; // We are at the phase boundary.
+  public:
+    MixedMassScatterCL (MatrixBuilderCL& m, const IdxDescCL& rowidx, const IdxDescCL& colidx, const VecDescCL& ls, const BndDataCL<>& lsetbnd)
+        : m_( m), rowidx_( rowidx), colidx_( colidx), ls_( ls), lsetbnd_( lsetbnd) {
+        p1[0][0]= p1[1][1]= p1[2][2]= p1[3][3]= 1.; // P1-Basis-Functions
+    }
 
-        GetLocalNumbP1NoBnd( rownum, *it, *mat->RowIdx);
-        GetLocalNumbP1NoBnd( colnum, *it, *mat->ColIdx);
+    void operator() (const TetraCL& t) {
+        triangle.Init( t, ls_, lsetbnd_);
+        if (!triangle.Intersects()) return; // We are not at the phase boundary.
+
+        IdxT rownum[4], colnum[4];
+        double coup[4][4];
+        GetLocalNumbP1NoBnd( rownum, t, rowidx_);
+        GetLocalNumbP1NoBnd( colnum, t, colidx_);
         std::memset( coup, 0, 4*4*sizeof( double));
 
         for (int ch= 0; ch < 8; ++ch) {
-        	triangle.ComputeForChild( ch);
+            triangle.ComputeForChild( ch);
             for (int tri= 0; tri < triangle.GetNumTriangles(); ++tri)
                 SetupMixedMassP1OnTriangle ( &triangle.GetBary( tri), triangle.GetAbsDet( tri), p1, qp1, coup);
         }
@@ -277,43 +328,68 @@ void SetupMixedMassP1 (const MultiGridCL& mg, MatDescCL* mat, const VecDescCL& l
             if (rownum[i] == NoIdx) continue;
             for(int j= 0; j < 4; ++j) {
                 if (colnum[j] == NoIdx) continue;
-                m( rownum[i], colnum[j])+= coup[i][j];
+                m_( rownum[i], colnum[j])+= coup[i][j];
             }
         }
     }
-    m.Build();
-    std::cerr << mat->Data.num_nonzeros() << " nonzeros in mixed mass-divergence matrix!" << std::endl;
-}
+};
 
-void SetupInterfaceRhsP1 (const MultiGridCL& mg, VecDescCL* v,
-    const VecDescCL& ls, const BndDataCL<>& lsetbnd, instat_scalar_fun_ptr f)
+void SetupMixedMassP1 (const MultiGridCL& mg, MatDescCL* mat, const VecDescCL& ls, const BndDataCL<>& lsetbnd)
 {
-    const IdxT num_unks= v->RowIdx->NumUnknowns();
-    const Uint lvl = v->GetLevel();
+    const IdxT rows= mat->RowIdx->NumUnknowns(),
+               cols= mat->ColIdx->NumUnknowns();
+    MatrixBuilderCL m( &mat->Data, rows, cols);
 
-    IdxT num[4];
+    std::cerr << "entering SetupMixedMassP1: " << rows << " rows, " << cols << " cols. ";
 
-    std::cout << "entering SetupInterfaceRhsP1: " << num_unks << " dof... ";
+    MixedMassScatterCL scatter( m, *mat->RowIdx, *mat->ColIdx, ls, lsetbnd);
+    scatter_tetras( mg, mat->GetRowLevel(), mat->RowIdx->GetMatchingFunction(), mat->RowIdx->GetBndInfo(), scatter);
+    m.Build();
+    std::cerr << mat->Data.num_nonzeros() << " nonzeros in mixed mass-divergence matrix!" << std::endl;
+}
 
+/// \brief Scatters the interface right-hand side of a tetra; used with scatter_tetras.
+class InterfaceRhsScatterCL
+{
+  private:
+    VecDescCL& v_;
+    const VecDescCL& ls_;
+    const BndDataCL<>& lsetbnd_;
+    instat_scalar_fun_ptr f_;
     LocalP1CL<> p1[4];
-    p1[0][0]= p1[1][1]= p1[2][2]= p1[3][3]= 1.; // P1-Basis-Functions
-    Quad5_2DCL<double> q[4], m;
-
+    Quad5_2DCL<double> q[4];
     InterfaceTriangleCL triangle;
 
-    DROPS_FOR_TRIANG_CONST_TETRA( mg, lvl, it) {
-        triangle.Init( *it, ls, lsetbnd);
-        if (triangle.Intersects()) { // We are at the phase boundary.
-            GetLocalNumbP1NoBnd( num, *it, *v->RowIdx);
+  public:
+    InterfaceRhsScatterCL (VecDescCL& v, const VecDescCL& ls, const BndDataCL<>& lsetbnd, instat_scalar_fun_ptr f)
+        : v_( v), ls_( ls), lsetbnd_( lsetbnd), f_( f) {
+        p1[0][0]= p1[1][1]= p1[2][2]= p1[3][3]= 1.; // P1-Basis-Functions
+    }
 
-            for (int ch= 0; ch < 8; ++ch) {
-                triangle.ComputeForChild( ch);
-                for (int tri= 0; tri < triangle.GetNumTriangles(); ++tri)
-                    SetupInterfaceRhsP1OnTriangle( p1, q, v->Data, num,
-                        *it, &triangle.GetBary( tri), triangle.GetAbsDet( tri), f);
-            }
+    void operator() (const TetraCL& t) {
+        triangle.Init( t, ls_, lsetbnd_);
+        if (!triangle.Intersects()) return; // We are not at the phase boundary.
+
+        IdxT num[4];
+        GetLocalNumbP1NoBnd( num, t, *v_.RowIdx);
+        for (int ch= 0; ch < 8; ++ch) {
+            triangle.ComputeForChild( ch);
+            for (int tri= 0; tri < triangle.GetNumTriangles(); ++tri)
+                SetupInterfaceRhsP1OnTriangle( p1, q, v_.Data, num,
+                    t, &triangle.GetBary( tri), triangle.GetAbsDet( tri), f_);
         }
     }
+};
+
+void SetupInterfaceRhsP1 (const MultiGridCL& mg, VecDescCL* v,
+    const VecDescCL& ls, const BndDataCL<>& lsetbnd, instat_scalar_fun_ptr f)
+{
+    const IdxT num_unks= v->RowIdx->NumUnknowns();
+
+    std::cout << "entering SetupInterfaceRhsP1: " << num_unks << " dof... ";
+
+    InterfaceRhsScatterCL scatter( *v, ls, lsetbnd, f);
+    scatter_tetras( mg, v->GetLevel(), v->RowIdx->GetMatchingFunction(), v->RowIdx->GetBndInfo(), scatter);
     std::cout << " Rhs set up." << std::endl;
 }
 
@@ -323,9 +399,18 @@ void P1Init (instat_scalar_fun_ptr icf, VecDescCL& ic, MultiGridCL& mg, double t
     const Uint lvl= ic.GetLevel(),
                idx= ic.RowIdx->GetIdx();
 
-    DROPS_FOR_TRIANG_VERTEX( mg, lvl, it) {
-        if (it->Unknowns.Exist( idx))
-            ic.Data[it->Unknowns( idx)]= icf( it->GetCoord(), t);
+    const MultiGridCL::TriangVertexIteratorCL begin= mg.GetTriangVertexBegin( lvl);
+    const size_t num_verts= std::distance( begin, mg.GetTriangVertexEnd( lvl));
+#ifndef DROPS_WIN
+    size_t i;
+#else
+    int i;
+#endif
+#   pragma omp parallel for
+    for (i= 0; i < num_verts; ++i) {
+        const VertexCL& v= *(begin + i);
+        if (v.Unknowns.Exist( idx))
+            ic.Data[v.Unknowns( idx)]= icf( v.GetCoord(), t);
     }
 }
 
@@ -413,11 +498,8 @@ void SurfactantcGP1CL::DoStep (const VectorCL& rhs)
 
     if (theta_ == 1.)
         L_.LinComb( theta_, M.Data, dt_*theta_, A.Data, dt_*theta_, Md.Data, dt_*theta_, C.Data);
-    else {
-        MatrixCL m;
-        m.LinComb( theta_, M.Data, dt_*theta_, A.Data, dt_*theta_, Md.Data, dt_*theta_, C.Data);
-        L_.LinComb( 1., m, 1. - theta_, M2.Data);
-    }
+    else
+        L_.LinComb( theta_, M.Data, dt_*theta_, A.Data, dt_*theta_, Md.Data, dt_*theta_, C.Data, 1. - theta_, M2.Data);
     std::cout << "Before solve: res = " << norm( L_*ic.Data - rhs) << std::endl;
     gm_.Solve( L_, ic.Data, rhs);
     std::cout << "res = " << gm_.GetResid() << ", iter = " << gm_.GetIter() << std::endl;
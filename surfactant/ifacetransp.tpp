@@ -23,114 +23,149 @@
 */
 
 #include "levelset/levelset.h"
+#include "num/accumulator.h"
 #include <cstring>
 
 namespace DROPS {
 
+/// \brief Scatters the interface convection matrix of a tetra; used with scatter_tetras.
 template <class DiscVelSolT>
-void SetupConvectionP1 (const MultiGridCL& mg, MatDescCL* mat, const VecDescCL& ls, const BndDataCL<>& lsetbnd, const DiscVelSolT& u)
+class InterfaceConvectionScatterCL
 {
-    const IdxT num_rows= mat->RowIdx->NumUnknowns();
-    const IdxT num_cols= mat->ColIdx->NumUnknowns();
-    MatrixBuilderCL m( &mat->Data, num_rows, num_cols);
-    const Uint lvl= mat->GetRowLevel();
-    IdxT numr[4], numc[4];
-
-    std::cout << "entering SetupConvectionP1: " << num_rows << " rows, " << num_cols << " cols. ";
-
+  private:
+    MatrixBuilderCL& m_;
+    const IdxDescCL& rowidx_;
+    const IdxDescCL& colidx_;
+    const VecDescCL& ls_;
+    const BndDataCL<>& lsetbnd_;
+    const DiscVelSolT& u_;
     LocalP1CL<> p1[4];
-    p1[0][0]= p1[1][1]= p1[2][2]= p1[3][3]= 1.; // P1-Basis-Functions
     Quad5_2DCL<double> qp1[4];
-
     LocalP2CL<Point3DCL> u_loc;
-    Point3DCL grad[4];
-
-    double coup[4][4];
-    double dummy;
-
     InterfaceTriangleCL triangle;
 
-    DROPS_FOR_TRIANG_CONST_TETRA( mg, lvl, it) {
-        triangle.Init( *it, ls, lsetbnd);
-        if (triangle.Intersects()) { // We are at the phase boundary.
-            GetLocalNumbP1NoBnd( numr, *it, *mat->RowIdx);
-            GetLocalNumbP1NoBnd( numc, *it, *mat->ColIdx);
-            P1DiscCL::GetGradients( grad, dummy, *it);
-            u_loc.assign( *it, u);
-            std::memset( coup, 0, 4*4*sizeof( double));
-
-            for (int ch= 0; ch < 8; ++ch) {
-                triangle.ComputeForChild( ch);
-                for (int tri= 0; tri < triangle.GetNumTriangles(); ++tri)
-                    SetupConvectionP1OnTriangle( &triangle.GetBary( tri), triangle.GetAbsDet( tri),
-                        p1, qp1, u_loc, grad, coup);
-            }
+  public:
+    InterfaceConvectionScatterCL (MatrixBuilderCL& m, const IdxDescCL& rowidx, const IdxDescCL& colidx,
+        const VecDescCL& ls, const BndDataCL<>& lsetbnd, const DiscVelSolT& u)
+        : m_( m), rowidx_( rowidx), colidx_( colidx), ls_( ls), lsetbnd_( lsetbnd), u_( u) {
+        p1[0][0]= p1[1][1]= p1[2][2]= p1[3][3]= 1.; // P1-Basis-Functions
+    }
 
-            for(int i= 0; i < 4; ++i) {// assemble row Numb[i]
-                if (numr[i] == NoIdx) continue;
-                for(int j= 0; j < 4; ++j) {
-                    if (numc[j] == NoIdx) continue;
-                    m( numr[i], numc[j])+= coup[i][j]; // Order of indices is correct as the assemply of coup is adapted.
-                }
+    void operator() (const TetraCL& t) {
+        triangle.Init( t, ls_, lsetbnd_);
+        if (!triangle.Intersects()) return; // We are not at the phase boundary.
+
+        IdxT numr[4], numc[4];
+        Point3DCL grad[4];
+        double coup[4][4];
+        double dummy;
+        GetLocalNumbP1NoBnd( numr, t, rowidx_);
+        GetLocalNumbP1NoBnd( numc, t, colidx_);
+        P1DiscCL::GetGradients( grad, dummy, t);
+        u_loc.assign( t, u_);
+        std::memset( coup, 0, 4*4*sizeof( double));
+
+        for (int ch= 0; ch < 8; ++ch) {
+            triangle.ComputeForChild( ch);
+            for (int tri= 0; tri < triangle.GetNumTriangles(); ++tri)
+                SetupConvectionP1OnTriangle( &triangle.GetBary( tri), triangle.GetAbsDet( tri),
+                    p1, qp1, u_loc, grad, coup);
+        }
+
+        for(int i= 0; i < 4; ++i) {// assemble row Numb[i]
+            if (numr[i] == NoIdx) continue;
+            for(int j= 0; j < 4; ++j) {
+                if (numc[j] == NoIdx) continue;
+                m_( numr[i], numc[j])+= coup[i][j]; // Order of indices is correct as the assemply of coup is adapted.
             }
         }
     }
-    m.Build();
-    std::cout << mat->Data.num_nonzeros() << " nonzeros in interface convection matrix!" << std::endl;
-}
-
+};
 
 template <class DiscVelSolT>
-void SetupMassDivP1 (const MultiGridCL& mg, MatDescCL* mat, const VecDescCL& ls, const BndDataCL<>& lsetbnd, const DiscVelSolT& u)
+void SetupConvectionP1 (const MultiGridCL& mg, MatDescCL* mat, const VecDescCL& ls, const BndDataCL<>& lsetbnd, const DiscVelSolT& u)
 {
     const IdxT num_rows= mat->RowIdx->NumUnknowns();
     const IdxT num_cols= mat->ColIdx->NumUnknowns();
     MatrixBuilderCL m( &mat->Data, num_rows, num_cols);
-    const Uint lvl= mat->GetRowLevel();
-    IdxT numr[4], numc[4];
 
-    std::cout << "entering SetupMassDivP1: " << num_rows << " rows, " << num_cols << " cols. ";
+    std::cout << "entering SetupConvectionP1: " << num_rows << " rows, " << num_cols << " cols. ";
+
+    InterfaceConvectionScatterCL<DiscVelSolT> scatter( m, *mat->RowIdx, *mat->ColIdx, ls, lsetbnd, u);
+    scatter_tetras( mg, mat->GetRowLevel(), mat->RowIdx->GetMatchingFunction(), mat->RowIdx->GetBndInfo(), scatter);
+    m.Build();
+    std::cout << mat->Data.num_nonzeros() << " nonzeros in interface convection matrix!" << std::endl;
+}
 
+
+/// \brief Scatters the interface mass-divergence matrix of a tetra; used with scatter_tetras.
+template <class DiscVelSolT>
+class MassDivScatterCL
+{
+  private:
+    MatrixBuilderCL& m_;
+    const IdxDescCL& rowidx_;
+    const IdxDescCL& colidx_;
+    const VecDescCL& ls_;
+    const BndDataCL<>& lsetbnd_;
+    const DiscVelSolT& u_;
     LocalP1CL<> p1[4];
-    p1[0][0]= p1[1][1]= p1[2][2]= p1[3][3]= 1.; // P1-Basis-Functions
     Quad5_2DCL<double> qp1[4];
-
     LocalP2CL<Point3DCL> u_loc;
-    SMatrixCL<3,3> T;
     LocalP1CL<Point3DCL> gradrefp2[10], gradp2[10];
-    P2DiscCL::GetGradientsOnRef( gradrefp2);
-
-    double coup[4][4];
-    double dummy;
-
     InterfaceTriangleCL triangle;
 
-    DROPS_FOR_TRIANG_CONST_TETRA( mg, lvl, it) {
-        triangle.Init( *it, ls, lsetbnd);
-        if (triangle.Intersects()) { // We are at the phase boundary.
-            GetLocalNumbP1NoBnd( numr, *it, *mat->RowIdx);
-            GetLocalNumbP1NoBnd( numc, *it, *mat->ColIdx);
-            GetTrafoTr( T, dummy, *it);
-            P2DiscCL::GetGradients( gradp2, gradrefp2, T);
-            u_loc.assign( *it, u);
-            std::memset( coup, 0, 4*4*sizeof( double));
-
-            for (int ch= 0; ch < 8; ++ch) {
-                triangle.ComputeForChild( ch);
-                 for (int tri= 0; tri < triangle.GetNumTriangles(); ++tri)
-                    SetupMassDivP1OnTriangle( &triangle.GetBary( tri), triangle.GetAbsDet( tri),
-                        p1, qp1, u_loc, gradp2, triangle.GetNormal(), coup);
-            }
+  public:
+    MassDivScatterCL (MatrixBuilderCL& m, const IdxDescCL& rowidx, const IdxDescCL& colidx,
+        const VecDescCL& ls, const BndDataCL<>& lsetbnd, const DiscVelSolT& u)
+        : m_( m), rowidx_( rowidx), colidx_( colidx), ls_( ls), lsetbnd_( lsetbnd), u_( u) {
+        p1[0][0]= p1[1][1]= p1[2][2]= p1[3][3]= 1.; // P1-Basis-Functions
+        P2DiscCL::GetGradientsOnRef( gradrefp2);
+    }
 
-            for(int i= 0; i < 4; ++i) {// assemble row Numb[i]
-                if (numr[i] == NoIdx) continue;
-                for(int j= 0; j < 4; ++j) {
-                    if (numc[j] == NoIdx) continue;
-                    m( numr[i], numc[j])+= coup[i][j];
-                }
+    void operator() (const TetraCL& t) {
+        triangle.Init( t, ls_, lsetbnd_);
+        if (!triangle.Intersects()) return; // We are not at the phase boundary.
+
+        IdxT numr[4], numc[4];
+        SMatrixCL<3,3> T;
+        double coup[4][4];
+        double dummy;
+        GetLocalNumbP1NoBnd( numr, t, rowidx_);
+        GetLocalNumbP1NoBnd( numc, t, colidx_);
+        GetTrafoTr( T, dummy, t);
+        P2DiscCL::GetGradients( gradp2, gradrefp2, T);
+        u_loc.assign( t, u_);
+        std::memset( coup, 0, 4*4*sizeof( double));
+
+        for (int ch= 0; ch < 8; ++ch) {
+            triangle.ComputeForChild( ch);
+            for (int tri= 0; tri < triangle.GetNumTriangles(); ++tri)
+                SetupMassDivP1OnTriangle( &triangle.GetBary( tri), triangle.GetAbsDet( tri),
+                    p1, qp1, u_loc, gradp2, triangle.GetNormal(), coup);
+        }
+
+        for(int i= 0; i < 4; ++i) {// assemble row Numb[i]
+            if (numr[i] == NoIdx) continue;
+            for(int j= 0; j < 4; ++j) {
+                if (numc[j] == NoIdx) continue;
+                m_( numr[i], numc[j])+= coup[i][j];
             }
         }
     }
+};
+
+template <class DiscVelSolT>
+void SetupMassDivP1 (const MultiGridCL& mg, MatDescCL* mat, const VecDescCL& ls, const BndDataCL<>& lsetbnd, const DiscVelSolT& u)
+{
+    const IdxT num_rows= mat->RowIdx->NumUnknowns();
+    const IdxT num_cols= mat->ColIdx->NumUnknowns();
+    MatrixBuilderCL m( &mat->Data, num_rows, num_cols);
+
+    std::cout << "entering SetupMassDivP1: " << num_rows << " rows, " << num_cols << " cols. ";
+
+    MassDivScatterCL<DiscVelSolT> scatter( m, *mat->RowIdx, *mat->ColIdx, ls, lsetbnd, u);
+    scatter_tetras( mg, mat->GetRowLevel(), mat->RowIdx->GetMatchingFunction(), mat->RowIdx->GetBndInfo(), scatter);
     m.Build();
     std::cout << mat->Data.num_nonzeros() << " nonzeros in mass-divergence matrix!" << std::endl;
 }
@@ -0,0 +1,250 @@
+/// \file accumulator.cpp
+/// \brief tests the scheduling of the OpenMP-parallel accumulation (coloring and owner-computes)
+/// \author LNM RWTH Aachen: Joerg Grande; SC RWTH Aachen:
+
+/*
+ * This file is part of DROPS.
+ *
+ * DROPS is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * DROPS is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with DROPS. If not, see <http://www.gnu.org/licenses/>.
+ *
+ *
+ * Copyright 2011 LNM/SC RWTH Aachen, Germany
+*/
+
+#include "num/accumulator.h"
+#include "geom/builder.h"
+#include <iostream>
+#include <map>
+#include <string>
+#include <cstdlib>
+
+using namespace DROPS;
+
+void MarkDrop (MultiGridCL& mg, int maxLevel)
+{
+    Point3DCL Mitte( 0.5);
+    DROPS_FOR_TRIANG_TETRA( mg, maxLevel, It) {
+        if ( (GetBaryCenter( *It) - Mitte).norm() <= std::max( 0.2, 1.5*std::pow( It->GetVolume(), 1.0/3.0)) )
+            It->SetRegRefMark();
+    }
+}
+
+/// \brief Counts the visits of each tetra and scatters the volume of the tetras to their vertices.
+/// The scatter is not synchronized; it is only correct, if tetras with a common vertex are not visited concurrently.
+class VolumeAccumulatorCL : public TetraAccumulatorCL
+{
+  private:
+    const std::map<const VertexCL*, size_t>& vnum_;
+    const std::map<const TetraCL*, size_t>&  tnum_;
+    std::vector<double>& vol_;
+    std::vector<int>&    visits_;
+
+  public:
+    VolumeAccumulatorCL (const std::map<const VertexCL*, size_t>& vnum, const std::map<const TetraCL*, size_t>& tnum,
+        std::vector<double>& vol, std::vector<int>& visits)
+        : vnum_( vnum), tnum_( tnum), vol_( vol), visits_( visits) {}
+
+    void begin_accumulation () {
+        std::fill( vol_.begin(), vol_.end(), 0.);
+        std::fill( visits_.begin(), visits_.end(), 0);
+    }
+    void visit (const TetraCL& t) {
+        ++visits_[tnum_.find( &t)->second];
+        for (Uint i= 0; i < 4; ++i)
+            vol_[vnum_.find( t.GetVertex( i))->second]+= t.GetVolume();
+    }
+    TetraAccumulatorCL* clone (int) { return new VolumeAccumulatorCL( *this); }
+};
+
+/// \brief Same as VolumeAccumulatorCL, but the tetras are visited in batches. The number of batches with more than one tetra is counted.
+class BatchVolumeAccumulatorCL : public VolumeAccumulatorCL
+{
+  private:
+    size_t& batches_;
+
+  public:
+    BatchVolumeAccumulatorCL (const std::map<const VertexCL*, size_t>& vnum, const std::map<const TetraCL*, size_t>& tnum,
+        std::vector<double>& vol, std::vector<int>& visits, size_t& batches)
+        : VolumeAccumulatorCL( vnum, tnum, vol, visits), batches_( batches) {}
+
+    void begin_accumulation () {
+        VolumeAccumulatorCL::begin_accumulation();
+        batches_= 0;
+    }
+    void visit_batch (const TetraCL* const* t, Uint n) {
+        if (n > 1)
+#           pragma omp atomic
+            ++batches_;
+        for (Uint i= 0; i < n; ++i)
+            visit( *t[i]);
+    }
+    bool supports_batch () const { return true; }
+    TetraAccumulatorCL* clone (int) { return new BatchVolumeAccumulatorCL( *this); }
+};
+
+int TestScheduling (const MultiGridCL& mg, AccumulationSchedulingT sched, const char* name,
+    const std::vector<double>& vol_ref, bool batched= false, double* time= 0)
+{
+    std::map<const VertexCL*, size_t> vnum;
+    DROPS_FOR_TRIANG_CONST_VERTEX( mg, -1, it)
+        vnum.insert( std::make_pair( &*it, vnum.size()));
+    std::map<const TetraCL*, size_t> tnum;
+    DROPS_FOR_TRIANG_CONST_TETRA( mg, -1, it)
+        tnum.insert( std::make_pair( &*it, tnum.size()));
+
+    std::vector<double> vol( vnum.size());
+    std::vector<int> visits( tnum.size());
+    size_t batches= 0;
+    VolumeAccumulatorCL accu( vnum, tnum, vol, visits);
+    BatchVolumeAccumulatorCL batch_accu( vnum, tnum, vol, visits, batches);
+    TetraAccumulatorTupleCL accus;
+    accus.push_back( batched ? &batch_accu : &accu);
+    const BndCondCL bnd( 0);
+    accumulate( accus, mg, -1, 0, bnd, sched); // The coloring resp. the partition is set up here.
+
+    TimerCL timer;
+    timer.Start();
+    for (int i= 0; i < 10; ++i)
+        accumulate( accus, mg, -1, 0, bnd, sched);
+    timer.Stop();
+
+    double err= 0.;
+    if (!vol_ref.empty())
+        for (size_t i= 0; i < vol.size(); ++i)
+            err= std::max( err, std::fabs( vol[i] - vol_ref[i]));
+    const bool once= std::count( visits.begin(), visits.end(), 1) == static_cast<std::ptrdiff_t>( visits.size());
+    std::cout << name << ": threads: " << omp_get_max_threads() << "\terror: " << err
+              << "\tvisited once: " << once << "\tbatches: " << (batches > 0)
+              << "\ttime: " << timer.GetTime() << " seconds" << std::endl;
+    if (time != 0)
+        *time= timer.GetTime();
+    return err > 1e-12 || !once || batched != (batches > 0);
+}
+
+/// \brief Runs both schedulings with 1, 2, 4, ..., max_threads threads and prints the speedup relative to one thread.
+/// The speedup is only meaningful, if the machine has at least max_threads cores.
+int ThreadSweep (const MultiGridCL& mg, const std::vector<double>& vol_ref, int max_threads)
+{
+    int ret= 0;
+    const AccumulationSchedulingT sched[2]= { ColoringSchedulingC, OwnerComputesSchedulingC };
+    const char* name[2]= { "coloring", "owner-computes" };
+    for (int s= 0; s < 2; ++s) {
+        double t1= 0., t;
+        for (int n= 1; n <= max_threads; n*= 2) {
+            omp_set_num_threads( n);
+            ret+= TestScheduling( mg, sched[s], name[s], vol_ref, false, &t);
+            if (n == 1)
+                t1= t;
+            std::cout << "sweep: " << name[s] << "\tthreads: " << n << "\tspeedup: " << t1/t << std::endl;
+        }
+    }
+    return ret;
+}
+
+/// \brief Sum, minimum and maximum of the volumes of the tetras; used with reduce_tetras.
+class VolumeReductionCL
+{
+  public:
+    double sum, min, max;
+
+    VolumeReductionCL () : sum( 0.), min( 1e99), max( -1.) {}
+
+    void operator() (const TetraCL& t) {
+        const double v= t.GetVolume();
+        sum+= v;
+        min= std::min( min, v);
+        max= std::max( max, v);
+    }
+    void join (const VolumeReductionCL& r) {
+        sum+= r.sum;
+        min= std::min( min, r.min);
+        max= std::max( max, r.max);
+    }
+};
+
+/// \brief Scatters the volume of a tetra to its vertices; used with scatter_tetras.
+class VolumeScatterCL
+{
+  private:
+    const std::map<const VertexCL*, size_t>& vnum_;
+    std::vector<double>& vol_;
+
+  public:
+    VolumeScatterCL (const std::map<const VertexCL*, size_t>& vnum, std::vector<double>& vol)
+        : vnum_( vnum), vol_( vol) {}
+
+    void operator() (const TetraCL& t) {
+        for (Uint i= 0; i < 4; ++i)
+            vol_[vnum_.find( t.GetVertex( i))->second]+= t.GetVolume();
+    }
+};
+
+int TestTraversal (const MultiGridCL& mg, const std::map<const VertexCL*, size_t>& vnum, const std::vector<double>& vol_ref)
+{
+    VolumeReductionCL red;
+    reduce_tetras( mg, -1, red);
+    VolumeReductionCL ref;
+    DROPS_FOR_TRIANG_CONST_TETRA( mg, -1, it)
+        ref( *it);
+    const double err_red= std::max( std::fabs( red.sum - ref.sum), std::max( std::fabs( red.min - ref.min), std::fabs( red.max - ref.max)));
+
+    std::vector<double> vol( vol_ref.size());
+    VolumeScatterCL scatter( vnum, vol);
+    const BndCondCL bnd( 0);
+    scatter_tetras( mg, -1, 0, bnd, scatter);
+    double err_scatter= 0.;
+    for (size_t i= 0; i < vol.size(); ++i)
+        err_scatter= std::max( err_scatter, std::fabs( vol[i] - vol_ref[i]));
+
+    std::cout << "reduce_tetras: threads: " << omp_get_max_threads() << "\terror: " << err_red
+              << "\tscatter_tetras: error: " << err_scatter << std::endl;
+    return err_red > 1e-10 || err_scatter > 1e-12;
+}
+
+/// With the arguments "sweep [max_threads]", the times of the schedulings are measured for 1, 2, 4, ..., max_threads (default: 64) threads.
+int main (int argc, char** argv)
+{
+  try {
+    BrickBuilderCL brick( Point3DCL( 0.), 1.*std_basis<3>( 1), 1.*std_basis<3>( 2), 1.*std_basis<3>( 3), 8, 8, 8);
+    MultiGridCL mg( brick);
+    for (int i= 0; i < 2; ++i) {
+        MarkDrop( mg, mg.GetLastLevel());
+        mg.Refine();
+    }
+
+    // serial reference
+    const MultiGridCL& cmg= mg;
+    std::map<const VertexCL*, size_t> vnum;
+    DROPS_FOR_TRIANG_CONST_VERTEX( cmg, -1, it)
+        vnum.insert( std::make_pair( &*it, vnum.size()));
+    std::vector<double> vol_ref( vnum.size());
+    DROPS_FOR_TRIANG_CONST_TETRA( cmg, -1, it)
+        for (Uint i= 0; i < 4; ++i)
+            vol_ref[vnum[it->GetVertex( i)]]+= it->GetVolume();
+
+    if (argc > 1 && std::string( argv[1]) == "sweep")
+        return ThreadSweep( mg, vol_ref, argc > 2 ? std::atoi( argv[2]) : 64);
+
+    int ret= 0;
+    ret+= TestScheduling( mg, ColoringSchedulingC,      "coloring",       vol_ref);
+    ret+= TestScheduling( mg, OwnerComputesSchedulingC, "owner-computes", vol_ref);
+    if (omp_get_max_threads() > 1)
+        mg.GetOwnerPartition( -1, omp_get_max_threads(), 0, BndCondCL( 0)).WriteStats( std::cout);
+    ret+= TestScheduling( mg, ColoringSchedulingC,      "coloring, batched",       vol_ref, true);
+    ret+= TestScheduling( mg, OwnerComputesSchedulingC, "owner-computes, batched", vol_ref, true);
+    ret+= TestTraversal( mg, vnum, vol_ref);
+    return ret;
+  }
+  catch (DROPSErrCL err) { err.handle(); }
+}
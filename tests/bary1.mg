@@ -0,0 +1,3276 @@
+0.09375 0.0625 0.03125 
+0.21875 0.0625 0.03125 
+0.1875 0.09375 0.03125 
+0.15625 0.09375 0.0625 
+0.21875 0.1875 0.03125 
+0.21875 0.15625 0.0625 
+0.1875 0.15625 0.09375 
+0.21875 0.1875 0.15625 
+0.34375 0.0625 0.03125 
+0.46875 0.0625 0.03125 
+0.4375 0.09375 0.03125 
+0.40625 0.09375 0.0625 
+0.46875 0.1875 0.03125 
+0.46875 0.15625 0.0625 
+0.4375 0.15625 0.09375 
+0.46875 0.1875 0.15625 
+0.3125 0.09375 0.03125 
+0.3125 0.21875 0.03125 
+0.34375 0.1875 0.03125 
+0.34375 0.15625 0.0625 
+0.4375 0.21875 0.03125 
+0.40625 0.21875 0.0625 
+0.40625 0.1875 0.09375 
+0.4375 0.21875 0.15625 
+0.28125 0.09375 0.0625 
+0.28125 0.21875 0.0625 
+0.28125 0.1875 0.09375 
+0.3125 0.15625 0.09375 
+0.28125 0.21875 0.1875 
+0.3125 0.21875 0.15625 
+0.34375 0.1875 0.15625 
+0.40625 0.21875 0.1875 
+0.34375 0.3125 0.03125 
+0.46875 0.3125 0.03125 
+0.4375 0.34375 0.03125 
+0.40625 0.34375 0.0625 
+0.46875 0.4375 0.03125 
+0.46875 0.40625 0.0625 
+0.4375 0.40625 0.09375 
+0.46875 0.4375 0.15625 
+0.34375 0.28125 0.0625 
+0.46875 0.28125 0.0625 
+0.4375 0.28125 0.09375 
+0.40625 0.3125 0.09375 
+0.46875 0.28125 0.1875 
+0.46875 0.3125 0.15625 
+0.4375 0.34375 0.15625 
+0.46875 0.40625 0.1875 
+0.3125 0.28125 0.09375 
+0.3125 0.28125 0.21875 
+0.34375 0.28125 0.1875 
+0.34375 0.3125 0.15625 
+0.4375 0.28125 0.21875 
+0.40625 0.3125 0.21875 
+0.40625 0.34375 0.1875 
+0.4375 0.40625 0.21875 
+0.34375 0.3125 0.28125 
+0.46875 0.3125 0.28125 
+0.4375 0.34375 0.28125 
+0.40625 0.34375 0.3125 
+0.46875 0.4375 0.28125 
+0.09375 0.03125 0.0625 
+0.21875 0.03125 0.0625 
+0.1875 0.03125 0.09375 
+0.15625 0.0625 0.09375 
+0.21875 0.03125 0.1875 
+0.21875 0.0625 0.15625 
+0.1875 0.09375 0.15625 
+0.21875 0.15625 0.1875 
+0.34375 0.03125 0.0625 
+0.46875 0.03125 0.0625 
+0.4375 0.03125 0.09375 
+0.40625 0.0625 0.09375 
+0.46875 0.03125 0.1875 
+0.46875 0.0625 0.15625 
+0.4375 0.09375 0.15625 
+0.46875 0.15625 0.1875 
+0.3125 0.03125 0.09375 
+0.3125 0.03125 0.21875 
+0.34375 0.03125 0.1875 
+0.34375 0.0625 0.15625 
+0.4375 0.03125 0.21875 
+0.40625 0.0625 0.21875 
+0.40625 0.09375 0.1875 
+0.4375 0.15625 0.21875 
+0.28125 0.0625 0.09375 
+0.28125 0.0625 0.21875 
+0.28125 0.09375 0.1875 
+0.3125 0.09375 0.15625 
+0.28125 0.1875 0.21875 
+0.3125 0.15625 0.21875 
+0.34375 0.15625 0.1875 
+0.40625 0.1875 0.21875 
+0.34375 0.03125 0.3125 
+0.46875 0.03125 0.3125 
+0.4375 0.03125 0.34375 
+0.40625 0.0625 0.34375 
+0.46875 0.03125 0.4375 
+0.46875 0.0625 0.40625 
+0.4375 0.09375 0.40625 
+0.46875 0.15625 0.4375 
+0.34375 0.0625 0.28125 
+0.46875 0.0625 0.28125 
+0.4375 0.09375 0.28125 
+0.40625 0.09375 0.3125 
+0.46875 0.1875 0.28125 
+0.46875 0.15625 0.3125 
+0.4375 0.15625 0.34375 
+0.46875 0.1875 0.40625 
+0.3125 0.09375 0.28125 
+0.3125 0.21875 0.28125 
+0.34375 0.1875 0.28125 
+0.34375 0.15625 0.3125 
+0.4375 0.21875 0.28125 
+0.40625 0.21875 0.3125 
+0.40625 0.1875 0.34375 
+0.4375 0.21875 0.40625 
+0.34375 0.28125 0.3125 
+0.46875 0.28125 0.3125 
+0.4375 0.28125 0.34375 
+0.40625 0.3125 0.34375 
+0.46875 0.28125 0.4375 
+0.0625 0.09375 0.03125 
+0.0625 0.21875 0.03125 
+0.09375 0.1875 0.03125 
+0.09375 0.15625 0.0625 
+0.1875 0.21875 0.03125 
+0.15625 0.21875 0.0625 
+0.15625 0.1875 0.09375 
+0.1875 0.21875 0.15625 
+0.0625 0.34375 0.03125 
+0.0625 0.46875 0.03125 
+0.09375 0.4375 0.03125 
+0.09375 0.40625 0.0625 
+0.1875 0.46875 0.03125 
+0.15625 0.46875 0.0625 
+0.15625 0.4375 0.09375 
+0.1875 0.46875 0.15625 
+0.09375 0.3125 0.03125 
+0.21875 0.3125 0.03125 
+0.1875 0.34375 0.03125 
+0.15625 0.34375 0.0625 
+0.21875 0.4375 0.03125 
+0.21875 0.40625 0.0625 
+0.1875 0.40625 0.09375 
+0.21875 0.4375 0.15625 
+0.09375 0.28125 0.0625 
+0.21875 0.28125 0.0625 
+0.1875 0.28125 0.09375 
+0.15625 0.3125 0.09375 
+0.21875 0.28125 0.1875 
+0.21875 0.3125 0.15625 
+0.1875 0.34375 0.15625 
+0.21875 0.40625 0.1875 
+0.3125 0.34375 0.03125 
+0.3125 0.46875 0.03125 
+0.34375 0.4375 0.03125 
+0.34375 0.40625 0.0625 
+0.4375 0.46875 0.03125 
+0.40625 0.46875 0.0625 
+0.40625 0.4375 0.09375 
+0.4375 0.46875 0.15625 
+0.28125 0.34375 0.0625 
+0.28125 0.46875 0.0625 
+0.28125 0.4375 0.09375 
+0.3125 0.40625 0.09375 
+0.28125 0.46875 0.1875 
+0.3125 0.46875 0.15625 
+0.34375 0.4375 0.15625 
+0.40625 0.46875 0.1875 
+0.28125 0.3125 0.09375 
+0.28125 0.3125 0.21875 
+0.28125 0.34375 0.1875 
+0.3125 0.34375 0.15625 
+0.28125 0.4375 0.21875 
+0.3125 0.40625 0.21875 
+0.34375 0.40625 0.1875 
+0.40625 0.4375 0.21875 
+0.3125 0.34375 0.28125 
+0.3125 0.46875 0.28125 
+0.34375 0.4375 0.28125 
+0.34375 0.40625 0.3125 
+0.4375 0.46875 0.28125 
+0.03125 0.09375 0.0625 
+0.03125 0.21875 0.0625 
+0.03125 0.1875 0.09375 
+0.0625 0.15625 0.09375 
+0.03125 0.21875 0.1875 
+0.0625 0.21875 0.15625 
+0.09375 0.1875 0.15625 
+0.15625 0.21875 0.1875 
+0.03125 0.34375 0.0625 
+0.03125 0.46875 0.0625 
+0.03125 0.4375 0.09375 
+0.0625 0.40625 0.09375 
+0.03125 0.46875 0.1875 
+0.0625 0.46875 0.15625 
+0.09375 0.4375 0.15625 
+0.15625 0.46875 0.1875 
+0.03125 0.3125 0.09375 
+0.03125 0.3125 0.21875 
+0.03125 0.34375 0.1875 
+0.0625 0.34375 0.15625 
+0.03125 0.4375 0.21875 
+0.0625 0.40625 0.21875 
+0.09375 0.40625 0.1875 
+0.15625 0.4375 0.21875 
+0.0625 0.28125 0.09375 
+0.0625 0.28125 0.21875 
+0.09375 0.28125 0.1875 
+0.09375 0.3125 0.15625 
+0.1875 0.28125 0.21875 
+0.15625 0.3125 0.21875 
+0.15625 0.34375 0.1875 
+0.1875 0.40625 0.21875 
+0.03125 0.34375 0.3125 
+0.03125 0.46875 0.3125 
+0.03125 0.4375 0.34375 
+0.0625 0.40625 0.34375 
+0.03125 0.46875 0.4375 
+0.0625 0.46875 0.40625 
+0.09375 0.4375 0.40625 
+0.15625 0.46875 0.4375 
+0.0625 0.34375 0.28125 
+0.0625 0.46875 0.28125 
+0.09375 0.4375 0.28125 
+0.09375 0.40625 0.3125 
+0.1875 0.46875 0.28125 
+0.15625 0.46875 0.3125 
+0.15625 0.4375 0.34375 
+0.1875 0.46875 0.40625 
+0.09375 0.3125 0.28125 
+0.21875 0.3125 0.28125 
+0.1875 0.34375 0.28125 
+0.15625 0.34375 0.3125 
+0.21875 0.4375 0.28125 
+0.21875 0.40625 0.3125 
+0.1875 0.40625 0.34375 
+0.21875 0.4375 0.40625 
+0.28125 0.34375 0.3125 
+0.28125 0.46875 0.3125 
+0.28125 0.4375 0.34375 
+0.3125 0.40625 0.34375 
+0.28125 0.46875 0.4375 
+0.0625 0.03125 0.09375 
+0.0625 0.03125 0.21875 
+0.09375 0.03125 0.1875 
+0.09375 0.0625 0.15625 
+0.1875 0.03125 0.21875 
+0.15625 0.0625 0.21875 
+0.15625 0.09375 0.1875 
+0.1875 0.15625 0.21875 
+0.0625 0.03125 0.34375 
+0.0625 0.03125 0.46875 
+0.09375 0.03125 0.4375 
+0.09375 0.0625 0.40625 
+0.1875 0.03125 0.46875 
+0.15625 0.0625 0.46875 
+0.15625 0.09375 0.4375 
+0.1875 0.15625 0.46875 
+0.09375 0.03125 0.3125 
+0.21875 0.03125 0.3125 
+0.1875 0.03125 0.34375 
+0.15625 0.0625 0.34375 
+0.21875 0.03125 0.4375 
+0.21875 0.0625 0.40625 
+0.1875 0.09375 0.40625 
+0.21875 0.15625 0.4375 
+0.09375 0.0625 0.28125 
+0.21875 0.0625 0.28125 
+0.1875 0.09375 0.28125 
+0.15625 0.09375 0.3125 
+0.21875 0.1875 0.28125 
+0.21875 0.15625 0.3125 
+0.1875 0.15625 0.34375 
+0.21875 0.1875 0.40625 
+0.3125 0.03125 0.34375 
+0.3125 0.03125 0.46875 
+0.34375 0.03125 0.4375 
+0.34375 0.0625 0.40625 
+0.4375 0.03125 0.46875 
+0.40625 0.0625 0.46875 
+0.40625 0.09375 0.4375 
+0.4375 0.15625 0.46875 
+0.28125 0.0625 0.34375 
+0.28125 0.0625 0.46875 
+0.28125 0.09375 0.4375 
+0.3125 0.09375 0.40625 
+0.28125 0.1875 0.46875 
+0.3125 0.15625 0.46875 
+0.34375 0.15625 0.4375 
+0.40625 0.1875 0.46875 
+0.28125 0.09375 0.3125 
+0.28125 0.21875 0.3125 
+0.28125 0.1875 0.34375 
+0.3125 0.15625 0.34375 
+0.28125 0.21875 0.4375 
+0.3125 0.21875 0.40625 
+0.34375 0.1875 0.40625 
+0.40625 0.21875 0.4375 
+0.3125 0.28125 0.34375 
+0.3125 0.28125 0.46875 
+0.34375 0.28125 0.4375 
+0.34375 0.3125 0.40625 
+0.4375 0.28125 0.46875 
+0.03125 0.0625 0.09375 
+0.03125 0.0625 0.21875 
+0.03125 0.09375 0.1875 
+0.0625 0.09375 0.15625 
+0.03125 0.1875 0.21875 
+0.0625 0.15625 0.21875 
+0.09375 0.15625 0.1875 
+0.15625 0.1875 0.21875 
+0.03125 0.0625 0.34375 
+0.03125 0.0625 0.46875 
+0.03125 0.09375 0.4375 
+0.0625 0.09375 0.40625 
+0.03125 0.1875 0.46875 
+0.0625 0.15625 0.46875 
+0.09375 0.15625 0.4375 
+0.15625 0.1875 0.46875 
+0.03125 0.09375 0.3125 
+0.03125 0.21875 0.3125 
+0.03125 0.1875 0.34375 
+0.0625 0.15625 0.34375 
+0.03125 0.21875 0.4375 
+0.0625 0.21875 0.40625 
+0.09375 0.1875 0.40625 
+0.15625 0.21875 0.4375 
+0.0625 0.09375 0.28125 
+0.0625 0.21875 0.28125 
+0.09375 0.1875 0.28125 
+0.09375 0.15625 0.3125 
+0.1875 0.21875 0.28125 
+0.15625 0.21875 0.3125 
+0.15625 0.1875 0.34375 
+0.1875 0.21875 0.40625 
+0.03125 0.3125 0.34375 
+0.03125 0.3125 0.46875 
+0.03125 0.34375 0.4375 
+0.0625 0.34375 0.40625 
+0.03125 0.4375 0.46875 
+0.0625 0.40625 0.46875 
+0.09375 0.40625 0.4375 
+0.15625 0.4375 0.46875 
+0.0625 0.28125 0.34375 
+0.0625 0.28125 0.46875 
+0.09375 0.28125 0.4375 
+0.09375 0.3125 0.40625 
+0.1875 0.28125 0.46875 
+0.15625 0.3125 0.46875 
+0.15625 0.34375 0.4375 
+0.1875 0.40625 0.46875 
+0.09375 0.28125 0.3125 
+0.21875 0.28125 0.3125 
+0.1875 0.28125 0.34375 
+0.15625 0.3125 0.34375 
+0.21875 0.28125 0.4375 
+0.21875 0.3125 0.40625 
+0.1875 0.34375 0.40625 
+0.21875 0.40625 0.4375 
+0.28125 0.3125 0.34375 
+0.28125 0.3125 0.46875 
+0.28125 0.34375 0.4375 
+0.3125 0.34375 0.40625 
+0.28125 0.4375 0.46875 
+0.59375 0.0625 0.03125 
+0.71875 0.0625 0.03125 
+0.6875 0.09375 0.03125 
+0.65625 0.09375 0.0625 
+0.71875 0.1875 0.03125 
+0.71875 0.15625 0.0625 
+0.6875 0.15625 0.09375 
+0.71875 0.1875 0.15625 
+0.84375 0.0625 0.03125 
+0.96875 0.0625 0.03125 
+0.9375 0.09375 0.03125 
+0.90625 0.09375 0.0625 
+0.96875 0.1875 0.03125 
+0.96875 0.15625 0.0625 
+0.9375 0.15625 0.09375 
+0.96875 0.1875 0.15625 
+0.8125 0.09375 0.03125 
+0.8125 0.21875 0.03125 
+0.84375 0.1875 0.03125 
+0.84375 0.15625 0.0625 
+0.9375 0.21875 0.03125 
+0.90625 0.21875 0.0625 
+0.90625 0.1875 0.09375 
+0.9375 0.21875 0.15625 
+0.78125 0.09375 0.0625 
+0.78125 0.21875 0.0625 
+0.78125 0.1875 0.09375 
+0.8125 0.15625 0.09375 
+0.78125 0.21875 0.1875 
+0.8125 0.21875 0.15625 
+0.84375 0.1875 0.15625 
+0.90625 0.21875 0.1875 
+0.84375 0.3125 0.03125 
+0.96875 0.3125 0.03125 
+0.9375 0.34375 0.03125 
+0.90625 0.34375 0.0625 
+0.96875 0.4375 0.03125 
+0.96875 0.40625 0.0625 
+0.9375 0.40625 0.09375 
+0.96875 0.4375 0.15625 
+0.84375 0.28125 0.0625 
+0.96875 0.28125 0.0625 
+0.9375 0.28125 0.09375 
+0.90625 0.3125 0.09375 
+0.96875 0.28125 0.1875 
+0.96875 0.3125 0.15625 
+0.9375 0.34375 0.15625 
+0.96875 0.40625 0.1875 
+0.8125 0.28125 0.09375 
+0.8125 0.28125 0.21875 
+0.84375 0.28125 0.1875 
+0.84375 0.3125 0.15625 
+0.9375 0.28125 0.21875 
+0.90625 0.3125 0.21875 
+0.90625 0.34375 0.1875 
+0.9375 0.40625 0.21875 
+0.84375 0.3125 0.28125 
+0.96875 0.3125 0.28125 
+0.9375 0.34375 0.28125 
+0.90625 0.34375 0.3125 
+0.96875 0.4375 0.28125 
+0.96875 0.40625 0.3125 
+0.9375 0.40625 0.34375 
+0.96875 0.4375 0.40625 
+0.59375 0.03125 0.0625 
+0.71875 0.03125 0.0625 
+0.6875 0.03125 0.09375 
+0.65625 0.0625 0.09375 
+0.71875 0.03125 0.1875 
+0.71875 0.0625 0.15625 
+0.6875 0.09375 0.15625 
+0.71875 0.15625 0.1875 
+0.84375 0.03125 0.0625 
+0.96875 0.03125 0.0625 
+0.9375 0.03125 0.09375 
+0.90625 0.0625 0.09375 
+0.96875 0.03125 0.1875 
+0.96875 0.0625 0.15625 
+0.9375 0.09375 0.15625 
+0.96875 0.15625 0.1875 
+0.8125 0.03125 0.09375 
+0.8125 0.03125 0.21875 
+0.84375 0.03125 0.1875 
+0.84375 0.0625 0.15625 
+0.9375 0.03125 0.21875 
+0.90625 0.0625 0.21875 
+0.90625 0.09375 0.1875 
+0.9375 0.15625 0.21875 
+0.78125 0.0625 0.09375 
+0.78125 0.0625 0.21875 
+0.78125 0.09375 0.1875 
+0.8125 0.09375 0.15625 
+0.78125 0.1875 0.21875 
+0.8125 0.15625 0.21875 
+0.84375 0.15625 0.1875 
+0.90625 0.1875 0.21875 
+0.84375 0.03125 0.3125 
+0.96875 0.03125 0.3125 
+0.9375 0.03125 0.34375 
+0.90625 0.0625 0.34375 
+0.96875 0.03125 0.4375 
+0.96875 0.0625 0.40625 
+0.9375 0.09375 0.40625 
+0.96875 0.15625 0.4375 
+0.84375 0.0625 0.28125 
+0.96875 0.0625 0.28125 
+0.9375 0.09375 0.28125 
+0.90625 0.09375 0.3125 
+0.96875 0.1875 0.28125 
+0.96875 0.15625 0.3125 
+0.9375 0.15625 0.34375 
+0.96875 0.1875 0.40625 
+0.8125 0.09375 0.28125 
+0.8125 0.21875 0.28125 
+0.84375 0.1875 0.28125 
+0.84375 0.15625 0.3125 
+0.9375 0.21875 0.28125 
+0.90625 0.21875 0.3125 
+0.90625 0.1875 0.34375 
+0.9375 0.21875 0.40625 
+0.84375 0.28125 0.3125 
+0.96875 0.28125 0.3125 
+0.9375 0.28125 0.34375 
+0.90625 0.3125 0.34375 
+0.96875 0.28125 0.4375 
+0.96875 0.3125 0.40625 
+0.9375 0.34375 0.40625 
+0.96875 0.40625 0.4375 
+0.5625 0.09375 0.03125 
+0.5625 0.21875 0.03125 
+0.59375 0.1875 0.03125 
+0.59375 0.15625 0.0625 
+0.6875 0.21875 0.03125 
+0.65625 0.21875 0.0625 
+0.65625 0.1875 0.09375 
+0.6875 0.21875 0.15625 
+0.5625 0.34375 0.03125 
+0.5625 0.46875 0.03125 
+0.59375 0.4375 0.03125 
+0.59375 0.40625 0.0625 
+0.6875 0.46875 0.03125 
+0.65625 0.46875 0.0625 
+0.65625 0.4375 0.09375 
+0.6875 0.46875 0.15625 
+0.59375 0.3125 0.03125 
+0.71875 0.3125 0.03125 
+0.6875 0.34375 0.03125 
+0.65625 0.34375 0.0625 
+0.71875 0.4375 0.03125 
+0.71875 0.40625 0.0625 
+0.6875 0.40625 0.09375 
+0.71875 0.4375 0.15625 
+0.59375 0.28125 0.0625 
+0.71875 0.28125 0.0625 
+0.6875 0.28125 0.09375 
+0.65625 0.3125 0.09375 
+0.71875 0.28125 0.1875 
+0.71875 0.3125 0.15625 
+0.6875 0.34375 0.15625 
+0.71875 0.40625 0.1875 
+0.8125 0.34375 0.03125 
+0.8125 0.46875 0.03125 
+0.84375 0.4375 0.03125 
+0.84375 0.40625 0.0625 
+0.9375 0.46875 0.03125 
+0.90625 0.46875 0.0625 
+0.90625 0.4375 0.09375 
+0.9375 0.46875 0.15625 
+0.78125 0.34375 0.0625 
+0.78125 0.46875 0.0625 
+0.78125 0.4375 0.09375 
+0.8125 0.40625 0.09375 
+0.78125 0.46875 0.1875 
+0.8125 0.46875 0.15625 
+0.84375 0.4375 0.15625 
+0.90625 0.46875 0.1875 
+0.78125 0.3125 0.09375 
+0.78125 0.3125 0.21875 
+0.78125 0.34375 0.1875 
+0.8125 0.34375 0.15625 
+0.78125 0.4375 0.21875 
+0.8125 0.40625 0.21875 
+0.84375 0.40625 0.1875 
+0.90625 0.4375 0.21875 
+0.8125 0.34375 0.28125 
+0.8125 0.46875 0.28125 
+0.84375 0.4375 0.28125 
+0.84375 0.40625 0.3125 
+0.9375 0.46875 0.28125 
+0.90625 0.46875 0.3125 
+0.90625 0.4375 0.34375 
+0.9375 0.46875 0.40625 
+0.53125 0.09375 0.0625 
+0.53125 0.21875 0.0625 
+0.53125 0.1875 0.09375 
+0.5625 0.15625 0.09375 
+0.53125 0.21875 0.1875 
+0.5625 0.21875 0.15625 
+0.59375 0.1875 0.15625 
+0.65625 0.21875 0.1875 
+0.53125 0.34375 0.0625 
+0.53125 0.46875 0.0625 
+0.53125 0.4375 0.09375 
+0.5625 0.40625 0.09375 
+0.53125 0.46875 0.1875 
+0.5625 0.46875 0.15625 
+0.59375 0.4375 0.15625 
+0.65625 0.46875 0.1875 
+0.53125 0.3125 0.09375 
+0.53125 0.3125 0.21875 
+0.53125 0.34375 0.1875 
+0.5625 0.34375 0.15625 
+0.53125 0.4375 0.21875 
+0.5625 0.40625 0.21875 
+0.59375 0.40625 0.1875 
+0.65625 0.4375 0.21875 
+0.5625 0.28125 0.09375 
+0.5625 0.28125 0.21875 
+0.59375 0.28125 0.1875 
+0.59375 0.3125 0.15625 
+0.6875 0.28125 0.21875 
+0.65625 0.3125 0.21875 
+0.65625 0.34375 0.1875 
+0.6875 0.40625 0.21875 
+0.53125 0.34375 0.3125 
+0.53125 0.46875 0.3125 
+0.5625 0.40625 0.34375 
+0.65625 0.46875 0.4375 
+0.5625 0.34375 0.28125 
+0.5625 0.46875 0.28125 
+0.59375 0.4375 0.28125 
+0.59375 0.40625 0.3125 
+0.6875 0.46875 0.28125 
+0.65625 0.46875 0.3125 
+0.65625 0.4375 0.34375 
+0.6875 0.46875 0.40625 
+0.59375 0.3125 0.28125 
+0.71875 0.3125 0.28125 
+0.6875 0.34375 0.28125 
+0.65625 0.34375 0.3125 
+0.71875 0.4375 0.28125 
+0.71875 0.40625 0.3125 
+0.6875 0.40625 0.34375 
+0.71875 0.4375 0.40625 
+0.78125 0.34375 0.3125 
+0.78125 0.46875 0.3125 
+0.78125 0.4375 0.34375 
+0.8125 0.40625 0.34375 
+0.78125 0.46875 0.4375 
+0.8125 0.46875 0.40625 
+0.84375 0.4375 0.40625 
+0.90625 0.46875 0.4375 
+0.5625 0.03125 0.09375 
+0.5625 0.03125 0.21875 
+0.59375 0.03125 0.1875 
+0.59375 0.0625 0.15625 
+0.6875 0.03125 0.21875 
+0.65625 0.0625 0.21875 
+0.65625 0.09375 0.1875 
+0.6875 0.15625 0.21875 
+0.5625 0.03125 0.34375 
+0.5625 0.03125 0.46875 
+0.59375 0.03125 0.4375 
+0.59375 0.0625 0.40625 
+0.6875 0.03125 0.46875 
+0.65625 0.0625 0.46875 
+0.65625 0.09375 0.4375 
+0.6875 0.15625 0.46875 
+0.59375 0.03125 0.3125 
+0.71875 0.03125 0.3125 
+0.6875 0.03125 0.34375 
+0.65625 0.0625 0.34375 
+0.71875 0.03125 0.4375 
+0.71875 0.0625 0.40625 
+0.6875 0.09375 0.40625 
+0.71875 0.15625 0.4375 
+0.59375 0.0625 0.28125 
+0.71875 0.0625 0.28125 
+0.6875 0.09375 0.28125 
+0.65625 0.09375 0.3125 
+0.71875 0.1875 0.28125 
+0.71875 0.15625 0.3125 
+0.6875 0.15625 0.34375 
+0.71875 0.1875 0.40625 
+0.8125 0.03125 0.34375 
+0.8125 0.03125 0.46875 
+0.84375 0.03125 0.4375 
+0.84375 0.0625 0.40625 
+0.9375 0.03125 0.46875 
+0.90625 0.0625 0.46875 
+0.90625 0.09375 0.4375 
+0.9375 0.15625 0.46875 
+0.78125 0.0625 0.34375 
+0.78125 0.0625 0.46875 
+0.78125 0.09375 0.4375 
+0.8125 0.09375 0.40625 
+0.78125 0.1875 0.46875 
+0.8125 0.15625 0.46875 
+0.84375 0.15625 0.4375 
+0.90625 0.1875 0.46875 
+0.78125 0.09375 0.3125 
+0.78125 0.21875 0.3125 
+0.78125 0.1875 0.34375 
+0.8125 0.15625 0.34375 
+0.78125 0.21875 0.4375 
+0.8125 0.21875 0.40625 
+0.84375 0.1875 0.40625 
+0.90625 0.21875 0.4375 
+0.8125 0.28125 0.34375 
+0.8125 0.28125 0.46875 
+0.84375 0.28125 0.4375 
+0.84375 0.3125 0.40625 
+0.9375 0.28125 0.46875 
+0.90625 0.3125 0.46875 
+0.90625 0.34375 0.4375 
+0.9375 0.40625 0.46875 
+0.53125 0.0625 0.09375 
+0.53125 0.0625 0.21875 
+0.53125 0.09375 0.1875 
+0.5625 0.09375 0.15625 
+0.53125 0.1875 0.21875 
+0.5625 0.15625 0.21875 
+0.59375 0.15625 0.1875 
+0.65625 0.1875 0.21875 
+0.53125 0.0625 0.34375 
+0.53125 0.0625 0.46875 
+0.53125 0.09375 0.4375 
+0.5625 0.09375 0.40625 
+0.53125 0.1875 0.46875 
+0.5625 0.15625 0.46875 
+0.59375 0.15625 0.4375 
+0.65625 0.1875 0.46875 
+0.53125 0.09375 0.3125 
+0.53125 0.21875 0.3125 
+0.53125 0.1875 0.34375 
+0.5625 0.15625 0.34375 
+0.53125 0.21875 0.4375 
+0.5625 0.21875 0.40625 
+0.59375 0.1875 0.40625 
+0.65625 0.21875 0.4375 
+0.5625 0.09375 0.28125 
+0.5625 0.21875 0.28125 
+0.59375 0.1875 0.28125 
+0.59375 0.15625 0.3125 
+0.6875 0.21875 0.28125 
+0.65625 0.21875 0.3125 
+0.65625 0.1875 0.34375 
+0.6875 0.21875 0.40625 
+0.53125 0.3125 0.34375 
+0.53125 0.3125 0.46875 
+0.5625 0.34375 0.40625 
+0.65625 0.4375 0.46875 
+0.5625 0.28125 0.34375 
+0.5625 0.28125 0.46875 
+0.59375 0.28125 0.4375 
+0.59375 0.3125 0.40625 
+0.6875 0.28125 0.46875 
+0.65625 0.3125 0.46875 
+0.65625 0.34375 0.4375 
+0.6875 0.40625 0.46875 
+0.59375 0.28125 0.3125 
+0.71875 0.28125 0.3125 
+0.6875 0.28125 0.34375 
+0.65625 0.3125 0.34375 
+0.71875 0.28125 0.4375 
+0.71875 0.3125 0.40625 
+0.6875 0.34375 0.40625 
+0.71875 0.40625 0.4375 
+0.78125 0.3125 0.34375 
+0.78125 0.3125 0.46875 
+0.78125 0.34375 0.4375 
+0.8125 0.34375 0.40625 
+0.78125 0.4375 0.46875 
+0.8125 0.40625 0.46875 
+0.84375 0.40625 0.4375 
+0.90625 0.4375 0.46875 
+0.09375 0.5625 0.03125 
+0.21875 0.5625 0.03125 
+0.1875 0.59375 0.03125 
+0.15625 0.59375 0.0625 
+0.21875 0.6875 0.03125 
+0.21875 0.65625 0.0625 
+0.1875 0.65625 0.09375 
+0.21875 0.6875 0.15625 
+0.34375 0.5625 0.03125 
+0.46875 0.5625 0.03125 
+0.4375 0.59375 0.03125 
+0.40625 0.59375 0.0625 
+0.46875 0.6875 0.03125 
+0.46875 0.65625 0.0625 
+0.4375 0.65625 0.09375 
+0.46875 0.6875 0.15625 
+0.3125 0.59375 0.03125 
+0.3125 0.71875 0.03125 
+0.34375 0.6875 0.03125 
+0.34375 0.65625 0.0625 
+0.4375 0.71875 0.03125 
+0.40625 0.71875 0.0625 
+0.40625 0.6875 0.09375 
+0.4375 0.71875 0.15625 
+0.28125 0.59375 0.0625 
+0.28125 0.71875 0.0625 
+0.28125 0.6875 0.09375 
+0.3125 0.65625 0.09375 
+0.28125 0.71875 0.1875 
+0.3125 0.71875 0.15625 
+0.34375 0.6875 0.15625 
+0.40625 0.71875 0.1875 
+0.34375 0.8125 0.03125 
+0.46875 0.8125 0.03125 
+0.4375 0.84375 0.03125 
+0.40625 0.84375 0.0625 
+0.46875 0.9375 0.03125 
+0.46875 0.90625 0.0625 
+0.4375 0.90625 0.09375 
+0.46875 0.9375 0.15625 
+0.34375 0.78125 0.0625 
+0.46875 0.78125 0.0625 
+0.4375 0.78125 0.09375 
+0.40625 0.8125 0.09375 
+0.46875 0.78125 0.1875 
+0.46875 0.8125 0.15625 
+0.4375 0.84375 0.15625 
+0.46875 0.90625 0.1875 
+0.3125 0.78125 0.09375 
+0.3125 0.78125 0.21875 
+0.34375 0.78125 0.1875 
+0.34375 0.8125 0.15625 
+0.4375 0.78125 0.21875 
+0.40625 0.8125 0.21875 
+0.40625 0.84375 0.1875 
+0.4375 0.90625 0.21875 
+0.34375 0.8125 0.28125 
+0.46875 0.8125 0.28125 
+0.4375 0.84375 0.28125 
+0.40625 0.84375 0.3125 
+0.46875 0.9375 0.28125 
+0.46875 0.90625 0.3125 
+0.4375 0.90625 0.34375 
+0.46875 0.9375 0.40625 
+0.09375 0.53125 0.0625 
+0.21875 0.53125 0.0625 
+0.1875 0.53125 0.09375 
+0.15625 0.5625 0.09375 
+0.21875 0.53125 0.1875 
+0.21875 0.5625 0.15625 
+0.1875 0.59375 0.15625 
+0.21875 0.65625 0.1875 
+0.34375 0.53125 0.0625 
+0.46875 0.53125 0.0625 
+0.4375 0.53125 0.09375 
+0.40625 0.5625 0.09375 
+0.46875 0.53125 0.1875 
+0.46875 0.5625 0.15625 
+0.4375 0.59375 0.15625 
+0.46875 0.65625 0.1875 
+0.3125 0.53125 0.09375 
+0.3125 0.53125 0.21875 
+0.34375 0.53125 0.1875 
+0.34375 0.5625 0.15625 
+0.4375 0.53125 0.21875 
+0.40625 0.5625 0.21875 
+0.40625 0.59375 0.1875 
+0.4375 0.65625 0.21875 
+0.28125 0.5625 0.09375 
+0.28125 0.5625 0.21875 
+0.28125 0.59375 0.1875 
+0.3125 0.59375 0.15625 
+0.28125 0.6875 0.21875 
+0.3125 0.65625 0.21875 
+0.34375 0.65625 0.1875 
+0.40625 0.6875 0.21875 
+0.34375 0.53125 0.3125 
+0.46875 0.53125 0.3125 
+0.40625 0.5625 0.34375 
+0.46875 0.65625 0.4375 
+0.34375 0.5625 0.28125 
+0.46875 0.5625 0.28125 
+0.4375 0.59375 0.28125 
+0.40625 0.59375 0.3125 
+0.46875 0.6875 0.28125 
+0.46875 0.65625 0.3125 
+0.4375 0.65625 0.34375 
+0.46875 0.6875 0.40625 
+0.3125 0.59375 0.28125 
+0.3125 0.71875 0.28125 
+0.34375 0.6875 0.28125 
+0.34375 0.65625 0.3125 
+0.4375 0.71875 0.28125 
+0.40625 0.71875 0.3125 
+0.40625 0.6875 0.34375 
+0.4375 0.71875 0.40625 
+0.34375 0.78125 0.3125 
+0.46875 0.78125 0.3125 
+0.4375 0.78125 0.34375 
+0.40625 0.8125 0.34375 
+0.46875 0.78125 0.4375 
+0.46875 0.8125 0.40625 
+0.4375 0.84375 0.40625 
+0.46875 0.90625 0.4375 
+0.0625 0.59375 0.03125 
+0.0625 0.71875 0.03125 
+0.09375 0.6875 0.03125 
+0.09375 0.65625 0.0625 
+0.1875 0.71875 0.03125 
+0.15625 0.71875 0.0625 
+0.15625 0.6875 0.09375 
+0.1875 0.71875 0.15625 
+0.0625 0.84375 0.03125 
+0.0625 0.96875 0.03125 
+0.09375 0.9375 0.03125 
+0.09375 0.90625 0.0625 
+0.1875 0.96875 0.03125 
+0.15625 0.96875 0.0625 
+0.15625 0.9375 0.09375 
+0.1875 0.96875 0.15625 
+0.09375 0.8125 0.03125 
+0.21875 0.8125 0.03125 
+0.1875 0.84375 0.03125 
+0.15625 0.84375 0.0625 
+0.21875 0.9375 0.03125 
+0.21875 0.90625 0.0625 
+0.1875 0.90625 0.09375 
+0.21875 0.9375 0.15625 
+0.09375 0.78125 0.0625 
+0.21875 0.78125 0.0625 
+0.1875 0.78125 0.09375 
+0.15625 0.8125 0.09375 
+0.21875 0.78125 0.1875 
+0.21875 0.8125 0.15625 
+0.1875 0.84375 0.15625 
+0.21875 0.90625 0.1875 
+0.3125 0.84375 0.03125 
+0.3125 0.96875 0.03125 
+0.34375 0.9375 0.03125 
+0.34375 0.90625 0.0625 
+0.4375 0.96875 0.03125 
+0.40625 0.96875 0.0625 
+0.40625 0.9375 0.09375 
+0.4375 0.96875 0.15625 
+0.28125 0.84375 0.0625 
+0.28125 0.96875 0.0625 
+0.28125 0.9375 0.09375 
+0.3125 0.90625 0.09375 
+0.28125 0.96875 0.1875 
+0.3125 0.96875 0.15625 
+0.34375 0.9375 0.15625 
+0.40625 0.96875 0.1875 
+0.28125 0.8125 0.09375 
+0.28125 0.8125 0.21875 
+0.28125 0.84375 0.1875 
+0.3125 0.84375 0.15625 
+0.28125 0.9375 0.21875 
+0.3125 0.90625 0.21875 
+0.34375 0.90625 0.1875 
+0.40625 0.9375 0.21875 
+0.3125 0.84375 0.28125 
+0.3125 0.96875 0.28125 
+0.34375 0.9375 0.28125 
+0.34375 0.90625 0.3125 
+0.4375 0.96875 0.28125 
+0.40625 0.96875 0.3125 
+0.40625 0.9375 0.34375 
+0.4375 0.96875 0.40625 
+0.03125 0.59375 0.0625 
+0.03125 0.71875 0.0625 
+0.03125 0.6875 0.09375 
+0.0625 0.65625 0.09375 
+0.03125 0.71875 0.1875 
+0.0625 0.71875 0.15625 
+0.09375 0.6875 0.15625 
+0.15625 0.71875 0.1875 
+0.03125 0.84375 0.0625 
+0.03125 0.96875 0.0625 
+0.03125 0.9375 0.09375 
+0.0625 0.90625 0.09375 
+0.03125 0.96875 0.1875 
+0.0625 0.96875 0.15625 
+0.09375 0.9375 0.15625 
+0.15625 0.96875 0.1875 
+0.03125 0.8125 0.09375 
+0.03125 0.8125 0.21875 
+0.03125 0.84375 0.1875 
+0.0625 0.84375 0.15625 
+0.03125 0.9375 0.21875 
+0.0625 0.90625 0.21875 
+0.09375 0.90625 0.1875 
+0.15625 0.9375 0.21875 
+0.0625 0.78125 0.09375 
+0.0625 0.78125 0.21875 
+0.09375 0.78125 0.1875 
+0.09375 0.8125 0.15625 
+0.1875 0.78125 0.21875 
+0.15625 0.8125 0.21875 
+0.15625 0.84375 0.1875 
+0.1875 0.90625 0.21875 
+0.03125 0.84375 0.3125 
+0.03125 0.96875 0.3125 
+0.03125 0.9375 0.34375 
+0.0625 0.90625 0.34375 
+0.03125 0.96875 0.4375 
+0.0625 0.96875 0.40625 
+0.09375 0.9375 0.40625 
+0.15625 0.96875 0.4375 
+0.0625 0.84375 0.28125 
+0.0625 0.96875 0.28125 
+0.09375 0.9375 0.28125 
+0.09375 0.90625 0.3125 
+0.1875 0.96875 0.28125 
+0.15625 0.96875 0.3125 
+0.15625 0.9375 0.34375 
+0.1875 0.96875 0.40625 
+0.09375 0.8125 0.28125 
+0.21875 0.8125 0.28125 
+0.1875 0.84375 0.28125 
+0.15625 0.84375 0.3125 
+0.21875 0.9375 0.28125 
+0.21875 0.90625 0.3125 
+0.1875 0.90625 0.34375 
+0.21875 0.9375 0.40625 
+0.28125 0.84375 0.3125 
+0.28125 0.96875 0.3125 
+0.28125 0.9375 0.34375 
+0.3125 0.90625 0.34375 
+0.28125 0.96875 0.4375 
+0.3125 0.96875 0.40625 
+0.34375 0.9375 0.40625 
+0.40625 0.96875 0.4375 
+0.0625 0.53125 0.09375 
+0.0625 0.53125 0.21875 
+0.09375 0.53125 0.1875 
+0.09375 0.5625 0.15625 
+0.1875 0.53125 0.21875 
+0.15625 0.5625 0.21875 
+0.15625 0.59375 0.1875 
+0.1875 0.65625 0.21875 
+0.0625 0.53125 0.34375 
+0.0625 0.53125 0.46875 
+0.09375 0.53125 0.4375 
+0.09375 0.5625 0.40625 
+0.1875 0.53125 0.46875 
+0.15625 0.5625 0.46875 
+0.15625 0.59375 0.4375 
+0.1875 0.65625 0.46875 
+0.09375 0.53125 0.3125 
+0.21875 0.53125 0.3125 
+0.1875 0.53125 0.34375 
+0.15625 0.5625 0.34375 
+0.21875 0.53125 0.4375 
+0.21875 0.5625 0.40625 
+0.1875 0.59375 0.40625 
+0.21875 0.65625 0.4375 
+0.09375 0.5625 0.28125 
+0.21875 0.5625 0.28125 
+0.1875 0.59375 0.28125 
+0.15625 0.59375 0.3125 
+0.21875 0.6875 0.28125 
+0.21875 0.65625 0.3125 
+0.1875 0.65625 0.34375 
+0.21875 0.6875 0.40625 
+0.3125 0.53125 0.34375 
+0.3125 0.53125 0.46875 
+0.34375 0.5625 0.40625 
+0.4375 0.65625 0.46875 
+0.28125 0.5625 0.34375 
+0.28125 0.5625 0.46875 
+0.28125 0.59375 0.4375 
+0.3125 0.59375 0.40625 
+0.28125 0.6875 0.46875 
+0.3125 0.65625 0.46875 
+0.34375 0.65625 0.4375 
+0.40625 0.6875 0.46875 
+0.28125 0.59375 0.3125 
+0.28125 0.71875 0.3125 
+0.28125 0.6875 0.34375 
+0.3125 0.65625 0.34375 
+0.28125 0.71875 0.4375 
+0.3125 0.71875 0.40625 
+0.34375 0.6875 0.40625 
+0.40625 0.71875 0.4375 
+0.3125 0.78125 0.34375 
+0.3125 0.78125 0.46875 
+0.34375 0.78125 0.4375 
+0.34375 0.8125 0.40625 
+0.4375 0.78125 0.46875 
+0.40625 0.8125 0.46875 
+0.40625 0.84375 0.4375 
+0.4375 0.90625 0.46875 
+0.03125 0.5625 0.09375 
+0.03125 0.5625 0.21875 
+0.03125 0.59375 0.1875 
+0.0625 0.59375 0.15625 
+0.03125 0.6875 0.21875 
+0.0625 0.65625 0.21875 
+0.09375 0.65625 0.1875 
+0.15625 0.6875 0.21875 
+0.03125 0.5625 0.34375 
+0.03125 0.5625 0.46875 
+0.03125 0.59375 0.4375 
+0.0625 0.59375 0.40625 
+0.03125 0.6875 0.46875 
+0.0625 0.65625 0.46875 
+0.09375 0.65625 0.4375 
+0.15625 0.6875 0.46875 
+0.03125 0.59375 0.3125 
+0.03125 0.71875 0.3125 
+0.03125 0.6875 0.34375 
+0.0625 0.65625 0.34375 
+0.03125 0.71875 0.4375 
+0.0625 0.71875 0.40625 
+0.09375 0.6875 0.40625 
+0.15625 0.71875 0.4375 
+0.0625 0.59375 0.28125 
+0.0625 0.71875 0.28125 
+0.09375 0.6875 0.28125 
+0.09375 0.65625 0.3125 
+0.1875 0.71875 0.28125 
+0.15625 0.71875 0.3125 
+0.15625 0.6875 0.34375 
+0.1875 0.71875 0.40625 
+0.03125 0.8125 0.34375 
+0.03125 0.8125 0.46875 
+0.03125 0.84375 0.4375 
+0.0625 0.84375 0.40625 
+0.03125 0.9375 0.46875 
+0.0625 0.90625 0.46875 
+0.09375 0.90625 0.4375 
+0.15625 0.9375 0.46875 
+0.0625 0.78125 0.34375 
+0.0625 0.78125 0.46875 
+0.09375 0.78125 0.4375 
+0.09375 0.8125 0.40625 
+0.1875 0.78125 0.46875 
+0.15625 0.8125 0.46875 
+0.15625 0.84375 0.4375 
+0.1875 0.90625 0.46875 
+0.09375 0.78125 0.3125 
+0.21875 0.78125 0.3125 
+0.1875 0.78125 0.34375 
+0.15625 0.8125 0.34375 
+0.21875 0.78125 0.4375 
+0.21875 0.8125 0.40625 
+0.1875 0.84375 0.40625 
+0.21875 0.90625 0.4375 
+0.28125 0.8125 0.34375 
+0.28125 0.8125 0.46875 
+0.28125 0.84375 0.4375 
+0.3125 0.84375 0.40625 
+0.28125 0.9375 0.46875 
+0.3125 0.90625 0.46875 
+0.34375 0.90625 0.4375 
+0.40625 0.9375 0.46875 
+0.59375 0.5625 0.03125 
+0.71875 0.5625 0.03125 
+0.6875 0.59375 0.03125 
+0.65625 0.59375 0.0625 
+0.71875 0.6875 0.03125 
+0.71875 0.65625 0.0625 
+0.6875 0.65625 0.09375 
+0.71875 0.6875 0.15625 
+0.84375 0.5625 0.03125 
+0.96875 0.5625 0.03125 
+0.9375 0.59375 0.03125 
+0.90625 0.59375 0.0625 
+0.96875 0.6875 0.03125 
+0.96875 0.65625 0.0625 
+0.9375 0.65625 0.09375 
+0.96875 0.6875 0.15625 
+0.8125 0.59375 0.03125 
+0.8125 0.71875 0.03125 
+0.84375 0.6875 0.03125 
+0.84375 0.65625 0.0625 
+0.9375 0.71875 0.03125 
+0.90625 0.71875 0.0625 
+0.90625 0.6875 0.09375 
+0.9375 0.71875 0.15625 
+0.78125 0.59375 0.0625 
+0.78125 0.71875 0.0625 
+0.78125 0.6875 0.09375 
+0.8125 0.65625 0.09375 
+0.78125 0.71875 0.1875 
+0.8125 0.71875 0.15625 
+0.84375 0.6875 0.15625 
+0.90625 0.71875 0.1875 
+0.84375 0.8125 0.03125 
+0.96875 0.8125 0.03125 
+0.9375 0.84375 0.03125 
+0.90625 0.84375 0.0625 
+0.96875 0.9375 0.03125 
+0.96875 0.90625 0.0625 
+0.9375 0.90625 0.09375 
+0.96875 0.9375 0.15625 
+0.84375 0.78125 0.0625 
+0.96875 0.78125 0.0625 
+0.9375 0.78125 0.09375 
+0.90625 0.8125 0.09375 
+0.96875 0.78125 0.1875 
+0.96875 0.8125 0.15625 
+0.9375 0.84375 0.15625 
+0.96875 0.90625 0.1875 
+0.8125 0.78125 0.09375 
+0.8125 0.78125 0.21875 
+0.84375 0.78125 0.1875 
+0.84375 0.8125 0.15625 
+0.9375 0.78125 0.21875 
+0.90625 0.8125 0.21875 
+0.90625 0.84375 0.1875 
+0.9375 0.90625 0.21875 
+0.84375 0.8125 0.28125 
+0.96875 0.8125 0.28125 
+0.9375 0.84375 0.28125 
+0.90625 0.84375 0.3125 
+0.96875 0.9375 0.28125 
+0.96875 0.90625 0.3125 
+0.9375 0.90625 0.34375 
+0.96875 0.9375 0.40625 
+0.59375 0.53125 0.0625 
+0.71875 0.53125 0.0625 
+0.6875 0.53125 0.09375 
+0.65625 0.5625 0.09375 
+0.71875 0.53125 0.1875 
+0.71875 0.5625 0.15625 
+0.6875 0.59375 0.15625 
+0.71875 0.65625 0.1875 
+0.84375 0.53125 0.0625 
+0.96875 0.53125 0.0625 
+0.9375 0.53125 0.09375 
+0.90625 0.5625 0.09375 
+0.96875 0.53125 0.1875 
+0.96875 0.5625 0.15625 
+0.9375 0.59375 0.15625 
+0.96875 0.65625 0.1875 
+0.8125 0.53125 0.09375 
+0.8125 0.53125 0.21875 
+0.84375 0.53125 0.1875 
+0.84375 0.5625 0.15625 
+0.9375 0.53125 0.21875 
+0.90625 0.5625 0.21875 
+0.90625 0.59375 0.1875 
+0.9375 0.65625 0.21875 
+0.78125 0.5625 0.09375 
+0.78125 0.5625 0.21875 
+0.78125 0.59375 0.1875 
+0.8125 0.59375 0.15625 
+0.78125 0.6875 0.21875 
+0.8125 0.65625 0.21875 
+0.84375 0.65625 0.1875 
+0.90625 0.6875 0.21875 
+0.84375 0.53125 0.3125 
+0.96875 0.53125 0.3125 
+0.9375 0.53125 0.34375 
+0.90625 0.5625 0.34375 
+0.96875 0.53125 0.4375 
+0.96875 0.5625 0.40625 
+0.9375 0.59375 0.40625 
+0.96875 0.65625 0.4375 
+0.84375 0.5625 0.28125 
+0.96875 0.5625 0.28125 
+0.9375 0.59375 0.28125 
+0.90625 0.59375 0.3125 
+0.96875 0.6875 0.28125 
+0.96875 0.65625 0.3125 
+0.9375 0.65625 0.34375 
+0.96875 0.6875 0.40625 
+0.8125 0.59375 0.28125 
+0.8125 0.71875 0.28125 
+0.84375 0.6875 0.28125 
+0.84375 0.65625 0.3125 
+0.9375 0.71875 0.28125 
+0.90625 0.71875 0.3125 
+0.90625 0.6875 0.34375 
+0.9375 0.71875 0.40625 
+0.84375 0.78125 0.3125 
+0.96875 0.78125 0.3125 
+0.9375 0.78125 0.34375 
+0.90625 0.8125 0.34375 
+0.96875 0.78125 0.4375 
+0.96875 0.8125 0.40625 
+0.9375 0.84375 0.40625 
+0.96875 0.90625 0.4375 
+0.5625 0.59375 0.03125 
+0.5625 0.71875 0.03125 
+0.59375 0.6875 0.03125 
+0.59375 0.65625 0.0625 
+0.6875 0.71875 0.03125 
+0.65625 0.71875 0.0625 
+0.65625 0.6875 0.09375 
+0.6875 0.71875 0.15625 
+0.5625 0.84375 0.03125 
+0.5625 0.96875 0.03125 
+0.59375 0.9375 0.03125 
+0.59375 0.90625 0.0625 
+0.6875 0.96875 0.03125 
+0.65625 0.96875 0.0625 
+0.65625 0.9375 0.09375 
+0.6875 0.96875 0.15625 
+0.59375 0.8125 0.03125 
+0.71875 0.8125 0.03125 
+0.6875 0.84375 0.03125 
+0.65625 0.84375 0.0625 
+0.71875 0.9375 0.03125 
+0.71875 0.90625 0.0625 
+0.6875 0.90625 0.09375 
+0.71875 0.9375 0.15625 
+0.59375 0.78125 0.0625 
+0.71875 0.78125 0.0625 
+0.6875 0.78125 0.09375 
+0.65625 0.8125 0.09375 
+0.71875 0.78125 0.1875 
+0.71875 0.8125 0.15625 
+0.6875 0.84375 0.15625 
+0.71875 0.90625 0.1875 
+0.8125 0.84375 0.03125 
+0.8125 0.96875 0.03125 
+0.84375 0.9375 0.03125 
+0.84375 0.90625 0.0625 
+0.9375 0.96875 0.03125 
+0.90625 0.96875 0.0625 
+0.90625 0.9375 0.09375 
+0.9375 0.96875 0.15625 
+0.78125 0.84375 0.0625 
+0.78125 0.96875 0.0625 
+0.78125 0.9375 0.09375 
+0.8125 0.90625 0.09375 
+0.78125 0.96875 0.1875 
+0.8125 0.96875 0.15625 
+0.84375 0.9375 0.15625 
+0.90625 0.96875 0.1875 
+0.78125 0.8125 0.09375 
+0.78125 0.8125 0.21875 
+0.78125 0.84375 0.1875 
+0.8125 0.84375 0.15625 
+0.78125 0.9375 0.21875 
+0.8125 0.90625 0.21875 
+0.84375 0.90625 0.1875 
+0.90625 0.9375 0.21875 
+0.8125 0.84375 0.28125 
+0.8125 0.96875 0.28125 
+0.84375 0.9375 0.28125 
+0.84375 0.90625 0.3125 
+0.9375 0.96875 0.28125 
+0.90625 0.96875 0.3125 
+0.90625 0.9375 0.34375 
+0.9375 0.96875 0.40625 
+0.53125 0.59375 0.0625 
+0.53125 0.71875 0.0625 
+0.53125 0.6875 0.09375 
+0.5625 0.65625 0.09375 
+0.53125 0.71875 0.1875 
+0.5625 0.71875 0.15625 
+0.59375 0.6875 0.15625 
+0.65625 0.71875 0.1875 
+0.53125 0.84375 0.0625 
+0.53125 0.96875 0.0625 
+0.53125 0.9375 0.09375 
+0.5625 0.90625 0.09375 
+0.53125 0.96875 0.1875 
+0.5625 0.96875 0.15625 
+0.59375 0.9375 0.15625 
+0.65625 0.96875 0.1875 
+0.53125 0.8125 0.09375 
+0.53125 0.8125 0.21875 
+0.53125 0.84375 0.1875 
+0.5625 0.84375 0.15625 
+0.53125 0.9375 0.21875 
+0.5625 0.90625 0.21875 
+0.59375 0.90625 0.1875 
+0.65625 0.9375 0.21875 
+0.5625 0.78125 0.09375 
+0.5625 0.78125 0.21875 
+0.59375 0.78125 0.1875 
+0.59375 0.8125 0.15625 
+0.6875 0.78125 0.21875 
+0.65625 0.8125 0.21875 
+0.65625 0.84375 0.1875 
+0.6875 0.90625 0.21875 
+0.53125 0.84375 0.3125 
+0.53125 0.96875 0.3125 
+0.53125 0.9375 0.34375 
+0.5625 0.90625 0.34375 
+0.53125 0.96875 0.4375 
+0.5625 0.96875 0.40625 
+0.59375 0.9375 0.40625 
+0.65625 0.96875 0.4375 
+0.5625 0.84375 0.28125 
+0.5625 0.96875 0.28125 
+0.59375 0.9375 0.28125 
+0.59375 0.90625 0.3125 
+0.6875 0.96875 0.28125 
+0.65625 0.96875 0.3125 
+0.65625 0.9375 0.34375 
+0.6875 0.96875 0.40625 
+0.59375 0.8125 0.28125 
+0.71875 0.8125 0.28125 
+0.6875 0.84375 0.28125 
+0.65625 0.84375 0.3125 
+0.71875 0.9375 0.28125 
+0.71875 0.90625 0.3125 
+0.6875 0.90625 0.34375 
+0.71875 0.9375 0.40625 
+0.78125 0.84375 0.3125 
+0.78125 0.96875 0.3125 
+0.78125 0.9375 0.34375 
+0.8125 0.90625 0.34375 
+0.78125 0.96875 0.4375 
+0.8125 0.96875 0.40625 
+0.84375 0.9375 0.40625 
+0.90625 0.96875 0.4375 
+0.5625 0.53125 0.09375 
+0.5625 0.53125 0.21875 
+0.59375 0.53125 0.1875 
+0.59375 0.5625 0.15625 
+0.6875 0.53125 0.21875 
+0.65625 0.5625 0.21875 
+0.65625 0.59375 0.1875 
+0.6875 0.65625 0.21875 
+0.5625 0.53125 0.34375 
+0.6875 0.53125 0.46875 
+0.65625 0.59375 0.4375 
+0.6875 0.65625 0.46875 
+0.59375 0.53125 0.3125 
+0.71875 0.53125 0.3125 
+0.6875 0.53125 0.34375 
+0.65625 0.5625 0.34375 
+0.71875 0.53125 0.4375 
+0.71875 0.5625 0.40625 
+0.6875 0.59375 0.40625 
+0.71875 0.65625 0.4375 
+0.59375 0.5625 0.28125 
+0.71875 0.5625 0.28125 
+0.6875 0.59375 0.28125 
+0.65625 0.59375 0.3125 
+0.71875 0.6875 0.28125 
+0.71875 0.65625 0.3125 
+0.6875 0.65625 0.34375 
+0.71875 0.6875 0.40625 
+0.8125 0.53125 0.34375 
+0.8125 0.53125 0.46875 
+0.84375 0.53125 0.4375 
+0.84375 0.5625 0.40625 
+0.9375 0.53125 0.46875 
+0.90625 0.5625 0.46875 
+0.90625 0.59375 0.4375 
+0.9375 0.65625 0.46875 
+0.78125 0.5625 0.34375 
+0.78125 0.5625 0.46875 
+0.78125 0.59375 0.4375 
+0.8125 0.59375 0.40625 
+0.78125 0.6875 0.46875 
+0.8125 0.65625 0.46875 
+0.84375 0.65625 0.4375 
+0.90625 0.6875 0.46875 
+0.78125 0.59375 0.3125 
+0.78125 0.71875 0.3125 
+0.78125 0.6875 0.34375 
+0.8125 0.65625 0.34375 
+0.78125 0.71875 0.4375 
+0.8125 0.71875 0.40625 
+0.84375 0.6875 0.40625 
+0.90625 0.71875 0.4375 
+0.8125 0.78125 0.34375 
+0.8125 0.78125 0.46875 
+0.84375 0.78125 0.4375 
+0.84375 0.8125 0.40625 
+0.9375 0.78125 0.46875 
+0.90625 0.8125 0.46875 
+0.90625 0.84375 0.4375 
+0.9375 0.90625 0.46875 
+0.53125 0.5625 0.09375 
+0.53125 0.5625 0.21875 
+0.53125 0.59375 0.1875 
+0.5625 0.59375 0.15625 
+0.53125 0.6875 0.21875 
+0.5625 0.65625 0.21875 
+0.59375 0.65625 0.1875 
+0.65625 0.6875 0.21875 
+0.53125 0.5625 0.34375 
+0.53125 0.6875 0.46875 
+0.59375 0.65625 0.4375 
+0.65625 0.6875 0.46875 
+0.53125 0.59375 0.3125 
+0.53125 0.71875 0.3125 
+0.53125 0.6875 0.34375 
+0.5625 0.65625 0.34375 
+0.53125 0.71875 0.4375 
+0.5625 0.71875 0.40625 
+0.59375 0.6875 0.40625 
+0.65625 0.71875 0.4375 
+0.5625 0.59375 0.28125 
+0.5625 0.71875 0.28125 
+0.59375 0.6875 0.28125 
+0.59375 0.65625 0.3125 
+0.6875 0.71875 0.28125 
+0.65625 0.71875 0.3125 
+0.65625 0.6875 0.34375 
+0.6875 0.71875 0.40625 
+0.53125 0.8125 0.34375 
+0.53125 0.8125 0.46875 
+0.53125 0.84375 0.4375 
+0.5625 0.84375 0.40625 
+0.53125 0.9375 0.46875 
+0.5625 0.90625 0.46875 
+0.59375 0.90625 0.4375 
+0.65625 0.9375 0.46875 
+0.5625 0.78125 0.34375 
+0.5625 0.78125 0.46875 
+0.59375 0.78125 0.4375 
+0.59375 0.8125 0.40625 
+0.6875 0.78125 0.46875 
+0.65625 0.8125 0.46875 
+0.65625 0.84375 0.4375 
+0.6875 0.90625 0.46875 
+0.59375 0.78125 0.3125 
+0.71875 0.78125 0.3125 
+0.6875 0.78125 0.34375 
+0.65625 0.8125 0.34375 
+0.71875 0.78125 0.4375 
+0.71875 0.8125 0.40625 
+0.6875 0.84375 0.40625 
+0.71875 0.90625 0.4375 
+0.78125 0.8125 0.34375 
+0.78125 0.8125 0.46875 
+0.78125 0.84375 0.4375 
+0.8125 0.84375 0.40625 
+0.78125 0.9375 0.46875 
+0.8125 0.90625 0.46875 
+0.84375 0.90625 0.4375 
+0.90625 0.9375 0.46875 
+0.09375 0.0625 0.53125 
+0.21875 0.0625 0.53125 
+0.1875 0.09375 0.53125 
+0.15625 0.09375 0.5625 
+0.21875 0.1875 0.53125 
+0.21875 0.15625 0.5625 
+0.1875 0.15625 0.59375 
+0.21875 0.1875 0.65625 
+0.34375 0.0625 0.53125 
+0.46875 0.0625 0.53125 
+0.4375 0.09375 0.53125 
+0.40625 0.09375 0.5625 
+0.46875 0.1875 0.53125 
+0.46875 0.15625 0.5625 
+0.4375 0.15625 0.59375 
+0.46875 0.1875 0.65625 
+0.3125 0.09375 0.53125 
+0.3125 0.21875 0.53125 
+0.34375 0.1875 0.53125 
+0.34375 0.15625 0.5625 
+0.4375 0.21875 0.53125 
+0.40625 0.21875 0.5625 
+0.40625 0.1875 0.59375 
+0.4375 0.21875 0.65625 
+0.28125 0.09375 0.5625 
+0.28125 0.21875 0.5625 
+0.28125 0.1875 0.59375 
+0.3125 0.15625 0.59375 
+0.28125 0.21875 0.6875 
+0.3125 0.21875 0.65625 
+0.34375 0.1875 0.65625 
+0.40625 0.21875 0.6875 
+0.34375 0.3125 0.53125 
+0.46875 0.3125 0.53125 
+0.40625 0.34375 0.5625 
+0.46875 0.4375 0.65625 
+0.34375 0.28125 0.5625 
+0.46875 0.28125 0.5625 
+0.4375 0.28125 0.59375 
+0.40625 0.3125 0.59375 
+0.46875 0.28125 0.6875 
+0.46875 0.3125 0.65625 
+0.4375 0.34375 0.65625 
+0.46875 0.40625 0.6875 
+0.3125 0.28125 0.59375 
+0.3125 0.28125 0.71875 
+0.34375 0.28125 0.6875 
+0.34375 0.3125 0.65625 
+0.4375 0.28125 0.71875 
+0.40625 0.3125 0.71875 
+0.40625 0.34375 0.6875 
+0.4375 0.40625 0.71875 
+0.34375 0.3125 0.78125 
+0.46875 0.3125 0.78125 
+0.4375 0.34375 0.78125 
+0.40625 0.34375 0.8125 
+0.46875 0.4375 0.78125 
+0.46875 0.40625 0.8125 
+0.4375 0.40625 0.84375 
+0.46875 0.4375 0.90625 
+0.09375 0.03125 0.5625 
+0.21875 0.03125 0.5625 
+0.1875 0.03125 0.59375 
+0.15625 0.0625 0.59375 
+0.21875 0.03125 0.6875 
+0.21875 0.0625 0.65625 
+0.1875 0.09375 0.65625 
+0.21875 0.15625 0.6875 
+0.34375 0.03125 0.5625 
+0.46875 0.03125 0.5625 
+0.4375 0.03125 0.59375 
+0.40625 0.0625 0.59375 
+0.46875 0.03125 0.6875 
+0.46875 0.0625 0.65625 
+0.4375 0.09375 0.65625 
+0.46875 0.15625 0.6875 
+0.3125 0.03125 0.59375 
+0.3125 0.03125 0.71875 
+0.34375 0.03125 0.6875 
+0.34375 0.0625 0.65625 
+0.4375 0.03125 0.71875 
+0.40625 0.0625 0.71875 
+0.40625 0.09375 0.6875 
+0.4375 0.15625 0.71875 
+0.28125 0.0625 0.59375 
+0.28125 0.0625 0.71875 
+0.28125 0.09375 0.6875 
+0.3125 0.09375 0.65625 
+0.28125 0.1875 0.71875 
+0.3125 0.15625 0.71875 
+0.34375 0.15625 0.6875 
+0.40625 0.1875 0.71875 
+0.34375 0.03125 0.8125 
+0.46875 0.03125 0.8125 
+0.4375 0.03125 0.84375 
+0.40625 0.0625 0.84375 
+0.46875 0.03125 0.9375 
+0.46875 0.0625 0.90625 
+0.4375 0.09375 0.90625 
+0.46875 0.15625 0.9375 
+0.34375 0.0625 0.78125 
+0.46875 0.0625 0.78125 
+0.4375 0.09375 0.78125 
+0.40625 0.09375 0.8125 
+0.46875 0.1875 0.78125 
+0.46875 0.15625 0.8125 
+0.4375 0.15625 0.84375 
+0.46875 0.1875 0.90625 
+0.3125 0.09375 0.78125 
+0.3125 0.21875 0.78125 
+0.34375 0.1875 0.78125 
+0.34375 0.15625 0.8125 
+0.4375 0.21875 0.78125 
+0.40625 0.21875 0.8125 
+0.40625 0.1875 0.84375 
+0.4375 0.21875 0.90625 
+0.34375 0.28125 0.8125 
+0.46875 0.28125 0.8125 
+0.4375 0.28125 0.84375 
+0.40625 0.3125 0.84375 
+0.46875 0.28125 0.9375 
+0.46875 0.3125 0.90625 
+0.4375 0.34375 0.90625 
+0.46875 0.40625 0.9375 
+0.0625 0.09375 0.53125 
+0.0625 0.21875 0.53125 
+0.09375 0.1875 0.53125 
+0.09375 0.15625 0.5625 
+0.1875 0.21875 0.53125 
+0.15625 0.21875 0.5625 
+0.15625 0.1875 0.59375 
+0.1875 0.21875 0.65625 
+0.0625 0.34375 0.53125 
+0.0625 0.46875 0.53125 
+0.09375 0.4375 0.53125 
+0.09375 0.40625 0.5625 
+0.1875 0.46875 0.53125 
+0.15625 0.46875 0.5625 
+0.15625 0.4375 0.59375 
+0.1875 0.46875 0.65625 
+0.09375 0.3125 0.53125 
+0.21875 0.3125 0.53125 
+0.1875 0.34375 0.53125 
+0.15625 0.34375 0.5625 
+0.21875 0.4375 0.53125 
+0.21875 0.40625 0.5625 
+0.1875 0.40625 0.59375 
+0.21875 0.4375 0.65625 
+0.09375 0.28125 0.5625 
+0.21875 0.28125 0.5625 
+0.1875 0.28125 0.59375 
+0.15625 0.3125 0.59375 
+0.21875 0.28125 0.6875 
+0.21875 0.3125 0.65625 
+0.1875 0.34375 0.65625 
+0.21875 0.40625 0.6875 
+0.3125 0.34375 0.53125 
+0.3125 0.46875 0.53125 
+0.34375 0.40625 0.5625 
+0.4375 0.46875 0.65625 
+0.28125 0.34375 0.5625 
+0.28125 0.46875 0.5625 
+0.28125 0.4375 0.59375 
+0.3125 0.40625 0.59375 
+0.28125 0.46875 0.6875 
+0.3125 0.46875 0.65625 
+0.34375 0.4375 0.65625 
+0.40625 0.46875 0.6875 
+0.28125 0.3125 0.59375 
+0.28125 0.3125 0.71875 
+0.28125 0.34375 0.6875 
+0.3125 0.34375 0.65625 
+0.28125 0.4375 0.71875 
+0.3125 0.40625 0.71875 
+0.34375 0.40625 0.6875 
+0.40625 0.4375 0.71875 
+0.3125 0.34375 0.78125 
+0.3125 0.46875 0.78125 
+0.34375 0.4375 0.78125 
+0.34375 0.40625 0.8125 
+0.4375 0.46875 0.78125 
+0.40625 0.46875 0.8125 
+0.40625 0.4375 0.84375 
+0.4375 0.46875 0.90625 
+0.03125 0.09375 0.5625 
+0.03125 0.21875 0.5625 
+0.03125 0.1875 0.59375 
+0.0625 0.15625 0.59375 
+0.03125 0.21875 0.6875 
+0.0625 0.21875 0.65625 
+0.09375 0.1875 0.65625 
+0.15625 0.21875 0.6875 
+0.03125 0.34375 0.5625 
+0.03125 0.46875 0.5625 
+0.03125 0.4375 0.59375 
+0.0625 0.40625 0.59375 
+0.03125 0.46875 0.6875 
+0.0625 0.46875 0.65625 
+0.09375 0.4375 0.65625 
+0.15625 0.46875 0.6875 
+0.03125 0.3125 0.59375 
+0.03125 0.3125 0.71875 
+0.03125 0.34375 0.6875 
+0.0625 0.34375 0.65625 
+0.03125 0.4375 0.71875 
+0.0625 0.40625 0.71875 
+0.09375 0.40625 0.6875 
+0.15625 0.4375 0.71875 
+0.0625 0.28125 0.59375 
+0.0625 0.28125 0.71875 
+0.09375 0.28125 0.6875 
+0.09375 0.3125 0.65625 
+0.1875 0.28125 0.71875 
+0.15625 0.3125 0.71875 
+0.15625 0.34375 0.6875 
+0.1875 0.40625 0.71875 
+0.03125 0.34375 0.8125 
+0.03125 0.46875 0.8125 
+0.03125 0.4375 0.84375 
+0.0625 0.40625 0.84375 
+0.03125 0.46875 0.9375 
+0.0625 0.46875 0.90625 
+0.09375 0.4375 0.90625 
+0.15625 0.46875 0.9375 
+0.0625 0.34375 0.78125 
+0.0625 0.46875 0.78125 
+0.09375 0.4375 0.78125 
+0.09375 0.40625 0.8125 
+0.1875 0.46875 0.78125 
+0.15625 0.46875 0.8125 
+0.15625 0.4375 0.84375 
+0.1875 0.46875 0.90625 
+0.09375 0.3125 0.78125 
+0.21875 0.3125 0.78125 
+0.1875 0.34375 0.78125 
+0.15625 0.34375 0.8125 
+0.21875 0.4375 0.78125 
+0.21875 0.40625 0.8125 
+0.1875 0.40625 0.84375 
+0.21875 0.4375 0.90625 
+0.28125 0.34375 0.8125 
+0.28125 0.46875 0.8125 
+0.28125 0.4375 0.84375 
+0.3125 0.40625 0.84375 
+0.28125 0.46875 0.9375 
+0.3125 0.46875 0.90625 
+0.34375 0.4375 0.90625 
+0.40625 0.46875 0.9375 
+0.0625 0.03125 0.59375 
+0.0625 0.03125 0.71875 
+0.09375 0.03125 0.6875 
+0.09375 0.0625 0.65625 
+0.1875 0.03125 0.71875 
+0.15625 0.0625 0.71875 
+0.15625 0.09375 0.6875 
+0.1875 0.15625 0.71875 
+0.0625 0.03125 0.84375 
+0.0625 0.03125 0.96875 
+0.09375 0.03125 0.9375 
+0.09375 0.0625 0.90625 
+0.1875 0.03125 0.96875 
+0.15625 0.0625 0.96875 
+0.15625 0.09375 0.9375 
+0.1875 0.15625 0.96875 
+0.09375 0.03125 0.8125 
+0.21875 0.03125 0.8125 
+0.1875 0.03125 0.84375 
+0.15625 0.0625 0.84375 
+0.21875 0.03125 0.9375 
+0.21875 0.0625 0.90625 
+0.1875 0.09375 0.90625 
+0.21875 0.15625 0.9375 
+0.09375 0.0625 0.78125 
+0.21875 0.0625 0.78125 
+0.1875 0.09375 0.78125 
+0.15625 0.09375 0.8125 
+0.21875 0.1875 0.78125 
+0.21875 0.15625 0.8125 
+0.1875 0.15625 0.84375 
+0.21875 0.1875 0.90625 
+0.3125 0.03125 0.84375 
+0.3125 0.03125 0.96875 
+0.34375 0.03125 0.9375 
+0.34375 0.0625 0.90625 
+0.4375 0.03125 0.96875 
+0.40625 0.0625 0.96875 
+0.40625 0.09375 0.9375 
+0.4375 0.15625 0.96875 
+0.28125 0.0625 0.84375 
+0.28125 0.0625 0.96875 
+0.28125 0.09375 0.9375 
+0.3125 0.09375 0.90625 
+0.28125 0.1875 0.96875 
+0.3125 0.15625 0.96875 
+0.34375 0.15625 0.9375 
+0.40625 0.1875 0.96875 
+0.28125 0.09375 0.8125 
+0.28125 0.21875 0.8125 
+0.28125 0.1875 0.84375 
+0.3125 0.15625 0.84375 
+0.28125 0.21875 0.9375 
+0.3125 0.21875 0.90625 
+0.34375 0.1875 0.90625 
+0.40625 0.21875 0.9375 
+0.3125 0.28125 0.84375 
+0.3125 0.28125 0.96875 
+0.34375 0.28125 0.9375 
+0.34375 0.3125 0.90625 
+0.4375 0.28125 0.96875 
+0.40625 0.3125 0.96875 
+0.40625 0.34375 0.9375 
+0.4375 0.40625 0.96875 
+0.03125 0.0625 0.59375 
+0.03125 0.0625 0.71875 
+0.03125 0.09375 0.6875 
+0.0625 0.09375 0.65625 
+0.03125 0.1875 0.71875 
+0.0625 0.15625 0.71875 
+0.09375 0.15625 0.6875 
+0.15625 0.1875 0.71875 
+0.03125 0.0625 0.84375 
+0.03125 0.0625 0.96875 
+0.03125 0.09375 0.9375 
+0.0625 0.09375 0.90625 
+0.03125 0.1875 0.96875 
+0.0625 0.15625 0.96875 
+0.09375 0.15625 0.9375 
+0.15625 0.1875 0.96875 
+0.03125 0.09375 0.8125 
+0.03125 0.21875 0.8125 
+0.03125 0.1875 0.84375 
+0.0625 0.15625 0.84375 
+0.03125 0.21875 0.9375 
+0.0625 0.21875 0.90625 
+0.09375 0.1875 0.90625 
+0.15625 0.21875 0.9375 
+0.0625 0.09375 0.78125 
+0.0625 0.21875 0.78125 
+0.09375 0.1875 0.78125 
+0.09375 0.15625 0.8125 
+0.1875 0.21875 0.78125 
+0.15625 0.21875 0.8125 
+0.15625 0.1875 0.84375 
+0.1875 0.21875 0.90625 
+0.03125 0.3125 0.84375 
+0.03125 0.3125 0.96875 
+0.03125 0.34375 0.9375 
+0.0625 0.34375 0.90625 
+0.03125 0.4375 0.96875 
+0.0625 0.40625 0.96875 
+0.09375 0.40625 0.9375 
+0.15625 0.4375 0.96875 
+0.0625 0.28125 0.84375 
+0.0625 0.28125 0.96875 
+0.09375 0.28125 0.9375 
+0.09375 0.3125 0.90625 
+0.1875 0.28125 0.96875 
+0.15625 0.3125 0.96875 
+0.15625 0.34375 0.9375 
+0.1875 0.40625 0.96875 
+0.09375 0.28125 0.8125 
+0.21875 0.28125 0.8125 
+0.1875 0.28125 0.84375 
+0.15625 0.3125 0.84375 
+0.21875 0.28125 0.9375 
+0.21875 0.3125 0.90625 
+0.1875 0.34375 0.90625 
+0.21875 0.40625 0.9375 
+0.28125 0.3125 0.84375 
+0.28125 0.3125 0.96875 
+0.28125 0.34375 0.9375 
+0.3125 0.34375 0.90625 
+0.28125 0.4375 0.96875 
+0.3125 0.40625 0.96875 
+0.34375 0.40625 0.9375 
+0.40625 0.4375 0.96875 
+0.59375 0.0625 0.53125 
+0.71875 0.0625 0.53125 
+0.6875 0.09375 0.53125 
+0.65625 0.09375 0.5625 
+0.71875 0.1875 0.53125 
+0.71875 0.15625 0.5625 
+0.6875 0.15625 0.59375 
+0.71875 0.1875 0.65625 
+0.84375 0.0625 0.53125 
+0.96875 0.0625 0.53125 
+0.9375 0.09375 0.53125 
+0.90625 0.09375 0.5625 
+0.96875 0.1875 0.53125 
+0.96875 0.15625 0.5625 
+0.9375 0.15625 0.59375 
+0.96875 0.1875 0.65625 
+0.8125 0.09375 0.53125 
+0.8125 0.21875 0.53125 
+0.84375 0.1875 0.53125 
+0.84375 0.15625 0.5625 
+0.9375 0.21875 0.53125 
+0.90625 0.21875 0.5625 
+0.90625 0.1875 0.59375 
+0.9375 0.21875 0.65625 
+0.78125 0.09375 0.5625 
+0.78125 0.21875 0.5625 
+0.78125 0.1875 0.59375 
+0.8125 0.15625 0.59375 
+0.78125 0.21875 0.6875 
+0.8125 0.21875 0.65625 
+0.84375 0.1875 0.65625 
+0.90625 0.21875 0.6875 
+0.84375 0.3125 0.53125 
+0.96875 0.3125 0.53125 
+0.9375 0.34375 0.53125 
+0.90625 0.34375 0.5625 
+0.96875 0.4375 0.53125 
+0.96875 0.40625 0.5625 
+0.9375 0.40625 0.59375 
+0.96875 0.4375 0.65625 
+0.84375 0.28125 0.5625 
+0.96875 0.28125 0.5625 
+0.9375 0.28125 0.59375 
+0.90625 0.3125 0.59375 
+0.96875 0.28125 0.6875 
+0.96875 0.3125 0.65625 
+0.9375 0.34375 0.65625 
+0.96875 0.40625 0.6875 
+0.8125 0.28125 0.59375 
+0.8125 0.28125 0.71875 
+0.84375 0.28125 0.6875 
+0.84375 0.3125 0.65625 
+0.9375 0.28125 0.71875 
+0.90625 0.3125 0.71875 
+0.90625 0.34375 0.6875 
+0.9375 0.40625 0.71875 
+0.84375 0.3125 0.78125 
+0.96875 0.3125 0.78125 
+0.9375 0.34375 0.78125 
+0.90625 0.34375 0.8125 
+0.96875 0.4375 0.78125 
+0.96875 0.40625 0.8125 
+0.9375 0.40625 0.84375 
+0.96875 0.4375 0.90625 
+0.59375 0.03125 0.5625 
+0.71875 0.03125 0.5625 
+0.6875 0.03125 0.59375 
+0.65625 0.0625 0.59375 
+0.71875 0.03125 0.6875 
+0.71875 0.0625 0.65625 
+0.6875 0.09375 0.65625 
+0.71875 0.15625 0.6875 
+0.84375 0.03125 0.5625 
+0.96875 0.03125 0.5625 
+0.9375 0.03125 0.59375 
+0.90625 0.0625 0.59375 
+0.96875 0.03125 0.6875 
+0.96875 0.0625 0.65625 
+0.9375 0.09375 0.65625 
+0.96875 0.15625 0.6875 
+0.8125 0.03125 0.59375 
+0.8125 0.03125 0.71875 
+0.84375 0.03125 0.6875 
+0.84375 0.0625 0.65625 
+0.9375 0.03125 0.71875 
+0.90625 0.0625 0.71875 
+0.90625 0.09375 0.6875 
+0.9375 0.15625 0.71875 
+0.78125 0.0625 0.59375 
+0.78125 0.0625 0.71875 
+0.78125 0.09375 0.6875 
+0.8125 0.09375 0.65625 
+0.78125 0.1875 0.71875 
+0.8125 0.15625 0.71875 
+0.84375 0.15625 0.6875 
+0.90625 0.1875 0.71875 
+0.84375 0.03125 0.8125 
+0.96875 0.03125 0.8125 
+0.9375 0.03125 0.84375 
+0.90625 0.0625 0.84375 
+0.96875 0.03125 0.9375 
+0.96875 0.0625 0.90625 
+0.9375 0.09375 0.90625 
+0.96875 0.15625 0.9375 
+0.84375 0.0625 0.78125 
+0.96875 0.0625 0.78125 
+0.9375 0.09375 0.78125 
+0.90625 0.09375 0.8125 
+0.96875 0.1875 0.78125 
+0.96875 0.15625 0.8125 
+0.9375 0.15625 0.84375 
+0.96875 0.1875 0.90625 
+0.8125 0.09375 0.78125 
+0.8125 0.21875 0.78125 
+0.84375 0.1875 0.78125 
+0.84375 0.15625 0.8125 
+0.9375 0.21875 0.78125 
+0.90625 0.21875 0.8125 
+0.90625 0.1875 0.84375 
+0.9375 0.21875 0.90625 
+0.84375 0.28125 0.8125 
+0.96875 0.28125 0.8125 
+0.9375 0.28125 0.84375 
+0.90625 0.3125 0.84375 
+0.96875 0.28125 0.9375 
+0.96875 0.3125 0.90625 
+0.9375 0.34375 0.90625 
+0.96875 0.40625 0.9375 
+0.5625 0.09375 0.53125 
+0.5625 0.21875 0.53125 
+0.59375 0.1875 0.53125 
+0.59375 0.15625 0.5625 
+0.6875 0.21875 0.53125 
+0.65625 0.21875 0.5625 
+0.65625 0.1875 0.59375 
+0.6875 0.21875 0.65625 
+0.5625 0.34375 0.53125 
+0.6875 0.46875 0.53125 
+0.65625 0.4375 0.59375 
+0.6875 0.46875 0.65625 
+0.59375 0.3125 0.53125 
+0.71875 0.3125 0.53125 
+0.6875 0.34375 0.53125 
+0.65625 0.34375 0.5625 
+0.71875 0.4375 0.53125 
+0.71875 0.40625 0.5625 
+0.6875 0.40625 0.59375 
+0.71875 0.4375 0.65625 
+0.59375 0.28125 0.5625 
+0.71875 0.28125 0.5625 
+0.6875 0.28125 0.59375 
+0.65625 0.3125 0.59375 
+0.71875 0.28125 0.6875 
+0.71875 0.3125 0.65625 
+0.6875 0.34375 0.65625 
+0.71875 0.40625 0.6875 
+0.8125 0.34375 0.53125 
+0.8125 0.46875 0.53125 
+0.84375 0.4375 0.53125 
+0.84375 0.40625 0.5625 
+0.9375 0.46875 0.53125 
+0.90625 0.46875 0.5625 
+0.90625 0.4375 0.59375 
+0.9375 0.46875 0.65625 
+0.78125 0.34375 0.5625 
+0.78125 0.46875 0.5625 
+0.78125 0.4375 0.59375 
+0.8125 0.40625 0.59375 
+0.78125 0.46875 0.6875 
+0.8125 0.46875 0.65625 
+0.84375 0.4375 0.65625 
+0.90625 0.46875 0.6875 
+0.78125 0.3125 0.59375 
+0.78125 0.3125 0.71875 
+0.78125 0.34375 0.6875 
+0.8125 0.34375 0.65625 
+0.78125 0.4375 0.71875 
+0.8125 0.40625 0.71875 
+0.84375 0.40625 0.6875 
+0.90625 0.4375 0.71875 
+0.8125 0.34375 0.78125 
+0.8125 0.46875 0.78125 
+0.84375 0.4375 0.78125 
+0.84375 0.40625 0.8125 
+0.9375 0.46875 0.78125 
+0.90625 0.46875 0.8125 
+0.90625 0.4375 0.84375 
+0.9375 0.46875 0.90625 
+0.53125 0.09375 0.5625 
+0.53125 0.21875 0.5625 
+0.53125 0.1875 0.59375 
+0.5625 0.15625 0.59375 
+0.53125 0.21875 0.6875 
+0.5625 0.21875 0.65625 
+0.59375 0.1875 0.65625 
+0.65625 0.21875 0.6875 
+0.53125 0.34375 0.5625 
+0.53125 0.46875 0.6875 
+0.59375 0.4375 0.65625 
+0.65625 0.46875 0.6875 
+0.53125 0.3125 0.59375 
+0.53125 0.3125 0.71875 
+0.53125 0.34375 0.6875 
+0.5625 0.34375 0.65625 
+0.53125 0.4375 0.71875 
+0.5625 0.40625 0.71875 
+0.59375 0.40625 0.6875 
+0.65625 0.4375 0.71875 
+0.5625 0.28125 0.59375 
+0.5625 0.28125 0.71875 
+0.59375 0.28125 0.6875 
+0.59375 0.3125 0.65625 
+0.6875 0.28125 0.71875 
+0.65625 0.3125 0.71875 
+0.65625 0.34375 0.6875 
+0.6875 0.40625 0.71875 
+0.53125 0.34375 0.8125 
+0.53125 0.46875 0.8125 
+0.53125 0.4375 0.84375 
+0.5625 0.40625 0.84375 
+0.53125 0.46875 0.9375 
+0.5625 0.46875 0.90625 
+0.59375 0.4375 0.90625 
+0.65625 0.46875 0.9375 
+0.5625 0.34375 0.78125 
+0.5625 0.46875 0.78125 
+0.59375 0.4375 0.78125 
+0.59375 0.40625 0.8125 
+0.6875 0.46875 0.78125 
+0.65625 0.46875 0.8125 
+0.65625 0.4375 0.84375 
+0.6875 0.46875 0.90625 
+0.59375 0.3125 0.78125 
+0.71875 0.3125 0.78125 
+0.6875 0.34375 0.78125 
+0.65625 0.34375 0.8125 
+0.71875 0.4375 0.78125 
+0.71875 0.40625 0.8125 
+0.6875 0.40625 0.84375 
+0.71875 0.4375 0.90625 
+0.78125 0.34375 0.8125 
+0.78125 0.46875 0.8125 
+0.78125 0.4375 0.84375 
+0.8125 0.40625 0.84375 
+0.78125 0.46875 0.9375 
+0.8125 0.46875 0.90625 
+0.84375 0.4375 0.90625 
+0.90625 0.46875 0.9375 
+0.5625 0.03125 0.59375 
+0.5625 0.03125 0.71875 
+0.59375 0.03125 0.6875 
+0.59375 0.0625 0.65625 
+0.6875 0.03125 0.71875 
+0.65625 0.0625 0.71875 
+0.65625 0.09375 0.6875 
+0.6875 0.15625 0.71875 
+0.5625 0.03125 0.84375 
+0.5625 0.03125 0.96875 
+0.59375 0.03125 0.9375 
+0.59375 0.0625 0.90625 
+0.6875 0.03125 0.96875 
+0.65625 0.0625 0.96875 
+0.65625 0.09375 0.9375 
+0.6875 0.15625 0.96875 
+0.59375 0.03125 0.8125 
+0.71875 0.03125 0.8125 
+0.6875 0.03125 0.84375 
+0.65625 0.0625 0.84375 
+0.71875 0.03125 0.9375 
+0.71875 0.0625 0.90625 
+0.6875 0.09375 0.90625 
+0.71875 0.15625 0.9375 
+0.59375 0.0625 0.78125 
+0.71875 0.0625 0.78125 
+0.6875 0.09375 0.78125 
+0.65625 0.09375 0.8125 
+0.71875 0.1875 0.78125 
+0.71875 0.15625 0.8125 
+0.6875 0.15625 0.84375 
+0.71875 0.1875 0.90625 
+0.8125 0.03125 0.84375 
+0.8125 0.03125 0.96875 
+0.84375 0.03125 0.9375 
+0.84375 0.0625 0.90625 
+0.9375 0.03125 0.96875 
+0.90625 0.0625 0.96875 
+0.90625 0.09375 0.9375 
+0.9375 0.15625 0.96875 
+0.78125 0.0625 0.84375 
+0.78125 0.0625 0.96875 
+0.78125 0.09375 0.9375 
+0.8125 0.09375 0.90625 
+0.78125 0.1875 0.96875 
+0.8125 0.15625 0.96875 
+0.84375 0.15625 0.9375 
+0.90625 0.1875 0.96875 
+0.78125 0.09375 0.8125 
+0.78125 0.21875 0.8125 
+0.78125 0.1875 0.84375 
+0.8125 0.15625 0.84375 
+0.78125 0.21875 0.9375 
+0.8125 0.21875 0.90625 
+0.84375 0.1875 0.90625 
+0.90625 0.21875 0.9375 
+0.8125 0.28125 0.84375 
+0.8125 0.28125 0.96875 
+0.84375 0.28125 0.9375 
+0.84375 0.3125 0.90625 
+0.9375 0.28125 0.96875 
+0.90625 0.3125 0.96875 
+0.90625 0.34375 0.9375 
+0.9375 0.40625 0.96875 
+0.53125 0.0625 0.59375 
+0.53125 0.0625 0.71875 
+0.53125 0.09375 0.6875 
+0.5625 0.09375 0.65625 
+0.53125 0.1875 0.71875 
+0.5625 0.15625 0.71875 
+0.59375 0.15625 0.6875 
+0.65625 0.1875 0.71875 
+0.53125 0.0625 0.84375 
+0.53125 0.0625 0.96875 
+0.53125 0.09375 0.9375 
+0.5625 0.09375 0.90625 
+0.53125 0.1875 0.96875 
+0.5625 0.15625 0.96875 
+0.59375 0.15625 0.9375 
+0.65625 0.1875 0.96875 
+0.53125 0.09375 0.8125 
+0.53125 0.21875 0.8125 
+0.53125 0.1875 0.84375 
+0.5625 0.15625 0.84375 
+0.53125 0.21875 0.9375 
+0.5625 0.21875 0.90625 
+0.59375 0.1875 0.90625 
+0.65625 0.21875 0.9375 
+0.5625 0.09375 0.78125 
+0.5625 0.21875 0.78125 
+0.59375 0.1875 0.78125 
+0.59375 0.15625 0.8125 
+0.6875 0.21875 0.78125 
+0.65625 0.21875 0.8125 
+0.65625 0.1875 0.84375 
+0.6875 0.21875 0.90625 
+0.53125 0.3125 0.84375 
+0.53125 0.3125 0.96875 
+0.53125 0.34375 0.9375 
+0.5625 0.34375 0.90625 
+0.53125 0.4375 0.96875 
+0.5625 0.40625 0.96875 
+0.59375 0.40625 0.9375 
+0.65625 0.4375 0.96875 
+0.5625 0.28125 0.84375 
+0.5625 0.28125 0.96875 
+0.59375 0.28125 0.9375 
+0.59375 0.3125 0.90625 
+0.6875 0.28125 0.96875 
+0.65625 0.3125 0.96875 
+0.65625 0.34375 0.9375 
+0.6875 0.40625 0.96875 
+0.59375 0.28125 0.8125 
+0.71875 0.28125 0.8125 
+0.6875 0.28125 0.84375 
+0.65625 0.3125 0.84375 
+0.71875 0.28125 0.9375 
+0.71875 0.3125 0.90625 
+0.6875 0.34375 0.90625 
+0.71875 0.40625 0.9375 
+0.78125 0.3125 0.84375 
+0.78125 0.3125 0.96875 
+0.78125 0.34375 0.9375 
+0.8125 0.34375 0.90625 
+0.78125 0.4375 0.96875 
+0.8125 0.40625 0.96875 
+0.84375 0.40625 0.9375 
+0.90625 0.4375 0.96875 
+0.09375 0.5625 0.53125 
+0.21875 0.5625 0.53125 
+0.1875 0.59375 0.53125 
+0.15625 0.59375 0.5625 
+0.21875 0.6875 0.53125 
+0.21875 0.65625 0.5625 
+0.1875 0.65625 0.59375 
+0.21875 0.6875 0.65625 
+0.34375 0.5625 0.53125 
+0.46875 0.6875 0.53125 
+0.4375 0.65625 0.59375 
+0.46875 0.6875 0.65625 
+0.3125 0.59375 0.53125 
+0.3125 0.71875 0.53125 
+0.34375 0.6875 0.53125 
+0.34375 0.65625 0.5625 
+0.4375 0.71875 0.53125 
+0.40625 0.71875 0.5625 
+0.40625 0.6875 0.59375 
+0.4375 0.71875 0.65625 
+0.28125 0.59375 0.5625 
+0.28125 0.71875 0.5625 
+0.28125 0.6875 0.59375 
+0.3125 0.65625 0.59375 
+0.28125 0.71875 0.6875 
+0.3125 0.71875 0.65625 
+0.34375 0.6875 0.65625 
+0.40625 0.71875 0.6875 
+0.34375 0.8125 0.53125 
+0.46875 0.8125 0.53125 
+0.4375 0.84375 0.53125 
+0.40625 0.84375 0.5625 
+0.46875 0.9375 0.53125 
+0.46875 0.90625 0.5625 
+0.4375 0.90625 0.59375 
+0.46875 0.9375 0.65625 
+0.34375 0.78125 0.5625 
+0.46875 0.78125 0.5625 
+0.4375 0.78125 0.59375 
+0.40625 0.8125 0.59375 
+0.46875 0.78125 0.6875 
+0.46875 0.8125 0.65625 
+0.4375 0.84375 0.65625 
+0.46875 0.90625 0.6875 
+0.3125 0.78125 0.59375 
+0.3125 0.78125 0.71875 
+0.34375 0.78125 0.6875 
+0.34375 0.8125 0.65625 
+0.4375 0.78125 0.71875 
+0.40625 0.8125 0.71875 
+0.40625 0.84375 0.6875 
+0.4375 0.90625 0.71875 
+0.34375 0.8125 0.78125 
+0.46875 0.8125 0.78125 
+0.4375 0.84375 0.78125 
+0.40625 0.84375 0.8125 
+0.46875 0.9375 0.78125 
+0.46875 0.90625 0.8125 
+0.4375 0.90625 0.84375 
+0.46875 0.9375 0.90625 
+0.09375 0.53125 0.5625 
+0.21875 0.53125 0.5625 
+0.1875 0.53125 0.59375 
+0.15625 0.5625 0.59375 
+0.21875 0.53125 0.6875 
+0.21875 0.5625 0.65625 
+0.1875 0.59375 0.65625 
+0.21875 0.65625 0.6875 
+0.34375 0.53125 0.5625 
+0.46875 0.53125 0.6875 
+0.4375 0.59375 0.65625 
+0.46875 0.65625 0.6875 
+0.3125 0.53125 0.59375 
+0.3125 0.53125 0.71875 
+0.34375 0.53125 0.6875 
+0.34375 0.5625 0.65625 
+0.4375 0.53125 0.71875 
+0.40625 0.5625 0.71875 
+0.40625 0.59375 0.6875 
+0.4375 0.65625 0.71875 
+0.28125 0.5625 0.59375 
+0.28125 0.5625 0.71875 
+0.28125 0.59375 0.6875 
+0.3125 0.59375 0.65625 
+0.28125 0.6875 0.71875 
+0.3125 0.65625 0.71875 
+0.34375 0.65625 0.6875 
+0.40625 0.6875 0.71875 
+0.34375 0.53125 0.8125 
+0.46875 0.53125 0.8125 
+0.4375 0.53125 0.84375 
+0.40625 0.5625 0.84375 
+0.46875 0.53125 0.9375 
+0.46875 0.5625 0.90625 
+0.4375 0.59375 0.90625 
+0.46875 0.65625 0.9375 
+0.34375 0.5625 0.78125 
+0.46875 0.5625 0.78125 
+0.4375 0.59375 0.78125 
+0.40625 0.59375 0.8125 
+0.46875 0.6875 0.78125 
+0.46875 0.65625 0.8125 
+0.4375 0.65625 0.84375 
+0.46875 0.6875 0.90625 
+0.3125 0.59375 0.78125 
+0.3125 0.71875 0.78125 
+0.34375 0.6875 0.78125 
+0.34375 0.65625 0.8125 
+0.4375 0.71875 0.78125 
+0.40625 0.71875 0.8125 
+0.40625 0.6875 0.84375 
+0.4375 0.71875 0.90625 
+0.34375 0.78125 0.8125 
+0.46875 0.78125 0.8125 
+0.4375 0.78125 0.84375 
+0.40625 0.8125 0.84375 
+0.46875 0.78125 0.9375 
+0.46875 0.8125 0.90625 
+0.4375 0.84375 0.90625 
+0.46875 0.90625 0.9375 
+0.0625 0.59375 0.53125 
+0.0625 0.71875 0.53125 
+0.09375 0.6875 0.53125 
+0.09375 0.65625 0.5625 
+0.1875 0.71875 0.53125 
+0.15625 0.71875 0.5625 
+0.15625 0.6875 0.59375 
+0.1875 0.71875 0.65625 
+0.0625 0.84375 0.53125 
+0.0625 0.96875 0.53125 
+0.09375 0.9375 0.53125 
+0.09375 0.90625 0.5625 
+0.1875 0.96875 0.53125 
+0.15625 0.96875 0.5625 
+0.15625 0.9375 0.59375 
+0.1875 0.96875 0.65625 
+0.09375 0.8125 0.53125 
+0.21875 0.8125 0.53125 
+0.1875 0.84375 0.53125 
+0.15625 0.84375 0.5625 
+0.21875 0.9375 0.53125 
+0.21875 0.90625 0.5625 
+0.1875 0.90625 0.59375 
+0.21875 0.9375 0.65625 
+0.09375 0.78125 0.5625 
+0.21875 0.78125 0.5625 
+0.1875 0.78125 0.59375 
+0.15625 0.8125 0.59375 
+0.21875 0.78125 0.6875 
+0.21875 0.8125 0.65625 
+0.1875 0.84375 0.65625 
+0.21875 0.90625 0.6875 
+0.3125 0.84375 0.53125 
+0.3125 0.96875 0.53125 
+0.34375 0.9375 0.53125 
+0.34375 0.90625 0.5625 
+0.4375 0.96875 0.53125 
+0.40625 0.96875 0.5625 
+0.40625 0.9375 0.59375 
+0.4375 0.96875 0.65625 
+0.28125 0.84375 0.5625 
+0.28125 0.96875 0.5625 
+0.28125 0.9375 0.59375 
+0.3125 0.90625 0.59375 
+0.28125 0.96875 0.6875 
+0.3125 0.96875 0.65625 
+0.34375 0.9375 0.65625 
+0.40625 0.96875 0.6875 
+0.28125 0.8125 0.59375 
+0.28125 0.8125 0.71875 
+0.28125 0.84375 0.6875 
+0.3125 0.84375 0.65625 
+0.28125 0.9375 0.71875 
+0.3125 0.90625 0.71875 
+0.34375 0.90625 0.6875 
+0.40625 0.9375 0.71875 
+0.3125 0.84375 0.78125 
+0.3125 0.96875 0.78125 
+0.34375 0.9375 0.78125 
+0.34375 0.90625 0.8125 
+0.4375 0.96875 0.78125 
+0.40625 0.96875 0.8125 
+0.40625 0.9375 0.84375 
+0.4375 0.96875 0.90625 
+0.03125 0.59375 0.5625 
+0.03125 0.71875 0.5625 
+0.03125 0.6875 0.59375 
+0.0625 0.65625 0.59375 
+0.03125 0.71875 0.6875 
+0.0625 0.71875 0.65625 
+0.09375 0.6875 0.65625 
+0.15625 0.71875 0.6875 
+0.03125 0.84375 0.5625 
+0.03125 0.96875 0.5625 
+0.03125 0.9375 0.59375 
+0.0625 0.90625 0.59375 
+0.03125 0.96875 0.6875 
+0.0625 0.96875 0.65625 
+0.09375 0.9375 0.65625 
+0.15625 0.96875 0.6875 
+0.03125 0.8125 0.59375 
+0.03125 0.8125 0.71875 
+0.03125 0.84375 0.6875 
+0.0625 0.84375 0.65625 
+0.03125 0.9375 0.71875 
+0.0625 0.90625 0.71875 
+0.09375 0.90625 0.6875 
+0.15625 0.9375 0.71875 
+0.0625 0.78125 0.59375 
+0.0625 0.78125 0.71875 
+0.09375 0.78125 0.6875 
+0.09375 0.8125 0.65625 
+0.1875 0.78125 0.71875 
+0.15625 0.8125 0.71875 
+0.15625 0.84375 0.6875 
+0.1875 0.90625 0.71875 
+0.03125 0.84375 0.8125 
+0.03125 0.96875 0.8125 
+0.03125 0.9375 0.84375 
+0.0625 0.90625 0.84375 
+0.03125 0.96875 0.9375 
+0.0625 0.96875 0.90625 
+0.09375 0.9375 0.90625 
+0.15625 0.96875 0.9375 
+0.0625 0.84375 0.78125 
+0.0625 0.96875 0.78125 
+0.09375 0.9375 0.78125 
+0.09375 0.90625 0.8125 
+0.1875 0.96875 0.78125 
+0.15625 0.96875 0.8125 
+0.15625 0.9375 0.84375 
+0.1875 0.96875 0.90625 
+0.09375 0.8125 0.78125 
+0.21875 0.8125 0.78125 
+0.1875 0.84375 0.78125 
+0.15625 0.84375 0.8125 
+0.21875 0.9375 0.78125 
+0.21875 0.90625 0.8125 
+0.1875 0.90625 0.84375 
+0.21875 0.9375 0.90625 
+0.28125 0.84375 0.8125 
+0.28125 0.96875 0.8125 
+0.28125 0.9375 0.84375 
+0.3125 0.90625 0.84375 
+0.28125 0.96875 0.9375 
+0.3125 0.96875 0.90625 
+0.34375 0.9375 0.90625 
+0.40625 0.96875 0.9375 
+0.0625 0.53125 0.59375 
+0.0625 0.53125 0.71875 
+0.09375 0.53125 0.6875 
+0.09375 0.5625 0.65625 
+0.1875 0.53125 0.71875 
+0.15625 0.5625 0.71875 
+0.15625 0.59375 0.6875 
+0.1875 0.65625 0.71875 
+0.0625 0.53125 0.84375 
+0.0625 0.53125 0.96875 
+0.09375 0.53125 0.9375 
+0.09375 0.5625 0.90625 
+0.1875 0.53125 0.96875 
+0.15625 0.5625 0.96875 
+0.15625 0.59375 0.9375 
+0.1875 0.65625 0.96875 
+0.09375 0.53125 0.8125 
+0.21875 0.53125 0.8125 
+0.1875 0.53125 0.84375 
+0.15625 0.5625 0.84375 
+0.21875 0.53125 0.9375 
+0.21875 0.5625 0.90625 
+0.1875 0.59375 0.90625 
+0.21875 0.65625 0.9375 
+0.09375 0.5625 0.78125 
+0.21875 0.5625 0.78125 
+0.1875 0.59375 0.78125 
+0.15625 0.59375 0.8125 
+0.21875 0.6875 0.78125 
+0.21875 0.65625 0.8125 
+0.1875 0.65625 0.84375 
+0.21875 0.6875 0.90625 
+0.3125 0.53125 0.84375 
+0.3125 0.53125 0.96875 
+0.34375 0.53125 0.9375 
+0.34375 0.5625 0.90625 
+0.4375 0.53125 0.96875 
+0.40625 0.5625 0.96875 
+0.40625 0.59375 0.9375 
+0.4375 0.65625 0.96875 
+0.28125 0.5625 0.84375 
+0.28125 0.5625 0.96875 
+0.28125 0.59375 0.9375 
+0.3125 0.59375 0.90625 
+0.28125 0.6875 0.96875 
+0.3125 0.65625 0.96875 
+0.34375 0.65625 0.9375 
+0.40625 0.6875 0.96875 
+0.28125 0.59375 0.8125 
+0.28125 0.71875 0.8125 
+0.28125 0.6875 0.84375 
+0.3125 0.65625 0.84375 
+0.28125 0.71875 0.9375 
+0.3125 0.71875 0.90625 
+0.34375 0.6875 0.90625 
+0.40625 0.71875 0.9375 
+0.3125 0.78125 0.84375 
+0.3125 0.78125 0.96875 
+0.34375 0.78125 0.9375 
+0.34375 0.8125 0.90625 
+0.4375 0.78125 0.96875 
+0.40625 0.8125 0.96875 
+0.40625 0.84375 0.9375 
+0.4375 0.90625 0.96875 
+0.03125 0.5625 0.59375 
+0.03125 0.5625 0.71875 
+0.03125 0.59375 0.6875 
+0.0625 0.59375 0.65625 
+0.03125 0.6875 0.71875 
+0.0625 0.65625 0.71875 
+0.09375 0.65625 0.6875 
+0.15625 0.6875 0.71875 
+0.03125 0.5625 0.84375 
+0.03125 0.5625 0.96875 
+0.03125 0.59375 0.9375 
+0.0625 0.59375 0.90625 
+0.03125 0.6875 0.96875 
+0.0625 0.65625 0.96875 
+0.09375 0.65625 0.9375 
+0.15625 0.6875 0.96875 
+0.03125 0.59375 0.8125 
+0.03125 0.71875 0.8125 
+0.03125 0.6875 0.84375 
+0.0625 0.65625 0.84375 
+0.03125 0.71875 0.9375 
+0.0625 0.71875 0.90625 
+0.09375 0.6875 0.90625 
+0.15625 0.71875 0.9375 
+0.0625 0.59375 0.78125 
+0.0625 0.71875 0.78125 
+0.09375 0.6875 0.78125 
+0.09375 0.65625 0.8125 
+0.1875 0.71875 0.78125 
+0.15625 0.71875 0.8125 
+0.15625 0.6875 0.84375 
+0.1875 0.71875 0.90625 
+0.03125 0.8125 0.84375 
+0.03125 0.8125 0.96875 
+0.03125 0.84375 0.9375 
+0.0625 0.84375 0.90625 
+0.03125 0.9375 0.96875 
+0.0625 0.90625 0.96875 
+0.09375 0.90625 0.9375 
+0.15625 0.9375 0.96875 
+0.0625 0.78125 0.84375 
+0.0625 0.78125 0.96875 
+0.09375 0.78125 0.9375 
+0.09375 0.8125 0.90625 
+0.1875 0.78125 0.96875 
+0.15625 0.8125 0.96875 
+0.15625 0.84375 0.9375 
+0.1875 0.90625 0.96875 
+0.09375 0.78125 0.8125 
+0.21875 0.78125 0.8125 
+0.1875 0.78125 0.84375 
+0.15625 0.8125 0.84375 
+0.21875 0.78125 0.9375 
+0.21875 0.8125 0.90625 
+0.1875 0.84375 0.90625 
+0.21875 0.90625 0.9375 
+0.28125 0.8125 0.84375 
+0.28125 0.8125 0.96875 
+0.28125 0.84375 0.9375 
+0.3125 0.84375 0.90625 
+0.28125 0.9375 0.96875 
+0.3125 0.90625 0.96875 
+0.34375 0.90625 0.9375 
+0.40625 0.9375 0.96875 
+0.71875 0.5625 0.53125 
+0.71875 0.6875 0.53125 
+0.71875 0.65625 0.5625 
+0.6875 0.65625 0.59375 
+0.71875 0.6875 0.65625 
+0.84375 0.5625 0.53125 
+0.96875 0.5625 0.53125 
+0.9375 0.59375 0.53125 
+0.90625 0.59375 0.5625 
+0.96875 0.6875 0.53125 
+0.96875 0.65625 0.5625 
+0.9375 0.65625 0.59375 
+0.96875 0.6875 0.65625 
+0.8125 0.59375 0.53125 
+0.8125 0.71875 0.53125 
+0.84375 0.6875 0.53125 
+0.84375 0.65625 0.5625 
+0.9375 0.71875 0.53125 
+0.90625 0.71875 0.5625 
+0.90625 0.6875 0.59375 
+0.9375 0.71875 0.65625 
+0.78125 0.59375 0.5625 
+0.78125 0.71875 0.5625 
+0.78125 0.6875 0.59375 
+0.8125 0.65625 0.59375 
+0.78125 0.71875 0.6875 
+0.8125 0.71875 0.65625 
+0.84375 0.6875 0.65625 
+0.90625 0.71875 0.6875 
+0.84375 0.8125 0.53125 
+0.96875 0.8125 0.53125 
+0.9375 0.84375 0.53125 
+0.90625 0.84375 0.5625 
+0.96875 0.9375 0.53125 
+0.96875 0.90625 0.5625 
+0.9375 0.90625 0.59375 
+0.96875 0.9375 0.65625 
+0.84375 0.78125 0.5625 
+0.96875 0.78125 0.5625 
+0.9375 0.78125 0.59375 
+0.90625 0.8125 0.59375 
+0.96875 0.78125 0.6875 
+0.96875 0.8125 0.65625 
+0.9375 0.84375 0.65625 
+0.96875 0.90625 0.6875 
+0.8125 0.78125 0.59375 
+0.8125 0.78125 0.71875 
+0.84375 0.78125 0.6875 
+0.84375 0.8125 0.65625 
+0.9375 0.78125 0.71875 
+0.90625 0.8125 0.71875 
+0.90625 0.84375 0.6875 
+0.9375 0.90625 0.71875 
+0.84375 0.8125 0.78125 
+0.96875 0.8125 0.78125 
+0.9375 0.84375 0.78125 
+0.90625 0.84375 0.8125 
+0.96875 0.9375 0.78125 
+0.96875 0.90625 0.8125 
+0.9375 0.90625 0.84375 
+0.96875 0.9375 0.90625 
+0.71875 0.53125 0.5625 
+0.71875 0.53125 0.6875 
+0.71875 0.5625 0.65625 
+0.6875 0.59375 0.65625 
+0.71875 0.65625 0.6875 
+0.84375 0.53125 0.5625 
+0.96875 0.53125 0.5625 
+0.9375 0.53125 0.59375 
+0.90625 0.5625 0.59375 
+0.96875 0.53125 0.6875 
+0.96875 0.5625 0.65625 
+0.9375 0.59375 0.65625 
+0.96875 0.65625 0.6875 
+0.8125 0.53125 0.59375 
+0.8125 0.53125 0.71875 
+0.84375 0.53125 0.6875 
+0.84375 0.5625 0.65625 
+0.9375 0.53125 0.71875 
+0.90625 0.5625 0.71875 
+0.90625 0.59375 0.6875 
+0.9375 0.65625 0.71875 
+0.78125 0.5625 0.59375 
+0.78125 0.5625 0.71875 
+0.78125 0.59375 0.6875 
+0.8125 0.59375 0.65625 
+0.78125 0.6875 0.71875 
+0.8125 0.65625 0.71875 
+0.84375 0.65625 0.6875 
+0.90625 0.6875 0.71875 
+0.84375 0.53125 0.8125 
+0.96875 0.53125 0.8125 
+0.9375 0.53125 0.84375 
+0.90625 0.5625 0.84375 
+0.96875 0.53125 0.9375 
+0.96875 0.5625 0.90625 
+0.9375 0.59375 0.90625 
+0.96875 0.65625 0.9375 
+0.84375 0.5625 0.78125 
+0.96875 0.5625 0.78125 
+0.9375 0.59375 0.78125 
+0.90625 0.59375 0.8125 
+0.96875 0.6875 0.78125 
+0.96875 0.65625 0.8125 
+0.9375 0.65625 0.84375 
+0.96875 0.6875 0.90625 
+0.8125 0.59375 0.78125 
+0.8125 0.71875 0.78125 
+0.84375 0.6875 0.78125 
+0.84375 0.65625 0.8125 
+0.9375 0.71875 0.78125 
+0.90625 0.71875 0.8125 
+0.90625 0.6875 0.84375 
+0.9375 0.71875 0.90625 
+0.84375 0.78125 0.8125 
+0.96875 0.78125 0.8125 
+0.9375 0.78125 0.84375 
+0.90625 0.8125 0.84375 
+0.96875 0.78125 0.9375 
+0.96875 0.8125 0.90625 
+0.9375 0.84375 0.90625 
+0.96875 0.90625 0.9375 
+0.5625 0.71875 0.53125 
+0.6875 0.71875 0.53125 
+0.65625 0.71875 0.5625 
+0.65625 0.6875 0.59375 
+0.6875 0.71875 0.65625 
+0.5625 0.84375 0.53125 
+0.5625 0.96875 0.53125 
+0.59375 0.9375 0.53125 
+0.59375 0.90625 0.5625 
+0.6875 0.96875 0.53125 
+0.65625 0.96875 0.5625 
+0.65625 0.9375 0.59375 
+0.6875 0.96875 0.65625 
+0.59375 0.8125 0.53125 
+0.71875 0.8125 0.53125 
+0.6875 0.84375 0.53125 
+0.65625 0.84375 0.5625 
+0.71875 0.9375 0.53125 
+0.71875 0.90625 0.5625 
+0.6875 0.90625 0.59375 
+0.71875 0.9375 0.65625 
+0.59375 0.78125 0.5625 
+0.71875 0.78125 0.5625 
+0.6875 0.78125 0.59375 
+0.65625 0.8125 0.59375 
+0.71875 0.78125 0.6875 
+0.71875 0.8125 0.65625 
+0.6875 0.84375 0.65625 
+0.71875 0.90625 0.6875 
+0.8125 0.84375 0.53125 
+0.8125 0.96875 0.53125 
+0.84375 0.9375 0.53125 
+0.84375 0.90625 0.5625 
+0.9375 0.96875 0.53125 
+0.90625 0.96875 0.5625 
+0.90625 0.9375 0.59375 
+0.9375 0.96875 0.65625 
+0.78125 0.84375 0.5625 
+0.78125 0.96875 0.5625 
+0.78125 0.9375 0.59375 
+0.8125 0.90625 0.59375 
+0.78125 0.96875 0.6875 
+0.8125 0.96875 0.65625 
+0.84375 0.9375 0.65625 
+0.90625 0.96875 0.6875 
+0.78125 0.8125 0.59375 
+0.78125 0.8125 0.71875 
+0.78125 0.84375 0.6875 
+0.8125 0.84375 0.65625 
+0.78125 0.9375 0.71875 
+0.8125 0.90625 0.71875 
+0.84375 0.90625 0.6875 
+0.90625 0.9375 0.71875 
+0.8125 0.84375 0.78125 
+0.8125 0.96875 0.78125 
+0.84375 0.9375 0.78125 
+0.84375 0.90625 0.8125 
+0.9375 0.96875 0.78125 
+0.90625 0.96875 0.8125 
+0.90625 0.9375 0.84375 
+0.9375 0.96875 0.90625 
+0.53125 0.71875 0.5625 
+0.53125 0.71875 0.6875 
+0.5625 0.71875 0.65625 
+0.59375 0.6875 0.65625 
+0.65625 0.71875 0.6875 
+0.53125 0.84375 0.5625 
+0.53125 0.96875 0.5625 
+0.53125 0.9375 0.59375 
+0.5625 0.90625 0.59375 
+0.53125 0.96875 0.6875 
+0.5625 0.96875 0.65625 
+0.59375 0.9375 0.65625 
+0.65625 0.96875 0.6875 
+0.53125 0.8125 0.59375 
+0.53125 0.8125 0.71875 
+0.53125 0.84375 0.6875 
+0.5625 0.84375 0.65625 
+0.53125 0.9375 0.71875 
+0.5625 0.90625 0.71875 
+0.59375 0.90625 0.6875 
+0.65625 0.9375 0.71875 
+0.5625 0.78125 0.59375 
+0.5625 0.78125 0.71875 
+0.59375 0.78125 0.6875 
+0.59375 0.8125 0.65625 
+0.6875 0.78125 0.71875 
+0.65625 0.8125 0.71875 
+0.65625 0.84375 0.6875 
+0.6875 0.90625 0.71875 
+0.53125 0.84375 0.8125 
+0.53125 0.96875 0.8125 
+0.53125 0.9375 0.84375 
+0.5625 0.90625 0.84375 
+0.53125 0.96875 0.9375 
+0.5625 0.96875 0.90625 
+0.59375 0.9375 0.90625 
+0.65625 0.96875 0.9375 
+0.5625 0.84375 0.78125 
+0.5625 0.96875 0.78125 
+0.59375 0.9375 0.78125 
+0.59375 0.90625 0.8125 
+0.6875 0.96875 0.78125 
+0.65625 0.96875 0.8125 
+0.65625 0.9375 0.84375 
+0.6875 0.96875 0.90625 
+0.59375 0.8125 0.78125 
+0.71875 0.8125 0.78125 
+0.6875 0.84375 0.78125 
+0.65625 0.84375 0.8125 
+0.71875 0.9375 0.78125 
+0.71875 0.90625 0.8125 
+0.6875 0.90625 0.84375 
+0.71875 0.9375 0.90625 
+0.78125 0.84375 0.8125 
+0.78125 0.96875 0.8125 
+0.78125 0.9375 0.84375 
+0.8125 0.90625 0.84375 
+0.78125 0.96875 0.9375 
+0.8125 0.96875 0.90625 
+0.84375 0.9375 0.90625 
+0.90625 0.96875 0.9375 
+0.5625 0.53125 0.71875 
+0.6875 0.53125 0.71875 
+0.65625 0.5625 0.71875 
+0.65625 0.59375 0.6875 
+0.6875 0.65625 0.71875 
+0.5625 0.53125 0.84375 
+0.5625 0.53125 0.96875 
+0.59375 0.53125 0.9375 
+0.59375 0.5625 0.90625 
+0.6875 0.53125 0.96875 
+0.65625 0.5625 0.96875 
+0.65625 0.59375 0.9375 
+0.6875 0.65625 0.96875 
+0.59375 0.53125 0.8125 
+0.71875 0.53125 0.8125 
+0.6875 0.53125 0.84375 
+0.65625 0.5625 0.84375 
+0.71875 0.53125 0.9375 
+0.71875 0.5625 0.90625 
+0.6875 0.59375 0.90625 
+0.71875 0.65625 0.9375 
+0.59375 0.5625 0.78125 
+0.71875 0.5625 0.78125 
+0.6875 0.59375 0.78125 
+0.65625 0.59375 0.8125 
+0.71875 0.6875 0.78125 
+0.71875 0.65625 0.8125 
+0.6875 0.65625 0.84375 
+0.71875 0.6875 0.90625 
+0.8125 0.53125 0.84375 
+0.8125 0.53125 0.96875 
+0.84375 0.53125 0.9375 
+0.84375 0.5625 0.90625 
+0.9375 0.53125 0.96875 
+0.90625 0.5625 0.96875 
+0.90625 0.59375 0.9375 
+0.9375 0.65625 0.96875 
+0.78125 0.5625 0.84375 
+0.78125 0.5625 0.96875 
+0.78125 0.59375 0.9375 
+0.8125 0.59375 0.90625 
+0.78125 0.6875 0.96875 
+0.8125 0.65625 0.96875 
+0.84375 0.65625 0.9375 
+0.90625 0.6875 0.96875 
+0.78125 0.59375 0.8125 
+0.78125 0.71875 0.8125 
+0.78125 0.6875 0.84375 
+0.8125 0.65625 0.84375 
+0.78125 0.71875 0.9375 
+0.8125 0.71875 0.90625 
+0.84375 0.6875 0.90625 
+0.90625 0.71875 0.9375 
+0.8125 0.78125 0.84375 
+0.8125 0.78125 0.96875 
+0.84375 0.78125 0.9375 
+0.84375 0.8125 0.90625 
+0.9375 0.78125 0.96875 
+0.90625 0.8125 0.96875 
+0.90625 0.84375 0.9375 
+0.9375 0.90625 0.96875 
+0.53125 0.5625 0.71875 
+0.53125 0.6875 0.71875 
+0.5625 0.65625 0.71875 
+0.59375 0.65625 0.6875 
+0.65625 0.6875 0.71875 
+0.53125 0.5625 0.84375 
+0.53125 0.5625 0.96875 
+0.53125 0.59375 0.9375 
+0.5625 0.59375 0.90625 
+0.53125 0.6875 0.96875 
+0.5625 0.65625 0.96875 
+0.59375 0.65625 0.9375 
+0.65625 0.6875 0.96875 
+0.53125 0.59375 0.8125 
+0.53125 0.71875 0.8125 
+0.53125 0.6875 0.84375 
+0.5625 0.65625 0.84375 
+0.53125 0.71875 0.9375 
+0.5625 0.71875 0.90625 
+0.59375 0.6875 0.90625 
+0.65625 0.71875 0.9375 
+0.5625 0.59375 0.78125 
+0.5625 0.71875 0.78125 
+0.59375 0.6875 0.78125 
+0.59375 0.65625 0.8125 
+0.6875 0.71875 0.78125 
+0.65625 0.71875 0.8125 
+0.65625 0.6875 0.84375 
+0.6875 0.71875 0.90625 
+0.53125 0.8125 0.84375 
+0.53125 0.8125 0.96875 
+0.53125 0.84375 0.9375 
+0.5625 0.84375 0.90625 
+0.53125 0.9375 0.96875 
+0.5625 0.90625 0.96875 
+0.59375 0.90625 0.9375 
+0.65625 0.9375 0.96875 
+0.5625 0.78125 0.84375 
+0.5625 0.78125 0.96875 
+0.59375 0.78125 0.9375 
+0.59375 0.8125 0.90625 
+0.6875 0.78125 0.96875 
+0.65625 0.8125 0.96875 
+0.65625 0.84375 0.9375 
+0.6875 0.90625 0.96875 
+0.59375 0.78125 0.8125 
+0.71875 0.78125 0.8125 
+0.6875 0.78125 0.84375 
+0.65625 0.8125 0.84375 
+0.71875 0.78125 0.9375 
+0.71875 0.8125 0.90625 
+0.6875 0.84375 0.90625 
+0.71875 0.90625 0.9375 
+0.78125 0.8125 0.84375 
+0.78125 0.8125 0.96875 
+0.78125 0.84375 0.9375 
+0.8125 0.84375 0.90625 
+0.78125 0.9375 0.96875 
+0.8125 0.90625 0.96875 
+0.84375 0.90625 0.9375 
+0.90625 0.9375 0.96875 
+0.46875 0.390625 0.3125 
+0.46875 0.421875 0.3125 
+0.4375 0.390625 0.34375 
+0.4375 0.421875 0.34375 
+0.46875 0.40625 0.390625 
+0.46875 0.453125 0.390625 
+0.46875 0.4375 0.40625 
+0.46875 0.453125 0.4375 
+0.46875 0.3125 0.390625 
+0.46875 0.3125 0.421875 
+0.4375 0.34375 0.390625 
+0.4375 0.34375 0.421875 
+0.46875 0.390625 0.40625 
+0.46875 0.390625 0.453125 
+0.46875 0.40625 0.4375 
+0.46875 0.4375 0.453125 
+0.390625 0.46875 0.3125 
+0.421875 0.46875 0.3125 
+0.390625 0.4375 0.34375 
+0.421875 0.4375 0.34375 
+0.40625 0.46875 0.390625 
+0.453125 0.46875 0.390625 
+0.4375 0.46875 0.40625 
+0.453125 0.46875 0.4375 
+0.3125 0.46875 0.390625 
+0.3125 0.46875 0.421875 
+0.34375 0.4375 0.390625 
+0.34375 0.4375 0.421875 
+0.390625 0.46875 0.40625 
+0.390625 0.46875 0.453125 
+0.40625 0.46875 0.4375 
+0.4375 0.46875 0.453125 
+0.390625 0.3125 0.46875 
+0.421875 0.3125 0.46875 
+0.390625 0.34375 0.4375 
+0.421875 0.34375 0.4375 
+0.40625 0.390625 0.46875 
+0.453125 0.390625 0.46875 
+0.4375 0.40625 0.46875 
+0.453125 0.4375 0.46875 
+0.3125 0.390625 0.46875 
+0.3125 0.421875 0.46875 
+0.34375 0.390625 0.4375 
+0.34375 0.421875 0.4375 
+0.390625 0.40625 0.46875 
+0.390625 0.453125 0.46875 
+0.40625 0.4375 0.46875 
+0.4375 0.453125 0.46875 
+0.53125 0.421875 0.34375 
+0.53125 0.453125 0.34375 
+0.515625 0.421875 0.40625 
+0.515625 0.484375 0.40625 
+0.515625 0.46875 0.421875 
+0.53125 0.453125 0.421875 
+0.515625 0.484375 0.46875 
+0.53125 0.484375 0.453125 
+0.546875 0.46875 0.453125 
+0.578125 0.484375 0.46875 
+0.546875 0.4375 0.390625 
+0.59375 0.484375 0.4375 
+0.546875 0.484375 0.390625 
+0.5625 0.46875 0.40625 
+0.578125 0.421875 0.390625 
+0.609375 0.453125 0.421875 
+0.53125 0.34375 0.421875 
+0.53125 0.34375 0.453125 
+0.515625 0.40625 0.421875 
+0.515625 0.40625 0.484375 
+0.515625 0.421875 0.46875 
+0.53125 0.421875 0.453125 
+0.515625 0.46875 0.484375 
+0.53125 0.453125 0.484375 
+0.546875 0.453125 0.46875 
+0.578125 0.46875 0.484375 
+0.546875 0.390625 0.4375 
+0.59375 0.4375 0.484375 
+0.546875 0.390625 0.484375 
+0.5625 0.40625 0.46875 
+0.578125 0.390625 0.421875 
+0.609375 0.421875 0.453125 
+0.421875 0.53125 0.34375 
+0.453125 0.53125 0.34375 
+0.421875 0.515625 0.40625 
+0.484375 0.515625 0.40625 
+0.46875 0.515625 0.421875 
+0.453125 0.53125 0.421875 
+0.484375 0.515625 0.46875 
+0.484375 0.53125 0.453125 
+0.46875 0.546875 0.453125 
+0.484375 0.578125 0.46875 
+0.4375 0.546875 0.390625 
+0.484375 0.59375 0.4375 
+0.484375 0.546875 0.390625 
+0.46875 0.5625 0.40625 
+0.421875 0.578125 0.390625 
+0.453125 0.609375 0.421875 
+0.34375 0.53125 0.421875 
+0.34375 0.53125 0.453125 
+0.40625 0.515625 0.421875 
+0.40625 0.515625 0.484375 
+0.421875 0.515625 0.46875 
+0.421875 0.53125 0.453125 
+0.46875 0.515625 0.484375 
+0.453125 0.53125 0.484375 
+0.453125 0.546875 0.46875 
+0.46875 0.578125 0.484375 
+0.390625 0.546875 0.4375 
+0.4375 0.59375 0.484375 
+0.390625 0.546875 0.484375 
+0.40625 0.5625 0.46875 
+0.390625 0.578125 0.421875 
+0.421875 0.609375 0.453125 
+0.53125 0.515625 0.421875 
+0.53125 0.515625 0.484375 
+0.546875 0.515625 0.46875 
+0.546875 0.53125 0.453125 
+0.59375 0.515625 0.484375 
+0.578125 0.53125 0.484375 
+0.578125 0.546875 0.46875 
+0.59375 0.578125 0.484375 
+0.5625 0.515625 0.40625 
+0.609375 0.515625 0.453125 
+0.59375 0.53125 0.4375 
+0.609375 0.5625 0.453125 
+0.578125 0.546875 0.390625 
+0.609375 0.578125 0.421875 
+0.65625 0.546875 0.46875 
+0.65625 0.578125 0.46875 
+0.515625 0.53125 0.421875 
+0.515625 0.53125 0.484375 
+0.515625 0.546875 0.46875 
+0.53125 0.546875 0.453125 
+0.515625 0.59375 0.484375 
+0.53125 0.578125 0.484375 
+0.546875 0.578125 0.46875 
+0.578125 0.59375 0.484375 
+0.515625 0.5625 0.40625 
+0.515625 0.609375 0.453125 
+0.53125 0.59375 0.4375 
+0.5625 0.609375 0.453125 
+0.546875 0.578125 0.390625 
+0.578125 0.609375 0.421875 
+0.546875 0.65625 0.46875 
+0.578125 0.65625 0.46875 
+0.421875 0.34375 0.53125 
+0.453125 0.34375 0.53125 
+0.421875 0.40625 0.515625 
+0.484375 0.40625 0.515625 
+0.46875 0.421875 0.515625 
+0.453125 0.421875 0.53125 
+0.484375 0.46875 0.515625 
+0.484375 0.453125 0.53125 
+0.46875 0.453125 0.546875 
+0.484375 0.46875 0.578125 
+0.4375 0.390625 0.546875 
+0.484375 0.4375 0.59375 
+0.484375 0.390625 0.546875 
+0.46875 0.40625 0.5625 
+0.421875 0.390625 0.578125 
+0.453125 0.421875 0.609375 
+0.34375 0.421875 0.53125 
+0.34375 0.453125 0.53125 
+0.40625 0.421875 0.515625 
+0.40625 0.484375 0.515625 
+0.421875 0.46875 0.515625 
+0.421875 0.453125 0.53125 
+0.46875 0.484375 0.515625 
+0.453125 0.484375 0.53125 
+0.453125 0.46875 0.546875 
+0.46875 0.484375 0.578125 
+0.390625 0.4375 0.546875 
+0.4375 0.484375 0.59375 
+0.390625 0.484375 0.546875 
+0.40625 0.46875 0.5625 
+0.390625 0.421875 0.578125 
+0.421875 0.453125 0.609375 
+0.53125 0.421875 0.515625 
+0.53125 0.484375 0.515625 
+0.546875 0.46875 0.515625 
+0.546875 0.453125 0.53125 
+0.59375 0.484375 0.515625 
+0.578125 0.484375 0.53125 
+0.578125 0.46875 0.546875 
+0.59375 0.484375 0.578125 
+0.5625 0.40625 0.515625 
+0.609375 0.453125 0.515625 
+0.59375 0.4375 0.53125 
+0.609375 0.453125 0.5625 
+0.578125 0.390625 0.546875 
+0.609375 0.421875 0.578125 
+0.65625 0.46875 0.546875 
+0.65625 0.46875 0.578125 
+0.515625 0.421875 0.53125 
+0.515625 0.484375 0.53125 
+0.515625 0.46875 0.546875 
+0.53125 0.453125 0.546875 
+0.515625 0.484375 0.59375 
+0.53125 0.484375 0.578125 
+0.546875 0.46875 0.578125 
+0.578125 0.484375 0.59375 
+0.515625 0.40625 0.5625 
+0.515625 0.453125 0.609375 
+0.53125 0.4375 0.59375 
+0.5625 0.453125 0.609375 
+0.546875 0.390625 0.578125 
+0.578125 0.421875 0.609375 
+0.546875 0.46875 0.65625 
+0.578125 0.46875 0.65625 
+0.421875 0.53125 0.515625 
+0.484375 0.53125 0.515625 
+0.46875 0.546875 0.515625 
+0.453125 0.546875 0.53125 
+0.484375 0.59375 0.515625 
+0.484375 0.578125 0.53125 
+0.46875 0.578125 0.546875 
+0.484375 0.59375 0.578125 
+0.40625 0.5625 0.515625 
+0.453125 0.609375 0.515625 
+0.4375 0.59375 0.53125 
+0.453125 0.609375 0.5625 
+0.390625 0.578125 0.546875 
+0.421875 0.609375 0.578125 
+0.46875 0.65625 0.546875 
+0.46875 0.65625 0.578125 
+0.421875 0.515625 0.53125 
+0.484375 0.515625 0.53125 
+0.46875 0.515625 0.546875 
+0.453125 0.53125 0.546875 
+0.484375 0.515625 0.59375 
+0.484375 0.53125 0.578125 
+0.46875 0.546875 0.578125 
+0.484375 0.578125 0.59375 
+0.40625 0.515625 0.5625 
+0.453125 0.515625 0.609375 
+0.4375 0.53125 0.59375 
+0.453125 0.5625 0.609375 
+0.390625 0.546875 0.578125 
+0.421875 0.578125 0.609375 
+0.46875 0.546875 0.65625 
+0.46875 0.578125 0.65625 
+0.5625 0.546875 0.53125 
+0.609375 0.546875 0.53125 
+0.59375 0.5625 0.53125 
+0.609375 0.59375 0.53125 
+0.6875 0.578125 0.53125 
+0.6875 0.609375 0.53125 
+0.65625 0.578125 0.5625 
+0.65625 0.609375 0.5625 
+0.5625 0.53125 0.546875 
+0.609375 0.53125 0.546875 
+0.59375 0.53125 0.5625 
+0.609375 0.53125 0.59375 
+0.6875 0.53125 0.578125 
+0.6875 0.53125 0.609375 
+0.65625 0.5625 0.578125 
+0.65625 0.5625 0.609375 
+0.546875 0.5625 0.53125 
+0.546875 0.609375 0.53125 
+0.5625 0.59375 0.53125 
+0.59375 0.609375 0.53125 
+0.578125 0.6875 0.53125 
+0.609375 0.6875 0.53125 
+0.578125 0.65625 0.5625 
+0.609375 0.65625 0.5625 
+0.53125 0.5625 0.546875 
+0.53125 0.609375 0.546875 
+0.53125 0.59375 0.5625 
+0.53125 0.609375 0.59375 
+0.53125 0.6875 0.578125 
+0.53125 0.6875 0.609375 
+0.5625 0.65625 0.578125 
+0.5625 0.65625 0.609375 
+0.546875 0.53125 0.5625 
+0.546875 0.53125 0.609375 
+0.5625 0.53125 0.59375 
+0.59375 0.53125 0.609375 
+0.578125 0.53125 0.6875 
+0.609375 0.53125 0.6875 
+0.578125 0.5625 0.65625 
+0.609375 0.5625 0.65625 
+0.53125 0.546875 0.5625 
+0.53125 0.546875 0.609375 
+0.53125 0.5625 0.59375 
+0.53125 0.59375 0.609375 
+0.53125 0.578125 0.6875 
+0.53125 0.609375 0.6875 
+0.5625 0.578125 0.65625 
+0.5625 0.609375 0.65625 
@@ -0,0 +1,5028 @@
+0.09375 0.0625 0.03125 
+0.21875 0.0625 0.03125 
+0.1875 0.09375 0.03125 
+0.15625 0.09375 0.0625 
+0.21875 0.1875 0.03125 
+0.21875 0.15625 0.0625 
+0.1875 0.15625 0.09375 
+0.21875 0.1875 0.15625 
+0.34375 0.0625 0.03125 
+0.46875 0.0625 0.03125 
+0.4375 0.09375 0.03125 
+0.40625 0.09375 0.0625 
+0.46875 0.1875 0.03125 
+0.46875 0.15625 0.0625 
+0.4375 0.15625 0.09375 
+0.46875 0.1875 0.15625 
+0.3125 0.09375 0.03125 
+0.3125 0.21875 0.03125 
+0.34375 0.1875 0.03125 
+0.34375 0.15625 0.0625 
+0.4375 0.21875 0.03125 
+0.40625 0.21875 0.0625 
+0.40625 0.1875 0.09375 
+0.4375 0.21875 0.15625 
+0.28125 0.09375 0.0625 
+0.28125 0.21875 0.0625 
+0.28125 0.1875 0.09375 
+0.3125 0.15625 0.09375 
+0.28125 0.21875 0.1875 
+0.3125 0.21875 0.15625 
+0.34375 0.1875 0.15625 
+0.40625 0.21875 0.1875 
+0.34375 0.3125 0.03125 
+0.46875 0.3125 0.03125 
+0.4375 0.34375 0.03125 
+0.40625 0.34375 0.0625 
+0.46875 0.4375 0.03125 
+0.46875 0.40625 0.0625 
+0.4375 0.40625 0.09375 
+0.46875 0.4375 0.15625 
+0.34375 0.28125 0.0625 
+0.46875 0.28125 0.0625 
+0.4375 0.28125 0.09375 
+0.40625 0.3125 0.09375 
+0.46875 0.28125 0.1875 
+0.46875 0.3125 0.15625 
+0.4375 0.34375 0.15625 
+0.46875 0.40625 0.1875 
+0.3125 0.28125 0.09375 
+0.3125 0.28125 0.21875 
+0.34375 0.28125 0.1875 
+0.34375 0.3125 0.15625 
+0.4375 0.28125 0.21875 
+0.09375 0.03125 0.0625 
+0.21875 0.03125 0.0625 
+0.1875 0.03125 0.09375 
+0.15625 0.0625 0.09375 
+0.21875 0.03125 0.1875 
+0.21875 0.0625 0.15625 
+0.1875 0.09375 0.15625 
+0.21875 0.15625 0.1875 
+0.34375 0.03125 0.0625 
+0.46875 0.03125 0.0625 
+0.4375 0.03125 0.09375 
+0.40625 0.0625 0.09375 
+0.46875 0.03125 0.1875 
+0.46875 0.0625 0.15625 
+0.4375 0.09375 0.15625 
+0.46875 0.15625 0.1875 
+0.3125 0.03125 0.09375 
+0.3125 0.03125 0.21875 
+0.34375 0.03125 0.1875 
+0.34375 0.0625 0.15625 
+0.4375 0.03125 0.21875 
+0.40625 0.0625 0.21875 
+0.40625 0.09375 0.1875 
+0.4375 0.15625 0.21875 
+0.28125 0.0625 0.09375 
+0.28125 0.0625 0.21875 
+0.28125 0.09375 0.1875 
+0.3125 0.09375 0.15625 
+0.28125 0.1875 0.21875 
+0.3125 0.15625 0.21875 
+0.34375 0.15625 0.1875 
+0.40625 0.1875 0.21875 
+0.34375 0.03125 0.3125 
+0.46875 0.03125 0.3125 
+0.4375 0.03125 0.34375 
+0.40625 0.0625 0.34375 
+0.46875 0.03125 0.4375 
+0.46875 0.0625 0.40625 
+0.4375 0.09375 0.40625 
+0.46875 0.15625 0.4375 
+0.34375 0.0625 0.28125 
+0.46875 0.0625 0.28125 
+0.4375 0.09375 0.28125 
+0.40625 0.09375 0.3125 
+0.46875 0.1875 0.28125 
+0.46875 0.15625 0.3125 
+0.4375 0.15625 0.34375 
+0.46875 0.1875 0.40625 
+0.3125 0.09375 0.28125 
+0.3125 0.21875 0.28125 
+0.34375 0.1875 0.28125 
+0.34375 0.15625 0.3125 
+0.4375 0.21875 0.28125 
+0.0625 0.09375 0.03125 
+0.0625 0.21875 0.03125 
+0.09375 0.1875 0.03125 
+0.09375 0.15625 0.0625 
+0.1875 0.21875 0.03125 
+0.15625 0.21875 0.0625 
+0.15625 0.1875 0.09375 
+0.1875 0.21875 0.15625 
+0.0625 0.34375 0.03125 
+0.0625 0.46875 0.03125 
+0.09375 0.4375 0.03125 
+0.09375 0.40625 0.0625 
+0.1875 0.46875 0.03125 
+0.15625 0.46875 0.0625 
+0.15625 0.4375 0.09375 
+0.1875 0.46875 0.15625 
+0.09375 0.3125 0.03125 
+0.21875 0.3125 0.03125 
+0.1875 0.34375 0.03125 
+0.15625 0.34375 0.0625 
+0.21875 0.4375 0.03125 
+0.21875 0.40625 0.0625 
+0.1875 0.40625 0.09375 
+0.21875 0.4375 0.15625 
+0.09375 0.28125 0.0625 
+0.21875 0.28125 0.0625 
+0.1875 0.28125 0.09375 
+0.15625 0.3125 0.09375 
+0.21875 0.28125 0.1875 
+0.21875 0.3125 0.15625 
+0.1875 0.34375 0.15625 
+0.21875 0.40625 0.1875 
+0.3125 0.34375 0.03125 
+0.3125 0.46875 0.03125 
+0.34375 0.4375 0.03125 
+0.34375 0.40625 0.0625 
+0.4375 0.46875 0.03125 
+0.40625 0.46875 0.0625 
+0.40625 0.4375 0.09375 
+0.4375 0.46875 0.15625 
+0.28125 0.34375 0.0625 
+0.28125 0.46875 0.0625 
+0.28125 0.4375 0.09375 
+0.3125 0.40625 0.09375 
+0.28125 0.46875 0.1875 
+0.3125 0.46875 0.15625 
+0.34375 0.4375 0.15625 
+0.40625 0.46875 0.1875 
+0.28125 0.3125 0.09375 
+0.28125 0.3125 0.21875 
+0.28125 0.34375 0.1875 
+0.3125 0.34375 0.15625 
+0.28125 0.4375 0.21875 
+0.03125 0.09375 0.0625 
+0.03125 0.21875 0.0625 
+0.03125 0.1875 0.09375 
+0.0625 0.15625 0.09375 
+0.03125 0.21875 0.1875 
+0.0625 0.21875 0.15625 
+0.09375 0.1875 0.15625 
+0.15625 0.21875 0.1875 
+0.03125 0.34375 0.0625 
+0.03125 0.46875 0.0625 
+0.03125 0.4375 0.09375 
+0.0625 0.40625 0.09375 
+0.03125 0.46875 0.1875 
+0.0625 0.46875 0.15625 
+0.09375 0.4375 0.15625 
+0.15625 0.46875 0.1875 
+0.03125 0.3125 0.09375 
+0.03125 0.3125 0.21875 
+0.03125 0.34375 0.1875 
+0.0625 0.34375 0.15625 
+0.03125 0.4375 0.21875 
+0.0625 0.40625 0.21875 
+0.09375 0.40625 0.1875 
+0.15625 0.4375 0.21875 
+0.0625 0.28125 0.09375 
+0.0625 0.28125 0.21875 
+0.09375 0.28125 0.1875 
+0.09375 0.3125 0.15625 
+0.1875 0.28125 0.21875 
+0.15625 0.3125 0.21875 
+0.15625 0.34375 0.1875 
+0.1875 0.40625 0.21875 
+0.03125 0.34375 0.3125 
+0.03125 0.46875 0.3125 
+0.03125 0.4375 0.34375 
+0.0625 0.40625 0.34375 
+0.03125 0.46875 0.4375 
+0.0625 0.46875 0.40625 
+0.09375 0.4375 0.40625 
+0.15625 0.46875 0.4375 
+0.0625 0.34375 0.28125 
+0.0625 0.46875 0.28125 
+0.09375 0.4375 0.28125 
+0.09375 0.40625 0.3125 
+0.1875 0.46875 0.28125 
+0.15625 0.46875 0.3125 
+0.15625 0.4375 0.34375 
+0.1875 0.46875 0.40625 
+0.09375 0.3125 0.28125 
+0.21875 0.3125 0.28125 
+0.1875 0.34375 0.28125 
+0.15625 0.34375 0.3125 
+0.21875 0.4375 0.28125 
+0.0625 0.03125 0.09375 
+0.0625 0.03125 0.21875 
+0.09375 0.03125 0.1875 
+0.09375 0.0625 0.15625 
+0.1875 0.03125 0.21875 
+0.15625 0.0625 0.21875 
+0.15625 0.09375 0.1875 
+0.1875 0.15625 0.21875 
+0.0625 0.03125 0.34375 
+0.0625 0.03125 0.46875 
+0.09375 0.03125 0.4375 
+0.09375 0.0625 0.40625 
+0.1875 0.03125 0.46875 
+0.15625 0.0625 0.46875 
+0.15625 0.09375 0.4375 
+0.1875 0.15625 0.46875 
+0.09375 0.03125 0.3125 
+0.21875 0.03125 0.3125 
+0.1875 0.03125 0.34375 
+0.15625 0.0625 0.34375 
+0.21875 0.03125 0.4375 
+0.21875 0.0625 0.40625 
+0.1875 0.09375 0.40625 
+0.21875 0.15625 0.4375 
+0.09375 0.0625 0.28125 
+0.21875 0.0625 0.28125 
+0.1875 0.09375 0.28125 
+0.15625 0.09375 0.3125 
+0.21875 0.1875 0.28125 
+0.21875 0.15625 0.3125 
+0.1875 0.15625 0.34375 
+0.21875 0.1875 0.40625 
+0.3125 0.03125 0.34375 
+0.3125 0.03125 0.46875 
+0.34375 0.03125 0.4375 
+0.34375 0.0625 0.40625 
+0.4375 0.03125 0.46875 
+0.40625 0.0625 0.46875 
+0.40625 0.09375 0.4375 
+0.4375 0.15625 0.46875 
+0.28125 0.0625 0.34375 
+0.28125 0.0625 0.46875 
+0.28125 0.09375 0.4375 
+0.3125 0.09375 0.40625 
+0.28125 0.1875 0.46875 
+0.3125 0.15625 0.46875 
+0.34375 0.15625 0.4375 
+0.40625 0.1875 0.46875 
+0.28125 0.09375 0.3125 
+0.28125 0.21875 0.3125 
+0.28125 0.1875 0.34375 
+0.3125 0.15625 0.34375 
+0.28125 0.21875 0.4375 
+0.03125 0.0625 0.09375 
+0.03125 0.0625 0.21875 
+0.03125 0.09375 0.1875 
+0.0625 0.09375 0.15625 
+0.03125 0.1875 0.21875 
+0.0625 0.15625 0.21875 
+0.09375 0.15625 0.1875 
+0.15625 0.1875 0.21875 
+0.03125 0.0625 0.34375 
+0.03125 0.0625 0.46875 
+0.03125 0.09375 0.4375 
+0.0625 0.09375 0.40625 
+0.03125 0.1875 0.46875 
+0.0625 0.15625 0.46875 
+0.09375 0.15625 0.4375 
+0.15625 0.1875 0.46875 
+0.03125 0.09375 0.3125 
+0.03125 0.21875 0.3125 
+0.03125 0.1875 0.34375 
+0.0625 0.15625 0.34375 
+0.03125 0.21875 0.4375 
+0.0625 0.21875 0.40625 
+0.09375 0.1875 0.40625 
+0.15625 0.21875 0.4375 
+0.0625 0.09375 0.28125 
+0.0625 0.21875 0.28125 
+0.09375 0.1875 0.28125 
+0.09375 0.15625 0.3125 
+0.1875 0.21875 0.28125 
+0.15625 0.21875 0.3125 
+0.15625 0.1875 0.34375 
+0.1875 0.21875 0.40625 
+0.03125 0.3125 0.34375 
+0.03125 0.3125 0.46875 
+0.03125 0.34375 0.4375 
+0.0625 0.34375 0.40625 
+0.03125 0.4375 0.46875 
+0.0625 0.40625 0.46875 
+0.09375 0.40625 0.4375 
+0.15625 0.4375 0.46875 
+0.0625 0.28125 0.34375 
+0.0625 0.28125 0.46875 
+0.09375 0.28125 0.4375 
+0.09375 0.3125 0.40625 
+0.1875 0.28125 0.46875 
+0.15625 0.3125 0.46875 
+0.15625 0.34375 0.4375 
+0.1875 0.40625 0.46875 
+0.09375 0.28125 0.3125 
+0.21875 0.28125 0.3125 
+0.1875 0.28125 0.34375 
+0.15625 0.3125 0.34375 
+0.21875 0.28125 0.4375 
+0.59375 0.0625 0.03125 
+0.71875 0.0625 0.03125 
+0.6875 0.09375 0.03125 
+0.65625 0.09375 0.0625 
+0.71875 0.1875 0.03125 
+0.71875 0.15625 0.0625 
+0.6875 0.15625 0.09375 
+0.71875 0.1875 0.15625 
+0.84375 0.0625 0.03125 
+0.96875 0.0625 0.03125 
+0.9375 0.09375 0.03125 
+0.90625 0.09375 0.0625 
+0.96875 0.1875 0.03125 
+0.96875 0.15625 0.0625 
+0.9375 0.15625 0.09375 
+0.96875 0.1875 0.15625 
+0.8125 0.09375 0.03125 
+0.8125 0.21875 0.03125 
+0.84375 0.1875 0.03125 
+0.84375 0.15625 0.0625 
+0.9375 0.21875 0.03125 
+0.90625 0.21875 0.0625 
+0.90625 0.1875 0.09375 
+0.9375 0.21875 0.15625 
+0.78125 0.09375 0.0625 
+0.78125 0.21875 0.0625 
+0.78125 0.1875 0.09375 
+0.8125 0.15625 0.09375 
+0.78125 0.21875 0.1875 
+0.8125 0.21875 0.15625 
+0.84375 0.1875 0.15625 
+0.90625 0.21875 0.1875 
+0.84375 0.3125 0.03125 
+0.96875 0.3125 0.03125 
+0.9375 0.34375 0.03125 
+0.90625 0.34375 0.0625 
+0.96875 0.4375 0.03125 
+0.96875 0.40625 0.0625 
+0.9375 0.40625 0.09375 
+0.96875 0.4375 0.15625 
+0.84375 0.28125 0.0625 
+0.96875 0.28125 0.0625 
+0.9375 0.28125 0.09375 
+0.90625 0.3125 0.09375 
+0.96875 0.28125 0.1875 
+0.96875 0.3125 0.15625 
+0.9375 0.34375 0.15625 
+0.96875 0.40625 0.1875 
+0.8125 0.28125 0.09375 
+0.8125 0.28125 0.21875 
+0.84375 0.28125 0.1875 
+0.84375 0.3125 0.15625 
+0.9375 0.28125 0.21875 
+0.90625 0.3125 0.21875 
+0.90625 0.34375 0.1875 
+0.9375 0.40625 0.21875 
+0.84375 0.3125 0.28125 
+0.96875 0.3125 0.28125 
+0.9375 0.34375 0.28125 
+0.90625 0.34375 0.3125 
+0.96875 0.4375 0.28125 
+0.96875 0.40625 0.3125 
+0.9375 0.40625 0.34375 
+0.96875 0.4375 0.40625 
+0.59375 0.03125 0.0625 
+0.71875 0.03125 0.0625 
+0.6875 0.03125 0.09375 
+0.65625 0.0625 0.09375 
+0.71875 0.03125 0.1875 
+0.71875 0.0625 0.15625 
+0.6875 0.09375 0.15625 
+0.71875 0.15625 0.1875 
+0.84375 0.03125 0.0625 
+0.96875 0.03125 0.0625 
+0.9375 0.03125 0.09375 
+0.90625 0.0625 0.09375 
+0.96875 0.03125 0.1875 
+0.96875 0.0625 0.15625 
+0.9375 0.09375 0.15625 
+0.96875 0.15625 0.1875 
+0.8125 0.03125 0.09375 
+0.8125 0.03125 0.21875 
+0.84375 0.03125 0.1875 
+0.84375 0.0625 0.15625 
+0.9375 0.03125 0.21875 
+0.90625 0.0625 0.21875 
+0.90625 0.09375 0.1875 
+0.9375 0.15625 0.21875 
+0.78125 0.0625 0.09375 
+0.78125 0.0625 0.21875 
+0.78125 0.09375 0.1875 
+0.8125 0.09375 0.15625 
+0.78125 0.1875 0.21875 
+0.8125 0.15625 0.21875 
+0.84375 0.15625 0.1875 
+0.90625 0.1875 0.21875 
+0.84375 0.03125 0.3125 
+0.96875 0.03125 0.3125 
+0.9375 0.03125 0.34375 
+0.90625 0.0625 0.34375 
+0.96875 0.03125 0.4375 
+0.96875 0.0625 0.40625 
+0.9375 0.09375 0.40625 
+0.96875 0.15625 0.4375 
+0.84375 0.0625 0.28125 
+0.96875 0.0625 0.28125 
+0.9375 0.09375 0.28125 
+0.90625 0.09375 0.3125 
+0.96875 0.1875 0.28125 
+0.96875 0.15625 0.3125 
+0.9375 0.15625 0.34375 
+0.96875 0.1875 0.40625 
+0.8125 0.09375 0.28125 
+0.8125 0.21875 0.28125 
+0.84375 0.1875 0.28125 
+0.84375 0.15625 0.3125 
+0.9375 0.21875 0.28125 
+0.90625 0.21875 0.3125 
+0.90625 0.1875 0.34375 
+0.9375 0.21875 0.40625 
+0.84375 0.28125 0.3125 
+0.96875 0.28125 0.3125 
+0.9375 0.28125 0.34375 
+0.90625 0.3125 0.34375 
+0.96875 0.28125 0.4375 
+0.96875 0.3125 0.40625 
+0.9375 0.34375 0.40625 
+0.96875 0.40625 0.4375 
+0.5625 0.09375 0.03125 
+0.5625 0.21875 0.03125 
+0.59375 0.1875 0.03125 
+0.59375 0.15625 0.0625 
+0.6875 0.21875 0.03125 
+0.65625 0.21875 0.0625 
+0.65625 0.1875 0.09375 
+0.6875 0.21875 0.15625 
+0.5625 0.34375 0.03125 
+0.5625 0.46875 0.03125 
+0.59375 0.4375 0.03125 
+0.59375 0.40625 0.0625 
+0.6875 0.46875 0.03125 
+0.65625 0.46875 0.0625 
+0.65625 0.4375 0.09375 
+0.6875 0.46875 0.15625 
+0.59375 0.3125 0.03125 
+0.71875 0.3125 0.03125 
+0.6875 0.34375 0.03125 
+0.65625 0.34375 0.0625 
+0.71875 0.4375 0.03125 
+0.71875 0.40625 0.0625 
+0.6875 0.40625 0.09375 
+0.71875 0.4375 0.15625 
+0.59375 0.28125 0.0625 
+0.71875 0.28125 0.0625 
+0.6875 0.28125 0.09375 
+0.65625 0.3125 0.09375 
+0.71875 0.28125 0.1875 
+0.71875 0.3125 0.15625 
+0.6875 0.34375 0.15625 
+0.71875 0.40625 0.1875 
+0.8125 0.34375 0.03125 
+0.8125 0.46875 0.03125 
+0.84375 0.4375 0.03125 
+0.84375 0.40625 0.0625 
+0.9375 0.46875 0.03125 
+0.90625 0.46875 0.0625 
+0.90625 0.4375 0.09375 
+0.9375 0.46875 0.15625 
+0.78125 0.34375 0.0625 
+0.78125 0.46875 0.0625 
+0.78125 0.4375 0.09375 
+0.8125 0.40625 0.09375 
+0.78125 0.46875 0.1875 
+0.8125 0.46875 0.15625 
+0.84375 0.4375 0.15625 
+0.90625 0.46875 0.1875 
+0.78125 0.3125 0.09375 
+0.78125 0.3125 0.21875 
+0.78125 0.34375 0.1875 
+0.8125 0.34375 0.15625 
+0.78125 0.4375 0.21875 
+0.8125 0.40625 0.21875 
+0.84375 0.40625 0.1875 
+0.90625 0.4375 0.21875 
+0.8125 0.34375 0.28125 
+0.8125 0.46875 0.28125 
+0.84375 0.4375 0.28125 
+0.84375 0.40625 0.3125 
+0.9375 0.46875 0.28125 
+0.90625 0.46875 0.3125 
+0.90625 0.4375 0.34375 
+0.9375 0.46875 0.40625 
+0.53125 0.09375 0.0625 
+0.53125 0.21875 0.0625 
+0.53125 0.1875 0.09375 
+0.5625 0.15625 0.09375 
+0.53125 0.21875 0.1875 
+0.5625 0.21875 0.15625 
+0.59375 0.1875 0.15625 
+0.65625 0.21875 0.1875 
+0.53125 0.34375 0.0625 
+0.53125 0.46875 0.0625 
+0.53125 0.4375 0.09375 
+0.5625 0.40625 0.09375 
+0.53125 0.46875 0.1875 
+0.5625 0.46875 0.15625 
+0.59375 0.4375 0.15625 
+0.65625 0.46875 0.1875 
+0.53125 0.3125 0.09375 
+0.53125 0.3125 0.21875 
+0.53125 0.34375 0.1875 
+0.5625 0.34375 0.15625 
+0.53125 0.4375 0.21875 
+0.5625 0.40625 0.21875 
+0.59375 0.40625 0.1875 
+0.65625 0.4375 0.21875 
+0.5625 0.28125 0.09375 
+0.5625 0.28125 0.21875 
+0.59375 0.28125 0.1875 
+0.59375 0.3125 0.15625 
+0.6875 0.28125 0.21875 
+0.65625 0.3125 0.21875 
+0.65625 0.34375 0.1875 
+0.6875 0.40625 0.21875 
+0.5625 0.34375 0.28125 
+0.6875 0.46875 0.28125 
+0.65625 0.46875 0.3125 
+0.59375 0.3125 0.28125 
+0.71875 0.3125 0.28125 
+0.6875 0.34375 0.28125 
+0.65625 0.34375 0.3125 
+0.71875 0.4375 0.28125 
+0.71875 0.40625 0.3125 
+0.6875 0.40625 0.34375 
+0.71875 0.4375 0.40625 
+0.78125 0.34375 0.3125 
+0.78125 0.46875 0.3125 
+0.78125 0.4375 0.34375 
+0.8125 0.40625 0.34375 
+0.78125 0.46875 0.4375 
+0.8125 0.46875 0.40625 
+0.84375 0.4375 0.40625 
+0.90625 0.46875 0.4375 
+0.5625 0.03125 0.09375 
+0.5625 0.03125 0.21875 
+0.59375 0.03125 0.1875 
+0.59375 0.0625 0.15625 
+0.6875 0.03125 0.21875 
+0.65625 0.0625 0.21875 
+0.65625 0.09375 0.1875 
+0.6875 0.15625 0.21875 
+0.5625 0.03125 0.34375 
+0.5625 0.03125 0.46875 
+0.59375 0.03125 0.4375 
+0.59375 0.0625 0.40625 
+0.6875 0.03125 0.46875 
+0.65625 0.0625 0.46875 
+0.65625 0.09375 0.4375 
+0.6875 0.15625 0.46875 
+0.59375 0.03125 0.3125 
+0.71875 0.03125 0.3125 
+0.6875 0.03125 0.34375 
+0.65625 0.0625 0.34375 
+0.71875 0.03125 0.4375 
+0.71875 0.0625 0.40625 
+0.6875 0.09375 0.40625 
+0.71875 0.15625 0.4375 
+0.59375 0.0625 0.28125 
+0.71875 0.0625 0.28125 
+0.6875 0.09375 0.28125 
+0.65625 0.09375 0.3125 
+0.71875 0.1875 0.28125 
+0.71875 0.15625 0.3125 
+0.6875 0.15625 0.34375 
+0.71875 0.1875 0.40625 
+0.8125 0.03125 0.34375 
+0.8125 0.03125 0.46875 
+0.84375 0.03125 0.4375 
+0.84375 0.0625 0.40625 
+0.9375 0.03125 0.46875 
+0.90625 0.0625 0.46875 
+0.90625 0.09375 0.4375 
+0.9375 0.15625 0.46875 
+0.78125 0.0625 0.34375 
+0.78125 0.0625 0.46875 
+0.78125 0.09375 0.4375 
+0.8125 0.09375 0.40625 
+0.78125 0.1875 0.46875 
+0.8125 0.15625 0.46875 
+0.84375 0.15625 0.4375 
+0.90625 0.1875 0.46875 
+0.78125 0.09375 0.3125 
+0.78125 0.21875 0.3125 
+0.78125 0.1875 0.34375 
+0.8125 0.15625 0.34375 
+0.78125 0.21875 0.4375 
+0.8125 0.21875 0.40625 
+0.84375 0.1875 0.40625 
+0.90625 0.21875 0.4375 
+0.8125 0.28125 0.34375 
+0.8125 0.28125 0.46875 
+0.84375 0.28125 0.4375 
+0.84375 0.3125 0.40625 
+0.9375 0.28125 0.46875 
+0.90625 0.3125 0.46875 
+0.90625 0.34375 0.4375 
+0.9375 0.40625 0.46875 
+0.53125 0.0625 0.09375 
+0.53125 0.0625 0.21875 
+0.53125 0.09375 0.1875 
+0.5625 0.09375 0.15625 
+0.53125 0.1875 0.21875 
+0.5625 0.15625 0.21875 
+0.59375 0.15625 0.1875 
+0.65625 0.1875 0.21875 
+0.53125 0.0625 0.34375 
+0.53125 0.0625 0.46875 
+0.53125 0.09375 0.4375 
+0.5625 0.09375 0.40625 
+0.53125 0.1875 0.46875 
+0.5625 0.15625 0.46875 
+0.59375 0.15625 0.4375 
+0.65625 0.1875 0.46875 
+0.53125 0.09375 0.3125 
+0.53125 0.21875 0.3125 
+0.53125 0.1875 0.34375 
+0.5625 0.15625 0.34375 
+0.53125 0.21875 0.4375 
+0.5625 0.21875 0.40625 
+0.59375 0.1875 0.40625 
+0.65625 0.21875 0.4375 
+0.5625 0.09375 0.28125 
+0.5625 0.21875 0.28125 
+0.59375 0.1875 0.28125 
+0.59375 0.15625 0.3125 
+0.6875 0.21875 0.28125 
+0.65625 0.21875 0.3125 
+0.65625 0.1875 0.34375 
+0.6875 0.21875 0.40625 
+0.5625 0.28125 0.34375 
+0.6875 0.28125 0.46875 
+0.65625 0.3125 0.46875 
+0.59375 0.28125 0.3125 
+0.71875 0.28125 0.3125 
+0.6875 0.28125 0.34375 
+0.65625 0.3125 0.34375 
+0.71875 0.28125 0.4375 
+0.71875 0.3125 0.40625 
+0.6875 0.34375 0.40625 
+0.71875 0.40625 0.4375 
+0.78125 0.3125 0.34375 
+0.78125 0.3125 0.46875 
+0.78125 0.34375 0.4375 
+0.8125 0.34375 0.40625 
+0.78125 0.4375 0.46875 
+0.8125 0.40625 0.46875 
+0.84375 0.40625 0.4375 
+0.90625 0.4375 0.46875 
+0.09375 0.5625 0.03125 
+0.21875 0.5625 0.03125 
+0.1875 0.59375 0.03125 
+0.15625 0.59375 0.0625 
+0.21875 0.6875 0.03125 
+0.21875 0.65625 0.0625 
+0.1875 0.65625 0.09375 
+0.21875 0.6875 0.15625 
+0.34375 0.5625 0.03125 
+0.46875 0.5625 0.03125 
+0.4375 0.59375 0.03125 
+0.40625 0.59375 0.0625 
+0.46875 0.6875 0.03125 
+0.46875 0.65625 0.0625 
+0.4375 0.65625 0.09375 
+0.46875 0.6875 0.15625 
+0.3125 0.59375 0.03125 
+0.3125 0.71875 0.03125 
+0.34375 0.6875 0.03125 
+0.34375 0.65625 0.0625 
+0.4375 0.71875 0.03125 
+0.40625 0.71875 0.0625 
+0.40625 0.6875 0.09375 
+0.4375 0.71875 0.15625 
+0.28125 0.59375 0.0625 
+0.28125 0.71875 0.0625 
+0.28125 0.6875 0.09375 
+0.3125 0.65625 0.09375 
+0.28125 0.71875 0.1875 
+0.3125 0.71875 0.15625 
+0.34375 0.6875 0.15625 
+0.40625 0.71875 0.1875 
+0.34375 0.8125 0.03125 
+0.46875 0.8125 0.03125 
+0.4375 0.84375 0.03125 
+0.40625 0.84375 0.0625 
+0.46875 0.9375 0.03125 
+0.46875 0.90625 0.0625 
+0.4375 0.90625 0.09375 
+0.46875 0.9375 0.15625 
+0.34375 0.78125 0.0625 
+0.46875 0.78125 0.0625 
+0.4375 0.78125 0.09375 
+0.40625 0.8125 0.09375 
+0.46875 0.78125 0.1875 
+0.46875 0.8125 0.15625 
+0.4375 0.84375 0.15625 
+0.46875 0.90625 0.1875 
+0.3125 0.78125 0.09375 
+0.3125 0.78125 0.21875 
+0.34375 0.78125 0.1875 
+0.34375 0.8125 0.15625 
+0.4375 0.78125 0.21875 
+0.40625 0.8125 0.21875 
+0.40625 0.84375 0.1875 
+0.4375 0.90625 0.21875 
+0.34375 0.8125 0.28125 
+0.46875 0.8125 0.28125 
+0.4375 0.84375 0.28125 
+0.40625 0.84375 0.3125 
+0.46875 0.9375 0.28125 
+0.46875 0.90625 0.3125 
+0.4375 0.90625 0.34375 
+0.46875 0.9375 0.40625 
+0.09375 0.53125 0.0625 
+0.21875 0.53125 0.0625 
+0.1875 0.53125 0.09375 
+0.15625 0.5625 0.09375 
+0.21875 0.53125 0.1875 
+0.21875 0.5625 0.15625 
+0.1875 0.59375 0.15625 
+0.21875 0.65625 0.1875 
+0.34375 0.53125 0.0625 
+0.46875 0.53125 0.0625 
+0.4375 0.53125 0.09375 
+0.40625 0.5625 0.09375 
+0.46875 0.53125 0.1875 
+0.46875 0.5625 0.15625 
+0.4375 0.59375 0.15625 
+0.46875 0.65625 0.1875 
+0.3125 0.53125 0.09375 
+0.3125 0.53125 0.21875 
+0.34375 0.53125 0.1875 
+0.34375 0.5625 0.15625 
+0.4375 0.53125 0.21875 
+0.40625 0.5625 0.21875 
+0.40625 0.59375 0.1875 
+0.4375 0.65625 0.21875 
+0.28125 0.5625 0.09375 
+0.28125 0.5625 0.21875 
+0.28125 0.59375 0.1875 
+0.3125 0.59375 0.15625 
+0.28125 0.6875 0.21875 
+0.3125 0.65625 0.21875 
+0.34375 0.65625 0.1875 
+0.40625 0.6875 0.21875 
+0.34375 0.5625 0.28125 
+0.46875 0.6875 0.28125 
+0.46875 0.65625 0.3125 
+0.3125 0.59375 0.28125 
+0.3125 0.71875 0.28125 
+0.34375 0.6875 0.28125 
+0.34375 0.65625 0.3125 
+0.4375 0.71875 0.28125 
+0.40625 0.71875 0.3125 
+0.40625 0.6875 0.34375 
+0.4375 0.71875 0.40625 
+0.34375 0.78125 0.3125 
+0.46875 0.78125 0.3125 
+0.4375 0.78125 0.34375 
+0.40625 0.8125 0.34375 
+0.46875 0.78125 0.4375 
+0.46875 0.8125 0.40625 
+0.4375 0.84375 0.40625 
+0.46875 0.90625 0.4375 
+0.0625 0.59375 0.03125 
+0.0625 0.71875 0.03125 
+0.09375 0.6875 0.03125 
+0.09375 0.65625 0.0625 
+0.1875 0.71875 0.03125 
+0.15625 0.71875 0.0625 
+0.15625 0.6875 0.09375 
+0.1875 0.71875 0.15625 
+0.0625 0.84375 0.03125 
+0.0625 0.96875 0.03125 
+0.09375 0.9375 0.03125 
+0.09375 0.90625 0.0625 
+0.1875 0.96875 0.03125 
+0.15625 0.96875 0.0625 
+0.15625 0.9375 0.09375 
+0.1875 0.96875 0.15625 
+0.09375 0.8125 0.03125 
+0.21875 0.8125 0.03125 
+0.1875 0.84375 0.03125 
+0.15625 0.84375 0.0625 
+0.21875 0.9375 0.03125 
+0.21875 0.90625 0.0625 
+0.1875 0.90625 0.09375 
+0.21875 0.9375 0.15625 
+0.09375 0.78125 0.0625 
+0.21875 0.78125 0.0625 
+0.1875 0.78125 0.09375 
+0.15625 0.8125 0.09375 
+0.21875 0.78125 0.1875 
+0.21875 0.8125 0.15625 
+0.1875 0.84375 0.15625 
+0.21875 0.90625 0.1875 
+0.3125 0.84375 0.03125 
+0.3125 0.96875 0.03125 
+0.34375 0.9375 0.03125 
+0.34375 0.90625 0.0625 
+0.4375 0.96875 0.03125 
+0.40625 0.96875 0.0625 
+0.40625 0.9375 0.09375 
+0.4375 0.96875 0.15625 
+0.28125 0.84375 0.0625 
+0.28125 0.96875 0.0625 
+0.28125 0.9375 0.09375 
+0.3125 0.90625 0.09375 
+0.28125 0.96875 0.1875 
+0.3125 0.96875 0.15625 
+0.34375 0.9375 0.15625 
+0.40625 0.96875 0.1875 
+0.28125 0.8125 0.09375 
+0.28125 0.8125 0.21875 
+0.28125 0.84375 0.1875 
+0.3125 0.84375 0.15625 
+0.28125 0.9375 0.21875 
+0.3125 0.90625 0.21875 
+0.34375 0.90625 0.1875 
+0.40625 0.9375 0.21875 
+0.3125 0.84375 0.28125 
+0.3125 0.96875 0.28125 
+0.34375 0.9375 0.28125 
+0.34375 0.90625 0.3125 
+0.4375 0.96875 0.28125 
+0.40625 0.96875 0.3125 
+0.40625 0.9375 0.34375 
+0.4375 0.96875 0.40625 
+0.03125 0.59375 0.0625 
+0.03125 0.71875 0.0625 
+0.03125 0.6875 0.09375 
+0.0625 0.65625 0.09375 
+0.03125 0.71875 0.1875 
+0.0625 0.71875 0.15625 
+0.09375 0.6875 0.15625 
+0.15625 0.71875 0.1875 
+0.03125 0.84375 0.0625 
+0.03125 0.96875 0.0625 
+0.03125 0.9375 0.09375 
+0.0625 0.90625 0.09375 
+0.03125 0.96875 0.1875 
+0.0625 0.96875 0.15625 
+0.09375 0.9375 0.15625 
+0.15625 0.96875 0.1875 
+0.03125 0.8125 0.09375 
+0.03125 0.8125 0.21875 
+0.03125 0.84375 0.1875 
+0.0625 0.84375 0.15625 
+0.03125 0.9375 0.21875 
+0.0625 0.90625 0.21875 
+0.09375 0.90625 0.1875 
+0.15625 0.9375 0.21875 
+0.0625 0.78125 0.09375 
+0.0625 0.78125 0.21875 
+0.09375 0.78125 0.1875 
+0.09375 0.8125 0.15625 
+0.1875 0.78125 0.21875 
+0.15625 0.8125 0.21875 
+0.15625 0.84375 0.1875 
+0.1875 0.90625 0.21875 
+0.03125 0.84375 0.3125 
+0.03125 0.96875 0.3125 
+0.03125 0.9375 0.34375 
+0.0625 0.90625 0.34375 
+0.03125 0.96875 0.4375 
+0.0625 0.96875 0.40625 
+0.09375 0.9375 0.40625 
+0.15625 0.96875 0.4375 
+0.0625 0.84375 0.28125 
+0.0625 0.96875 0.28125 
+0.09375 0.9375 0.28125 
+0.09375 0.90625 0.3125 
+0.1875 0.96875 0.28125 
+0.15625 0.96875 0.3125 
+0.15625 0.9375 0.34375 
+0.1875 0.96875 0.40625 
+0.09375 0.8125 0.28125 
+0.21875 0.8125 0.28125 
+0.1875 0.84375 0.28125 
+0.15625 0.84375 0.3125 
+0.21875 0.9375 0.28125 
+0.21875 0.90625 0.3125 
+0.1875 0.90625 0.34375 
+0.21875 0.9375 0.40625 
+0.28125 0.84375 0.3125 
+0.28125 0.96875 0.3125 
+0.28125 0.9375 0.34375 
+0.3125 0.90625 0.34375 
+0.28125 0.96875 0.4375 
+0.3125 0.96875 0.40625 
+0.34375 0.9375 0.40625 
+0.40625 0.96875 0.4375 
+0.0625 0.53125 0.09375 
+0.0625 0.53125 0.21875 
+0.09375 0.53125 0.1875 
+0.09375 0.5625 0.15625 
+0.1875 0.53125 0.21875 
+0.15625 0.5625 0.21875 
+0.15625 0.59375 0.1875 
+0.1875 0.65625 0.21875 
+0.0625 0.53125 0.34375 
+0.0625 0.53125 0.46875 
+0.09375 0.53125 0.4375 
+0.09375 0.5625 0.40625 
+0.1875 0.53125 0.46875 
+0.15625 0.5625 0.46875 
+0.15625 0.59375 0.4375 
+0.1875 0.65625 0.46875 
+0.09375 0.53125 0.3125 
+0.21875 0.53125 0.3125 
+0.1875 0.53125 0.34375 
+0.15625 0.5625 0.34375 
+0.21875 0.53125 0.4375 
+0.21875 0.5625 0.40625 
+0.1875 0.59375 0.40625 
+0.21875 0.65625 0.4375 
+0.09375 0.5625 0.28125 
+0.21875 0.5625 0.28125 
+0.1875 0.59375 0.28125 
+0.15625 0.59375 0.3125 
+0.21875 0.6875 0.28125 
+0.21875 0.65625 0.3125 
+0.1875 0.65625 0.34375 
+0.21875 0.6875 0.40625 
+0.28125 0.5625 0.34375 
+0.28125 0.6875 0.46875 
+0.3125 0.65625 0.46875 
+0.28125 0.59375 0.3125 
+0.28125 0.71875 0.3125 
+0.28125 0.6875 0.34375 
+0.3125 0.65625 0.34375 
+0.28125 0.71875 0.4375 
+0.3125 0.71875 0.40625 
+0.34375 0.6875 0.40625 
+0.40625 0.71875 0.4375 
+0.3125 0.78125 0.34375 
+0.3125 0.78125 0.46875 
+0.34375 0.78125 0.4375 
+0.34375 0.8125 0.40625 
+0.4375 0.78125 0.46875 
+0.40625 0.8125 0.46875 
+0.40625 0.84375 0.4375 
+0.4375 0.90625 0.46875 
+0.03125 0.5625 0.09375 
+0.03125 0.5625 0.21875 
+0.03125 0.59375 0.1875 
+0.0625 0.59375 0.15625 
+0.03125 0.6875 0.21875 
+0.0625 0.65625 0.21875 
+0.09375 0.65625 0.1875 
+0.15625 0.6875 0.21875 
+0.03125 0.5625 0.34375 
+0.03125 0.5625 0.46875 
+0.03125 0.59375 0.4375 
+0.0625 0.59375 0.40625 
+0.03125 0.6875 0.46875 
+0.0625 0.65625 0.46875 
+0.09375 0.65625 0.4375 
+0.15625 0.6875 0.46875 
+0.03125 0.59375 0.3125 
+0.03125 0.71875 0.3125 
+0.03125 0.6875 0.34375 
+0.0625 0.65625 0.34375 
+0.03125 0.71875 0.4375 
+0.0625 0.71875 0.40625 
+0.09375 0.6875 0.40625 
+0.15625 0.71875 0.4375 
+0.0625 0.59375 0.28125 
+0.0625 0.71875 0.28125 
+0.09375 0.6875 0.28125 
+0.09375 0.65625 0.3125 
+0.1875 0.71875 0.28125 
+0.15625 0.71875 0.3125 
+0.15625 0.6875 0.34375 
+0.1875 0.71875 0.40625 
+0.03125 0.8125 0.34375 
+0.03125 0.8125 0.46875 
+0.03125 0.84375 0.4375 
+0.0625 0.84375 0.40625 
+0.03125 0.9375 0.46875 
+0.0625 0.90625 0.46875 
+0.09375 0.90625 0.4375 
+0.15625 0.9375 0.46875 
+0.0625 0.78125 0.34375 
+0.0625 0.78125 0.46875 
+0.09375 0.78125 0.4375 
+0.09375 0.8125 0.40625 
+0.1875 0.78125 0.46875 
+0.15625 0.8125 0.46875 
+0.15625 0.84375 0.4375 
+0.1875 0.90625 0.46875 
+0.09375 0.78125 0.3125 
+0.21875 0.78125 0.3125 
+0.1875 0.78125 0.34375 
+0.15625 0.8125 0.34375 
+0.21875 0.78125 0.4375 
+0.21875 0.8125 0.40625 
+0.1875 0.84375 0.40625 
+0.21875 0.90625 0.4375 
+0.28125 0.8125 0.34375 
+0.28125 0.8125 0.46875 
+0.28125 0.84375 0.4375 
+0.3125 0.84375 0.40625 
+0.28125 0.9375 0.46875 
+0.3125 0.90625 0.46875 
+0.34375 0.90625 0.4375 
+0.40625 0.9375 0.46875 
+0.59375 0.5625 0.03125 
+0.71875 0.5625 0.03125 
+0.6875 0.59375 0.03125 
+0.65625 0.59375 0.0625 
+0.71875 0.6875 0.03125 
+0.71875 0.65625 0.0625 
+0.6875 0.65625 0.09375 
+0.71875 0.6875 0.15625 
+0.84375 0.5625 0.03125 
+0.96875 0.5625 0.03125 
+0.9375 0.59375 0.03125 
+0.90625 0.59375 0.0625 
+0.96875 0.6875 0.03125 
+0.96875 0.65625 0.0625 
+0.9375 0.65625 0.09375 
+0.96875 0.6875 0.15625 
+0.8125 0.59375 0.03125 
+0.8125 0.71875 0.03125 
+0.84375 0.6875 0.03125 
+0.84375 0.65625 0.0625 
+0.9375 0.71875 0.03125 
+0.90625 0.71875 0.0625 
+0.90625 0.6875 0.09375 
+0.9375 0.71875 0.15625 
+0.78125 0.59375 0.0625 
+0.78125 0.71875 0.0625 
+0.78125 0.6875 0.09375 
+0.8125 0.65625 0.09375 
+0.78125 0.71875 0.1875 
+0.8125 0.71875 0.15625 
+0.84375 0.6875 0.15625 
+0.90625 0.71875 0.1875 
+0.84375 0.8125 0.03125 
+0.96875 0.8125 0.03125 
+0.9375 0.84375 0.03125 
+0.90625 0.84375 0.0625 
+0.96875 0.9375 0.03125 
+0.96875 0.90625 0.0625 
+0.9375 0.90625 0.09375 
+0.96875 0.9375 0.15625 
+0.84375 0.78125 0.0625 
+0.96875 0.78125 0.0625 
+0.9375 0.78125 0.09375 
+0.90625 0.8125 0.09375 
+0.96875 0.78125 0.1875 
+0.96875 0.8125 0.15625 
+0.9375 0.84375 0.15625 
+0.96875 0.90625 0.1875 
+0.8125 0.78125 0.09375 
+0.8125 0.78125 0.21875 
+0.84375 0.78125 0.1875 
+0.84375 0.8125 0.15625 
+0.9375 0.78125 0.21875 
+0.90625 0.8125 0.21875 
+0.90625 0.84375 0.1875 
+0.9375 0.90625 0.21875 
+0.84375 0.8125 0.28125 
+0.96875 0.8125 0.28125 
+0.9375 0.84375 0.28125 
+0.90625 0.84375 0.3125 
+0.96875 0.9375 0.28125 
+0.96875 0.90625 0.3125 
+0.9375 0.90625 0.34375 
+0.96875 0.9375 0.40625 
+0.59375 0.53125 0.0625 
+0.71875 0.53125 0.0625 
+0.6875 0.53125 0.09375 
+0.65625 0.5625 0.09375 
+0.71875 0.53125 0.1875 
+0.71875 0.5625 0.15625 
+0.6875 0.59375 0.15625 
+0.71875 0.65625 0.1875 
+0.84375 0.53125 0.0625 
+0.96875 0.53125 0.0625 
+0.9375 0.53125 0.09375 
+0.90625 0.5625 0.09375 
+0.96875 0.53125 0.1875 
+0.96875 0.5625 0.15625 
+0.9375 0.59375 0.15625 
+0.96875 0.65625 0.1875 
+0.8125 0.53125 0.09375 
+0.8125 0.53125 0.21875 
+0.84375 0.53125 0.1875 
+0.84375 0.5625 0.15625 
+0.9375 0.53125 0.21875 
+0.90625 0.5625 0.21875 
+0.90625 0.59375 0.1875 
+0.9375 0.65625 0.21875 
+0.78125 0.5625 0.09375 
+0.78125 0.5625 0.21875 
+0.78125 0.59375 0.1875 
+0.8125 0.59375 0.15625 
+0.78125 0.6875 0.21875 
+0.8125 0.65625 0.21875 
+0.84375 0.65625 0.1875 
+0.90625 0.6875 0.21875 
+0.84375 0.53125 0.3125 
+0.96875 0.53125 0.3125 
+0.9375 0.53125 0.34375 
+0.90625 0.5625 0.34375 
+0.96875 0.53125 0.4375 
+0.96875 0.5625 0.40625 
+0.9375 0.59375 0.40625 
+0.96875 0.65625 0.4375 
+0.84375 0.5625 0.28125 
+0.96875 0.5625 0.28125 
+0.9375 0.59375 0.28125 
+0.90625 0.59375 0.3125 
+0.96875 0.6875 0.28125 
+0.96875 0.65625 0.3125 
+0.9375 0.65625 0.34375 
+0.96875 0.6875 0.40625 
+0.8125 0.59375 0.28125 
+0.8125 0.71875 0.28125 
+0.84375 0.6875 0.28125 
+0.84375 0.65625 0.3125 
+0.9375 0.71875 0.28125 
+0.90625 0.71875 0.3125 
+0.90625 0.6875 0.34375 
+0.9375 0.71875 0.40625 
+0.84375 0.78125 0.3125 
+0.96875 0.78125 0.3125 
+0.9375 0.78125 0.34375 
+0.90625 0.8125 0.34375 
+0.96875 0.78125 0.4375 
+0.96875 0.8125 0.40625 
+0.9375 0.84375 0.40625 
+0.96875 0.90625 0.4375 
+0.5625 0.59375 0.03125 
+0.5625 0.71875 0.03125 
+0.59375 0.6875 0.03125 
+0.59375 0.65625 0.0625 
+0.6875 0.71875 0.03125 
+0.65625 0.71875 0.0625 
+0.65625 0.6875 0.09375 
+0.6875 0.71875 0.15625 
+0.5625 0.84375 0.03125 
+0.5625 0.96875 0.03125 
+0.59375 0.9375 0.03125 
+0.59375 0.90625 0.0625 
+0.6875 0.96875 0.03125 
+0.65625 0.96875 0.0625 
+0.65625 0.9375 0.09375 
+0.6875 0.96875 0.15625 
+0.59375 0.8125 0.03125 
+0.71875 0.8125 0.03125 
+0.6875 0.84375 0.03125 
+0.65625 0.84375 0.0625 
+0.71875 0.9375 0.03125 
+0.71875 0.90625 0.0625 
+0.6875 0.90625 0.09375 
+0.71875 0.9375 0.15625 
+0.59375 0.78125 0.0625 
+0.71875 0.78125 0.0625 
+0.6875 0.78125 0.09375 
+0.65625 0.8125 0.09375 
+0.71875 0.78125 0.1875 
+0.71875 0.8125 0.15625 
+0.6875 0.84375 0.15625 
+0.71875 0.90625 0.1875 
+0.8125 0.84375 0.03125 
+0.8125 0.96875 0.03125 
+0.84375 0.9375 0.03125 
+0.84375 0.90625 0.0625 
+0.9375 0.96875 0.03125 
+0.90625 0.96875 0.0625 
+0.90625 0.9375 0.09375 
+0.9375 0.96875 0.15625 
+0.78125 0.84375 0.0625 
+0.78125 0.96875 0.0625 
+0.78125 0.9375 0.09375 
+0.8125 0.90625 0.09375 
+0.78125 0.96875 0.1875 
+0.8125 0.96875 0.15625 
+0.84375 0.9375 0.15625 
+0.90625 0.96875 0.1875 
+0.78125 0.8125 0.09375 
+0.78125 0.8125 0.21875 
+0.78125 0.84375 0.1875 
+0.8125 0.84375 0.15625 
+0.78125 0.9375 0.21875 
+0.8125 0.90625 0.21875 
+0.84375 0.90625 0.1875 
+0.90625 0.9375 0.21875 
+0.8125 0.84375 0.28125 
+0.8125 0.96875 0.28125 
+0.84375 0.9375 0.28125 
+0.84375 0.90625 0.3125 
+0.9375 0.96875 0.28125 
+0.90625 0.96875 0.3125 
+0.90625 0.9375 0.34375 
+0.9375 0.96875 0.40625 
+0.53125 0.59375 0.0625 
+0.53125 0.71875 0.0625 
+0.53125 0.6875 0.09375 
+0.5625 0.65625 0.09375 
+0.53125 0.71875 0.1875 
+0.5625 0.71875 0.15625 
+0.59375 0.6875 0.15625 
+0.65625 0.71875 0.1875 
+0.53125 0.84375 0.0625 
+0.53125 0.96875 0.0625 
+0.53125 0.9375 0.09375 
+0.5625 0.90625 0.09375 
+0.53125 0.96875 0.1875 
+0.5625 0.96875 0.15625 
+0.59375 0.9375 0.15625 
+0.65625 0.96875 0.1875 
+0.53125 0.8125 0.09375 
+0.53125 0.8125 0.21875 
+0.53125 0.84375 0.1875 
+0.5625 0.84375 0.15625 
+0.53125 0.9375 0.21875 
+0.5625 0.90625 0.21875 
+0.59375 0.90625 0.1875 
+0.65625 0.9375 0.21875 
+0.5625 0.78125 0.09375 
+0.5625 0.78125 0.21875 
+0.59375 0.78125 0.1875 
+0.59375 0.8125 0.15625 
+0.6875 0.78125 0.21875 
+0.65625 0.8125 0.21875 
+0.65625 0.84375 0.1875 
+0.6875 0.90625 0.21875 
+0.53125 0.84375 0.3125 
+0.53125 0.96875 0.3125 
+0.53125 0.9375 0.34375 
+0.5625 0.90625 0.34375 
+0.53125 0.96875 0.4375 
+0.5625 0.96875 0.40625 
+0.59375 0.9375 0.40625 
+0.65625 0.96875 0.4375 
+0.5625 0.84375 0.28125 
+0.5625 0.96875 0.28125 
+0.59375 0.9375 0.28125 
+0.59375 0.90625 0.3125 
+0.6875 0.96875 0.28125 
+0.65625 0.96875 0.3125 
+0.65625 0.9375 0.34375 
+0.6875 0.96875 0.40625 
+0.59375 0.8125 0.28125 
+0.71875 0.8125 0.28125 
+0.6875 0.84375 0.28125 
+0.65625 0.84375 0.3125 
+0.71875 0.9375 0.28125 
+0.71875 0.90625 0.3125 
+0.6875 0.90625 0.34375 
+0.71875 0.9375 0.40625 
+0.78125 0.84375 0.3125 
+0.78125 0.96875 0.3125 
+0.78125 0.9375 0.34375 
+0.8125 0.90625 0.34375 
+0.78125 0.96875 0.4375 
+0.8125 0.96875 0.40625 
+0.84375 0.9375 0.40625 
+0.90625 0.96875 0.4375 
+0.5625 0.53125 0.09375 
+0.5625 0.53125 0.21875 
+0.59375 0.53125 0.1875 
+0.59375 0.5625 0.15625 
+0.6875 0.53125 0.21875 
+0.65625 0.5625 0.21875 
+0.65625 0.59375 0.1875 
+0.6875 0.65625 0.21875 
+0.71875 0.53125 0.3125 
+0.6875 0.53125 0.34375 
+0.71875 0.65625 0.4375 
+0.59375 0.5625 0.28125 
+0.71875 0.5625 0.28125 
+0.6875 0.59375 0.28125 
+0.65625 0.59375 0.3125 
+0.71875 0.6875 0.28125 
+0.71875 0.65625 0.3125 
+0.6875 0.65625 0.34375 
+0.71875 0.6875 0.40625 
+0.8125 0.53125 0.34375 
+0.8125 0.53125 0.46875 
+0.84375 0.53125 0.4375 
+0.84375 0.5625 0.40625 
+0.9375 0.53125 0.46875 
+0.90625 0.5625 0.46875 
+0.90625 0.59375 0.4375 
+0.9375 0.65625 0.46875 
+0.78125 0.5625 0.34375 
+0.78125 0.5625 0.46875 
+0.78125 0.59375 0.4375 
+0.8125 0.59375 0.40625 
+0.78125 0.6875 0.46875 
+0.8125 0.65625 0.46875 
+0.84375 0.65625 0.4375 
+0.90625 0.6875 0.46875 
+0.78125 0.59375 0.3125 
+0.78125 0.71875 0.3125 
+0.78125 0.6875 0.34375 
+0.8125 0.65625 0.34375 
+0.78125 0.71875 0.4375 
+0.8125 0.71875 0.40625 
+0.84375 0.6875 0.40625 
+0.90625 0.71875 0.4375 
+0.8125 0.78125 0.34375 
+0.8125 0.78125 0.46875 
+0.84375 0.78125 0.4375 
+0.84375 0.8125 0.40625 
+0.9375 0.78125 0.46875 
+0.90625 0.8125 0.46875 
+0.90625 0.84375 0.4375 
+0.9375 0.90625 0.46875 
+0.53125 0.5625 0.09375 
+0.53125 0.5625 0.21875 
+0.53125 0.59375 0.1875 
+0.5625 0.59375 0.15625 
+0.53125 0.6875 0.21875 
+0.5625 0.65625 0.21875 
+0.59375 0.65625 0.1875 
+0.65625 0.6875 0.21875 
+0.53125 0.71875 0.3125 
+0.53125 0.6875 0.34375 
+0.65625 0.71875 0.4375 
+0.5625 0.59375 0.28125 
+0.5625 0.71875 0.28125 
+0.59375 0.6875 0.28125 
+0.59375 0.65625 0.3125 
+0.6875 0.71875 0.28125 
+0.65625 0.71875 0.3125 
+0.65625 0.6875 0.34375 
+0.6875 0.71875 0.40625 
+0.53125 0.8125 0.34375 
+0.53125 0.8125 0.46875 
+0.53125 0.84375 0.4375 
+0.5625 0.84375 0.40625 
+0.53125 0.9375 0.46875 
+0.5625 0.90625 0.46875 
+0.59375 0.90625 0.4375 
+0.65625 0.9375 0.46875 
+0.5625 0.78125 0.34375 
+0.5625 0.78125 0.46875 
+0.59375 0.78125 0.4375 
+0.59375 0.8125 0.40625 
+0.6875 0.78125 0.46875 
+0.65625 0.8125 0.46875 
+0.65625 0.84375 0.4375 
+0.6875 0.90625 0.46875 
+0.59375 0.78125 0.3125 
+0.71875 0.78125 0.3125 
+0.6875 0.78125 0.34375 
+0.65625 0.8125 0.34375 
+0.71875 0.78125 0.4375 
+0.71875 0.8125 0.40625 
+0.6875 0.84375 0.40625 
+0.71875 0.90625 0.4375 
+0.78125 0.8125 0.34375 
+0.78125 0.8125 0.46875 
+0.78125 0.84375 0.4375 
+0.8125 0.84375 0.40625 
+0.78125 0.9375 0.46875 
+0.8125 0.90625 0.46875 
+0.84375 0.90625 0.4375 
+0.90625 0.9375 0.46875 
+0.09375 0.0625 0.53125 
+0.21875 0.0625 0.53125 
+0.1875 0.09375 0.53125 
+0.15625 0.09375 0.5625 
+0.21875 0.1875 0.53125 
+0.21875 0.15625 0.5625 
+0.1875 0.15625 0.59375 
+0.21875 0.1875 0.65625 
+0.34375 0.0625 0.53125 
+0.46875 0.0625 0.53125 
+0.4375 0.09375 0.53125 
+0.40625 0.09375 0.5625 
+0.46875 0.1875 0.53125 
+0.46875 0.15625 0.5625 
+0.4375 0.15625 0.59375 
+0.46875 0.1875 0.65625 
+0.3125 0.09375 0.53125 
+0.3125 0.21875 0.53125 
+0.34375 0.1875 0.53125 
+0.34375 0.15625 0.5625 
+0.4375 0.21875 0.53125 
+0.40625 0.21875 0.5625 
+0.40625 0.1875 0.59375 
+0.4375 0.21875 0.65625 
+0.28125 0.09375 0.5625 
+0.28125 0.21875 0.5625 
+0.28125 0.1875 0.59375 
+0.3125 0.15625 0.59375 
+0.28125 0.21875 0.6875 
+0.3125 0.21875 0.65625 
+0.34375 0.1875 0.65625 
+0.40625 0.21875 0.6875 
+0.34375 0.28125 0.5625 
+0.46875 0.28125 0.6875 
+0.46875 0.3125 0.65625 
+0.3125 0.28125 0.59375 
+0.3125 0.28125 0.71875 
+0.34375 0.28125 0.6875 
+0.34375 0.3125 0.65625 
+0.4375 0.28125 0.71875 
+0.40625 0.3125 0.71875 
+0.40625 0.34375 0.6875 
+0.4375 0.40625 0.71875 
+0.34375 0.3125 0.78125 
+0.46875 0.3125 0.78125 
+0.4375 0.34375 0.78125 
+0.40625 0.34375 0.8125 
+0.46875 0.4375 0.78125 
+0.46875 0.40625 0.8125 
+0.4375 0.40625 0.84375 
+0.46875 0.4375 0.90625 
+0.09375 0.03125 0.5625 
+0.21875 0.03125 0.5625 
+0.1875 0.03125 0.59375 
+0.15625 0.0625 0.59375 
+0.21875 0.03125 0.6875 
+0.21875 0.0625 0.65625 
+0.1875 0.09375 0.65625 
+0.21875 0.15625 0.6875 
+0.34375 0.03125 0.5625 
+0.46875 0.03125 0.5625 
+0.4375 0.03125 0.59375 
+0.40625 0.0625 0.59375 
+0.46875 0.03125 0.6875 
+0.46875 0.0625 0.65625 
+0.4375 0.09375 0.65625 
+0.46875 0.15625 0.6875 
+0.3125 0.03125 0.59375 
+0.3125 0.03125 0.71875 
+0.34375 0.03125 0.6875 
+0.34375 0.0625 0.65625 
+0.4375 0.03125 0.71875 
+0.40625 0.0625 0.71875 
+0.40625 0.09375 0.6875 
+0.4375 0.15625 0.71875 
+0.28125 0.0625 0.59375 
+0.28125 0.0625 0.71875 
+0.28125 0.09375 0.6875 
+0.3125 0.09375 0.65625 
+0.28125 0.1875 0.71875 
+0.3125 0.15625 0.71875 
+0.34375 0.15625 0.6875 
+0.40625 0.1875 0.71875 
+0.34375 0.03125 0.8125 
+0.46875 0.03125 0.8125 
+0.4375 0.03125 0.84375 
+0.40625 0.0625 0.84375 
+0.46875 0.03125 0.9375 
+0.46875 0.0625 0.90625 
+0.4375 0.09375 0.90625 
+0.46875 0.15625 0.9375 
+0.34375 0.0625 0.78125 
+0.46875 0.0625 0.78125 
+0.4375 0.09375 0.78125 
+0.40625 0.09375 0.8125 
+0.46875 0.1875 0.78125 
+0.46875 0.15625 0.8125 
+0.4375 0.15625 0.84375 
+0.46875 0.1875 0.90625 
+0.3125 0.09375 0.78125 
+0.3125 0.21875 0.78125 
+0.34375 0.1875 0.78125 
+0.34375 0.15625 0.8125 
+0.4375 0.21875 0.78125 
+0.40625 0.21875 0.8125 
+0.40625 0.1875 0.84375 
+0.4375 0.21875 0.90625 
+0.34375 0.28125 0.8125 
+0.46875 0.28125 0.8125 
+0.4375 0.28125 0.84375 
+0.40625 0.3125 0.84375 
+0.46875 0.28125 0.9375 
+0.46875 0.3125 0.90625 
+0.4375 0.34375 0.90625 
+0.46875 0.40625 0.9375 
+0.0625 0.09375 0.53125 
+0.0625 0.21875 0.53125 
+0.09375 0.1875 0.53125 
+0.09375 0.15625 0.5625 
+0.1875 0.21875 0.53125 
+0.15625 0.21875 0.5625 
+0.15625 0.1875 0.59375 
+0.1875 0.21875 0.65625 
+0.0625 0.34375 0.53125 
+0.0625 0.46875 0.53125 
+0.09375 0.4375 0.53125 
+0.09375 0.40625 0.5625 
+0.1875 0.46875 0.53125 
+0.15625 0.46875 0.5625 
+0.15625 0.4375 0.59375 
+0.1875 0.46875 0.65625 
+0.09375 0.3125 0.53125 
+0.21875 0.3125 0.53125 
+0.1875 0.34375 0.53125 
+0.15625 0.34375 0.5625 
+0.21875 0.4375 0.53125 
+0.21875 0.40625 0.5625 
+0.1875 0.40625 0.59375 
+0.21875 0.4375 0.65625 
+0.09375 0.28125 0.5625 
+0.21875 0.28125 0.5625 
+0.1875 0.28125 0.59375 
+0.15625 0.3125 0.59375 
+0.21875 0.28125 0.6875 
+0.21875 0.3125 0.65625 
+0.1875 0.34375 0.65625 
+0.21875 0.40625 0.6875 
+0.28125 0.34375 0.5625 
+0.28125 0.46875 0.6875 
+0.3125 0.46875 0.65625 
+0.28125 0.3125 0.59375 
+0.28125 0.3125 0.71875 
+0.28125 0.34375 0.6875 
+0.3125 0.34375 0.65625 
+0.28125 0.4375 0.71875 
+0.3125 0.40625 0.71875 
+0.34375 0.40625 0.6875 
+0.40625 0.4375 0.71875 
+0.3125 0.34375 0.78125 
+0.3125 0.46875 0.78125 
+0.34375 0.4375 0.78125 
+0.34375 0.40625 0.8125 
+0.4375 0.46875 0.78125 
+0.40625 0.46875 0.8125 
+0.40625 0.4375 0.84375 
+0.4375 0.46875 0.90625 
+0.03125 0.09375 0.5625 
+0.03125 0.21875 0.5625 
+0.03125 0.1875 0.59375 
+0.0625 0.15625 0.59375 
+0.03125 0.21875 0.6875 
+0.0625 0.21875 0.65625 
+0.09375 0.1875 0.65625 
+0.15625 0.21875 0.6875 
+0.03125 0.34375 0.5625 
+0.03125 0.46875 0.5625 
+0.03125 0.4375 0.59375 
+0.0625 0.40625 0.59375 
+0.03125 0.46875 0.6875 
+0.0625 0.46875 0.65625 
+0.09375 0.4375 0.65625 
+0.15625 0.46875 0.6875 
+0.03125 0.3125 0.59375 
+0.03125 0.3125 0.71875 
+0.03125 0.34375 0.6875 
+0.0625 0.34375 0.65625 
+0.03125 0.4375 0.71875 
+0.0625 0.40625 0.71875 
+0.09375 0.40625 0.6875 
+0.15625 0.4375 0.71875 
+0.0625 0.28125 0.59375 
+0.0625 0.28125 0.71875 
+0.09375 0.28125 0.6875 
+0.09375 0.3125 0.65625 
+0.1875 0.28125 0.71875 
+0.15625 0.3125 0.71875 
+0.15625 0.34375 0.6875 
+0.1875 0.40625 0.71875 
+0.03125 0.34375 0.8125 
+0.03125 0.46875 0.8125 
+0.03125 0.4375 0.84375 
+0.0625 0.40625 0.84375 
+0.03125 0.46875 0.9375 
+0.0625 0.46875 0.90625 
+0.09375 0.4375 0.90625 
+0.15625 0.46875 0.9375 
+0.0625 0.34375 0.78125 
+0.0625 0.46875 0.78125 
+0.09375 0.4375 0.78125 
+0.09375 0.40625 0.8125 
+0.1875 0.46875 0.78125 
+0.15625 0.46875 0.8125 
+0.15625 0.4375 0.84375 
+0.1875 0.46875 0.90625 
+0.09375 0.3125 0.78125 
+0.21875 0.3125 0.78125 
+0.1875 0.34375 0.78125 
+0.15625 0.34375 0.8125 
+0.21875 0.4375 0.78125 
+0.21875 0.40625 0.8125 
+0.1875 0.40625 0.84375 
+0.21875 0.4375 0.90625 
+0.28125 0.34375 0.8125 
+0.28125 0.46875 0.8125 
+0.28125 0.4375 0.84375 
+0.3125 0.40625 0.84375 
+0.28125 0.46875 0.9375 
+0.3125 0.46875 0.90625 
+0.34375 0.4375 0.90625 
+0.40625 0.46875 0.9375 
+0.0625 0.03125 0.59375 
+0.0625 0.03125 0.71875 
+0.09375 0.03125 0.6875 
+0.09375 0.0625 0.65625 
+0.1875 0.03125 0.71875 
+0.15625 0.0625 0.71875 
+0.15625 0.09375 0.6875 
+0.1875 0.15625 0.71875 
+0.0625 0.03125 0.84375 
+0.0625 0.03125 0.96875 
+0.09375 0.03125 0.9375 
+0.09375 0.0625 0.90625 
+0.1875 0.03125 0.96875 
+0.15625 0.0625 0.96875 
+0.15625 0.09375 0.9375 
+0.1875 0.15625 0.96875 
+0.09375 0.03125 0.8125 
+0.21875 0.03125 0.8125 
+0.1875 0.03125 0.84375 
+0.15625 0.0625 0.84375 
+0.21875 0.03125 0.9375 
+0.21875 0.0625 0.90625 
+0.1875 0.09375 0.90625 
+0.21875 0.15625 0.9375 
+0.09375 0.0625 0.78125 
+0.21875 0.0625 0.78125 
+0.1875 0.09375 0.78125 
+0.15625 0.09375 0.8125 
+0.21875 0.1875 0.78125 
+0.21875 0.15625 0.8125 
+0.1875 0.15625 0.84375 
+0.21875 0.1875 0.90625 
+0.3125 0.03125 0.84375 
+0.3125 0.03125 0.96875 
+0.34375 0.03125 0.9375 
+0.34375 0.0625 0.90625 
+0.4375 0.03125 0.96875 
+0.40625 0.0625 0.96875 
+0.40625 0.09375 0.9375 
+0.4375 0.15625 0.96875 
+0.28125 0.0625 0.84375 
+0.28125 0.0625 0.96875 
+0.28125 0.09375 0.9375 
+0.3125 0.09375 0.90625 
+0.28125 0.1875 0.96875 
+0.3125 0.15625 0.96875 
+0.34375 0.15625 0.9375 
+0.40625 0.1875 0.96875 
+0.28125 0.09375 0.8125 
+0.28125 0.21875 0.8125 
+0.28125 0.1875 0.84375 
+0.3125 0.15625 0.84375 
+0.28125 0.21875 0.9375 
+0.3125 0.21875 0.90625 
+0.34375 0.1875 0.90625 
+0.40625 0.21875 0.9375 
+0.3125 0.28125 0.84375 
+0.3125 0.28125 0.96875 
+0.34375 0.28125 0.9375 
+0.34375 0.3125 0.90625 
+0.4375 0.28125 0.96875 
+0.40625 0.3125 0.96875 
+0.40625 0.34375 0.9375 
+0.4375 0.40625 0.96875 
+0.03125 0.0625 0.59375 
+0.03125 0.0625 0.71875 
+0.03125 0.09375 0.6875 
+0.0625 0.09375 0.65625 
+0.03125 0.1875 0.71875 
+0.0625 0.15625 0.71875 
+0.09375 0.15625 0.6875 
+0.15625 0.1875 0.71875 
+0.03125 0.0625 0.84375 
+0.03125 0.0625 0.96875 
+0.03125 0.09375 0.9375 
+0.0625 0.09375 0.90625 
+0.03125 0.1875 0.96875 
+0.0625 0.15625 0.96875 
+0.09375 0.15625 0.9375 
+0.15625 0.1875 0.96875 
+0.03125 0.09375 0.8125 
+0.03125 0.21875 0.8125 
+0.03125 0.1875 0.84375 
+0.0625 0.15625 0.84375 
+0.03125 0.21875 0.9375 
+0.0625 0.21875 0.90625 
+0.09375 0.1875 0.90625 
+0.15625 0.21875 0.9375 
+0.0625 0.09375 0.78125 
+0.0625 0.21875 0.78125 
+0.09375 0.1875 0.78125 
+0.09375 0.15625 0.8125 
+0.1875 0.21875 0.78125 
+0.15625 0.21875 0.8125 
+0.15625 0.1875 0.84375 
+0.1875 0.21875 0.90625 
+0.03125 0.3125 0.84375 
+0.03125 0.3125 0.96875 
+0.03125 0.34375 0.9375 
+0.0625 0.34375 0.90625 
+0.03125 0.4375 0.96875 
+0.0625 0.40625 0.96875 
+0.09375 0.40625 0.9375 
+0.15625 0.4375 0.96875 
+0.0625 0.28125 0.84375 
+0.0625 0.28125 0.96875 
+0.09375 0.28125 0.9375 
+0.09375 0.3125 0.90625 
+0.1875 0.28125 0.96875 
+0.15625 0.3125 0.96875 
+0.15625 0.34375 0.9375 
+0.1875 0.40625 0.96875 
+0.09375 0.28125 0.8125 
+0.21875 0.28125 0.8125 
+0.1875 0.28125 0.84375 
+0.15625 0.3125 0.84375 
+0.21875 0.28125 0.9375 
+0.21875 0.3125 0.90625 
+0.1875 0.34375 0.90625 
+0.21875 0.40625 0.9375 
+0.28125 0.3125 0.84375 
+0.28125 0.3125 0.96875 
+0.28125 0.34375 0.9375 
+0.3125 0.34375 0.90625 
+0.28125 0.4375 0.96875 
+0.3125 0.40625 0.96875 
+0.34375 0.40625 0.9375 
+0.40625 0.4375 0.96875 
+0.59375 0.0625 0.53125 
+0.71875 0.0625 0.53125 
+0.6875 0.09375 0.53125 
+0.65625 0.09375 0.5625 
+0.71875 0.1875 0.53125 
+0.71875 0.15625 0.5625 
+0.6875 0.15625 0.59375 
+0.71875 0.1875 0.65625 
+0.84375 0.0625 0.53125 
+0.96875 0.0625 0.53125 
+0.9375 0.09375 0.53125 
+0.90625 0.09375 0.5625 
+0.96875 0.1875 0.53125 
+0.96875 0.15625 0.5625 
+0.9375 0.15625 0.59375 
+0.96875 0.1875 0.65625 
+0.8125 0.09375 0.53125 
+0.8125 0.21875 0.53125 
+0.84375 0.1875 0.53125 
+0.84375 0.15625 0.5625 
+0.9375 0.21875 0.53125 
+0.90625 0.21875 0.5625 
+0.90625 0.1875 0.59375 
+0.9375 0.21875 0.65625 
+0.78125 0.09375 0.5625 
+0.78125 0.21875 0.5625 
+0.78125 0.1875 0.59375 
+0.8125 0.15625 0.59375 
+0.78125 0.21875 0.6875 
+0.8125 0.21875 0.65625 
+0.84375 0.1875 0.65625 
+0.90625 0.21875 0.6875 
+0.84375 0.3125 0.53125 
+0.96875 0.3125 0.53125 
+0.9375 0.34375 0.53125 
+0.90625 0.34375 0.5625 
+0.96875 0.4375 0.53125 
+0.96875 0.40625 0.5625 
+0.9375 0.40625 0.59375 
+0.96875 0.4375 0.65625 
+0.84375 0.28125 0.5625 
+0.96875 0.28125 0.5625 
+0.9375 0.28125 0.59375 
+0.90625 0.3125 0.59375 
+0.96875 0.28125 0.6875 
+0.96875 0.3125 0.65625 
+0.9375 0.34375 0.65625 
+0.96875 0.40625 0.6875 
+0.8125 0.28125 0.59375 
+0.8125 0.28125 0.71875 
+0.84375 0.28125 0.6875 
+0.84375 0.3125 0.65625 
+0.9375 0.28125 0.71875 
+0.90625 0.3125 0.71875 
+0.90625 0.34375 0.6875 
+0.9375 0.40625 0.71875 
+0.84375 0.3125 0.78125 
+0.96875 0.3125 0.78125 
+0.9375 0.34375 0.78125 
+0.90625 0.34375 0.8125 
+0.96875 0.4375 0.78125 
+0.96875 0.40625 0.8125 
+0.9375 0.40625 0.84375 
+0.96875 0.4375 0.90625 
+0.59375 0.03125 0.5625 
+0.71875 0.03125 0.5625 
+0.6875 0.03125 0.59375 
+0.65625 0.0625 0.59375 
+0.71875 0.03125 0.6875 
+0.71875 0.0625 0.65625 
+0.6875 0.09375 0.65625 
+0.71875 0.15625 0.6875 
+0.84375 0.03125 0.5625 
+0.96875 0.03125 0.5625 
+0.9375 0.03125 0.59375 
+0.90625 0.0625 0.59375 
+0.96875 0.03125 0.6875 
+0.96875 0.0625 0.65625 
+0.9375 0.09375 0.65625 
+0.96875 0.15625 0.6875 
+0.8125 0.03125 0.59375 
+0.8125 0.03125 0.71875 
+0.84375 0.03125 0.6875 
+0.84375 0.0625 0.65625 
+0.9375 0.03125 0.71875 
+0.90625 0.0625 0.71875 
+0.90625 0.09375 0.6875 
+0.9375 0.15625 0.71875 
+0.78125 0.0625 0.59375 
+0.78125 0.0625 0.71875 
+0.78125 0.09375 0.6875 
+0.8125 0.09375 0.65625 
+0.78125 0.1875 0.71875 
+0.8125 0.15625 0.71875 
+0.84375 0.15625 0.6875 
+0.90625 0.1875 0.71875 
+0.84375 0.03125 0.8125 
+0.96875 0.03125 0.8125 
+0.9375 0.03125 0.84375 
+0.90625 0.0625 0.84375 
+0.96875 0.03125 0.9375 
+0.96875 0.0625 0.90625 
+0.9375 0.09375 0.90625 
+0.96875 0.15625 0.9375 
+0.84375 0.0625 0.78125 
+0.96875 0.0625 0.78125 
+0.9375 0.09375 0.78125 
+0.90625 0.09375 0.8125 
+0.96875 0.1875 0.78125 
+0.96875 0.15625 0.8125 
+0.9375 0.15625 0.84375 
+0.96875 0.1875 0.90625 
+0.8125 0.09375 0.78125 
+0.8125 0.21875 0.78125 
+0.84375 0.1875 0.78125 
+0.84375 0.15625 0.8125 
+0.9375 0.21875 0.78125 
+0.90625 0.21875 0.8125 
+0.90625 0.1875 0.84375 
+0.9375 0.21875 0.90625 
+0.84375 0.28125 0.8125 
+0.96875 0.28125 0.8125 
+0.9375 0.28125 0.84375 
+0.90625 0.3125 0.84375 
+0.96875 0.28125 0.9375 
+0.96875 0.3125 0.90625 
+0.9375 0.34375 0.90625 
+0.96875 0.40625 0.9375 
+0.5625 0.09375 0.53125 
+0.5625 0.21875 0.53125 
+0.59375 0.1875 0.53125 
+0.59375 0.15625 0.5625 
+0.6875 0.21875 0.53125 
+0.65625 0.21875 0.5625 
+0.65625 0.1875 0.59375 
+0.6875 0.21875 0.65625 
+0.71875 0.3125 0.53125 
+0.6875 0.34375 0.53125 
+0.71875 0.4375 0.65625 
+0.59375 0.28125 0.5625 
+0.71875 0.28125 0.5625 
+0.6875 0.28125 0.59375 
+0.65625 0.3125 0.59375 
+0.71875 0.28125 0.6875 
+0.71875 0.3125 0.65625 
+0.6875 0.34375 0.65625 
+0.71875 0.40625 0.6875 
+0.8125 0.34375 0.53125 
+0.8125 0.46875 0.53125 
+0.84375 0.4375 0.53125 
+0.84375 0.40625 0.5625 
+0.9375 0.46875 0.53125 
+0.90625 0.46875 0.5625 
+0.90625 0.4375 0.59375 
+0.9375 0.46875 0.65625 
+0.78125 0.34375 0.5625 
+0.78125 0.46875 0.5625 
+0.78125 0.4375 0.59375 
+0.8125 0.40625 0.59375 
+0.78125 0.46875 0.6875 
+0.8125 0.46875 0.65625 
+0.84375 0.4375 0.65625 
+0.90625 0.46875 0.6875 
+0.78125 0.3125 0.59375 
+0.78125 0.3125 0.71875 
+0.78125 0.34375 0.6875 
+0.8125 0.34375 0.65625 
+0.78125 0.4375 0.71875 
+0.8125 0.40625 0.71875 
+0.84375 0.40625 0.6875 
+0.90625 0.4375 0.71875 
+0.8125 0.34375 0.78125 
+0.8125 0.46875 0.78125 
+0.84375 0.4375 0.78125 
+0.84375 0.40625 0.8125 
+0.9375 0.46875 0.78125 
+0.90625 0.46875 0.8125 
+0.90625 0.4375 0.84375 
+0.9375 0.46875 0.90625 
+0.53125 0.09375 0.5625 
+0.53125 0.21875 0.5625 
+0.53125 0.1875 0.59375 
+0.5625 0.15625 0.59375 
+0.53125 0.21875 0.6875 
+0.5625 0.21875 0.65625 
+0.59375 0.1875 0.65625 
+0.65625 0.21875 0.6875 
+0.53125 0.3125 0.71875 
+0.53125 0.34375 0.6875 
+0.65625 0.4375 0.71875 
+0.5625 0.28125 0.59375 
+0.5625 0.28125 0.71875 
+0.59375 0.28125 0.6875 
+0.59375 0.3125 0.65625 
+0.6875 0.28125 0.71875 
+0.65625 0.3125 0.71875 
+0.65625 0.34375 0.6875 
+0.6875 0.40625 0.71875 
+0.53125 0.34375 0.8125 
+0.53125 0.46875 0.8125 
+0.53125 0.4375 0.84375 
+0.5625 0.40625 0.84375 
+0.53125 0.46875 0.9375 
+0.5625 0.46875 0.90625 
+0.59375 0.4375 0.90625 
+0.65625 0.46875 0.9375 
+0.5625 0.34375 0.78125 
+0.5625 0.46875 0.78125 
+0.59375 0.4375 0.78125 
+0.59375 0.40625 0.8125 
+0.6875 0.46875 0.78125 
+0.65625 0.46875 0.8125 
+0.65625 0.4375 0.84375 
+0.6875 0.46875 0.90625 
+0.59375 0.3125 0.78125 
+0.71875 0.3125 0.78125 
+0.6875 0.34375 0.78125 
+0.65625 0.34375 0.8125 
+0.71875 0.4375 0.78125 
+0.71875 0.40625 0.8125 
+0.6875 0.40625 0.84375 
+0.71875 0.4375 0.90625 
+0.78125 0.34375 0.8125 
+0.78125 0.46875 0.8125 
+0.78125 0.4375 0.84375 
+0.8125 0.40625 0.84375 
+0.78125 0.46875 0.9375 
+0.8125 0.46875 0.90625 
+0.84375 0.4375 0.90625 
+0.90625 0.46875 0.9375 
+0.5625 0.03125 0.59375 
+0.5625 0.03125 0.71875 
+0.59375 0.03125 0.6875 
+0.59375 0.0625 0.65625 
+0.6875 0.03125 0.71875 
+0.65625 0.0625 0.71875 
+0.65625 0.09375 0.6875 
+0.6875 0.15625 0.71875 
+0.5625 0.03125 0.84375 
+0.5625 0.03125 0.96875 
+0.59375 0.03125 0.9375 
+0.59375 0.0625 0.90625 
+0.6875 0.03125 0.96875 
+0.65625 0.0625 0.96875 
+0.65625 0.09375 0.9375 
+0.6875 0.15625 0.96875 
+0.59375 0.03125 0.8125 
+0.71875 0.03125 0.8125 
+0.6875 0.03125 0.84375 
+0.65625 0.0625 0.84375 
+0.71875 0.03125 0.9375 
+0.71875 0.0625 0.90625 
+0.6875 0.09375 0.90625 
+0.71875 0.15625 0.9375 
+0.59375 0.0625 0.78125 
+0.71875 0.0625 0.78125 
+0.6875 0.09375 0.78125 
+0.65625 0.09375 0.8125 
+0.71875 0.1875 0.78125 
+0.71875 0.15625 0.8125 
+0.6875 0.15625 0.84375 
+0.71875 0.1875 0.90625 
+0.8125 0.03125 0.84375 
+0.8125 0.03125 0.96875 
+0.84375 0.03125 0.9375 
+0.84375 0.0625 0.90625 
+0.9375 0.03125 0.96875 
+0.90625 0.0625 0.96875 
+0.90625 0.09375 0.9375 
+0.9375 0.15625 0.96875 
+0.78125 0.0625 0.84375 
+0.78125 0.0625 0.96875 
+0.78125 0.09375 0.9375 
+0.8125 0.09375 0.90625 
+0.78125 0.1875 0.96875 
+0.8125 0.15625 0.96875 
+0.84375 0.15625 0.9375 
+0.90625 0.1875 0.96875 
+0.78125 0.09375 0.8125 
+0.78125 0.21875 0.8125 
+0.78125 0.1875 0.84375 
+0.8125 0.15625 0.84375 
+0.78125 0.21875 0.9375 
+0.8125 0.21875 0.90625 
+0.84375 0.1875 0.90625 
+0.90625 0.21875 0.9375 
+0.8125 0.28125 0.84375 
+0.8125 0.28125 0.96875 
+0.84375 0.28125 0.9375 
+0.84375 0.3125 0.90625 
+0.9375 0.28125 0.96875 
+0.90625 0.3125 0.96875 
+0.90625 0.34375 0.9375 
+0.9375 0.40625 0.96875 
+0.53125 0.0625 0.59375 
+0.53125 0.0625 0.71875 
+0.53125 0.09375 0.6875 
+0.5625 0.09375 0.65625 
+0.53125 0.1875 0.71875 
+0.5625 0.15625 0.71875 
+0.59375 0.15625 0.6875 
+0.65625 0.1875 0.71875 
+0.53125 0.0625 0.84375 
+0.53125 0.0625 0.96875 
+0.53125 0.09375 0.9375 
+0.5625 0.09375 0.90625 
+0.53125 0.1875 0.96875 
+0.5625 0.15625 0.96875 
+0.59375 0.15625 0.9375 
+0.65625 0.1875 0.96875 
+0.53125 0.09375 0.8125 
+0.53125 0.21875 0.8125 
+0.53125 0.1875 0.84375 
+0.5625 0.15625 0.84375 
+0.53125 0.21875 0.9375 
+0.5625 0.21875 0.90625 
+0.59375 0.1875 0.90625 
+0.65625 0.21875 0.9375 
+0.5625 0.09375 0.78125 
+0.5625 0.21875 0.78125 
+0.59375 0.1875 0.78125 
+0.59375 0.15625 0.8125 
+0.6875 0.21875 0.78125 
+0.65625 0.21875 0.8125 
+0.65625 0.1875 0.84375 
+0.6875 0.21875 0.90625 
+0.53125 0.3125 0.84375 
+0.53125 0.3125 0.96875 
+0.53125 0.34375 0.9375 
+0.5625 0.34375 0.90625 
+0.53125 0.4375 0.96875 
+0.5625 0.40625 0.96875 
+0.59375 0.40625 0.9375 
+0.65625 0.4375 0.96875 
+0.5625 0.28125 0.84375 
+0.5625 0.28125 0.96875 
+0.59375 0.28125 0.9375 
+0.59375 0.3125 0.90625 
+0.6875 0.28125 0.96875 
+0.65625 0.3125 0.96875 
+0.65625 0.34375 0.9375 
+0.6875 0.40625 0.96875 
+0.59375 0.28125 0.8125 
+0.71875 0.28125 0.8125 
+0.6875 0.28125 0.84375 
+0.65625 0.3125 0.84375 
+0.71875 0.28125 0.9375 
+0.71875 0.3125 0.90625 
+0.6875 0.34375 0.90625 
+0.71875 0.40625 0.9375 
+0.78125 0.3125 0.84375 
+0.78125 0.3125 0.96875 
+0.78125 0.34375 0.9375 
+0.8125 0.34375 0.90625 
+0.78125 0.4375 0.96875 
+0.8125 0.40625 0.96875 
+0.84375 0.40625 0.9375 
+0.90625 0.4375 0.96875 
+0.09375 0.5625 0.53125 
+0.21875 0.5625 0.53125 
+0.1875 0.59375 0.53125 
+0.15625 0.59375 0.5625 
+0.21875 0.6875 0.53125 
+0.21875 0.65625 0.5625 
+0.1875 0.65625 0.59375 
+0.21875 0.6875 0.65625 
+0.3125 0.71875 0.53125 
+0.34375 0.6875 0.53125 
+0.4375 0.71875 0.65625 
+0.28125 0.59375 0.5625 
+0.28125 0.71875 0.5625 
+0.28125 0.6875 0.59375 
+0.3125 0.65625 0.59375 
+0.28125 0.71875 0.6875 
+0.3125 0.71875 0.65625 
+0.34375 0.6875 0.65625 
+0.40625 0.71875 0.6875 
+0.34375 0.8125 0.53125 
+0.46875 0.8125 0.53125 
+0.4375 0.84375 0.53125 
+0.40625 0.84375 0.5625 
+0.46875 0.9375 0.53125 
+0.46875 0.90625 0.5625 
+0.4375 0.90625 0.59375 
+0.46875 0.9375 0.65625 
+0.34375 0.78125 0.5625 
+0.46875 0.78125 0.5625 
+0.4375 0.78125 0.59375 
+0.40625 0.8125 0.59375 
+0.46875 0.78125 0.6875 
+0.46875 0.8125 0.65625 
+0.4375 0.84375 0.65625 
+0.46875 0.90625 0.6875 
+0.3125 0.78125 0.59375 
+0.3125 0.78125 0.71875 
+0.34375 0.78125 0.6875 
+0.34375 0.8125 0.65625 
+0.4375 0.78125 0.71875 
+0.40625 0.8125 0.71875 
+0.40625 0.84375 0.6875 
+0.4375 0.90625 0.71875 
+0.34375 0.8125 0.78125 
+0.46875 0.8125 0.78125 
+0.4375 0.84375 0.78125 
+0.40625 0.84375 0.8125 
+0.46875 0.9375 0.78125 
+0.46875 0.90625 0.8125 
+0.4375 0.90625 0.84375 
+0.46875 0.9375 0.90625 
+0.09375 0.53125 0.5625 
+0.21875 0.53125 0.5625 
+0.1875 0.53125 0.59375 
+0.15625 0.5625 0.59375 
+0.21875 0.53125 0.6875 
+0.21875 0.5625 0.65625 
+0.1875 0.59375 0.65625 
+0.21875 0.65625 0.6875 
+0.3125 0.53125 0.71875 
+0.34375 0.53125 0.6875 
+0.4375 0.65625 0.71875 
+0.28125 0.5625 0.59375 
+0.28125 0.5625 0.71875 
+0.28125 0.59375 0.6875 
+0.3125 0.59375 0.65625 
+0.28125 0.6875 0.71875 
+0.3125 0.65625 0.71875 
+0.34375 0.65625 0.6875 
+0.40625 0.6875 0.71875 
+0.34375 0.53125 0.8125 
+0.46875 0.53125 0.8125 
+0.4375 0.53125 0.84375 
+0.40625 0.5625 0.84375 
+0.46875 0.53125 0.9375 
+0.46875 0.5625 0.90625 
+0.4375 0.59375 0.90625 
+0.46875 0.65625 0.9375 
+0.34375 0.5625 0.78125 
+0.46875 0.5625 0.78125 
+0.4375 0.59375 0.78125 
+0.40625 0.59375 0.8125 
+0.46875 0.6875 0.78125 
+0.46875 0.65625 0.8125 
+0.4375 0.65625 0.84375 
+0.46875 0.6875 0.90625 
+0.3125 0.59375 0.78125 
+0.3125 0.71875 0.78125 
+0.34375 0.6875 0.78125 
+0.34375 0.65625 0.8125 
+0.4375 0.71875 0.78125 
+0.40625 0.71875 0.8125 
+0.40625 0.6875 0.84375 
+0.4375 0.71875 0.90625 
+0.34375 0.78125 0.8125 
+0.46875 0.78125 0.8125 
+0.4375 0.78125 0.84375 
+0.40625 0.8125 0.84375 
+0.46875 0.78125 0.9375 
+0.46875 0.8125 0.90625 
+0.4375 0.84375 0.90625 
+0.46875 0.90625 0.9375 
+0.0625 0.59375 0.53125 
+0.0625 0.71875 0.53125 
+0.09375 0.6875 0.53125 
+0.09375 0.65625 0.5625 
+0.1875 0.71875 0.53125 
+0.15625 0.71875 0.5625 
+0.15625 0.6875 0.59375 
+0.1875 0.71875 0.65625 
+0.0625 0.84375 0.53125 
+0.0625 0.96875 0.53125 
+0.09375 0.9375 0.53125 
+0.09375 0.90625 0.5625 
+0.1875 0.96875 0.53125 
+0.15625 0.96875 0.5625 
+0.15625 0.9375 0.59375 
+0.1875 0.96875 0.65625 
+0.09375 0.8125 0.53125 
+0.21875 0.8125 0.53125 
+0.1875 0.84375 0.53125 
+0.15625 0.84375 0.5625 
+0.21875 0.9375 0.53125 
+0.21875 0.90625 0.5625 
+0.1875 0.90625 0.59375 
+0.21875 0.9375 0.65625 
+0.09375 0.78125 0.5625 
+0.21875 0.78125 0.5625 
+0.1875 0.78125 0.59375 
+0.15625 0.8125 0.59375 
+0.21875 0.78125 0.6875 
+0.21875 0.8125 0.65625 
+0.1875 0.84375 0.65625 
+0.21875 0.90625 0.6875 
+0.3125 0.84375 0.53125 
+0.3125 0.96875 0.53125 
+0.34375 0.9375 0.53125 
+0.34375 0.90625 0.5625 
+0.4375 0.96875 0.53125 
+0.40625 0.96875 0.5625 
+0.40625 0.9375 0.59375 
+0.4375 0.96875 0.65625 
+0.28125 0.84375 0.5625 
+0.28125 0.96875 0.5625 
+0.28125 0.9375 0.59375 
+0.3125 0.90625 0.59375 
+0.28125 0.96875 0.6875 
+0.3125 0.96875 0.65625 
+0.34375 0.9375 0.65625 
+0.40625 0.96875 0.6875 
+0.28125 0.8125 0.59375 
+0.28125 0.8125 0.71875 
+0.28125 0.84375 0.6875 
+0.3125 0.84375 0.65625 
+0.28125 0.9375 0.71875 
+0.3125 0.90625 0.71875 
+0.34375 0.90625 0.6875 
+0.40625 0.9375 0.71875 
+0.3125 0.84375 0.78125 
+0.3125 0.96875 0.78125 
+0.34375 0.9375 0.78125 
+0.34375 0.90625 0.8125 
+0.4375 0.96875 0.78125 
+0.40625 0.96875 0.8125 
+0.40625 0.9375 0.84375 
+0.4375 0.96875 0.90625 
+0.03125 0.59375 0.5625 
+0.03125 0.71875 0.5625 
+0.03125 0.6875 0.59375 
+0.0625 0.65625 0.59375 
+0.03125 0.71875 0.6875 
+0.0625 0.71875 0.65625 
+0.09375 0.6875 0.65625 
+0.15625 0.71875 0.6875 
+0.03125 0.84375 0.5625 
+0.03125 0.96875 0.5625 
+0.03125 0.9375 0.59375 
+0.0625 0.90625 0.59375 
+0.03125 0.96875 0.6875 
+0.0625 0.96875 0.65625 
+0.09375 0.9375 0.65625 
+0.15625 0.96875 0.6875 
+0.03125 0.8125 0.59375 
+0.03125 0.8125 0.71875 
+0.03125 0.84375 0.6875 
+0.0625 0.84375 0.65625 
+0.03125 0.9375 0.71875 
+0.0625 0.90625 0.71875 
+0.09375 0.90625 0.6875 
+0.15625 0.9375 0.71875 
+0.0625 0.78125 0.59375 
+0.0625 0.78125 0.71875 
+0.09375 0.78125 0.6875 
+0.09375 0.8125 0.65625 
+0.1875 0.78125 0.71875 
+0.15625 0.8125 0.71875 
+0.15625 0.84375 0.6875 
+0.1875 0.90625 0.71875 
+0.03125 0.84375 0.8125 
+0.03125 0.96875 0.8125 
+0.03125 0.9375 0.84375 
+0.0625 0.90625 0.84375 
+0.03125 0.96875 0.9375 
+0.0625 0.96875 0.90625 
+0.09375 0.9375 0.90625 
+0.15625 0.96875 0.9375 
+0.0625 0.84375 0.78125 
+0.0625 0.96875 0.78125 
+0.09375 0.9375 0.78125 
+0.09375 0.90625 0.8125 
+0.1875 0.96875 0.78125 
+0.15625 0.96875 0.8125 
+0.15625 0.9375 0.84375 
+0.1875 0.96875 0.90625 
+0.09375 0.8125 0.78125 
+0.21875 0.8125 0.78125 
+0.1875 0.84375 0.78125 
+0.15625 0.84375 0.8125 
+0.21875 0.9375 0.78125 
+0.21875 0.90625 0.8125 
+0.1875 0.90625 0.84375 
+0.21875 0.9375 0.90625 
+0.28125 0.84375 0.8125 
+0.28125 0.96875 0.8125 
+0.28125 0.9375 0.84375 
+0.3125 0.90625 0.84375 
+0.28125 0.96875 0.9375 
+0.3125 0.96875 0.90625 
+0.34375 0.9375 0.90625 
+0.40625 0.96875 0.9375 
+0.0625 0.53125 0.59375 
+0.0625 0.53125 0.71875 
+0.09375 0.53125 0.6875 
+0.09375 0.5625 0.65625 
+0.1875 0.53125 0.71875 
+0.15625 0.5625 0.71875 
+0.15625 0.59375 0.6875 
+0.1875 0.65625 0.71875 
+0.0625 0.53125 0.84375 
+0.0625 0.53125 0.96875 
+0.09375 0.53125 0.9375 
+0.09375 0.5625 0.90625 
+0.1875 0.53125 0.96875 
+0.15625 0.5625 0.96875 
+0.15625 0.59375 0.9375 
+0.1875 0.65625 0.96875 
+0.09375 0.53125 0.8125 
+0.21875 0.53125 0.8125 
+0.1875 0.53125 0.84375 
+0.15625 0.5625 0.84375 
+0.21875 0.53125 0.9375 
+0.21875 0.5625 0.90625 
+0.1875 0.59375 0.90625 
+0.21875 0.65625 0.9375 
+0.09375 0.5625 0.78125 
+0.21875 0.5625 0.78125 
+0.1875 0.59375 0.78125 
+0.15625 0.59375 0.8125 
+0.21875 0.6875 0.78125 
+0.21875 0.65625 0.8125 
+0.1875 0.65625 0.84375 
+0.21875 0.6875 0.90625 
+0.3125 0.53125 0.84375 
+0.3125 0.53125 0.96875 
+0.34375 0.53125 0.9375 
+0.34375 0.5625 0.90625 
+0.4375 0.53125 0.96875 
+0.40625 0.5625 0.96875 
+0.40625 0.59375 0.9375 
+0.4375 0.65625 0.96875 
+0.28125 0.5625 0.84375 
+0.28125 0.5625 0.96875 
+0.28125 0.59375 0.9375 
+0.3125 0.59375 0.90625 
+0.28125 0.6875 0.96875 
+0.3125 0.65625 0.96875 
+0.34375 0.65625 0.9375 
+0.40625 0.6875 0.96875 
+0.28125 0.59375 0.8125 
+0.28125 0.71875 0.8125 
+0.28125 0.6875 0.84375 
+0.3125 0.65625 0.84375 
+0.28125 0.71875 0.9375 
+0.3125 0.71875 0.90625 
+0.34375 0.6875 0.90625 
+0.40625 0.71875 0.9375 
+0.3125 0.78125 0.84375 
+0.3125 0.78125 0.96875 
+0.34375 0.78125 0.9375 
+0.34375 0.8125 0.90625 
+0.4375 0.78125 0.96875 
+0.40625 0.8125 0.96875 
+0.40625 0.84375 0.9375 
+0.4375 0.90625 0.96875 
+0.03125 0.5625 0.59375 
+0.03125 0.5625 0.71875 
+0.03125 0.59375 0.6875 
+0.0625 0.59375 0.65625 
+0.03125 0.6875 0.71875 
+0.0625 0.65625 0.71875 
+0.09375 0.65625 0.6875 
+0.15625 0.6875 0.71875 
+0.03125 0.5625 0.84375 
+0.03125 0.5625 0.96875 
+0.03125 0.59375 0.9375 
+0.0625 0.59375 0.90625 
+0.03125 0.6875 0.96875 
+0.0625 0.65625 0.96875 
+0.09375 0.65625 0.9375 
+0.15625 0.6875 0.96875 
+0.03125 0.59375 0.8125 
+0.03125 0.71875 0.8125 
+0.03125 0.6875 0.84375 
+0.0625 0.65625 0.84375 
+0.03125 0.71875 0.9375 
+0.0625 0.71875 0.90625 
+0.09375 0.6875 0.90625 
+0.15625 0.71875 0.9375 
+0.0625 0.59375 0.78125 
+0.0625 0.71875 0.78125 
+0.09375 0.6875 0.78125 
+0.09375 0.65625 0.8125 
+0.1875 0.71875 0.78125 
+0.15625 0.71875 0.8125 
+0.15625 0.6875 0.84375 
+0.1875 0.71875 0.90625 
+0.03125 0.8125 0.84375 
+0.03125 0.8125 0.96875 
+0.03125 0.84375 0.9375 
+0.0625 0.84375 0.90625 
+0.03125 0.9375 0.96875 
+0.0625 0.90625 0.96875 
+0.09375 0.90625 0.9375 
+0.15625 0.9375 0.96875 
+0.0625 0.78125 0.84375 
+0.0625 0.78125 0.96875 
+0.09375 0.78125 0.9375 
+0.09375 0.8125 0.90625 
+0.1875 0.78125 0.96875 
+0.15625 0.8125 0.96875 
+0.15625 0.84375 0.9375 
+0.1875 0.90625 0.96875 
+0.09375 0.78125 0.8125 
+0.21875 0.78125 0.8125 
+0.1875 0.78125 0.84375 
+0.15625 0.8125 0.84375 
+0.21875 0.78125 0.9375 
+0.21875 0.8125 0.90625 
+0.1875 0.84375 0.90625 
+0.21875 0.90625 0.9375 
+0.28125 0.8125 0.84375 
+0.28125 0.8125 0.96875 
+0.28125 0.84375 0.9375 
+0.3125 0.84375 0.90625 
+0.28125 0.9375 0.96875 
+0.3125 0.90625 0.96875 
+0.34375 0.90625 0.9375 
+0.40625 0.9375 0.96875 
+0.84375 0.5625 0.53125 
+0.96875 0.5625 0.53125 
+0.9375 0.59375 0.53125 
+0.90625 0.59375 0.5625 
+0.96875 0.6875 0.53125 
+0.96875 0.65625 0.5625 
+0.9375 0.65625 0.59375 
+0.96875 0.6875 0.65625 
+0.8125 0.59375 0.53125 
+0.8125 0.71875 0.53125 
+0.84375 0.6875 0.53125 
+0.84375 0.65625 0.5625 
+0.9375 0.71875 0.53125 
+0.90625 0.71875 0.5625 
+0.90625 0.6875 0.59375 
+0.9375 0.71875 0.65625 
+0.78125 0.71875 0.5625 
+0.78125 0.71875 0.6875 
+0.8125 0.71875 0.65625 
+0.84375 0.6875 0.65625 
+0.90625 0.71875 0.6875 
+0.84375 0.8125 0.53125 
+0.96875 0.8125 0.53125 
+0.9375 0.84375 0.53125 
+0.90625 0.84375 0.5625 
+0.96875 0.9375 0.53125 
+0.96875 0.90625 0.5625 
+0.9375 0.90625 0.59375 
+0.96875 0.9375 0.65625 
+0.84375 0.78125 0.5625 
+0.96875 0.78125 0.5625 
+0.9375 0.78125 0.59375 
+0.90625 0.8125 0.59375 
+0.96875 0.78125 0.6875 
+0.96875 0.8125 0.65625 
+0.9375 0.84375 0.65625 
+0.96875 0.90625 0.6875 
+0.8125 0.78125 0.59375 
+0.8125 0.78125 0.71875 
+0.84375 0.78125 0.6875 
+0.84375 0.8125 0.65625 
+0.9375 0.78125 0.71875 
+0.90625 0.8125 0.71875 
+0.90625 0.84375 0.6875 
+0.9375 0.90625 0.71875 
+0.84375 0.8125 0.78125 
+0.96875 0.8125 0.78125 
+0.9375 0.84375 0.78125 
+0.90625 0.84375 0.8125 
+0.96875 0.9375 0.78125 
+0.96875 0.90625 0.8125 
+0.9375 0.90625 0.84375 
+0.96875 0.9375 0.90625 
+0.84375 0.53125 0.5625 
+0.96875 0.53125 0.5625 
+0.9375 0.53125 0.59375 
+0.90625 0.5625 0.59375 
+0.96875 0.53125 0.6875 
+0.96875 0.5625 0.65625 
+0.9375 0.59375 0.65625 
+0.96875 0.65625 0.6875 
+0.8125 0.53125 0.59375 
+0.8125 0.53125 0.71875 
+0.84375 0.53125 0.6875 
+0.84375 0.5625 0.65625 
+0.9375 0.53125 0.71875 
+0.90625 0.5625 0.71875 
+0.90625 0.59375 0.6875 
+0.9375 0.65625 0.71875 
+0.78125 0.5625 0.71875 
+0.78125 0.6875 0.71875 
+0.8125 0.65625 0.71875 
+0.84375 0.65625 0.6875 
+0.90625 0.6875 0.71875 
+0.84375 0.53125 0.8125 
+0.96875 0.53125 0.8125 
+0.9375 0.53125 0.84375 
+0.90625 0.5625 0.84375 
+0.96875 0.53125 0.9375 
+0.96875 0.5625 0.90625 
+0.9375 0.59375 0.90625 
+0.96875 0.65625 0.9375 
+0.84375 0.5625 0.78125 
+0.96875 0.5625 0.78125 
+0.9375 0.59375 0.78125 
+0.90625 0.59375 0.8125 
+0.96875 0.6875 0.78125 
+0.96875 0.65625 0.8125 
+0.9375 0.65625 0.84375 
+0.96875 0.6875 0.90625 
+0.8125 0.59375 0.78125 
+0.8125 0.71875 0.78125 
+0.84375 0.6875 0.78125 
+0.84375 0.65625 0.8125 
+0.9375 0.71875 0.78125 
+0.90625 0.71875 0.8125 
+0.90625 0.6875 0.84375 
+0.9375 0.71875 0.90625 
+0.84375 0.78125 0.8125 
+0.96875 0.78125 0.8125 
+0.9375 0.78125 0.84375 
+0.90625 0.8125 0.84375 
+0.96875 0.78125 0.9375 
+0.96875 0.8125 0.90625 
+0.9375 0.84375 0.90625 
+0.96875 0.90625 0.9375 
+0.5625 0.84375 0.53125 
+0.5625 0.96875 0.53125 
+0.59375 0.9375 0.53125 
+0.59375 0.90625 0.5625 
+0.6875 0.96875 0.53125 
+0.65625 0.96875 0.5625 
+0.65625 0.9375 0.59375 
+0.6875 0.96875 0.65625 
+0.59375 0.8125 0.53125 
+0.71875 0.8125 0.53125 
+0.6875 0.84375 0.53125 
+0.65625 0.84375 0.5625 
+0.71875 0.9375 0.53125 
+0.71875 0.90625 0.5625 
+0.6875 0.90625 0.59375 
+0.71875 0.9375 0.65625 
+0.71875 0.78125 0.5625 
+0.71875 0.78125 0.6875 
+0.71875 0.8125 0.65625 
+0.6875 0.84375 0.65625 
+0.71875 0.90625 0.6875 
+0.8125 0.84375 0.53125 
+0.8125 0.96875 0.53125 
+0.84375 0.9375 0.53125 
+0.84375 0.90625 0.5625 
+0.9375 0.96875 0.53125 
+0.90625 0.96875 0.5625 
+0.90625 0.9375 0.59375 
+0.9375 0.96875 0.65625 
+0.78125 0.84375 0.5625 
+0.78125 0.96875 0.5625 
+0.78125 0.9375 0.59375 
+0.8125 0.90625 0.59375 
+0.78125 0.96875 0.6875 
+0.8125 0.96875 0.65625 
+0.84375 0.9375 0.65625 
+0.90625 0.96875 0.6875 
+0.78125 0.8125 0.59375 
+0.78125 0.8125 0.71875 
+0.78125 0.84375 0.6875 
+0.8125 0.84375 0.65625 
+0.78125 0.9375 0.71875 
+0.8125 0.90625 0.71875 
+0.84375 0.90625 0.6875 
+0.90625 0.9375 0.71875 
+0.8125 0.84375 0.78125 
+0.8125 0.96875 0.78125 
+0.84375 0.9375 0.78125 
+0.84375 0.90625 0.8125 
+0.9375 0.96875 0.78125 
+0.90625 0.96875 0.8125 
+0.90625 0.9375 0.84375 
+0.9375 0.96875 0.90625 
+0.53125 0.84375 0.5625 
+0.53125 0.96875 0.5625 
+0.53125 0.9375 0.59375 
+0.5625 0.90625 0.59375 
+0.53125 0.96875 0.6875 
+0.5625 0.96875 0.65625 
+0.59375 0.9375 0.65625 
+0.65625 0.96875 0.6875 
+0.53125 0.8125 0.59375 
+0.53125 0.8125 0.71875 
+0.53125 0.84375 0.6875 
+0.5625 0.84375 0.65625 
+0.53125 0.9375 0.71875 
+0.5625 0.90625 0.71875 
+0.59375 0.90625 0.6875 
+0.65625 0.9375 0.71875 
+0.5625 0.78125 0.71875 
+0.6875 0.78125 0.71875 
+0.65625 0.8125 0.71875 
+0.65625 0.84375 0.6875 
+0.6875 0.90625 0.71875 
+0.53125 0.84375 0.8125 
+0.53125 0.96875 0.8125 
+0.53125 0.9375 0.84375 
+0.5625 0.90625 0.84375 
+0.53125 0.96875 0.9375 
+0.5625 0.96875 0.90625 
+0.59375 0.9375 0.90625 
+0.65625 0.96875 0.9375 
+0.5625 0.84375 0.78125 
+0.5625 0.96875 0.78125 
+0.59375 0.9375 0.78125 
+0.59375 0.90625 0.8125 
+0.6875 0.96875 0.78125 
+0.65625 0.96875 0.8125 
+0.65625 0.9375 0.84375 
+0.6875 0.96875 0.90625 
+0.59375 0.8125 0.78125 
+0.71875 0.8125 0.78125 
+0.6875 0.84375 0.78125 
+0.65625 0.84375 0.8125 
+0.71875 0.9375 0.78125 
+0.71875 0.90625 0.8125 
+0.6875 0.90625 0.84375 
+0.71875 0.9375 0.90625 
+0.78125 0.84375 0.8125 
+0.78125 0.96875 0.8125 
+0.78125 0.9375 0.84375 
+0.8125 0.90625 0.84375 
+0.78125 0.96875 0.9375 
+0.8125 0.96875 0.90625 
+0.84375 0.9375 0.90625 
+0.90625 0.96875 0.9375 
+0.5625 0.53125 0.84375 
+0.5625 0.53125 0.96875 
+0.59375 0.53125 0.9375 
+0.59375 0.5625 0.90625 
+0.6875 0.53125 0.96875 
+0.65625 0.5625 0.96875 
+0.65625 0.59375 0.9375 
+0.6875 0.65625 0.96875 
+0.59375 0.53125 0.8125 
+0.71875 0.53125 0.8125 
+0.6875 0.53125 0.84375 
+0.65625 0.5625 0.84375 
+0.71875 0.53125 0.9375 
+0.71875 0.5625 0.90625 
+0.6875 0.59375 0.90625 
+0.71875 0.65625 0.9375 
+0.71875 0.5625 0.78125 
+0.71875 0.6875 0.78125 
+0.71875 0.65625 0.8125 
+0.6875 0.65625 0.84375 
+0.71875 0.6875 0.90625 
+0.8125 0.53125 0.84375 
+0.8125 0.53125 0.96875 
+0.84375 0.53125 0.9375 
+0.84375 0.5625 0.90625 
+0.9375 0.53125 0.96875 
+0.90625 0.5625 0.96875 
+0.90625 0.59375 0.9375 
+0.9375 0.65625 0.96875 
+0.78125 0.5625 0.84375 
+0.78125 0.5625 0.96875 
+0.78125 0.59375 0.9375 
+0.8125 0.59375 0.90625 
+0.78125 0.6875 0.96875 
+0.8125 0.65625 0.96875 
+0.84375 0.65625 0.9375 
+0.90625 0.6875 0.96875 
+0.78125 0.59375 0.8125 
+0.78125 0.71875 0.8125 
+0.78125 0.6875 0.84375 
+0.8125 0.65625 0.84375 
+0.78125 0.71875 0.9375 
+0.8125 0.71875 0.90625 
+0.84375 0.6875 0.90625 
+0.90625 0.71875 0.9375 
+0.8125 0.78125 0.84375 
+0.8125 0.78125 0.96875 
+0.84375 0.78125 0.9375 
+0.84375 0.8125 0.90625 
+0.9375 0.78125 0.96875 
+0.90625 0.8125 0.96875 
+0.90625 0.84375 0.9375 
+0.9375 0.90625 0.96875 
+0.53125 0.5625 0.84375 
+0.53125 0.5625 0.96875 
+0.53125 0.59375 0.9375 
+0.5625 0.59375 0.90625 
+0.53125 0.6875 0.96875 
+0.5625 0.65625 0.96875 
+0.59375 0.65625 0.9375 
+0.65625 0.6875 0.96875 
+0.53125 0.59375 0.8125 
+0.53125 0.71875 0.8125 
+0.53125 0.6875 0.84375 
+0.5625 0.65625 0.84375 
+0.53125 0.71875 0.9375 
+0.5625 0.71875 0.90625 
+0.59375 0.6875 0.90625 
+0.65625 0.71875 0.9375 
+0.5625 0.71875 0.78125 
+0.6875 0.71875 0.78125 
+0.65625 0.71875 0.8125 
+0.65625 0.6875 0.84375 
+0.6875 0.71875 0.90625 
+0.53125 0.8125 0.84375 
+0.53125 0.8125 0.96875 
+0.53125 0.84375 0.9375 
+0.5625 0.84375 0.90625 
+0.53125 0.9375 0.96875 
+0.5625 0.90625 0.96875 
+0.59375 0.90625 0.9375 
+0.65625 0.9375 0.96875 
+0.5625 0.78125 0.84375 
+0.5625 0.78125 0.96875 
+0.59375 0.78125 0.9375 
+0.59375 0.8125 0.90625 
+0.6875 0.78125 0.96875 
+0.65625 0.8125 0.96875 
+0.65625 0.84375 0.9375 
+0.6875 0.90625 0.96875 
+0.59375 0.78125 0.8125 
+0.71875 0.78125 0.8125 
+0.6875 0.78125 0.84375 
+0.65625 0.8125 0.84375 
+0.71875 0.78125 0.9375 
+0.71875 0.8125 0.90625 
+0.6875 0.84375 0.90625 
+0.71875 0.90625 0.9375 
+0.78125 0.8125 0.84375 
+0.78125 0.8125 0.96875 
+0.78125 0.84375 0.9375 
+0.8125 0.84375 0.90625 
+0.78125 0.9375 0.96875 
+0.8125 0.90625 0.96875 
+0.84375 0.90625 0.9375 
+0.90625 0.9375 0.96875 
+0.390625 0.3125 0.21875 
+0.421875 0.3125 0.21875 
+0.390625 0.34375 0.1875 
+0.421875 0.34375 0.1875 
+0.421875 0.40625 0.21875 
+0.453125 0.40625 0.21875 
+0.34375 0.3125 0.265625 
+0.34375 0.3125 0.296875 
+0.46875 0.3125 0.265625 
+0.46875 0.3125 0.296875 
+0.40625 0.34375 0.265625 
+0.453125 0.34375 0.265625 
+0.4375 0.34375 0.28125 
+0.453125 0.34375 0.3125 
+0.390625 0.34375 0.28125 
+0.390625 0.34375 0.328125 
+0.40625 0.34375 0.3125 
+0.4375 0.34375 0.328125 
+0.4375 0.421875 0.265625 
+0.484375 0.46875 0.3125 
+0.484375 0.421875 0.265625 
+0.46875 0.4375 0.28125 
+0.421875 0.390625 0.28125 
+0.484375 0.390625 0.28125 
+0.46875 0.390625 0.296875 
+0.453125 0.40625 0.296875 
+0.484375 0.390625 0.34375 
+0.484375 0.40625 0.328125 
+0.46875 0.421875 0.328125 
+0.40625 0.390625 0.296875 
+0.40625 0.390625 0.359375 
+0.421875 0.390625 0.34375 
+0.421875 0.40625 0.328125 
+0.46875 0.390625 0.359375 
+0.453125 0.40625 0.359375 
+0.453125 0.421875 0.34375 
+0.421875 0.40625 0.390625 
+0.453125 0.421875 0.40625 
+0.390625 0.21875 0.3125 
+0.421875 0.21875 0.3125 
+0.390625 0.1875 0.34375 
+0.421875 0.1875 0.34375 
+0.421875 0.21875 0.40625 
+0.453125 0.21875 0.40625 
+0.34375 0.265625 0.3125 
+0.34375 0.296875 0.3125 
+0.46875 0.265625 0.3125 
+0.46875 0.296875 0.3125 
+0.40625 0.265625 0.34375 
+0.453125 0.265625 0.34375 
+0.4375 0.28125 0.34375 
+0.453125 0.3125 0.34375 
+0.390625 0.28125 0.34375 
+0.390625 0.328125 0.34375 
+0.40625 0.3125 0.34375 
+0.4375 0.328125 0.34375 
+0.4375 0.265625 0.421875 
+0.484375 0.3125 0.46875 
+0.484375 0.265625 0.421875 
+0.46875 0.28125 0.4375 
+0.421875 0.28125 0.390625 
+0.484375 0.28125 0.390625 
+0.46875 0.296875 0.390625 
+0.453125 0.296875 0.40625 
+0.484375 0.34375 0.390625 
+0.484375 0.328125 0.40625 
+0.46875 0.328125 0.421875 
+0.40625 0.296875 0.390625 
+0.40625 0.359375 0.390625 
+0.421875 0.34375 0.390625 
+0.421875 0.328125 0.40625 
+0.46875 0.359375 0.390625 
+0.453125 0.359375 0.40625 
+0.453125 0.34375 0.421875 
+0.421875 0.390625 0.40625 
+0.453125 0.40625 0.421875 
+0.3125 0.390625 0.21875 
+0.3125 0.421875 0.21875 
+0.34375 0.390625 0.1875 
+0.34375 0.421875 0.1875 
+0.40625 0.421875 0.21875 
+0.40625 0.453125 0.21875 
+0.3125 0.34375 0.265625 
+0.3125 0.34375 0.296875 
+0.3125 0.46875 0.265625 
+0.3125 0.46875 0.296875 
+0.34375 0.40625 0.265625 
+0.34375 0.453125 0.265625 
+0.34375 0.4375 0.28125 
+0.34375 0.453125 0.3125 
+0.34375 0.390625 0.28125 
+0.34375 0.390625 0.328125 
+0.34375 0.40625 0.3125 
+0.34375 0.4375 0.328125 
+0.421875 0.4375 0.265625 
+0.46875 0.484375 0.3125 
+0.421875 0.484375 0.265625 
+0.4375 0.46875 0.28125 
+0.390625 0.421875 0.28125 
+0.390625 0.484375 0.28125 
+0.390625 0.46875 0.296875 
+0.40625 0.453125 0.296875 
+0.390625 0.484375 0.34375 
+0.40625 0.484375 0.328125 
+0.421875 0.46875 0.328125 
+0.390625 0.40625 0.296875 
+0.390625 0.40625 0.359375 
+0.390625 0.421875 0.34375 
+0.40625 0.421875 0.328125 
+0.390625 0.46875 0.359375 
+0.40625 0.453125 0.359375 
+0.421875 0.453125 0.34375 
+0.40625 0.421875 0.390625 
+0.421875 0.453125 0.40625 
+0.21875 0.390625 0.3125 
+0.21875 0.421875 0.3125 
+0.1875 0.390625 0.34375 
+0.1875 0.421875 0.34375 
+0.21875 0.421875 0.40625 
+0.21875 0.453125 0.40625 
+0.265625 0.34375 0.3125 
+0.296875 0.34375 0.3125 
+0.265625 0.46875 0.3125 
+0.296875 0.46875 0.3125 
+0.265625 0.40625 0.34375 
+0.265625 0.453125 0.34375 
+0.28125 0.4375 0.34375 
+0.3125 0.453125 0.34375 
+0.28125 0.390625 0.34375 
+0.328125 0.390625 0.34375 
+0.3125 0.40625 0.34375 
+0.328125 0.4375 0.34375 
+0.265625 0.4375 0.421875 
+0.3125 0.484375 0.46875 
+0.265625 0.484375 0.421875 
+0.28125 0.46875 0.4375 
+0.28125 0.421875 0.390625 
+0.28125 0.484375 0.390625 
+0.296875 0.46875 0.390625 
+0.296875 0.453125 0.40625 
+0.34375 0.484375 0.390625 
+0.328125 0.484375 0.40625 
+0.328125 0.46875 0.421875 
+0.296875 0.40625 0.390625 
+0.359375 0.40625 0.390625 
+0.34375 0.421875 0.390625 
+0.328125 0.421875 0.40625 
+0.359375 0.46875 0.390625 
+0.359375 0.453125 0.40625 
+0.34375 0.453125 0.421875 
+0.390625 0.421875 0.40625 
+0.40625 0.453125 0.421875 
+0.3125 0.21875 0.390625 
+0.3125 0.21875 0.421875 
+0.34375 0.1875 0.390625 
+0.34375 0.1875 0.421875 
+0.40625 0.21875 0.421875 
+0.40625 0.21875 0.453125 
+0.3125 0.265625 0.34375 
+0.3125 0.296875 0.34375 
+0.3125 0.265625 0.46875 
+0.3125 0.296875 0.46875 
+0.34375 0.265625 0.40625 
+0.34375 0.265625 0.453125 
+0.34375 0.28125 0.4375 
+0.34375 0.3125 0.453125 
+0.34375 0.28125 0.390625 
+0.34375 0.328125 0.390625 
+0.34375 0.3125 0.40625 
+0.34375 0.328125 0.4375 
+0.421875 0.265625 0.4375 
+0.46875 0.3125 0.484375 
+0.421875 0.265625 0.484375 
+0.4375 0.28125 0.46875 
+0.390625 0.28125 0.421875 
+0.390625 0.28125 0.484375 
+0.390625 0.296875 0.46875 
+0.40625 0.296875 0.453125 
+0.390625 0.34375 0.484375 
+0.40625 0.328125 0.484375 
+0.421875 0.328125 0.46875 
+0.390625 0.296875 0.40625 
+0.390625 0.359375 0.40625 
+0.390625 0.34375 0.421875 
+0.40625 0.328125 0.421875 
+0.390625 0.359375 0.46875 
+0.40625 0.359375 0.453125 
+0.421875 0.34375 0.453125 
+0.40625 0.390625 0.421875 
+0.421875 0.40625 0.453125 
+0.21875 0.3125 0.390625 
+0.21875 0.3125 0.421875 
+0.1875 0.34375 0.390625 
+0.1875 0.34375 0.421875 
+0.21875 0.40625 0.421875 
+0.21875 0.40625 0.453125 
+0.265625 0.3125 0.34375 
+0.296875 0.3125 0.34375 
+0.265625 0.3125 0.46875 
+0.296875 0.3125 0.46875 
+0.265625 0.34375 0.40625 
+0.265625 0.34375 0.453125 
+0.28125 0.34375 0.4375 
+0.3125 0.34375 0.453125 
+0.28125 0.34375 0.390625 
+0.328125 0.34375 0.390625 
+0.3125 0.34375 0.40625 
+0.328125 0.34375 0.4375 
+0.265625 0.421875 0.4375 
+0.3125 0.46875 0.484375 
+0.265625 0.421875 0.484375 
+0.28125 0.4375 0.46875 
+0.28125 0.390625 0.421875 
+0.28125 0.390625 0.484375 
+0.296875 0.390625 0.46875 
+0.296875 0.40625 0.453125 
+0.34375 0.390625 0.484375 
+0.328125 0.40625 0.484375 
+0.328125 0.421875 0.46875 
+0.296875 0.390625 0.40625 
+0.359375 0.390625 0.40625 
+0.34375 0.390625 0.421875 
+0.328125 0.40625 0.421875 
+0.359375 0.390625 0.46875 
+0.359375 0.40625 0.453125 
+0.34375 0.421875 0.453125 
+0.390625 0.40625 0.421875 
+0.40625 0.421875 0.453125 
+0.53125 0.34375 0.296875 
+0.515625 0.34375 0.328125 
+0.546875 0.34375 0.328125 
+0.515625 0.4375 0.28125 
+0.515625 0.484375 0.328125 
+0.53125 0.46875 0.3125 
+0.5625 0.484375 0.328125 
+0.515625 0.40625 0.296875 
+0.515625 0.40625 0.359375 
+0.515625 0.421875 0.34375 
+0.53125 0.421875 0.328125 
+0.53125 0.453125 0.359375 
+0.546875 0.453125 0.34375 
+0.578125 0.46875 0.359375 
+0.53125 0.390625 0.359375 
+0.59375 0.453125 0.359375 
+0.546875 0.390625 0.3125 
+0.578125 0.40625 0.34375 
+0.578125 0.390625 0.359375 
+0.5625 0.40625 0.359375 
+0.5625 0.421875 0.34375 
+0.59375 0.484375 0.390625 
+0.578125 0.484375 0.40625 
+0.546875 0.40625 0.390625 
+0.609375 0.40625 0.390625 
+0.59375 0.421875 0.390625 
+0.578125 0.421875 0.40625 
+0.609375 0.46875 0.390625 
+0.609375 0.453125 0.40625 
+0.59375 0.453125 0.421875 
+0.65625 0.4375 0.421875 
+0.65625 0.484375 0.421875 
+0.65625 0.46875 0.4375 
+0.65625 0.484375 0.46875 
+0.546875 0.453125 0.265625 
+0.578125 0.484375 0.296875 
+0.578125 0.421875 0.265625 
+0.609375 0.453125 0.296875 
+0.578125 0.390625 0.296875 
+0.609375 0.40625 0.328125 
+0.609375 0.4375 0.328125 
+0.65625 0.421875 0.34375 
+0.65625 0.453125 0.34375 
+0.6875 0.453125 0.40625 
+0.6875 0.484375 0.40625 
+0.53125 0.296875 0.34375 
+0.515625 0.328125 0.34375 
+0.546875 0.328125 0.34375 
+0.515625 0.28125 0.4375 
+0.515625 0.328125 0.484375 
+0.53125 0.3125 0.46875 
+0.5625 0.328125 0.484375 
+0.515625 0.296875 0.40625 
+0.515625 0.359375 0.40625 
+0.515625 0.34375 0.421875 
+0.53125 0.328125 0.421875 
+0.53125 0.359375 0.453125 
+0.546875 0.34375 0.453125 
+0.578125 0.359375 0.46875 
+0.53125 0.359375 0.390625 
+0.59375 0.359375 0.453125 
+0.546875 0.3125 0.390625 
+0.578125 0.34375 0.40625 
+0.578125 0.359375 0.390625 
+0.5625 0.359375 0.40625 
+0.5625 0.34375 0.421875 
+0.59375 0.390625 0.484375 
+0.578125 0.40625 0.484375 
+0.546875 0.390625 0.40625 
+0.609375 0.390625 0.40625 
+0.59375 0.390625 0.421875 
+0.578125 0.40625 0.421875 
+0.609375 0.390625 0.46875 
+0.609375 0.40625 0.453125 
+0.59375 0.421875 0.453125 
+0.65625 0.421875 0.4375 
+0.65625 0.421875 0.484375 
+0.65625 0.4375 0.46875 
+0.65625 0.46875 0.484375 
+0.546875 0.265625 0.453125 
+0.578125 0.296875 0.484375 
+0.578125 0.265625 0.421875 
+0.609375 0.296875 0.453125 
+0.578125 0.296875 0.390625 
+0.609375 0.328125 0.40625 
+0.609375 0.328125 0.4375 
+0.65625 0.34375 0.421875 
+0.65625 0.34375 0.453125 
+0.6875 0.40625 0.453125 
+0.6875 0.40625 0.484375 
+0.34375 0.53125 0.296875 
+0.34375 0.515625 0.328125 
+0.34375 0.546875 0.328125 
+0.4375 0.515625 0.28125 
+0.484375 0.515625 0.328125 
+0.46875 0.53125 0.3125 
+0.484375 0.5625 0.328125 
+0.40625 0.515625 0.296875 
+0.40625 0.515625 0.359375 
+0.421875 0.515625 0.34375 
+0.421875 0.53125 0.328125 
+0.453125 0.53125 0.359375 
+0.453125 0.546875 0.34375 
+0.46875 0.578125 0.359375 
+0.390625 0.53125 0.359375 
+0.453125 0.59375 0.359375 
+0.390625 0.546875 0.3125 
+0.40625 0.578125 0.34375 
+0.390625 0.578125 0.359375 
+0.40625 0.5625 0.359375 
+0.421875 0.5625 0.34375 
+0.484375 0.59375 0.390625 
+0.484375 0.578125 0.40625 
+0.40625 0.546875 0.390625 
+0.40625 0.609375 0.390625 
+0.421875 0.59375 0.390625 
+0.421875 0.578125 0.40625 
+0.46875 0.609375 0.390625 
+0.453125 0.609375 0.40625 
+0.453125 0.59375 0.421875 
+0.4375 0.65625 0.421875 
+0.484375 0.65625 0.421875 
+0.46875 0.65625 0.4375 
+0.484375 0.65625 0.46875 
+0.453125 0.546875 0.265625 
+0.484375 0.578125 0.296875 
+0.421875 0.578125 0.265625 
+0.453125 0.609375 0.296875 
+0.390625 0.578125 0.296875 
+0.40625 0.609375 0.328125 
+0.4375 0.609375 0.328125 
+0.421875 0.65625 0.34375 
+0.453125 0.65625 0.34375 
+0.453125 0.6875 0.40625 
+0.484375 0.6875 0.40625 
+0.296875 0.53125 0.34375 
+0.328125 0.515625 0.34375 
+0.328125 0.546875 0.34375 
+0.28125 0.515625 0.4375 
+0.328125 0.515625 0.484375 
+0.3125 0.53125 0.46875 
+0.328125 0.5625 0.484375 
+0.296875 0.515625 0.40625 
+0.359375 0.515625 0.40625 
+0.34375 0.515625 0.421875 
+0.328125 0.53125 0.421875 
+0.359375 0.53125 0.453125 
+0.34375 0.546875 0.453125 
+0.359375 0.578125 0.46875 
+0.359375 0.53125 0.390625 
+0.359375 0.59375 0.453125 
+0.3125 0.546875 0.390625 
+0.34375 0.578125 0.40625 
+0.359375 0.578125 0.390625 
+0.359375 0.5625 0.40625 
+0.34375 0.5625 0.421875 
+0.390625 0.59375 0.484375 
+0.40625 0.578125 0.484375 
+0.390625 0.546875 0.40625 
+0.390625 0.609375 0.40625 
+0.390625 0.59375 0.421875 
+0.40625 0.578125 0.421875 
+0.390625 0.609375 0.46875 
+0.40625 0.609375 0.453125 
+0.421875 0.59375 0.453125 
+0.421875 0.65625 0.4375 
+0.421875 0.65625 0.484375 
+0.4375 0.65625 0.46875 
+0.46875 0.65625 0.484375 
+0.265625 0.546875 0.453125 
+0.296875 0.578125 0.484375 
+0.265625 0.578125 0.421875 
+0.296875 0.609375 0.453125 
+0.296875 0.578125 0.390625 
+0.328125 0.609375 0.40625 
+0.328125 0.609375 0.4375 
+0.34375 0.65625 0.421875 
+0.34375 0.65625 0.453125 
+0.40625 0.6875 0.453125 
+0.40625 0.6875 0.484375 
+0.53125 0.515625 0.34375 
+0.578125 0.515625 0.34375 
+0.5625 0.53125 0.34375 
+0.578125 0.5625 0.34375 
+0.609375 0.515625 0.40625 
+0.59375 0.515625 0.421875 
+0.609375 0.53125 0.390625 
+0.59375 0.546875 0.390625 
+0.578125 0.546875 0.40625 
+0.609375 0.59375 0.390625 
+0.609375 0.578125 0.40625 
+0.59375 0.578125 0.421875 
+0.609375 0.59375 0.453125 
+0.671875 0.515625 0.4375 
+0.71875 0.5625 0.484375 
+0.671875 0.515625 0.484375 
+0.6875 0.53125 0.46875 
+0.640625 0.53125 0.421875 
+0.640625 0.546875 0.46875 
+0.65625 0.546875 0.453125 
+0.640625 0.59375 0.484375 
+0.65625 0.578125 0.484375 
+0.671875 0.578125 0.46875 
+0.703125 0.59375 0.484375 
+0.640625 0.546875 0.40625 
+0.640625 0.609375 0.46875 
+0.65625 0.609375 0.421875 
+0.640625 0.59375 0.4375 
+0.65625 0.578125 0.4375 
+0.671875 0.609375 0.453125 
+0.6875 0.59375 0.453125 
+0.6875 0.65625 0.453125 
+0.671875 0.65625 0.484375 
+0.703125 0.65625 0.484375 
+0.59375 0.515625 0.3125 
+0.59375 0.546875 0.3125 
+0.65625 0.546875 0.34375 
+0.65625 0.578125 0.34375 
+0.703125 0.515625 0.421875 
+0.734375 0.546875 0.453125 
+0.703125 0.546875 0.390625 
+0.734375 0.578125 0.421875 
+0.671875 0.5625 0.390625 
+0.6875 0.609375 0.40625 
+0.703125 0.59375 0.421875 
+0.515625 0.53125 0.34375 
+0.515625 0.578125 0.34375 
+0.53125 0.5625 0.34375 
+0.5625 0.578125 0.34375 
+0.515625 0.609375 0.40625 
+0.515625 0.59375 0.421875 
+0.53125 0.609375 0.390625 
+0.546875 0.59375 0.390625 
+0.546875 0.578125 0.40625 
+0.59375 0.609375 0.390625 
+0.578125 0.609375 0.40625 
+0.578125 0.59375 0.421875 
+0.59375 0.609375 0.453125 
+0.515625 0.671875 0.4375 
+0.5625 0.71875 0.484375 
+0.515625 0.671875 0.484375 
+0.53125 0.6875 0.46875 
+0.53125 0.640625 0.421875 
+0.546875 0.640625 0.46875 
+0.546875 0.65625 0.453125 
+0.59375 0.640625 0.484375 
+0.578125 0.65625 0.484375 
+0.578125 0.671875 0.46875 
+0.59375 0.703125 0.484375 
+0.546875 0.640625 0.40625 
+0.609375 0.640625 0.46875 
+0.609375 0.65625 0.421875 
+0.59375 0.640625 0.4375 
+0.578125 0.65625 0.4375 
+0.609375 0.671875 0.453125 
+0.59375 0.6875 0.453125 
+0.65625 0.6875 0.453125 
+0.65625 0.671875 0.484375 
+0.65625 0.703125 0.484375 
+0.515625 0.59375 0.3125 
+0.546875 0.59375 0.3125 
+0.546875 0.65625 0.34375 
+0.578125 0.65625 0.34375 
+0.515625 0.703125 0.421875 
+0.546875 0.734375 0.453125 
+0.546875 0.703125 0.390625 
+0.578125 0.734375 0.421875 
+0.5625 0.671875 0.390625 
+0.609375 0.6875 0.40625 
+0.59375 0.703125 0.421875 
+0.34375 0.296875 0.53125 
+0.34375 0.328125 0.515625 
+0.34375 0.328125 0.546875 
+0.4375 0.28125 0.515625 
+0.484375 0.328125 0.515625 
+0.46875 0.3125 0.53125 
+0.484375 0.328125 0.5625 
+0.40625 0.296875 0.515625 
+0.40625 0.359375 0.515625 
+0.421875 0.34375 0.515625 
+0.421875 0.328125 0.53125 
+0.453125 0.359375 0.53125 
+0.453125 0.34375 0.546875 
+0.46875 0.359375 0.578125 
+0.390625 0.359375 0.53125 
+0.453125 0.359375 0.59375 
+0.390625 0.3125 0.546875 
+0.40625 0.34375 0.578125 
+0.390625 0.359375 0.578125 
+0.40625 0.359375 0.5625 
+0.421875 0.34375 0.5625 
+0.484375 0.390625 0.59375 
+0.484375 0.40625 0.578125 
+0.40625 0.390625 0.546875 
+0.40625 0.390625 0.609375 
+0.421875 0.390625 0.59375 
+0.421875 0.40625 0.578125 
+0.46875 0.390625 0.609375 
+0.453125 0.40625 0.609375 
+0.453125 0.421875 0.59375 
+0.4375 0.421875 0.65625 
+0.484375 0.421875 0.65625 
+0.46875 0.4375 0.65625 
+0.484375 0.46875 0.65625 
+0.453125 0.265625 0.546875 
+0.484375 0.296875 0.578125 
+0.421875 0.265625 0.578125 
+0.453125 0.296875 0.609375 
+0.390625 0.296875 0.578125 
+0.40625 0.328125 0.609375 
+0.4375 0.328125 0.609375 
+0.421875 0.34375 0.65625 
+0.453125 0.34375 0.65625 
+0.453125 0.40625 0.6875 
+0.484375 0.40625 0.6875 
+0.296875 0.34375 0.53125 
+0.328125 0.34375 0.515625 
+0.328125 0.34375 0.546875 
+0.28125 0.4375 0.515625 
+0.328125 0.484375 0.515625 
+0.3125 0.46875 0.53125 
+0.328125 0.484375 0.5625 
+0.296875 0.40625 0.515625 
+0.359375 0.40625 0.515625 
+0.34375 0.421875 0.515625 
+0.328125 0.421875 0.53125 
+0.359375 0.453125 0.53125 
+0.34375 0.453125 0.546875 
+0.359375 0.46875 0.578125 
+0.359375 0.390625 0.53125 
+0.359375 0.453125 0.59375 
+0.3125 0.390625 0.546875 
+0.34375 0.40625 0.578125 
+0.359375 0.390625 0.578125 
+0.359375 0.40625 0.5625 
+0.34375 0.421875 0.5625 
+0.390625 0.484375 0.59375 
+0.40625 0.484375 0.578125 
+0.390625 0.40625 0.546875 
+0.390625 0.40625 0.609375 
+0.390625 0.421875 0.59375 
+0.40625 0.421875 0.578125 
+0.390625 0.46875 0.609375 
+0.40625 0.453125 0.609375 
+0.421875 0.453125 0.59375 
+0.421875 0.4375 0.65625 
+0.421875 0.484375 0.65625 
+0.4375 0.46875 0.65625 
+0.46875 0.484375 0.65625 
+0.265625 0.453125 0.546875 
+0.296875 0.484375 0.578125 
+0.265625 0.421875 0.578125 
+0.296875 0.453125 0.609375 
+0.296875 0.390625 0.578125 
+0.328125 0.40625 0.609375 
+0.328125 0.4375 0.609375 
+0.34375 0.421875 0.65625 
+0.34375 0.453125 0.65625 
+0.40625 0.453125 0.6875 
+0.40625 0.484375 0.6875 
+0.53125 0.34375 0.515625 
+0.578125 0.34375 0.515625 
+0.5625 0.34375 0.53125 
+0.578125 0.34375 0.5625 
+0.609375 0.40625 0.515625 
+0.59375 0.421875 0.515625 
+0.609375 0.390625 0.53125 
+0.59375 0.390625 0.546875 
+0.578125 0.40625 0.546875 
+0.609375 0.390625 0.59375 
+0.609375 0.40625 0.578125 
+0.59375 0.421875 0.578125 
+0.609375 0.453125 0.59375 
+0.671875 0.4375 0.515625 
+0.71875 0.484375 0.5625 
+0.671875 0.484375 0.515625 
+0.6875 0.46875 0.53125 
+0.640625 0.421875 0.53125 
+0.640625 0.46875 0.546875 
+0.65625 0.453125 0.546875 
+0.640625 0.484375 0.59375 
+0.65625 0.484375 0.578125 
+0.671875 0.46875 0.578125 
+0.703125 0.484375 0.59375 
+0.640625 0.40625 0.546875 
+0.640625 0.46875 0.609375 
+0.65625 0.421875 0.609375 
+0.640625 0.4375 0.59375 
+0.65625 0.4375 0.578125 
+0.671875 0.453125 0.609375 
+0.6875 0.453125 0.59375 
+0.6875 0.453125 0.65625 
+0.671875 0.484375 0.65625 
+0.703125 0.484375 0.65625 
+0.59375 0.3125 0.515625 
+0.59375 0.3125 0.546875 
+0.65625 0.34375 0.546875 
+0.65625 0.34375 0.578125 
+0.703125 0.421875 0.515625 
+0.734375 0.453125 0.546875 
+0.703125 0.390625 0.546875 
+0.734375 0.421875 0.578125 
+0.671875 0.390625 0.5625 
+0.6875 0.40625 0.609375 
+0.703125 0.421875 0.59375 
+0.515625 0.34375 0.53125 
+0.515625 0.34375 0.578125 
+0.53125 0.34375 0.5625 
+0.5625 0.34375 0.578125 
+0.515625 0.40625 0.609375 
+0.515625 0.421875 0.59375 
+0.53125 0.390625 0.609375 
+0.546875 0.390625 0.59375 
+0.546875 0.40625 0.578125 
+0.59375 0.390625 0.609375 
+0.578125 0.40625 0.609375 
+0.578125 0.421875 0.59375 
+0.59375 0.453125 0.609375 
+0.515625 0.4375 0.671875 
+0.5625 0.484375 0.71875 
+0.515625 0.484375 0.671875 
+0.53125 0.46875 0.6875 
+0.53125 0.421875 0.640625 
+0.546875 0.46875 0.640625 
+0.546875 0.453125 0.65625 
+0.59375 0.484375 0.640625 
+0.578125 0.484375 0.65625 
+0.578125 0.46875 0.671875 
+0.59375 0.484375 0.703125 
+0.546875 0.40625 0.640625 
+0.609375 0.46875 0.640625 
+0.609375 0.421875 0.65625 
+0.59375 0.4375 0.640625 
+0.578125 0.4375 0.65625 
+0.609375 0.453125 0.671875 
+0.59375 0.453125 0.6875 
+0.65625 0.453125 0.6875 
+0.65625 0.484375 0.671875 
+0.65625 0.484375 0.703125 
+0.515625 0.3125 0.59375 
+0.546875 0.3125 0.59375 
+0.546875 0.34375 0.65625 
+0.578125 0.34375 0.65625 
+0.515625 0.421875 0.703125 
+0.546875 0.453125 0.734375 
+0.546875 0.390625 0.703125 
+0.578125 0.421875 0.734375 
+0.5625 0.390625 0.671875 
+0.609375 0.40625 0.6875 
+0.59375 0.421875 0.703125 
+0.34375 0.53125 0.515625 
+0.34375 0.578125 0.515625 
+0.34375 0.5625 0.53125 
+0.34375 0.578125 0.5625 
+0.40625 0.609375 0.515625 
+0.421875 0.59375 0.515625 
+0.390625 0.609375 0.53125 
+0.390625 0.59375 0.546875 
+0.40625 0.578125 0.546875 
+0.390625 0.609375 0.59375 
+0.40625 0.609375 0.578125 
+0.421875 0.59375 0.578125 
+0.453125 0.609375 0.59375 
+0.4375 0.671875 0.515625 
+0.484375 0.71875 0.5625 
+0.484375 0.671875 0.515625 
+0.46875 0.6875 0.53125 
+0.421875 0.640625 0.53125 
+0.46875 0.640625 0.546875 
+0.453125 0.65625 0.546875 
+0.484375 0.640625 0.59375 
+0.484375 0.65625 0.578125 
+0.46875 0.671875 0.578125 
+0.484375 0.703125 0.59375 
+0.40625 0.640625 0.546875 
+0.46875 0.640625 0.609375 
+0.421875 0.65625 0.609375 
+0.4375 0.640625 0.59375 
+0.4375 0.65625 0.578125 
+0.453125 0.671875 0.609375 
+0.453125 0.6875 0.59375 
+0.453125 0.6875 0.65625 
+0.484375 0.671875 0.65625 
+0.484375 0.703125 0.65625 
+0.3125 0.59375 0.515625 
+0.3125 0.59375 0.546875 
+0.34375 0.65625 0.546875 
+0.34375 0.65625 0.578125 
+0.421875 0.703125 0.515625 
+0.453125 0.734375 0.546875 
+0.390625 0.703125 0.546875 
+0.421875 0.734375 0.578125 
+0.390625 0.671875 0.5625 
+0.40625 0.6875 0.609375 
+0.421875 0.703125 0.59375 
+0.34375 0.515625 0.53125 
+0.34375 0.515625 0.578125 
+0.34375 0.53125 0.5625 
+0.34375 0.5625 0.578125 
+0.40625 0.515625 0.609375 
+0.421875 0.515625 0.59375 
+0.390625 0.53125 0.609375 
+0.390625 0.546875 0.59375 
+0.40625 0.546875 0.578125 
+0.390625 0.59375 0.609375 
+0.40625 0.578125 0.609375 
+0.421875 0.578125 0.59375 
+0.453125 0.59375 0.609375 
+0.4375 0.515625 0.671875 
+0.484375 0.5625 0.71875 
+0.484375 0.515625 0.671875 
+0.46875 0.53125 0.6875 
+0.421875 0.53125 0.640625 
+0.46875 0.546875 0.640625 
+0.453125 0.546875 0.65625 
+0.484375 0.59375 0.640625 
+0.484375 0.578125 0.65625 
+0.46875 0.578125 0.671875 
+0.484375 0.59375 0.703125 
+0.40625 0.546875 0.640625 
+0.46875 0.609375 0.640625 
+0.421875 0.609375 0.65625 
+0.4375 0.59375 0.640625 
+0.4375 0.578125 0.65625 
+0.453125 0.609375 0.671875 
+0.453125 0.59375 0.6875 
+0.453125 0.65625 0.6875 
+0.484375 0.65625 0.671875 
+0.484375 0.65625 0.703125 
+0.3125 0.515625 0.59375 
+0.3125 0.546875 0.59375 
+0.34375 0.546875 0.65625 
+0.34375 0.578125 0.65625 
+0.421875 0.515625 0.703125 
+0.453125 0.546875 0.734375 
+0.390625 0.546875 0.703125 
+0.421875 0.578125 0.734375 
+0.390625 0.5625 0.671875 
+0.40625 0.609375 0.6875 
+0.421875 0.59375 0.703125 
+0.59375 0.578125 0.546875 
+0.609375 0.59375 0.578125 
+0.6875 0.53125 0.515625 
+0.734375 0.578125 0.515625 
+0.71875 0.5625 0.53125 
+0.734375 0.578125 0.5625 
+0.65625 0.609375 0.515625 
+0.671875 0.59375 0.515625 
+0.671875 0.578125 0.53125 
+0.71875 0.609375 0.515625 
+0.703125 0.609375 0.53125 
+0.703125 0.59375 0.546875 
+0.71875 0.609375 0.578125 
+0.640625 0.609375 0.53125 
+0.640625 0.59375 0.546875 
+0.65625 0.578125 0.546875 
+0.640625 0.609375 0.59375 
+0.65625 0.609375 0.578125 
+0.671875 0.59375 0.578125 
+0.703125 0.609375 0.59375 
+0.703125 0.6875 0.53125 
+0.734375 0.6875 0.53125 
+0.6875 0.65625 0.546875 
+0.734375 0.65625 0.546875 
+0.71875 0.65625 0.5625 
+0.734375 0.65625 0.59375 
+0.671875 0.65625 0.5625 
+0.671875 0.65625 0.609375 
+0.6875 0.65625 0.59375 
+0.71875 0.65625 0.609375 
+0.703125 0.6875 0.65625 
+0.734375 0.6875 0.65625 
+0.78125 0.59375 0.546875 
+0.78125 0.59375 0.578125 
+0.78125 0.6875 0.578125 
+0.78125 0.6875 0.609375 
+0.8125 0.65625 0.578125 
+0.8125 0.65625 0.609375 
+0.59375 0.546875 0.578125 
+0.609375 0.578125 0.59375 
+0.6875 0.515625 0.53125 
+0.734375 0.515625 0.578125 
+0.71875 0.53125 0.5625 
+0.734375 0.5625 0.578125 
+0.65625 0.515625 0.609375 
+0.671875 0.515625 0.59375 
+0.671875 0.53125 0.578125 
+0.71875 0.515625 0.609375 
+0.703125 0.53125 0.609375 
+0.703125 0.546875 0.59375 
+0.71875 0.578125 0.609375 
+0.640625 0.53125 0.609375 
+0.640625 0.546875 0.59375 
+0.65625 0.546875 0.578125 
+0.640625 0.59375 0.609375 
+0.65625 0.578125 0.609375 
+0.671875 0.578125 0.59375 
+0.703125 0.59375 0.609375 
+0.703125 0.53125 0.6875 
+0.734375 0.53125 0.6875 
+0.6875 0.546875 0.65625 
+0.734375 0.546875 0.65625 
+0.71875 0.5625 0.65625 
+0.734375 0.59375 0.65625 
+0.671875 0.5625 0.65625 
+0.671875 0.609375 0.65625 
+0.6875 0.59375 0.65625 
+0.71875 0.609375 0.65625 
+0.703125 0.65625 0.6875 
+0.734375 0.65625 0.6875 
+0.78125 0.546875 0.59375 
+0.78125 0.578125 0.59375 
+0.78125 0.578125 0.6875 
+0.78125 0.609375 0.6875 
+0.8125 0.578125 0.65625 
+0.8125 0.609375 0.65625 
+0.578125 0.59375 0.546875 
+0.59375 0.609375 0.578125 
+0.53125 0.6875 0.515625 
+0.578125 0.734375 0.515625 
+0.5625 0.71875 0.53125 
+0.578125 0.734375 0.5625 
+0.609375 0.65625 0.515625 
+0.59375 0.671875 0.515625 
+0.578125 0.671875 0.53125 
+0.609375 0.71875 0.515625 
+0.609375 0.703125 0.53125 
+0.59375 0.703125 0.546875 
+0.609375 0.71875 0.578125 
+0.609375 0.640625 0.53125 
+0.59375 0.640625 0.546875 
+0.578125 0.65625 0.546875 
+0.609375 0.640625 0.59375 
+0.609375 0.65625 0.578125 
+0.59375 0.671875 0.578125 
+0.609375 0.703125 0.59375 
+0.6875 0.703125 0.53125 
+0.6875 0.734375 0.53125 
+0.65625 0.6875 0.546875 
+0.65625 0.734375 0.546875 
+0.65625 0.71875 0.5625 
+0.65625 0.734375 0.59375 
+0.65625 0.671875 0.5625 
+0.65625 0.671875 0.609375 
+0.65625 0.6875 0.59375 
+0.65625 0.71875 0.609375 
+0.6875 0.703125 0.65625 
+0.6875 0.734375 0.65625 
+0.59375 0.78125 0.546875 
+0.59375 0.78125 0.578125 
+0.6875 0.78125 0.578125 
+0.6875 0.78125 0.609375 
+0.65625 0.8125 0.578125 
+0.65625 0.8125 0.609375 
+0.546875 0.59375 0.578125 
+0.578125 0.609375 0.59375 
+0.515625 0.6875 0.53125 
+0.515625 0.734375 0.578125 
+0.53125 0.71875 0.5625 
+0.5625 0.734375 0.578125 
+0.515625 0.65625 0.609375 
+0.515625 0.671875 0.59375 
+0.53125 0.671875 0.578125 
+0.515625 0.71875 0.609375 
+0.53125 0.703125 0.609375 
+0.546875 0.703125 0.59375 
+0.578125 0.71875 0.609375 
+0.53125 0.640625 0.609375 
+0.546875 0.640625 0.59375 
+0.546875 0.65625 0.578125 
+0.59375 0.640625 0.609375 
+0.578125 0.65625 0.609375 
+0.578125 0.671875 0.59375 
+0.59375 0.703125 0.609375 
+0.53125 0.703125 0.6875 
+0.53125 0.734375 0.6875 
+0.546875 0.6875 0.65625 
+0.546875 0.734375 0.65625 
+0.5625 0.71875 0.65625 
+0.59375 0.734375 0.65625 
+0.5625 0.671875 0.65625 
+0.609375 0.671875 0.65625 
+0.59375 0.6875 0.65625 
+0.609375 0.71875 0.65625 
+0.65625 0.703125 0.6875 
+0.65625 0.734375 0.6875 
+0.546875 0.78125 0.59375 
+0.578125 0.78125 0.59375 
+0.578125 0.78125 0.6875 
+0.609375 0.78125 0.6875 
+0.578125 0.8125 0.65625 
+0.609375 0.8125 0.65625 
+0.578125 0.546875 0.59375 
+0.59375 0.578125 0.609375 
+0.53125 0.515625 0.6875 
+0.578125 0.515625 0.734375 
+0.5625 0.53125 0.71875 
+0.578125 0.5625 0.734375 
+0.609375 0.515625 0.65625 
+0.59375 0.515625 0.671875 
+0.578125 0.53125 0.671875 
+0.609375 0.515625 0.71875 
+0.609375 0.53125 0.703125 
+0.59375 0.546875 0.703125 
+0.609375 0.578125 0.71875 
+0.609375 0.53125 0.640625 
+0.59375 0.546875 0.640625 
+0.578125 0.546875 0.65625 
+0.609375 0.59375 0.640625 
+0.609375 0.578125 0.65625 
+0.59375 0.578125 0.671875 
+0.609375 0.59375 0.703125 
+0.6875 0.53125 0.703125 
+0.6875 0.53125 0.734375 
+0.65625 0.546875 0.6875 
+0.65625 0.546875 0.734375 
+0.65625 0.5625 0.71875 
+0.65625 0.59375 0.734375 
+0.65625 0.5625 0.671875 
+0.65625 0.609375 0.671875 
+0.65625 0.59375 0.6875 
+0.65625 0.609375 0.71875 
+0.6875 0.65625 0.703125 
+0.6875 0.65625 0.734375 
+0.59375 0.546875 0.78125 
+0.59375 0.578125 0.78125 
+0.6875 0.578125 0.78125 
+0.6875 0.609375 0.78125 
+0.65625 0.578125 0.8125 
+0.65625 0.609375 0.8125 
+0.546875 0.578125 0.59375 
+0.578125 0.59375 0.609375 
+0.515625 0.53125 0.6875 
+0.515625 0.578125 0.734375 
+0.53125 0.5625 0.71875 
+0.5625 0.578125 0.734375 
+0.515625 0.609375 0.65625 
+0.515625 0.59375 0.671875 
+0.53125 0.578125 0.671875 
+0.515625 0.609375 0.71875 
+0.53125 0.609375 0.703125 
+0.546875 0.59375 0.703125 
+0.578125 0.609375 0.71875 
+0.53125 0.609375 0.640625 
+0.546875 0.59375 0.640625 
+0.546875 0.578125 0.65625 
+0.59375 0.609375 0.640625 
+0.578125 0.609375 0.65625 
+0.578125 0.59375 0.671875 
+0.59375 0.609375 0.703125 
+0.53125 0.6875 0.703125 
+0.53125 0.6875 0.734375 
+0.546875 0.65625 0.6875 
+0.546875 0.65625 0.734375 
+0.5625 0.65625 0.71875 
+0.59375 0.65625 0.734375 
+0.5625 0.65625 0.671875 
+0.609375 0.65625 0.671875 
+0.59375 0.65625 0.6875 
+0.609375 0.65625 0.71875 
+0.65625 0.6875 0.703125 
+0.65625 0.6875 0.734375 
+0.546875 0.59375 0.78125 
+0.578125 0.59375 0.78125 
+0.578125 0.6875 0.78125 
+0.609375 0.6875 0.78125 
+0.578125 0.65625 0.8125 
+0.609375 0.65625 0.8125 
+0.507812 0.421875 0.390625 
+0.507812 0.421875 0.414062 
+0.515625 0.421875 0.40625 
+0.53125 0.421875 0.414062 
+0.507812 0.460938 0.390625 
+0.507812 0.492188 0.390625 
+0.507812 0.484375 0.398438 
+0.515625 0.476562 0.398438 
+0.507812 0.492188 0.421875 
+0.515625 0.492188 0.414062 
+0.523438 0.484375 0.414062 
+0.539062 0.492188 0.421875 
+0.507812 0.453125 0.398438 
+0.507812 0.453125 0.429688 
+0.507812 0.460938 0.421875 
+0.515625 0.460938 0.414062 
+0.507812 0.484375 0.429688 
+0.515625 0.476562 0.429688 
+0.523438 0.476562 0.421875 
+0.539062 0.484375 0.429688 
+0.515625 0.445312 0.398438 
+0.515625 0.445312 0.429688 
+0.523438 0.445312 0.421875 
+0.523438 0.453125 0.414062 
+0.546875 0.445312 0.429688 
+0.539062 0.453125 0.429688 
+0.539062 0.460938 0.421875 
+0.546875 0.476562 0.429688 
+0.507812 0.460938 0.453125 
+0.507812 0.492188 0.453125 
+0.507812 0.484375 0.460938 
+0.515625 0.476562 0.460938 
+0.507812 0.492188 0.484375 
+0.515625 0.492188 0.476562 
+0.523438 0.484375 0.476562 
+0.539062 0.492188 0.484375 
+0.515625 0.460938 0.445312 
+0.515625 0.492188 0.445312 
+0.523438 0.484375 0.445312 
+0.523438 0.476562 0.453125 
+0.546875 0.492188 0.445312 
+0.539062 0.492188 0.453125 
+0.539062 0.484375 0.460938 
+0.546875 0.492188 0.476562 
+0.523438 0.453125 0.445312 
+0.554688 0.453125 0.445312 
+0.546875 0.460938 0.445312 
+0.539062 0.460938 0.453125 
+0.554688 0.484375 0.445312 
+0.554688 0.476562 0.453125 
+0.546875 0.476562 0.460938 
+0.554688 0.484375 0.476562 
+0.570312 0.460938 0.453125 
+0.570312 0.492188 0.453125 
+0.570312 0.484375 0.460938 
+0.578125 0.476562 0.460938 
+0.570312 0.492188 0.484375 
+0.578125 0.492188 0.476562 
+0.585938 0.484375 0.476562 
+0.601562 0.492188 0.484375 
+0.507812 0.390625 0.421875 
+0.507812 0.414062 0.421875 
+0.515625 0.40625 0.421875 
+0.53125 0.414062 0.421875 
+0.507812 0.390625 0.460938 
+0.507812 0.390625 0.492188 
+0.507812 0.398438 0.484375 
+0.515625 0.398438 0.476562 
+0.507812 0.421875 0.492188 
+0.515625 0.414062 0.492188 
+0.523438 0.414062 0.484375 
+0.539062 0.421875 0.492188 
+0.507812 0.398438 0.453125 
+0.507812 0.429688 0.453125 
+0.507812 0.421875 0.460938 
+0.515625 0.414062 0.460938 
+0.507812 0.429688 0.484375 
+0.515625 0.429688 0.476562 
+0.523438 0.421875 0.476562 
+0.539062 0.429688 0.484375 
+0.515625 0.398438 0.445312 
+0.515625 0.429688 0.445312 
+0.523438 0.421875 0.445312 
+0.523438 0.414062 0.453125 
+0.546875 0.429688 0.445312 
+0.539062 0.429688 0.453125 
+0.539062 0.421875 0.460938 
+0.546875 0.429688 0.476562 
+0.507812 0.453125 0.460938 
+0.507812 0.453125 0.492188 
+0.507812 0.460938 0.484375 
+0.515625 0.460938 0.476562 
+0.507812 0.484375 0.492188 
+0.515625 0.476562 0.492188 
+0.523438 0.476562 0.484375 
+0.539062 0.484375 0.492188 
+0.515625 0.445312 0.460938 
+0.515625 0.445312 0.492188 
+0.523438 0.445312 0.484375 
+0.523438 0.453125 0.476562 
+0.546875 0.445312 0.492188 
+0.539062 0.453125 0.492188 
+0.539062 0.460938 0.484375 
+0.546875 0.476562 0.492188 
+0.523438 0.445312 0.453125 
+0.554688 0.445312 0.453125 
+0.546875 0.445312 0.460938 
+0.539062 0.453125 0.460938 
+0.554688 0.445312 0.484375 
+0.554688 0.453125 0.476562 
+0.546875 0.460938 0.476562 
+0.554688 0.476562 0.484375 
+0.570312 0.453125 0.460938 
+0.570312 0.453125 0.492188 
+0.570312 0.460938 0.484375 
+0.578125 0.460938 0.476562 
+0.570312 0.484375 0.492188 
+0.578125 0.476562 0.492188 
+0.585938 0.476562 0.484375 
+0.601562 0.484375 0.492188 
+0.421875 0.507812 0.390625 
+0.421875 0.507812 0.414062 
+0.421875 0.515625 0.40625 
+0.421875 0.53125 0.414062 
+0.460938 0.507812 0.390625 
+0.492188 0.507812 0.390625 
+0.484375 0.507812 0.398438 
+0.476562 0.515625 0.398438 
+0.492188 0.507812 0.421875 
+0.492188 0.515625 0.414062 
+0.484375 0.523438 0.414062 
+0.492188 0.539062 0.421875 
+0.453125 0.507812 0.398438 
+0.453125 0.507812 0.429688 
+0.460938 0.507812 0.421875 
+0.460938 0.515625 0.414062 
+0.484375 0.507812 0.429688 
+0.476562 0.515625 0.429688 
+0.476562 0.523438 0.421875 
+0.484375 0.539062 0.429688 
+0.445312 0.515625 0.398438 
+0.445312 0.515625 0.429688 
+0.445312 0.523438 0.421875 
+0.453125 0.523438 0.414062 
+0.445312 0.546875 0.429688 
+0.453125 0.539062 0.429688 
+0.460938 0.539062 0.421875 
+0.476562 0.546875 0.429688 
+0.460938 0.507812 0.453125 
+0.492188 0.507812 0.453125 
+0.484375 0.507812 0.460938 
+0.476562 0.515625 0.460938 
+0.492188 0.507812 0.484375 
+0.492188 0.515625 0.476562 
+0.484375 0.523438 0.476562 
+0.492188 0.539062 0.484375 
+0.460938 0.515625 0.445312 
+0.492188 0.515625 0.445312 
+0.484375 0.523438 0.445312 
+0.476562 0.523438 0.453125 
+0.492188 0.546875 0.445312 
+0.492188 0.539062 0.453125 
+0.484375 0.539062 0.460938 
+0.492188 0.546875 0.476562 
+0.453125 0.523438 0.445312 
+0.453125 0.554688 0.445312 
+0.460938 0.546875 0.445312 
+0.460938 0.539062 0.453125 
+0.484375 0.554688 0.445312 
+0.476562 0.554688 0.453125 
+0.476562 0.546875 0.460938 
+0.484375 0.554688 0.476562 
+0.460938 0.570312 0.453125 
+0.492188 0.570312 0.453125 
+0.484375 0.570312 0.460938 
+0.476562 0.578125 0.460938 
+0.492188 0.570312 0.484375 
+0.492188 0.578125 0.476562 
+0.484375 0.585938 0.476562 
+0.492188 0.601562 0.484375 
+0.390625 0.507812 0.421875 
+0.414062 0.507812 0.421875 
+0.40625 0.515625 0.421875 
+0.414062 0.53125 0.421875 
+0.390625 0.507812 0.460938 
+0.390625 0.507812 0.492188 
+0.398438 0.507812 0.484375 
+0.398438 0.515625 0.476562 
+0.421875 0.507812 0.492188 
+0.414062 0.515625 0.492188 
+0.414062 0.523438 0.484375 
+0.421875 0.539062 0.492188 
+0.398438 0.507812 0.453125 
+0.429688 0.507812 0.453125 
+0.421875 0.507812 0.460938 
+0.414062 0.515625 0.460938 
+0.429688 0.507812 0.484375 
+0.429688 0.515625 0.476562 
+0.421875 0.523438 0.476562 
+0.429688 0.539062 0.484375 
+0.398438 0.515625 0.445312 
+0.429688 0.515625 0.445312 
+0.421875 0.523438 0.445312 
+0.414062 0.523438 0.453125 
+0.429688 0.546875 0.445312 
+0.429688 0.539062 0.453125 
+0.421875 0.539062 0.460938 
+0.429688 0.546875 0.476562 
+0.453125 0.507812 0.460938 
+0.453125 0.507812 0.492188 
+0.460938 0.507812 0.484375 
+0.460938 0.515625 0.476562 
+0.484375 0.507812 0.492188 
+0.476562 0.515625 0.492188 
+0.476562 0.523438 0.484375 
+0.484375 0.539062 0.492188 
+0.445312 0.515625 0.460938 
+0.445312 0.515625 0.492188 
+0.445312 0.523438 0.484375 
+0.453125 0.523438 0.476562 
+0.445312 0.546875 0.492188 
+0.453125 0.539062 0.492188 
+0.460938 0.539062 0.484375 
+0.476562 0.546875 0.492188 
+0.445312 0.523438 0.453125 
+0.445312 0.554688 0.453125 
+0.445312 0.546875 0.460938 
+0.453125 0.539062 0.460938 
+0.445312 0.554688 0.484375 
+0.453125 0.554688 0.476562 
+0.460938 0.546875 0.476562 
+0.476562 0.554688 0.484375 
+0.453125 0.570312 0.460938 
+0.453125 0.570312 0.492188 
+0.460938 0.570312 0.484375 
+0.460938 0.578125 0.476562 
+0.484375 0.570312 0.492188 
+0.476562 0.578125 0.492188 
+0.476562 0.585938 0.484375 
+0.484375 0.601562 0.492188 
+0.515625 0.507812 0.398438 
+0.515625 0.507812 0.429688 
+0.523438 0.507812 0.421875 
+0.523438 0.515625 0.414062 
+0.546875 0.507812 0.429688 
+0.539062 0.515625 0.429688 
+0.539062 0.523438 0.421875 
+0.546875 0.539062 0.429688 
+0.515625 0.507812 0.460938 
+0.515625 0.507812 0.492188 
+0.523438 0.507812 0.484375 
+0.523438 0.515625 0.476562 
+0.546875 0.507812 0.492188 
+0.539062 0.515625 0.492188 
+0.539062 0.523438 0.484375 
+0.546875 0.539062 0.492188 
+0.523438 0.507812 0.453125 
+0.554688 0.507812 0.453125 
+0.546875 0.507812 0.460938 
+0.539062 0.515625 0.460938 
+0.554688 0.507812 0.484375 
+0.554688 0.515625 0.476562 
+0.546875 0.523438 0.476562 
+0.554688 0.539062 0.484375 
+0.523438 0.515625 0.445312 
+0.554688 0.515625 0.445312 
+0.546875 0.523438 0.445312 
+0.539062 0.523438 0.453125 
+0.554688 0.546875 0.445312 
+0.554688 0.539062 0.453125 
+0.546875 0.539062 0.460938 
+0.554688 0.546875 0.476562 
+0.578125 0.507812 0.460938 
+0.578125 0.507812 0.492188 
+0.585938 0.507812 0.484375 
+0.585938 0.515625 0.476562 
+0.609375 0.507812 0.492188 
+0.601562 0.515625 0.492188 
+0.601562 0.523438 0.484375 
+0.609375 0.539062 0.492188 
+0.570312 0.515625 0.460938 
+0.570312 0.515625 0.492188 
+0.570312 0.523438 0.484375 
+0.578125 0.523438 0.476562 
+0.570312 0.546875 0.492188 
+0.578125 0.539062 0.492188 
+0.585938 0.539062 0.484375 
+0.601562 0.546875 0.492188 
+0.570312 0.523438 0.453125 
+0.570312 0.554688 0.453125 
+0.570312 0.546875 0.460938 
+0.578125 0.539062 0.460938 
+0.570312 0.554688 0.484375 
+0.578125 0.554688 0.476562 
+0.585938 0.546875 0.476562 
+0.601562 0.554688 0.484375 
+0.585938 0.578125 0.46875 
+0.585938 0.578125 0.492188 
+0.59375 0.578125 0.484375 
+0.609375 0.578125 0.492188 
+0.507812 0.515625 0.398438 
+0.507812 0.515625 0.429688 
+0.507812 0.523438 0.421875 
+0.515625 0.523438 0.414062 
+0.507812 0.546875 0.429688 
+0.515625 0.539062 0.429688 
+0.523438 0.539062 0.421875 
+0.539062 0.546875 0.429688 
+0.507812 0.515625 0.460938 
+0.507812 0.515625 0.492188 
+0.507812 0.523438 0.484375 
+0.515625 0.523438 0.476562 
+0.507812 0.546875 0.492188 
+0.515625 0.539062 0.492188 
+0.523438 0.539062 0.484375 
+0.539062 0.546875 0.492188 
+0.507812 0.523438 0.453125 
+0.507812 0.554688 0.453125 
+0.507812 0.546875 0.460938 
+0.515625 0.539062 0.460938 
+0.507812 0.554688 0.484375 
+0.515625 0.554688 0.476562 
+0.523438 0.546875 0.476562 
+0.539062 0.554688 0.484375 
+0.515625 0.523438 0.445312 
+0.515625 0.554688 0.445312 
+0.523438 0.546875 0.445312 
+0.523438 0.539062 0.453125 
+0.546875 0.554688 0.445312 
+0.539062 0.554688 0.453125 
+0.539062 0.546875 0.460938 
+0.546875 0.554688 0.476562 
+0.507812 0.578125 0.460938 
+0.507812 0.578125 0.492188 
+0.507812 0.585938 0.484375 
+0.515625 0.585938 0.476562 
+0.507812 0.609375 0.492188 
+0.515625 0.601562 0.492188 
+0.523438 0.601562 0.484375 
+0.539062 0.609375 0.492188 
+0.515625 0.570312 0.460938 
+0.515625 0.570312 0.492188 
+0.523438 0.570312 0.484375 
+0.523438 0.578125 0.476562 
+0.546875 0.570312 0.492188 
+0.539062 0.578125 0.492188 
+0.539062 0.585938 0.484375 
+0.546875 0.601562 0.492188 
+0.523438 0.570312 0.453125 
+0.554688 0.570312 0.453125 
+0.546875 0.570312 0.460938 
+0.539062 0.578125 0.460938 
+0.554688 0.570312 0.484375 
+0.554688 0.578125 0.476562 
+0.546875 0.585938 0.476562 
+0.554688 0.601562 0.484375 
+0.578125 0.585938 0.46875 
+0.578125 0.585938 0.492188 
+0.578125 0.59375 0.484375 
+0.578125 0.609375 0.492188 
+0.421875 0.390625 0.507812 
+0.421875 0.414062 0.507812 
+0.421875 0.40625 0.515625 
+0.421875 0.414062 0.53125 
+0.460938 0.390625 0.507812 
+0.492188 0.390625 0.507812 
+0.484375 0.398438 0.507812 
+0.476562 0.398438 0.515625 
+0.492188 0.421875 0.507812 
+0.492188 0.414062 0.515625 
+0.484375 0.414062 0.523438 
+0.492188 0.421875 0.539062 
+0.453125 0.398438 0.507812 
+0.453125 0.429688 0.507812 
+0.460938 0.421875 0.507812 
+0.460938 0.414062 0.515625 
+0.484375 0.429688 0.507812 
+0.476562 0.429688 0.515625 
+0.476562 0.421875 0.523438 
+0.484375 0.429688 0.539062 
+0.445312 0.398438 0.515625 
+0.445312 0.429688 0.515625 
+0.445312 0.421875 0.523438 
+0.453125 0.414062 0.523438 
+0.445312 0.429688 0.546875 
+0.453125 0.429688 0.539062 
+0.460938 0.421875 0.539062 
+0.476562 0.429688 0.546875 
+0.460938 0.453125 0.507812 
+0.492188 0.453125 0.507812 
+0.484375 0.460938 0.507812 
+0.476562 0.460938 0.515625 
+0.492188 0.484375 0.507812 
+0.492188 0.476562 0.515625 
+0.484375 0.476562 0.523438 
+0.492188 0.484375 0.539062 
+0.460938 0.445312 0.515625 
+0.492188 0.445312 0.515625 
+0.484375 0.445312 0.523438 
+0.476562 0.453125 0.523438 
+0.492188 0.445312 0.546875 
+0.492188 0.453125 0.539062 
+0.484375 0.460938 0.539062 
+0.492188 0.476562 0.546875 
+0.453125 0.445312 0.523438 
+0.453125 0.445312 0.554688 
+0.460938 0.445312 0.546875 
+0.460938 0.453125 0.539062 
+0.484375 0.445312 0.554688 
+0.476562 0.453125 0.554688 
+0.476562 0.460938 0.546875 
+0.484375 0.476562 0.554688 
+0.460938 0.453125 0.570312 
+0.492188 0.453125 0.570312 
+0.484375 0.460938 0.570312 
+0.476562 0.460938 0.578125 
+0.492188 0.484375 0.570312 
+0.492188 0.476562 0.578125 
+0.484375 0.476562 0.585938 
+0.492188 0.484375 0.601562 
+0.390625 0.421875 0.507812 
+0.414062 0.421875 0.507812 
+0.40625 0.421875 0.515625 
+0.414062 0.421875 0.53125 
+0.390625 0.460938 0.507812 
+0.390625 0.492188 0.507812 
+0.398438 0.484375 0.507812 
+0.398438 0.476562 0.515625 
+0.421875 0.492188 0.507812 
+0.414062 0.492188 0.515625 
+0.414062 0.484375 0.523438 
+0.421875 0.492188 0.539062 
+0.398438 0.453125 0.507812 
+0.429688 0.453125 0.507812 
+0.421875 0.460938 0.507812 
+0.414062 0.460938 0.515625 
+0.429688 0.484375 0.507812 
+0.429688 0.476562 0.515625 
+0.421875 0.476562 0.523438 
+0.429688 0.484375 0.539062 
+0.398438 0.445312 0.515625 
+0.429688 0.445312 0.515625 
+0.421875 0.445312 0.523438 
+0.414062 0.453125 0.523438 
+0.429688 0.445312 0.546875 
+0.429688 0.453125 0.539062 
+0.421875 0.460938 0.539062 
+0.429688 0.476562 0.546875 
+0.453125 0.460938 0.507812 
+0.453125 0.492188 0.507812 
+0.460938 0.484375 0.507812 
+0.460938 0.476562 0.515625 
+0.484375 0.492188 0.507812 
+0.476562 0.492188 0.515625 
+0.476562 0.484375 0.523438 
+0.484375 0.492188 0.539062 
+0.445312 0.460938 0.515625 
+0.445312 0.492188 0.515625 
+0.445312 0.484375 0.523438 
+0.453125 0.476562 0.523438 
+0.445312 0.492188 0.546875 
+0.453125 0.492188 0.539062 
+0.460938 0.484375 0.539062 
+0.476562 0.492188 0.546875 
+0.445312 0.453125 0.523438 
+0.445312 0.453125 0.554688 
+0.445312 0.460938 0.546875 
+0.453125 0.460938 0.539062 
+0.445312 0.484375 0.554688 
+0.453125 0.476562 0.554688 
+0.460938 0.476562 0.546875 
+0.476562 0.484375 0.554688 
+0.453125 0.460938 0.570312 
+0.453125 0.492188 0.570312 
+0.460938 0.484375 0.570312 
+0.460938 0.476562 0.578125 
+0.484375 0.492188 0.570312 
+0.476562 0.492188 0.578125 
+0.476562 0.484375 0.585938 
+0.484375 0.492188 0.601562 
+0.515625 0.398438 0.507812 
+0.515625 0.429688 0.507812 
+0.523438 0.421875 0.507812 
+0.523438 0.414062 0.515625 
+0.546875 0.429688 0.507812 
+0.539062 0.429688 0.515625 
+0.539062 0.421875 0.523438 
+0.546875 0.429688 0.539062 
+0.515625 0.460938 0.507812 
+0.515625 0.492188 0.507812 
+0.523438 0.484375 0.507812 
+0.523438 0.476562 0.515625 
+0.546875 0.492188 0.507812 
+0.539062 0.492188 0.515625 
+0.539062 0.484375 0.523438 
+0.546875 0.492188 0.539062 
+0.523438 0.453125 0.507812 
+0.554688 0.453125 0.507812 
+0.546875 0.460938 0.507812 
+0.539062 0.460938 0.515625 
+0.554688 0.484375 0.507812 
+0.554688 0.476562 0.515625 
+0.546875 0.476562 0.523438 
+0.554688 0.484375 0.539062 
+0.523438 0.445312 0.515625 
+0.554688 0.445312 0.515625 
+0.546875 0.445312 0.523438 
+0.539062 0.453125 0.523438 
+0.554688 0.445312 0.546875 
+0.554688 0.453125 0.539062 
+0.546875 0.460938 0.539062 
+0.554688 0.476562 0.546875 
+0.578125 0.460938 0.507812 
+0.578125 0.492188 0.507812 
+0.585938 0.484375 0.507812 
+0.585938 0.476562 0.515625 
+0.609375 0.492188 0.507812 
+0.601562 0.492188 0.515625 
+0.601562 0.484375 0.523438 
+0.609375 0.492188 0.539062 
+0.570312 0.460938 0.515625 
+0.570312 0.492188 0.515625 
+0.570312 0.484375 0.523438 
+0.578125 0.476562 0.523438 
+0.570312 0.492188 0.546875 
+0.578125 0.492188 0.539062 
+0.585938 0.484375 0.539062 
+0.601562 0.492188 0.546875 
+0.570312 0.453125 0.523438 
+0.570312 0.453125 0.554688 
+0.570312 0.460938 0.546875 
+0.578125 0.460938 0.539062 
+0.570312 0.484375 0.554688 
+0.578125 0.476562 0.554688 
+0.585938 0.476562 0.546875 
+0.601562 0.484375 0.554688 
+0.585938 0.46875 0.578125 
+0.585938 0.492188 0.578125 
+0.59375 0.484375 0.578125 
+0.609375 0.492188 0.578125 
+0.507812 0.398438 0.515625 
+0.507812 0.429688 0.515625 
+0.507812 0.421875 0.523438 
+0.515625 0.414062 0.523438 
+0.507812 0.429688 0.546875 
+0.515625 0.429688 0.539062 
+0.523438 0.421875 0.539062 
+0.539062 0.429688 0.546875 
+0.507812 0.460938 0.515625 
+0.507812 0.492188 0.515625 
+0.507812 0.484375 0.523438 
+0.515625 0.476562 0.523438 
+0.507812 0.492188 0.546875 
+0.515625 0.492188 0.539062 
+0.523438 0.484375 0.539062 
+0.539062 0.492188 0.546875 
+0.507812 0.453125 0.523438 
+0.507812 0.453125 0.554688 
+0.507812 0.460938 0.546875 
+0.515625 0.460938 0.539062 
+0.507812 0.484375 0.554688 
+0.515625 0.476562 0.554688 
+0.523438 0.476562 0.546875 
+0.539062 0.484375 0.554688 
+0.515625 0.445312 0.523438 
+0.515625 0.445312 0.554688 
+0.523438 0.445312 0.546875 
+0.523438 0.453125 0.539062 
+0.546875 0.445312 0.554688 
+0.539062 0.453125 0.554688 
+0.539062 0.460938 0.546875 
+0.546875 0.476562 0.554688 
+0.507812 0.460938 0.578125 
+0.507812 0.492188 0.578125 
+0.507812 0.484375 0.585938 
+0.515625 0.476562 0.585938 
+0.507812 0.492188 0.609375 
+0.515625 0.492188 0.601562 
+0.523438 0.484375 0.601562 
+0.539062 0.492188 0.609375 
+0.515625 0.460938 0.570312 
+0.515625 0.492188 0.570312 
+0.523438 0.484375 0.570312 
+0.523438 0.476562 0.578125 
+0.546875 0.492188 0.570312 
+0.539062 0.492188 0.578125 
+0.539062 0.484375 0.585938 
+0.546875 0.492188 0.601562 
+0.523438 0.453125 0.570312 
+0.554688 0.453125 0.570312 
+0.546875 0.460938 0.570312 
+0.539062 0.460938 0.578125 
+0.554688 0.484375 0.570312 
+0.554688 0.476562 0.578125 
+0.546875 0.476562 0.585938 
+0.554688 0.484375 0.601562 
+0.578125 0.46875 0.585938 
+0.578125 0.492188 0.585938 
+0.578125 0.484375 0.59375 
+0.578125 0.492188 0.609375 
+0.398438 0.515625 0.507812 
+0.429688 0.515625 0.507812 
+0.421875 0.523438 0.507812 
+0.414062 0.523438 0.515625 
+0.429688 0.546875 0.507812 
+0.429688 0.539062 0.515625 
+0.421875 0.539062 0.523438 
+0.429688 0.546875 0.539062 
+0.460938 0.515625 0.507812 
+0.492188 0.515625 0.507812 
+0.484375 0.523438 0.507812 
+0.476562 0.523438 0.515625 
+0.492188 0.546875 0.507812 
+0.492188 0.539062 0.515625 
+0.484375 0.539062 0.523438 
+0.492188 0.546875 0.539062 
+0.453125 0.523438 0.507812 
+0.453125 0.554688 0.507812 
+0.460938 0.546875 0.507812 
+0.460938 0.539062 0.515625 
+0.484375 0.554688 0.507812 
+0.476562 0.554688 0.515625 
+0.476562 0.546875 0.523438 
+0.484375 0.554688 0.539062 
+0.445312 0.523438 0.515625 
+0.445312 0.554688 0.515625 
+0.445312 0.546875 0.523438 
+0.453125 0.539062 0.523438 
+0.445312 0.554688 0.546875 
+0.453125 0.554688 0.539062 
+0.460938 0.546875 0.539062 
+0.476562 0.554688 0.546875 
+0.460938 0.578125 0.507812 
+0.492188 0.578125 0.507812 
+0.484375 0.585938 0.507812 
+0.476562 0.585938 0.515625 
+0.492188 0.609375 0.507812 
+0.492188 0.601562 0.515625 
+0.484375 0.601562 0.523438 
+0.492188 0.609375 0.539062 
+0.460938 0.570312 0.515625 
+0.492188 0.570312 0.515625 
+0.484375 0.570312 0.523438 
+0.476562 0.578125 0.523438 
+0.492188 0.570312 0.546875 
+0.492188 0.578125 0.539062 
+0.484375 0.585938 0.539062 
+0.492188 0.601562 0.546875 
+0.453125 0.570312 0.523438 
+0.453125 0.570312 0.554688 
+0.460938 0.570312 0.546875 
+0.460938 0.578125 0.539062 
+0.484375 0.570312 0.554688 
+0.476562 0.578125 0.554688 
+0.476562 0.585938 0.546875 
+0.484375 0.601562 0.554688 
+0.46875 0.585938 0.578125 
+0.492188 0.585938 0.578125 
+0.484375 0.59375 0.578125 
+0.492188 0.609375 0.578125 
+0.398438 0.507812 0.515625 
+0.429688 0.507812 0.515625 
+0.421875 0.507812 0.523438 
+0.414062 0.515625 0.523438 
+0.429688 0.507812 0.546875 
+0.429688 0.515625 0.539062 
+0.421875 0.523438 0.539062 
+0.429688 0.539062 0.546875 
+0.460938 0.507812 0.515625 
+0.492188 0.507812 0.515625 
+0.484375 0.507812 0.523438 
+0.476562 0.515625 0.523438 
+0.492188 0.507812 0.546875 
+0.492188 0.515625 0.539062 
+0.484375 0.523438 0.539062 
+0.492188 0.539062 0.546875 
+0.453125 0.507812 0.523438 
+0.453125 0.507812 0.554688 
+0.460938 0.507812 0.546875 
+0.460938 0.515625 0.539062 
+0.484375 0.507812 0.554688 
+0.476562 0.515625 0.554688 
+0.476562 0.523438 0.546875 
+0.484375 0.539062 0.554688 
+0.445312 0.515625 0.523438 
+0.445312 0.515625 0.554688 
+0.445312 0.523438 0.546875 
+0.453125 0.523438 0.539062 
+0.445312 0.546875 0.554688 
+0.453125 0.539062 0.554688 
+0.460938 0.539062 0.546875 
+0.476562 0.546875 0.554688 
+0.460938 0.507812 0.578125 
+0.492188 0.507812 0.578125 
+0.484375 0.507812 0.585938 
+0.476562 0.515625 0.585938 
+0.492188 0.507812 0.609375 
+0.492188 0.515625 0.601562 
+0.484375 0.523438 0.601562 
+0.492188 0.539062 0.609375 
+0.460938 0.515625 0.570312 
+0.492188 0.515625 0.570312 
+0.484375 0.523438 0.570312 
+0.476562 0.523438 0.578125 
+0.492188 0.546875 0.570312 
+0.492188 0.539062 0.578125 
+0.484375 0.539062 0.585938 
+0.492188 0.546875 0.601562 
+0.453125 0.523438 0.570312 
+0.453125 0.554688 0.570312 
+0.460938 0.546875 0.570312 
+0.460938 0.539062 0.578125 
+0.484375 0.554688 0.570312 
+0.476562 0.554688 0.578125 
+0.476562 0.546875 0.585938 
+0.484375 0.554688 0.601562 
+0.46875 0.578125 0.585938 
+0.492188 0.578125 0.585938 
+0.484375 0.578125 0.59375 
+0.492188 0.578125 0.609375 
+0.484375 0.445312 0.34375 
+0.484375 0.460938 0.34375 
+0.46875 0.445312 0.359375 
+0.46875 0.460938 0.359375 
+0.484375 0.40625 0.382812 
+0.484375 0.40625 0.398438 
+0.46875 0.421875 0.382812 
+0.46875 0.421875 0.398438 
+0.484375 0.453125 0.382812 
+0.484375 0.476562 0.382812 
+0.484375 0.46875 0.390625 
+0.484375 0.476562 0.40625 
+0.484375 0.445312 0.390625 
+0.484375 0.445312 0.414062 
+0.484375 0.453125 0.40625 
+0.484375 0.46875 0.414062 
+0.46875 0.445312 0.421875 
+0.46875 0.460938 0.421875 
+0.484375 0.453125 0.445312 
+0.484375 0.476562 0.445312 
+0.484375 0.46875 0.453125 
+0.484375 0.476562 0.46875 
+0.484375 0.34375 0.445312 
+0.484375 0.34375 0.460938 
+0.46875 0.359375 0.445312 
+0.46875 0.359375 0.460938 
+0.484375 0.382812 0.40625 
+0.484375 0.398438 0.40625 
+0.46875 0.382812 0.421875 
+0.46875 0.398438 0.421875 
+0.484375 0.382812 0.453125 
+0.484375 0.382812 0.476562 
+0.484375 0.390625 0.46875 
+0.484375 0.40625 0.476562 
+0.484375 0.390625 0.445312 
+0.484375 0.414062 0.445312 
+0.484375 0.40625 0.453125 
+0.484375 0.414062 0.46875 
+0.46875 0.421875 0.445312 
+0.46875 0.421875 0.460938 
+0.484375 0.445312 0.453125 
+0.484375 0.445312 0.476562 
+0.484375 0.453125 0.46875 
+0.484375 0.46875 0.476562 
+0.445312 0.484375 0.34375 
+0.460938 0.484375 0.34375 
+0.445312 0.46875 0.359375 
+0.460938 0.46875 0.359375 
+0.40625 0.484375 0.382812 
+0.40625 0.484375 0.398438 
+0.421875 0.46875 0.382812 
+0.421875 0.46875 0.398438 
+0.453125 0.484375 0.382812 
+0.476562 0.484375 0.382812 
+0.46875 0.484375 0.390625 
+0.476562 0.484375 0.40625 
+0.445312 0.484375 0.390625 
+0.445312 0.484375 0.414062 
+0.453125 0.484375 0.40625 
+0.46875 0.484375 0.414062 
+0.445312 0.46875 0.421875 
+0.460938 0.46875 0.421875 
+0.453125 0.484375 0.445312 
+0.476562 0.484375 0.445312 
+0.46875 0.484375 0.453125 
+0.476562 0.484375 0.46875 
+0.34375 0.484375 0.445312 
+0.34375 0.484375 0.460938 
+0.359375 0.46875 0.445312 
+0.359375 0.46875 0.460938 
+0.382812 0.484375 0.40625 
+0.398438 0.484375 0.40625 
+0.382812 0.46875 0.421875 
+0.398438 0.46875 0.421875 
+0.382812 0.484375 0.453125 
+0.382812 0.484375 0.476562 
+0.390625 0.484375 0.46875 
+0.40625 0.484375 0.476562 
+0.390625 0.484375 0.445312 
+0.414062 0.484375 0.445312 
+0.40625 0.484375 0.453125 
+0.414062 0.484375 0.46875 
+0.421875 0.46875 0.445312 
+0.421875 0.46875 0.460938 
+0.445312 0.484375 0.453125 
+0.445312 0.484375 0.476562 
+0.453125 0.484375 0.46875 
+0.46875 0.484375 0.476562 
+0.445312 0.34375 0.484375 
+0.460938 0.34375 0.484375 
+0.445312 0.359375 0.46875 
+0.460938 0.359375 0.46875 
+0.40625 0.382812 0.484375 
+0.40625 0.398438 0.484375 
+0.421875 0.382812 0.46875 
+0.421875 0.398438 0.46875 
+0.453125 0.382812 0.484375 
+0.476562 0.382812 0.484375 
+0.46875 0.390625 0.484375 
+0.476562 0.40625 0.484375 
+0.445312 0.390625 0.484375 
+0.445312 0.414062 0.484375 
+0.453125 0.40625 0.484375 
+0.46875 0.414062 0.484375 
+0.445312 0.421875 0.46875 
+0.460938 0.421875 0.46875 
+0.453125 0.445312 0.484375 
+0.476562 0.445312 0.484375 
+0.46875 0.453125 0.484375 
+0.476562 0.46875 0.484375 
+0.34375 0.445312 0.484375 
+0.34375 0.460938 0.484375 
+0.359375 0.445312 0.46875 
+0.359375 0.460938 0.46875 
+0.382812 0.40625 0.484375 
+0.398438 0.40625 0.484375 
+0.382812 0.421875 0.46875 
+0.398438 0.421875 0.46875 
+0.382812 0.453125 0.484375 
+0.382812 0.476562 0.484375 
+0.390625 0.46875 0.484375 
+0.40625 0.476562 0.484375 
+0.390625 0.445312 0.484375 
+0.414062 0.445312 0.484375 
+0.40625 0.453125 0.484375 
+0.414062 0.46875 0.484375 
+0.421875 0.445312 0.46875 
+0.421875 0.460938 0.46875 
+0.445312 0.453125 0.484375 
+0.445312 0.476562 0.484375 
+0.453125 0.46875 0.484375 
+0.46875 0.476562 0.484375 
+0.515625 0.460938 0.359375 
+0.515625 0.476562 0.359375 
+0.523438 0.421875 0.382812 
+0.539062 0.421875 0.398438 
+0.523438 0.46875 0.382812 
+0.546875 0.492188 0.40625 
+0.523438 0.492188 0.382812 
+0.53125 0.484375 0.390625 
+0.539062 0.460938 0.382812 
+0.554688 0.476562 0.398438 
+0.53125 0.445312 0.390625 
+0.554688 0.445312 0.414062 
+0.546875 0.453125 0.40625 
+0.554688 0.46875 0.414062 
+0.578125 0.460938 0.421875 
+0.578125 0.476562 0.421875 
+0.585938 0.46875 0.445312 
+0.609375 0.492188 0.46875 
+0.585938 0.492188 0.445312 
+0.59375 0.484375 0.453125 
+0.601562 0.460938 0.445312 
+0.617188 0.476562 0.460938 
+0.515625 0.359375 0.460938 
+0.515625 0.359375 0.476562 
+0.523438 0.382812 0.421875 
+0.539062 0.398438 0.421875 
+0.523438 0.382812 0.46875 
+0.546875 0.40625 0.492188 
+0.523438 0.382812 0.492188 
+0.53125 0.390625 0.484375 
+0.539062 0.382812 0.460938 
+0.554688 0.398438 0.476562 
+0.53125 0.390625 0.445312 
+0.554688 0.414062 0.445312 
+0.546875 0.40625 0.453125 
+0.554688 0.414062 0.46875 
+0.578125 0.421875 0.460938 
+0.578125 0.421875 0.476562 
+0.585938 0.445312 0.46875 
+0.609375 0.46875 0.492188 
+0.585938 0.445312 0.492188 
+0.59375 0.453125 0.484375 
+0.601562 0.445312 0.460938 
+0.617188 0.460938 0.476562 
+0.460938 0.515625 0.359375 
+0.476562 0.515625 0.359375 
+0.421875 0.523438 0.382812 
+0.421875 0.539062 0.398438 
+0.46875 0.523438 0.382812 
+0.492188 0.546875 0.40625 
+0.492188 0.523438 0.382812 
+0.484375 0.53125 0.390625 
+0.460938 0.539062 0.382812 
+0.476562 0.554688 0.398438 
+0.445312 0.53125 0.390625 
+0.445312 0.554688 0.414062 
+0.453125 0.546875 0.40625 
+0.46875 0.554688 0.414062 
+0.460938 0.578125 0.421875 
+0.476562 0.578125 0.421875 
+0.46875 0.585938 0.445312 
+0.492188 0.609375 0.46875 
+0.492188 0.585938 0.445312 
+0.484375 0.59375 0.453125 
+0.460938 0.601562 0.445312 
+0.476562 0.617188 0.460938 
+0.359375 0.515625 0.460938 
+0.359375 0.515625 0.476562 
+0.382812 0.523438 0.421875 
+0.398438 0.539062 0.421875 
+0.382812 0.523438 0.46875 
+0.40625 0.546875 0.492188 
+0.382812 0.523438 0.492188 
+0.390625 0.53125 0.484375 
+0.382812 0.539062 0.460938 
+0.398438 0.554688 0.476562 
+0.390625 0.53125 0.445312 
+0.414062 0.554688 0.445312 
+0.40625 0.546875 0.453125 
+0.414062 0.554688 0.46875 
+0.421875 0.578125 0.460938 
+0.421875 0.578125 0.476562 
+0.445312 0.585938 0.46875 
+0.46875 0.609375 0.492188 
+0.445312 0.585938 0.492188 
+0.453125 0.59375 0.484375 
+0.445312 0.601562 0.460938 
+0.460938 0.617188 0.476562 
+0.53125 0.507812 0.390625 
+0.554688 0.507812 0.414062 
+0.546875 0.515625 0.40625 
+0.554688 0.53125 0.414062 
+0.578125 0.523438 0.421875 
+0.578125 0.539062 0.421875 
+0.59375 0.507812 0.453125 
+0.617188 0.507812 0.476562 
+0.609375 0.515625 0.46875 
+0.617188 0.53125 0.476562 
+0.601562 0.523438 0.445312 
+0.617188 0.539062 0.460938 
+0.585938 0.53125 0.445312 
+0.609375 0.554688 0.46875 
+0.585938 0.554688 0.445312 
+0.59375 0.546875 0.453125 
+0.601562 0.578125 0.460938 
+0.617188 0.578125 0.476562 
+0.539062 0.523438 0.382812 
+0.554688 0.539062 0.398438 
+0.640625 0.523438 0.484375 
+0.640625 0.539062 0.484375 
+0.507812 0.53125 0.390625 
+0.507812 0.554688 0.414062 
+0.515625 0.546875 0.40625 
+0.53125 0.554688 0.414062 
+0.523438 0.578125 0.421875 
+0.539062 0.578125 0.421875 
+0.507812 0.59375 0.453125 
+0.507812 0.617188 0.476562 
+0.515625 0.609375 0.46875 
+0.53125 0.617188 0.476562 
+0.523438 0.601562 0.445312 
+0.539062 0.617188 0.460938 
+0.53125 0.585938 0.445312 
+0.554688 0.609375 0.46875 
+0.554688 0.585938 0.445312 
+0.546875 0.59375 0.453125 
+0.578125 0.601562 0.460938 
+0.578125 0.617188 0.476562 
+0.523438 0.539062 0.382812 
+0.539062 0.554688 0.398438 
+0.523438 0.640625 0.484375 
+0.539062 0.640625 0.484375 
+0.460938 0.359375 0.515625 
+0.476562 0.359375 0.515625 
+0.421875 0.382812 0.523438 
+0.421875 0.398438 0.539062 
+0.46875 0.382812 0.523438 
+0.492188 0.40625 0.546875 
+0.492188 0.382812 0.523438 
+0.484375 0.390625 0.53125 
+0.460938 0.382812 0.539062 
+0.476562 0.398438 0.554688 
+0.445312 0.390625 0.53125 
+0.445312 0.414062 0.554688 
+0.453125 0.40625 0.546875 
+0.46875 0.414062 0.554688 
+0.460938 0.421875 0.578125 
+0.476562 0.421875 0.578125 
+0.46875 0.445312 0.585938 
+0.492188 0.46875 0.609375 
+0.492188 0.445312 0.585938 
+0.484375 0.453125 0.59375 
+0.460938 0.445312 0.601562 
+0.476562 0.460938 0.617188 
+0.359375 0.460938 0.515625 
+0.359375 0.476562 0.515625 
+0.382812 0.421875 0.523438 
+0.398438 0.421875 0.539062 
+0.382812 0.46875 0.523438 
+0.40625 0.492188 0.546875 
+0.382812 0.492188 0.523438 
+0.390625 0.484375 0.53125 
+0.382812 0.460938 0.539062 
+0.398438 0.476562 0.554688 
+0.390625 0.445312 0.53125 
+0.414062 0.445312 0.554688 
+0.40625 0.453125 0.546875 
+0.414062 0.46875 0.554688 
+0.421875 0.460938 0.578125 
+0.421875 0.476562 0.578125 
+0.445312 0.46875 0.585938 
+0.46875 0.492188 0.609375 
+0.445312 0.492188 0.585938 
+0.453125 0.484375 0.59375 
+0.445312 0.460938 0.601562 
+0.460938 0.476562 0.617188 
+0.53125 0.390625 0.507812 
+0.554688 0.414062 0.507812 
+0.546875 0.40625 0.515625 
+0.554688 0.414062 0.53125 
+0.578125 0.421875 0.523438 
+0.578125 0.421875 0.539062 
+0.59375 0.453125 0.507812 
+0.617188 0.476562 0.507812 
+0.609375 0.46875 0.515625 
+0.617188 0.476562 0.53125 
+0.601562 0.445312 0.523438 
+0.617188 0.460938 0.539062 
+0.585938 0.445312 0.53125 
+0.609375 0.46875 0.554688 
+0.585938 0.445312 0.554688 
+0.59375 0.453125 0.546875 
+0.601562 0.460938 0.578125 
+0.617188 0.476562 0.578125 
+0.539062 0.382812 0.523438 
+0.554688 0.398438 0.539062 
+0.640625 0.484375 0.523438 
+0.640625 0.484375 0.539062 
+0.507812 0.390625 0.53125 
+0.507812 0.414062 0.554688 
+0.515625 0.40625 0.546875 
+0.53125 0.414062 0.554688 
+0.523438 0.421875 0.578125 
+0.539062 0.421875 0.578125 
+0.507812 0.453125 0.59375 
+0.507812 0.476562 0.617188 
+0.515625 0.46875 0.609375 
+0.53125 0.476562 0.617188 
+0.523438 0.445312 0.601562 
+0.539062 0.460938 0.617188 
+0.53125 0.445312 0.585938 
+0.554688 0.46875 0.609375 
+0.554688 0.445312 0.585938 
+0.546875 0.453125 0.59375 
+0.578125 0.460938 0.601562 
+0.578125 0.476562 0.617188 
+0.523438 0.382812 0.539062 
+0.539062 0.398438 0.554688 
+0.523438 0.484375 0.640625 
+0.539062 0.484375 0.640625 
+0.390625 0.53125 0.507812 
+0.414062 0.554688 0.507812 
+0.40625 0.546875 0.515625 
+0.414062 0.554688 0.53125 
+0.421875 0.578125 0.523438 
+0.421875 0.578125 0.539062 
+0.453125 0.59375 0.507812 
+0.476562 0.617188 0.507812 
+0.46875 0.609375 0.515625 
+0.476562 0.617188 0.53125 
+0.445312 0.601562 0.523438 
+0.460938 0.617188 0.539062 
+0.445312 0.585938 0.53125 
+0.46875 0.609375 0.554688 
+0.445312 0.585938 0.554688 
+0.453125 0.59375 0.546875 
+0.460938 0.601562 0.578125 
+0.476562 0.617188 0.578125 
+0.382812 0.539062 0.523438 
+0.398438 0.554688 0.539062 
+0.484375 0.640625 0.523438 
+0.484375 0.640625 0.539062 
+0.390625 0.507812 0.53125 
+0.414062 0.507812 0.554688 
+0.40625 0.515625 0.546875 
+0.414062 0.53125 0.554688 
+0.421875 0.523438 0.578125 
+0.421875 0.539062 0.578125 
+0.453125 0.507812 0.59375 
+0.476562 0.507812 0.617188 
+0.46875 0.515625 0.609375 
+0.476562 0.53125 0.617188 
+0.445312 0.523438 0.601562 
+0.460938 0.539062 0.617188 
+0.445312 0.53125 0.585938 
+0.46875 0.554688 0.609375 
+0.445312 0.554688 0.585938 
+0.453125 0.546875 0.59375 
+0.460938 0.578125 0.601562 
+0.476562 0.578125 0.617188 
+0.382812 0.523438 0.539062 
+0.398438 0.539062 0.554688 
+0.484375 0.523438 0.640625 
+0.484375 0.539062 0.640625 
+0.53125 0.523438 0.515625 
+0.554688 0.523438 0.515625 
+0.546875 0.53125 0.515625 
+0.554688 0.546875 0.515625 
+0.59375 0.523438 0.515625 
+0.617188 0.523438 0.515625 
+0.609375 0.53125 0.515625 
+0.617188 0.546875 0.515625 
+0.585938 0.53125 0.515625 
+0.585938 0.554688 0.515625 
+0.59375 0.546875 0.515625 
+0.609375 0.554688 0.515625 
+0.578125 0.539062 0.53125 
+0.578125 0.554688 0.53125 
+0.601562 0.59375 0.515625 
+0.617188 0.59375 0.515625 
+0.601562 0.578125 0.53125 
+0.617188 0.578125 0.53125 
+0.65625 0.539062 0.515625 
+0.65625 0.554688 0.515625 
+0.640625 0.539062 0.53125 
+0.640625 0.554688 0.53125 
+0.53125 0.515625 0.523438 
+0.554688 0.515625 0.523438 
+0.546875 0.515625 0.53125 
+0.554688 0.515625 0.546875 
+0.59375 0.515625 0.523438 
+0.617188 0.515625 0.523438 
+0.609375 0.515625 0.53125 
+0.617188 0.515625 0.546875 
+0.585938 0.515625 0.53125 
+0.585938 0.515625 0.554688 
+0.59375 0.515625 0.546875 
+0.609375 0.515625 0.554688 
+0.578125 0.53125 0.539062 
+0.578125 0.53125 0.554688 
+0.601562 0.515625 0.59375 
+0.617188 0.515625 0.59375 
+0.601562 0.53125 0.578125 
+0.617188 0.53125 0.578125 
+0.65625 0.515625 0.539062 
+0.65625 0.515625 0.554688 
+0.640625 0.53125 0.539062 
+0.640625 0.53125 0.554688 
+0.523438 0.53125 0.515625 
+0.523438 0.554688 0.515625 
+0.53125 0.546875 0.515625 
+0.546875 0.554688 0.515625 
+0.523438 0.59375 0.515625 
+0.523438 0.617188 0.515625 
+0.53125 0.609375 0.515625 
+0.546875 0.617188 0.515625 
+0.53125 0.585938 0.515625 
+0.554688 0.585938 0.515625 
+0.546875 0.59375 0.515625 
+0.554688 0.609375 0.515625 
+0.539062 0.578125 0.53125 
+0.554688 0.578125 0.53125 
+0.59375 0.601562 0.515625 
+0.59375 0.617188 0.515625 
+0.578125 0.601562 0.53125 
+0.578125 0.617188 0.53125 
+0.539062 0.65625 0.515625 
+0.554688 0.65625 0.515625 
+0.539062 0.640625 0.53125 
+0.554688 0.640625 0.53125 
+0.515625 0.53125 0.523438 
+0.515625 0.554688 0.523438 
+0.515625 0.546875 0.53125 
+0.515625 0.554688 0.546875 
+0.515625 0.59375 0.523438 
+0.515625 0.617188 0.523438 
+0.515625 0.609375 0.53125 
+0.515625 0.617188 0.546875 
+0.515625 0.585938 0.53125 
+0.515625 0.585938 0.554688 
+0.515625 0.59375 0.546875 
+0.515625 0.609375 0.554688 
+0.53125 0.578125 0.539062 
+0.53125 0.578125 0.554688 
+0.515625 0.601562 0.59375 
+0.515625 0.617188 0.59375 
+0.53125 0.601562 0.578125 
+0.53125 0.617188 0.578125 
+0.515625 0.65625 0.539062 
+0.515625 0.65625 0.554688 
+0.53125 0.640625 0.539062 
+0.53125 0.640625 0.554688 
+0.523438 0.515625 0.53125 
+0.523438 0.515625 0.554688 
+0.53125 0.515625 0.546875 
+0.546875 0.515625 0.554688 
+0.523438 0.515625 0.59375 
+0.523438 0.515625 0.617188 
+0.53125 0.515625 0.609375 
+0.546875 0.515625 0.617188 
+0.53125 0.515625 0.585938 
+0.554688 0.515625 0.585938 
+0.546875 0.515625 0.59375 
+0.554688 0.515625 0.609375 
+0.539062 0.53125 0.578125 
+0.554688 0.53125 0.578125 
+0.59375 0.515625 0.601562 
+0.59375 0.515625 0.617188 
+0.578125 0.53125 0.601562 
+0.578125 0.53125 0.617188 
+0.539062 0.515625 0.65625 
+0.554688 0.515625 0.65625 
+0.539062 0.53125 0.640625 
+0.554688 0.53125 0.640625 
+0.515625 0.523438 0.53125 
+0.515625 0.523438 0.554688 
+0.515625 0.53125 0.546875 
+0.515625 0.546875 0.554688 
+0.515625 0.523438 0.59375 
+0.515625 0.523438 0.617188 
+0.515625 0.53125 0.609375 
+0.515625 0.546875 0.617188 
+0.515625 0.53125 0.585938 
+0.515625 0.554688 0.585938 
+0.515625 0.546875 0.59375 
+0.515625 0.554688 0.609375 
+0.53125 0.539062 0.578125 
+0.53125 0.554688 0.578125 
+0.515625 0.59375 0.601562 
+0.515625 0.59375 0.617188 
+0.53125 0.578125 0.601562 
+0.53125 0.578125 0.617188 
+0.515625 0.539062 0.65625 
+0.515625 0.554688 0.65625 
+0.53125 0.539062 0.640625 
+0.53125 0.554688 0.640625 
@@ -0,0 +1,12180 @@
+0.09375 0.0625 0.03125 
+0.21875 0.0625 0.03125 
+0.1875 0.09375 0.03125 
+0.15625 0.09375 0.0625 
+0.21875 0.1875 0.03125 
+0.21875 0.15625 0.0625 
+0.1875 0.15625 0.09375 
+0.21875 0.1875 0.15625 
+0.34375 0.0625 0.03125 
+0.46875 0.0625 0.03125 
+0.4375 0.09375 0.03125 
+0.40625 0.09375 0.0625 
+0.46875 0.1875 0.03125 
+0.46875 0.15625 0.0625 
+0.4375 0.15625 0.09375 
+0.46875 0.1875 0.15625 
+0.3125 0.09375 0.03125 
+0.3125 0.21875 0.03125 
+0.34375 0.1875 0.03125 
+0.34375 0.15625 0.0625 
+0.4375 0.21875 0.03125 
+0.40625 0.21875 0.0625 
+0.40625 0.1875 0.09375 
+0.4375 0.21875 0.15625 
+0.28125 0.09375 0.0625 
+0.28125 0.21875 0.0625 
+0.28125 0.1875 0.09375 
+0.3125 0.15625 0.09375 
+0.28125 0.21875 0.1875 
+0.3125 0.21875 0.15625 
+0.34375 0.1875 0.15625 
+0.40625 0.21875 0.1875 
+0.34375 0.3125 0.03125 
+0.46875 0.3125 0.03125 
+0.4375 0.34375 0.03125 
+0.40625 0.34375 0.0625 
+0.46875 0.4375 0.03125 
+0.46875 0.40625 0.0625 
+0.4375 0.40625 0.09375 
+0.46875 0.4375 0.15625 
+0.34375 0.28125 0.0625 
+0.46875 0.28125 0.0625 
+0.4375 0.28125 0.09375 
+0.40625 0.3125 0.09375 
+0.46875 0.28125 0.1875 
+0.46875 0.3125 0.15625 
+0.4375 0.34375 0.15625 
+0.3125 0.28125 0.09375 
+0.34375 0.3125 0.15625 
+0.4375 0.28125 0.21875 
+0.09375 0.03125 0.0625 
+0.21875 0.03125 0.0625 
+0.1875 0.03125 0.09375 
+0.15625 0.0625 0.09375 
+0.21875 0.03125 0.1875 
+0.21875 0.0625 0.15625 
+0.1875 0.09375 0.15625 
+0.21875 0.15625 0.1875 
+0.34375 0.03125 0.0625 
+0.46875 0.03125 0.0625 
+0.4375 0.03125 0.09375 
+0.40625 0.0625 0.09375 
+0.46875 0.03125 0.1875 
+0.46875 0.0625 0.15625 
+0.4375 0.09375 0.15625 
+0.46875 0.15625 0.1875 
+0.3125 0.03125 0.09375 
+0.3125 0.03125 0.21875 
+0.34375 0.03125 0.1875 
+0.34375 0.0625 0.15625 
+0.4375 0.03125 0.21875 
+0.40625 0.0625 0.21875 
+0.40625 0.09375 0.1875 
+0.4375 0.15625 0.21875 
+0.28125 0.0625 0.09375 
+0.28125 0.0625 0.21875 
+0.28125 0.09375 0.1875 
+0.3125 0.09375 0.15625 
+0.28125 0.1875 0.21875 
+0.3125 0.15625 0.21875 
+0.34375 0.15625 0.1875 
+0.40625 0.1875 0.21875 
+0.34375 0.03125 0.3125 
+0.46875 0.03125 0.3125 
+0.4375 0.03125 0.34375 
+0.40625 0.0625 0.34375 
+0.46875 0.03125 0.4375 
+0.46875 0.0625 0.40625 
+0.4375 0.09375 0.40625 
+0.46875 0.15625 0.4375 
+0.34375 0.0625 0.28125 
+0.46875 0.0625 0.28125 
+0.4375 0.09375 0.28125 
+0.40625 0.09375 0.3125 
+0.46875 0.1875 0.28125 
+0.46875 0.15625 0.3125 
+0.4375 0.15625 0.34375 
+0.3125 0.09375 0.28125 
+0.34375 0.15625 0.3125 
+0.4375 0.21875 0.28125 
+0.0625 0.09375 0.03125 
+0.0625 0.21875 0.03125 
+0.09375 0.1875 0.03125 
+0.09375 0.15625 0.0625 
+0.1875 0.21875 0.03125 
+0.15625 0.21875 0.0625 
+0.15625 0.1875 0.09375 
+0.1875 0.21875 0.15625 
+0.0625 0.34375 0.03125 
+0.0625 0.46875 0.03125 
+0.09375 0.4375 0.03125 
+0.09375 0.40625 0.0625 
+0.1875 0.46875 0.03125 
+0.15625 0.46875 0.0625 
+0.15625 0.4375 0.09375 
+0.1875 0.46875 0.15625 
+0.09375 0.3125 0.03125 
+0.21875 0.3125 0.03125 
+0.1875 0.34375 0.03125 
+0.15625 0.34375 0.0625 
+0.21875 0.4375 0.03125 
+0.21875 0.40625 0.0625 
+0.1875 0.40625 0.09375 
+0.21875 0.4375 0.15625 
+0.09375 0.28125 0.0625 
+0.21875 0.28125 0.0625 
+0.1875 0.28125 0.09375 
+0.15625 0.3125 0.09375 
+0.21875 0.28125 0.1875 
+0.21875 0.3125 0.15625 
+0.1875 0.34375 0.15625 
+0.21875 0.40625 0.1875 
+0.3125 0.34375 0.03125 
+0.3125 0.46875 0.03125 
+0.34375 0.4375 0.03125 
+0.34375 0.40625 0.0625 
+0.4375 0.46875 0.03125 
+0.40625 0.46875 0.0625 
+0.40625 0.4375 0.09375 
+0.4375 0.46875 0.15625 
+0.28125 0.34375 0.0625 
+0.28125 0.46875 0.0625 
+0.28125 0.4375 0.09375 
+0.3125 0.40625 0.09375 
+0.28125 0.46875 0.1875 
+0.3125 0.46875 0.15625 
+0.34375 0.4375 0.15625 
+0.28125 0.3125 0.09375 
+0.3125 0.34375 0.15625 
+0.28125 0.4375 0.21875 
+0.03125 0.09375 0.0625 
+0.03125 0.21875 0.0625 
+0.03125 0.1875 0.09375 
+0.0625 0.15625 0.09375 
+0.03125 0.21875 0.1875 
+0.0625 0.21875 0.15625 
+0.09375 0.1875 0.15625 
+0.15625 0.21875 0.1875 
+0.03125 0.34375 0.0625 
+0.03125 0.46875 0.0625 
+0.03125 0.4375 0.09375 
+0.0625 0.40625 0.09375 
+0.03125 0.46875 0.1875 
+0.0625 0.46875 0.15625 
+0.09375 0.4375 0.15625 
+0.15625 0.46875 0.1875 
+0.03125 0.3125 0.09375 
+0.03125 0.3125 0.21875 
+0.03125 0.34375 0.1875 
+0.0625 0.34375 0.15625 
+0.03125 0.4375 0.21875 
+0.0625 0.40625 0.21875 
+0.09375 0.40625 0.1875 
+0.15625 0.4375 0.21875 
+0.0625 0.28125 0.09375 
+0.0625 0.28125 0.21875 
+0.09375 0.28125 0.1875 
+0.09375 0.3125 0.15625 
+0.1875 0.28125 0.21875 
+0.15625 0.3125 0.21875 
+0.15625 0.34375 0.1875 
+0.1875 0.40625 0.21875 
+0.03125 0.34375 0.3125 
+0.03125 0.46875 0.3125 
+0.03125 0.4375 0.34375 
+0.0625 0.40625 0.34375 
+0.03125 0.46875 0.4375 
+0.0625 0.46875 0.40625 
+0.09375 0.4375 0.40625 
+0.15625 0.46875 0.4375 
+0.0625 0.34375 0.28125 
+0.0625 0.46875 0.28125 
+0.09375 0.4375 0.28125 
+0.09375 0.40625 0.3125 
+0.1875 0.46875 0.28125 
+0.15625 0.46875 0.3125 
+0.15625 0.4375 0.34375 
+0.09375 0.3125 0.28125 
+0.15625 0.34375 0.3125 
+0.21875 0.4375 0.28125 
+0.0625 0.03125 0.09375 
+0.0625 0.03125 0.21875 
+0.09375 0.03125 0.1875 
+0.09375 0.0625 0.15625 
+0.1875 0.03125 0.21875 
+0.15625 0.0625 0.21875 
+0.15625 0.09375 0.1875 
+0.1875 0.15625 0.21875 
+0.0625 0.03125 0.34375 
+0.0625 0.03125 0.46875 
+0.09375 0.03125 0.4375 
+0.09375 0.0625 0.40625 
+0.1875 0.03125 0.46875 
+0.15625 0.0625 0.46875 
+0.15625 0.09375 0.4375 
+0.1875 0.15625 0.46875 
+0.09375 0.03125 0.3125 
+0.21875 0.03125 0.3125 
+0.1875 0.03125 0.34375 
+0.15625 0.0625 0.34375 
+0.21875 0.03125 0.4375 
+0.21875 0.0625 0.40625 
+0.1875 0.09375 0.40625 
+0.21875 0.15625 0.4375 
+0.09375 0.0625 0.28125 
+0.21875 0.0625 0.28125 
+0.1875 0.09375 0.28125 
+0.15625 0.09375 0.3125 
+0.21875 0.1875 0.28125 
+0.21875 0.15625 0.3125 
+0.1875 0.15625 0.34375 
+0.21875 0.1875 0.40625 
+0.3125 0.03125 0.34375 
+0.3125 0.03125 0.46875 
+0.34375 0.03125 0.4375 
+0.34375 0.0625 0.40625 
+0.4375 0.03125 0.46875 
+0.40625 0.0625 0.46875 
+0.40625 0.09375 0.4375 
+0.4375 0.15625 0.46875 
+0.28125 0.0625 0.34375 
+0.28125 0.0625 0.46875 
+0.28125 0.09375 0.4375 
+0.3125 0.09375 0.40625 
+0.28125 0.1875 0.46875 
+0.3125 0.15625 0.46875 
+0.34375 0.15625 0.4375 
+0.28125 0.09375 0.3125 
+0.3125 0.15625 0.34375 
+0.28125 0.21875 0.4375 
+0.03125 0.0625 0.09375 
+0.03125 0.0625 0.21875 
+0.03125 0.09375 0.1875 
+0.0625 0.09375 0.15625 
+0.03125 0.1875 0.21875 
+0.0625 0.15625 0.21875 
+0.09375 0.15625 0.1875 
+0.15625 0.1875 0.21875 
+0.03125 0.0625 0.34375 
+0.03125 0.0625 0.46875 
+0.03125 0.09375 0.4375 
+0.0625 0.09375 0.40625 
+0.03125 0.1875 0.46875 
+0.0625 0.15625 0.46875 
+0.09375 0.15625 0.4375 
+0.15625 0.1875 0.46875 
+0.03125 0.09375 0.3125 
+0.03125 0.21875 0.3125 
+0.03125 0.1875 0.34375 
+0.0625 0.15625 0.34375 
+0.03125 0.21875 0.4375 
+0.0625 0.21875 0.40625 
+0.09375 0.1875 0.40625 
+0.15625 0.21875 0.4375 
+0.0625 0.09375 0.28125 
+0.0625 0.21875 0.28125 
+0.09375 0.1875 0.28125 
+0.09375 0.15625 0.3125 
+0.1875 0.21875 0.28125 
+0.15625 0.21875 0.3125 
+0.15625 0.1875 0.34375 
+0.1875 0.21875 0.40625 
+0.03125 0.3125 0.34375 
+0.03125 0.3125 0.46875 
+0.03125 0.34375 0.4375 
+0.0625 0.34375 0.40625 
+0.03125 0.4375 0.46875 
+0.0625 0.40625 0.46875 
+0.09375 0.40625 0.4375 
+0.15625 0.4375 0.46875 
+0.0625 0.28125 0.34375 
+0.0625 0.28125 0.46875 
+0.09375 0.28125 0.4375 
+0.09375 0.3125 0.40625 
+0.1875 0.28125 0.46875 
+0.15625 0.3125 0.46875 
+0.15625 0.34375 0.4375 
+0.09375 0.28125 0.3125 
+0.15625 0.3125 0.34375 
+0.21875 0.28125 0.4375 
+0.59375 0.0625 0.03125 
+0.71875 0.0625 0.03125 
+0.6875 0.09375 0.03125 
+0.65625 0.09375 0.0625 
+0.71875 0.1875 0.03125 
+0.71875 0.15625 0.0625 
+0.6875 0.15625 0.09375 
+0.71875 0.1875 0.15625 
+0.84375 0.0625 0.03125 
+0.96875 0.0625 0.03125 
+0.9375 0.09375 0.03125 
+0.90625 0.09375 0.0625 
+0.96875 0.1875 0.03125 
+0.96875 0.15625 0.0625 
+0.9375 0.15625 0.09375 
+0.96875 0.1875 0.15625 
+0.8125 0.09375 0.03125 
+0.8125 0.21875 0.03125 
+0.84375 0.1875 0.03125 
+0.84375 0.15625 0.0625 
+0.9375 0.21875 0.03125 
+0.90625 0.21875 0.0625 
+0.90625 0.1875 0.09375 
+0.9375 0.21875 0.15625 
+0.78125 0.09375 0.0625 
+0.78125 0.21875 0.0625 
+0.78125 0.1875 0.09375 
+0.8125 0.15625 0.09375 
+0.78125 0.21875 0.1875 
+0.8125 0.21875 0.15625 
+0.84375 0.1875 0.15625 
+0.90625 0.21875 0.1875 
+0.84375 0.3125 0.03125 
+0.96875 0.3125 0.03125 
+0.9375 0.34375 0.03125 
+0.90625 0.34375 0.0625 
+0.96875 0.4375 0.03125 
+0.96875 0.40625 0.0625 
+0.9375 0.40625 0.09375 
+0.96875 0.4375 0.15625 
+0.84375 0.28125 0.0625 
+0.96875 0.28125 0.0625 
+0.9375 0.28125 0.09375 
+0.90625 0.3125 0.09375 
+0.96875 0.28125 0.1875 
+0.96875 0.3125 0.15625 
+0.9375 0.34375 0.15625 
+0.96875 0.40625 0.1875 
+0.8125 0.28125 0.09375 
+0.8125 0.28125 0.21875 
+0.84375 0.28125 0.1875 
+0.84375 0.3125 0.15625 
+0.9375 0.28125 0.21875 
+0.90625 0.3125 0.21875 
+0.90625 0.34375 0.1875 
+0.9375 0.40625 0.21875 
+0.84375 0.3125 0.28125 
+0.96875 0.3125 0.28125 
+0.9375 0.34375 0.28125 
+0.90625 0.34375 0.3125 
+0.96875 0.4375 0.28125 
+0.96875 0.40625 0.3125 
+0.9375 0.40625 0.34375 
+0.96875 0.4375 0.40625 
+0.59375 0.03125 0.0625 
+0.71875 0.03125 0.0625 
+0.6875 0.03125 0.09375 
+0.65625 0.0625 0.09375 
+0.71875 0.03125 0.1875 
+0.71875 0.0625 0.15625 
+0.6875 0.09375 0.15625 
+0.71875 0.15625 0.1875 
+0.84375 0.03125 0.0625 
+0.96875 0.03125 0.0625 
+0.9375 0.03125 0.09375 
+0.90625 0.0625 0.09375 
+0.96875 0.03125 0.1875 
+0.96875 0.0625 0.15625 
+0.9375 0.09375 0.15625 
+0.96875 0.15625 0.1875 
+0.8125 0.03125 0.09375 
+0.8125 0.03125 0.21875 
+0.84375 0.03125 0.1875 
+0.84375 0.0625 0.15625 
+0.9375 0.03125 0.21875 
+0.90625 0.0625 0.21875 
+0.90625 0.09375 0.1875 
+0.9375 0.15625 0.21875 
+0.78125 0.0625 0.09375 
+0.78125 0.0625 0.21875 
+0.78125 0.09375 0.1875 
+0.8125 0.09375 0.15625 
+0.78125 0.1875 0.21875 
+0.8125 0.15625 0.21875 
+0.84375 0.15625 0.1875 
+0.90625 0.1875 0.21875 
+0.84375 0.03125 0.3125 
+0.96875 0.03125 0.3125 
+0.9375 0.03125 0.34375 
+0.90625 0.0625 0.34375 
+0.96875 0.03125 0.4375 
+0.96875 0.0625 0.40625 
+0.9375 0.09375 0.40625 
+0.96875 0.15625 0.4375 
+0.84375 0.0625 0.28125 
+0.96875 0.0625 0.28125 
+0.9375 0.09375 0.28125 
+0.90625 0.09375 0.3125 
+0.96875 0.1875 0.28125 
+0.96875 0.15625 0.3125 
+0.9375 0.15625 0.34375 
+0.96875 0.1875 0.40625 
+0.8125 0.09375 0.28125 
+0.8125 0.21875 0.28125 
+0.84375 0.1875 0.28125 
+0.84375 0.15625 0.3125 
+0.9375 0.21875 0.28125 
+0.90625 0.21875 0.3125 
+0.90625 0.1875 0.34375 
+0.9375 0.21875 0.40625 
+0.84375 0.28125 0.3125 
+0.96875 0.28125 0.3125 
+0.9375 0.28125 0.34375 
+0.90625 0.3125 0.34375 
+0.96875 0.28125 0.4375 
+0.96875 0.3125 0.40625 
+0.9375 0.34375 0.40625 
+0.96875 0.40625 0.4375 
+0.5625 0.09375 0.03125 
+0.5625 0.21875 0.03125 
+0.59375 0.1875 0.03125 
+0.59375 0.15625 0.0625 
+0.6875 0.21875 0.03125 
+0.65625 0.21875 0.0625 
+0.65625 0.1875 0.09375 
+0.6875 0.21875 0.15625 
+0.5625 0.34375 0.03125 
+0.5625 0.46875 0.03125 
+0.59375 0.4375 0.03125 
+0.59375 0.40625 0.0625 
+0.6875 0.46875 0.03125 
+0.65625 0.46875 0.0625 
+0.65625 0.4375 0.09375 
+0.6875 0.46875 0.15625 
+0.59375 0.3125 0.03125 
+0.71875 0.3125 0.03125 
+0.6875 0.34375 0.03125 
+0.65625 0.34375 0.0625 
+0.71875 0.4375 0.03125 
+0.71875 0.40625 0.0625 
+0.6875 0.40625 0.09375 
+0.71875 0.4375 0.15625 
+0.59375 0.28125 0.0625 
+0.71875 0.28125 0.0625 
+0.6875 0.28125 0.09375 
+0.65625 0.3125 0.09375 
+0.71875 0.28125 0.1875 
+0.71875 0.3125 0.15625 
+0.6875 0.34375 0.15625 
+0.71875 0.40625 0.1875 
+0.8125 0.34375 0.03125 
+0.8125 0.46875 0.03125 
+0.84375 0.4375 0.03125 
+0.84375 0.40625 0.0625 
+0.9375 0.46875 0.03125 
+0.90625 0.46875 0.0625 
+0.90625 0.4375 0.09375 
+0.9375 0.46875 0.15625 
+0.78125 0.34375 0.0625 
+0.78125 0.46875 0.0625 
+0.78125 0.4375 0.09375 
+0.8125 0.40625 0.09375 
+0.78125 0.46875 0.1875 
+0.8125 0.46875 0.15625 
+0.84375 0.4375 0.15625 
+0.90625 0.46875 0.1875 
+0.78125 0.3125 0.09375 
+0.78125 0.3125 0.21875 
+0.78125 0.34375 0.1875 
+0.8125 0.34375 0.15625 
+0.78125 0.4375 0.21875 
+0.8125 0.40625 0.21875 
+0.84375 0.40625 0.1875 
+0.90625 0.4375 0.21875 
+0.8125 0.34375 0.28125 
+0.8125 0.46875 0.28125 
+0.84375 0.4375 0.28125 
+0.84375 0.40625 0.3125 
+0.9375 0.46875 0.28125 
+0.90625 0.46875 0.3125 
+0.90625 0.4375 0.34375 
+0.9375 0.46875 0.40625 
+0.53125 0.09375 0.0625 
+0.53125 0.21875 0.0625 
+0.53125 0.1875 0.09375 
+0.5625 0.15625 0.09375 
+0.53125 0.21875 0.1875 
+0.5625 0.21875 0.15625 
+0.59375 0.1875 0.15625 
+0.65625 0.21875 0.1875 
+0.53125 0.34375 0.0625 
+0.53125 0.46875 0.0625 
+0.53125 0.4375 0.09375 
+0.5625 0.40625 0.09375 
+0.53125 0.46875 0.1875 
+0.5625 0.46875 0.15625 
+0.59375 0.4375 0.15625 
+0.65625 0.46875 0.1875 
+0.53125 0.3125 0.09375 
+0.53125 0.3125 0.21875 
+0.53125 0.34375 0.1875 
+0.5625 0.34375 0.15625 
+0.5625 0.40625 0.21875 
+0.59375 0.40625 0.1875 
+0.65625 0.4375 0.21875 
+0.5625 0.28125 0.09375 
+0.5625 0.28125 0.21875 
+0.59375 0.28125 0.1875 
+0.59375 0.3125 0.15625 
+0.6875 0.28125 0.21875 
+0.65625 0.3125 0.21875 
+0.65625 0.34375 0.1875 
+0.6875 0.40625 0.21875 
+0.5625 0.34375 0.28125 
+0.6875 0.46875 0.28125 
+0.65625 0.46875 0.3125 
+0.59375 0.3125 0.28125 
+0.71875 0.3125 0.28125 
+0.6875 0.34375 0.28125 
+0.65625 0.34375 0.3125 
+0.71875 0.4375 0.28125 
+0.71875 0.40625 0.3125 
+0.6875 0.40625 0.34375 
+0.78125 0.34375 0.3125 
+0.78125 0.46875 0.3125 
+0.78125 0.4375 0.34375 
+0.8125 0.40625 0.34375 
+0.78125 0.46875 0.4375 
+0.8125 0.46875 0.40625 
+0.84375 0.4375 0.40625 
+0.90625 0.46875 0.4375 
+0.5625 0.03125 0.09375 
+0.5625 0.03125 0.21875 
+0.59375 0.03125 0.1875 
+0.59375 0.0625 0.15625 
+0.6875 0.03125 0.21875 
+0.65625 0.0625 0.21875 
+0.65625 0.09375 0.1875 
+0.6875 0.15625 0.21875 
+0.5625 0.03125 0.34375 
+0.5625 0.03125 0.46875 
+0.59375 0.03125 0.4375 
+0.59375 0.0625 0.40625 
+0.6875 0.03125 0.46875 
+0.65625 0.0625 0.46875 
+0.65625 0.09375 0.4375 
+0.6875 0.15625 0.46875 
+0.59375 0.03125 0.3125 
+0.71875 0.03125 0.3125 
+0.6875 0.03125 0.34375 
+0.65625 0.0625 0.34375 
+0.71875 0.03125 0.4375 
+0.71875 0.0625 0.40625 
+0.6875 0.09375 0.40625 
+0.71875 0.15625 0.4375 
+0.59375 0.0625 0.28125 
+0.71875 0.0625 0.28125 
+0.6875 0.09375 0.28125 
+0.65625 0.09375 0.3125 
+0.71875 0.1875 0.28125 
+0.71875 0.15625 0.3125 
+0.6875 0.15625 0.34375 
+0.71875 0.1875 0.40625 
+0.8125 0.03125 0.34375 
+0.8125 0.03125 0.46875 
+0.84375 0.03125 0.4375 
+0.84375 0.0625 0.40625 
+0.9375 0.03125 0.46875 
+0.90625 0.0625 0.46875 
+0.90625 0.09375 0.4375 
+0.9375 0.15625 0.46875 
+0.78125 0.0625 0.34375 
+0.78125 0.0625 0.46875 
+0.78125 0.09375 0.4375 
+0.8125 0.09375 0.40625 
+0.78125 0.1875 0.46875 
+0.8125 0.15625 0.46875 
+0.84375 0.15625 0.4375 
+0.90625 0.1875 0.46875 
+0.78125 0.09375 0.3125 
+0.78125 0.21875 0.3125 
+0.78125 0.1875 0.34375 
+0.8125 0.15625 0.34375 
+0.78125 0.21875 0.4375 
+0.8125 0.21875 0.40625 
+0.84375 0.1875 0.40625 
+0.90625 0.21875 0.4375 
+0.8125 0.28125 0.34375 
+0.8125 0.28125 0.46875 
+0.84375 0.28125 0.4375 
+0.84375 0.3125 0.40625 
+0.9375 0.28125 0.46875 
+0.90625 0.3125 0.46875 
+0.90625 0.34375 0.4375 
+0.9375 0.40625 0.46875 
+0.53125 0.0625 0.09375 
+0.53125 0.0625 0.21875 
+0.53125 0.09375 0.1875 
+0.5625 0.09375 0.15625 
+0.53125 0.1875 0.21875 
+0.5625 0.15625 0.21875 
+0.59375 0.15625 0.1875 
+0.65625 0.1875 0.21875 
+0.53125 0.0625 0.34375 
+0.53125 0.0625 0.46875 
+0.53125 0.09375 0.4375 
+0.5625 0.09375 0.40625 
+0.53125 0.1875 0.46875 
+0.5625 0.15625 0.46875 
+0.59375 0.15625 0.4375 
+0.65625 0.1875 0.46875 
+0.53125 0.09375 0.3125 
+0.53125 0.21875 0.3125 
+0.53125 0.1875 0.34375 
+0.5625 0.15625 0.34375 
+0.5625 0.21875 0.40625 
+0.59375 0.1875 0.40625 
+0.65625 0.21875 0.4375 
+0.5625 0.09375 0.28125 
+0.5625 0.21875 0.28125 
+0.59375 0.1875 0.28125 
+0.59375 0.15625 0.3125 
+0.6875 0.21875 0.28125 
+0.65625 0.21875 0.3125 
+0.65625 0.1875 0.34375 
+0.6875 0.21875 0.40625 
+0.5625 0.28125 0.34375 
+0.6875 0.28125 0.46875 
+0.65625 0.3125 0.46875 
+0.59375 0.28125 0.3125 
+0.71875 0.28125 0.3125 
+0.6875 0.28125 0.34375 
+0.65625 0.3125 0.34375 
+0.71875 0.28125 0.4375 
+0.71875 0.3125 0.40625 
+0.6875 0.34375 0.40625 
+0.78125 0.3125 0.34375 
+0.78125 0.3125 0.46875 
+0.78125 0.34375 0.4375 
+0.8125 0.34375 0.40625 
+0.78125 0.4375 0.46875 
+0.8125 0.40625 0.46875 
+0.84375 0.40625 0.4375 
+0.90625 0.4375 0.46875 
+0.09375 0.5625 0.03125 
+0.21875 0.5625 0.03125 
+0.1875 0.59375 0.03125 
+0.15625 0.59375 0.0625 
+0.21875 0.6875 0.03125 
+0.21875 0.65625 0.0625 
+0.1875 0.65625 0.09375 
+0.21875 0.6875 0.15625 
+0.34375 0.5625 0.03125 
+0.46875 0.5625 0.03125 
+0.4375 0.59375 0.03125 
+0.40625 0.59375 0.0625 
+0.46875 0.6875 0.03125 
+0.46875 0.65625 0.0625 
+0.4375 0.65625 0.09375 
+0.46875 0.6875 0.15625 
+0.3125 0.59375 0.03125 
+0.3125 0.71875 0.03125 
+0.34375 0.6875 0.03125 
+0.34375 0.65625 0.0625 
+0.4375 0.71875 0.03125 
+0.40625 0.71875 0.0625 
+0.40625 0.6875 0.09375 
+0.4375 0.71875 0.15625 
+0.28125 0.59375 0.0625 
+0.28125 0.71875 0.0625 
+0.28125 0.6875 0.09375 
+0.3125 0.65625 0.09375 
+0.28125 0.71875 0.1875 
+0.3125 0.71875 0.15625 
+0.34375 0.6875 0.15625 
+0.40625 0.71875 0.1875 
+0.34375 0.8125 0.03125 
+0.46875 0.8125 0.03125 
+0.4375 0.84375 0.03125 
+0.40625 0.84375 0.0625 
+0.46875 0.9375 0.03125 
+0.46875 0.90625 0.0625 
+0.4375 0.90625 0.09375 
+0.46875 0.9375 0.15625 
+0.34375 0.78125 0.0625 
+0.46875 0.78125 0.0625 
+0.4375 0.78125 0.09375 
+0.40625 0.8125 0.09375 
+0.46875 0.78125 0.1875 
+0.46875 0.8125 0.15625 
+0.4375 0.84375 0.15625 
+0.46875 0.90625 0.1875 
+0.3125 0.78125 0.09375 
+0.3125 0.78125 0.21875 
+0.34375 0.78125 0.1875 
+0.34375 0.8125 0.15625 
+0.4375 0.78125 0.21875 
+0.40625 0.8125 0.21875 
+0.40625 0.84375 0.1875 
+0.4375 0.90625 0.21875 
+0.34375 0.8125 0.28125 
+0.46875 0.8125 0.28125 
+0.4375 0.84375 0.28125 
+0.40625 0.84375 0.3125 
+0.46875 0.9375 0.28125 
+0.46875 0.90625 0.3125 
+0.4375 0.90625 0.34375 
+0.46875 0.9375 0.40625 
+0.09375 0.53125 0.0625 
+0.21875 0.53125 0.0625 
+0.1875 0.53125 0.09375 
+0.15625 0.5625 0.09375 
+0.21875 0.53125 0.1875 
+0.21875 0.5625 0.15625 
+0.1875 0.59375 0.15625 
+0.21875 0.65625 0.1875 
+0.34375 0.53125 0.0625 
+0.46875 0.53125 0.0625 
+0.4375 0.53125 0.09375 
+0.40625 0.5625 0.09375 
+0.46875 0.53125 0.1875 
+0.46875 0.5625 0.15625 
+0.4375 0.59375 0.15625 
+0.46875 0.65625 0.1875 
+0.3125 0.53125 0.09375 
+0.3125 0.53125 0.21875 
+0.34375 0.53125 0.1875 
+0.34375 0.5625 0.15625 
+0.40625 0.5625 0.21875 
+0.40625 0.59375 0.1875 
+0.4375 0.65625 0.21875 
+0.28125 0.5625 0.09375 
+0.28125 0.5625 0.21875 
+0.28125 0.59375 0.1875 
+0.3125 0.59375 0.15625 
+0.28125 0.6875 0.21875 
+0.3125 0.65625 0.21875 
+0.34375 0.65625 0.1875 
+0.40625 0.6875 0.21875 
+0.34375 0.5625 0.28125 
+0.46875 0.6875 0.28125 
+0.46875 0.65625 0.3125 
+0.3125 0.59375 0.28125 
+0.3125 0.71875 0.28125 
+0.34375 0.6875 0.28125 
+0.34375 0.65625 0.3125 
+0.4375 0.71875 0.28125 
+0.40625 0.71875 0.3125 
+0.40625 0.6875 0.34375 
+0.34375 0.78125 0.3125 
+0.46875 0.78125 0.3125 
+0.4375 0.78125 0.34375 
+0.40625 0.8125 0.34375 
+0.46875 0.78125 0.4375 
+0.46875 0.8125 0.40625 
+0.4375 0.84375 0.40625 
+0.46875 0.90625 0.4375 
+0.0625 0.59375 0.03125 
+0.0625 0.71875 0.03125 
+0.09375 0.6875 0.03125 
+0.09375 0.65625 0.0625 
+0.1875 0.71875 0.03125 
+0.15625 0.71875 0.0625 
+0.15625 0.6875 0.09375 
+0.1875 0.71875 0.15625 
+0.0625 0.84375 0.03125 
+0.0625 0.96875 0.03125 
+0.09375 0.9375 0.03125 
+0.09375 0.90625 0.0625 
+0.1875 0.96875 0.03125 
+0.15625 0.96875 0.0625 
+0.15625 0.9375 0.09375 
+0.1875 0.96875 0.15625 
+0.09375 0.8125 0.03125 
+0.21875 0.8125 0.03125 
+0.1875 0.84375 0.03125 
+0.15625 0.84375 0.0625 
+0.21875 0.9375 0.03125 
+0.21875 0.90625 0.0625 
+0.1875 0.90625 0.09375 
+0.21875 0.9375 0.15625 
+0.09375 0.78125 0.0625 
+0.21875 0.78125 0.0625 
+0.1875 0.78125 0.09375 
+0.15625 0.8125 0.09375 
+0.21875 0.78125 0.1875 
+0.21875 0.8125 0.15625 
+0.1875 0.84375 0.15625 
+0.21875 0.90625 0.1875 
+0.3125 0.84375 0.03125 
+0.3125 0.96875 0.03125 
+0.34375 0.9375 0.03125 
+0.34375 0.90625 0.0625 
+0.4375 0.96875 0.03125 
+0.40625 0.96875 0.0625 
+0.40625 0.9375 0.09375 
+0.4375 0.96875 0.15625 
+0.28125 0.84375 0.0625 
+0.28125 0.96875 0.0625 
+0.28125 0.9375 0.09375 
+0.3125 0.90625 0.09375 
+0.28125 0.96875 0.1875 
+0.3125 0.96875 0.15625 
+0.34375 0.9375 0.15625 
+0.40625 0.96875 0.1875 
+0.28125 0.8125 0.09375 
+0.28125 0.8125 0.21875 
+0.28125 0.84375 0.1875 
+0.3125 0.84375 0.15625 
+0.28125 0.9375 0.21875 
+0.3125 0.90625 0.21875 
+0.34375 0.90625 0.1875 
+0.40625 0.9375 0.21875 
+0.3125 0.84375 0.28125 
+0.3125 0.96875 0.28125 
+0.34375 0.9375 0.28125 
+0.34375 0.90625 0.3125 
+0.4375 0.96875 0.28125 
+0.40625 0.96875 0.3125 
+0.40625 0.9375 0.34375 
+0.4375 0.96875 0.40625 
+0.03125 0.59375 0.0625 
+0.03125 0.71875 0.0625 
+0.03125 0.6875 0.09375 
+0.0625 0.65625 0.09375 
+0.03125 0.71875 0.1875 
+0.0625 0.71875 0.15625 
+0.09375 0.6875 0.15625 
+0.15625 0.71875 0.1875 
+0.03125 0.84375 0.0625 
+0.03125 0.96875 0.0625 
+0.03125 0.9375 0.09375 
+0.0625 0.90625 0.09375 
+0.03125 0.96875 0.1875 
+0.0625 0.96875 0.15625 
+0.09375 0.9375 0.15625 
+0.15625 0.96875 0.1875 
+0.03125 0.8125 0.09375 
+0.03125 0.8125 0.21875 
+0.03125 0.84375 0.1875 
+0.0625 0.84375 0.15625 
+0.03125 0.9375 0.21875 
+0.0625 0.90625 0.21875 
+0.09375 0.90625 0.1875 
+0.15625 0.9375 0.21875 
+0.0625 0.78125 0.09375 
+0.0625 0.78125 0.21875 
+0.09375 0.78125 0.1875 
+0.09375 0.8125 0.15625 
+0.1875 0.78125 0.21875 
+0.15625 0.8125 0.21875 
+0.15625 0.84375 0.1875 
+0.1875 0.90625 0.21875 
+0.03125 0.84375 0.3125 
+0.03125 0.96875 0.3125 
+0.03125 0.9375 0.34375 
+0.0625 0.90625 0.34375 
+0.03125 0.96875 0.4375 
+0.0625 0.96875 0.40625 
+0.09375 0.9375 0.40625 
+0.15625 0.96875 0.4375 
+0.0625 0.84375 0.28125 
+0.0625 0.96875 0.28125 
+0.09375 0.9375 0.28125 
+0.09375 0.90625 0.3125 
+0.1875 0.96875 0.28125 
+0.15625 0.96875 0.3125 
+0.15625 0.9375 0.34375 
+0.1875 0.96875 0.40625 
+0.09375 0.8125 0.28125 
+0.21875 0.8125 0.28125 
+0.1875 0.84375 0.28125 
+0.15625 0.84375 0.3125 
+0.21875 0.9375 0.28125 
+0.21875 0.90625 0.3125 
+0.1875 0.90625 0.34375 
+0.21875 0.9375 0.40625 
+0.28125 0.84375 0.3125 
+0.28125 0.96875 0.3125 
+0.28125 0.9375 0.34375 
+0.3125 0.90625 0.34375 
+0.28125 0.96875 0.4375 
+0.3125 0.96875 0.40625 
+0.34375 0.9375 0.40625 
+0.40625 0.96875 0.4375 
+0.0625 0.53125 0.09375 
+0.0625 0.53125 0.21875 
+0.09375 0.53125 0.1875 
+0.09375 0.5625 0.15625 
+0.1875 0.53125 0.21875 
+0.15625 0.5625 0.21875 
+0.15625 0.59375 0.1875 
+0.1875 0.65625 0.21875 
+0.0625 0.53125 0.34375 
+0.0625 0.53125 0.46875 
+0.09375 0.53125 0.4375 
+0.09375 0.5625 0.40625 
+0.1875 0.53125 0.46875 
+0.15625 0.5625 0.46875 
+0.15625 0.59375 0.4375 
+0.1875 0.65625 0.46875 
+0.09375 0.53125 0.3125 
+0.21875 0.53125 0.3125 
+0.1875 0.53125 0.34375 
+0.15625 0.5625 0.34375 
+0.21875 0.5625 0.40625 
+0.1875 0.59375 0.40625 
+0.21875 0.65625 0.4375 
+0.09375 0.5625 0.28125 
+0.21875 0.5625 0.28125 
+0.1875 0.59375 0.28125 
+0.15625 0.59375 0.3125 
+0.21875 0.6875 0.28125 
+0.21875 0.65625 0.3125 
+0.1875 0.65625 0.34375 
+0.21875 0.6875 0.40625 
+0.28125 0.5625 0.34375 
+0.28125 0.6875 0.46875 
+0.3125 0.65625 0.46875 
+0.28125 0.59375 0.3125 
+0.28125 0.71875 0.3125 
+0.28125 0.6875 0.34375 
+0.3125 0.65625 0.34375 
+0.28125 0.71875 0.4375 
+0.3125 0.71875 0.40625 
+0.34375 0.6875 0.40625 
+0.3125 0.78125 0.34375 
+0.3125 0.78125 0.46875 
+0.34375 0.78125 0.4375 
+0.34375 0.8125 0.40625 
+0.4375 0.78125 0.46875 
+0.40625 0.8125 0.46875 
+0.40625 0.84375 0.4375 
+0.4375 0.90625 0.46875 
+0.03125 0.5625 0.09375 
+0.03125 0.5625 0.21875 
+0.03125 0.59375 0.1875 
+0.0625 0.59375 0.15625 
+0.03125 0.6875 0.21875 
+0.0625 0.65625 0.21875 
+0.09375 0.65625 0.1875 
+0.15625 0.6875 0.21875 
+0.03125 0.5625 0.34375 
+0.03125 0.5625 0.46875 
+0.03125 0.59375 0.4375 
+0.0625 0.59375 0.40625 
+0.03125 0.6875 0.46875 
+0.0625 0.65625 0.46875 
+0.09375 0.65625 0.4375 
+0.15625 0.6875 0.46875 
+0.03125 0.59375 0.3125 
+0.03125 0.71875 0.3125 
+0.03125 0.6875 0.34375 
+0.0625 0.65625 0.34375 
+0.03125 0.71875 0.4375 
+0.0625 0.71875 0.40625 
+0.09375 0.6875 0.40625 
+0.15625 0.71875 0.4375 
+0.0625 0.59375 0.28125 
+0.0625 0.71875 0.28125 
+0.09375 0.6875 0.28125 
+0.09375 0.65625 0.3125 
+0.1875 0.71875 0.28125 
+0.15625 0.71875 0.3125 
+0.15625 0.6875 0.34375 
+0.1875 0.71875 0.40625 
+0.03125 0.8125 0.34375 
+0.03125 0.8125 0.46875 
+0.03125 0.84375 0.4375 
+0.0625 0.84375 0.40625 
+0.03125 0.9375 0.46875 
+0.0625 0.90625 0.46875 
+0.09375 0.90625 0.4375 
+0.15625 0.9375 0.46875 
+0.0625 0.78125 0.34375 
+0.0625 0.78125 0.46875 
+0.09375 0.78125 0.4375 
+0.09375 0.8125 0.40625 
+0.1875 0.78125 0.46875 
+0.15625 0.8125 0.46875 
+0.15625 0.84375 0.4375 
+0.1875 0.90625 0.46875 
+0.09375 0.78125 0.3125 
+0.21875 0.78125 0.3125 
+0.1875 0.78125 0.34375 
+0.15625 0.8125 0.34375 
+0.21875 0.78125 0.4375 
+0.21875 0.8125 0.40625 
+0.1875 0.84375 0.40625 
+0.21875 0.90625 0.4375 
+0.28125 0.8125 0.34375 
+0.28125 0.8125 0.46875 
+0.28125 0.84375 0.4375 
+0.3125 0.84375 0.40625 
+0.28125 0.9375 0.46875 
+0.3125 0.90625 0.46875 
+0.34375 0.90625 0.4375 
+0.40625 0.9375 0.46875 
+0.59375 0.5625 0.03125 
+0.71875 0.5625 0.03125 
+0.6875 0.59375 0.03125 
+0.65625 0.59375 0.0625 
+0.71875 0.6875 0.03125 
+0.71875 0.65625 0.0625 
+0.6875 0.65625 0.09375 
+0.71875 0.6875 0.15625 
+0.84375 0.5625 0.03125 
+0.96875 0.5625 0.03125 
+0.9375 0.59375 0.03125 
+0.90625 0.59375 0.0625 
+0.96875 0.6875 0.03125 
+0.96875 0.65625 0.0625 
+0.9375 0.65625 0.09375 
+0.96875 0.6875 0.15625 
+0.8125 0.59375 0.03125 
+0.8125 0.71875 0.03125 
+0.84375 0.6875 0.03125 
+0.84375 0.65625 0.0625 
+0.9375 0.71875 0.03125 
+0.90625 0.71875 0.0625 
+0.90625 0.6875 0.09375 
+0.9375 0.71875 0.15625 
+0.78125 0.59375 0.0625 
+0.78125 0.71875 0.0625 
+0.78125 0.6875 0.09375 
+0.8125 0.65625 0.09375 
+0.78125 0.71875 0.1875 
+0.8125 0.71875 0.15625 
+0.84375 0.6875 0.15625 
+0.90625 0.71875 0.1875 
+0.84375 0.8125 0.03125 
+0.96875 0.8125 0.03125 
+0.9375 0.84375 0.03125 
+0.90625 0.84375 0.0625 
+0.96875 0.9375 0.03125 
+0.96875 0.90625 0.0625 
+0.9375 0.90625 0.09375 
+0.96875 0.9375 0.15625 
+0.84375 0.78125 0.0625 
+0.96875 0.78125 0.0625 
+0.9375 0.78125 0.09375 
+0.90625 0.8125 0.09375 
+0.96875 0.78125 0.1875 
+0.96875 0.8125 0.15625 
+0.9375 0.84375 0.15625 
+0.96875 0.90625 0.1875 
+0.8125 0.78125 0.09375 
+0.8125 0.78125 0.21875 
+0.84375 0.78125 0.1875 
+0.84375 0.8125 0.15625 
+0.9375 0.78125 0.21875 
+0.90625 0.8125 0.21875 
+0.90625 0.84375 0.1875 
+0.9375 0.90625 0.21875 
+0.84375 0.8125 0.28125 
+0.96875 0.8125 0.28125 
+0.9375 0.84375 0.28125 
+0.90625 0.84375 0.3125 
+0.96875 0.9375 0.28125 
+0.96875 0.90625 0.3125 
+0.9375 0.90625 0.34375 
+0.96875 0.9375 0.40625 
+0.59375 0.53125 0.0625 
+0.71875 0.53125 0.0625 
+0.6875 0.53125 0.09375 
+0.65625 0.5625 0.09375 
+0.71875 0.53125 0.1875 
+0.71875 0.5625 0.15625 
+0.6875 0.59375 0.15625 
+0.71875 0.65625 0.1875 
+0.84375 0.53125 0.0625 
+0.96875 0.53125 0.0625 
+0.9375 0.53125 0.09375 
+0.90625 0.5625 0.09375 
+0.96875 0.53125 0.1875 
+0.96875 0.5625 0.15625 
+0.9375 0.59375 0.15625 
+0.96875 0.65625 0.1875 
+0.8125 0.53125 0.09375 
+0.8125 0.53125 0.21875 
+0.84375 0.53125 0.1875 
+0.84375 0.5625 0.15625 
+0.9375 0.53125 0.21875 
+0.90625 0.5625 0.21875 
+0.90625 0.59375 0.1875 
+0.9375 0.65625 0.21875 
+0.78125 0.5625 0.09375 
+0.78125 0.5625 0.21875 
+0.78125 0.59375 0.1875 
+0.8125 0.59375 0.15625 
+0.78125 0.6875 0.21875 
+0.8125 0.65625 0.21875 
+0.84375 0.65625 0.1875 
+0.90625 0.6875 0.21875 
+0.84375 0.53125 0.3125 
+0.96875 0.53125 0.3125 
+0.9375 0.53125 0.34375 
+0.90625 0.5625 0.34375 
+0.96875 0.53125 0.4375 
+0.96875 0.5625 0.40625 
+0.9375 0.59375 0.40625 
+0.96875 0.65625 0.4375 
+0.84375 0.5625 0.28125 
+0.96875 0.5625 0.28125 
+0.9375 0.59375 0.28125 
+0.90625 0.59375 0.3125 
+0.96875 0.6875 0.28125 
+0.96875 0.65625 0.3125 
+0.9375 0.65625 0.34375 
+0.96875 0.6875 0.40625 
+0.8125 0.59375 0.28125 
+0.8125 0.71875 0.28125 
+0.84375 0.6875 0.28125 
+0.84375 0.65625 0.3125 
+0.9375 0.71875 0.28125 
+0.90625 0.71875 0.3125 
+0.90625 0.6875 0.34375 
+0.9375 0.71875 0.40625 
+0.84375 0.78125 0.3125 
+0.96875 0.78125 0.3125 
+0.9375 0.78125 0.34375 
+0.90625 0.8125 0.34375 
+0.96875 0.78125 0.4375 
+0.96875 0.8125 0.40625 
+0.9375 0.84375 0.40625 
+0.96875 0.90625 0.4375 
+0.5625 0.59375 0.03125 
+0.5625 0.71875 0.03125 
+0.59375 0.6875 0.03125 
+0.59375 0.65625 0.0625 
+0.6875 0.71875 0.03125 
+0.65625 0.71875 0.0625 
+0.65625 0.6875 0.09375 
+0.6875 0.71875 0.15625 
+0.5625 0.84375 0.03125 
+0.5625 0.96875 0.03125 
+0.59375 0.9375 0.03125 
+0.59375 0.90625 0.0625 
+0.6875 0.96875 0.03125 
+0.65625 0.96875 0.0625 
+0.65625 0.9375 0.09375 
+0.6875 0.96875 0.15625 
+0.59375 0.8125 0.03125 
+0.71875 0.8125 0.03125 
+0.6875 0.84375 0.03125 
+0.65625 0.84375 0.0625 
+0.71875 0.9375 0.03125 
+0.71875 0.90625 0.0625 
+0.6875 0.90625 0.09375 
+0.71875 0.9375 0.15625 
+0.59375 0.78125 0.0625 
+0.71875 0.78125 0.0625 
+0.6875 0.78125 0.09375 
+0.65625 0.8125 0.09375 
+0.71875 0.78125 0.1875 
+0.71875 0.8125 0.15625 
+0.6875 0.84375 0.15625 
+0.71875 0.90625 0.1875 
+0.8125 0.84375 0.03125 
+0.8125 0.96875 0.03125 
+0.84375 0.9375 0.03125 
+0.84375 0.90625 0.0625 
+0.9375 0.96875 0.03125 
+0.90625 0.96875 0.0625 
+0.90625 0.9375 0.09375 
+0.9375 0.96875 0.15625 
+0.78125 0.84375 0.0625 
+0.78125 0.96875 0.0625 
+0.78125 0.9375 0.09375 
+0.8125 0.90625 0.09375 
+0.78125 0.96875 0.1875 
+0.8125 0.96875 0.15625 
+0.84375 0.9375 0.15625 
+0.90625 0.96875 0.1875 
+0.78125 0.8125 0.09375 
+0.78125 0.8125 0.21875 
+0.78125 0.84375 0.1875 
+0.8125 0.84375 0.15625 
+0.78125 0.9375 0.21875 
+0.8125 0.90625 0.21875 
+0.84375 0.90625 0.1875 
+0.90625 0.9375 0.21875 
+0.8125 0.84375 0.28125 
+0.8125 0.96875 0.28125 
+0.84375 0.9375 0.28125 
+0.84375 0.90625 0.3125 
+0.9375 0.96875 0.28125 
+0.90625 0.96875 0.3125 
+0.90625 0.9375 0.34375 
+0.9375 0.96875 0.40625 
+0.53125 0.59375 0.0625 
+0.53125 0.71875 0.0625 
+0.53125 0.6875 0.09375 
+0.5625 0.65625 0.09375 
+0.53125 0.71875 0.1875 
+0.5625 0.71875 0.15625 
+0.59375 0.6875 0.15625 
+0.65625 0.71875 0.1875 
+0.53125 0.84375 0.0625 
+0.53125 0.96875 0.0625 
+0.53125 0.9375 0.09375 
+0.5625 0.90625 0.09375 
+0.53125 0.96875 0.1875 
+0.5625 0.96875 0.15625 
+0.59375 0.9375 0.15625 
+0.65625 0.96875 0.1875 
+0.53125 0.8125 0.09375 
+0.53125 0.8125 0.21875 
+0.53125 0.84375 0.1875 
+0.5625 0.84375 0.15625 
+0.53125 0.9375 0.21875 
+0.5625 0.90625 0.21875 
+0.59375 0.90625 0.1875 
+0.65625 0.9375 0.21875 
+0.5625 0.78125 0.09375 
+0.5625 0.78125 0.21875 
+0.59375 0.78125 0.1875 
+0.59375 0.8125 0.15625 
+0.6875 0.78125 0.21875 
+0.65625 0.8125 0.21875 
+0.65625 0.84375 0.1875 
+0.6875 0.90625 0.21875 
+0.53125 0.84375 0.3125 
+0.53125 0.96875 0.3125 
+0.53125 0.9375 0.34375 
+0.5625 0.90625 0.34375 
+0.53125 0.96875 0.4375 
+0.5625 0.96875 0.40625 
+0.59375 0.9375 0.40625 
+0.65625 0.96875 0.4375 
+0.5625 0.84375 0.28125 
+0.5625 0.96875 0.28125 
+0.59375 0.9375 0.28125 
+0.59375 0.90625 0.3125 
+0.6875 0.96875 0.28125 
+0.65625 0.96875 0.3125 
+0.65625 0.9375 0.34375 
+0.6875 0.96875 0.40625 
+0.59375 0.8125 0.28125 
+0.71875 0.8125 0.28125 
+0.6875 0.84375 0.28125 
+0.65625 0.84375 0.3125 
+0.71875 0.9375 0.28125 
+0.71875 0.90625 0.3125 
+0.6875 0.90625 0.34375 
+0.71875 0.9375 0.40625 
+0.78125 0.84375 0.3125 
+0.78125 0.96875 0.3125 
+0.78125 0.9375 0.34375 
+0.8125 0.90625 0.34375 
+0.78125 0.96875 0.4375 
+0.8125 0.96875 0.40625 
+0.84375 0.9375 0.40625 
+0.90625 0.96875 0.4375 
+0.5625 0.53125 0.09375 
+0.5625 0.53125 0.21875 
+0.59375 0.53125 0.1875 
+0.59375 0.5625 0.15625 
+0.6875 0.53125 0.21875 
+0.65625 0.5625 0.21875 
+0.65625 0.59375 0.1875 
+0.6875 0.65625 0.21875 
+0.71875 0.53125 0.3125 
+0.6875 0.53125 0.34375 
+0.71875 0.65625 0.4375 
+0.71875 0.5625 0.28125 
+0.6875 0.59375 0.28125 
+0.65625 0.59375 0.3125 
+0.71875 0.6875 0.28125 
+0.71875 0.65625 0.3125 
+0.6875 0.65625 0.34375 
+0.71875 0.6875 0.40625 
+0.8125 0.53125 0.34375 
+0.8125 0.53125 0.46875 
+0.84375 0.53125 0.4375 
+0.84375 0.5625 0.40625 
+0.9375 0.53125 0.46875 
+0.90625 0.5625 0.46875 
+0.90625 0.59375 0.4375 
+0.9375 0.65625 0.46875 
+0.78125 0.5625 0.34375 
+0.78125 0.59375 0.4375 
+0.8125 0.59375 0.40625 
+0.78125 0.6875 0.46875 
+0.8125 0.65625 0.46875 
+0.84375 0.65625 0.4375 
+0.90625 0.6875 0.46875 
+0.78125 0.59375 0.3125 
+0.78125 0.71875 0.3125 
+0.78125 0.6875 0.34375 
+0.8125 0.65625 0.34375 
+0.78125 0.71875 0.4375 
+0.8125 0.71875 0.40625 
+0.84375 0.6875 0.40625 
+0.90625 0.71875 0.4375 
+0.8125 0.78125 0.34375 
+0.8125 0.78125 0.46875 
+0.84375 0.78125 0.4375 
+0.84375 0.8125 0.40625 
+0.9375 0.78125 0.46875 
+0.90625 0.8125 0.46875 
+0.90625 0.84375 0.4375 
+0.9375 0.90625 0.46875 
+0.53125 0.5625 0.09375 
+0.53125 0.5625 0.21875 
+0.53125 0.59375 0.1875 
+0.5625 0.59375 0.15625 
+0.53125 0.6875 0.21875 
+0.5625 0.65625 0.21875 
+0.59375 0.65625 0.1875 
+0.65625 0.6875 0.21875 
+0.53125 0.71875 0.3125 
+0.53125 0.6875 0.34375 
+0.65625 0.71875 0.4375 
+0.5625 0.71875 0.28125 
+0.59375 0.6875 0.28125 
+0.59375 0.65625 0.3125 
+0.6875 0.71875 0.28125 
+0.65625 0.71875 0.3125 
+0.65625 0.6875 0.34375 
+0.6875 0.71875 0.40625 
+0.53125 0.8125 0.34375 
+0.53125 0.8125 0.46875 
+0.53125 0.84375 0.4375 
+0.5625 0.84375 0.40625 
+0.53125 0.9375 0.46875 
+0.5625 0.90625 0.46875 
+0.59375 0.90625 0.4375 
+0.65625 0.9375 0.46875 
+0.5625 0.78125 0.34375 
+0.59375 0.78125 0.4375 
+0.59375 0.8125 0.40625 
+0.6875 0.78125 0.46875 
+0.65625 0.8125 0.46875 
+0.65625 0.84375 0.4375 
+0.6875 0.90625 0.46875 
+0.59375 0.78125 0.3125 
+0.71875 0.78125 0.3125 
+0.6875 0.78125 0.34375 
+0.65625 0.8125 0.34375 
+0.71875 0.78125 0.4375 
+0.71875 0.8125 0.40625 
+0.6875 0.84375 0.40625 
+0.71875 0.90625 0.4375 
+0.78125 0.8125 0.34375 
+0.78125 0.8125 0.46875 
+0.78125 0.84375 0.4375 
+0.8125 0.84375 0.40625 
+0.78125 0.9375 0.46875 
+0.8125 0.90625 0.46875 
+0.84375 0.90625 0.4375 
+0.90625 0.9375 0.46875 
+0.09375 0.0625 0.53125 
+0.21875 0.0625 0.53125 
+0.1875 0.09375 0.53125 
+0.15625 0.09375 0.5625 
+0.21875 0.1875 0.53125 
+0.21875 0.15625 0.5625 
+0.1875 0.15625 0.59375 
+0.21875 0.1875 0.65625 
+0.34375 0.0625 0.53125 
+0.46875 0.0625 0.53125 
+0.4375 0.09375 0.53125 
+0.40625 0.09375 0.5625 
+0.46875 0.1875 0.53125 
+0.46875 0.15625 0.5625 
+0.4375 0.15625 0.59375 
+0.46875 0.1875 0.65625 
+0.3125 0.09375 0.53125 
+0.3125 0.21875 0.53125 
+0.34375 0.1875 0.53125 
+0.34375 0.15625 0.5625 
+0.40625 0.21875 0.5625 
+0.40625 0.1875 0.59375 
+0.4375 0.21875 0.65625 
+0.28125 0.09375 0.5625 
+0.28125 0.21875 0.5625 
+0.28125 0.1875 0.59375 
+0.3125 0.15625 0.59375 
+0.28125 0.21875 0.6875 
+0.3125 0.21875 0.65625 
+0.34375 0.1875 0.65625 
+0.40625 0.21875 0.6875 
+0.34375 0.28125 0.5625 
+0.46875 0.28125 0.6875 
+0.46875 0.3125 0.65625 
+0.3125 0.28125 0.59375 
+0.3125 0.28125 0.71875 
+0.34375 0.28125 0.6875 
+0.34375 0.3125 0.65625 
+0.4375 0.28125 0.71875 
+0.40625 0.3125 0.71875 
+0.40625 0.34375 0.6875 
+0.34375 0.3125 0.78125 
+0.46875 0.3125 0.78125 
+0.4375 0.34375 0.78125 
+0.40625 0.34375 0.8125 
+0.46875 0.4375 0.78125 
+0.46875 0.40625 0.8125 
+0.4375 0.40625 0.84375 
+0.46875 0.4375 0.90625 
+0.09375 0.03125 0.5625 
+0.21875 0.03125 0.5625 
+0.1875 0.03125 0.59375 
+0.15625 0.0625 0.59375 
+0.21875 0.03125 0.6875 
+0.21875 0.0625 0.65625 
+0.1875 0.09375 0.65625 
+0.21875 0.15625 0.6875 
+0.34375 0.03125 0.5625 
+0.46875 0.03125 0.5625 
+0.4375 0.03125 0.59375 
+0.40625 0.0625 0.59375 
+0.46875 0.03125 0.6875 
+0.46875 0.0625 0.65625 
+0.4375 0.09375 0.65625 
+0.46875 0.15625 0.6875 
+0.3125 0.03125 0.59375 
+0.3125 0.03125 0.71875 
+0.34375 0.03125 0.6875 
+0.34375 0.0625 0.65625 
+0.4375 0.03125 0.71875 
+0.40625 0.0625 0.71875 
+0.40625 0.09375 0.6875 
+0.4375 0.15625 0.71875 
+0.28125 0.0625 0.59375 
+0.28125 0.0625 0.71875 
+0.28125 0.09375 0.6875 
+0.3125 0.09375 0.65625 
+0.28125 0.1875 0.71875 
+0.3125 0.15625 0.71875 
+0.34375 0.15625 0.6875 
+0.40625 0.1875 0.71875 
+0.34375 0.03125 0.8125 
+0.46875 0.03125 0.8125 
+0.4375 0.03125 0.84375 
+0.40625 0.0625 0.84375 
+0.46875 0.03125 0.9375 
+0.46875 0.0625 0.90625 
+0.4375 0.09375 0.90625 
+0.46875 0.15625 0.9375 
+0.34375 0.0625 0.78125 
+0.46875 0.0625 0.78125 
+0.4375 0.09375 0.78125 
+0.40625 0.09375 0.8125 
+0.46875 0.1875 0.78125 
+0.46875 0.15625 0.8125 
+0.4375 0.15625 0.84375 
+0.46875 0.1875 0.90625 
+0.3125 0.09375 0.78125 
+0.3125 0.21875 0.78125 
+0.34375 0.1875 0.78125 
+0.34375 0.15625 0.8125 
+0.4375 0.21875 0.78125 
+0.40625 0.21875 0.8125 
+0.40625 0.1875 0.84375 
+0.4375 0.21875 0.90625 
+0.34375 0.28125 0.8125 
+0.46875 0.28125 0.8125 
+0.4375 0.28125 0.84375 
+0.40625 0.3125 0.84375 
+0.46875 0.28125 0.9375 
+0.46875 0.3125 0.90625 
+0.4375 0.34375 0.90625 
+0.46875 0.40625 0.9375 
+0.0625 0.09375 0.53125 
+0.0625 0.21875 0.53125 
+0.09375 0.1875 0.53125 
+0.09375 0.15625 0.5625 
+0.1875 0.21875 0.53125 
+0.15625 0.21875 0.5625 
+0.15625 0.1875 0.59375 
+0.1875 0.21875 0.65625 
+0.0625 0.34375 0.53125 
+0.0625 0.46875 0.53125 
+0.09375 0.4375 0.53125 
+0.09375 0.40625 0.5625 
+0.1875 0.46875 0.53125 
+0.15625 0.46875 0.5625 
+0.15625 0.4375 0.59375 
+0.1875 0.46875 0.65625 
+0.09375 0.3125 0.53125 
+0.21875 0.3125 0.53125 
+0.1875 0.34375 0.53125 
+0.15625 0.34375 0.5625 
+0.21875 0.40625 0.5625 
+0.1875 0.40625 0.59375 
+0.21875 0.4375 0.65625 
+0.09375 0.28125 0.5625 
+0.21875 0.28125 0.5625 
+0.1875 0.28125 0.59375 
+0.15625 0.3125 0.59375 
+0.21875 0.28125 0.6875 
+0.21875 0.3125 0.65625 
+0.1875 0.34375 0.65625 
+0.21875 0.40625 0.6875 
+0.28125 0.34375 0.5625 
+0.28125 0.46875 0.6875 
+0.3125 0.46875 0.65625 
+0.28125 0.3125 0.59375 
+0.28125 0.3125 0.71875 
+0.28125 0.34375 0.6875 
+0.3125 0.34375 0.65625 
+0.28125 0.4375 0.71875 
+0.3125 0.40625 0.71875 
+0.34375 0.40625 0.6875 
+0.3125 0.34375 0.78125 
+0.3125 0.46875 0.78125 
+0.34375 0.4375 0.78125 
+0.34375 0.40625 0.8125 
+0.4375 0.46875 0.78125 
+0.40625 0.46875 0.8125 
+0.40625 0.4375 0.84375 
+0.4375 0.46875 0.90625 
+0.03125 0.09375 0.5625 
+0.03125 0.21875 0.5625 
+0.03125 0.1875 0.59375 
+0.0625 0.15625 0.59375 
+0.03125 0.21875 0.6875 
+0.0625 0.21875 0.65625 
+0.09375 0.1875 0.65625 
+0.15625 0.21875 0.6875 
+0.03125 0.34375 0.5625 
+0.03125 0.46875 0.5625 
+0.03125 0.4375 0.59375 
+0.0625 0.40625 0.59375 
+0.03125 0.46875 0.6875 
+0.0625 0.46875 0.65625 
+0.09375 0.4375 0.65625 
+0.15625 0.46875 0.6875 
+0.03125 0.3125 0.59375 
+0.03125 0.3125 0.71875 
+0.03125 0.34375 0.6875 
+0.0625 0.34375 0.65625 
+0.03125 0.4375 0.71875 
+0.0625 0.40625 0.71875 
+0.09375 0.40625 0.6875 
+0.15625 0.4375 0.71875 
+0.0625 0.28125 0.59375 
+0.0625 0.28125 0.71875 
+0.09375 0.28125 0.6875 
+0.09375 0.3125 0.65625 
+0.1875 0.28125 0.71875 
+0.15625 0.3125 0.71875 
+0.15625 0.34375 0.6875 
+0.1875 0.40625 0.71875 
+0.03125 0.34375 0.8125 
+0.03125 0.46875 0.8125 
+0.03125 0.4375 0.84375 
+0.0625 0.40625 0.84375 
+0.03125 0.46875 0.9375 
+0.0625 0.46875 0.90625 
+0.09375 0.4375 0.90625 
+0.15625 0.46875 0.9375 
+0.0625 0.34375 0.78125 
+0.0625 0.46875 0.78125 
+0.09375 0.4375 0.78125 
+0.09375 0.40625 0.8125 
+0.1875 0.46875 0.78125 
+0.15625 0.46875 0.8125 
+0.15625 0.4375 0.84375 
+0.1875 0.46875 0.90625 
+0.09375 0.3125 0.78125 
+0.21875 0.3125 0.78125 
+0.1875 0.34375 0.78125 
+0.15625 0.34375 0.8125 
+0.21875 0.4375 0.78125 
+0.21875 0.40625 0.8125 
+0.1875 0.40625 0.84375 
+0.21875 0.4375 0.90625 
+0.28125 0.34375 0.8125 
+0.28125 0.46875 0.8125 
+0.28125 0.4375 0.84375 
+0.3125 0.40625 0.84375 
+0.28125 0.46875 0.9375 
+0.3125 0.46875 0.90625 
+0.34375 0.4375 0.90625 
+0.40625 0.46875 0.9375 
+0.0625 0.03125 0.59375 
+0.0625 0.03125 0.71875 
+0.09375 0.03125 0.6875 
+0.09375 0.0625 0.65625 
+0.1875 0.03125 0.71875 
+0.15625 0.0625 0.71875 
+0.15625 0.09375 0.6875 
+0.1875 0.15625 0.71875 
+0.0625 0.03125 0.84375 
+0.0625 0.03125 0.96875 
+0.09375 0.03125 0.9375 
+0.09375 0.0625 0.90625 
+0.1875 0.03125 0.96875 
+0.15625 0.0625 0.96875 
+0.15625 0.09375 0.9375 
+0.1875 0.15625 0.96875 
+0.09375 0.03125 0.8125 
+0.21875 0.03125 0.8125 
+0.1875 0.03125 0.84375 
+0.15625 0.0625 0.84375 
+0.21875 0.03125 0.9375 
+0.21875 0.0625 0.90625 
+0.1875 0.09375 0.90625 
+0.21875 0.15625 0.9375 
+0.09375 0.0625 0.78125 
+0.21875 0.0625 0.78125 
+0.1875 0.09375 0.78125 
+0.15625 0.09375 0.8125 
+0.21875 0.1875 0.78125 
+0.21875 0.15625 0.8125 
+0.1875 0.15625 0.84375 
+0.21875 0.1875 0.90625 
+0.3125 0.03125 0.84375 
+0.3125 0.03125 0.96875 
+0.34375 0.03125 0.9375 
+0.34375 0.0625 0.90625 
+0.4375 0.03125 0.96875 
+0.40625 0.0625 0.96875 
+0.40625 0.09375 0.9375 
+0.4375 0.15625 0.96875 
+0.28125 0.0625 0.84375 
+0.28125 0.0625 0.96875 
+0.28125 0.09375 0.9375 
+0.3125 0.09375 0.90625 
+0.28125 0.1875 0.96875 
+0.3125 0.15625 0.96875 
+0.34375 0.15625 0.9375 
+0.40625 0.1875 0.96875 
+0.28125 0.09375 0.8125 
+0.28125 0.21875 0.8125 
+0.28125 0.1875 0.84375 
+0.3125 0.15625 0.84375 
+0.28125 0.21875 0.9375 
+0.3125 0.21875 0.90625 
+0.34375 0.1875 0.90625 
+0.40625 0.21875 0.9375 
+0.3125 0.28125 0.84375 
+0.3125 0.28125 0.96875 
+0.34375 0.28125 0.9375 
+0.34375 0.3125 0.90625 
+0.4375 0.28125 0.96875 
+0.40625 0.3125 0.96875 
+0.40625 0.34375 0.9375 
+0.4375 0.40625 0.96875 
+0.03125 0.0625 0.59375 
+0.03125 0.0625 0.71875 
+0.03125 0.09375 0.6875 
+0.0625 0.09375 0.65625 
+0.03125 0.1875 0.71875 
+0.0625 0.15625 0.71875 
+0.09375 0.15625 0.6875 
+0.15625 0.1875 0.71875 
+0.03125 0.0625 0.84375 
+0.03125 0.0625 0.96875 
+0.03125 0.09375 0.9375 
+0.0625 0.09375 0.90625 
+0.03125 0.1875 0.96875 
+0.0625 0.15625 0.96875 
+0.09375 0.15625 0.9375 
+0.15625 0.1875 0.96875 
+0.03125 0.09375 0.8125 
+0.03125 0.21875 0.8125 
+0.03125 0.1875 0.84375 
+0.0625 0.15625 0.84375 
+0.03125 0.21875 0.9375 
+0.0625 0.21875 0.90625 
+0.09375 0.1875 0.90625 
+0.15625 0.21875 0.9375 
+0.0625 0.09375 0.78125 
+0.0625 0.21875 0.78125 
+0.09375 0.1875 0.78125 
+0.09375 0.15625 0.8125 
+0.1875 0.21875 0.78125 
+0.15625 0.21875 0.8125 
+0.15625 0.1875 0.84375 
+0.1875 0.21875 0.90625 
+0.03125 0.3125 0.84375 
+0.03125 0.3125 0.96875 
+0.03125 0.34375 0.9375 
+0.0625 0.34375 0.90625 
+0.03125 0.4375 0.96875 
+0.0625 0.40625 0.96875 
+0.09375 0.40625 0.9375 
+0.15625 0.4375 0.96875 
+0.0625 0.28125 0.84375 
+0.0625 0.28125 0.96875 
+0.09375 0.28125 0.9375 
+0.09375 0.3125 0.90625 
+0.1875 0.28125 0.96875 
+0.15625 0.3125 0.96875 
+0.15625 0.34375 0.9375 
+0.1875 0.40625 0.96875 
+0.09375 0.28125 0.8125 
+0.21875 0.28125 0.8125 
+0.1875 0.28125 0.84375 
+0.15625 0.3125 0.84375 
+0.21875 0.28125 0.9375 
+0.21875 0.3125 0.90625 
+0.1875 0.34375 0.90625 
+0.21875 0.40625 0.9375 
+0.28125 0.3125 0.84375 
+0.28125 0.3125 0.96875 
+0.28125 0.34375 0.9375 
+0.3125 0.34375 0.90625 
+0.28125 0.4375 0.96875 
+0.3125 0.40625 0.96875 
+0.34375 0.40625 0.9375 
+0.40625 0.4375 0.96875 
+0.59375 0.0625 0.53125 
+0.71875 0.0625 0.53125 
+0.6875 0.09375 0.53125 
+0.65625 0.09375 0.5625 
+0.71875 0.1875 0.53125 
+0.71875 0.15625 0.5625 
+0.6875 0.15625 0.59375 
+0.71875 0.1875 0.65625 
+0.84375 0.0625 0.53125 
+0.96875 0.0625 0.53125 
+0.9375 0.09375 0.53125 
+0.90625 0.09375 0.5625 
+0.96875 0.1875 0.53125 
+0.96875 0.15625 0.5625 
+0.9375 0.15625 0.59375 
+0.96875 0.1875 0.65625 
+0.8125 0.09375 0.53125 
+0.8125 0.21875 0.53125 
+0.84375 0.1875 0.53125 
+0.84375 0.15625 0.5625 
+0.9375 0.21875 0.53125 
+0.90625 0.21875 0.5625 
+0.90625 0.1875 0.59375 
+0.9375 0.21875 0.65625 
+0.78125 0.09375 0.5625 
+0.78125 0.21875 0.5625 
+0.78125 0.1875 0.59375 
+0.8125 0.15625 0.59375 
+0.78125 0.21875 0.6875 
+0.8125 0.21875 0.65625 
+0.84375 0.1875 0.65625 
+0.90625 0.21875 0.6875 
+0.84375 0.3125 0.53125 
+0.96875 0.3125 0.53125 
+0.9375 0.34375 0.53125 
+0.90625 0.34375 0.5625 
+0.96875 0.4375 0.53125 
+0.96875 0.40625 0.5625 
+0.9375 0.40625 0.59375 
+0.96875 0.4375 0.65625 
+0.84375 0.28125 0.5625 
+0.96875 0.28125 0.5625 
+0.9375 0.28125 0.59375 
+0.90625 0.3125 0.59375 
+0.96875 0.28125 0.6875 
+0.96875 0.3125 0.65625 
+0.9375 0.34375 0.65625 
+0.96875 0.40625 0.6875 
+0.8125 0.28125 0.59375 
+0.8125 0.28125 0.71875 
+0.84375 0.28125 0.6875 
+0.84375 0.3125 0.65625 
+0.9375 0.28125 0.71875 
+0.90625 0.3125 0.71875 
+0.90625 0.34375 0.6875 
+0.9375 0.40625 0.71875 
+0.84375 0.3125 0.78125 
+0.96875 0.3125 0.78125 
+0.9375 0.34375 0.78125 
+0.90625 0.34375 0.8125 
+0.96875 0.4375 0.78125 
+0.96875 0.40625 0.8125 
+0.9375 0.40625 0.84375 
+0.96875 0.4375 0.90625 
+0.59375 0.03125 0.5625 
+0.71875 0.03125 0.5625 
+0.6875 0.03125 0.59375 
+0.65625 0.0625 0.59375 
+0.71875 0.03125 0.6875 
+0.71875 0.0625 0.65625 
+0.6875 0.09375 0.65625 
+0.71875 0.15625 0.6875 
+0.84375 0.03125 0.5625 
+0.96875 0.03125 0.5625 
+0.9375 0.03125 0.59375 
+0.90625 0.0625 0.59375 
+0.96875 0.03125 0.6875 
+0.96875 0.0625 0.65625 
+0.9375 0.09375 0.65625 
+0.96875 0.15625 0.6875 
+0.8125 0.03125 0.59375 
+0.8125 0.03125 0.71875 
+0.84375 0.03125 0.6875 
+0.84375 0.0625 0.65625 
+0.9375 0.03125 0.71875 
+0.90625 0.0625 0.71875 
+0.90625 0.09375 0.6875 
+0.9375 0.15625 0.71875 
+0.78125 0.0625 0.59375 
+0.78125 0.0625 0.71875 
+0.78125 0.09375 0.6875 
+0.8125 0.09375 0.65625 
+0.78125 0.1875 0.71875 
+0.8125 0.15625 0.71875 
+0.84375 0.15625 0.6875 
+0.90625 0.1875 0.71875 
+0.84375 0.03125 0.8125 
+0.96875 0.03125 0.8125 
+0.9375 0.03125 0.84375 
+0.90625 0.0625 0.84375 
+0.96875 0.03125 0.9375 
+0.96875 0.0625 0.90625 
+0.9375 0.09375 0.90625 
+0.96875 0.15625 0.9375 
+0.84375 0.0625 0.78125 
+0.96875 0.0625 0.78125 
+0.9375 0.09375 0.78125 
+0.90625 0.09375 0.8125 
+0.96875 0.1875 0.78125 
+0.96875 0.15625 0.8125 
+0.9375 0.15625 0.84375 
+0.96875 0.1875 0.90625 
+0.8125 0.09375 0.78125 
+0.8125 0.21875 0.78125 
+0.84375 0.1875 0.78125 
+0.84375 0.15625 0.8125 
+0.9375 0.21875 0.78125 
+0.90625 0.21875 0.8125 
+0.90625 0.1875 0.84375 
+0.9375 0.21875 0.90625 
+0.84375 0.28125 0.8125 
+0.96875 0.28125 0.8125 
+0.9375 0.28125 0.84375 
+0.90625 0.3125 0.84375 
+0.96875 0.28125 0.9375 
+0.96875 0.3125 0.90625 
+0.9375 0.34375 0.90625 
+0.96875 0.40625 0.9375 
+0.5625 0.09375 0.53125 
+0.5625 0.21875 0.53125 
+0.59375 0.1875 0.53125 
+0.59375 0.15625 0.5625 
+0.6875 0.21875 0.53125 
+0.65625 0.21875 0.5625 
+0.65625 0.1875 0.59375 
+0.6875 0.21875 0.65625 
+0.71875 0.3125 0.53125 
+0.6875 0.34375 0.53125 
+0.71875 0.4375 0.65625 
+0.71875 0.28125 0.5625 
+0.6875 0.28125 0.59375 
+0.65625 0.3125 0.59375 
+0.71875 0.28125 0.6875 
+0.71875 0.3125 0.65625 
+0.6875 0.34375 0.65625 
+0.71875 0.40625 0.6875 
+0.8125 0.34375 0.53125 
+0.8125 0.46875 0.53125 
+0.84375 0.4375 0.53125 
+0.84375 0.40625 0.5625 
+0.9375 0.46875 0.53125 
+0.90625 0.46875 0.5625 
+0.90625 0.4375 0.59375 
+0.9375 0.46875 0.65625 
+0.78125 0.34375 0.5625 
+0.78125 0.4375 0.59375 
+0.8125 0.40625 0.59375 
+0.78125 0.46875 0.6875 
+0.8125 0.46875 0.65625 
+0.84375 0.4375 0.65625 
+0.90625 0.46875 0.6875 
+0.78125 0.3125 0.59375 
+0.78125 0.3125 0.71875 
+0.78125 0.34375 0.6875 
+0.8125 0.34375 0.65625 
+0.78125 0.4375 0.71875 
+0.8125 0.40625 0.71875 
+0.84375 0.40625 0.6875 
+0.90625 0.4375 0.71875 
+0.8125 0.34375 0.78125 
+0.8125 0.46875 0.78125 
+0.84375 0.4375 0.78125 
+0.84375 0.40625 0.8125 
+0.9375 0.46875 0.78125 
+0.90625 0.46875 0.8125 
+0.90625 0.4375 0.84375 
+0.9375 0.46875 0.90625 
+0.53125 0.09375 0.5625 
+0.53125 0.21875 0.5625 
+0.53125 0.1875 0.59375 
+0.5625 0.15625 0.59375 
+0.53125 0.21875 0.6875 
+0.5625 0.21875 0.65625 
+0.59375 0.1875 0.65625 
+0.65625 0.21875 0.6875 
+0.53125 0.3125 0.71875 
+0.53125 0.34375 0.6875 
+0.65625 0.4375 0.71875 
+0.5625 0.28125 0.71875 
+0.59375 0.28125 0.6875 
+0.59375 0.3125 0.65625 
+0.6875 0.28125 0.71875 
+0.65625 0.3125 0.71875 
+0.65625 0.34375 0.6875 
+0.6875 0.40625 0.71875 
+0.53125 0.34375 0.8125 
+0.53125 0.46875 0.8125 
+0.53125 0.4375 0.84375 
+0.5625 0.40625 0.84375 
+0.53125 0.46875 0.9375 
+0.5625 0.46875 0.90625 
+0.59375 0.4375 0.90625 
+0.65625 0.46875 0.9375 
+0.5625 0.34375 0.78125 
+0.59375 0.4375 0.78125 
+0.59375 0.40625 0.8125 
+0.6875 0.46875 0.78125 
+0.65625 0.46875 0.8125 
+0.65625 0.4375 0.84375 
+0.6875 0.46875 0.90625 
+0.59375 0.3125 0.78125 
+0.71875 0.3125 0.78125 
+0.6875 0.34375 0.78125 
+0.65625 0.34375 0.8125 
+0.71875 0.4375 0.78125 
+0.71875 0.40625 0.8125 
+0.6875 0.40625 0.84375 
+0.71875 0.4375 0.90625 
+0.78125 0.34375 0.8125 
+0.78125 0.46875 0.8125 
+0.78125 0.4375 0.84375 
+0.8125 0.40625 0.84375 
+0.78125 0.46875 0.9375 
+0.8125 0.46875 0.90625 
+0.84375 0.4375 0.90625 
+0.90625 0.46875 0.9375 
+0.5625 0.03125 0.59375 
+0.5625 0.03125 0.71875 
+0.59375 0.03125 0.6875 
+0.59375 0.0625 0.65625 
+0.6875 0.03125 0.71875 
+0.65625 0.0625 0.71875 
+0.65625 0.09375 0.6875 
+0.6875 0.15625 0.71875 
+0.5625 0.03125 0.84375 
+0.5625 0.03125 0.96875 
+0.59375 0.03125 0.9375 
+0.59375 0.0625 0.90625 
+0.6875 0.03125 0.96875 
+0.65625 0.0625 0.96875 
+0.65625 0.09375 0.9375 
+0.6875 0.15625 0.96875 
+0.59375 0.03125 0.8125 
+0.71875 0.03125 0.8125 
+0.6875 0.03125 0.84375 
+0.65625 0.0625 0.84375 
+0.71875 0.03125 0.9375 
+0.71875 0.0625 0.90625 
+0.6875 0.09375 0.90625 
+0.71875 0.15625 0.9375 
+0.59375 0.0625 0.78125 
+0.71875 0.0625 0.78125 
+0.6875 0.09375 0.78125 
+0.65625 0.09375 0.8125 
+0.71875 0.1875 0.78125 
+0.71875 0.15625 0.8125 
+0.6875 0.15625 0.84375 
+0.71875 0.1875 0.90625 
+0.8125 0.03125 0.84375 
+0.8125 0.03125 0.96875 
+0.84375 0.03125 0.9375 
+0.84375 0.0625 0.90625 
+0.9375 0.03125 0.96875 
+0.90625 0.0625 0.96875 
+0.90625 0.09375 0.9375 
+0.9375 0.15625 0.96875 
+0.78125 0.0625 0.84375 
+0.78125 0.0625 0.96875 
+0.78125 0.09375 0.9375 
+0.8125 0.09375 0.90625 
+0.78125 0.1875 0.96875 
+0.8125 0.15625 0.96875 
+0.84375 0.15625 0.9375 
+0.90625 0.1875 0.96875 
+0.78125 0.09375 0.8125 
+0.78125 0.21875 0.8125 
+0.78125 0.1875 0.84375 
+0.8125 0.15625 0.84375 
+0.78125 0.21875 0.9375 
+0.8125 0.21875 0.90625 
+0.84375 0.1875 0.90625 
+0.90625 0.21875 0.9375 
+0.8125 0.28125 0.84375 
+0.8125 0.28125 0.96875 
+0.84375 0.28125 0.9375 
+0.84375 0.3125 0.90625 
+0.9375 0.28125 0.96875 
+0.90625 0.3125 0.96875 
+0.90625 0.34375 0.9375 
+0.9375 0.40625 0.96875 
+0.53125 0.0625 0.59375 
+0.53125 0.0625 0.71875 
+0.53125 0.09375 0.6875 
+0.5625 0.09375 0.65625 
+0.53125 0.1875 0.71875 
+0.5625 0.15625 0.71875 
+0.59375 0.15625 0.6875 
+0.65625 0.1875 0.71875 
+0.53125 0.0625 0.84375 
+0.53125 0.0625 0.96875 
+0.53125 0.09375 0.9375 
+0.5625 0.09375 0.90625 
+0.53125 0.1875 0.96875 
+0.5625 0.15625 0.96875 
+0.59375 0.15625 0.9375 
+0.65625 0.1875 0.96875 
+0.53125 0.09375 0.8125 
+0.53125 0.21875 0.8125 
+0.53125 0.1875 0.84375 
+0.5625 0.15625 0.84375 
+0.53125 0.21875 0.9375 
+0.5625 0.21875 0.90625 
+0.59375 0.1875 0.90625 
+0.65625 0.21875 0.9375 
+0.5625 0.09375 0.78125 
+0.5625 0.21875 0.78125 
+0.59375 0.1875 0.78125 
+0.59375 0.15625 0.8125 
+0.6875 0.21875 0.78125 
+0.65625 0.21875 0.8125 
+0.65625 0.1875 0.84375 
+0.6875 0.21875 0.90625 
+0.53125 0.3125 0.84375 
+0.53125 0.3125 0.96875 
+0.53125 0.34375 0.9375 
+0.5625 0.34375 0.90625 
+0.53125 0.4375 0.96875 
+0.5625 0.40625 0.96875 
+0.59375 0.40625 0.9375 
+0.65625 0.4375 0.96875 
+0.5625 0.28125 0.84375 
+0.5625 0.28125 0.96875 
+0.59375 0.28125 0.9375 
+0.59375 0.3125 0.90625 
+0.6875 0.28125 0.96875 
+0.65625 0.3125 0.96875 
+0.65625 0.34375 0.9375 
+0.6875 0.40625 0.96875 
+0.59375 0.28125 0.8125 
+0.71875 0.28125 0.8125 
+0.6875 0.28125 0.84375 
+0.65625 0.3125 0.84375 
+0.71875 0.28125 0.9375 
+0.71875 0.3125 0.90625 
+0.6875 0.34375 0.90625 
+0.71875 0.40625 0.9375 
+0.78125 0.3125 0.84375 
+0.78125 0.3125 0.96875 
+0.78125 0.34375 0.9375 
+0.8125 0.34375 0.90625 
+0.78125 0.4375 0.96875 
+0.8125 0.40625 0.96875 
+0.84375 0.40625 0.9375 
+0.90625 0.4375 0.96875 
+0.09375 0.5625 0.53125 
+0.21875 0.5625 0.53125 
+0.1875 0.59375 0.53125 
+0.15625 0.59375 0.5625 
+0.21875 0.6875 0.53125 
+0.21875 0.65625 0.5625 
+0.1875 0.65625 0.59375 
+0.21875 0.6875 0.65625 
+0.3125 0.71875 0.53125 
+0.34375 0.6875 0.53125 
+0.4375 0.71875 0.65625 
+0.28125 0.71875 0.5625 
+0.28125 0.6875 0.59375 
+0.3125 0.65625 0.59375 
+0.28125 0.71875 0.6875 
+0.3125 0.71875 0.65625 
+0.34375 0.6875 0.65625 
+0.40625 0.71875 0.6875 
+0.34375 0.8125 0.53125 
+0.46875 0.8125 0.53125 
+0.4375 0.84375 0.53125 
+0.40625 0.84375 0.5625 
+0.46875 0.9375 0.53125 
+0.46875 0.90625 0.5625 
+0.4375 0.90625 0.59375 
+0.46875 0.9375 0.65625 
+0.34375 0.78125 0.5625 
+0.4375 0.78125 0.59375 
+0.40625 0.8125 0.59375 
+0.46875 0.78125 0.6875 
+0.46875 0.8125 0.65625 
+0.4375 0.84375 0.65625 
+0.46875 0.90625 0.6875 
+0.3125 0.78125 0.59375 
+0.3125 0.78125 0.71875 
+0.34375 0.78125 0.6875 
+0.34375 0.8125 0.65625 
+0.4375 0.78125 0.71875 
+0.40625 0.8125 0.71875 
+0.40625 0.84375 0.6875 
+0.4375 0.90625 0.71875 
+0.34375 0.8125 0.78125 
+0.46875 0.8125 0.78125 
+0.4375 0.84375 0.78125 
+0.40625 0.84375 0.8125 
+0.46875 0.9375 0.78125 
+0.46875 0.90625 0.8125 
+0.4375 0.90625 0.84375 
+0.46875 0.9375 0.90625 
+0.09375 0.53125 0.5625 
+0.21875 0.53125 0.5625 
+0.1875 0.53125 0.59375 
+0.15625 0.5625 0.59375 
+0.21875 0.53125 0.6875 
+0.21875 0.5625 0.65625 
+0.1875 0.59375 0.65625 
+0.21875 0.65625 0.6875 
+0.3125 0.53125 0.71875 
+0.34375 0.53125 0.6875 
+0.4375 0.65625 0.71875 
+0.28125 0.5625 0.71875 
+0.28125 0.59375 0.6875 
+0.3125 0.59375 0.65625 
+0.28125 0.6875 0.71875 
+0.3125 0.65625 0.71875 
+0.34375 0.65625 0.6875 
+0.40625 0.6875 0.71875 
+0.34375 0.53125 0.8125 
+0.46875 0.53125 0.8125 
+0.4375 0.53125 0.84375 
+0.40625 0.5625 0.84375 
+0.46875 0.53125 0.9375 
+0.46875 0.5625 0.90625 
+0.4375 0.59375 0.90625 
+0.46875 0.65625 0.9375 
+0.34375 0.5625 0.78125 
+0.4375 0.59375 0.78125 
+0.40625 0.59375 0.8125 
+0.46875 0.6875 0.78125 
+0.46875 0.65625 0.8125 
+0.4375 0.65625 0.84375 
+0.46875 0.6875 0.90625 
+0.3125 0.59375 0.78125 
+0.3125 0.71875 0.78125 
+0.34375 0.6875 0.78125 
+0.34375 0.65625 0.8125 
+0.4375 0.71875 0.78125 
+0.40625 0.71875 0.8125 
+0.40625 0.6875 0.84375 
+0.4375 0.71875 0.90625 
+0.34375 0.78125 0.8125 
+0.46875 0.78125 0.8125 
+0.4375 0.78125 0.84375 
+0.40625 0.8125 0.84375 
+0.46875 0.78125 0.9375 
+0.46875 0.8125 0.90625 
+0.4375 0.84375 0.90625 
+0.46875 0.90625 0.9375 
+0.0625 0.59375 0.53125 
+0.0625 0.71875 0.53125 
+0.09375 0.6875 0.53125 
+0.09375 0.65625 0.5625 
+0.1875 0.71875 0.53125 
+0.15625 0.71875 0.5625 
+0.15625 0.6875 0.59375 
+0.1875 0.71875 0.65625 
+0.0625 0.84375 0.53125 
+0.0625 0.96875 0.53125 
+0.09375 0.9375 0.53125 
+0.09375 0.90625 0.5625 
+0.1875 0.96875 0.53125 
+0.15625 0.96875 0.5625 
+0.15625 0.9375 0.59375 
+0.1875 0.96875 0.65625 
+0.09375 0.8125 0.53125 
+0.21875 0.8125 0.53125 
+0.1875 0.84375 0.53125 
+0.15625 0.84375 0.5625 
+0.21875 0.9375 0.53125 
+0.21875 0.90625 0.5625 
+0.1875 0.90625 0.59375 
+0.21875 0.9375 0.65625 
+0.09375 0.78125 0.5625 
+0.21875 0.78125 0.5625 
+0.1875 0.78125 0.59375 
+0.15625 0.8125 0.59375 
+0.21875 0.78125 0.6875 
+0.21875 0.8125 0.65625 
+0.1875 0.84375 0.65625 
+0.21875 0.90625 0.6875 
+0.3125 0.84375 0.53125 
+0.3125 0.96875 0.53125 
+0.34375 0.9375 0.53125 
+0.34375 0.90625 0.5625 
+0.4375 0.96875 0.53125 
+0.40625 0.96875 0.5625 
+0.40625 0.9375 0.59375 
+0.4375 0.96875 0.65625 
+0.28125 0.84375 0.5625 
+0.28125 0.96875 0.5625 
+0.28125 0.9375 0.59375 
+0.3125 0.90625 0.59375 
+0.28125 0.96875 0.6875 
+0.3125 0.96875 0.65625 
+0.34375 0.9375 0.65625 
+0.40625 0.96875 0.6875 
+0.28125 0.8125 0.59375 
+0.28125 0.8125 0.71875 
+0.28125 0.84375 0.6875 
+0.3125 0.84375 0.65625 
+0.28125 0.9375 0.71875 
+0.3125 0.90625 0.71875 
+0.34375 0.90625 0.6875 
+0.40625 0.9375 0.71875 
+0.3125 0.84375 0.78125 
+0.3125 0.96875 0.78125 
+0.34375 0.9375 0.78125 
+0.34375 0.90625 0.8125 
+0.4375 0.96875 0.78125 
+0.40625 0.96875 0.8125 
+0.40625 0.9375 0.84375 
+0.4375 0.96875 0.90625 
+0.03125 0.59375 0.5625 
+0.03125 0.71875 0.5625 
+0.03125 0.6875 0.59375 
+0.0625 0.65625 0.59375 
+0.03125 0.71875 0.6875 
+0.0625 0.71875 0.65625 
+0.09375 0.6875 0.65625 
+0.15625 0.71875 0.6875 
+0.03125 0.84375 0.5625 
+0.03125 0.96875 0.5625 
+0.03125 0.9375 0.59375 
+0.0625 0.90625 0.59375 
+0.03125 0.96875 0.6875 
+0.0625 0.96875 0.65625 
+0.09375 0.9375 0.65625 
+0.15625 0.96875 0.6875 
+0.03125 0.8125 0.59375 
+0.03125 0.8125 0.71875 
+0.03125 0.84375 0.6875 
+0.0625 0.84375 0.65625 
+0.03125 0.9375 0.71875 
+0.0625 0.90625 0.71875 
+0.09375 0.90625 0.6875 
+0.15625 0.9375 0.71875 
+0.0625 0.78125 0.59375 
+0.0625 0.78125 0.71875 
+0.09375 0.78125 0.6875 
+0.09375 0.8125 0.65625 
+0.1875 0.78125 0.71875 
+0.15625 0.8125 0.71875 
+0.15625 0.84375 0.6875 
+0.1875 0.90625 0.71875 
+0.03125 0.84375 0.8125 
+0.03125 0.96875 0.8125 
+0.03125 0.9375 0.84375 
+0.0625 0.90625 0.84375 
+0.03125 0.96875 0.9375 
+0.0625 0.96875 0.90625 
+0.09375 0.9375 0.90625 
+0.15625 0.96875 0.9375 
+0.0625 0.84375 0.78125 
+0.0625 0.96875 0.78125 
+0.09375 0.9375 0.78125 
+0.09375 0.90625 0.8125 
+0.1875 0.96875 0.78125 
+0.15625 0.96875 0.8125 
+0.15625 0.9375 0.84375 
+0.1875 0.96875 0.90625 
+0.09375 0.8125 0.78125 
+0.21875 0.8125 0.78125 
+0.1875 0.84375 0.78125 
+0.15625 0.84375 0.8125 
+0.21875 0.9375 0.78125 
+0.21875 0.90625 0.8125 
+0.1875 0.90625 0.84375 
+0.21875 0.9375 0.90625 
+0.28125 0.84375 0.8125 
+0.28125 0.96875 0.8125 
+0.28125 0.9375 0.84375 
+0.3125 0.90625 0.84375 
+0.28125 0.96875 0.9375 
+0.3125 0.96875 0.90625 
+0.34375 0.9375 0.90625 
+0.40625 0.96875 0.9375 
+0.0625 0.53125 0.59375 
+0.0625 0.53125 0.71875 
+0.09375 0.53125 0.6875 
+0.09375 0.5625 0.65625 
+0.1875 0.53125 0.71875 
+0.15625 0.5625 0.71875 
+0.15625 0.59375 0.6875 
+0.1875 0.65625 0.71875 
+0.0625 0.53125 0.84375 
+0.0625 0.53125 0.96875 
+0.09375 0.53125 0.9375 
+0.09375 0.5625 0.90625 
+0.1875 0.53125 0.96875 
+0.15625 0.5625 0.96875 
+0.15625 0.59375 0.9375 
+0.1875 0.65625 0.96875 
+0.09375 0.53125 0.8125 
+0.21875 0.53125 0.8125 
+0.1875 0.53125 0.84375 
+0.15625 0.5625 0.84375 
+0.21875 0.53125 0.9375 
+0.21875 0.5625 0.90625 
+0.1875 0.59375 0.90625 
+0.21875 0.65625 0.9375 
+0.09375 0.5625 0.78125 
+0.21875 0.5625 0.78125 
+0.1875 0.59375 0.78125 
+0.15625 0.59375 0.8125 
+0.21875 0.6875 0.78125 
+0.21875 0.65625 0.8125 
+0.1875 0.65625 0.84375 
+0.21875 0.6875 0.90625 
+0.3125 0.53125 0.84375 
+0.3125 0.53125 0.96875 
+0.34375 0.53125 0.9375 
+0.34375 0.5625 0.90625 
+0.4375 0.53125 0.96875 
+0.40625 0.5625 0.96875 
+0.40625 0.59375 0.9375 
+0.4375 0.65625 0.96875 
+0.28125 0.5625 0.84375 
+0.28125 0.5625 0.96875 
+0.28125 0.59375 0.9375 
+0.3125 0.59375 0.90625 
+0.28125 0.6875 0.96875 
+0.3125 0.65625 0.96875 
+0.34375 0.65625 0.9375 
+0.40625 0.6875 0.96875 
+0.28125 0.59375 0.8125 
+0.28125 0.71875 0.8125 
+0.28125 0.6875 0.84375 
+0.3125 0.65625 0.84375 
+0.28125 0.71875 0.9375 
+0.3125 0.71875 0.90625 
+0.34375 0.6875 0.90625 
+0.40625 0.71875 0.9375 
+0.3125 0.78125 0.84375 
+0.3125 0.78125 0.96875 
+0.34375 0.78125 0.9375 
+0.34375 0.8125 0.90625 
+0.4375 0.78125 0.96875 
+0.40625 0.8125 0.96875 
+0.40625 0.84375 0.9375 
+0.4375 0.90625 0.96875 
+0.03125 0.5625 0.59375 
+0.03125 0.5625 0.71875 
+0.03125 0.59375 0.6875 
+0.0625 0.59375 0.65625 
+0.03125 0.6875 0.71875 
+0.0625 0.65625 0.71875 
+0.09375 0.65625 0.6875 
+0.15625 0.6875 0.71875 
+0.03125 0.5625 0.84375 
+0.03125 0.5625 0.96875 
+0.03125 0.59375 0.9375 
+0.0625 0.59375 0.90625 
+0.03125 0.6875 0.96875 
+0.0625 0.65625 0.96875 
+0.09375 0.65625 0.9375 
+0.15625 0.6875 0.96875 
+0.03125 0.59375 0.8125 
+0.03125 0.71875 0.8125 
+0.03125 0.6875 0.84375 
+0.0625 0.65625 0.84375 
+0.03125 0.71875 0.9375 
+0.0625 0.71875 0.90625 
+0.09375 0.6875 0.90625 
+0.15625 0.71875 0.9375 
+0.0625 0.59375 0.78125 
+0.0625 0.71875 0.78125 
+0.09375 0.6875 0.78125 
+0.09375 0.65625 0.8125 
+0.1875 0.71875 0.78125 
+0.15625 0.71875 0.8125 
+0.15625 0.6875 0.84375 
+0.1875 0.71875 0.90625 
+0.03125 0.8125 0.84375 
+0.03125 0.8125 0.96875 
+0.03125 0.84375 0.9375 
+0.0625 0.84375 0.90625 
+0.03125 0.9375 0.96875 
+0.0625 0.90625 0.96875 
+0.09375 0.90625 0.9375 
+0.15625 0.9375 0.96875 
+0.0625 0.78125 0.84375 
+0.0625 0.78125 0.96875 
+0.09375 0.78125 0.9375 
+0.09375 0.8125 0.90625 
+0.1875 0.78125 0.96875 
+0.15625 0.8125 0.96875 
+0.15625 0.84375 0.9375 
+0.1875 0.90625 0.96875 
+0.09375 0.78125 0.8125 
+0.21875 0.78125 0.8125 
+0.1875 0.78125 0.84375 
+0.15625 0.8125 0.84375 
+0.21875 0.78125 0.9375 
+0.21875 0.8125 0.90625 
+0.1875 0.84375 0.90625 
+0.21875 0.90625 0.9375 
+0.28125 0.8125 0.84375 
+0.28125 0.8125 0.96875 
+0.28125 0.84375 0.9375 
+0.3125 0.84375 0.90625 
+0.28125 0.9375 0.96875 
+0.3125 0.90625 0.96875 
+0.34375 0.90625 0.9375 
+0.40625 0.9375 0.96875 
+0.84375 0.5625 0.53125 
+0.96875 0.5625 0.53125 
+0.9375 0.59375 0.53125 
+0.90625 0.59375 0.5625 
+0.96875 0.6875 0.53125 
+0.96875 0.65625 0.5625 
+0.9375 0.65625 0.59375 
+0.96875 0.6875 0.65625 
+0.8125 0.71875 0.53125 
+0.84375 0.6875 0.53125 
+0.84375 0.65625 0.5625 
+0.9375 0.71875 0.53125 
+0.90625 0.71875 0.5625 
+0.90625 0.6875 0.59375 
+0.9375 0.71875 0.65625 
+0.78125 0.71875 0.5625 
+0.84375 0.6875 0.65625 
+0.90625 0.71875 0.6875 
+0.84375 0.8125 0.53125 
+0.96875 0.8125 0.53125 
+0.9375 0.84375 0.53125 
+0.90625 0.84375 0.5625 
+0.96875 0.9375 0.53125 
+0.96875 0.90625 0.5625 
+0.9375 0.90625 0.59375 
+0.96875 0.9375 0.65625 
+0.84375 0.78125 0.5625 
+0.96875 0.78125 0.5625 
+0.9375 0.78125 0.59375 
+0.90625 0.8125 0.59375 
+0.96875 0.78125 0.6875 
+0.96875 0.8125 0.65625 
+0.9375 0.84375 0.65625 
+0.96875 0.90625 0.6875 
+0.8125 0.78125 0.59375 
+0.8125 0.78125 0.71875 
+0.84375 0.78125 0.6875 
+0.84375 0.8125 0.65625 
+0.9375 0.78125 0.71875 
+0.90625 0.8125 0.71875 
+0.90625 0.84375 0.6875 
+0.9375 0.90625 0.71875 
+0.84375 0.8125 0.78125 
+0.96875 0.8125 0.78125 
+0.9375 0.84375 0.78125 
+0.90625 0.84375 0.8125 
+0.96875 0.9375 0.78125 
+0.96875 0.90625 0.8125 
+0.9375 0.90625 0.84375 
+0.96875 0.9375 0.90625 
+0.84375 0.53125 0.5625 
+0.96875 0.53125 0.5625 
+0.9375 0.53125 0.59375 
+0.90625 0.5625 0.59375 
+0.96875 0.53125 0.6875 
+0.96875 0.5625 0.65625 
+0.9375 0.59375 0.65625 
+0.96875 0.65625 0.6875 
+0.8125 0.53125 0.71875 
+0.84375 0.53125 0.6875 
+0.84375 0.5625 0.65625 
+0.9375 0.53125 0.71875 
+0.90625 0.5625 0.71875 
+0.90625 0.59375 0.6875 
+0.9375 0.65625 0.71875 
+0.78125 0.5625 0.71875 
+0.84375 0.65625 0.6875 
+0.90625 0.6875 0.71875 
+0.84375 0.53125 0.8125 
+0.96875 0.53125 0.8125 
+0.9375 0.53125 0.84375 
+0.90625 0.5625 0.84375 
+0.96875 0.53125 0.9375 
+0.96875 0.5625 0.90625 
+0.9375 0.59375 0.90625 
+0.96875 0.65625 0.9375 
+0.84375 0.5625 0.78125 
+0.96875 0.5625 0.78125 
+0.9375 0.59375 0.78125 
+0.90625 0.59375 0.8125 
+0.96875 0.6875 0.78125 
+0.96875 0.65625 0.8125 
+0.9375 0.65625 0.84375 
+0.96875 0.6875 0.90625 
+0.8125 0.59375 0.78125 
+0.8125 0.71875 0.78125 
+0.84375 0.6875 0.78125 
+0.84375 0.65625 0.8125 
+0.9375 0.71875 0.78125 
+0.90625 0.71875 0.8125 
+0.90625 0.6875 0.84375 
+0.9375 0.71875 0.90625 
+0.84375 0.78125 0.8125 
+0.96875 0.78125 0.8125 
+0.9375 0.78125 0.84375 
+0.90625 0.8125 0.84375 
+0.96875 0.78125 0.9375 
+0.96875 0.8125 0.90625 
+0.9375 0.84375 0.90625 
+0.96875 0.90625 0.9375 
+0.5625 0.84375 0.53125 
+0.5625 0.96875 0.53125 
+0.59375 0.9375 0.53125 
+0.59375 0.90625 0.5625 
+0.6875 0.96875 0.53125 
+0.65625 0.96875 0.5625 
+0.65625 0.9375 0.59375 
+0.6875 0.96875 0.65625 
+0.71875 0.8125 0.53125 
+0.6875 0.84375 0.53125 
+0.65625 0.84375 0.5625 
+0.71875 0.9375 0.53125 
+0.71875 0.90625 0.5625 
+0.6875 0.90625 0.59375 
+0.71875 0.9375 0.65625 
+0.71875 0.78125 0.5625 
+0.6875 0.84375 0.65625 
+0.71875 0.90625 0.6875 
+0.8125 0.84375 0.53125 
+0.8125 0.96875 0.53125 
+0.84375 0.9375 0.53125 
+0.84375 0.90625 0.5625 
+0.9375 0.96875 0.53125 
+0.90625 0.96875 0.5625 
+0.90625 0.9375 0.59375 
+0.9375 0.96875 0.65625 
+0.78125 0.84375 0.5625 
+0.78125 0.96875 0.5625 
+0.78125 0.9375 0.59375 
+0.8125 0.90625 0.59375 
+0.78125 0.96875 0.6875 
+0.8125 0.96875 0.65625 
+0.84375 0.9375 0.65625 
+0.90625 0.96875 0.6875 
+0.78125 0.8125 0.59375 
+0.78125 0.8125 0.71875 
+0.78125 0.84375 0.6875 
+0.8125 0.84375 0.65625 
+0.78125 0.9375 0.71875 
+0.8125 0.90625 0.71875 
+0.84375 0.90625 0.6875 
+0.90625 0.9375 0.71875 
+0.8125 0.84375 0.78125 
+0.8125 0.96875 0.78125 
+0.84375 0.9375 0.78125 
+0.84375 0.90625 0.8125 
+0.9375 0.96875 0.78125 
+0.90625 0.96875 0.8125 
+0.90625 0.9375 0.84375 
+0.9375 0.96875 0.90625 
+0.53125 0.84375 0.5625 
+0.53125 0.96875 0.5625 
+0.53125 0.9375 0.59375 
+0.5625 0.90625 0.59375 
+0.53125 0.96875 0.6875 
+0.5625 0.96875 0.65625 
+0.59375 0.9375 0.65625 
+0.65625 0.96875 0.6875 
+0.53125 0.8125 0.71875 
+0.53125 0.84375 0.6875 
+0.5625 0.84375 0.65625 
+0.53125 0.9375 0.71875 
+0.5625 0.90625 0.71875 
+0.59375 0.90625 0.6875 
+0.65625 0.9375 0.71875 
+0.5625 0.78125 0.71875 
+0.65625 0.84375 0.6875 
+0.6875 0.90625 0.71875 
+0.53125 0.84375 0.8125 
+0.53125 0.96875 0.8125 
+0.53125 0.9375 0.84375 
+0.5625 0.90625 0.84375 
+0.53125 0.96875 0.9375 
+0.5625 0.96875 0.90625 
+0.59375 0.9375 0.90625 
+0.65625 0.96875 0.9375 
+0.5625 0.84375 0.78125 
+0.5625 0.96875 0.78125 
+0.59375 0.9375 0.78125 
+0.59375 0.90625 0.8125 
+0.6875 0.96875 0.78125 
+0.65625 0.96875 0.8125 
+0.65625 0.9375 0.84375 
+0.6875 0.96875 0.90625 
+0.59375 0.8125 0.78125 
+0.71875 0.8125 0.78125 
+0.6875 0.84375 0.78125 
+0.65625 0.84375 0.8125 
+0.71875 0.9375 0.78125 
+0.71875 0.90625 0.8125 
+0.6875 0.90625 0.84375 
+0.71875 0.9375 0.90625 
+0.78125 0.84375 0.8125 
+0.78125 0.96875 0.8125 
+0.78125 0.9375 0.84375 
+0.8125 0.90625 0.84375 
+0.78125 0.96875 0.9375 
+0.8125 0.96875 0.90625 
+0.84375 0.9375 0.90625 
+0.90625 0.96875 0.9375 
+0.5625 0.53125 0.84375 
+0.5625 0.53125 0.96875 
+0.59375 0.53125 0.9375 
+0.59375 0.5625 0.90625 
+0.6875 0.53125 0.96875 
+0.65625 0.5625 0.96875 
+0.65625 0.59375 0.9375 
+0.6875 0.65625 0.96875 
+0.71875 0.53125 0.8125 
+0.6875 0.53125 0.84375 
+0.65625 0.5625 0.84375 
+0.71875 0.53125 0.9375 
+0.71875 0.5625 0.90625 
+0.6875 0.59375 0.90625 
+0.71875 0.65625 0.9375 
+0.71875 0.5625 0.78125 
+0.6875 0.65625 0.84375 
+0.71875 0.6875 0.90625 
+0.8125 0.53125 0.84375 
+0.8125 0.53125 0.96875 
+0.84375 0.53125 0.9375 
+0.84375 0.5625 0.90625 
+0.9375 0.53125 0.96875 
+0.90625 0.5625 0.96875 
+0.90625 0.59375 0.9375 
+0.9375 0.65625 0.96875 
+0.78125 0.5625 0.84375 
+0.78125 0.5625 0.96875 
+0.78125 0.59375 0.9375 
+0.8125 0.59375 0.90625 
+0.78125 0.6875 0.96875 
+0.8125 0.65625 0.96875 
+0.84375 0.65625 0.9375 
+0.90625 0.6875 0.96875 
+0.78125 0.59375 0.8125 
+0.78125 0.71875 0.8125 
+0.78125 0.6875 0.84375 
+0.8125 0.65625 0.84375 
+0.78125 0.71875 0.9375 
+0.8125 0.71875 0.90625 
+0.84375 0.6875 0.90625 
+0.90625 0.71875 0.9375 
+0.8125 0.78125 0.84375 
+0.8125 0.78125 0.96875 
+0.84375 0.78125 0.9375 
+0.84375 0.8125 0.90625 
+0.9375 0.78125 0.96875 
+0.90625 0.8125 0.96875 
+0.90625 0.84375 0.9375 
+0.9375 0.90625 0.96875 
+0.53125 0.5625 0.84375 
+0.53125 0.5625 0.96875 
+0.53125 0.59375 0.9375 
+0.5625 0.59375 0.90625 
+0.53125 0.6875 0.96875 
+0.5625 0.65625 0.96875 
+0.59375 0.65625 0.9375 
+0.65625 0.6875 0.96875 
+0.53125 0.71875 0.8125 
+0.53125 0.6875 0.84375 
+0.5625 0.65625 0.84375 
+0.53125 0.71875 0.9375 
+0.5625 0.71875 0.90625 
+0.59375 0.6875 0.90625 
+0.65625 0.71875 0.9375 
+0.5625 0.71875 0.78125 
+0.65625 0.6875 0.84375 
+0.6875 0.71875 0.90625 
+0.53125 0.8125 0.84375 
+0.53125 0.8125 0.96875 
+0.53125 0.84375 0.9375 
+0.5625 0.84375 0.90625 
+0.53125 0.9375 0.96875 
+0.5625 0.90625 0.96875 
+0.59375 0.90625 0.9375 
+0.65625 0.9375 0.96875 
+0.5625 0.78125 0.84375 
+0.5625 0.78125 0.96875 
+0.59375 0.78125 0.9375 
+0.59375 0.8125 0.90625 
+0.6875 0.78125 0.96875 
+0.65625 0.8125 0.96875 
+0.65625 0.84375 0.9375 
+0.6875 0.90625 0.96875 
+0.59375 0.78125 0.8125 
+0.71875 0.78125 0.8125 
+0.6875 0.78125 0.84375 
+0.65625 0.8125 0.84375 
+0.71875 0.78125 0.9375 
+0.71875 0.8125 0.90625 
+0.6875 0.84375 0.90625 
+0.71875 0.90625 0.9375 
+0.78125 0.8125 0.84375 
+0.78125 0.8125 0.96875 
+0.78125 0.84375 0.9375 
+0.8125 0.84375 0.90625 
+0.78125 0.9375 0.96875 
+0.8125 0.90625 0.96875 
+0.84375 0.90625 0.9375 
+0.90625 0.9375 0.96875 
+0.390625 0.34375 0.1875 
+0.421875 0.34375 0.1875 
+0.421875 0.40625 0.21875 
+0.4375 0.421875 0.265625 
+0.421875 0.390625 0.28125 
+0.484375 0.390625 0.28125 
+0.46875 0.390625 0.296875 
+0.453125 0.40625 0.296875 
+0.484375 0.40625 0.328125 
+0.46875 0.421875 0.328125 
+0.40625 0.390625 0.296875 
+0.421875 0.40625 0.328125 
+0.390625 0.1875 0.34375 
+0.421875 0.1875 0.34375 
+0.421875 0.21875 0.40625 
+0.4375 0.265625 0.421875 
+0.421875 0.28125 0.390625 
+0.484375 0.28125 0.390625 
+0.46875 0.296875 0.390625 
+0.453125 0.296875 0.40625 
+0.484375 0.328125 0.40625 
+0.46875 0.328125 0.421875 
+0.40625 0.296875 0.390625 
+0.421875 0.328125 0.40625 
+0.34375 0.390625 0.1875 
+0.34375 0.421875 0.1875 
+0.40625 0.421875 0.21875 
+0.421875 0.4375 0.265625 
+0.390625 0.421875 0.28125 
+0.390625 0.484375 0.28125 
+0.390625 0.46875 0.296875 
+0.40625 0.453125 0.296875 
+0.40625 0.484375 0.328125 
+0.421875 0.46875 0.328125 
+0.390625 0.40625 0.296875 
+0.40625 0.421875 0.328125 
+0.1875 0.390625 0.34375 
+0.1875 0.421875 0.34375 
+0.21875 0.421875 0.40625 
+0.265625 0.4375 0.421875 
+0.28125 0.421875 0.390625 
+0.28125 0.484375 0.390625 
+0.296875 0.46875 0.390625 
+0.296875 0.453125 0.40625 
+0.328125 0.484375 0.40625 
+0.328125 0.46875 0.421875 
+0.296875 0.40625 0.390625 
+0.328125 0.421875 0.40625 
+0.34375 0.1875 0.390625 
+0.34375 0.1875 0.421875 
+0.40625 0.21875 0.421875 
+0.421875 0.265625 0.4375 
+0.390625 0.28125 0.421875 
+0.390625 0.28125 0.484375 
+0.390625 0.296875 0.46875 
+0.40625 0.296875 0.453125 
+0.40625 0.328125 0.484375 
+0.421875 0.328125 0.46875 
+0.390625 0.296875 0.40625 
+0.40625 0.328125 0.421875 
+0.1875 0.34375 0.390625 
+0.1875 0.34375 0.421875 
+0.21875 0.40625 0.421875 
+0.265625 0.421875 0.4375 
+0.28125 0.390625 0.421875 
+0.28125 0.390625 0.484375 
+0.296875 0.390625 0.46875 
+0.296875 0.40625 0.453125 
+0.328125 0.40625 0.484375 
+0.328125 0.421875 0.46875 
+0.296875 0.390625 0.40625 
+0.328125 0.40625 0.421875 
+0.53125 0.34375 0.296875 
+0.515625 0.34375 0.328125 
+0.546875 0.34375 0.328125 
+0.515625 0.40625 0.296875 
+0.53125 0.421875 0.328125 
+0.53125 0.390625 0.359375 
+0.59375 0.453125 0.359375 
+0.546875 0.390625 0.3125 
+0.578125 0.40625 0.34375 
+0.578125 0.390625 0.359375 
+0.5625 0.40625 0.359375 
+0.5625 0.421875 0.34375 
+0.609375 0.40625 0.390625 
+0.59375 0.421875 0.390625 
+0.578125 0.421875 0.265625 
+0.609375 0.453125 0.296875 
+0.578125 0.390625 0.296875 
+0.609375 0.40625 0.328125 
+0.609375 0.4375 0.328125 
+0.65625 0.421875 0.34375 
+0.65625 0.453125 0.34375 
+0.53125 0.296875 0.34375 
+0.515625 0.328125 0.34375 
+0.546875 0.328125 0.34375 
+0.515625 0.296875 0.40625 
+0.53125 0.328125 0.421875 
+0.53125 0.359375 0.390625 
+0.59375 0.359375 0.453125 
+0.546875 0.3125 0.390625 
+0.578125 0.34375 0.40625 
+0.578125 0.359375 0.390625 
+0.5625 0.359375 0.40625 
+0.5625 0.34375 0.421875 
+0.609375 0.390625 0.40625 
+0.59375 0.390625 0.421875 
+0.578125 0.265625 0.421875 
+0.609375 0.296875 0.453125 
+0.578125 0.296875 0.390625 
+0.609375 0.328125 0.40625 
+0.609375 0.328125 0.4375 
+0.65625 0.34375 0.421875 
+0.65625 0.34375 0.453125 
+0.34375 0.53125 0.296875 
+0.34375 0.515625 0.328125 
+0.34375 0.546875 0.328125 
+0.40625 0.515625 0.296875 
+0.421875 0.53125 0.328125 
+0.390625 0.53125 0.359375 
+0.453125 0.59375 0.359375 
+0.390625 0.546875 0.3125 
+0.40625 0.578125 0.34375 
+0.390625 0.578125 0.359375 
+0.40625 0.5625 0.359375 
+0.421875 0.5625 0.34375 
+0.40625 0.609375 0.390625 
+0.421875 0.59375 0.390625 
+0.421875 0.578125 0.265625 
+0.453125 0.609375 0.296875 
+0.390625 0.578125 0.296875 
+0.40625 0.609375 0.328125 
+0.4375 0.609375 0.328125 
+0.421875 0.65625 0.34375 
+0.453125 0.65625 0.34375 
+0.296875 0.53125 0.34375 
+0.328125 0.515625 0.34375 
+0.328125 0.546875 0.34375 
+0.296875 0.515625 0.40625 
+0.328125 0.53125 0.421875 
+0.359375 0.53125 0.390625 
+0.359375 0.59375 0.453125 
+0.3125 0.546875 0.390625 
+0.34375 0.578125 0.40625 
+0.359375 0.578125 0.390625 
+0.359375 0.5625 0.40625 
+0.34375 0.5625 0.421875 
+0.390625 0.609375 0.40625 
+0.390625 0.59375 0.421875 
+0.265625 0.578125 0.421875 
+0.296875 0.609375 0.453125 
+0.296875 0.578125 0.390625 
+0.328125 0.609375 0.40625 
+0.328125 0.609375 0.4375 
+0.34375 0.65625 0.421875 
+0.34375 0.65625 0.453125 
+0.609375 0.59375 0.390625 
+0.609375 0.578125 0.40625 
+0.671875 0.578125 0.46875 
+0.703125 0.59375 0.484375 
+0.640625 0.546875 0.40625 
+0.640625 0.609375 0.46875 
+0.65625 0.609375 0.421875 
+0.640625 0.59375 0.4375 
+0.65625 0.578125 0.4375 
+0.671875 0.609375 0.453125 
+0.6875 0.59375 0.453125 
+0.6875 0.65625 0.453125 
+0.671875 0.65625 0.484375 
+0.703125 0.65625 0.484375 
+0.65625 0.546875 0.34375 
+0.65625 0.578125 0.34375 
+0.703125 0.546875 0.390625 
+0.734375 0.578125 0.421875 
+0.671875 0.5625 0.390625 
+0.6875 0.609375 0.40625 
+0.703125 0.59375 0.421875 
+0.59375 0.609375 0.390625 
+0.578125 0.609375 0.40625 
+0.578125 0.671875 0.46875 
+0.59375 0.703125 0.484375 
+0.546875 0.640625 0.40625 
+0.609375 0.640625 0.46875 
+0.609375 0.65625 0.421875 
+0.59375 0.640625 0.4375 
+0.578125 0.65625 0.4375 
+0.609375 0.671875 0.453125 
+0.59375 0.6875 0.453125 
+0.65625 0.6875 0.453125 
+0.65625 0.671875 0.484375 
+0.65625 0.703125 0.484375 
+0.546875 0.65625 0.34375 
+0.578125 0.65625 0.34375 
+0.546875 0.703125 0.390625 
+0.578125 0.734375 0.421875 
+0.5625 0.671875 0.390625 
+0.609375 0.6875 0.40625 
+0.59375 0.703125 0.421875 
+0.34375 0.296875 0.53125 
+0.34375 0.328125 0.515625 
+0.34375 0.328125 0.546875 
+0.40625 0.296875 0.515625 
+0.421875 0.328125 0.53125 
+0.390625 0.359375 0.53125 
+0.453125 0.359375 0.59375 
+0.390625 0.3125 0.546875 
+0.40625 0.34375 0.578125 
+0.390625 0.359375 0.578125 
+0.40625 0.359375 0.5625 
+0.421875 0.34375 0.5625 
+0.40625 0.390625 0.609375 
+0.421875 0.390625 0.59375 
+0.421875 0.265625 0.578125 
+0.453125 0.296875 0.609375 
+0.390625 0.296875 0.578125 
+0.40625 0.328125 0.609375 
+0.4375 0.328125 0.609375 
+0.421875 0.34375 0.65625 
+0.453125 0.34375 0.65625 
+0.296875 0.34375 0.53125 
+0.328125 0.34375 0.515625 
+0.328125 0.34375 0.546875 
+0.296875 0.40625 0.515625 
+0.328125 0.421875 0.53125 
+0.359375 0.390625 0.53125 
+0.359375 0.453125 0.59375 
+0.3125 0.390625 0.546875 
+0.34375 0.40625 0.578125 
+0.359375 0.390625 0.578125 
+0.359375 0.40625 0.5625 
+0.34375 0.421875 0.5625 
+0.390625 0.40625 0.609375 
+0.390625 0.421875 0.59375 
+0.265625 0.421875 0.578125 
+0.296875 0.453125 0.609375 
+0.296875 0.390625 0.578125 
+0.328125 0.40625 0.609375 
+0.328125 0.4375 0.609375 
+0.34375 0.421875 0.65625 
+0.34375 0.453125 0.65625 
+0.609375 0.390625 0.59375 
+0.609375 0.40625 0.578125 
+0.671875 0.46875 0.578125 
+0.703125 0.484375 0.59375 
+0.640625 0.40625 0.546875 
+0.640625 0.46875 0.609375 
+0.65625 0.421875 0.609375 
+0.640625 0.4375 0.59375 
+0.65625 0.4375 0.578125 
+0.671875 0.453125 0.609375 
+0.6875 0.453125 0.59375 
+0.6875 0.453125 0.65625 
+0.671875 0.484375 0.65625 
+0.703125 0.484375 0.65625 
+0.65625 0.34375 0.546875 
+0.65625 0.34375 0.578125 
+0.703125 0.390625 0.546875 
+0.734375 0.421875 0.578125 
+0.671875 0.390625 0.5625 
+0.6875 0.40625 0.609375 
+0.703125 0.421875 0.59375 
+0.59375 0.390625 0.609375 
+0.578125 0.40625 0.609375 
+0.578125 0.46875 0.671875 
+0.59375 0.484375 0.703125 
+0.546875 0.40625 0.640625 
+0.609375 0.46875 0.640625 
+0.609375 0.421875 0.65625 
+0.59375 0.4375 0.640625 
+0.578125 0.4375 0.65625 
+0.609375 0.453125 0.671875 
+0.59375 0.453125 0.6875 
+0.65625 0.453125 0.6875 
+0.65625 0.484375 0.671875 
+0.65625 0.484375 0.703125 
+0.546875 0.34375 0.65625 
+0.578125 0.34375 0.65625 
+0.546875 0.390625 0.703125 
+0.578125 0.421875 0.734375 
+0.5625 0.390625 0.671875 
+0.609375 0.40625 0.6875 
+0.59375 0.421875 0.703125 
+0.390625 0.609375 0.59375 
+0.40625 0.609375 0.578125 
+0.46875 0.671875 0.578125 
+0.484375 0.703125 0.59375 
+0.40625 0.640625 0.546875 
+0.46875 0.640625 0.609375 
+0.421875 0.65625 0.609375 
+0.4375 0.640625 0.59375 
+0.4375 0.65625 0.578125 
+0.453125 0.671875 0.609375 
+0.453125 0.6875 0.59375 
+0.453125 0.6875 0.65625 
+0.484375 0.671875 0.65625 
+0.484375 0.703125 0.65625 
+0.34375 0.65625 0.546875 
+0.34375 0.65625 0.578125 
+0.390625 0.703125 0.546875 
+0.421875 0.734375 0.578125 
+0.390625 0.671875 0.5625 
+0.40625 0.6875 0.609375 
+0.421875 0.703125 0.59375 
+0.390625 0.59375 0.609375 
+0.40625 0.578125 0.609375 
+0.46875 0.578125 0.671875 
+0.484375 0.59375 0.703125 
+0.40625 0.546875 0.640625 
+0.46875 0.609375 0.640625 
+0.421875 0.609375 0.65625 
+0.4375 0.59375 0.640625 
+0.4375 0.578125 0.65625 
+0.453125 0.609375 0.671875 
+0.453125 0.59375 0.6875 
+0.453125 0.65625 0.6875 
+0.484375 0.65625 0.671875 
+0.484375 0.65625 0.703125 
+0.34375 0.546875 0.65625 
+0.34375 0.578125 0.65625 
+0.390625 0.546875 0.703125 
+0.421875 0.578125 0.734375 
+0.390625 0.5625 0.671875 
+0.40625 0.609375 0.6875 
+0.421875 0.59375 0.703125 
+0.671875 0.59375 0.515625 
+0.671875 0.578125 0.53125 
+0.71875 0.609375 0.515625 
+0.703125 0.609375 0.53125 
+0.703125 0.59375 0.546875 
+0.71875 0.609375 0.578125 
+0.671875 0.59375 0.578125 
+0.703125 0.609375 0.59375 
+0.734375 0.6875 0.53125 
+0.734375 0.65625 0.546875 
+0.78125 0.6875 0.578125 
+0.8125 0.65625 0.578125 
+0.8125 0.65625 0.609375 
+0.671875 0.515625 0.59375 
+0.671875 0.53125 0.578125 
+0.71875 0.515625 0.609375 
+0.703125 0.53125 0.609375 
+0.703125 0.546875 0.59375 
+0.71875 0.578125 0.609375 
+0.671875 0.578125 0.59375 
+0.703125 0.59375 0.609375 
+0.734375 0.53125 0.6875 
+0.734375 0.546875 0.65625 
+0.78125 0.578125 0.6875 
+0.8125 0.578125 0.65625 
+0.8125 0.609375 0.65625 
+0.59375 0.671875 0.515625 
+0.578125 0.671875 0.53125 
+0.609375 0.71875 0.515625 
+0.609375 0.703125 0.53125 
+0.59375 0.703125 0.546875 
+0.609375 0.71875 0.578125 
+0.59375 0.671875 0.578125 
+0.609375 0.703125 0.59375 
+0.6875 0.734375 0.53125 
+0.65625 0.734375 0.546875 
+0.6875 0.78125 0.578125 
+0.65625 0.8125 0.578125 
+0.65625 0.8125 0.609375 
+0.515625 0.671875 0.59375 
+0.53125 0.671875 0.578125 
+0.515625 0.71875 0.609375 
+0.53125 0.703125 0.609375 
+0.546875 0.703125 0.59375 
+0.578125 0.71875 0.609375 
+0.578125 0.671875 0.59375 
+0.59375 0.703125 0.609375 
+0.53125 0.734375 0.6875 
+0.546875 0.734375 0.65625 
+0.578125 0.78125 0.6875 
+0.578125 0.8125 0.65625 
+0.609375 0.8125 0.65625 
+0.59375 0.515625 0.671875 
+0.578125 0.53125 0.671875 
+0.609375 0.515625 0.71875 
+0.609375 0.53125 0.703125 
+0.59375 0.546875 0.703125 
+0.609375 0.578125 0.71875 
+0.59375 0.578125 0.671875 
+0.609375 0.59375 0.703125 
+0.6875 0.53125 0.734375 
+0.65625 0.546875 0.734375 
+0.6875 0.578125 0.78125 
+0.65625 0.578125 0.8125 
+0.65625 0.609375 0.8125 
+0.515625 0.59375 0.671875 
+0.53125 0.578125 0.671875 
+0.515625 0.609375 0.71875 
+0.53125 0.609375 0.703125 
+0.546875 0.59375 0.703125 
+0.578125 0.609375 0.71875 
+0.578125 0.59375 0.671875 
+0.59375 0.609375 0.703125 
+0.53125 0.6875 0.734375 
+0.546875 0.65625 0.734375 
+0.578125 0.6875 0.78125 
+0.578125 0.65625 0.8125 
+0.609375 0.65625 0.8125 
+0.46875 0.390625 0.1875 
+0.46875 0.421875 0.1875 
+0.3125 0.265625 0.21875 
+0.3125 0.296875 0.21875 
+0.34375 0.265625 0.1875 
+0.34375 0.296875 0.1875 
+0.40625 0.296875 0.21875 
+0.390625 0.328125 0.21875 
+0.421875 0.328125 0.21875 
+0.453125 0.390625 0.21875 
+0.453125 0.421875 0.21875 
+0.34375 0.28125 0.265625 
+0.34375 0.328125 0.265625 
+0.34375 0.3125 0.28125 
+0.34375 0.328125 0.3125 
+0.453125 0.296875 0.265625 
+0.484375 0.328125 0.28125 
+0.484375 0.328125 0.3125 
+0.40625 0.359375 0.265625 
+0.46875 0.359375 0.328125 
+0.421875 0.3125 0.265625 
+0.453125 0.34375 0.28125 
+0.453125 0.359375 0.265625 
+0.4375 0.359375 0.28125 
+0.4375 0.34375 0.296875 
+0.390625 0.296875 0.28125 
+0.390625 0.359375 0.28125 
+0.390625 0.34375 0.296875 
+0.40625 0.328125 0.296875 
+0.390625 0.359375 0.34375 
+0.40625 0.359375 0.328125 
+0.421875 0.34375 0.328125 
+0.484375 0.40625 0.265625 
+0.484375 0.46875 0.328125 
+0.46875 0.453125 0.28125 
+0.484375 0.453125 0.265625 
+0.484375 0.4375 0.28125 
+0.46875 0.4375 0.296875 
+0.46875 0.1875 0.390625 
+0.46875 0.1875 0.421875 
+0.3125 0.21875 0.265625 
+0.3125 0.21875 0.296875 
+0.34375 0.1875 0.265625 
+0.34375 0.1875 0.296875 
+0.40625 0.21875 0.296875 
+0.390625 0.21875 0.328125 
+0.421875 0.21875 0.328125 
+0.453125 0.21875 0.390625 
+0.453125 0.21875 0.421875 
+0.34375 0.265625 0.28125 
+0.34375 0.265625 0.328125 
+0.34375 0.28125 0.3125 
+0.34375 0.3125 0.328125 
+0.453125 0.265625 0.296875 
+0.484375 0.28125 0.328125 
+0.484375 0.3125 0.328125 
+0.40625 0.265625 0.359375 
+0.46875 0.328125 0.359375 
+0.421875 0.265625 0.3125 
+0.453125 0.28125 0.34375 
+0.453125 0.265625 0.359375 
+0.4375 0.28125 0.359375 
+0.4375 0.296875 0.34375 
+0.390625 0.28125 0.296875 
+0.390625 0.28125 0.359375 
+0.390625 0.296875 0.34375 
+0.40625 0.296875 0.328125 
+0.390625 0.34375 0.359375 
+0.40625 0.328125 0.359375 
+0.421875 0.328125 0.34375 
+0.484375 0.265625 0.40625 
+0.484375 0.328125 0.46875 
+0.46875 0.28125 0.453125 
+0.484375 0.265625 0.453125 
+0.484375 0.28125 0.4375 
+0.46875 0.296875 0.4375 
+0.390625 0.46875 0.1875 
+0.421875 0.46875 0.1875 
+0.265625 0.3125 0.21875 
+0.296875 0.3125 0.21875 
+0.265625 0.34375 0.1875 
+0.296875 0.34375 0.1875 
+0.296875 0.40625 0.21875 
+0.328125 0.390625 0.21875 
+0.328125 0.421875 0.21875 
+0.390625 0.453125 0.21875 
+0.421875 0.453125 0.21875 
+0.28125 0.34375 0.265625 
+0.328125 0.34375 0.265625 
+0.3125 0.34375 0.28125 
+0.328125 0.34375 0.3125 
+0.296875 0.453125 0.265625 
+0.328125 0.484375 0.28125 
+0.328125 0.484375 0.3125 
+0.359375 0.40625 0.265625 
+0.359375 0.46875 0.328125 
+0.3125 0.421875 0.265625 
+0.34375 0.453125 0.28125 
+0.359375 0.453125 0.265625 
+0.359375 0.4375 0.28125 
+0.34375 0.4375 0.296875 
+0.296875 0.390625 0.28125 
+0.359375 0.390625 0.28125 
+0.34375 0.390625 0.296875 
+0.328125 0.40625 0.296875 
+0.359375 0.390625 0.34375 
+0.359375 0.40625 0.328125 
+0.34375 0.421875 0.328125 
+0.40625 0.484375 0.265625 
+0.46875 0.484375 0.328125 
+0.453125 0.46875 0.28125 
+0.453125 0.484375 0.265625 
+0.4375 0.484375 0.28125 
+0.4375 0.46875 0.296875 
+0.1875 0.46875 0.390625 
+0.1875 0.46875 0.421875 
+0.21875 0.3125 0.265625 
+0.21875 0.3125 0.296875 
+0.1875 0.34375 0.265625 
+0.1875 0.34375 0.296875 
+0.21875 0.40625 0.296875 
+0.21875 0.390625 0.328125 
+0.21875 0.421875 0.328125 
+0.21875 0.453125 0.390625 
+0.21875 0.453125 0.421875 
+0.265625 0.34375 0.28125 
+0.265625 0.34375 0.328125 
+0.28125 0.34375 0.3125 
+0.3125 0.34375 0.328125 
+0.265625 0.453125 0.296875 
+0.28125 0.484375 0.328125 
+0.3125 0.484375 0.328125 
+0.265625 0.40625 0.359375 
+0.328125 0.46875 0.359375 
+0.265625 0.421875 0.3125 
+0.28125 0.453125 0.34375 
+0.265625 0.453125 0.359375 
+0.28125 0.4375 0.359375 
+0.296875 0.4375 0.34375 
+0.28125 0.390625 0.296875 
+0.28125 0.390625 0.359375 
+0.296875 0.390625 0.34375 
+0.296875 0.40625 0.328125 
+0.34375 0.390625 0.359375 
+0.328125 0.40625 0.359375 
+0.328125 0.421875 0.34375 
+0.265625 0.484375 0.40625 
+0.328125 0.484375 0.46875 
+0.28125 0.46875 0.453125 
+0.265625 0.484375 0.453125 
+0.28125 0.484375 0.4375 
+0.296875 0.46875 0.4375 
+0.390625 0.1875 0.46875 
+0.421875 0.1875 0.46875 
+0.265625 0.21875 0.3125 
+0.296875 0.21875 0.3125 
+0.265625 0.1875 0.34375 
+0.296875 0.1875 0.34375 
+0.296875 0.21875 0.40625 
+0.328125 0.21875 0.390625 
+0.328125 0.21875 0.421875 
+0.390625 0.21875 0.453125 
+0.421875 0.21875 0.453125 
+0.28125 0.265625 0.34375 
+0.328125 0.265625 0.34375 
+0.3125 0.28125 0.34375 
+0.328125 0.3125 0.34375 
+0.296875 0.265625 0.453125 
+0.328125 0.28125 0.484375 
+0.328125 0.3125 0.484375 
+0.359375 0.265625 0.40625 
+0.359375 0.328125 0.46875 
+0.3125 0.265625 0.421875 
+0.34375 0.28125 0.453125 
+0.359375 0.265625 0.453125 
+0.359375 0.28125 0.4375 
+0.34375 0.296875 0.4375 
+0.296875 0.28125 0.390625 
+0.359375 0.28125 0.390625 
+0.34375 0.296875 0.390625 
+0.328125 0.296875 0.40625 
+0.359375 0.34375 0.390625 
+0.359375 0.328125 0.40625 
+0.34375 0.328125 0.421875 
+0.40625 0.265625 0.484375 
+0.46875 0.328125 0.484375 
+0.453125 0.28125 0.46875 
+0.453125 0.265625 0.484375 
+0.4375 0.28125 0.484375 
+0.4375 0.296875 0.46875 
+0.1875 0.390625 0.46875 
+0.1875 0.421875 0.46875 
+0.21875 0.265625 0.3125 
+0.21875 0.296875 0.3125 
+0.1875 0.265625 0.34375 
+0.1875 0.296875 0.34375 
+0.21875 0.296875 0.40625 
+0.21875 0.328125 0.390625 
+0.21875 0.328125 0.421875 
+0.21875 0.390625 0.453125 
+0.21875 0.421875 0.453125 
+0.265625 0.28125 0.34375 
+0.265625 0.328125 0.34375 
+0.28125 0.3125 0.34375 
+0.3125 0.328125 0.34375 
+0.265625 0.296875 0.453125 
+0.28125 0.328125 0.484375 
+0.3125 0.328125 0.484375 
+0.265625 0.359375 0.40625 
+0.328125 0.359375 0.46875 
+0.265625 0.3125 0.421875 
+0.28125 0.34375 0.453125 
+0.265625 0.359375 0.453125 
+0.28125 0.359375 0.4375 
+0.296875 0.34375 0.4375 
+0.28125 0.296875 0.390625 
+0.28125 0.359375 0.390625 
+0.296875 0.34375 0.390625 
+0.296875 0.328125 0.40625 
+0.34375 0.359375 0.390625 
+0.328125 0.359375 0.40625 
+0.328125 0.34375 0.421875 
+0.265625 0.40625 0.484375 
+0.328125 0.46875 0.484375 
+0.28125 0.453125 0.46875 
+0.265625 0.453125 0.484375 
+0.28125 0.4375 0.484375 
+0.296875 0.4375 0.46875 
+0.53125 0.421875 0.21875 
+0.53125 0.453125 0.21875 
+0.515625 0.421875 0.28125 
+0.515625 0.484375 0.28125 
+0.515625 0.46875 0.296875 
+0.53125 0.453125 0.296875 
+0.53125 0.484375 0.328125 
+0.546875 0.46875 0.328125 
+0.578125 0.484375 0.34375 
+0.640625 0.421875 0.40625 
+0.640625 0.484375 0.40625 
+0.65625 0.453125 0.421875 
+0.671875 0.46875 0.453125 
+0.703125 0.484375 0.46875 
+0.546875 0.4375 0.265625 
+0.59375 0.484375 0.3125 
+0.546875 0.484375 0.265625 
+0.5625 0.46875 0.28125 
+0.671875 0.4375 0.390625 
+0.71875 0.484375 0.4375 
+0.671875 0.484375 0.390625 
+0.6875 0.46875 0.40625 
+0.703125 0.421875 0.390625 
+0.734375 0.453125 0.421875 
+0.53125 0.21875 0.421875 
+0.53125 0.21875 0.453125 
+0.515625 0.28125 0.421875 
+0.515625 0.28125 0.484375 
+0.515625 0.296875 0.46875 
+0.53125 0.296875 0.453125 
+0.53125 0.328125 0.484375 
+0.546875 0.328125 0.46875 
+0.578125 0.34375 0.484375 
+0.640625 0.40625 0.421875 
+0.640625 0.40625 0.484375 
+0.65625 0.421875 0.453125 
+0.671875 0.453125 0.46875 
+0.703125 0.46875 0.484375 
+0.546875 0.265625 0.4375 
+0.59375 0.3125 0.484375 
+0.546875 0.265625 0.484375 
+0.5625 0.28125 0.46875 
+0.671875 0.390625 0.4375 
+0.71875 0.4375 0.484375 
+0.671875 0.390625 0.484375 
+0.6875 0.40625 0.46875 
+0.703125 0.390625 0.421875 
+0.734375 0.421875 0.453125 
+0.421875 0.53125 0.21875 
+0.453125 0.53125 0.21875 
+0.421875 0.515625 0.28125 
+0.484375 0.515625 0.28125 
+0.46875 0.515625 0.296875 
+0.453125 0.53125 0.296875 
+0.484375 0.53125 0.328125 
+0.46875 0.546875 0.328125 
+0.484375 0.578125 0.34375 
+0.421875 0.640625 0.40625 
+0.484375 0.640625 0.40625 
+0.453125 0.65625 0.421875 
+0.46875 0.671875 0.453125 
+0.484375 0.703125 0.46875 
+0.4375 0.546875 0.265625 
+0.484375 0.59375 0.3125 
+0.484375 0.546875 0.265625 
+0.46875 0.5625 0.28125 
+0.4375 0.671875 0.390625 
+0.484375 0.71875 0.4375 
+0.484375 0.671875 0.390625 
+0.46875 0.6875 0.40625 
+0.421875 0.703125 0.390625 
+0.453125 0.734375 0.421875 
+0.21875 0.53125 0.421875 
+0.21875 0.53125 0.453125 
+0.28125 0.515625 0.421875 
+0.28125 0.515625 0.484375 
+0.296875 0.515625 0.46875 
+0.296875 0.53125 0.453125 
+0.328125 0.53125 0.484375 
+0.328125 0.546875 0.46875 
+0.34375 0.578125 0.484375 
+0.40625 0.640625 0.421875 
+0.40625 0.640625 0.484375 
+0.421875 0.65625 0.453125 
+0.453125 0.671875 0.46875 
+0.46875 0.703125 0.484375 
+0.265625 0.546875 0.4375 
+0.3125 0.59375 0.484375 
+0.265625 0.546875 0.484375 
+0.28125 0.5625 0.46875 
+0.390625 0.671875 0.4375 
+0.4375 0.71875 0.484375 
+0.390625 0.671875 0.484375 
+0.40625 0.6875 0.46875 
+0.390625 0.703125 0.421875 
+0.421875 0.734375 0.453125 
+0.53125 0.515625 0.296875 
+0.546875 0.53125 0.328125 
+0.59375 0.515625 0.359375 
+0.578125 0.546875 0.34375 
+0.59375 0.578125 0.359375 
+0.65625 0.515625 0.421875 
+0.671875 0.515625 0.46875 
+0.671875 0.53125 0.453125 
+0.71875 0.515625 0.484375 
+0.703125 0.53125 0.484375 
+0.703125 0.546875 0.46875 
+0.71875 0.578125 0.484375 
+0.5625 0.515625 0.28125 
+0.609375 0.515625 0.328125 
+0.59375 0.53125 0.3125 
+0.609375 0.5625 0.328125 
+0.6875 0.515625 0.40625 
+0.734375 0.515625 0.453125 
+0.71875 0.53125 0.4375 
+0.734375 0.5625 0.453125 
+0.578125 0.546875 0.265625 
+0.609375 0.578125 0.296875 
+0.78125 0.546875 0.46875 
+0.78125 0.578125 0.46875 
+0.515625 0.53125 0.296875 
+0.53125 0.546875 0.328125 
+0.515625 0.59375 0.359375 
+0.546875 0.578125 0.34375 
+0.578125 0.59375 0.359375 
+0.515625 0.65625 0.421875 
+0.515625 0.671875 0.46875 
+0.53125 0.671875 0.453125 
+0.515625 0.71875 0.484375 
+0.53125 0.703125 0.484375 
+0.546875 0.703125 0.46875 
+0.578125 0.71875 0.484375 
+0.515625 0.5625 0.28125 
+0.515625 0.609375 0.328125 
+0.53125 0.59375 0.3125 
+0.5625 0.609375 0.328125 
+0.515625 0.6875 0.40625 
+0.515625 0.734375 0.453125 
+0.53125 0.71875 0.4375 
+0.5625 0.734375 0.453125 
+0.546875 0.578125 0.265625 
+0.578125 0.609375 0.296875 
+0.546875 0.78125 0.46875 
+0.578125 0.78125 0.46875 
+0.421875 0.21875 0.53125 
+0.453125 0.21875 0.53125 
+0.421875 0.28125 0.515625 
+0.484375 0.28125 0.515625 
+0.46875 0.296875 0.515625 
+0.453125 0.296875 0.53125 
+0.484375 0.328125 0.53125 
+0.46875 0.328125 0.546875 
+0.484375 0.34375 0.578125 
+0.421875 0.40625 0.640625 
+0.484375 0.40625 0.640625 
+0.453125 0.421875 0.65625 
+0.46875 0.453125 0.671875 
+0.484375 0.46875 0.703125 
+0.4375 0.265625 0.546875 
+0.484375 0.3125 0.59375 
+0.484375 0.265625 0.546875 
+0.46875 0.28125 0.5625 
+0.4375 0.390625 0.671875 
+0.484375 0.4375 0.71875 
+0.484375 0.390625 0.671875 
+0.46875 0.40625 0.6875 
+0.421875 0.390625 0.703125 
+0.453125 0.421875 0.734375 
+0.21875 0.421875 0.53125 
+0.21875 0.453125 0.53125 
+0.28125 0.421875 0.515625 
+0.28125 0.484375 0.515625 
+0.296875 0.46875 0.515625 
+0.296875 0.453125 0.53125 
+0.328125 0.484375 0.53125 
+0.328125 0.46875 0.546875 
+0.34375 0.484375 0.578125 
+0.40625 0.421875 0.640625 
+0.40625 0.484375 0.640625 
+0.421875 0.453125 0.65625 
+0.453125 0.46875 0.671875 
+0.46875 0.484375 0.703125 
+0.265625 0.4375 0.546875 
+0.3125 0.484375 0.59375 
+0.265625 0.484375 0.546875 
+0.28125 0.46875 0.5625 
+0.390625 0.4375 0.671875 
+0.4375 0.484375 0.71875 
+0.390625 0.484375 0.671875 
+0.40625 0.46875 0.6875 
+0.390625 0.421875 0.703125 
+0.421875 0.453125 0.734375 
+0.53125 0.296875 0.515625 
+0.546875 0.328125 0.53125 
+0.59375 0.359375 0.515625 
+0.578125 0.34375 0.546875 
+0.59375 0.359375 0.578125 
+0.65625 0.421875 0.515625 
+0.671875 0.46875 0.515625 
+0.671875 0.453125 0.53125 
+0.71875 0.484375 0.515625 
+0.703125 0.484375 0.53125 
+0.703125 0.46875 0.546875 
+0.71875 0.484375 0.578125 
+0.5625 0.28125 0.515625 
+0.609375 0.328125 0.515625 
+0.59375 0.3125 0.53125 
+0.609375 0.328125 0.5625 
+0.6875 0.40625 0.515625 
+0.734375 0.453125 0.515625 
+0.71875 0.4375 0.53125 
+0.734375 0.453125 0.5625 
+0.578125 0.265625 0.546875 
+0.609375 0.296875 0.578125 
+0.78125 0.46875 0.546875 
+0.78125 0.46875 0.578125 
+0.515625 0.296875 0.53125 
+0.53125 0.328125 0.546875 
+0.515625 0.359375 0.59375 
+0.546875 0.34375 0.578125 
+0.578125 0.359375 0.59375 
+0.515625 0.421875 0.65625 
+0.515625 0.46875 0.671875 
+0.53125 0.453125 0.671875 
+0.515625 0.484375 0.71875 
+0.53125 0.484375 0.703125 
+0.546875 0.46875 0.703125 
+0.578125 0.484375 0.71875 
+0.515625 0.28125 0.5625 
+0.515625 0.328125 0.609375 
+0.53125 0.3125 0.59375 
+0.5625 0.328125 0.609375 
+0.515625 0.40625 0.6875 
+0.515625 0.453125 0.734375 
+0.53125 0.4375 0.71875 
+0.5625 0.453125 0.734375 
+0.546875 0.265625 0.578125 
+0.578125 0.296875 0.609375 
+0.546875 0.46875 0.78125 
+0.578125 0.46875 0.78125 
+0.296875 0.53125 0.515625 
+0.328125 0.546875 0.53125 
+0.359375 0.59375 0.515625 
+0.34375 0.578125 0.546875 
+0.359375 0.59375 0.578125 
+0.421875 0.65625 0.515625 
+0.46875 0.671875 0.515625 
+0.453125 0.671875 0.53125 
+0.484375 0.71875 0.515625 
+0.484375 0.703125 0.53125 
+0.46875 0.703125 0.546875 
+0.484375 0.71875 0.578125 
+0.28125 0.5625 0.515625 
+0.328125 0.609375 0.515625 
+0.3125 0.59375 0.53125 
+0.328125 0.609375 0.5625 
+0.40625 0.6875 0.515625 
+0.453125 0.734375 0.515625 
+0.4375 0.71875 0.53125 
+0.453125 0.734375 0.5625 
+0.265625 0.578125 0.546875 
+0.296875 0.609375 0.578125 
+0.46875 0.78125 0.546875 
+0.46875 0.78125 0.578125 
+0.296875 0.515625 0.53125 
+0.328125 0.53125 0.546875 
+0.359375 0.515625 0.59375 
+0.34375 0.546875 0.578125 
+0.359375 0.578125 0.59375 
+0.421875 0.515625 0.65625 
+0.46875 0.515625 0.671875 
+0.453125 0.53125 0.671875 
+0.484375 0.515625 0.71875 
+0.484375 0.53125 0.703125 
+0.46875 0.546875 0.703125 
+0.484375 0.578125 0.71875 
+0.28125 0.515625 0.5625 
+0.328125 0.515625 0.609375 
+0.3125 0.53125 0.59375 
+0.328125 0.5625 0.609375 
+0.40625 0.515625 0.6875 
+0.453125 0.515625 0.734375 
+0.4375 0.53125 0.71875 
+0.453125 0.5625 0.734375 
+0.265625 0.546875 0.578125 
+0.296875 0.578125 0.609375 
+0.46875 0.546875 0.78125 
+0.46875 0.578125 0.78125 
+0.671875 0.53125 0.515625 
+0.734375 0.59375 0.515625 
+0.734375 0.546875 0.53125 
+0.71875 0.5625 0.515625 
+0.703125 0.5625 0.53125 
+0.734375 0.578125 0.546875 
+0.71875 0.578125 0.5625 
+0.6875 0.671875 0.515625 
+0.71875 0.703125 0.546875 
+0.671875 0.640625 0.53125 
+0.734375 0.640625 0.59375 
+0.71875 0.640625 0.5625 
+0.703125 0.65625 0.5625 
+0.734375 0.671875 0.578125 
+0.71875 0.6875 0.578125 
+0.65625 0.640625 0.609375 
+0.671875 0.640625 0.59375 
+0.671875 0.65625 0.578125 
+0.71875 0.640625 0.609375 
+0.703125 0.65625 0.609375 
+0.703125 0.671875 0.59375 
+0.71875 0.703125 0.609375 
+0.6875 0.671875 0.65625 
+0.734375 0.671875 0.65625 
+0.71875 0.6875 0.65625 
+0.734375 0.71875 0.65625 
+0.8125 0.578125 0.53125 
+0.8125 0.609375 0.53125 
+0.78125 0.578125 0.5625 
+0.78125 0.609375 0.546875 
+0.78125 0.609375 0.578125 
+0.78125 0.671875 0.609375 
+0.78125 0.703125 0.609375 
+0.78125 0.703125 0.6875 
+0.78125 0.734375 0.6875 
+0.8125 0.703125 0.65625 
+0.8125 0.734375 0.65625 
+0.671875 0.515625 0.53125 
+0.734375 0.515625 0.59375 
+0.734375 0.53125 0.546875 
+0.71875 0.515625 0.5625 
+0.703125 0.53125 0.5625 
+0.734375 0.546875 0.578125 
+0.71875 0.5625 0.578125 
+0.6875 0.515625 0.671875 
+0.71875 0.546875 0.703125 
+0.671875 0.53125 0.640625 
+0.734375 0.59375 0.640625 
+0.71875 0.5625 0.640625 
+0.703125 0.5625 0.65625 
+0.734375 0.578125 0.671875 
+0.71875 0.578125 0.6875 
+0.65625 0.609375 0.640625 
+0.671875 0.59375 0.640625 
+0.671875 0.578125 0.65625 
+0.71875 0.609375 0.640625 
+0.703125 0.609375 0.65625 
+0.703125 0.59375 0.671875 
+0.71875 0.609375 0.703125 
+0.6875 0.65625 0.671875 
+0.734375 0.65625 0.671875 
+0.71875 0.65625 0.6875 
+0.734375 0.65625 0.71875 
+0.8125 0.53125 0.578125 
+0.8125 0.53125 0.609375 
+0.78125 0.5625 0.578125 
+0.78125 0.546875 0.609375 
+0.78125 0.578125 0.609375 
+0.78125 0.609375 0.671875 
+0.78125 0.609375 0.703125 
+0.78125 0.6875 0.703125 
+0.78125 0.6875 0.734375 
+0.8125 0.65625 0.703125 
+0.8125 0.65625 0.734375 
+0.53125 0.671875 0.515625 
+0.59375 0.734375 0.515625 
+0.546875 0.734375 0.53125 
+0.5625 0.71875 0.515625 
+0.5625 0.703125 0.53125 
+0.578125 0.734375 0.546875 
+0.578125 0.71875 0.5625 
+0.671875 0.6875 0.515625 
+0.703125 0.71875 0.546875 
+0.640625 0.671875 0.53125 
+0.640625 0.734375 0.59375 
+0.640625 0.71875 0.5625 
+0.65625 0.703125 0.5625 
+0.671875 0.734375 0.578125 
+0.6875 0.71875 0.578125 
+0.640625 0.65625 0.609375 
+0.640625 0.671875 0.59375 
+0.65625 0.671875 0.578125 
+0.640625 0.71875 0.609375 
+0.65625 0.703125 0.609375 
+0.671875 0.703125 0.59375 
+0.703125 0.71875 0.609375 
+0.671875 0.6875 0.65625 
+0.671875 0.734375 0.65625 
+0.6875 0.71875 0.65625 
+0.71875 0.734375 0.65625 
+0.578125 0.8125 0.53125 
+0.609375 0.8125 0.53125 
+0.578125 0.78125 0.5625 
+0.609375 0.78125 0.546875 
+0.609375 0.78125 0.578125 
+0.671875 0.78125 0.609375 
+0.703125 0.78125 0.609375 
+0.703125 0.78125 0.6875 
+0.734375 0.78125 0.6875 
+0.703125 0.8125 0.65625 
+0.734375 0.8125 0.65625 
+0.515625 0.671875 0.53125 
+0.515625 0.734375 0.59375 
+0.53125 0.734375 0.546875 
+0.515625 0.71875 0.5625 
+0.53125 0.703125 0.5625 
+0.546875 0.734375 0.578125 
+0.5625 0.71875 0.578125 
+0.515625 0.6875 0.671875 
+0.546875 0.71875 0.703125 
+0.53125 0.671875 0.640625 
+0.59375 0.734375 0.640625 
+0.5625 0.71875 0.640625 
+0.5625 0.703125 0.65625 
+0.578125 0.734375 0.671875 
+0.578125 0.71875 0.6875 
+0.609375 0.65625 0.640625 
+0.59375 0.671875 0.640625 
+0.578125 0.671875 0.65625 
+0.609375 0.71875 0.640625 
+0.609375 0.703125 0.65625 
+0.59375 0.703125 0.671875 
+0.609375 0.71875 0.703125 
+0.65625 0.6875 0.671875 
+0.65625 0.734375 0.671875 
+0.65625 0.71875 0.6875 
+0.65625 0.734375 0.71875 
+0.53125 0.8125 0.578125 
+0.53125 0.8125 0.609375 
+0.5625 0.78125 0.578125 
+0.546875 0.78125 0.609375 
+0.578125 0.78125 0.609375 
+0.609375 0.78125 0.671875 
+0.609375 0.78125 0.703125 
+0.6875 0.78125 0.703125 
+0.6875 0.78125 0.734375 
+0.65625 0.8125 0.703125 
+0.65625 0.8125 0.734375 
+0.53125 0.515625 0.671875 
+0.59375 0.515625 0.734375 
+0.546875 0.53125 0.734375 
+0.5625 0.515625 0.71875 
+0.5625 0.53125 0.703125 
+0.578125 0.546875 0.734375 
+0.578125 0.5625 0.71875 
+0.671875 0.515625 0.6875 
+0.703125 0.546875 0.71875 
+0.640625 0.53125 0.671875 
+0.640625 0.59375 0.734375 
+0.640625 0.5625 0.71875 
+0.65625 0.5625 0.703125 
+0.671875 0.578125 0.734375 
+0.6875 0.578125 0.71875 
+0.640625 0.609375 0.65625 
+0.640625 0.59375 0.671875 
+0.65625 0.578125 0.671875 
+0.640625 0.609375 0.71875 
+0.65625 0.609375 0.703125 
+0.671875 0.59375 0.703125 
+0.703125 0.609375 0.71875 
+0.671875 0.65625 0.6875 
+0.671875 0.65625 0.734375 
+0.6875 0.65625 0.71875 
+0.71875 0.65625 0.734375 
+0.578125 0.53125 0.8125 
+0.609375 0.53125 0.8125 
+0.578125 0.5625 0.78125 
+0.609375 0.546875 0.78125 
+0.609375 0.578125 0.78125 
+0.671875 0.609375 0.78125 
+0.703125 0.609375 0.78125 
+0.703125 0.6875 0.78125 
+0.734375 0.6875 0.78125 
+0.703125 0.65625 0.8125 
+0.734375 0.65625 0.8125 
+0.515625 0.53125 0.671875 
+0.515625 0.59375 0.734375 
+0.53125 0.546875 0.734375 
+0.515625 0.5625 0.71875 
+0.53125 0.5625 0.703125 
+0.546875 0.578125 0.734375 
+0.5625 0.578125 0.71875 
+0.515625 0.671875 0.6875 
+0.546875 0.703125 0.71875 
+0.53125 0.640625 0.671875 
+0.59375 0.640625 0.734375 
+0.5625 0.640625 0.71875 
+0.5625 0.65625 0.703125 
+0.578125 0.671875 0.734375 
+0.578125 0.6875 0.71875 
+0.609375 0.640625 0.65625 
+0.59375 0.640625 0.671875 
+0.578125 0.65625 0.671875 
+0.609375 0.640625 0.71875 
+0.609375 0.65625 0.703125 
+0.59375 0.671875 0.703125 
+0.609375 0.703125 0.71875 
+0.65625 0.671875 0.6875 
+0.65625 0.671875 0.734375 
+0.65625 0.6875 0.71875 
+0.65625 0.71875 0.734375 
+0.53125 0.578125 0.8125 
+0.53125 0.609375 0.8125 
+0.5625 0.578125 0.78125 
+0.546875 0.609375 0.78125 
+0.578125 0.609375 0.78125 
+0.609375 0.671875 0.78125 
+0.609375 0.703125 0.78125 
+0.6875 0.703125 0.78125 
+0.6875 0.734375 0.78125 
+0.65625 0.703125 0.8125 
+0.65625 0.734375 0.8125 
+0.484375 0.445312 0.34375 
+0.484375 0.460938 0.34375 
+0.484375 0.34375 0.445312 
+0.484375 0.34375 0.460938 
+0.445312 0.484375 0.34375 
+0.460938 0.484375 0.34375 
+0.34375 0.484375 0.445312 
+0.34375 0.484375 0.460938 
+0.445312 0.34375 0.484375 
+0.460938 0.34375 0.484375 
+0.34375 0.445312 0.484375 
+0.34375 0.460938 0.484375 
+0.65625 0.539062 0.515625 
+0.65625 0.554688 0.515625 
+0.65625 0.515625 0.539062 
+0.65625 0.515625 0.554688 
+0.539062 0.65625 0.515625 
+0.554688 0.65625 0.515625 
+0.515625 0.65625 0.539062 
+0.515625 0.65625 0.554688 
+0.539062 0.515625 0.65625 
+0.554688 0.515625 0.65625 
+0.515625 0.539062 0.65625 
+0.515625 0.554688 0.65625 
+0.507812 0.398438 0.390625 
+0.515625 0.414062 0.398438 
+0.507812 0.390625 0.398438 
+0.515625 0.398438 0.414062 
+0.398438 0.507812 0.390625 
+0.414062 0.515625 0.398438 
+0.390625 0.507812 0.398438 
+0.398438 0.515625 0.414062 
+0.601562 0.585938 0.484375 
+0.609375 0.601562 0.492188 
+0.585938 0.601562 0.484375 
+0.601562 0.609375 0.492188 
+0.398438 0.390625 0.507812 
+0.414062 0.398438 0.515625 
+0.390625 0.398438 0.507812 
+0.398438 0.414062 0.515625 
+0.601562 0.484375 0.585938 
+0.609375 0.492188 0.601562 
+0.585938 0.484375 0.601562 
+0.601562 0.492188 0.609375 
+0.484375 0.601562 0.585938 
+0.492188 0.609375 0.601562 
+0.484375 0.585938 0.601562 
+0.492188 0.601562 0.609375 
+0.484375 0.382812 0.34375 
+0.484375 0.398438 0.34375 
+0.40625 0.382812 0.359375 
+0.40625 0.398438 0.359375 
+0.421875 0.382812 0.34375 
+0.421875 0.398438 0.34375 
+0.453125 0.382812 0.359375 
+0.476562 0.382812 0.359375 
+0.46875 0.390625 0.359375 
+0.476562 0.40625 0.359375 
+0.445312 0.390625 0.359375 
+0.445312 0.414062 0.359375 
+0.453125 0.40625 0.359375 
+0.46875 0.414062 0.359375 
+0.445312 0.421875 0.34375 
+0.460938 0.421875 0.34375 
+0.453125 0.445312 0.359375 
+0.476562 0.445312 0.359375 
+0.46875 0.453125 0.359375 
+0.476562 0.46875 0.359375 
+0.421875 0.398438 0.390625 
+0.421875 0.414062 0.382812 
+0.421875 0.414062 0.398438 
+0.460938 0.390625 0.382812 
+0.492188 0.390625 0.382812 
+0.484375 0.398438 0.382812 
+0.476562 0.398438 0.390625 
+0.492188 0.421875 0.382812 
+0.492188 0.414062 0.390625 
+0.484375 0.414062 0.398438 
+0.453125 0.398438 0.382812 
+0.453125 0.429688 0.382812 
+0.460938 0.421875 0.382812 
+0.460938 0.414062 0.390625 
+0.484375 0.429688 0.382812 
+0.476562 0.429688 0.390625 
+0.476562 0.421875 0.398438 
+0.445312 0.429688 0.390625 
+0.476562 0.429688 0.421875 
+0.445312 0.40625 0.398438 
+0.453125 0.421875 0.414062 
+0.445312 0.429688 0.414062 
+0.453125 0.429688 0.40625 
+0.460938 0.421875 0.40625 
+0.460938 0.453125 0.382812 
+0.492188 0.453125 0.382812 
+0.484375 0.460938 0.382812 
+0.476562 0.460938 0.390625 
+0.492188 0.484375 0.382812 
+0.460938 0.445312 0.390625 
+0.476562 0.453125 0.398438 
+0.453125 0.445312 0.398438 
+0.453125 0.445312 0.429688 
+0.460938 0.445312 0.421875 
+0.460938 0.453125 0.414062 
+0.476562 0.453125 0.429688 
+0.476562 0.460938 0.421875 
+0.460938 0.453125 0.445312 
+0.476562 0.460938 0.453125 
+0.484375 0.34375 0.382812 
+0.484375 0.34375 0.398438 
+0.40625 0.359375 0.382812 
+0.40625 0.359375 0.398438 
+0.421875 0.34375 0.382812 
+0.421875 0.34375 0.398438 
+0.453125 0.359375 0.382812 
+0.476562 0.359375 0.382812 
+0.46875 0.359375 0.390625 
+0.476562 0.359375 0.40625 
+0.445312 0.359375 0.390625 
+0.445312 0.359375 0.414062 
+0.453125 0.359375 0.40625 
+0.46875 0.359375 0.414062 
+0.445312 0.34375 0.421875 
+0.460938 0.34375 0.421875 
+0.453125 0.359375 0.445312 
+0.476562 0.359375 0.445312 
+0.46875 0.359375 0.453125 
+0.476562 0.359375 0.46875 
+0.421875 0.390625 0.398438 
+0.421875 0.382812 0.414062 
+0.421875 0.398438 0.414062 
+0.460938 0.382812 0.390625 
+0.492188 0.382812 0.390625 
+0.484375 0.382812 0.398438 
+0.476562 0.390625 0.398438 
+0.492188 0.382812 0.421875 
+0.492188 0.390625 0.414062 
+0.484375 0.398438 0.414062 
+0.453125 0.382812 0.398438 
+0.453125 0.382812 0.429688 
+0.460938 0.382812 0.421875 
+0.460938 0.390625 0.414062 
+0.484375 0.382812 0.429688 
+0.476562 0.390625 0.429688 
+0.476562 0.398438 0.421875 
+0.445312 0.390625 0.429688 
+0.476562 0.421875 0.429688 
+0.445312 0.398438 0.40625 
+0.453125 0.414062 0.421875 
+0.445312 0.414062 0.429688 
+0.453125 0.40625 0.429688 
+0.460938 0.40625 0.421875 
+0.460938 0.382812 0.453125 
+0.492188 0.382812 0.453125 
+0.484375 0.382812 0.460938 
+0.476562 0.390625 0.460938 
+0.492188 0.382812 0.484375 
+0.460938 0.390625 0.445312 
+0.476562 0.398438 0.453125 
+0.453125 0.398438 0.445312 
+0.453125 0.429688 0.445312 
+0.460938 0.421875 0.445312 
+0.460938 0.414062 0.453125 
+0.476562 0.429688 0.453125 
+0.476562 0.421875 0.460938 
+0.460938 0.445312 0.453125 
+0.476562 0.453125 0.460938 
+0.382812 0.484375 0.34375 
+0.398438 0.484375 0.34375 
+0.382812 0.40625 0.359375 
+0.398438 0.40625 0.359375 
+0.382812 0.421875 0.34375 
+0.398438 0.421875 0.34375 
+0.382812 0.453125 0.359375 
+0.382812 0.476562 0.359375 
+0.390625 0.46875 0.359375 
+0.40625 0.476562 0.359375 
+0.390625 0.445312 0.359375 
+0.414062 0.445312 0.359375 
+0.40625 0.453125 0.359375 
+0.414062 0.46875 0.359375 
+0.421875 0.445312 0.34375 
+0.421875 0.460938 0.34375 
+0.445312 0.453125 0.359375 
+0.445312 0.476562 0.359375 
+0.453125 0.46875 0.359375 
+0.46875 0.476562 0.359375 
+0.398438 0.421875 0.390625 
+0.414062 0.421875 0.382812 
+0.414062 0.421875 0.398438 
+0.390625 0.460938 0.382812 
+0.390625 0.492188 0.382812 
+0.398438 0.484375 0.382812 
+0.398438 0.476562 0.390625 
+0.421875 0.492188 0.382812 
+0.414062 0.492188 0.390625 
+0.414062 0.484375 0.398438 
+0.398438 0.453125 0.382812 
+0.429688 0.453125 0.382812 
+0.421875 0.460938 0.382812 
+0.414062 0.460938 0.390625 
+0.429688 0.484375 0.382812 
+0.429688 0.476562 0.390625 
+0.421875 0.476562 0.398438 
+0.429688 0.445312 0.390625 
+0.429688 0.476562 0.421875 
+0.40625 0.445312 0.398438 
+0.421875 0.453125 0.414062 
+0.429688 0.445312 0.414062 
+0.429688 0.453125 0.40625 
+0.421875 0.460938 0.40625 
+0.453125 0.460938 0.382812 
+0.453125 0.492188 0.382812 
+0.460938 0.484375 0.382812 
+0.460938 0.476562 0.390625 
+0.484375 0.492188 0.382812 
+0.445312 0.460938 0.390625 
+0.453125 0.476562 0.398438 
+0.445312 0.453125 0.398438 
+0.445312 0.453125 0.429688 
+0.445312 0.460938 0.421875 
+0.453125 0.460938 0.414062 
+0.453125 0.476562 0.429688 
+0.460938 0.476562 0.421875 
+0.453125 0.460938 0.445312 
+0.460938 0.476562 0.453125 
+0.34375 0.484375 0.382812 
+0.34375 0.484375 0.398438 
+0.359375 0.40625 0.382812 
+0.359375 0.40625 0.398438 
+0.34375 0.421875 0.382812 
+0.34375 0.421875 0.398438 
+0.359375 0.453125 0.382812 
+0.359375 0.476562 0.382812 
+0.359375 0.46875 0.390625 
+0.359375 0.476562 0.40625 
+0.359375 0.445312 0.390625 
+0.359375 0.445312 0.414062 
+0.359375 0.453125 0.40625 
+0.359375 0.46875 0.414062 
+0.34375 0.445312 0.421875 
+0.34375 0.460938 0.421875 
+0.359375 0.453125 0.445312 
+0.359375 0.476562 0.445312 
+0.359375 0.46875 0.453125 
+0.359375 0.476562 0.46875 
+0.390625 0.421875 0.398438 
+0.382812 0.421875 0.414062 
+0.398438 0.421875 0.414062 
+0.382812 0.460938 0.390625 
+0.382812 0.492188 0.390625 
+0.382812 0.484375 0.398438 
+0.390625 0.476562 0.398438 
+0.382812 0.492188 0.421875 
+0.390625 0.492188 0.414062 
+0.398438 0.484375 0.414062 
+0.382812 0.453125 0.398438 
+0.382812 0.453125 0.429688 
+0.382812 0.460938 0.421875 
+0.390625 0.460938 0.414062 
+0.382812 0.484375 0.429688 
+0.390625 0.476562 0.429688 
+0.398438 0.476562 0.421875 
+0.390625 0.445312 0.429688 
+0.421875 0.476562 0.429688 
+0.398438 0.445312 0.40625 
+0.414062 0.453125 0.421875 
+0.414062 0.445312 0.429688 
+0.40625 0.453125 0.429688 
+0.40625 0.460938 0.421875 
+0.382812 0.460938 0.453125 
+0.382812 0.492188 0.453125 
+0.382812 0.484375 0.460938 
+0.390625 0.476562 0.460938 
+0.382812 0.492188 0.484375 
+0.390625 0.460938 0.445312 
+0.398438 0.476562 0.453125 
+0.398438 0.453125 0.445312 
+0.429688 0.453125 0.445312 
+0.421875 0.460938 0.445312 
+0.414062 0.460938 0.453125 
+0.429688 0.476562 0.453125 
+0.421875 0.476562 0.460938 
+0.445312 0.460938 0.453125 
+0.453125 0.476562 0.460938 
+0.382812 0.34375 0.484375 
+0.398438 0.34375 0.484375 
+0.382812 0.359375 0.40625 
+0.398438 0.359375 0.40625 
+0.382812 0.34375 0.421875 
+0.398438 0.34375 0.421875 
+0.382812 0.359375 0.453125 
+0.382812 0.359375 0.476562 
+0.390625 0.359375 0.46875 
+0.40625 0.359375 0.476562 
+0.390625 0.359375 0.445312 
+0.414062 0.359375 0.445312 
+0.40625 0.359375 0.453125 
+0.414062 0.359375 0.46875 
+0.421875 0.34375 0.445312 
+0.421875 0.34375 0.460938 
+0.445312 0.359375 0.453125 
+0.445312 0.359375 0.476562 
+0.453125 0.359375 0.46875 
+0.46875 0.359375 0.476562 
+0.398438 0.390625 0.421875 
+0.414062 0.382812 0.421875 
+0.414062 0.398438 0.421875 
+0.390625 0.382812 0.460938 
+0.390625 0.382812 0.492188 
+0.398438 0.382812 0.484375 
+0.398438 0.390625 0.476562 
+0.421875 0.382812 0.492188 
+0.414062 0.390625 0.492188 
+0.414062 0.398438 0.484375 
+0.398438 0.382812 0.453125 
+0.429688 0.382812 0.453125 
+0.421875 0.382812 0.460938 
+0.414062 0.390625 0.460938 
+0.429688 0.382812 0.484375 
+0.429688 0.390625 0.476562 
+0.421875 0.398438 0.476562 
+0.429688 0.390625 0.445312 
+0.429688 0.421875 0.476562 
+0.40625 0.398438 0.445312 
+0.421875 0.414062 0.453125 
+0.429688 0.414062 0.445312 
+0.429688 0.40625 0.453125 
+0.421875 0.40625 0.460938 
+0.453125 0.382812 0.460938 
+0.453125 0.382812 0.492188 
+0.460938 0.382812 0.484375 
+0.460938 0.390625 0.476562 
+0.484375 0.382812 0.492188 
+0.445312 0.390625 0.460938 
+0.453125 0.398438 0.476562 
+0.445312 0.398438 0.453125 
+0.445312 0.429688 0.453125 
+0.445312 0.421875 0.460938 
+0.453125 0.414062 0.460938 
+0.453125 0.429688 0.476562 
+0.460938 0.421875 0.476562 
+0.453125 0.445312 0.460938 
+0.460938 0.453125 0.476562 
+0.34375 0.382812 0.484375 
+0.34375 0.398438 0.484375 
+0.359375 0.382812 0.40625 
+0.359375 0.398438 0.40625 
+0.34375 0.382812 0.421875 
+0.34375 0.398438 0.421875 
+0.359375 0.382812 0.453125 
+0.359375 0.382812 0.476562 
+0.359375 0.390625 0.46875 
+0.359375 0.40625 0.476562 
+0.359375 0.390625 0.445312 
+0.359375 0.414062 0.445312 
+0.359375 0.40625 0.453125 
+0.359375 0.414062 0.46875 
+0.34375 0.421875 0.445312 
+0.34375 0.421875 0.460938 
+0.359375 0.445312 0.453125 
+0.359375 0.445312 0.476562 
+0.359375 0.453125 0.46875 
+0.359375 0.46875 0.476562 
+0.390625 0.398438 0.421875 
+0.382812 0.414062 0.421875 
+0.398438 0.414062 0.421875 
+0.382812 0.390625 0.460938 
+0.382812 0.390625 0.492188 
+0.382812 0.398438 0.484375 
+0.390625 0.398438 0.476562 
+0.382812 0.421875 0.492188 
+0.390625 0.414062 0.492188 
+0.398438 0.414062 0.484375 
+0.382812 0.398438 0.453125 
+0.382812 0.429688 0.453125 
+0.382812 0.421875 0.460938 
+0.390625 0.414062 0.460938 
+0.382812 0.429688 0.484375 
+0.390625 0.429688 0.476562 
+0.398438 0.421875 0.476562 
+0.390625 0.429688 0.445312 
+0.421875 0.429688 0.476562 
+0.398438 0.40625 0.445312 
+0.414062 0.421875 0.453125 
+0.414062 0.429688 0.445312 
+0.40625 0.429688 0.453125 
+0.40625 0.421875 0.460938 
+0.382812 0.453125 0.460938 
+0.382812 0.453125 0.492188 
+0.382812 0.460938 0.484375 
+0.390625 0.460938 0.476562 
+0.382812 0.484375 0.492188 
+0.390625 0.445312 0.460938 
+0.398438 0.453125 0.476562 
+0.398438 0.445312 0.453125 
+0.429688 0.445312 0.453125 
+0.421875 0.445312 0.460938 
+0.414062 0.453125 0.460938 
+0.429688 0.453125 0.476562 
+0.421875 0.460938 0.476562 
+0.445312 0.453125 0.460938 
+0.453125 0.460938 0.476562 
+0.515625 0.398438 0.359375 
+0.507812 0.414062 0.359375 
+0.523438 0.414062 0.359375 
+0.507812 0.421875 0.34375 
+0.523438 0.421875 0.34375 
+0.507812 0.453125 0.359375 
+0.507812 0.476562 0.359375 
+0.515625 0.46875 0.359375 
+0.53125 0.476562 0.359375 
+0.515625 0.445312 0.359375 
+0.539062 0.445312 0.359375 
+0.53125 0.453125 0.359375 
+0.539062 0.46875 0.359375 
+0.546875 0.445312 0.34375 
+0.546875 0.460938 0.34375 
+0.578125 0.460938 0.359375 
+0.578125 0.476562 0.359375 
+0.515625 0.429688 0.382812 
+0.546875 0.429688 0.414062 
+0.523438 0.40625 0.382812 
+0.539062 0.421875 0.390625 
+0.539062 0.429688 0.382812 
+0.53125 0.429688 0.390625 
+0.53125 0.421875 0.398438 
+0.515625 0.460938 0.382812 
+0.515625 0.492188 0.382812 
+0.523438 0.484375 0.382812 
+0.546875 0.492188 0.382812 
+0.539062 0.492188 0.390625 
+0.523438 0.453125 0.382812 
+0.554688 0.453125 0.382812 
+0.546875 0.460938 0.382812 
+0.539062 0.460938 0.390625 
+0.554688 0.484375 0.382812 
+0.554688 0.476562 0.390625 
+0.546875 0.476562 0.398438 
+0.554688 0.445312 0.390625 
+0.546875 0.445312 0.398438 
+0.585938 0.46875 0.382812 
+0.59375 0.492188 0.390625 
+0.601562 0.484375 0.398438 
+0.570312 0.460938 0.390625 
+0.570312 0.492188 0.421875 
+0.578125 0.492188 0.398438 
+0.570312 0.484375 0.40625 
+0.578125 0.476562 0.40625 
+0.585938 0.492188 0.414062 
+0.59375 0.484375 0.414062 
+0.570312 0.453125 0.398438 
+0.570312 0.460938 0.421875 
+0.578125 0.460938 0.414062 
+0.578125 0.476562 0.429688 
+0.585938 0.476562 0.421875 
+0.601562 0.484375 0.429688 
+0.609375 0.492188 0.445312 
+0.601562 0.492188 0.453125 
+0.539062 0.398438 0.382812 
+0.554688 0.414062 0.390625 
+0.554688 0.414062 0.40625 
+0.578125 0.421875 0.398438 
+0.570312 0.421875 0.414062 
+0.585938 0.421875 0.414062 
+0.601562 0.460938 0.382812 
+0.617188 0.476562 0.398438 
+0.601562 0.445312 0.398438 
+0.617188 0.453125 0.414062 
+0.617188 0.46875 0.414062 
+0.578125 0.445312 0.429688 
+0.609375 0.476562 0.429688 
+0.585938 0.445312 0.40625 
+0.601562 0.453125 0.421875 
+0.601562 0.445312 0.429688 
+0.59375 0.453125 0.429688 
+0.59375 0.460938 0.421875 
+0.617188 0.453125 0.445312 
+0.609375 0.460938 0.445312 
+0.601562 0.460938 0.453125 
+0.617188 0.484375 0.445312 
+0.617188 0.476562 0.453125 
+0.609375 0.476562 0.460938 
+0.617188 0.484375 0.476562 
+0.515625 0.359375 0.398438 
+0.507812 0.359375 0.414062 
+0.523438 0.359375 0.414062 
+0.507812 0.34375 0.421875 
+0.523438 0.34375 0.421875 
+0.507812 0.359375 0.453125 
+0.507812 0.359375 0.476562 
+0.515625 0.359375 0.46875 
+0.53125 0.359375 0.476562 
+0.515625 0.359375 0.445312 
+0.539062 0.359375 0.445312 
+0.53125 0.359375 0.453125 
+0.539062 0.359375 0.46875 
+0.546875 0.34375 0.445312 
+0.546875 0.34375 0.460938 
+0.578125 0.359375 0.460938 
+0.578125 0.359375 0.476562 
+0.515625 0.382812 0.429688 
+0.546875 0.414062 0.429688 
+0.523438 0.382812 0.40625 
+0.539062 0.390625 0.421875 
+0.539062 0.382812 0.429688 
+0.53125 0.390625 0.429688 
+0.53125 0.398438 0.421875 
+0.515625 0.382812 0.460938 
+0.515625 0.382812 0.492188 
+0.523438 0.382812 0.484375 
+0.546875 0.382812 0.492188 
+0.539062 0.390625 0.492188 
+0.523438 0.382812 0.453125 
+0.554688 0.382812 0.453125 
+0.546875 0.382812 0.460938 
+0.539062 0.390625 0.460938 
+0.554688 0.382812 0.484375 
+0.554688 0.390625 0.476562 
+0.546875 0.398438 0.476562 
+0.554688 0.390625 0.445312 
+0.546875 0.398438 0.445312 
+0.585938 0.382812 0.46875 
+0.59375 0.390625 0.492188 
+0.601562 0.398438 0.484375 
+0.570312 0.390625 0.460938 
+0.570312 0.421875 0.492188 
+0.578125 0.398438 0.492188 
+0.570312 0.40625 0.484375 
+0.578125 0.40625 0.476562 
+0.585938 0.414062 0.492188 
+0.59375 0.414062 0.484375 
+0.570312 0.398438 0.453125 
+0.570312 0.421875 0.460938 
+0.578125 0.414062 0.460938 
+0.578125 0.429688 0.476562 
+0.585938 0.421875 0.476562 
+0.601562 0.429688 0.484375 
+0.609375 0.445312 0.492188 
+0.601562 0.453125 0.492188 
+0.539062 0.382812 0.398438 
+0.554688 0.390625 0.414062 
+0.554688 0.40625 0.414062 
+0.578125 0.398438 0.421875 
+0.570312 0.414062 0.421875 
+0.585938 0.414062 0.421875 
+0.601562 0.382812 0.460938 
+0.617188 0.398438 0.476562 
+0.601562 0.398438 0.445312 
+0.617188 0.414062 0.453125 
+0.617188 0.414062 0.46875 
+0.578125 0.429688 0.445312 
+0.609375 0.429688 0.476562 
+0.585938 0.40625 0.445312 
+0.601562 0.421875 0.453125 
+0.601562 0.429688 0.445312 
+0.59375 0.429688 0.453125 
+0.59375 0.421875 0.460938 
+0.617188 0.445312 0.453125 
+0.609375 0.445312 0.460938 
+0.601562 0.453125 0.460938 
+0.617188 0.445312 0.484375 
+0.617188 0.453125 0.476562 
+0.609375 0.460938 0.476562 
+0.617188 0.476562 0.484375 
+0.398438 0.515625 0.359375 
+0.414062 0.507812 0.359375 
+0.414062 0.523438 0.359375 
+0.421875 0.507812 0.34375 
+0.421875 0.523438 0.34375 
+0.453125 0.507812 0.359375 
+0.476562 0.507812 0.359375 
+0.46875 0.515625 0.359375 
+0.476562 0.53125 0.359375 
+0.445312 0.515625 0.359375 
+0.445312 0.539062 0.359375 
+0.453125 0.53125 0.359375 
+0.46875 0.539062 0.359375 
+0.445312 0.546875 0.34375 
+0.460938 0.546875 0.34375 
+0.460938 0.578125 0.359375 
+0.476562 0.578125 0.359375 
+0.429688 0.515625 0.382812 
+0.429688 0.546875 0.414062 
+0.40625 0.523438 0.382812 
+0.421875 0.539062 0.390625 
+0.429688 0.539062 0.382812 
+0.429688 0.53125 0.390625 
+0.421875 0.53125 0.398438 
+0.460938 0.515625 0.382812 
+0.492188 0.515625 0.382812 
+0.484375 0.523438 0.382812 
+0.492188 0.546875 0.382812 
+0.492188 0.539062 0.390625 
+0.453125 0.523438 0.382812 
+0.453125 0.554688 0.382812 
+0.460938 0.546875 0.382812 
+0.460938 0.539062 0.390625 
+0.484375 0.554688 0.382812 
+0.476562 0.554688 0.390625 
+0.476562 0.546875 0.398438 
+0.445312 0.554688 0.390625 
+0.445312 0.546875 0.398438 
+0.46875 0.585938 0.382812 
+0.492188 0.59375 0.390625 
+0.484375 0.601562 0.398438 
+0.460938 0.570312 0.390625 
+0.492188 0.570312 0.421875 
+0.492188 0.578125 0.398438 
+0.484375 0.570312 0.40625 
+0.476562 0.578125 0.40625 
+0.492188 0.585938 0.414062 
+0.484375 0.59375 0.414062 
+0.453125 0.570312 0.398438 
+0.460938 0.570312 0.421875 
+0.460938 0.578125 0.414062 
+0.476562 0.578125 0.429688 
+0.476562 0.585938 0.421875 
+0.484375 0.601562 0.429688 
+0.492188 0.609375 0.445312 
+0.492188 0.601562 0.453125 
+0.398438 0.539062 0.382812 
+0.414062 0.554688 0.390625 
+0.414062 0.554688 0.40625 
+0.421875 0.578125 0.398438 
+0.421875 0.570312 0.414062 
+0.421875 0.585938 0.414062 
+0.460938 0.601562 0.382812 
+0.476562 0.617188 0.398438 
+0.445312 0.601562 0.398438 
+0.453125 0.617188 0.414062 
+0.46875 0.617188 0.414062 
+0.445312 0.578125 0.429688 
+0.476562 0.609375 0.429688 
+0.445312 0.585938 0.40625 
+0.453125 0.601562 0.421875 
+0.445312 0.601562 0.429688 
+0.453125 0.59375 0.429688 
+0.460938 0.59375 0.421875 
+0.453125 0.617188 0.445312 
+0.460938 0.609375 0.445312 
+0.460938 0.601562 0.453125 
+0.484375 0.617188 0.445312 
+0.476562 0.617188 0.453125 
+0.476562 0.609375 0.460938 
+0.484375 0.617188 0.476562 
+0.359375 0.515625 0.398438 
+0.359375 0.507812 0.414062 
+0.359375 0.523438 0.414062 
+0.34375 0.507812 0.421875 
+0.34375 0.523438 0.421875 
+0.359375 0.507812 0.453125 
+0.359375 0.507812 0.476562 
+0.359375 0.515625 0.46875 
+0.359375 0.53125 0.476562 
+0.359375 0.515625 0.445312 
+0.359375 0.539062 0.445312 
+0.359375 0.53125 0.453125 
+0.359375 0.539062 0.46875 
+0.34375 0.546875 0.445312 
+0.34375 0.546875 0.460938 
+0.359375 0.578125 0.460938 
+0.359375 0.578125 0.476562 
+0.382812 0.515625 0.429688 
+0.414062 0.546875 0.429688 
+0.382812 0.523438 0.40625 
+0.390625 0.539062 0.421875 
+0.382812 0.539062 0.429688 
+0.390625 0.53125 0.429688 
+0.398438 0.53125 0.421875 
+0.382812 0.515625 0.460938 
+0.382812 0.515625 0.492188 
+0.382812 0.523438 0.484375 
+0.382812 0.546875 0.492188 
+0.390625 0.539062 0.492188 
+0.382812 0.523438 0.453125 
+0.382812 0.554688 0.453125 
+0.382812 0.546875 0.460938 
+0.390625 0.539062 0.460938 
+0.382812 0.554688 0.484375 
+0.390625 0.554688 0.476562 
+0.398438 0.546875 0.476562 
+0.390625 0.554688 0.445312 
+0.398438 0.546875 0.445312 
+0.382812 0.585938 0.46875 
+0.390625 0.59375 0.492188 
+0.398438 0.601562 0.484375 
+0.390625 0.570312 0.460938 
+0.421875 0.570312 0.492188 
+0.398438 0.578125 0.492188 
+0.40625 0.570312 0.484375 
+0.40625 0.578125 0.476562 
+0.414062 0.585938 0.492188 
+0.414062 0.59375 0.484375 
+0.398438 0.570312 0.453125 
+0.421875 0.570312 0.460938 
+0.414062 0.578125 0.460938 
+0.429688 0.578125 0.476562 
+0.421875 0.585938 0.476562 
+0.429688 0.601562 0.484375 
+0.445312 0.609375 0.492188 
+0.453125 0.601562 0.492188 
+0.382812 0.539062 0.398438 
+0.390625 0.554688 0.414062 
+0.40625 0.554688 0.414062 
+0.398438 0.578125 0.421875 
+0.414062 0.570312 0.421875 
+0.414062 0.585938 0.421875 
+0.382812 0.601562 0.460938 
+0.398438 0.617188 0.476562 
+0.398438 0.601562 0.445312 
+0.414062 0.617188 0.453125 
+0.414062 0.617188 0.46875 
+0.429688 0.578125 0.445312 
+0.429688 0.609375 0.476562 
+0.40625 0.585938 0.445312 
+0.421875 0.601562 0.453125 
+0.429688 0.601562 0.445312 
+0.429688 0.59375 0.453125 
+0.421875 0.59375 0.460938 
+0.445312 0.617188 0.453125 
+0.445312 0.609375 0.460938 
+0.453125 0.601562 0.460938 
+0.445312 0.617188 0.484375 
+0.453125 0.617188 0.476562 
+0.460938 0.609375 0.476562 
+0.476562 0.617188 0.484375 
+0.554688 0.507812 0.390625 
+0.546875 0.507812 0.398438 
+0.601562 0.507812 0.398438 
+0.617188 0.515625 0.414062 
+0.617188 0.53125 0.414062 
+0.578125 0.507812 0.429688 
+0.609375 0.539062 0.429688 
+0.585938 0.507812 0.40625 
+0.601562 0.515625 0.421875 
+0.601562 0.507812 0.429688 
+0.59375 0.515625 0.429688 
+0.59375 0.523438 0.421875 
+0.570312 0.515625 0.398438 
+0.570312 0.523438 0.421875 
+0.578125 0.523438 0.414062 
+0.578125 0.539062 0.429688 
+0.585938 0.539062 0.421875 
+0.601562 0.546875 0.429688 
+0.617188 0.507812 0.453125 
+0.609375 0.507812 0.460938 
+0.617188 0.507812 0.484375 
+0.617188 0.515625 0.476562 
+0.617188 0.539062 0.484375 
+0.617188 0.515625 0.445312 
+0.609375 0.523438 0.445312 
+0.601562 0.523438 0.453125 
+0.617188 0.546875 0.445312 
+0.617188 0.539062 0.453125 
+0.609375 0.539062 0.460938 
+0.617188 0.546875 0.476562 
+0.609375 0.554688 0.445312 
+0.601562 0.554688 0.453125 
+0.585938 0.570312 0.453125 
+0.617188 0.570312 0.484375 
+0.617188 0.578125 0.460938 
+0.609375 0.570312 0.46875 
+0.601562 0.578125 0.46875 
+0.617188 0.585938 0.476562 
+0.609375 0.59375 0.476562 
+0.523438 0.515625 0.382812 
+0.554688 0.515625 0.382812 
+0.546875 0.523438 0.382812 
+0.539062 0.523438 0.390625 
+0.554688 0.546875 0.382812 
+0.554688 0.539062 0.390625 
+0.546875 0.539062 0.398438 
+0.601562 0.523438 0.382812 
+0.617188 0.539062 0.398438 
+0.585938 0.53125 0.382812 
+0.59375 0.554688 0.390625 
+0.601562 0.546875 0.398438 
+0.570312 0.523438 0.390625 
+0.570312 0.554688 0.421875 
+0.578125 0.554688 0.398438 
+0.570312 0.546875 0.40625 
+0.578125 0.539062 0.40625 
+0.585938 0.554688 0.414062 
+0.59375 0.546875 0.414062 
+0.59375 0.578125 0.414062 
+0.585938 0.578125 0.429688 
+0.601562 0.578125 0.429688 
+0.59375 0.585938 0.445312 
+0.617188 0.59375 0.453125 
+0.609375 0.601562 0.460938 
+0.640625 0.523438 0.421875 
+0.640625 0.539062 0.421875 
+0.640625 0.523438 0.46875 
+0.640625 0.523438 0.492188 
+0.640625 0.53125 0.484375 
+0.640625 0.546875 0.492188 
+0.640625 0.53125 0.460938 
+0.640625 0.554688 0.460938 
+0.640625 0.546875 0.46875 
+0.640625 0.554688 0.484375 
+0.65625 0.539062 0.453125 
+0.65625 0.554688 0.453125 
+0.640625 0.59375 0.476562 
+0.640625 0.585938 0.492188 
+0.640625 0.601562 0.492188 
+0.65625 0.578125 0.476562 
+0.65625 0.578125 0.492188 
+0.507812 0.554688 0.390625 
+0.507812 0.546875 0.398438 
+0.507812 0.601562 0.398438 
+0.515625 0.617188 0.414062 
+0.53125 0.617188 0.414062 
+0.507812 0.578125 0.429688 
+0.539062 0.609375 0.429688 
+0.507812 0.585938 0.40625 
+0.515625 0.601562 0.421875 
+0.507812 0.601562 0.429688 
+0.515625 0.59375 0.429688 
+0.523438 0.59375 0.421875 
+0.515625 0.570312 0.398438 
+0.523438 0.570312 0.421875 
+0.523438 0.578125 0.414062 
+0.539062 0.578125 0.429688 
+0.539062 0.585938 0.421875 
+0.546875 0.601562 0.429688 
+0.507812 0.617188 0.453125 
+0.507812 0.609375 0.460938 
+0.507812 0.617188 0.484375 
+0.515625 0.617188 0.476562 
+0.539062 0.617188 0.484375 
+0.515625 0.617188 0.445312 
+0.523438 0.609375 0.445312 
+0.523438 0.601562 0.453125 
+0.546875 0.617188 0.445312 
+0.539062 0.617188 0.453125 
+0.539062 0.609375 0.460938 
+0.546875 0.617188 0.476562 
+0.554688 0.609375 0.445312 
+0.554688 0.601562 0.453125 
+0.570312 0.585938 0.453125 
+0.570312 0.617188 0.484375 
+0.578125 0.617188 0.460938 
+0.570312 0.609375 0.46875 
+0.578125 0.601562 0.46875 
+0.585938 0.617188 0.476562 
+0.59375 0.609375 0.476562 
+0.515625 0.523438 0.382812 
+0.515625 0.554688 0.382812 
+0.523438 0.546875 0.382812 
+0.523438 0.539062 0.390625 
+0.546875 0.554688 0.382812 
+0.539062 0.554688 0.390625 
+0.539062 0.546875 0.398438 
+0.523438 0.601562 0.382812 
+0.539062 0.617188 0.398438 
+0.53125 0.585938 0.382812 
+0.554688 0.59375 0.390625 
+0.546875 0.601562 0.398438 
+0.523438 0.570312 0.390625 
+0.554688 0.570312 0.421875 
+0.554688 0.578125 0.398438 
+0.546875 0.570312 0.40625 
+0.539062 0.578125 0.40625 
+0.554688 0.585938 0.414062 
+0.546875 0.59375 0.414062 
+0.578125 0.59375 0.414062 
+0.578125 0.585938 0.429688 
+0.578125 0.601562 0.429688 
+0.585938 0.59375 0.445312 
+0.59375 0.617188 0.453125 
+0.601562 0.609375 0.460938 
+0.523438 0.640625 0.421875 
+0.539062 0.640625 0.421875 
+0.523438 0.640625 0.46875 
+0.523438 0.640625 0.492188 
+0.53125 0.640625 0.484375 
+0.546875 0.640625 0.492188 
+0.53125 0.640625 0.460938 
+0.554688 0.640625 0.460938 
+0.546875 0.640625 0.46875 
+0.554688 0.640625 0.484375 
+0.539062 0.65625 0.453125 
+0.554688 0.65625 0.453125 
+0.59375 0.640625 0.476562 
+0.585938 0.640625 0.492188 
+0.601562 0.640625 0.492188 
+0.578125 0.65625 0.476562 
+0.578125 0.65625 0.492188 
+0.398438 0.359375 0.515625 
+0.414062 0.359375 0.507812 
+0.414062 0.359375 0.523438 
+0.421875 0.34375 0.507812 
+0.421875 0.34375 0.523438 
+0.453125 0.359375 0.507812 
+0.476562 0.359375 0.507812 
+0.46875 0.359375 0.515625 
+0.476562 0.359375 0.53125 
+0.445312 0.359375 0.515625 
+0.445312 0.359375 0.539062 
+0.453125 0.359375 0.53125 
+0.46875 0.359375 0.539062 
+0.445312 0.34375 0.546875 
+0.460938 0.34375 0.546875 
+0.460938 0.359375 0.578125 
+0.476562 0.359375 0.578125 
+0.429688 0.382812 0.515625 
+0.429688 0.414062 0.546875 
+0.40625 0.382812 0.523438 
+0.421875 0.390625 0.539062 
+0.429688 0.382812 0.539062 
+0.429688 0.390625 0.53125 
+0.421875 0.398438 0.53125 
+0.460938 0.382812 0.515625 
+0.492188 0.382812 0.515625 
+0.484375 0.382812 0.523438 
+0.492188 0.382812 0.546875 
+0.492188 0.390625 0.539062 
+0.453125 0.382812 0.523438 
+0.453125 0.382812 0.554688 
+0.460938 0.382812 0.546875 
+0.460938 0.390625 0.539062 
+0.484375 0.382812 0.554688 
+0.476562 0.390625 0.554688 
+0.476562 0.398438 0.546875 
+0.445312 0.390625 0.554688 
+0.445312 0.398438 0.546875 
+0.46875 0.382812 0.585938 
+0.492188 0.390625 0.59375 
+0.484375 0.398438 0.601562 
+0.460938 0.390625 0.570312 
+0.492188 0.421875 0.570312 
+0.492188 0.398438 0.578125 
+0.484375 0.40625 0.570312 
+0.476562 0.40625 0.578125 
+0.492188 0.414062 0.585938 
+0.484375 0.414062 0.59375 
+0.453125 0.398438 0.570312 
+0.460938 0.421875 0.570312 
+0.460938 0.414062 0.578125 
+0.476562 0.429688 0.578125 
+0.476562 0.421875 0.585938 
+0.484375 0.429688 0.601562 
+0.492188 0.445312 0.609375 
+0.492188 0.453125 0.601562 
+0.398438 0.382812 0.539062 
+0.414062 0.390625 0.554688 
+0.414062 0.40625 0.554688 
+0.421875 0.398438 0.578125 
+0.421875 0.414062 0.570312 
+0.421875 0.414062 0.585938 
+0.460938 0.382812 0.601562 
+0.476562 0.398438 0.617188 
+0.445312 0.398438 0.601562 
+0.453125 0.414062 0.617188 
+0.46875 0.414062 0.617188 
+0.445312 0.429688 0.578125 
+0.476562 0.429688 0.609375 
+0.445312 0.40625 0.585938 
+0.453125 0.421875 0.601562 
+0.445312 0.429688 0.601562 
+0.453125 0.429688 0.59375 
+0.460938 0.421875 0.59375 
+0.453125 0.445312 0.617188 
+0.460938 0.445312 0.609375 
+0.460938 0.453125 0.601562 
+0.484375 0.445312 0.617188 
+0.476562 0.453125 0.617188 
+0.476562 0.460938 0.609375 
+0.484375 0.476562 0.617188 
+0.359375 0.398438 0.515625 
+0.359375 0.414062 0.507812 
+0.359375 0.414062 0.523438 
+0.34375 0.421875 0.507812 
+0.34375 0.421875 0.523438 
+0.359375 0.453125 0.507812 
+0.359375 0.476562 0.507812 
+0.359375 0.46875 0.515625 
+0.359375 0.476562 0.53125 
+0.359375 0.445312 0.515625 
+0.359375 0.445312 0.539062 
+0.359375 0.453125 0.53125 
+0.359375 0.46875 0.539062 
+0.34375 0.445312 0.546875 
+0.34375 0.460938 0.546875 
+0.359375 0.460938 0.578125 
+0.359375 0.476562 0.578125 
+0.382812 0.429688 0.515625 
+0.414062 0.429688 0.546875 
+0.382812 0.40625 0.523438 
+0.390625 0.421875 0.539062 
+0.382812 0.429688 0.539062 
+0.390625 0.429688 0.53125 
+0.398438 0.421875 0.53125 
+0.382812 0.460938 0.515625 
+0.382812 0.492188 0.515625 
+0.382812 0.484375 0.523438 
+0.382812 0.492188 0.546875 
+0.390625 0.492188 0.539062 
+0.382812 0.453125 0.523438 
+0.382812 0.453125 0.554688 
+0.382812 0.460938 0.546875 
+0.390625 0.460938 0.539062 
+0.382812 0.484375 0.554688 
+0.390625 0.476562 0.554688 
+0.398438 0.476562 0.546875 
+0.390625 0.445312 0.554688 
+0.398438 0.445312 0.546875 
+0.382812 0.46875 0.585938 
+0.390625 0.492188 0.59375 
+0.398438 0.484375 0.601562 
+0.390625 0.460938 0.570312 
+0.421875 0.492188 0.570312 
+0.398438 0.492188 0.578125 
+0.40625 0.484375 0.570312 
+0.40625 0.476562 0.578125 
+0.414062 0.492188 0.585938 
+0.414062 0.484375 0.59375 
+0.398438 0.453125 0.570312 
+0.421875 0.460938 0.570312 
+0.414062 0.460938 0.578125 
+0.429688 0.476562 0.578125 
+0.421875 0.476562 0.585938 
+0.429688 0.484375 0.601562 
+0.445312 0.492188 0.609375 
+0.453125 0.492188 0.601562 
+0.382812 0.398438 0.539062 
+0.390625 0.414062 0.554688 
+0.40625 0.414062 0.554688 
+0.398438 0.421875 0.578125 
+0.414062 0.421875 0.570312 
+0.414062 0.421875 0.585938 
+0.382812 0.460938 0.601562 
+0.398438 0.476562 0.617188 
+0.398438 0.445312 0.601562 
+0.414062 0.453125 0.617188 
+0.414062 0.46875 0.617188 
+0.429688 0.445312 0.578125 
+0.429688 0.476562 0.609375 
+0.40625 0.445312 0.585938 
+0.421875 0.453125 0.601562 
+0.429688 0.445312 0.601562 
+0.429688 0.453125 0.59375 
+0.421875 0.460938 0.59375 
+0.445312 0.453125 0.617188 
+0.445312 0.460938 0.609375 
+0.453125 0.460938 0.601562 
+0.445312 0.484375 0.617188 
+0.453125 0.476562 0.617188 
+0.460938 0.476562 0.609375 
+0.476562 0.484375 0.617188 
+0.554688 0.390625 0.507812 
+0.546875 0.398438 0.507812 
+0.601562 0.398438 0.507812 
+0.617188 0.414062 0.515625 
+0.617188 0.414062 0.53125 
+0.578125 0.429688 0.507812 
+0.609375 0.429688 0.539062 
+0.585938 0.40625 0.507812 
+0.601562 0.421875 0.515625 
+0.601562 0.429688 0.507812 
+0.59375 0.429688 0.515625 
+0.59375 0.421875 0.523438 
+0.570312 0.398438 0.515625 
+0.570312 0.421875 0.523438 
+0.578125 0.414062 0.523438 
+0.578125 0.429688 0.539062 
+0.585938 0.421875 0.539062 
+0.601562 0.429688 0.546875 
+0.617188 0.453125 0.507812 
+0.609375 0.460938 0.507812 
+0.617188 0.484375 0.507812 
+0.617188 0.476562 0.515625 
+0.617188 0.484375 0.539062 
+0.617188 0.445312 0.515625 
+0.609375 0.445312 0.523438 
+0.601562 0.453125 0.523438 
+0.617188 0.445312 0.546875 
+0.617188 0.453125 0.539062 
+0.609375 0.460938 0.539062 
+0.617188 0.476562 0.546875 
+0.609375 0.445312 0.554688 
+0.601562 0.453125 0.554688 
+0.585938 0.453125 0.570312 
+0.617188 0.484375 0.570312 
+0.617188 0.460938 0.578125 
+0.609375 0.46875 0.570312 
+0.601562 0.46875 0.578125 
+0.617188 0.476562 0.585938 
+0.609375 0.476562 0.59375 
+0.523438 0.382812 0.515625 
+0.554688 0.382812 0.515625 
+0.546875 0.382812 0.523438 
+0.539062 0.390625 0.523438 
+0.554688 0.382812 0.546875 
+0.554688 0.390625 0.539062 
+0.546875 0.398438 0.539062 
+0.601562 0.382812 0.523438 
+0.617188 0.398438 0.539062 
+0.585938 0.382812 0.53125 
+0.59375 0.390625 0.554688 
+0.601562 0.398438 0.546875 
+0.570312 0.390625 0.523438 
+0.570312 0.421875 0.554688 
+0.578125 0.398438 0.554688 
+0.570312 0.40625 0.546875 
+0.578125 0.40625 0.539062 
+0.585938 0.414062 0.554688 
+0.59375 0.414062 0.546875 
+0.59375 0.414062 0.578125 
+0.585938 0.429688 0.578125 
+0.601562 0.429688 0.578125 
+0.59375 0.445312 0.585938 
+0.617188 0.453125 0.59375 
+0.609375 0.460938 0.601562 
+0.640625 0.421875 0.523438 
+0.640625 0.421875 0.539062 
+0.640625 0.46875 0.523438 
+0.640625 0.492188 0.523438 
+0.640625 0.484375 0.53125 
+0.640625 0.492188 0.546875 
+0.640625 0.460938 0.53125 
+0.640625 0.460938 0.554688 
+0.640625 0.46875 0.546875 
+0.640625 0.484375 0.554688 
+0.65625 0.453125 0.539062 
+0.65625 0.453125 0.554688 
+0.640625 0.476562 0.59375 
+0.640625 0.492188 0.585938 
+0.640625 0.492188 0.601562 
+0.65625 0.476562 0.578125 
+0.65625 0.492188 0.578125 
+0.507812 0.390625 0.554688 
+0.507812 0.398438 0.546875 
+0.507812 0.398438 0.601562 
+0.515625 0.414062 0.617188 
+0.53125 0.414062 0.617188 
+0.507812 0.429688 0.578125 
+0.539062 0.429688 0.609375 
+0.507812 0.40625 0.585938 
+0.515625 0.421875 0.601562 
+0.507812 0.429688 0.601562 
+0.515625 0.429688 0.59375 
+0.523438 0.421875 0.59375 
+0.515625 0.398438 0.570312 
+0.523438 0.421875 0.570312 
+0.523438 0.414062 0.578125 
+0.539062 0.429688 0.578125 
+0.539062 0.421875 0.585938 
+0.546875 0.429688 0.601562 
+0.507812 0.453125 0.617188 
+0.507812 0.460938 0.609375 
+0.507812 0.484375 0.617188 
+0.515625 0.476562 0.617188 
+0.539062 0.484375 0.617188 
+0.515625 0.445312 0.617188 
+0.523438 0.445312 0.609375 
+0.523438 0.453125 0.601562 
+0.546875 0.445312 0.617188 
+0.539062 0.453125 0.617188 
+0.539062 0.460938 0.609375 
+0.546875 0.476562 0.617188 
+0.554688 0.445312 0.609375 
+0.554688 0.453125 0.601562 
+0.570312 0.453125 0.585938 
+0.570312 0.484375 0.617188 
+0.578125 0.460938 0.617188 
+0.570312 0.46875 0.609375 
+0.578125 0.46875 0.601562 
+0.585938 0.476562 0.617188 
+0.59375 0.476562 0.609375 
+0.515625 0.382812 0.523438 
+0.515625 0.382812 0.554688 
+0.523438 0.382812 0.546875 
+0.523438 0.390625 0.539062 
+0.546875 0.382812 0.554688 
+0.539062 0.390625 0.554688 
+0.539062 0.398438 0.546875 
+0.523438 0.382812 0.601562 
+0.539062 0.398438 0.617188 
+0.53125 0.382812 0.585938 
+0.554688 0.390625 0.59375 
+0.546875 0.398438 0.601562 
+0.523438 0.390625 0.570312 
+0.554688 0.421875 0.570312 
+0.554688 0.398438 0.578125 
+0.546875 0.40625 0.570312 
+0.539062 0.40625 0.578125 
+0.554688 0.414062 0.585938 
+0.546875 0.414062 0.59375 
+0.578125 0.414062 0.59375 
+0.578125 0.429688 0.585938 
+0.578125 0.429688 0.601562 
+0.585938 0.445312 0.59375 
+0.59375 0.453125 0.617188 
+0.601562 0.460938 0.609375 
+0.523438 0.421875 0.640625 
+0.539062 0.421875 0.640625 
+0.523438 0.46875 0.640625 
+0.523438 0.492188 0.640625 
+0.53125 0.484375 0.640625 
+0.546875 0.492188 0.640625 
+0.53125 0.460938 0.640625 
+0.554688 0.460938 0.640625 
+0.546875 0.46875 0.640625 
+0.554688 0.484375 0.640625 
+0.539062 0.453125 0.65625 
+0.554688 0.453125 0.65625 
+0.59375 0.476562 0.640625 
+0.585938 0.492188 0.640625 
+0.601562 0.492188 0.640625 
+0.578125 0.476562 0.65625 
+0.578125 0.492188 0.65625 
+0.390625 0.554688 0.507812 
+0.398438 0.546875 0.507812 
+0.398438 0.601562 0.507812 
+0.414062 0.617188 0.515625 
+0.414062 0.617188 0.53125 
+0.429688 0.578125 0.507812 
+0.429688 0.609375 0.539062 
+0.40625 0.585938 0.507812 
+0.421875 0.601562 0.515625 
+0.429688 0.601562 0.507812 
+0.429688 0.59375 0.515625 
+0.421875 0.59375 0.523438 
+0.398438 0.570312 0.515625 
+0.421875 0.570312 0.523438 
+0.414062 0.578125 0.523438 
+0.429688 0.578125 0.539062 
+0.421875 0.585938 0.539062 
+0.429688 0.601562 0.546875 
+0.453125 0.617188 0.507812 
+0.460938 0.609375 0.507812 
+0.484375 0.617188 0.507812 
+0.476562 0.617188 0.515625 
+0.484375 0.617188 0.539062 
+0.445312 0.617188 0.515625 
+0.445312 0.609375 0.523438 
+0.453125 0.601562 0.523438 
+0.445312 0.617188 0.546875 
+0.453125 0.617188 0.539062 
+0.460938 0.609375 0.539062 
+0.476562 0.617188 0.546875 
+0.445312 0.609375 0.554688 
+0.453125 0.601562 0.554688 
+0.453125 0.585938 0.570312 
+0.484375 0.617188 0.570312 
+0.460938 0.617188 0.578125 
+0.46875 0.609375 0.570312 
+0.46875 0.601562 0.578125 
+0.476562 0.617188 0.585938 
+0.476562 0.609375 0.59375 
+0.382812 0.523438 0.515625 
+0.382812 0.554688 0.515625 
+0.382812 0.546875 0.523438 
+0.390625 0.539062 0.523438 
+0.382812 0.554688 0.546875 
+0.390625 0.554688 0.539062 
+0.398438 0.546875 0.539062 
+0.382812 0.601562 0.523438 
+0.398438 0.617188 0.539062 
+0.382812 0.585938 0.53125 
+0.390625 0.59375 0.554688 
+0.398438 0.601562 0.546875 
+0.390625 0.570312 0.523438 
+0.421875 0.570312 0.554688 
+0.398438 0.578125 0.554688 
+0.40625 0.570312 0.546875 
+0.40625 0.578125 0.539062 
+0.414062 0.585938 0.554688 
+0.414062 0.59375 0.546875 
+0.414062 0.59375 0.578125 
+0.429688 0.585938 0.578125 
+0.429688 0.601562 0.578125 
+0.445312 0.59375 0.585938 
+0.453125 0.617188 0.59375 
+0.460938 0.609375 0.601562 
+0.421875 0.640625 0.523438 
+0.421875 0.640625 0.539062 
+0.46875 0.640625 0.523438 
+0.492188 0.640625 0.523438 
+0.484375 0.640625 0.53125 
+0.492188 0.640625 0.546875 
+0.460938 0.640625 0.53125 
+0.460938 0.640625 0.554688 
+0.46875 0.640625 0.546875 
+0.484375 0.640625 0.554688 
+0.453125 0.65625 0.539062 
+0.453125 0.65625 0.554688 
+0.476562 0.640625 0.59375 
+0.492188 0.640625 0.585938 
+0.492188 0.640625 0.601562 
+0.476562 0.65625 0.578125 
+0.492188 0.65625 0.578125 
+0.390625 0.507812 0.554688 
+0.398438 0.507812 0.546875 
+0.398438 0.507812 0.601562 
+0.414062 0.515625 0.617188 
+0.414062 0.53125 0.617188 
+0.429688 0.507812 0.578125 
+0.429688 0.539062 0.609375 
+0.40625 0.507812 0.585938 
+0.421875 0.515625 0.601562 
+0.429688 0.507812 0.601562 
+0.429688 0.515625 0.59375 
+0.421875 0.523438 0.59375 
+0.398438 0.515625 0.570312 
+0.421875 0.523438 0.570312 
+0.414062 0.523438 0.578125 
+0.429688 0.539062 0.578125 
+0.421875 0.539062 0.585938 
+0.429688 0.546875 0.601562 
+0.453125 0.507812 0.617188 
+0.460938 0.507812 0.609375 
+0.484375 0.507812 0.617188 
+0.476562 0.515625 0.617188 
+0.484375 0.539062 0.617188 
+0.445312 0.515625 0.617188 
+0.445312 0.523438 0.609375 
+0.453125 0.523438 0.601562 
+0.445312 0.546875 0.617188 
+0.453125 0.539062 0.617188 
+0.460938 0.539062 0.609375 
+0.476562 0.546875 0.617188 
+0.445312 0.554688 0.609375 
+0.453125 0.554688 0.601562 
+0.453125 0.570312 0.585938 
+0.484375 0.570312 0.617188 
+0.460938 0.578125 0.617188 
+0.46875 0.570312 0.609375 
+0.46875 0.578125 0.601562 
+0.476562 0.585938 0.617188 
+0.476562 0.59375 0.609375 
+0.382812 0.515625 0.523438 
+0.382812 0.515625 0.554688 
+0.382812 0.523438 0.546875 
+0.390625 0.523438 0.539062 
+0.382812 0.546875 0.554688 
+0.390625 0.539062 0.554688 
+0.398438 0.539062 0.546875 
+0.382812 0.523438 0.601562 
+0.398438 0.539062 0.617188 
+0.382812 0.53125 0.585938 
+0.390625 0.554688 0.59375 
+0.398438 0.546875 0.601562 
+0.390625 0.523438 0.570312 
+0.421875 0.554688 0.570312 
+0.398438 0.554688 0.578125 
+0.40625 0.546875 0.570312 
+0.40625 0.539062 0.578125 
+0.414062 0.554688 0.585938 
+0.414062 0.546875 0.59375 
+0.414062 0.578125 0.59375 
+0.429688 0.578125 0.585938 
+0.429688 0.578125 0.601562 
+0.445312 0.585938 0.59375 
+0.453125 0.59375 0.617188 
+0.460938 0.601562 0.609375 
+0.421875 0.523438 0.640625 
+0.421875 0.539062 0.640625 
+0.46875 0.523438 0.640625 
+0.492188 0.523438 0.640625 
+0.484375 0.53125 0.640625 
+0.492188 0.546875 0.640625 
+0.460938 0.53125 0.640625 
+0.460938 0.554688 0.640625 
+0.46875 0.546875 0.640625 
+0.484375 0.554688 0.640625 
+0.453125 0.539062 0.65625 
+0.453125 0.554688 0.65625 
+0.476562 0.59375 0.640625 
+0.492188 0.585938 0.640625 
+0.492188 0.601562 0.640625 
+0.476562 0.578125 0.65625 
+0.492188 0.578125 0.65625 
+0.546875 0.539062 0.523438 
+0.554688 0.546875 0.539062 
+0.617188 0.515625 0.507812 
+0.617188 0.546875 0.507812 
+0.617188 0.539062 0.515625 
+0.609375 0.539062 0.523438 
+0.617188 0.546875 0.539062 
+0.601562 0.546875 0.523438 
+0.609375 0.554688 0.539062 
+0.570312 0.546875 0.523438 
+0.578125 0.539062 0.523438 
+0.570312 0.554688 0.546875 
+0.578125 0.554688 0.539062 
+0.585938 0.546875 0.539062 
+0.601562 0.554688 0.546875 
+0.617188 0.578125 0.507812 
+0.609375 0.585938 0.507812 
+0.601562 0.585938 0.515625 
+0.617188 0.609375 0.507812 
+0.617188 0.601562 0.515625 
+0.609375 0.601562 0.523438 
+0.617188 0.609375 0.539062 
+0.617188 0.570312 0.515625 
+0.609375 0.570312 0.523438 
+0.601562 0.578125 0.523438 
+0.617188 0.570312 0.546875 
+0.617188 0.578125 0.539062 
+0.609375 0.585938 0.539062 
+0.617188 0.601562 0.546875 
+0.578125 0.570312 0.523438 
+0.609375 0.570312 0.554688 
+0.585938 0.578125 0.554688 
+0.59375 0.570312 0.546875 
+0.59375 0.578125 0.539062 
+0.601562 0.585938 0.554688 
+0.601562 0.59375 0.546875 
+0.601562 0.59375 0.578125 
+0.617188 0.585938 0.578125 
+0.617188 0.601562 0.578125 
+0.65625 0.601562 0.515625 
+0.65625 0.617188 0.515625 
+0.640625 0.53125 0.523438 
+0.640625 0.554688 0.523438 
+0.640625 0.546875 0.53125 
+0.640625 0.554688 0.546875 
+0.640625 0.59375 0.523438 
+0.640625 0.617188 0.523438 
+0.640625 0.609375 0.53125 
+0.640625 0.617188 0.546875 
+0.640625 0.585938 0.53125 
+0.640625 0.585938 0.554688 
+0.640625 0.59375 0.546875 
+0.640625 0.609375 0.554688 
+0.65625 0.578125 0.539062 
+0.65625 0.578125 0.554688 
+0.640625 0.601562 0.59375 
+0.640625 0.617188 0.59375 
+0.65625 0.601562 0.578125 
+0.65625 0.617188 0.578125 
+0.546875 0.523438 0.539062 
+0.554688 0.539062 0.546875 
+0.617188 0.507812 0.515625 
+0.617188 0.507812 0.546875 
+0.617188 0.515625 0.539062 
+0.609375 0.523438 0.539062 
+0.617188 0.539062 0.546875 
+0.601562 0.523438 0.546875 
+0.609375 0.539062 0.554688 
+0.570312 0.523438 0.546875 
+0.578125 0.523438 0.539062 
+0.570312 0.546875 0.554688 
+0.578125 0.539062 0.554688 
+0.585938 0.539062 0.546875 
+0.601562 0.546875 0.554688 
+0.617188 0.507812 0.578125 
+0.609375 0.507812 0.585938 
+0.601562 0.515625 0.585938 
+0.617188 0.507812 0.609375 
+0.617188 0.515625 0.601562 
+0.609375 0.523438 0.601562 
+0.617188 0.539062 0.609375 
+0.617188 0.515625 0.570312 
+0.609375 0.523438 0.570312 
+0.601562 0.523438 0.578125 
+0.617188 0.546875 0.570312 
+0.617188 0.539062 0.578125 
+0.609375 0.539062 0.585938 
+0.617188 0.546875 0.601562 
+0.578125 0.523438 0.570312 
+0.609375 0.554688 0.570312 
+0.585938 0.554688 0.578125 
+0.59375 0.546875 0.570312 
+0.59375 0.539062 0.578125 
+0.601562 0.554688 0.585938 
+0.601562 0.546875 0.59375 
+0.601562 0.578125 0.59375 
+0.617188 0.578125 0.585938 
+0.617188 0.578125 0.601562 
+0.65625 0.515625 0.601562 
+0.65625 0.515625 0.617188 
+0.640625 0.523438 0.53125 
+0.640625 0.523438 0.554688 
+0.640625 0.53125 0.546875 
+0.640625 0.546875 0.554688 
+0.640625 0.523438 0.59375 
+0.640625 0.523438 0.617188 
+0.640625 0.53125 0.609375 
+0.640625 0.546875 0.617188 
+0.640625 0.53125 0.585938 
+0.640625 0.554688 0.585938 
+0.640625 0.546875 0.59375 
+0.640625 0.554688 0.609375 
+0.65625 0.539062 0.578125 
+0.65625 0.554688 0.578125 
+0.640625 0.59375 0.601562 
+0.640625 0.59375 0.617188 
+0.65625 0.578125 0.601562 
+0.65625 0.578125 0.617188 
+0.539062 0.546875 0.523438 
+0.546875 0.554688 0.539062 
+0.515625 0.617188 0.507812 
+0.546875 0.617188 0.507812 
+0.539062 0.617188 0.515625 
+0.539062 0.609375 0.523438 
+0.546875 0.617188 0.539062 
+0.546875 0.601562 0.523438 
+0.554688 0.609375 0.539062 
+0.546875 0.570312 0.523438 
+0.539062 0.578125 0.523438 
+0.554688 0.570312 0.546875 
+0.554688 0.578125 0.539062 
+0.546875 0.585938 0.539062 
+0.554688 0.601562 0.546875 
+0.578125 0.617188 0.507812 
+0.585938 0.609375 0.507812 
+0.585938 0.601562 0.515625 
+0.609375 0.617188 0.507812 
+0.601562 0.617188 0.515625 
+0.601562 0.609375 0.523438 
+0.609375 0.617188 0.539062 
+0.570312 0.617188 0.515625 
+0.570312 0.609375 0.523438 
+0.578125 0.601562 0.523438 
+0.570312 0.617188 0.546875 
+0.578125 0.617188 0.539062 
+0.585938 0.609375 0.539062 
+0.601562 0.617188 0.546875 
+0.570312 0.578125 0.523438 
+0.570312 0.609375 0.554688 
+0.578125 0.585938 0.554688 
+0.570312 0.59375 0.546875 
+0.578125 0.59375 0.539062 
+0.585938 0.601562 0.554688 
+0.59375 0.601562 0.546875 
+0.59375 0.601562 0.578125 
+0.585938 0.617188 0.578125 
+0.601562 0.617188 0.578125 
+0.601562 0.65625 0.515625 
+0.617188 0.65625 0.515625 
+0.53125 0.640625 0.523438 
+0.554688 0.640625 0.523438 
+0.546875 0.640625 0.53125 
+0.554688 0.640625 0.546875 
+0.59375 0.640625 0.523438 
+0.617188 0.640625 0.523438 
+0.609375 0.640625 0.53125 
+0.617188 0.640625 0.546875 
+0.585938 0.640625 0.53125 
+0.585938 0.640625 0.554688 
+0.59375 0.640625 0.546875 
+0.609375 0.640625 0.554688 
+0.578125 0.65625 0.539062 
+0.578125 0.65625 0.554688 
+0.601562 0.640625 0.59375 
+0.617188 0.640625 0.59375 
+0.601562 0.65625 0.578125 
+0.617188 0.65625 0.578125 
+0.523438 0.546875 0.539062 
+0.539062 0.554688 0.546875 
+0.507812 0.617188 0.515625 
+0.507812 0.617188 0.546875 
+0.515625 0.617188 0.539062 
+0.523438 0.609375 0.539062 
+0.539062 0.617188 0.546875 
+0.523438 0.601562 0.546875 
+0.539062 0.609375 0.554688 
+0.523438 0.570312 0.546875 
+0.523438 0.578125 0.539062 
+0.546875 0.570312 0.554688 
+0.539062 0.578125 0.554688 
+0.539062 0.585938 0.546875 
+0.546875 0.601562 0.554688 
+0.507812 0.617188 0.578125 
+0.507812 0.609375 0.585938 
+0.515625 0.601562 0.585938 
+0.507812 0.617188 0.609375 
+0.515625 0.617188 0.601562 
+0.523438 0.609375 0.601562 
+0.539062 0.617188 0.609375 
+0.515625 0.617188 0.570312 
+0.523438 0.609375 0.570312 
+0.523438 0.601562 0.578125 
+0.546875 0.617188 0.570312 
+0.539062 0.617188 0.578125 
+0.539062 0.609375 0.585938 
+0.546875 0.617188 0.601562 
+0.523438 0.578125 0.570312 
+0.554688 0.609375 0.570312 
+0.554688 0.585938 0.578125 
+0.546875 0.59375 0.570312 
+0.539062 0.59375 0.578125 
+0.554688 0.601562 0.585938 
+0.546875 0.601562 0.59375 
+0.578125 0.601562 0.59375 
+0.578125 0.617188 0.585938 
+0.578125 0.617188 0.601562 
+0.515625 0.65625 0.601562 
+0.515625 0.65625 0.617188 
+0.523438 0.640625 0.53125 
+0.523438 0.640625 0.554688 
+0.53125 0.640625 0.546875 
+0.546875 0.640625 0.554688 
+0.523438 0.640625 0.59375 
+0.523438 0.640625 0.617188 
+0.53125 0.640625 0.609375 
+0.546875 0.640625 0.617188 
+0.53125 0.640625 0.585938 
+0.554688 0.640625 0.585938 
+0.546875 0.640625 0.59375 
+0.554688 0.640625 0.609375 
+0.539062 0.65625 0.578125 
+0.554688 0.65625 0.578125 
+0.59375 0.640625 0.601562 
+0.59375 0.640625 0.617188 
+0.578125 0.65625 0.601562 
+0.578125 0.65625 0.617188 
+0.539062 0.523438 0.546875 
+0.546875 0.539062 0.554688 
+0.515625 0.507812 0.617188 
+0.546875 0.507812 0.617188 
+0.539062 0.515625 0.617188 
+0.539062 0.523438 0.609375 
+0.546875 0.539062 0.617188 
+0.546875 0.523438 0.601562 
+0.554688 0.539062 0.609375 
+0.546875 0.523438 0.570312 
+0.539062 0.523438 0.578125 
+0.554688 0.546875 0.570312 
+0.554688 0.539062 0.578125 
+0.546875 0.539062 0.585938 
+0.554688 0.546875 0.601562 
+0.578125 0.507812 0.617188 
+0.585938 0.507812 0.609375 
+0.585938 0.515625 0.601562 
+0.609375 0.507812 0.617188 
+0.601562 0.515625 0.617188 
+0.601562 0.523438 0.609375 
+0.609375 0.539062 0.617188 
+0.570312 0.515625 0.617188 
+0.570312 0.523438 0.609375 
+0.578125 0.523438 0.601562 
+0.570312 0.546875 0.617188 
+0.578125 0.539062 0.617188 
+0.585938 0.539062 0.609375 
+0.601562 0.546875 0.617188 
+0.570312 0.523438 0.578125 
+0.570312 0.554688 0.609375 
+0.578125 0.554688 0.585938 
+0.570312 0.546875 0.59375 
+0.578125 0.539062 0.59375 
+0.585938 0.554688 0.601562 
+0.59375 0.546875 0.601562 
+0.59375 0.578125 0.601562 
+0.585938 0.578125 0.617188 
+0.601562 0.578125 0.617188 
+0.601562 0.515625 0.65625 
+0.617188 0.515625 0.65625 
+0.53125 0.523438 0.640625 
+0.554688 0.523438 0.640625 
+0.546875 0.53125 0.640625 
+0.554688 0.546875 0.640625 
+0.59375 0.523438 0.640625 
+0.617188 0.523438 0.640625 
+0.609375 0.53125 0.640625 
+0.617188 0.546875 0.640625 
+0.585938 0.53125 0.640625 
+0.585938 0.554688 0.640625 
+0.59375 0.546875 0.640625 
+0.609375 0.554688 0.640625 
+0.578125 0.539062 0.65625 
+0.578125 0.554688 0.65625 
+0.601562 0.59375 0.640625 
+0.617188 0.59375 0.640625 
+0.601562 0.578125 0.65625 
+0.617188 0.578125 0.65625 
+0.523438 0.539062 0.546875 
+0.539062 0.546875 0.554688 
+0.507812 0.515625 0.617188 
+0.507812 0.546875 0.617188 
+0.515625 0.539062 0.617188 
+0.523438 0.539062 0.609375 
+0.539062 0.546875 0.617188 
+0.523438 0.546875 0.601562 
+0.539062 0.554688 0.609375 
+0.523438 0.546875 0.570312 
+0.523438 0.539062 0.578125 
+0.546875 0.554688 0.570312 
+0.539062 0.554688 0.578125 
+0.539062 0.546875 0.585938 
+0.546875 0.554688 0.601562 
+0.507812 0.578125 0.617188 
+0.507812 0.585938 0.609375 
+0.515625 0.585938 0.601562 
+0.507812 0.609375 0.617188 
+0.515625 0.601562 0.617188 
+0.523438 0.601562 0.609375 
+0.539062 0.609375 0.617188 
+0.515625 0.570312 0.617188 
+0.523438 0.570312 0.609375 
+0.523438 0.578125 0.601562 
+0.546875 0.570312 0.617188 
+0.539062 0.578125 0.617188 
+0.539062 0.585938 0.609375 
+0.546875 0.601562 0.617188 
+0.523438 0.570312 0.578125 
+0.554688 0.570312 0.609375 
+0.554688 0.578125 0.585938 
+0.546875 0.570312 0.59375 
+0.539062 0.578125 0.59375 
+0.554688 0.585938 0.601562 
+0.546875 0.59375 0.601562 
+0.578125 0.59375 0.601562 
+0.578125 0.585938 0.617188 
+0.578125 0.601562 0.617188 
+0.515625 0.601562 0.65625 
+0.515625 0.617188 0.65625 
+0.523438 0.53125 0.640625 
+0.523438 0.554688 0.640625 
+0.53125 0.546875 0.640625 
+0.546875 0.554688 0.640625 
+0.523438 0.59375 0.640625 
+0.523438 0.617188 0.640625 
+0.53125 0.609375 0.640625 
+0.546875 0.617188 0.640625 
+0.53125 0.585938 0.640625 
+0.554688 0.585938 0.640625 
+0.546875 0.59375 0.640625 
+0.554688 0.609375 0.640625 
+0.539062 0.578125 0.65625 
+0.554688 0.578125 0.65625 
+0.59375 0.601562 0.640625 
+0.59375 0.617188 0.640625 
+0.578125 0.601562 0.65625 
+0.578125 0.617188 0.65625 
+0.445312 0.359375 0.34375 
+0.460938 0.359375 0.34375 
+0.445312 0.34375 0.359375 
+0.460938 0.34375 0.359375 
+0.359375 0.445312 0.34375 
+0.359375 0.460938 0.34375 
+0.34375 0.445312 0.359375 
+0.34375 0.460938 0.359375 
+0.359375 0.34375 0.445312 
+0.359375 0.34375 0.460938 
+0.34375 0.359375 0.445312 
+0.34375 0.359375 0.460938 
+0.507812 0.484375 0.34375 
+0.523438 0.484375 0.34375 
+0.640625 0.460938 0.421875 
+0.640625 0.476562 0.421875 
+0.640625 0.46875 0.460938 
+0.640625 0.492188 0.460938 
+0.640625 0.484375 0.46875 
+0.640625 0.492188 0.484375 
+0.65625 0.476562 0.453125 
+0.65625 0.492188 0.453125 
+0.507812 0.34375 0.484375 
+0.523438 0.34375 0.484375 
+0.640625 0.421875 0.460938 
+0.640625 0.421875 0.476562 
+0.640625 0.460938 0.46875 
+0.640625 0.460938 0.492188 
+0.640625 0.46875 0.484375 
+0.640625 0.484375 0.492188 
+0.65625 0.453125 0.476562 
+0.65625 0.453125 0.492188 
+0.484375 0.507812 0.34375 
+0.484375 0.523438 0.34375 
+0.460938 0.640625 0.421875 
+0.476562 0.640625 0.421875 
+0.46875 0.640625 0.460938 
+0.492188 0.640625 0.460938 
+0.484375 0.640625 0.46875 
+0.492188 0.640625 0.484375 
+0.476562 0.65625 0.453125 
+0.492188 0.65625 0.453125 
+0.34375 0.507812 0.484375 
+0.34375 0.523438 0.484375 
+0.421875 0.640625 0.460938 
+0.421875 0.640625 0.476562 
+0.460938 0.640625 0.46875 
+0.460938 0.640625 0.492188 
+0.46875 0.640625 0.484375 
+0.484375 0.640625 0.492188 
+0.453125 0.65625 0.476562 
+0.453125 0.65625 0.492188 
+0.515625 0.507812 0.359375 
+0.539062 0.507812 0.359375 
+0.53125 0.515625 0.359375 
+0.539062 0.53125 0.359375 
+0.546875 0.507812 0.34375 
+0.546875 0.523438 0.34375 
+0.578125 0.523438 0.359375 
+0.578125 0.539062 0.359375 
+0.65625 0.515625 0.476562 
+0.65625 0.515625 0.492188 
+0.507812 0.515625 0.359375 
+0.507812 0.539062 0.359375 
+0.515625 0.53125 0.359375 
+0.53125 0.539062 0.359375 
+0.507812 0.546875 0.34375 
+0.523438 0.546875 0.34375 
+0.523438 0.578125 0.359375 
+0.539062 0.578125 0.359375 
+0.515625 0.65625 0.476562 
+0.515625 0.65625 0.492188 
+0.484375 0.34375 0.507812 
+0.484375 0.34375 0.523438 
+0.460938 0.421875 0.640625 
+0.476562 0.421875 0.640625 
+0.46875 0.460938 0.640625 
+0.492188 0.460938 0.640625 
+0.484375 0.46875 0.640625 
+0.492188 0.484375 0.640625 
+0.476562 0.453125 0.65625 
+0.492188 0.453125 0.65625 
+0.34375 0.484375 0.507812 
+0.34375 0.484375 0.523438 
+0.421875 0.460938 0.640625 
+0.421875 0.476562 0.640625 
+0.460938 0.46875 0.640625 
+0.460938 0.492188 0.640625 
+0.46875 0.484375 0.640625 
+0.484375 0.492188 0.640625 
+0.453125 0.476562 0.65625 
+0.453125 0.492188 0.65625 
+0.515625 0.359375 0.507812 
+0.539062 0.359375 0.507812 
+0.53125 0.359375 0.515625 
+0.539062 0.359375 0.53125 
+0.546875 0.34375 0.507812 
+0.546875 0.34375 0.523438 
+0.578125 0.359375 0.523438 
+0.578125 0.359375 0.539062 
+0.65625 0.476562 0.515625 
+0.65625 0.492188 0.515625 
+0.507812 0.359375 0.515625 
+0.507812 0.359375 0.539062 
+0.515625 0.359375 0.53125 
+0.53125 0.359375 0.539062 
+0.507812 0.34375 0.546875 
+0.523438 0.34375 0.546875 
+0.523438 0.359375 0.578125 
+0.539062 0.359375 0.578125 
+0.515625 0.476562 0.65625 
+0.515625 0.492188 0.65625 
+0.359375 0.515625 0.507812 
+0.359375 0.539062 0.507812 
+0.359375 0.53125 0.515625 
+0.359375 0.539062 0.53125 
+0.34375 0.546875 0.507812 
+0.34375 0.546875 0.523438 
+0.359375 0.578125 0.523438 
+0.359375 0.578125 0.539062 
+0.476562 0.65625 0.515625 
+0.492188 0.65625 0.515625 
+0.359375 0.507812 0.515625 
+0.359375 0.507812 0.539062 
+0.359375 0.515625 0.53125 
+0.359375 0.53125 0.539062 
+0.34375 0.507812 0.546875 
+0.34375 0.523438 0.546875 
+0.359375 0.523438 0.578125 
+0.359375 0.539062 0.578125 
+0.476562 0.515625 0.65625 
+0.492188 0.515625 0.65625 
+0.65625 0.640625 0.539062 
+0.65625 0.640625 0.554688 
+0.65625 0.539062 0.640625 
+0.65625 0.554688 0.640625 
+0.640625 0.65625 0.539062 
+0.640625 0.65625 0.554688 
+0.539062 0.65625 0.640625 
+0.554688 0.65625 0.640625 
+0.640625 0.539062 0.65625 
+0.640625 0.554688 0.65625 
+0.539062 0.640625 0.65625 
+0.554688 0.640625 0.65625 
+0.503906 0.460938 0.390625 
+0.511719 0.460938 0.390625 
+0.503906 0.492188 0.390625 
+0.511719 0.492188 0.390625 
+0.503906 0.476562 0.398438 
+0.503906 0.488281 0.398438 
+0.507812 0.484375 0.398438 
+0.515625 0.488281 0.398438 
+0.507812 0.472656 0.398438 
+0.519531 0.472656 0.398438 
+0.515625 0.476562 0.398438 
+0.519531 0.484375 0.398438 
+0.503906 0.480469 0.414062 
+0.503906 0.496094 0.414062 
+0.503906 0.492188 0.417969 
+0.507812 0.488281 0.417969 
+0.503906 0.496094 0.429688 
+0.507812 0.496094 0.425781 
+0.511719 0.492188 0.425781 
+0.519531 0.496094 0.429688 
+0.507812 0.480469 0.410156 
+0.507812 0.496094 0.410156 
+0.511719 0.492188 0.410156 
+0.511719 0.488281 0.414062 
+0.523438 0.496094 0.410156 
+0.519531 0.496094 0.414062 
+0.519531 0.492188 0.417969 
+0.523438 0.496094 0.425781 
+0.511719 0.476562 0.410156 
+0.527344 0.476562 0.410156 
+0.523438 0.480469 0.410156 
+0.519531 0.480469 0.414062 
+0.527344 0.492188 0.410156 
+0.527344 0.488281 0.414062 
+0.523438 0.488281 0.417969 
+0.527344 0.492188 0.425781 
+0.535156 0.480469 0.414062 
+0.535156 0.496094 0.414062 
+0.535156 0.492188 0.417969 
+0.539062 0.488281 0.417969 
+0.535156 0.496094 0.429688 
+0.539062 0.496094 0.425781 
+0.542969 0.492188 0.425781 
+0.550781 0.496094 0.429688 
+0.503906 0.445312 0.398438 
+0.503906 0.457031 0.398438 
+0.507812 0.453125 0.398438 
+0.515625 0.457031 0.398438 
+0.503906 0.445312 0.417969 
+0.503906 0.445312 0.433594 
+0.503906 0.449219 0.429688 
+0.507812 0.449219 0.425781 
+0.503906 0.460938 0.433594 
+0.507812 0.457031 0.433594 
+0.511719 0.457031 0.429688 
+0.519531 0.460938 0.433594 
+0.503906 0.449219 0.414062 
+0.503906 0.464844 0.414062 
+0.503906 0.460938 0.417969 
+0.507812 0.457031 0.417969 
+0.503906 0.464844 0.429688 
+0.507812 0.464844 0.425781 
+0.511719 0.460938 0.425781 
+0.519531 0.464844 0.429688 
+0.507812 0.449219 0.410156 
+0.507812 0.464844 0.410156 
+0.511719 0.460938 0.410156 
+0.511719 0.457031 0.414062 
+0.523438 0.464844 0.410156 
+0.519531 0.464844 0.414062 
+0.519531 0.460938 0.417969 
+0.523438 0.464844 0.425781 
+0.503906 0.476562 0.417969 
+0.503906 0.476562 0.433594 
+0.503906 0.480469 0.429688 
+0.507812 0.480469 0.425781 
+0.503906 0.492188 0.433594 
+0.507812 0.488281 0.433594 
+0.511719 0.488281 0.429688 
+0.519531 0.492188 0.433594 
+0.507812 0.472656 0.417969 
+0.507812 0.472656 0.433594 
+0.511719 0.472656 0.429688 
+0.511719 0.476562 0.425781 
+0.523438 0.472656 0.433594 
+0.519531 0.476562 0.433594 
+0.519531 0.480469 0.429688 
+0.523438 0.488281 0.433594 
+0.511719 0.472656 0.414062 
+0.527344 0.472656 0.414062 
+0.523438 0.472656 0.417969 
+0.519531 0.476562 0.417969 
+0.527344 0.472656 0.429688 
+0.527344 0.476562 0.425781 
+0.523438 0.480469 0.425781 
+0.527344 0.488281 0.429688 
+0.535156 0.476562 0.417969 
+0.535156 0.476562 0.433594 
+0.535156 0.480469 0.429688 
+0.539062 0.480469 0.425781 
+0.535156 0.492188 0.433594 
+0.539062 0.488281 0.433594 
+0.542969 0.488281 0.429688 
+0.550781 0.492188 0.433594 
+0.507812 0.441406 0.398438 
+0.519531 0.441406 0.398438 
+0.515625 0.445312 0.398438 
+0.519531 0.453125 0.398438 
+0.507812 0.441406 0.417969 
+0.507812 0.441406 0.433594 
+0.511719 0.441406 0.429688 
+0.511719 0.445312 0.425781 
+0.523438 0.441406 0.433594 
+0.519531 0.445312 0.433594 
+0.519531 0.449219 0.429688 
+0.523438 0.457031 0.433594 
+0.511719 0.441406 0.414062 
+0.527344 0.441406 0.414062 
+0.523438 0.441406 0.417969 
+0.519531 0.445312 0.417969 
+0.527344 0.441406 0.429688 
+0.527344 0.445312 0.425781 
+0.523438 0.449219 0.425781 
+0.527344 0.457031 0.429688 
+0.511719 0.445312 0.410156 
+0.527344 0.445312 0.410156 
+0.523438 0.449219 0.410156 
+0.519531 0.449219 0.414062 
+0.527344 0.460938 0.410156 
+0.527344 0.457031 0.414062 
+0.523438 0.457031 0.417969 
+0.527344 0.460938 0.425781 
+0.539062 0.441406 0.433594 
+0.554688 0.457031 0.433594 
+0.542969 0.441406 0.421875 
+0.550781 0.445312 0.429688 
+0.550781 0.441406 0.433594 
+0.546875 0.445312 0.433594 
+0.546875 0.449219 0.429688 
+0.535156 0.445312 0.417969 
+0.535156 0.445312 0.433594 
+0.535156 0.449219 0.429688 
+0.539062 0.449219 0.425781 
+0.535156 0.460938 0.433594 
+0.539062 0.457031 0.433594 
+0.542969 0.457031 0.429688 
+0.550781 0.460938 0.433594 
+0.535156 0.449219 0.414062 
+0.535156 0.464844 0.414062 
+0.535156 0.460938 0.417969 
+0.539062 0.457031 0.417969 
+0.535156 0.464844 0.429688 
+0.539062 0.464844 0.425781 
+0.542969 0.460938 0.425781 
+0.550781 0.464844 0.429688 
+0.539062 0.472656 0.417969 
+0.539062 0.472656 0.433594 
+0.542969 0.472656 0.429688 
+0.542969 0.476562 0.425781 
+0.554688 0.472656 0.433594 
+0.550781 0.476562 0.433594 
+0.550781 0.480469 0.429688 
+0.554688 0.488281 0.433594 
+0.503906 0.449219 0.445312 
+0.503906 0.464844 0.445312 
+0.503906 0.460938 0.449219 
+0.507812 0.457031 0.449219 
+0.503906 0.464844 0.460938 
+0.507812 0.464844 0.457031 
+0.511719 0.460938 0.457031 
+0.519531 0.464844 0.460938 
+0.503906 0.480469 0.445312 
+0.503906 0.496094 0.445312 
+0.503906 0.492188 0.449219 
+0.507812 0.488281 0.449219 
+0.503906 0.496094 0.460938 
+0.507812 0.496094 0.457031 
+0.511719 0.492188 0.457031 
+0.519531 0.496094 0.460938 
+0.503906 0.476562 0.449219 
+0.503906 0.476562 0.464844 
+0.503906 0.480469 0.460938 
+0.507812 0.480469 0.457031 
+0.503906 0.492188 0.464844 
+0.507812 0.488281 0.464844 
+0.511719 0.488281 0.460938 
+0.519531 0.492188 0.464844 
+0.507812 0.472656 0.449219 
+0.507812 0.472656 0.464844 
+0.511719 0.472656 0.460938 
+0.511719 0.476562 0.457031 
+0.523438 0.472656 0.464844 
+0.519531 0.476562 0.464844 
+0.519531 0.480469 0.460938 
+0.523438 0.488281 0.464844 
+0.503906 0.480469 0.476562 
+0.503906 0.496094 0.476562 
+0.503906 0.492188 0.480469 
+0.507812 0.488281 0.480469 
+0.503906 0.496094 0.492188 
+0.507812 0.496094 0.488281 
+0.511719 0.492188 0.488281 
+0.519531 0.496094 0.492188 
+0.507812 0.480469 0.472656 
+0.507812 0.496094 0.472656 
+0.511719 0.492188 0.472656 
+0.511719 0.488281 0.476562 
+0.523438 0.496094 0.472656 
+0.519531 0.496094 0.476562 
+0.519531 0.492188 0.480469 
+0.523438 0.496094 0.488281 
+0.511719 0.476562 0.472656 
+0.527344 0.476562 0.472656 
+0.523438 0.480469 0.472656 
+0.519531 0.480469 0.476562 
+0.527344 0.492188 0.472656 
+0.527344 0.488281 0.476562 
+0.523438 0.488281 0.480469 
+0.527344 0.492188 0.488281 
+0.535156 0.480469 0.476562 
+0.535156 0.496094 0.476562 
+0.535156 0.492188 0.480469 
+0.539062 0.488281 0.480469 
+0.535156 0.496094 0.492188 
+0.539062 0.496094 0.488281 
+0.542969 0.492188 0.488281 
+0.550781 0.496094 0.492188 
+0.507812 0.449219 0.441406 
+0.507812 0.464844 0.441406 
+0.511719 0.460938 0.441406 
+0.511719 0.457031 0.445312 
+0.523438 0.464844 0.441406 
+0.519531 0.464844 0.445312 
+0.519531 0.460938 0.449219 
+0.523438 0.464844 0.457031 
+0.507812 0.480469 0.441406 
+0.507812 0.496094 0.441406 
+0.511719 0.492188 0.441406 
+0.511719 0.488281 0.445312 
+0.523438 0.496094 0.441406 
+0.519531 0.496094 0.445312 
+0.519531 0.492188 0.449219 
+0.523438 0.496094 0.457031 
+0.511719 0.476562 0.441406 
+0.527344 0.476562 0.441406 
+0.523438 0.480469 0.441406 
+0.519531 0.480469 0.445312 
+0.527344 0.492188 0.441406 
+0.527344 0.488281 0.445312 
+0.523438 0.488281 0.449219 
+0.527344 0.492188 0.457031 
+0.511719 0.472656 0.445312 
+0.527344 0.472656 0.445312 
+0.523438 0.472656 0.449219 
+0.519531 0.476562 0.449219 
+0.527344 0.472656 0.460938 
+0.527344 0.476562 0.457031 
+0.523438 0.480469 0.457031 
+0.527344 0.488281 0.460938 
+0.539062 0.480469 0.441406 
+0.539062 0.496094 0.441406 
+0.542969 0.492188 0.441406 
+0.542969 0.488281 0.445312 
+0.554688 0.496094 0.441406 
+0.550781 0.496094 0.445312 
+0.550781 0.492188 0.449219 
+0.554688 0.496094 0.457031 
+0.535156 0.480469 0.445312 
+0.535156 0.496094 0.445312 
+0.535156 0.492188 0.449219 
+0.539062 0.488281 0.449219 
+0.535156 0.496094 0.460938 
+0.539062 0.496094 0.457031 
+0.542969 0.492188 0.457031 
+0.550781 0.496094 0.460938 
+0.535156 0.476562 0.449219 
+0.535156 0.476562 0.464844 
+0.535156 0.480469 0.460938 
+0.539062 0.480469 0.457031 
+0.535156 0.492188 0.464844 
+0.539062 0.488281 0.464844 
+0.542969 0.488281 0.460938 
+0.550781 0.492188 0.464844 
+0.539062 0.480469 0.472656 
+0.539062 0.496094 0.472656 
+0.542969 0.492188 0.472656 
+0.542969 0.488281 0.476562 
+0.554688 0.496094 0.472656 
+0.550781 0.496094 0.476562 
+0.550781 0.492188 0.480469 
+0.554688 0.496094 0.488281 
+0.511719 0.445312 0.441406 
+0.527344 0.445312 0.441406 
+0.523438 0.449219 0.441406 
+0.519531 0.449219 0.445312 
+0.527344 0.460938 0.441406 
+0.527344 0.457031 0.445312 
+0.523438 0.457031 0.449219 
+0.527344 0.460938 0.457031 
+0.542969 0.445312 0.441406 
+0.558594 0.445312 0.441406 
+0.554688 0.449219 0.441406 
+0.550781 0.449219 0.445312 
+0.558594 0.460938 0.441406 
+0.558594 0.457031 0.445312 
+0.554688 0.457031 0.449219 
+0.558594 0.460938 0.457031 
+0.539062 0.449219 0.441406 
+0.539062 0.464844 0.441406 
+0.542969 0.460938 0.441406 
+0.542969 0.457031 0.445312 
+0.554688 0.464844 0.441406 
+0.550781 0.464844 0.445312 
+0.550781 0.460938 0.449219 
+0.554688 0.464844 0.457031 
+0.535156 0.449219 0.445312 
+0.535156 0.464844 0.445312 
+0.535156 0.460938 0.449219 
+0.539062 0.457031 0.449219 
+0.535156 0.464844 0.460938 
+0.539062 0.464844 0.457031 
+0.542969 0.460938 0.457031 
+0.550781 0.464844 0.460938 
+0.542969 0.476562 0.441406 
+0.558594 0.476562 0.441406 
+0.554688 0.480469 0.441406 
+0.550781 0.480469 0.445312 
+0.558594 0.492188 0.441406 
+0.558594 0.488281 0.445312 
+0.554688 0.488281 0.449219 
+0.558594 0.492188 0.457031 
+0.542969 0.472656 0.445312 
+0.558594 0.472656 0.445312 
+0.554688 0.472656 0.449219 
+0.550781 0.476562 0.449219 
+0.558594 0.472656 0.460938 
+0.558594 0.476562 0.457031 
+0.554688 0.480469 0.457031 
+0.558594 0.488281 0.460938 
+0.539062 0.472656 0.449219 
+0.539062 0.472656 0.464844 
+0.542969 0.472656 0.460938 
+0.542969 0.476562 0.457031 
+0.554688 0.472656 0.464844 
+0.550781 0.476562 0.464844 
+0.550781 0.480469 0.460938 
+0.554688 0.488281 0.464844 
+0.542969 0.476562 0.472656 
+0.558594 0.476562 0.472656 
+0.554688 0.480469 0.472656 
+0.550781 0.480469 0.476562 
+0.558594 0.492188 0.472656 
+0.558594 0.488281 0.476562 
+0.554688 0.488281 0.480469 
+0.558594 0.492188 0.488281 
+0.566406 0.449219 0.445312 
+0.566406 0.464844 0.445312 
+0.566406 0.460938 0.449219 
+0.570312 0.457031 0.449219 
+0.566406 0.464844 0.460938 
+0.570312 0.464844 0.457031 
+0.574219 0.460938 0.457031 
+0.582031 0.464844 0.460938 
+0.566406 0.480469 0.445312 
+0.566406 0.496094 0.445312 
+0.566406 0.492188 0.449219 
+0.570312 0.488281 0.449219 
+0.566406 0.496094 0.460938 
+0.570312 0.496094 0.457031 
+0.574219 0.492188 0.457031 
+0.582031 0.496094 0.460938 
+0.566406 0.476562 0.449219 
+0.566406 0.476562 0.464844 
+0.566406 0.480469 0.460938 
+0.570312 0.480469 0.457031 
+0.566406 0.492188 0.464844 
+0.570312 0.488281 0.464844 
+0.574219 0.488281 0.460938 
+0.582031 0.492188 0.464844 
+0.570312 0.472656 0.449219 
+0.570312 0.472656 0.464844 
+0.574219 0.472656 0.460938 
+0.574219 0.476562 0.457031 
+0.585938 0.472656 0.464844 
+0.582031 0.476562 0.464844 
+0.582031 0.480469 0.460938 
+0.585938 0.488281 0.464844 
+0.566406 0.480469 0.476562 
+0.566406 0.496094 0.476562 
+0.566406 0.492188 0.480469 
+0.570312 0.488281 0.480469 
+0.566406 0.496094 0.492188 
+0.570312 0.496094 0.488281 
+0.574219 0.492188 0.488281 
+0.582031 0.496094 0.492188 
+0.570312 0.480469 0.472656 
+0.570312 0.496094 0.472656 
+0.574219 0.492188 0.472656 
+0.574219 0.488281 0.476562 
+0.585938 0.496094 0.472656 
+0.582031 0.496094 0.476562 
+0.582031 0.492188 0.480469 
+0.585938 0.496094 0.488281 
+0.574219 0.476562 0.472656 
+0.589844 0.476562 0.472656 
+0.585938 0.480469 0.472656 
+0.582031 0.480469 0.476562 
+0.589844 0.492188 0.472656 
+0.589844 0.488281 0.476562 
+0.585938 0.488281 0.480469 
+0.589844 0.492188 0.488281 
+0.601562 0.484375 0.480469 
+0.601562 0.496094 0.480469 
+0.601562 0.492188 0.484375 
+0.601562 0.496094 0.492188 
+0.503906 0.390625 0.460938 
+0.511719 0.390625 0.460938 
+0.503906 0.390625 0.492188 
+0.511719 0.390625 0.492188 
+0.503906 0.398438 0.476562 
+0.503906 0.398438 0.488281 
+0.507812 0.398438 0.484375 
+0.515625 0.398438 0.488281 
+0.507812 0.398438 0.472656 
+0.519531 0.398438 0.472656 
+0.515625 0.398438 0.476562 
+0.519531 0.398438 0.484375 
+0.503906 0.414062 0.480469 
+0.503906 0.414062 0.496094 
+0.503906 0.417969 0.492188 
+0.507812 0.417969 0.488281 
+0.503906 0.429688 0.496094 
+0.507812 0.425781 0.496094 
+0.511719 0.425781 0.492188 
+0.519531 0.429688 0.496094 
+0.507812 0.410156 0.480469 
+0.507812 0.410156 0.496094 
+0.511719 0.410156 0.492188 
+0.511719 0.414062 0.488281 
+0.523438 0.410156 0.496094 
+0.519531 0.414062 0.496094 
+0.519531 0.417969 0.492188 
+0.523438 0.425781 0.496094 
+0.511719 0.410156 0.476562 
+0.527344 0.410156 0.476562 
+0.523438 0.410156 0.480469 
+0.519531 0.414062 0.480469 
+0.527344 0.410156 0.492188 
+0.527344 0.414062 0.488281 
+0.523438 0.417969 0.488281 
+0.527344 0.425781 0.492188 
+0.535156 0.414062 0.480469 
+0.535156 0.414062 0.496094 
+0.535156 0.417969 0.492188 
+0.539062 0.417969 0.488281 
+0.535156 0.429688 0.496094 
+0.539062 0.425781 0.496094 
+0.542969 0.425781 0.492188 
+0.550781 0.429688 0.496094 
+0.503906 0.398438 0.445312 
+0.503906 0.398438 0.457031 
+0.507812 0.398438 0.453125 
+0.515625 0.398438 0.457031 
+0.503906 0.417969 0.445312 
+0.503906 0.433594 0.445312 
+0.503906 0.429688 0.449219 
+0.507812 0.425781 0.449219 
+0.503906 0.433594 0.460938 
+0.507812 0.433594 0.457031 
+0.511719 0.429688 0.457031 
+0.519531 0.433594 0.460938 
+0.503906 0.414062 0.449219 
+0.503906 0.414062 0.464844 
+0.503906 0.417969 0.460938 
+0.507812 0.417969 0.457031 
+0.503906 0.429688 0.464844 
+0.507812 0.425781 0.464844 
+0.511719 0.425781 0.460938 
+0.519531 0.429688 0.464844 
+0.507812 0.410156 0.449219 
+0.507812 0.410156 0.464844 
+0.511719 0.410156 0.460938 
+0.511719 0.414062 0.457031 
+0.523438 0.410156 0.464844 
+0.519531 0.414062 0.464844 
+0.519531 0.417969 0.460938 
+0.523438 0.425781 0.464844 
+0.503906 0.417969 0.476562 
+0.503906 0.433594 0.476562 
+0.503906 0.429688 0.480469 
+0.507812 0.425781 0.480469 
+0.503906 0.433594 0.492188 
+0.507812 0.433594 0.488281 
+0.511719 0.429688 0.488281 
+0.519531 0.433594 0.492188 
+0.507812 0.417969 0.472656 
+0.507812 0.433594 0.472656 
+0.511719 0.429688 0.472656 
+0.511719 0.425781 0.476562 
+0.523438 0.433594 0.472656 
+0.519531 0.433594 0.476562 
+0.519531 0.429688 0.480469 
+0.523438 0.433594 0.488281 
+0.511719 0.414062 0.472656 
+0.527344 0.414062 0.472656 
+0.523438 0.417969 0.472656 
+0.519531 0.417969 0.476562 
+0.527344 0.429688 0.472656 
+0.527344 0.425781 0.476562 
+0.523438 0.425781 0.480469 
+0.527344 0.429688 0.488281 
+0.535156 0.417969 0.476562 
+0.535156 0.433594 0.476562 
+0.535156 0.429688 0.480469 
+0.539062 0.425781 0.480469 
+0.535156 0.433594 0.492188 
+0.539062 0.433594 0.488281 
+0.542969 0.429688 0.488281 
+0.550781 0.433594 0.492188 
+0.507812 0.398438 0.441406 
+0.519531 0.398438 0.441406 
+0.515625 0.398438 0.445312 
+0.519531 0.398438 0.453125 
+0.507812 0.417969 0.441406 
+0.507812 0.433594 0.441406 
+0.511719 0.429688 0.441406 
+0.511719 0.425781 0.445312 
+0.523438 0.433594 0.441406 
+0.519531 0.433594 0.445312 
+0.519531 0.429688 0.449219 
+0.523438 0.433594 0.457031 
+0.511719 0.414062 0.441406 
+0.527344 0.414062 0.441406 
+0.523438 0.417969 0.441406 
+0.519531 0.417969 0.445312 
+0.527344 0.429688 0.441406 
+0.527344 0.425781 0.445312 
+0.523438 0.425781 0.449219 
+0.527344 0.429688 0.457031 
+0.511719 0.410156 0.445312 
+0.527344 0.410156 0.445312 
+0.523438 0.410156 0.449219 
+0.519531 0.414062 0.449219 
+0.527344 0.410156 0.460938 
+0.527344 0.414062 0.457031 
+0.523438 0.417969 0.457031 
+0.527344 0.425781 0.460938 
+0.539062 0.433594 0.441406 
+0.554688 0.433594 0.457031 
+0.542969 0.421875 0.441406 
+0.550781 0.429688 0.445312 
+0.550781 0.433594 0.441406 
+0.546875 0.433594 0.445312 
+0.546875 0.429688 0.449219 
+0.535156 0.417969 0.445312 
+0.535156 0.433594 0.445312 
+0.535156 0.429688 0.449219 
+0.539062 0.425781 0.449219 
+0.535156 0.433594 0.460938 
+0.539062 0.433594 0.457031 
+0.542969 0.429688 0.457031 
+0.550781 0.433594 0.460938 
+0.535156 0.414062 0.449219 
+0.535156 0.414062 0.464844 
+0.535156 0.417969 0.460938 
+0.539062 0.417969 0.457031 
+0.535156 0.429688 0.464844 
+0.539062 0.425781 0.464844 
+0.542969 0.425781 0.460938 
+0.550781 0.429688 0.464844 
+0.539062 0.417969 0.472656 
+0.539062 0.433594 0.472656 
+0.542969 0.429688 0.472656 
+0.542969 0.425781 0.476562 
+0.554688 0.433594 0.472656 
+0.550781 0.433594 0.476562 
+0.550781 0.429688 0.480469 
+0.554688 0.433594 0.488281 
+0.503906 0.445312 0.449219 
+0.503906 0.445312 0.464844 
+0.503906 0.449219 0.460938 
+0.507812 0.449219 0.457031 
+0.503906 0.460938 0.464844 
+0.507812 0.457031 0.464844 
+0.511719 0.457031 0.460938 
+0.519531 0.460938 0.464844 
+0.503906 0.445312 0.480469 
+0.503906 0.445312 0.496094 
+0.503906 0.449219 0.492188 
+0.507812 0.449219 0.488281 
+0.503906 0.460938 0.496094 
+0.507812 0.457031 0.496094 
+0.511719 0.457031 0.492188 
+0.519531 0.460938 0.496094 
+0.503906 0.449219 0.476562 
+0.503906 0.464844 0.476562 
+0.503906 0.460938 0.480469 
+0.507812 0.457031 0.480469 
+0.503906 0.464844 0.492188 
+0.507812 0.464844 0.488281 
+0.511719 0.460938 0.488281 
+0.519531 0.464844 0.492188 
+0.507812 0.449219 0.472656 
+0.507812 0.464844 0.472656 
+0.511719 0.460938 0.472656 
+0.511719 0.457031 0.476562 
+0.523438 0.464844 0.472656 
+0.519531 0.464844 0.476562 
+0.519531 0.460938 0.480469 
+0.523438 0.464844 0.488281 
+0.503906 0.476562 0.480469 
+0.503906 0.476562 0.496094 
+0.503906 0.480469 0.492188 
+0.507812 0.480469 0.488281 
+0.503906 0.492188 0.496094 
+0.507812 0.488281 0.496094 
+0.511719 0.488281 0.492188 
+0.519531 0.492188 0.496094 
+0.507812 0.472656 0.480469 
+0.507812 0.472656 0.496094 
+0.511719 0.472656 0.492188 
+0.511719 0.476562 0.488281 
+0.523438 0.472656 0.496094 
+0.519531 0.476562 0.496094 
+0.519531 0.480469 0.492188 
+0.523438 0.488281 0.496094 
+0.511719 0.472656 0.476562 
+0.527344 0.472656 0.476562 
+0.523438 0.472656 0.480469 
+0.519531 0.476562 0.480469 
+0.527344 0.472656 0.492188 
+0.527344 0.476562 0.488281 
+0.523438 0.480469 0.488281 
+0.527344 0.488281 0.492188 
+0.535156 0.476562 0.480469 
+0.535156 0.476562 0.496094 
+0.535156 0.480469 0.492188 
+0.539062 0.480469 0.488281 
+0.535156 0.492188 0.496094 
+0.539062 0.488281 0.496094 
+0.542969 0.488281 0.492188 
+0.550781 0.492188 0.496094 
+0.507812 0.441406 0.449219 
+0.507812 0.441406 0.464844 
+0.511719 0.441406 0.460938 
+0.511719 0.445312 0.457031 
+0.523438 0.441406 0.464844 
+0.519531 0.445312 0.464844 
+0.519531 0.449219 0.460938 
+0.523438 0.457031 0.464844 
+0.507812 0.441406 0.480469 
+0.507812 0.441406 0.496094 
+0.511719 0.441406 0.492188 
+0.511719 0.445312 0.488281 
+0.523438 0.441406 0.496094 
+0.519531 0.445312 0.496094 
+0.519531 0.449219 0.492188 
+0.523438 0.457031 0.496094 
+0.511719 0.441406 0.476562 
+0.527344 0.441406 0.476562 
+0.523438 0.441406 0.480469 
+0.519531 0.445312 0.480469 
+0.527344 0.441406 0.492188 
+0.527344 0.445312 0.488281 
+0.523438 0.449219 0.488281 
+0.527344 0.457031 0.492188 
+0.511719 0.445312 0.472656 
+0.527344 0.445312 0.472656 
+0.523438 0.449219 0.472656 
+0.519531 0.449219 0.476562 
+0.527344 0.460938 0.472656 
+0.527344 0.457031 0.476562 
+0.523438 0.457031 0.480469 
+0.527344 0.460938 0.488281 
+0.539062 0.441406 0.480469 
+0.539062 0.441406 0.496094 
+0.542969 0.441406 0.492188 
+0.542969 0.445312 0.488281 
+0.554688 0.441406 0.496094 
+0.550781 0.445312 0.496094 
+0.550781 0.449219 0.492188 
+0.554688 0.457031 0.496094 
+0.535156 0.445312 0.480469 
+0.535156 0.445312 0.496094 
+0.535156 0.449219 0.492188 
+0.539062 0.449219 0.488281 
+0.535156 0.460938 0.496094 
+0.539062 0.457031 0.496094 
+0.542969 0.457031 0.492188 
+0.550781 0.460938 0.496094 
+0.535156 0.449219 0.476562 
+0.535156 0.464844 0.476562 
+0.535156 0.460938 0.480469 
+0.539062 0.457031 0.480469 
+0.535156 0.464844 0.492188 
+0.539062 0.464844 0.488281 
+0.542969 0.460938 0.488281 
+0.550781 0.464844 0.492188 
+0.539062 0.472656 0.480469 
+0.539062 0.472656 0.496094 
+0.542969 0.472656 0.492188 
+0.542969 0.476562 0.488281 
+0.554688 0.472656 0.496094 
+0.550781 0.476562 0.496094 
+0.550781 0.480469 0.492188 
+0.554688 0.488281 0.496094 
+0.511719 0.441406 0.445312 
+0.527344 0.441406 0.445312 
+0.523438 0.441406 0.449219 
+0.519531 0.445312 0.449219 
+0.527344 0.441406 0.460938 
+0.527344 0.445312 0.457031 
+0.523438 0.449219 0.457031 
+0.527344 0.457031 0.460938 
+0.542969 0.441406 0.445312 
+0.558594 0.441406 0.445312 
+0.554688 0.441406 0.449219 
+0.550781 0.445312 0.449219 
+0.558594 0.441406 0.460938 
+0.558594 0.445312 0.457031 
+0.554688 0.449219 0.457031 
+0.558594 0.457031 0.460938 
+0.539062 0.441406 0.449219 
+0.539062 0.441406 0.464844 
+0.542969 0.441406 0.460938 
+0.542969 0.445312 0.457031 
+0.554688 0.441406 0.464844 
+0.550781 0.445312 0.464844 
+0.550781 0.449219 0.460938 
+0.554688 0.457031 0.464844 
+0.535156 0.445312 0.449219 
+0.535156 0.445312 0.464844 
+0.535156 0.449219 0.460938 
+0.539062 0.449219 0.457031 
+0.535156 0.460938 0.464844 
+0.539062 0.457031 0.464844 
+0.542969 0.457031 0.460938 
+0.550781 0.460938 0.464844 
+0.542969 0.441406 0.476562 
+0.558594 0.441406 0.476562 
+0.554688 0.441406 0.480469 
+0.550781 0.445312 0.480469 
+0.558594 0.441406 0.492188 
+0.558594 0.445312 0.488281 
+0.554688 0.449219 0.488281 
+0.558594 0.457031 0.492188 
+0.542969 0.445312 0.472656 
+0.558594 0.445312 0.472656 
+0.554688 0.449219 0.472656 
+0.550781 0.449219 0.476562 
+0.558594 0.460938 0.472656 
+0.558594 0.457031 0.476562 
+0.554688 0.457031 0.480469 
+0.558594 0.460938 0.488281 
+0.539062 0.449219 0.472656 
+0.539062 0.464844 0.472656 
+0.542969 0.460938 0.472656 
+0.542969 0.457031 0.476562 
+0.554688 0.464844 0.472656 
+0.550781 0.464844 0.476562 
+0.550781 0.460938 0.480469 
+0.554688 0.464844 0.488281 
+0.542969 0.472656 0.476562 
+0.558594 0.472656 0.476562 
+0.554688 0.472656 0.480469 
+0.550781 0.476562 0.480469 
+0.558594 0.472656 0.492188 
+0.558594 0.476562 0.488281 
+0.554688 0.480469 0.488281 
+0.558594 0.488281 0.492188 
+0.566406 0.445312 0.449219 
+0.566406 0.445312 0.464844 
+0.566406 0.449219 0.460938 
+0.570312 0.449219 0.457031 
+0.566406 0.460938 0.464844 
+0.570312 0.457031 0.464844 
+0.574219 0.457031 0.460938 
+0.582031 0.460938 0.464844 
+0.566406 0.445312 0.480469 
+0.566406 0.445312 0.496094 
+0.566406 0.449219 0.492188 
+0.570312 0.449219 0.488281 
+0.566406 0.460938 0.496094 
+0.570312 0.457031 0.496094 
+0.574219 0.457031 0.492188 
+0.582031 0.460938 0.496094 
+0.566406 0.449219 0.476562 
+0.566406 0.464844 0.476562 
+0.566406 0.460938 0.480469 
+0.570312 0.457031 0.480469 
+0.566406 0.464844 0.492188 
+0.570312 0.464844 0.488281 
+0.574219 0.460938 0.488281 
+0.582031 0.464844 0.492188 
+0.570312 0.449219 0.472656 
+0.570312 0.464844 0.472656 
+0.574219 0.460938 0.472656 
+0.574219 0.457031 0.476562 
+0.585938 0.464844 0.472656 
+0.582031 0.464844 0.476562 
+0.582031 0.460938 0.480469 
+0.585938 0.464844 0.488281 
+0.566406 0.476562 0.480469 
+0.566406 0.476562 0.496094 
+0.566406 0.480469 0.492188 
+0.570312 0.480469 0.488281 
+0.566406 0.492188 0.496094 
+0.570312 0.488281 0.496094 
+0.574219 0.488281 0.492188 
+0.582031 0.492188 0.496094 
+0.570312 0.472656 0.480469 
+0.570312 0.472656 0.496094 
+0.574219 0.472656 0.492188 
+0.574219 0.476562 0.488281 
+0.585938 0.472656 0.496094 
+0.582031 0.476562 0.496094 
+0.582031 0.480469 0.492188 
+0.585938 0.488281 0.496094 
+0.574219 0.472656 0.476562 
+0.589844 0.472656 0.476562 
+0.585938 0.472656 0.480469 
+0.582031 0.476562 0.480469 
+0.589844 0.472656 0.492188 
+0.589844 0.476562 0.488281 
+0.585938 0.480469 0.488281 
+0.589844 0.488281 0.492188 
+0.601562 0.480469 0.484375 
+0.601562 0.480469 0.496094 
+0.601562 0.484375 0.492188 
+0.601562 0.492188 0.496094 
+0.460938 0.503906 0.390625 
+0.460938 0.511719 0.390625 
+0.492188 0.503906 0.390625 
+0.492188 0.511719 0.390625 
+0.476562 0.503906 0.398438 
+0.488281 0.503906 0.398438 
+0.484375 0.507812 0.398438 
+0.488281 0.515625 0.398438 
+0.472656 0.507812 0.398438 
+0.472656 0.519531 0.398438 
+0.476562 0.515625 0.398438 
+0.484375 0.519531 0.398438 
+0.480469 0.503906 0.414062 
+0.496094 0.503906 0.414062 
+0.492188 0.503906 0.417969 
+0.488281 0.507812 0.417969 
+0.496094 0.503906 0.429688 
+0.496094 0.507812 0.425781 
+0.492188 0.511719 0.425781 
+0.496094 0.519531 0.429688 
+0.480469 0.507812 0.410156 
+0.496094 0.507812 0.410156 
+0.492188 0.511719 0.410156 
+0.488281 0.511719 0.414062 
+0.496094 0.523438 0.410156 
+0.496094 0.519531 0.414062 
+0.492188 0.519531 0.417969 
+0.496094 0.523438 0.425781 
+0.476562 0.511719 0.410156 
+0.476562 0.527344 0.410156 
+0.480469 0.523438 0.410156 
+0.480469 0.519531 0.414062 
+0.492188 0.527344 0.410156 
+0.488281 0.527344 0.414062 
+0.488281 0.523438 0.417969 
+0.492188 0.527344 0.425781 
+0.480469 0.535156 0.414062 
+0.496094 0.535156 0.414062 
+0.492188 0.535156 0.417969 
+0.488281 0.539062 0.417969 
+0.496094 0.535156 0.429688 
+0.496094 0.539062 0.425781 
+0.492188 0.542969 0.425781 
+0.496094 0.550781 0.429688 
+0.445312 0.503906 0.398438 
+0.457031 0.503906 0.398438 
+0.453125 0.507812 0.398438 
+0.457031 0.515625 0.398438 
+0.445312 0.503906 0.417969 
+0.445312 0.503906 0.433594 
+0.449219 0.503906 0.429688 
+0.449219 0.507812 0.425781 
+0.460938 0.503906 0.433594 
+0.457031 0.507812 0.433594 
+0.457031 0.511719 0.429688 
+0.460938 0.519531 0.433594 
+0.449219 0.503906 0.414062 
+0.464844 0.503906 0.414062 
+0.460938 0.503906 0.417969 
+0.457031 0.507812 0.417969 
+0.464844 0.503906 0.429688 
+0.464844 0.507812 0.425781 
+0.460938 0.511719 0.425781 
+0.464844 0.519531 0.429688 
+0.449219 0.507812 0.410156 
+0.464844 0.507812 0.410156 
+0.460938 0.511719 0.410156 
+0.457031 0.511719 0.414062 
+0.464844 0.523438 0.410156 
+0.464844 0.519531 0.414062 
+0.460938 0.519531 0.417969 
+0.464844 0.523438 0.425781 
+0.476562 0.503906 0.417969 
+0.476562 0.503906 0.433594 
+0.480469 0.503906 0.429688 
+0.480469 0.507812 0.425781 
+0.492188 0.503906 0.433594 
+0.488281 0.507812 0.433594 
+0.488281 0.511719 0.429688 
+0.492188 0.519531 0.433594 
+0.472656 0.507812 0.417969 
+0.472656 0.507812 0.433594 
+0.472656 0.511719 0.429688 
+0.476562 0.511719 0.425781 
+0.472656 0.523438 0.433594 
+0.476562 0.519531 0.433594 
+0.480469 0.519531 0.429688 
+0.488281 0.523438 0.433594 
+0.472656 0.511719 0.414062 
+0.472656 0.527344 0.414062 
+0.472656 0.523438 0.417969 
+0.476562 0.519531 0.417969 
+0.472656 0.527344 0.429688 
+0.476562 0.527344 0.425781 
+0.480469 0.523438 0.425781 
+0.488281 0.527344 0.429688 
+0.476562 0.535156 0.417969 
+0.476562 0.535156 0.433594 
+0.480469 0.535156 0.429688 
+0.480469 0.539062 0.425781 
+0.492188 0.535156 0.433594 
+0.488281 0.539062 0.433594 
+0.488281 0.542969 0.429688 
+0.492188 0.550781 0.433594 
+0.441406 0.507812 0.398438 
+0.441406 0.519531 0.398438 
+0.445312 0.515625 0.398438 
+0.453125 0.519531 0.398438 
+0.441406 0.507812 0.417969 
+0.441406 0.507812 0.433594 
+0.441406 0.511719 0.429688 
+0.445312 0.511719 0.425781 
+0.441406 0.523438 0.433594 
+0.445312 0.519531 0.433594 
+0.449219 0.519531 0.429688 
+0.457031 0.523438 0.433594 
+0.441406 0.511719 0.414062 
+0.441406 0.527344 0.414062 
+0.441406 0.523438 0.417969 
+0.445312 0.519531 0.417969 
+0.441406 0.527344 0.429688 
+0.445312 0.527344 0.425781 
+0.449219 0.523438 0.425781 
+0.457031 0.527344 0.429688 
+0.445312 0.511719 0.410156 
+0.445312 0.527344 0.410156 
+0.449219 0.523438 0.410156 
+0.449219 0.519531 0.414062 
+0.460938 0.527344 0.410156 
+0.457031 0.527344 0.414062 
+0.457031 0.523438 0.417969 
+0.460938 0.527344 0.425781 
+0.441406 0.539062 0.433594 
+0.457031 0.554688 0.433594 
+0.441406 0.542969 0.421875 
+0.445312 0.550781 0.429688 
+0.441406 0.550781 0.433594 
+0.445312 0.546875 0.433594 
+0.449219 0.546875 0.429688 
+0.445312 0.535156 0.417969 
+0.445312 0.535156 0.433594 
+0.449219 0.535156 0.429688 
+0.449219 0.539062 0.425781 
+0.460938 0.535156 0.433594 
+0.457031 0.539062 0.433594 
+0.457031 0.542969 0.429688 
+0.460938 0.550781 0.433594 
+0.449219 0.535156 0.414062 
+0.464844 0.535156 0.414062 
+0.460938 0.535156 0.417969 
+0.457031 0.539062 0.417969 
+0.464844 0.535156 0.429688 
+0.464844 0.539062 0.425781 
+0.460938 0.542969 0.425781 
+0.464844 0.550781 0.429688 
+0.472656 0.539062 0.417969 
+0.472656 0.539062 0.433594 
+0.472656 0.542969 0.429688 
+0.476562 0.542969 0.425781 
+0.472656 0.554688 0.433594 
+0.476562 0.550781 0.433594 
+0.480469 0.550781 0.429688 
+0.488281 0.554688 0.433594 
+0.449219 0.503906 0.445312 
+0.464844 0.503906 0.445312 
+0.460938 0.503906 0.449219 
+0.457031 0.507812 0.449219 
+0.464844 0.503906 0.460938 
+0.464844 0.507812 0.457031 
+0.460938 0.511719 0.457031 
+0.464844 0.519531 0.460938 
+0.480469 0.503906 0.445312 
+0.496094 0.503906 0.445312 
+0.492188 0.503906 0.449219 
+0.488281 0.507812 0.449219 
+0.496094 0.503906 0.460938 
+0.496094 0.507812 0.457031 
+0.492188 0.511719 0.457031 
+0.496094 0.519531 0.460938 
+0.476562 0.503906 0.449219 
+0.476562 0.503906 0.464844 
+0.480469 0.503906 0.460938 
+0.480469 0.507812 0.457031 
+0.492188 0.503906 0.464844 
+0.488281 0.507812 0.464844 
+0.488281 0.511719 0.460938 
+0.492188 0.519531 0.464844 
+0.472656 0.507812 0.449219 
+0.472656 0.507812 0.464844 
+0.472656 0.511719 0.460938 
+0.476562 0.511719 0.457031 
+0.472656 0.523438 0.464844 
+0.476562 0.519531 0.464844 
+0.480469 0.519531 0.460938 
+0.488281 0.523438 0.464844 
+0.480469 0.503906 0.476562 
+0.496094 0.503906 0.476562 
+0.492188 0.503906 0.480469 
+0.488281 0.507812 0.480469 
+0.496094 0.503906 0.492188 
+0.496094 0.507812 0.488281 
+0.492188 0.511719 0.488281 
+0.496094 0.519531 0.492188 
+0.480469 0.507812 0.472656 
+0.496094 0.507812 0.472656 
+0.492188 0.511719 0.472656 
+0.488281 0.511719 0.476562 
+0.496094 0.523438 0.472656 
+0.496094 0.519531 0.476562 
+0.492188 0.519531 0.480469 
+0.496094 0.523438 0.488281 
+0.476562 0.511719 0.472656 
+0.476562 0.527344 0.472656 
+0.480469 0.523438 0.472656 
+0.480469 0.519531 0.476562 
+0.492188 0.527344 0.472656 
+0.488281 0.527344 0.476562 
+0.488281 0.523438 0.480469 
+0.492188 0.527344 0.488281 
+0.480469 0.535156 0.476562 
+0.496094 0.535156 0.476562 
+0.492188 0.535156 0.480469 
+0.488281 0.539062 0.480469 
+0.496094 0.535156 0.492188 
+0.496094 0.539062 0.488281 
+0.492188 0.542969 0.488281 
+0.496094 0.550781 0.492188 
+0.449219 0.507812 0.441406 
+0.464844 0.507812 0.441406 
+0.460938 0.511719 0.441406 
+0.457031 0.511719 0.445312 
+0.464844 0.523438 0.441406 
+0.464844 0.519531 0.445312 
+0.460938 0.519531 0.449219 
+0.464844 0.523438 0.457031 
+0.480469 0.507812 0.441406 
+0.496094 0.507812 0.441406 
+0.492188 0.511719 0.441406 
+0.488281 0.511719 0.445312 
+0.496094 0.523438 0.441406 
+0.496094 0.519531 0.445312 
+0.492188 0.519531 0.449219 
+0.496094 0.523438 0.457031 
+0.476562 0.511719 0.441406 
+0.476562 0.527344 0.441406 
+0.480469 0.523438 0.441406 
+0.480469 0.519531 0.445312 
+0.492188 0.527344 0.441406 
+0.488281 0.527344 0.445312 
+0.488281 0.523438 0.449219 
+0.492188 0.527344 0.457031 
+0.472656 0.511719 0.445312 
+0.472656 0.527344 0.445312 
+0.472656 0.523438 0.449219 
+0.476562 0.519531 0.449219 
+0.472656 0.527344 0.460938 
+0.476562 0.527344 0.457031 
+0.480469 0.523438 0.457031 
+0.488281 0.527344 0.460938 
+0.480469 0.539062 0.441406 
+0.496094 0.539062 0.441406 
+0.492188 0.542969 0.441406 
+0.488281 0.542969 0.445312 
+0.496094 0.554688 0.441406 
+0.496094 0.550781 0.445312 
+0.492188 0.550781 0.449219 
+0.496094 0.554688 0.457031 
+0.480469 0.535156 0.445312 
+0.496094 0.535156 0.445312 
+0.492188 0.535156 0.449219 
+0.488281 0.539062 0.449219 
+0.496094 0.535156 0.460938 
+0.496094 0.539062 0.457031 
+0.492188 0.542969 0.457031 
+0.496094 0.550781 0.460938 
+0.476562 0.535156 0.449219 
+0.476562 0.535156 0.464844 
+0.480469 0.535156 0.460938 
+0.480469 0.539062 0.457031 
+0.492188 0.535156 0.464844 
+0.488281 0.539062 0.464844 
+0.488281 0.542969 0.460938 
+0.492188 0.550781 0.464844 
+0.480469 0.539062 0.472656 
+0.496094 0.539062 0.472656 
+0.492188 0.542969 0.472656 
+0.488281 0.542969 0.476562 
+0.496094 0.554688 0.472656 
+0.496094 0.550781 0.476562 
+0.492188 0.550781 0.480469 
+0.496094 0.554688 0.488281 
+0.445312 0.511719 0.441406 
+0.445312 0.527344 0.441406 
+0.449219 0.523438 0.441406 
+0.449219 0.519531 0.445312 
+0.460938 0.527344 0.441406 
+0.457031 0.527344 0.445312 
+0.457031 0.523438 0.449219 
+0.460938 0.527344 0.457031 
+0.445312 0.542969 0.441406 
+0.445312 0.558594 0.441406 
+0.449219 0.554688 0.441406 
+0.449219 0.550781 0.445312 
+0.460938 0.558594 0.441406 
+0.457031 0.558594 0.445312 
+0.457031 0.554688 0.449219 
+0.460938 0.558594 0.457031 
+0.449219 0.539062 0.441406 
+0.464844 0.539062 0.441406 
+0.460938 0.542969 0.441406 
+0.457031 0.542969 0.445312 
+0.464844 0.554688 0.441406 
+0.464844 0.550781 0.445312 
+0.460938 0.550781 0.449219 
+0.464844 0.554688 0.457031 
+0.449219 0.535156 0.445312 
+0.464844 0.535156 0.445312 
+0.460938 0.535156 0.449219 
+0.457031 0.539062 0.449219 
+0.464844 0.535156 0.460938 
+0.464844 0.539062 0.457031 
+0.460938 0.542969 0.457031 
+0.464844 0.550781 0.460938 
+0.476562 0.542969 0.441406 
+0.476562 0.558594 0.441406 
+0.480469 0.554688 0.441406 
+0.480469 0.550781 0.445312 
+0.492188 0.558594 0.441406 
+0.488281 0.558594 0.445312 
+0.488281 0.554688 0.449219 
+0.492188 0.558594 0.457031 
+0.472656 0.542969 0.445312 
+0.472656 0.558594 0.445312 
+0.472656 0.554688 0.449219 
+0.476562 0.550781 0.449219 
+0.472656 0.558594 0.460938 
+0.476562 0.558594 0.457031 
+0.480469 0.554688 0.457031 
+0.488281 0.558594 0.460938 
+0.472656 0.539062 0.449219 
+0.472656 0.539062 0.464844 
+0.472656 0.542969 0.460938 
+0.476562 0.542969 0.457031 
+0.472656 0.554688 0.464844 
+0.476562 0.550781 0.464844 
+0.480469 0.550781 0.460938 
+0.488281 0.554688 0.464844 
+0.476562 0.542969 0.472656 
+0.476562 0.558594 0.472656 
+0.480469 0.554688 0.472656 
+0.480469 0.550781 0.476562 
+0.492188 0.558594 0.472656 
+0.488281 0.558594 0.476562 
+0.488281 0.554688 0.480469 
+0.492188 0.558594 0.488281 
+0.449219 0.566406 0.445312 
+0.464844 0.566406 0.445312 
+0.460938 0.566406 0.449219 
+0.457031 0.570312 0.449219 
+0.464844 0.566406 0.460938 
+0.464844 0.570312 0.457031 
+0.460938 0.574219 0.457031 
+0.464844 0.582031 0.460938 
+0.480469 0.566406 0.445312 
+0.496094 0.566406 0.445312 
+0.492188 0.566406 0.449219 
+0.488281 0.570312 0.449219 
+0.496094 0.566406 0.460938 
+0.496094 0.570312 0.457031 
+0.492188 0.574219 0.457031 
+0.496094 0.582031 0.460938 
+0.476562 0.566406 0.449219 
+0.476562 0.566406 0.464844 
+0.480469 0.566406 0.460938 
+0.480469 0.570312 0.457031 
+0.492188 0.566406 0.464844 
+0.488281 0.570312 0.464844 
+0.488281 0.574219 0.460938 
+0.492188 0.582031 0.464844 
+0.472656 0.570312 0.449219 
+0.472656 0.570312 0.464844 
+0.472656 0.574219 0.460938 
+0.476562 0.574219 0.457031 
+0.472656 0.585938 0.464844 
+0.476562 0.582031 0.464844 
+0.480469 0.582031 0.460938 
+0.488281 0.585938 0.464844 
+0.480469 0.566406 0.476562 
+0.496094 0.566406 0.476562 
+0.492188 0.566406 0.480469 
+0.488281 0.570312 0.480469 
+0.496094 0.566406 0.492188 
+0.496094 0.570312 0.488281 
+0.492188 0.574219 0.488281 
+0.496094 0.582031 0.492188 
+0.480469 0.570312 0.472656 
+0.496094 0.570312 0.472656 
+0.492188 0.574219 0.472656 
+0.488281 0.574219 0.476562 
+0.496094 0.585938 0.472656 
+0.496094 0.582031 0.476562 
+0.492188 0.582031 0.480469 
+0.496094 0.585938 0.488281 
+0.476562 0.574219 0.472656 
+0.476562 0.589844 0.472656 
+0.480469 0.585938 0.472656 
+0.480469 0.582031 0.476562 
+0.492188 0.589844 0.472656 
+0.488281 0.589844 0.476562 
+0.488281 0.585938 0.480469 
+0.492188 0.589844 0.488281 
+0.484375 0.601562 0.480469 
+0.496094 0.601562 0.480469 
+0.492188 0.601562 0.484375 
+0.496094 0.601562 0.492188 
+0.390625 0.503906 0.460938 
+0.390625 0.511719 0.460938 
+0.390625 0.503906 0.492188 
+0.390625 0.511719 0.492188 
+0.398438 0.503906 0.476562 
+0.398438 0.503906 0.488281 
+0.398438 0.507812 0.484375 
+0.398438 0.515625 0.488281 
+0.398438 0.507812 0.472656 
+0.398438 0.519531 0.472656 
+0.398438 0.515625 0.476562 
+0.398438 0.519531 0.484375 
+0.414062 0.503906 0.480469 
+0.414062 0.503906 0.496094 
+0.417969 0.503906 0.492188 
+0.417969 0.507812 0.488281 
+0.429688 0.503906 0.496094 
+0.425781 0.507812 0.496094 
+0.425781 0.511719 0.492188 
+0.429688 0.519531 0.496094 
+0.410156 0.507812 0.480469 
+0.410156 0.507812 0.496094 
+0.410156 0.511719 0.492188 
+0.414062 0.511719 0.488281 
+0.410156 0.523438 0.496094 
+0.414062 0.519531 0.496094 
+0.417969 0.519531 0.492188 
+0.425781 0.523438 0.496094 
+0.410156 0.511719 0.476562 
+0.410156 0.527344 0.476562 
+0.410156 0.523438 0.480469 
+0.414062 0.519531 0.480469 
+0.410156 0.527344 0.492188 
+0.414062 0.527344 0.488281 
+0.417969 0.523438 0.488281 
+0.425781 0.527344 0.492188 
+0.414062 0.535156 0.480469 
+0.414062 0.535156 0.496094 
+0.417969 0.535156 0.492188 
+0.417969 0.539062 0.488281 
+0.429688 0.535156 0.496094 
+0.425781 0.539062 0.496094 
+0.425781 0.542969 0.492188 
+0.429688 0.550781 0.496094 
+0.398438 0.503906 0.445312 
+0.398438 0.503906 0.457031 
+0.398438 0.507812 0.453125 
+0.398438 0.515625 0.457031 
+0.417969 0.503906 0.445312 
+0.433594 0.503906 0.445312 
+0.429688 0.503906 0.449219 
+0.425781 0.507812 0.449219 
+0.433594 0.503906 0.460938 
+0.433594 0.507812 0.457031 
+0.429688 0.511719 0.457031 
+0.433594 0.519531 0.460938 
+0.414062 0.503906 0.449219 
+0.414062 0.503906 0.464844 
+0.417969 0.503906 0.460938 
+0.417969 0.507812 0.457031 
+0.429688 0.503906 0.464844 
+0.425781 0.507812 0.464844 
+0.425781 0.511719 0.460938 
+0.429688 0.519531 0.464844 
+0.410156 0.507812 0.449219 
+0.410156 0.507812 0.464844 
+0.410156 0.511719 0.460938 
+0.414062 0.511719 0.457031 
+0.410156 0.523438 0.464844 
+0.414062 0.519531 0.464844 
+0.417969 0.519531 0.460938 
+0.425781 0.523438 0.464844 
+0.417969 0.503906 0.476562 
+0.433594 0.503906 0.476562 
+0.429688 0.503906 0.480469 
+0.425781 0.507812 0.480469 
+0.433594 0.503906 0.492188 
+0.433594 0.507812 0.488281 
+0.429688 0.511719 0.488281 
+0.433594 0.519531 0.492188 
+0.417969 0.507812 0.472656 
+0.433594 0.507812 0.472656 
+0.429688 0.511719 0.472656 
+0.425781 0.511719 0.476562 
+0.433594 0.523438 0.472656 
+0.433594 0.519531 0.476562 
+0.429688 0.519531 0.480469 
+0.433594 0.523438 0.488281 
+0.414062 0.511719 0.472656 
+0.414062 0.527344 0.472656 
+0.417969 0.523438 0.472656 
+0.417969 0.519531 0.476562 
+0.429688 0.527344 0.472656 
+0.425781 0.527344 0.476562 
+0.425781 0.523438 0.480469 
+0.429688 0.527344 0.488281 
+0.417969 0.535156 0.476562 
+0.433594 0.535156 0.476562 
+0.429688 0.535156 0.480469 
+0.425781 0.539062 0.480469 
+0.433594 0.535156 0.492188 
+0.433594 0.539062 0.488281 
+0.429688 0.542969 0.488281 
+0.433594 0.550781 0.492188 
+0.398438 0.507812 0.441406 
+0.398438 0.519531 0.441406 
+0.398438 0.515625 0.445312 
+0.398438 0.519531 0.453125 
+0.417969 0.507812 0.441406 
+0.433594 0.507812 0.441406 
+0.429688 0.511719 0.441406 
+0.425781 0.511719 0.445312 
+0.433594 0.523438 0.441406 
+0.433594 0.519531 0.445312 
+0.429688 0.519531 0.449219 
+0.433594 0.523438 0.457031 
+0.414062 0.511719 0.441406 
+0.414062 0.527344 0.441406 
+0.417969 0.523438 0.441406 
+0.417969 0.519531 0.445312 
+0.429688 0.527344 0.441406 
+0.425781 0.527344 0.445312 
+0.425781 0.523438 0.449219 
+0.429688 0.527344 0.457031 
+0.410156 0.511719 0.445312 
+0.410156 0.527344 0.445312 
+0.410156 0.523438 0.449219 
+0.414062 0.519531 0.449219 
+0.410156 0.527344 0.460938 
+0.414062 0.527344 0.457031 
+0.417969 0.523438 0.457031 
+0.425781 0.527344 0.460938 
+0.433594 0.539062 0.441406 
+0.433594 0.554688 0.457031 
+0.421875 0.542969 0.441406 
+0.429688 0.550781 0.445312 
+0.433594 0.550781 0.441406 
+0.433594 0.546875 0.445312 
+0.429688 0.546875 0.449219 
+0.417969 0.535156 0.445312 
+0.433594 0.535156 0.445312 
+0.429688 0.535156 0.449219 
+0.425781 0.539062 0.449219 
+0.433594 0.535156 0.460938 
+0.433594 0.539062 0.457031 
+0.429688 0.542969 0.457031 
+0.433594 0.550781 0.460938 
+0.414062 0.535156 0.449219 
+0.414062 0.535156 0.464844 
+0.417969 0.535156 0.460938 
+0.417969 0.539062 0.457031 
+0.429688 0.535156 0.464844 
+0.425781 0.539062 0.464844 
+0.425781 0.542969 0.460938 
+0.429688 0.550781 0.464844 
+0.417969 0.539062 0.472656 
+0.433594 0.539062 0.472656 
+0.429688 0.542969 0.472656 
+0.425781 0.542969 0.476562 
+0.433594 0.554688 0.472656 
+0.433594 0.550781 0.476562 
+0.429688 0.550781 0.480469 
+0.433594 0.554688 0.488281 
+0.445312 0.503906 0.449219 
+0.445312 0.503906 0.464844 
+0.449219 0.503906 0.460938 
+0.449219 0.507812 0.457031 
+0.460938 0.503906 0.464844 
+0.457031 0.507812 0.464844 
+0.457031 0.511719 0.460938 
+0.460938 0.519531 0.464844 
+0.445312 0.503906 0.480469 
+0.445312 0.503906 0.496094 
+0.449219 0.503906 0.492188 
+0.449219 0.507812 0.488281 
+0.460938 0.503906 0.496094 
+0.457031 0.507812 0.496094 
+0.457031 0.511719 0.492188 
+0.460938 0.519531 0.496094 
+0.449219 0.503906 0.476562 
+0.464844 0.503906 0.476562 
+0.460938 0.503906 0.480469 
+0.457031 0.507812 0.480469 
+0.464844 0.503906 0.492188 
+0.464844 0.507812 0.488281 
+0.460938 0.511719 0.488281 
+0.464844 0.519531 0.492188 
+0.449219 0.507812 0.472656 
+0.464844 0.507812 0.472656 
+0.460938 0.511719 0.472656 
+0.457031 0.511719 0.476562 
+0.464844 0.523438 0.472656 
+0.464844 0.519531 0.476562 
+0.460938 0.519531 0.480469 
+0.464844 0.523438 0.488281 
+0.476562 0.503906 0.480469 
+0.476562 0.503906 0.496094 
+0.480469 0.503906 0.492188 
+0.480469 0.507812 0.488281 
+0.492188 0.503906 0.496094 
+0.488281 0.507812 0.496094 
+0.488281 0.511719 0.492188 
+0.492188 0.519531 0.496094 
+0.472656 0.507812 0.480469 
+0.472656 0.507812 0.496094 
+0.472656 0.511719 0.492188 
+0.476562 0.511719 0.488281 
+0.472656 0.523438 0.496094 
+0.476562 0.519531 0.496094 
+0.480469 0.519531 0.492188 
+0.488281 0.523438 0.496094 
+0.472656 0.511719 0.476562 
+0.472656 0.527344 0.476562 
+0.472656 0.523438 0.480469 
+0.476562 0.519531 0.480469 
+0.472656 0.527344 0.492188 
+0.476562 0.527344 0.488281 
+0.480469 0.523438 0.488281 
+0.488281 0.527344 0.492188 
+0.476562 0.535156 0.480469 
+0.476562 0.535156 0.496094 
+0.480469 0.535156 0.492188 
+0.480469 0.539062 0.488281 
+0.492188 0.535156 0.496094 
+0.488281 0.539062 0.496094 
+0.488281 0.542969 0.492188 
+0.492188 0.550781 0.496094 
+0.441406 0.507812 0.449219 
+0.441406 0.507812 0.464844 
+0.441406 0.511719 0.460938 
+0.445312 0.511719 0.457031 
+0.441406 0.523438 0.464844 
+0.445312 0.519531 0.464844 
+0.449219 0.519531 0.460938 
+0.457031 0.523438 0.464844 
+0.441406 0.507812 0.480469 
+0.441406 0.507812 0.496094 
+0.441406 0.511719 0.492188 
+0.445312 0.511719 0.488281 
+0.441406 0.523438 0.496094 
+0.445312 0.519531 0.496094 
+0.449219 0.519531 0.492188 
+0.457031 0.523438 0.496094 
+0.441406 0.511719 0.476562 
+0.441406 0.527344 0.476562 
+0.441406 0.523438 0.480469 
+0.445312 0.519531 0.480469 
+0.441406 0.527344 0.492188 
+0.445312 0.527344 0.488281 
+0.449219 0.523438 0.488281 
+0.457031 0.527344 0.492188 
+0.445312 0.511719 0.472656 
+0.445312 0.527344 0.472656 
+0.449219 0.523438 0.472656 
+0.449219 0.519531 0.476562 
+0.460938 0.527344 0.472656 
+0.457031 0.527344 0.476562 
+0.457031 0.523438 0.480469 
+0.460938 0.527344 0.488281 
+0.441406 0.539062 0.480469 
+0.441406 0.539062 0.496094 
+0.441406 0.542969 0.492188 
+0.445312 0.542969 0.488281 
+0.441406 0.554688 0.496094 
+0.445312 0.550781 0.496094 
+0.449219 0.550781 0.492188 
+0.457031 0.554688 0.496094 
+0.445312 0.535156 0.480469 
+0.445312 0.535156 0.496094 
+0.449219 0.535156 0.492188 
+0.449219 0.539062 0.488281 
+0.460938 0.535156 0.496094 
+0.457031 0.539062 0.496094 
+0.457031 0.542969 0.492188 
+0.460938 0.550781 0.496094 
+0.449219 0.535156 0.476562 
+0.464844 0.535156 0.476562 
+0.460938 0.535156 0.480469 
+0.457031 0.539062 0.480469 
+0.464844 0.535156 0.492188 
+0.464844 0.539062 0.488281 
+0.460938 0.542969 0.488281 
+0.464844 0.550781 0.492188 
+0.472656 0.539062 0.480469 
+0.472656 0.539062 0.496094 
+0.472656 0.542969 0.492188 
+0.476562 0.542969 0.488281 
+0.472656 0.554688 0.496094 
+0.476562 0.550781 0.496094 
+0.480469 0.550781 0.492188 
+0.488281 0.554688 0.496094 
+0.441406 0.511719 0.445312 
+0.441406 0.527344 0.445312 
+0.441406 0.523438 0.449219 
+0.445312 0.519531 0.449219 
+0.441406 0.527344 0.460938 
+0.445312 0.527344 0.457031 
+0.449219 0.523438 0.457031 
+0.457031 0.527344 0.460938 
+0.441406 0.542969 0.445312 
+0.441406 0.558594 0.445312 
+0.441406 0.554688 0.449219 
+0.445312 0.550781 0.449219 
+0.441406 0.558594 0.460938 
+0.445312 0.558594 0.457031 
+0.449219 0.554688 0.457031 
+0.457031 0.558594 0.460938 
+0.441406 0.539062 0.449219 
+0.441406 0.539062 0.464844 
+0.441406 0.542969 0.460938 
+0.445312 0.542969 0.457031 
+0.441406 0.554688 0.464844 
+0.445312 0.550781 0.464844 
+0.449219 0.550781 0.460938 
+0.457031 0.554688 0.464844 
+0.445312 0.535156 0.449219 
+0.445312 0.535156 0.464844 
+0.449219 0.535156 0.460938 
+0.449219 0.539062 0.457031 
+0.460938 0.535156 0.464844 
+0.457031 0.539062 0.464844 
+0.457031 0.542969 0.460938 
+0.460938 0.550781 0.464844 
+0.441406 0.542969 0.476562 
+0.441406 0.558594 0.476562 
+0.441406 0.554688 0.480469 
+0.445312 0.550781 0.480469 
+0.441406 0.558594 0.492188 
+0.445312 0.558594 0.488281 
+0.449219 0.554688 0.488281 
+0.457031 0.558594 0.492188 
+0.445312 0.542969 0.472656 
+0.445312 0.558594 0.472656 
+0.449219 0.554688 0.472656 
+0.449219 0.550781 0.476562 
+0.460938 0.558594 0.472656 
+0.457031 0.558594 0.476562 
+0.457031 0.554688 0.480469 
+0.460938 0.558594 0.488281 
+0.449219 0.539062 0.472656 
+0.464844 0.539062 0.472656 
+0.460938 0.542969 0.472656 
+0.457031 0.542969 0.476562 
+0.464844 0.554688 0.472656 
+0.464844 0.550781 0.476562 
+0.460938 0.550781 0.480469 
+0.464844 0.554688 0.488281 
+0.472656 0.542969 0.476562 
+0.472656 0.558594 0.476562 
+0.472656 0.554688 0.480469 
+0.476562 0.550781 0.480469 
+0.472656 0.558594 0.492188 
+0.476562 0.558594 0.488281 
+0.480469 0.554688 0.488281 
+0.488281 0.558594 0.492188 
+0.445312 0.566406 0.449219 
+0.445312 0.566406 0.464844 
+0.449219 0.566406 0.460938 
+0.449219 0.570312 0.457031 
+0.460938 0.566406 0.464844 
+0.457031 0.570312 0.464844 
+0.457031 0.574219 0.460938 
+0.460938 0.582031 0.464844 
+0.445312 0.566406 0.480469 
+0.445312 0.566406 0.496094 
+0.449219 0.566406 0.492188 
+0.449219 0.570312 0.488281 
+0.460938 0.566406 0.496094 
+0.457031 0.570312 0.496094 
+0.457031 0.574219 0.492188 
+0.460938 0.582031 0.496094 
+0.449219 0.566406 0.476562 
+0.464844 0.566406 0.476562 
+0.460938 0.566406 0.480469 
+0.457031 0.570312 0.480469 
+0.464844 0.566406 0.492188 
+0.464844 0.570312 0.488281 
+0.460938 0.574219 0.488281 
+0.464844 0.582031 0.492188 
+0.449219 0.570312 0.472656 
+0.464844 0.570312 0.472656 
+0.460938 0.574219 0.472656 
+0.457031 0.574219 0.476562 
+0.464844 0.585938 0.472656 
+0.464844 0.582031 0.476562 
+0.460938 0.582031 0.480469 
+0.464844 0.585938 0.488281 
+0.476562 0.566406 0.480469 
+0.476562 0.566406 0.496094 
+0.480469 0.566406 0.492188 
+0.480469 0.570312 0.488281 
+0.492188 0.566406 0.496094 
+0.488281 0.570312 0.496094 
+0.488281 0.574219 0.492188 
+0.492188 0.582031 0.496094 
+0.472656 0.570312 0.480469 
+0.472656 0.570312 0.496094 
+0.472656 0.574219 0.492188 
+0.476562 0.574219 0.488281 
+0.472656 0.585938 0.496094 
+0.476562 0.582031 0.496094 
+0.480469 0.582031 0.492188 
+0.488281 0.585938 0.496094 
+0.472656 0.574219 0.476562 
+0.472656 0.589844 0.476562 
+0.472656 0.585938 0.480469 
+0.476562 0.582031 0.480469 
+0.472656 0.589844 0.492188 
+0.476562 0.589844 0.488281 
+0.480469 0.585938 0.488281 
+0.488281 0.589844 0.492188 
+0.480469 0.601562 0.484375 
+0.480469 0.601562 0.496094 
+0.484375 0.601562 0.492188 
+0.492188 0.601562 0.496094 
+0.507812 0.503906 0.398438 
+0.519531 0.503906 0.398438 
+0.515625 0.507812 0.398438 
+0.519531 0.515625 0.398438 
+0.507812 0.503906 0.417969 
+0.507812 0.503906 0.433594 
+0.511719 0.503906 0.429688 
+0.511719 0.507812 0.425781 
+0.523438 0.503906 0.433594 
+0.519531 0.507812 0.433594 
+0.519531 0.511719 0.429688 
+0.523438 0.519531 0.433594 
+0.511719 0.503906 0.414062 
+0.527344 0.503906 0.414062 
+0.523438 0.503906 0.417969 
+0.519531 0.507812 0.417969 
+0.527344 0.503906 0.429688 
+0.527344 0.507812 0.425781 
+0.523438 0.511719 0.425781 
+0.527344 0.519531 0.429688 
+0.511719 0.507812 0.410156 
+0.527344 0.507812 0.410156 
+0.523438 0.511719 0.410156 
+0.519531 0.511719 0.414062 
+0.527344 0.523438 0.410156 
+0.527344 0.519531 0.414062 
+0.523438 0.519531 0.417969 
+0.527344 0.523438 0.425781 
+0.539062 0.503906 0.417969 
+0.539062 0.503906 0.433594 
+0.542969 0.503906 0.429688 
+0.542969 0.507812 0.425781 
+0.554688 0.503906 0.433594 
+0.550781 0.507812 0.433594 
+0.550781 0.511719 0.429688 
+0.554688 0.519531 0.433594 
+0.535156 0.507812 0.417969 
+0.535156 0.507812 0.433594 
+0.535156 0.511719 0.429688 
+0.539062 0.511719 0.425781 
+0.535156 0.523438 0.433594 
+0.539062 0.519531 0.433594 
+0.542969 0.519531 0.429688 
+0.550781 0.523438 0.433594 
+0.535156 0.511719 0.414062 
+0.535156 0.527344 0.414062 
+0.535156 0.523438 0.417969 
+0.539062 0.519531 0.417969 
+0.535156 0.527344 0.429688 
+0.539062 0.527344 0.425781 
+0.542969 0.523438 0.425781 
+0.550781 0.527344 0.429688 
+0.539062 0.535156 0.417969 
+0.539062 0.535156 0.433594 
+0.542969 0.535156 0.429688 
+0.542969 0.539062 0.425781 
+0.554688 0.535156 0.433594 
+0.550781 0.539062 0.433594 
+0.550781 0.542969 0.429688 
+0.554688 0.550781 0.433594 
+0.507812 0.503906 0.449219 
+0.507812 0.503906 0.464844 
+0.511719 0.503906 0.460938 
+0.511719 0.507812 0.457031 
+0.523438 0.503906 0.464844 
+0.519531 0.507812 0.464844 
+0.519531 0.511719 0.460938 
+0.523438 0.519531 0.464844 
+0.507812 0.503906 0.480469 
+0.507812 0.503906 0.496094 
+0.511719 0.503906 0.492188 
+0.511719 0.507812 0.488281 
+0.523438 0.503906 0.496094 
+0.519531 0.507812 0.496094 
+0.519531 0.511719 0.492188 
+0.523438 0.519531 0.496094 
+0.511719 0.503906 0.476562 
+0.527344 0.503906 0.476562 
+0.523438 0.503906 0.480469 
+0.519531 0.507812 0.480469 
+0.527344 0.503906 0.492188 
+0.527344 0.507812 0.488281 
+0.523438 0.511719 0.488281 
+0.527344 0.519531 0.492188 
+0.511719 0.507812 0.472656 
+0.527344 0.507812 0.472656 
+0.523438 0.511719 0.472656 
+0.519531 0.511719 0.476562 
+0.527344 0.523438 0.472656 
+0.527344 0.519531 0.476562 
+0.523438 0.519531 0.480469 
+0.527344 0.523438 0.488281 
+0.539062 0.503906 0.480469 
+0.539062 0.503906 0.496094 
+0.542969 0.503906 0.492188 
+0.542969 0.507812 0.488281 
+0.554688 0.503906 0.496094 
+0.550781 0.507812 0.496094 
+0.550781 0.511719 0.492188 
+0.554688 0.519531 0.496094 
+0.535156 0.507812 0.480469 
+0.535156 0.507812 0.496094 
+0.535156 0.511719 0.492188 
+0.539062 0.511719 0.488281 
+0.535156 0.523438 0.496094 
+0.539062 0.519531 0.496094 
+0.542969 0.519531 0.492188 
+0.550781 0.523438 0.496094 
+0.535156 0.511719 0.476562 
+0.535156 0.527344 0.476562 
+0.535156 0.523438 0.480469 
+0.539062 0.519531 0.480469 
+0.535156 0.527344 0.492188 
+0.539062 0.527344 0.488281 
+0.542969 0.523438 0.488281 
+0.550781 0.527344 0.492188 
+0.539062 0.535156 0.480469 
+0.539062 0.535156 0.496094 
+0.542969 0.535156 0.492188 
+0.542969 0.539062 0.488281 
+0.554688 0.535156 0.496094 
+0.550781 0.539062 0.496094 
+0.550781 0.542969 0.492188 
+0.554688 0.550781 0.496094 
+0.511719 0.503906 0.445312 
+0.527344 0.503906 0.445312 
+0.523438 0.503906 0.449219 
+0.519531 0.507812 0.449219 
+0.527344 0.503906 0.460938 
+0.527344 0.507812 0.457031 
+0.523438 0.511719 0.457031 
+0.527344 0.519531 0.460938 
+0.542969 0.503906 0.445312 
+0.558594 0.503906 0.445312 
+0.554688 0.503906 0.449219 
+0.550781 0.507812 0.449219 
+0.558594 0.503906 0.460938 
+0.558594 0.507812 0.457031 
+0.554688 0.511719 0.457031 
+0.558594 0.519531 0.460938 
+0.539062 0.503906 0.449219 
+0.539062 0.503906 0.464844 
+0.542969 0.503906 0.460938 
+0.542969 0.507812 0.457031 
+0.554688 0.503906 0.464844 
+0.550781 0.507812 0.464844 
+0.550781 0.511719 0.460938 
+0.554688 0.519531 0.464844 
+0.535156 0.507812 0.449219 
+0.535156 0.507812 0.464844 
+0.535156 0.511719 0.460938 
+0.539062 0.511719 0.457031 
+0.535156 0.523438 0.464844 
+0.539062 0.519531 0.464844 
+0.542969 0.519531 0.460938 
+0.550781 0.523438 0.464844 
+0.542969 0.503906 0.476562 
+0.558594 0.503906 0.476562 
+0.554688 0.503906 0.480469 
+0.550781 0.507812 0.480469 
+0.558594 0.503906 0.492188 
+0.558594 0.507812 0.488281 
+0.554688 0.511719 0.488281 
+0.558594 0.519531 0.492188 
+0.542969 0.507812 0.472656 
+0.558594 0.507812 0.472656 
+0.554688 0.511719 0.472656 
+0.550781 0.511719 0.476562 
+0.558594 0.523438 0.472656 
+0.558594 0.519531 0.476562 
+0.554688 0.519531 0.480469 
+0.558594 0.523438 0.488281 
+0.539062 0.511719 0.472656 
+0.539062 0.527344 0.472656 
+0.542969 0.523438 0.472656 
+0.542969 0.519531 0.476562 
+0.554688 0.527344 0.472656 
+0.550781 0.527344 0.476562 
+0.550781 0.523438 0.480469 
+0.554688 0.527344 0.488281 
+0.542969 0.535156 0.476562 
+0.558594 0.535156 0.476562 
+0.554688 0.535156 0.480469 
+0.550781 0.539062 0.480469 
+0.558594 0.535156 0.492188 
+0.558594 0.539062 0.488281 
+0.554688 0.542969 0.488281 
+0.558594 0.550781 0.492188 
+0.511719 0.507812 0.441406 
+0.527344 0.507812 0.441406 
+0.523438 0.511719 0.441406 
+0.519531 0.511719 0.445312 
+0.527344 0.523438 0.441406 
+0.527344 0.519531 0.445312 
+0.523438 0.519531 0.449219 
+0.527344 0.523438 0.457031 
+0.542969 0.507812 0.441406 
+0.558594 0.507812 0.441406 
+0.554688 0.511719 0.441406 
+0.550781 0.511719 0.445312 
+0.558594 0.523438 0.441406 
+0.558594 0.519531 0.445312 
+0.554688 0.519531 0.449219 
+0.558594 0.523438 0.457031 
+0.539062 0.511719 0.441406 
+0.539062 0.527344 0.441406 
+0.542969 0.523438 0.441406 
+0.542969 0.519531 0.445312 
+0.554688 0.527344 0.441406 
+0.550781 0.527344 0.445312 
+0.550781 0.523438 0.449219 
+0.554688 0.527344 0.457031 
+0.535156 0.511719 0.445312 
+0.535156 0.527344 0.445312 
+0.535156 0.523438 0.449219 
+0.539062 0.519531 0.449219 
+0.535156 0.527344 0.460938 
+0.539062 0.527344 0.457031 
+0.542969 0.523438 0.457031 
+0.550781 0.527344 0.460938 
+0.542969 0.539062 0.441406 
+0.558594 0.539062 0.441406 
+0.554688 0.542969 0.441406 
+0.550781 0.542969 0.445312 
+0.558594 0.554688 0.441406 
+0.558594 0.550781 0.445312 
+0.554688 0.550781 0.449219 
+0.558594 0.554688 0.457031 
+0.542969 0.535156 0.445312 
+0.558594 0.535156 0.445312 
+0.554688 0.535156 0.449219 
+0.550781 0.539062 0.449219 
+0.558594 0.535156 0.460938 
+0.558594 0.539062 0.457031 
+0.554688 0.542969 0.457031 
+0.558594 0.550781 0.460938 
+0.539062 0.535156 0.449219 
+0.539062 0.535156 0.464844 
+0.542969 0.535156 0.460938 
+0.542969 0.539062 0.457031 
+0.554688 0.535156 0.464844 
+0.550781 0.539062 0.464844 
+0.550781 0.542969 0.460938 
+0.554688 0.550781 0.464844 
+0.542969 0.539062 0.472656 
+0.558594 0.539062 0.472656 
+0.554688 0.542969 0.472656 
+0.550781 0.542969 0.476562 
+0.558594 0.554688 0.472656 
+0.558594 0.550781 0.476562 
+0.554688 0.550781 0.480469 
+0.558594 0.554688 0.488281 
+0.570312 0.503906 0.449219 
+0.570312 0.503906 0.464844 
+0.574219 0.503906 0.460938 
+0.574219 0.507812 0.457031 
+0.585938 0.503906 0.464844 
+0.582031 0.507812 0.464844 
+0.582031 0.511719 0.460938 
+0.585938 0.519531 0.464844 
+0.570312 0.503906 0.480469 
+0.570312 0.503906 0.496094 
+0.574219 0.503906 0.492188 
+0.574219 0.507812 0.488281 
+0.585938 0.503906 0.496094 
+0.582031 0.507812 0.496094 
+0.582031 0.511719 0.492188 
+0.585938 0.519531 0.496094 
+0.574219 0.503906 0.476562 
+0.589844 0.503906 0.476562 
+0.585938 0.503906 0.480469 
+0.582031 0.507812 0.480469 
+0.589844 0.503906 0.492188 
+0.589844 0.507812 0.488281 
+0.585938 0.511719 0.488281 
+0.589844 0.519531 0.492188 
+0.574219 0.507812 0.472656 
+0.589844 0.507812 0.472656 
+0.585938 0.511719 0.472656 
+0.582031 0.511719 0.476562 
+0.589844 0.523438 0.472656 
+0.589844 0.519531 0.476562 
+0.585938 0.519531 0.480469 
+0.589844 0.523438 0.488281 
+0.609375 0.507812 0.488281 
+0.609375 0.507812 0.496094 
+0.601562 0.511719 0.484375 
+0.601562 0.511719 0.496094 
+0.601562 0.515625 0.492188 
+0.601562 0.523438 0.496094 
+0.601562 0.515625 0.480469 
+0.601562 0.527344 0.480469 
+0.601562 0.523438 0.484375 
+0.601562 0.527344 0.492188 
+0.609375 0.539062 0.488281 
+0.609375 0.539062 0.496094 
+0.566406 0.507812 0.449219 
+0.566406 0.507812 0.464844 
+0.566406 0.511719 0.460938 
+0.570312 0.511719 0.457031 
+0.566406 0.523438 0.464844 
+0.570312 0.519531 0.464844 
+0.574219 0.519531 0.460938 
+0.582031 0.523438 0.464844 
+0.566406 0.507812 0.480469 
+0.566406 0.507812 0.496094 
+0.566406 0.511719 0.492188 
+0.570312 0.511719 0.488281 
+0.566406 0.523438 0.496094 
+0.570312 0.519531 0.496094 
+0.574219 0.519531 0.492188 
+0.582031 0.523438 0.496094 
+0.566406 0.511719 0.476562 
+0.566406 0.527344 0.476562 
+0.566406 0.523438 0.480469 
+0.570312 0.519531 0.480469 
+0.566406 0.527344 0.492188 
+0.570312 0.527344 0.488281 
+0.574219 0.523438 0.488281 
+0.582031 0.527344 0.492188 
+0.570312 0.511719 0.472656 
+0.570312 0.527344 0.472656 
+0.574219 0.523438 0.472656 
+0.574219 0.519531 0.476562 
+0.585938 0.527344 0.472656 
+0.582031 0.527344 0.476562 
+0.582031 0.523438 0.480469 
+0.585938 0.527344 0.488281 
+0.566406 0.539062 0.480469 
+0.566406 0.539062 0.496094 
+0.566406 0.542969 0.492188 
+0.570312 0.542969 0.488281 
+0.566406 0.554688 0.496094 
+0.570312 0.550781 0.496094 
+0.574219 0.550781 0.492188 
+0.582031 0.554688 0.496094 
+0.570312 0.535156 0.480469 
+0.570312 0.535156 0.496094 
+0.574219 0.535156 0.492188 
+0.574219 0.539062 0.488281 
+0.585938 0.535156 0.496094 
+0.582031 0.539062 0.496094 
+0.582031 0.542969 0.492188 
+0.585938 0.550781 0.496094 
+0.574219 0.535156 0.476562 
+0.589844 0.535156 0.476562 
+0.585938 0.535156 0.480469 
+0.582031 0.539062 0.480469 
+0.589844 0.535156 0.492188 
+0.589844 0.539062 0.488281 
+0.585938 0.542969 0.488281 
+0.589844 0.550781 0.492188 
+0.601562 0.542969 0.484375 
+0.601562 0.542969 0.496094 
+0.601562 0.546875 0.492188 
+0.601562 0.554688 0.496094 
+0.566406 0.511719 0.445312 
+0.566406 0.527344 0.445312 
+0.566406 0.523438 0.449219 
+0.570312 0.519531 0.449219 
+0.566406 0.527344 0.460938 
+0.570312 0.527344 0.457031 
+0.574219 0.523438 0.457031 
+0.582031 0.527344 0.460938 
+0.566406 0.542969 0.445312 
+0.566406 0.558594 0.460938 
+0.570312 0.558594 0.449219 
+0.566406 0.554688 0.453125 
+0.570312 0.550781 0.453125 
+0.574219 0.558594 0.457031 
+0.578125 0.554688 0.457031 
+0.566406 0.539062 0.449219 
+0.566406 0.539062 0.464844 
+0.566406 0.542969 0.460938 
+0.570312 0.542969 0.457031 
+0.566406 0.554688 0.464844 
+0.570312 0.550781 0.464844 
+0.574219 0.550781 0.460938 
+0.582031 0.554688 0.464844 
+0.570312 0.535156 0.449219 
+0.570312 0.535156 0.464844 
+0.574219 0.535156 0.460938 
+0.574219 0.539062 0.457031 
+0.585938 0.535156 0.464844 
+0.582031 0.539062 0.464844 
+0.582031 0.542969 0.460938 
+0.585938 0.550781 0.464844 
+0.566406 0.542969 0.476562 
+0.566406 0.558594 0.476562 
+0.566406 0.554688 0.480469 
+0.570312 0.550781 0.480469 
+0.566406 0.558594 0.492188 
+0.570312 0.558594 0.488281 
+0.574219 0.554688 0.488281 
+0.582031 0.558594 0.492188 
+0.570312 0.542969 0.472656 
+0.570312 0.558594 0.472656 
+0.574219 0.554688 0.472656 
+0.574219 0.550781 0.476562 
+0.585938 0.558594 0.472656 
+0.582031 0.558594 0.476562 
+0.582031 0.554688 0.480469 
+0.585938 0.558594 0.488281 
+0.574219 0.539062 0.472656 
+0.589844 0.539062 0.472656 
+0.585938 0.542969 0.472656 
+0.582031 0.542969 0.476562 
+0.589844 0.554688 0.472656 
+0.589844 0.550781 0.476562 
+0.585938 0.550781 0.480469 
+0.589844 0.554688 0.488281 
+0.601562 0.546875 0.480469 
+0.601562 0.558594 0.480469 
+0.601562 0.554688 0.484375 
+0.601562 0.558594 0.492188 
+0.503906 0.507812 0.398438 
+0.503906 0.519531 0.398438 
+0.507812 0.515625 0.398438 
+0.515625 0.519531 0.398438 
+0.503906 0.507812 0.417969 
+0.503906 0.507812 0.433594 
+0.503906 0.511719 0.429688 
+0.507812 0.511719 0.425781 
+0.503906 0.523438 0.433594 
+0.507812 0.519531 0.433594 
+0.511719 0.519531 0.429688 
+0.519531 0.523438 0.433594 
+0.503906 0.511719 0.414062 
+0.503906 0.527344 0.414062 
+0.503906 0.523438 0.417969 
+0.507812 0.519531 0.417969 
+0.503906 0.527344 0.429688 
+0.507812 0.527344 0.425781 
+0.511719 0.523438 0.425781 
+0.519531 0.527344 0.429688 
+0.507812 0.511719 0.410156 
+0.507812 0.527344 0.410156 
+0.511719 0.523438 0.410156 
+0.511719 0.519531 0.414062 
+0.523438 0.527344 0.410156 
+0.519531 0.527344 0.414062 
+0.519531 0.523438 0.417969 
+0.523438 0.527344 0.425781 
+0.503906 0.539062 0.417969 
+0.503906 0.539062 0.433594 
+0.503906 0.542969 0.429688 
+0.507812 0.542969 0.425781 
+0.503906 0.554688 0.433594 
+0.507812 0.550781 0.433594 
+0.511719 0.550781 0.429688 
+0.519531 0.554688 0.433594 
+0.507812 0.535156 0.417969 
+0.507812 0.535156 0.433594 
+0.511719 0.535156 0.429688 
+0.511719 0.539062 0.425781 
+0.523438 0.535156 0.433594 
+0.519531 0.539062 0.433594 
+0.519531 0.542969 0.429688 
+0.523438 0.550781 0.433594 
+0.511719 0.535156 0.414062 
+0.527344 0.535156 0.414062 
+0.523438 0.535156 0.417969 
+0.519531 0.539062 0.417969 
+0.527344 0.535156 0.429688 
+0.527344 0.539062 0.425781 
+0.523438 0.542969 0.425781 
+0.527344 0.550781 0.429688 
+0.535156 0.539062 0.417969 
+0.535156 0.539062 0.433594 
+0.535156 0.542969 0.429688 
+0.539062 0.542969 0.425781 
+0.535156 0.554688 0.433594 
+0.539062 0.550781 0.433594 
+0.542969 0.550781 0.429688 
+0.550781 0.554688 0.433594 
+0.503906 0.507812 0.449219 
+0.503906 0.507812 0.464844 
+0.503906 0.511719 0.460938 
+0.507812 0.511719 0.457031 
+0.503906 0.523438 0.464844 
+0.507812 0.519531 0.464844 
+0.511719 0.519531 0.460938 
+0.519531 0.523438 0.464844 
+0.503906 0.507812 0.480469 
+0.503906 0.507812 0.496094 
+0.503906 0.511719 0.492188 
+0.507812 0.511719 0.488281 
+0.503906 0.523438 0.496094 
+0.507812 0.519531 0.496094 
+0.511719 0.519531 0.492188 
+0.519531 0.523438 0.496094 
+0.503906 0.511719 0.476562 
+0.503906 0.527344 0.476562 
+0.503906 0.523438 0.480469 
+0.507812 0.519531 0.480469 
+0.503906 0.527344 0.492188 
+0.507812 0.527344 0.488281 
+0.511719 0.523438 0.488281 
+0.519531 0.527344 0.492188 
+0.507812 0.511719 0.472656 
+0.507812 0.527344 0.472656 
+0.511719 0.523438 0.472656 
+0.511719 0.519531 0.476562 
+0.523438 0.527344 0.472656 
+0.519531 0.527344 0.476562 
+0.519531 0.523438 0.480469 
+0.523438 0.527344 0.488281 
+0.503906 0.539062 0.480469 
+0.503906 0.539062 0.496094 
+0.503906 0.542969 0.492188 
+0.507812 0.542969 0.488281 
+0.503906 0.554688 0.496094 
+0.507812 0.550781 0.496094 
+0.511719 0.550781 0.492188 
+0.519531 0.554688 0.496094 
+0.507812 0.535156 0.480469 
+0.507812 0.535156 0.496094 
+0.511719 0.535156 0.492188 
+0.511719 0.539062 0.488281 
+0.523438 0.535156 0.496094 
+0.519531 0.539062 0.496094 
+0.519531 0.542969 0.492188 
+0.523438 0.550781 0.496094 
+0.511719 0.535156 0.476562 
+0.527344 0.535156 0.476562 
+0.523438 0.535156 0.480469 
+0.519531 0.539062 0.480469 
+0.527344 0.535156 0.492188 
+0.527344 0.539062 0.488281 
+0.523438 0.542969 0.488281 
+0.527344 0.550781 0.492188 
+0.535156 0.539062 0.480469 
+0.535156 0.539062 0.496094 
+0.535156 0.542969 0.492188 
+0.539062 0.542969 0.488281 
+0.535156 0.554688 0.496094 
+0.539062 0.550781 0.496094 
+0.542969 0.550781 0.492188 
+0.550781 0.554688 0.496094 
+0.503906 0.511719 0.445312 
+0.503906 0.527344 0.445312 
+0.503906 0.523438 0.449219 
+0.507812 0.519531 0.449219 
+0.503906 0.527344 0.460938 
+0.507812 0.527344 0.457031 
+0.511719 0.523438 0.457031 
+0.519531 0.527344 0.460938 
+0.503906 0.542969 0.445312 
+0.503906 0.558594 0.445312 
+0.503906 0.554688 0.449219 
+0.507812 0.550781 0.449219 
+0.503906 0.558594 0.460938 
+0.507812 0.558594 0.457031 
+0.511719 0.554688 0.457031 
+0.519531 0.558594 0.460938 
+0.503906 0.539062 0.449219 
+0.503906 0.539062 0.464844 
+0.503906 0.542969 0.460938 
+0.507812 0.542969 0.457031 
+0.503906 0.554688 0.464844 
+0.507812 0.550781 0.464844 
+0.511719 0.550781 0.460938 
+0.519531 0.554688 0.464844 
+0.507812 0.535156 0.449219 
+0.507812 0.535156 0.464844 
+0.511719 0.535156 0.460938 
+0.511719 0.539062 0.457031 
+0.523438 0.535156 0.464844 
+0.519531 0.539062 0.464844 
+0.519531 0.542969 0.460938 
+0.523438 0.550781 0.464844 
+0.503906 0.542969 0.476562 
+0.503906 0.558594 0.476562 
+0.503906 0.554688 0.480469 
+0.507812 0.550781 0.480469 
+0.503906 0.558594 0.492188 
+0.507812 0.558594 0.488281 
+0.511719 0.554688 0.488281 
+0.519531 0.558594 0.492188 
+0.507812 0.542969 0.472656 
+0.507812 0.558594 0.472656 
+0.511719 0.554688 0.472656 
+0.511719 0.550781 0.476562 
+0.523438 0.558594 0.472656 
+0.519531 0.558594 0.476562 
+0.519531 0.554688 0.480469 
+0.523438 0.558594 0.488281 
+0.511719 0.539062 0.472656 
+0.527344 0.539062 0.472656 
+0.523438 0.542969 0.472656 
+0.519531 0.542969 0.476562 
+0.527344 0.554688 0.472656 
+0.527344 0.550781 0.476562 
+0.523438 0.550781 0.480469 
+0.527344 0.554688 0.488281 
+0.535156 0.542969 0.476562 
+0.535156 0.558594 0.476562 
+0.535156 0.554688 0.480469 
+0.539062 0.550781 0.480469 
+0.535156 0.558594 0.492188 
+0.539062 0.558594 0.488281 
+0.542969 0.554688 0.488281 
+0.550781 0.558594 0.492188 
+0.507812 0.511719 0.441406 
+0.507812 0.527344 0.441406 
+0.511719 0.523438 0.441406 
+0.511719 0.519531 0.445312 
+0.523438 0.527344 0.441406 
+0.519531 0.527344 0.445312 
+0.519531 0.523438 0.449219 
+0.523438 0.527344 0.457031 
+0.507812 0.542969 0.441406 
+0.507812 0.558594 0.441406 
+0.511719 0.554688 0.441406 
+0.511719 0.550781 0.445312 
+0.523438 0.558594 0.441406 
+0.519531 0.558594 0.445312 
+0.519531 0.554688 0.449219 
+0.523438 0.558594 0.457031 
+0.511719 0.539062 0.441406 
+0.527344 0.539062 0.441406 
+0.523438 0.542969 0.441406 
+0.519531 0.542969 0.445312 
+0.527344 0.554688 0.441406 
+0.527344 0.550781 0.445312 
+0.523438 0.550781 0.449219 
+0.527344 0.554688 0.457031 
+0.511719 0.535156 0.445312 
+0.527344 0.535156 0.445312 
+0.523438 0.535156 0.449219 
+0.519531 0.539062 0.449219 
+0.527344 0.535156 0.460938 
+0.527344 0.539062 0.457031 
+0.523438 0.542969 0.457031 
+0.527344 0.550781 0.460938 
+0.539062 0.542969 0.441406 
+0.539062 0.558594 0.441406 
+0.542969 0.554688 0.441406 
+0.542969 0.550781 0.445312 
+0.554688 0.558594 0.441406 
+0.550781 0.558594 0.445312 
+0.550781 0.554688 0.449219 
+0.554688 0.558594 0.457031 
+0.535156 0.542969 0.445312 
+0.535156 0.558594 0.445312 
+0.535156 0.554688 0.449219 
+0.539062 0.550781 0.449219 
+0.535156 0.558594 0.460938 
+0.539062 0.558594 0.457031 
+0.542969 0.554688 0.457031 
+0.550781 0.558594 0.460938 
+0.535156 0.539062 0.449219 
+0.535156 0.539062 0.464844 
+0.535156 0.542969 0.460938 
+0.539062 0.542969 0.457031 
+0.535156 0.554688 0.464844 
+0.539062 0.550781 0.464844 
+0.542969 0.550781 0.460938 
+0.550781 0.554688 0.464844 
+0.539062 0.542969 0.472656 
+0.539062 0.558594 0.472656 
+0.542969 0.554688 0.472656 
+0.542969 0.550781 0.476562 
+0.554688 0.558594 0.472656 
+0.550781 0.558594 0.476562 
+0.550781 0.554688 0.480469 
+0.554688 0.558594 0.488281 
+0.503906 0.570312 0.449219 
+0.503906 0.570312 0.464844 
+0.503906 0.574219 0.460938 
+0.507812 0.574219 0.457031 
+0.503906 0.585938 0.464844 
+0.507812 0.582031 0.464844 
+0.511719 0.582031 0.460938 
+0.519531 0.585938 0.464844 
+0.503906 0.570312 0.480469 
+0.503906 0.570312 0.496094 
+0.503906 0.574219 0.492188 
+0.507812 0.574219 0.488281 
+0.503906 0.585938 0.496094 
+0.507812 0.582031 0.496094 
+0.511719 0.582031 0.492188 
+0.519531 0.585938 0.496094 
+0.503906 0.574219 0.476562 
+0.503906 0.589844 0.476562 
+0.503906 0.585938 0.480469 
+0.507812 0.582031 0.480469 
+0.503906 0.589844 0.492188 
+0.507812 0.589844 0.488281 
+0.511719 0.585938 0.488281 
+0.519531 0.589844 0.492188 
+0.507812 0.574219 0.472656 
+0.507812 0.589844 0.472656 
+0.511719 0.585938 0.472656 
+0.511719 0.582031 0.476562 
+0.523438 0.589844 0.472656 
+0.519531 0.589844 0.476562 
+0.519531 0.585938 0.480469 
+0.523438 0.589844 0.488281 
+0.507812 0.609375 0.488281 
+0.507812 0.609375 0.496094 
+0.511719 0.601562 0.484375 
+0.511719 0.601562 0.496094 
+0.515625 0.601562 0.492188 
+0.523438 0.601562 0.496094 
+0.515625 0.601562 0.480469 
+0.527344 0.601562 0.480469 
+0.523438 0.601562 0.484375 
+0.527344 0.601562 0.492188 
+0.539062 0.609375 0.488281 
+0.539062 0.609375 0.496094 
+0.507812 0.566406 0.449219 
+0.507812 0.566406 0.464844 
+0.511719 0.566406 0.460938 
+0.511719 0.570312 0.457031 
+0.523438 0.566406 0.464844 
+0.519531 0.570312 0.464844 
+0.519531 0.574219 0.460938 
+0.523438 0.582031 0.464844 
+0.507812 0.566406 0.480469 
+0.507812 0.566406 0.496094 
+0.511719 0.566406 0.492188 
+0.511719 0.570312 0.488281 
+0.523438 0.566406 0.496094 
+0.519531 0.570312 0.496094 
+0.519531 0.574219 0.492188 
+0.523438 0.582031 0.496094 
+0.511719 0.566406 0.476562 
+0.527344 0.566406 0.476562 
+0.523438 0.566406 0.480469 
+0.519531 0.570312 0.480469 
+0.527344 0.566406 0.492188 
+0.527344 0.570312 0.488281 
+0.523438 0.574219 0.488281 
+0.527344 0.582031 0.492188 
+0.511719 0.570312 0.472656 
+0.527344 0.570312 0.472656 
+0.523438 0.574219 0.472656 
+0.519531 0.574219 0.476562 
+0.527344 0.585938 0.472656 
+0.527344 0.582031 0.476562 
+0.523438 0.582031 0.480469 
+0.527344 0.585938 0.488281 
+0.539062 0.566406 0.480469 
+0.539062 0.566406 0.496094 
+0.542969 0.566406 0.492188 
+0.542969 0.570312 0.488281 
+0.554688 0.566406 0.496094 
+0.550781 0.570312 0.496094 
+0.550781 0.574219 0.492188 
+0.554688 0.582031 0.496094 
+0.535156 0.570312 0.480469 
+0.535156 0.570312 0.496094 
+0.535156 0.574219 0.492188 
+0.539062 0.574219 0.488281 
+0.535156 0.585938 0.496094 
+0.539062 0.582031 0.496094 
+0.542969 0.582031 0.492188 
+0.550781 0.585938 0.496094 
+0.535156 0.574219 0.476562 
+0.535156 0.589844 0.476562 
+0.535156 0.585938 0.480469 
+0.539062 0.582031 0.480469 
+0.535156 0.589844 0.492188 
+0.539062 0.589844 0.488281 
+0.542969 0.585938 0.488281 
+0.550781 0.589844 0.492188 
+0.542969 0.601562 0.484375 
+0.542969 0.601562 0.496094 
+0.546875 0.601562 0.492188 
+0.554688 0.601562 0.496094 
+0.511719 0.566406 0.445312 
+0.527344 0.566406 0.445312 
+0.523438 0.566406 0.449219 
+0.519531 0.570312 0.449219 
+0.527344 0.566406 0.460938 
+0.527344 0.570312 0.457031 
+0.523438 0.574219 0.457031 
+0.527344 0.582031 0.460938 
+0.542969 0.566406 0.445312 
+0.558594 0.566406 0.460938 
+0.558594 0.570312 0.449219 
+0.554688 0.566406 0.453125 
+0.550781 0.570312 0.453125 
+0.558594 0.574219 0.457031 
+0.554688 0.578125 0.457031 
+0.539062 0.566406 0.449219 
+0.539062 0.566406 0.464844 
+0.542969 0.566406 0.460938 
+0.542969 0.570312 0.457031 
+0.554688 0.566406 0.464844 
+0.550781 0.570312 0.464844 
+0.550781 0.574219 0.460938 
+0.554688 0.582031 0.464844 
+0.535156 0.570312 0.449219 
+0.535156 0.570312 0.464844 
+0.535156 0.574219 0.460938 
+0.539062 0.574219 0.457031 
+0.535156 0.585938 0.464844 
+0.539062 0.582031 0.464844 
+0.542969 0.582031 0.460938 
+0.550781 0.585938 0.464844 
+0.542969 0.566406 0.476562 
+0.558594 0.566406 0.476562 
+0.554688 0.566406 0.480469 
+0.550781 0.570312 0.480469 
+0.558594 0.566406 0.492188 
+0.558594 0.570312 0.488281 
+0.554688 0.574219 0.488281 
+0.558594 0.582031 0.492188 
+0.542969 0.570312 0.472656 
+0.558594 0.570312 0.472656 
+0.554688 0.574219 0.472656 
+0.550781 0.574219 0.476562 
+0.558594 0.585938 0.472656 
+0.558594 0.582031 0.476562 
+0.554688 0.582031 0.480469 
+0.558594 0.585938 0.488281 
+0.539062 0.574219 0.472656 
+0.539062 0.589844 0.472656 
+0.542969 0.585938 0.472656 
+0.542969 0.582031 0.476562 
+0.554688 0.589844 0.472656 
+0.550781 0.589844 0.476562 
+0.550781 0.585938 0.480469 
+0.554688 0.589844 0.488281 
+0.546875 0.601562 0.480469 
+0.558594 0.601562 0.480469 
+0.554688 0.601562 0.484375 
+0.558594 0.601562 0.492188 
+0.460938 0.390625 0.503906 
+0.460938 0.390625 0.511719 
+0.492188 0.390625 0.503906 
+0.492188 0.390625 0.511719 
+0.476562 0.398438 0.503906 
+0.488281 0.398438 0.503906 
+0.484375 0.398438 0.507812 
+0.488281 0.398438 0.515625 
+0.472656 0.398438 0.507812 
+0.472656 0.398438 0.519531 
+0.476562 0.398438 0.515625 
+0.484375 0.398438 0.519531 
+0.480469 0.414062 0.503906 
+0.496094 0.414062 0.503906 
+0.492188 0.417969 0.503906 
+0.488281 0.417969 0.507812 
+0.496094 0.429688 0.503906 
+0.496094 0.425781 0.507812 
+0.492188 0.425781 0.511719 
+0.496094 0.429688 0.519531 
+0.480469 0.410156 0.507812 
+0.496094 0.410156 0.507812 
+0.492188 0.410156 0.511719 
+0.488281 0.414062 0.511719 
+0.496094 0.410156 0.523438 
+0.496094 0.414062 0.519531 
+0.492188 0.417969 0.519531 
+0.496094 0.425781 0.523438 
+0.476562 0.410156 0.511719 
+0.476562 0.410156 0.527344 
+0.480469 0.410156 0.523438 
+0.480469 0.414062 0.519531 
+0.492188 0.410156 0.527344 
+0.488281 0.414062 0.527344 
+0.488281 0.417969 0.523438 
+0.492188 0.425781 0.527344 
+0.480469 0.414062 0.535156 
+0.496094 0.414062 0.535156 
+0.492188 0.417969 0.535156 
+0.488281 0.417969 0.539062 
+0.496094 0.429688 0.535156 
+0.496094 0.425781 0.539062 
+0.492188 0.425781 0.542969 
+0.496094 0.429688 0.550781 
+0.445312 0.398438 0.503906 
+0.457031 0.398438 0.503906 
+0.453125 0.398438 0.507812 
+0.457031 0.398438 0.515625 
+0.445312 0.417969 0.503906 
+0.445312 0.433594 0.503906 
+0.449219 0.429688 0.503906 
+0.449219 0.425781 0.507812 
+0.460938 0.433594 0.503906 
+0.457031 0.433594 0.507812 
+0.457031 0.429688 0.511719 
+0.460938 0.433594 0.519531 
+0.449219 0.414062 0.503906 
+0.464844 0.414062 0.503906 
+0.460938 0.417969 0.503906 
+0.457031 0.417969 0.507812 
+0.464844 0.429688 0.503906 
+0.464844 0.425781 0.507812 
+0.460938 0.425781 0.511719 
+0.464844 0.429688 0.519531 
+0.449219 0.410156 0.507812 
+0.464844 0.410156 0.507812 
+0.460938 0.410156 0.511719 
+0.457031 0.414062 0.511719 
+0.464844 0.410156 0.523438 
+0.464844 0.414062 0.519531 
+0.460938 0.417969 0.519531 
+0.464844 0.425781 0.523438 
+0.476562 0.417969 0.503906 
+0.476562 0.433594 0.503906 
+0.480469 0.429688 0.503906 
+0.480469 0.425781 0.507812 
+0.492188 0.433594 0.503906 
+0.488281 0.433594 0.507812 
+0.488281 0.429688 0.511719 
+0.492188 0.433594 0.519531 
+0.472656 0.417969 0.507812 
+0.472656 0.433594 0.507812 
+0.472656 0.429688 0.511719 
+0.476562 0.425781 0.511719 
+0.472656 0.433594 0.523438 
+0.476562 0.433594 0.519531 
+0.480469 0.429688 0.519531 
+0.488281 0.433594 0.523438 
+0.472656 0.414062 0.511719 
+0.472656 0.414062 0.527344 
+0.472656 0.417969 0.523438 
+0.476562 0.417969 0.519531 
+0.472656 0.429688 0.527344 
+0.476562 0.425781 0.527344 
+0.480469 0.425781 0.523438 
+0.488281 0.429688 0.527344 
+0.476562 0.417969 0.535156 
+0.476562 0.433594 0.535156 
+0.480469 0.429688 0.535156 
+0.480469 0.425781 0.539062 
+0.492188 0.433594 0.535156 
+0.488281 0.433594 0.539062 
+0.488281 0.429688 0.542969 
+0.492188 0.433594 0.550781 
+0.441406 0.398438 0.507812 
+0.441406 0.398438 0.519531 
+0.445312 0.398438 0.515625 
+0.453125 0.398438 0.519531 
+0.441406 0.417969 0.507812 
+0.441406 0.433594 0.507812 
+0.441406 0.429688 0.511719 
+0.445312 0.425781 0.511719 
+0.441406 0.433594 0.523438 
+0.445312 0.433594 0.519531 
+0.449219 0.429688 0.519531 
+0.457031 0.433594 0.523438 
+0.441406 0.414062 0.511719 
+0.441406 0.414062 0.527344 
+0.441406 0.417969 0.523438 
+0.445312 0.417969 0.519531 
+0.441406 0.429688 0.527344 
+0.445312 0.425781 0.527344 
+0.449219 0.425781 0.523438 
+0.457031 0.429688 0.527344 
+0.445312 0.410156 0.511719 
+0.445312 0.410156 0.527344 
+0.449219 0.410156 0.523438 
+0.449219 0.414062 0.519531 
+0.460938 0.410156 0.527344 
+0.457031 0.414062 0.527344 
+0.457031 0.417969 0.523438 
+0.460938 0.425781 0.527344 
+0.441406 0.433594 0.539062 
+0.457031 0.433594 0.554688 
+0.441406 0.421875 0.542969 
+0.445312 0.429688 0.550781 
+0.441406 0.433594 0.550781 
+0.445312 0.433594 0.546875 
+0.449219 0.429688 0.546875 
+0.445312 0.417969 0.535156 
+0.445312 0.433594 0.535156 
+0.449219 0.429688 0.535156 
+0.449219 0.425781 0.539062 
+0.460938 0.433594 0.535156 
+0.457031 0.433594 0.539062 
+0.457031 0.429688 0.542969 
+0.460938 0.433594 0.550781 
+0.449219 0.414062 0.535156 
+0.464844 0.414062 0.535156 
+0.460938 0.417969 0.535156 
+0.457031 0.417969 0.539062 
+0.464844 0.429688 0.535156 
+0.464844 0.425781 0.539062 
+0.460938 0.425781 0.542969 
+0.464844 0.429688 0.550781 
+0.472656 0.417969 0.539062 
+0.472656 0.433594 0.539062 
+0.472656 0.429688 0.542969 
+0.476562 0.425781 0.542969 
+0.472656 0.433594 0.554688 
+0.476562 0.433594 0.550781 
+0.480469 0.429688 0.550781 
+0.488281 0.433594 0.554688 
+0.449219 0.445312 0.503906 
+0.464844 0.445312 0.503906 
+0.460938 0.449219 0.503906 
+0.457031 0.449219 0.507812 
+0.464844 0.460938 0.503906 
+0.464844 0.457031 0.507812 
+0.460938 0.457031 0.511719 
+0.464844 0.460938 0.519531 
+0.480469 0.445312 0.503906 
+0.496094 0.445312 0.503906 
+0.492188 0.449219 0.503906 
+0.488281 0.449219 0.507812 
+0.496094 0.460938 0.503906 
+0.496094 0.457031 0.507812 
+0.492188 0.457031 0.511719 
+0.496094 0.460938 0.519531 
+0.476562 0.449219 0.503906 
+0.476562 0.464844 0.503906 
+0.480469 0.460938 0.503906 
+0.480469 0.457031 0.507812 
+0.492188 0.464844 0.503906 
+0.488281 0.464844 0.507812 
+0.488281 0.460938 0.511719 
+0.492188 0.464844 0.519531 
+0.472656 0.449219 0.507812 
+0.472656 0.464844 0.507812 
+0.472656 0.460938 0.511719 
+0.476562 0.457031 0.511719 
+0.472656 0.464844 0.523438 
+0.476562 0.464844 0.519531 
+0.480469 0.460938 0.519531 
+0.488281 0.464844 0.523438 
+0.480469 0.476562 0.503906 
+0.496094 0.476562 0.503906 
+0.492188 0.480469 0.503906 
+0.488281 0.480469 0.507812 
+0.496094 0.492188 0.503906 
+0.496094 0.488281 0.507812 
+0.492188 0.488281 0.511719 
+0.496094 0.492188 0.519531 
+0.480469 0.472656 0.507812 
+0.496094 0.472656 0.507812 
+0.492188 0.472656 0.511719 
+0.488281 0.476562 0.511719 
+0.496094 0.472656 0.523438 
+0.496094 0.476562 0.519531 
+0.492188 0.480469 0.519531 
+0.496094 0.488281 0.523438 
+0.476562 0.472656 0.511719 
+0.476562 0.472656 0.527344 
+0.480469 0.472656 0.523438 
+0.480469 0.476562 0.519531 
+0.492188 0.472656 0.527344 
+0.488281 0.476562 0.527344 
+0.488281 0.480469 0.523438 
+0.492188 0.488281 0.527344 
+0.480469 0.476562 0.535156 
+0.496094 0.476562 0.535156 
+0.492188 0.480469 0.535156 
+0.488281 0.480469 0.539062 
+0.496094 0.492188 0.535156 
+0.496094 0.488281 0.539062 
+0.492188 0.488281 0.542969 
+0.496094 0.492188 0.550781 
+0.449219 0.441406 0.507812 
+0.464844 0.441406 0.507812 
+0.460938 0.441406 0.511719 
+0.457031 0.445312 0.511719 
+0.464844 0.441406 0.523438 
+0.464844 0.445312 0.519531 
+0.460938 0.449219 0.519531 
+0.464844 0.457031 0.523438 
+0.480469 0.441406 0.507812 
+0.496094 0.441406 0.507812 
+0.492188 0.441406 0.511719 
+0.488281 0.445312 0.511719 
+0.496094 0.441406 0.523438 
+0.496094 0.445312 0.519531 
+0.492188 0.449219 0.519531 
+0.496094 0.457031 0.523438 
+0.476562 0.441406 0.511719 
+0.476562 0.441406 0.527344 
+0.480469 0.441406 0.523438 
+0.480469 0.445312 0.519531 
+0.492188 0.441406 0.527344 
+0.488281 0.445312 0.527344 
+0.488281 0.449219 0.523438 
+0.492188 0.457031 0.527344 
+0.472656 0.445312 0.511719 
+0.472656 0.445312 0.527344 
+0.472656 0.449219 0.523438 
+0.476562 0.449219 0.519531 
+0.472656 0.460938 0.527344 
+0.476562 0.457031 0.527344 
+0.480469 0.457031 0.523438 
+0.488281 0.460938 0.527344 
+0.480469 0.441406 0.539062 
+0.496094 0.441406 0.539062 
+0.492188 0.441406 0.542969 
+0.488281 0.445312 0.542969 
+0.496094 0.441406 0.554688 
+0.496094 0.445312 0.550781 
+0.492188 0.449219 0.550781 
+0.496094 0.457031 0.554688 
+0.480469 0.445312 0.535156 
+0.496094 0.445312 0.535156 
+0.492188 0.449219 0.535156 
+0.488281 0.449219 0.539062 
+0.496094 0.460938 0.535156 
+0.496094 0.457031 0.539062 
+0.492188 0.457031 0.542969 
+0.496094 0.460938 0.550781 
+0.476562 0.449219 0.535156 
+0.476562 0.464844 0.535156 
+0.480469 0.460938 0.535156 
+0.480469 0.457031 0.539062 
+0.492188 0.464844 0.535156 
+0.488281 0.464844 0.539062 
+0.488281 0.460938 0.542969 
+0.492188 0.464844 0.550781 
+0.480469 0.472656 0.539062 
+0.496094 0.472656 0.539062 
+0.492188 0.472656 0.542969 
+0.488281 0.476562 0.542969 
+0.496094 0.472656 0.554688 
+0.496094 0.476562 0.550781 
+0.492188 0.480469 0.550781 
+0.496094 0.488281 0.554688 
+0.445312 0.441406 0.511719 
+0.445312 0.441406 0.527344 
+0.449219 0.441406 0.523438 
+0.449219 0.445312 0.519531 
+0.460938 0.441406 0.527344 
+0.457031 0.445312 0.527344 
+0.457031 0.449219 0.523438 
+0.460938 0.457031 0.527344 
+0.445312 0.441406 0.542969 
+0.445312 0.441406 0.558594 
+0.449219 0.441406 0.554688 
+0.449219 0.445312 0.550781 
+0.460938 0.441406 0.558594 
+0.457031 0.445312 0.558594 
+0.457031 0.449219 0.554688 
+0.460938 0.457031 0.558594 
+0.449219 0.441406 0.539062 
+0.464844 0.441406 0.539062 
+0.460938 0.441406 0.542969 
+0.457031 0.445312 0.542969 
+0.464844 0.441406 0.554688 
+0.464844 0.445312 0.550781 
+0.460938 0.449219 0.550781 
+0.464844 0.457031 0.554688 
+0.449219 0.445312 0.535156 
+0.464844 0.445312 0.535156 
+0.460938 0.449219 0.535156 
+0.457031 0.449219 0.539062 
+0.464844 0.460938 0.535156 
+0.464844 0.457031 0.539062 
+0.460938 0.457031 0.542969 
+0.464844 0.460938 0.550781 
+0.476562 0.441406 0.542969 
+0.476562 0.441406 0.558594 
+0.480469 0.441406 0.554688 
+0.480469 0.445312 0.550781 
+0.492188 0.441406 0.558594 
+0.488281 0.445312 0.558594 
+0.488281 0.449219 0.554688 
+0.492188 0.457031 0.558594 
+0.472656 0.445312 0.542969 
+0.472656 0.445312 0.558594 
+0.472656 0.449219 0.554688 
+0.476562 0.449219 0.550781 
+0.472656 0.460938 0.558594 
+0.476562 0.457031 0.558594 
+0.480469 0.457031 0.554688 
+0.488281 0.460938 0.558594 
+0.472656 0.449219 0.539062 
+0.472656 0.464844 0.539062 
+0.472656 0.460938 0.542969 
+0.476562 0.457031 0.542969 
+0.472656 0.464844 0.554688 
+0.476562 0.464844 0.550781 
+0.480469 0.460938 0.550781 
+0.488281 0.464844 0.554688 
+0.476562 0.472656 0.542969 
+0.476562 0.472656 0.558594 
+0.480469 0.472656 0.554688 
+0.480469 0.476562 0.550781 
+0.492188 0.472656 0.558594 
+0.488281 0.476562 0.558594 
+0.488281 0.480469 0.554688 
+0.492188 0.488281 0.558594 
+0.449219 0.445312 0.566406 
+0.464844 0.445312 0.566406 
+0.460938 0.449219 0.566406 
+0.457031 0.449219 0.570312 
+0.464844 0.460938 0.566406 
+0.464844 0.457031 0.570312 
+0.460938 0.457031 0.574219 
+0.464844 0.460938 0.582031 
+0.480469 0.445312 0.566406 
+0.496094 0.445312 0.566406 
+0.492188 0.449219 0.566406 
+0.488281 0.449219 0.570312 
+0.496094 0.460938 0.566406 
+0.496094 0.457031 0.570312 
+0.492188 0.457031 0.574219 
+0.496094 0.460938 0.582031 
+0.476562 0.449219 0.566406 
+0.476562 0.464844 0.566406 
+0.480469 0.460938 0.566406 
+0.480469 0.457031 0.570312 
+0.492188 0.464844 0.566406 
+0.488281 0.464844 0.570312 
+0.488281 0.460938 0.574219 
+0.492188 0.464844 0.582031 
+0.472656 0.449219 0.570312 
+0.472656 0.464844 0.570312 
+0.472656 0.460938 0.574219 
+0.476562 0.457031 0.574219 
+0.472656 0.464844 0.585938 
+0.476562 0.464844 0.582031 
+0.480469 0.460938 0.582031 
+0.488281 0.464844 0.585938 
+0.480469 0.476562 0.566406 
+0.496094 0.476562 0.566406 
+0.492188 0.480469 0.566406 
+0.488281 0.480469 0.570312 
+0.496094 0.492188 0.566406 
+0.496094 0.488281 0.570312 
+0.492188 0.488281 0.574219 
+0.496094 0.492188 0.582031 
+0.480469 0.472656 0.570312 
+0.496094 0.472656 0.570312 
+0.492188 0.472656 0.574219 
+0.488281 0.476562 0.574219 
+0.496094 0.472656 0.585938 
+0.496094 0.476562 0.582031 
+0.492188 0.480469 0.582031 
+0.496094 0.488281 0.585938 
+0.476562 0.472656 0.574219 
+0.476562 0.472656 0.589844 
+0.480469 0.472656 0.585938 
+0.480469 0.476562 0.582031 
+0.492188 0.472656 0.589844 
+0.488281 0.476562 0.589844 
+0.488281 0.480469 0.585938 
+0.492188 0.488281 0.589844 
+0.484375 0.480469 0.601562 
+0.496094 0.480469 0.601562 
+0.492188 0.484375 0.601562 
+0.496094 0.492188 0.601562 
+0.390625 0.460938 0.503906 
+0.390625 0.460938 0.511719 
+0.390625 0.492188 0.503906 
+0.390625 0.492188 0.511719 
+0.398438 0.476562 0.503906 
+0.398438 0.488281 0.503906 
+0.398438 0.484375 0.507812 
+0.398438 0.488281 0.515625 
+0.398438 0.472656 0.507812 
+0.398438 0.472656 0.519531 
+0.398438 0.476562 0.515625 
+0.398438 0.484375 0.519531 
+0.414062 0.480469 0.503906 
+0.414062 0.496094 0.503906 
+0.417969 0.492188 0.503906 
+0.417969 0.488281 0.507812 
+0.429688 0.496094 0.503906 
+0.425781 0.496094 0.507812 
+0.425781 0.492188 0.511719 
+0.429688 0.496094 0.519531 
+0.410156 0.480469 0.507812 
+0.410156 0.496094 0.507812 
+0.410156 0.492188 0.511719 
+0.414062 0.488281 0.511719 
+0.410156 0.496094 0.523438 
+0.414062 0.496094 0.519531 
+0.417969 0.492188 0.519531 
+0.425781 0.496094 0.523438 
+0.410156 0.476562 0.511719 
+0.410156 0.476562 0.527344 
+0.410156 0.480469 0.523438 
+0.414062 0.480469 0.519531 
+0.410156 0.492188 0.527344 
+0.414062 0.488281 0.527344 
+0.417969 0.488281 0.523438 
+0.425781 0.492188 0.527344 
+0.414062 0.480469 0.535156 
+0.414062 0.496094 0.535156 
+0.417969 0.492188 0.535156 
+0.417969 0.488281 0.539062 
+0.429688 0.496094 0.535156 
+0.425781 0.496094 0.539062 
+0.425781 0.492188 0.542969 
+0.429688 0.496094 0.550781 
+0.398438 0.445312 0.503906 
+0.398438 0.457031 0.503906 
+0.398438 0.453125 0.507812 
+0.398438 0.457031 0.515625 
+0.417969 0.445312 0.503906 
+0.433594 0.445312 0.503906 
+0.429688 0.449219 0.503906 
+0.425781 0.449219 0.507812 
+0.433594 0.460938 0.503906 
+0.433594 0.457031 0.507812 
+0.429688 0.457031 0.511719 
+0.433594 0.460938 0.519531 
+0.414062 0.449219 0.503906 
+0.414062 0.464844 0.503906 
+0.417969 0.460938 0.503906 
+0.417969 0.457031 0.507812 
+0.429688 0.464844 0.503906 
+0.425781 0.464844 0.507812 
+0.425781 0.460938 0.511719 
+0.429688 0.464844 0.519531 
+0.410156 0.449219 0.507812 
+0.410156 0.464844 0.507812 
+0.410156 0.460938 0.511719 
+0.414062 0.457031 0.511719 
+0.410156 0.464844 0.523438 
+0.414062 0.464844 0.519531 
+0.417969 0.460938 0.519531 
+0.425781 0.464844 0.523438 
+0.417969 0.476562 0.503906 
+0.433594 0.476562 0.503906 
+0.429688 0.480469 0.503906 
+0.425781 0.480469 0.507812 
+0.433594 0.492188 0.503906 
+0.433594 0.488281 0.507812 
+0.429688 0.488281 0.511719 
+0.433594 0.492188 0.519531 
+0.417969 0.472656 0.507812 
+0.433594 0.472656 0.507812 
+0.429688 0.472656 0.511719 
+0.425781 0.476562 0.511719 
+0.433594 0.472656 0.523438 
+0.433594 0.476562 0.519531 
+0.429688 0.480469 0.519531 
+0.433594 0.488281 0.523438 
+0.414062 0.472656 0.511719 
+0.414062 0.472656 0.527344 
+0.417969 0.472656 0.523438 
+0.417969 0.476562 0.519531 
+0.429688 0.472656 0.527344 
+0.425781 0.476562 0.527344 
+0.425781 0.480469 0.523438 
+0.429688 0.488281 0.527344 
+0.417969 0.476562 0.535156 
+0.433594 0.476562 0.535156 
+0.429688 0.480469 0.535156 
+0.425781 0.480469 0.539062 
+0.433594 0.492188 0.535156 
+0.433594 0.488281 0.539062 
+0.429688 0.488281 0.542969 
+0.433594 0.492188 0.550781 
+0.398438 0.441406 0.507812 
+0.398438 0.441406 0.519531 
+0.398438 0.445312 0.515625 
+0.398438 0.453125 0.519531 
+0.417969 0.441406 0.507812 
+0.433594 0.441406 0.507812 
+0.429688 0.441406 0.511719 
+0.425781 0.445312 0.511719 
+0.433594 0.441406 0.523438 
+0.433594 0.445312 0.519531 
+0.429688 0.449219 0.519531 
+0.433594 0.457031 0.523438 
+0.414062 0.441406 0.511719 
+0.414062 0.441406 0.527344 
+0.417969 0.441406 0.523438 
+0.417969 0.445312 0.519531 
+0.429688 0.441406 0.527344 
+0.425781 0.445312 0.527344 
+0.425781 0.449219 0.523438 
+0.429688 0.457031 0.527344 
+0.410156 0.445312 0.511719 
+0.410156 0.445312 0.527344 
+0.410156 0.449219 0.523438 
+0.414062 0.449219 0.519531 
+0.410156 0.460938 0.527344 
+0.414062 0.457031 0.527344 
+0.417969 0.457031 0.523438 
+0.425781 0.460938 0.527344 
+0.433594 0.441406 0.539062 
+0.433594 0.457031 0.554688 
+0.421875 0.441406 0.542969 
+0.429688 0.445312 0.550781 
+0.433594 0.441406 0.550781 
+0.433594 0.445312 0.546875 
+0.429688 0.449219 0.546875 
+0.417969 0.445312 0.535156 
+0.433594 0.445312 0.535156 
+0.429688 0.449219 0.535156 
+0.425781 0.449219 0.539062 
+0.433594 0.460938 0.535156 
+0.433594 0.457031 0.539062 
+0.429688 0.457031 0.542969 
+0.433594 0.460938 0.550781 
+0.414062 0.449219 0.535156 
+0.414062 0.464844 0.535156 
+0.417969 0.460938 0.535156 
+0.417969 0.457031 0.539062 
+0.429688 0.464844 0.535156 
+0.425781 0.464844 0.539062 
+0.425781 0.460938 0.542969 
+0.429688 0.464844 0.550781 
+0.417969 0.472656 0.539062 
+0.433594 0.472656 0.539062 
+0.429688 0.472656 0.542969 
+0.425781 0.476562 0.542969 
+0.433594 0.472656 0.554688 
+0.433594 0.476562 0.550781 
+0.429688 0.480469 0.550781 
+0.433594 0.488281 0.554688 
+0.445312 0.449219 0.503906 
+0.445312 0.464844 0.503906 
+0.449219 0.460938 0.503906 
+0.449219 0.457031 0.507812 
+0.460938 0.464844 0.503906 
+0.457031 0.464844 0.507812 
+0.457031 0.460938 0.511719 
+0.460938 0.464844 0.519531 
+0.445312 0.480469 0.503906 
+0.445312 0.496094 0.503906 
+0.449219 0.492188 0.503906 
+0.449219 0.488281 0.507812 
+0.460938 0.496094 0.503906 
+0.457031 0.496094 0.507812 
+0.457031 0.492188 0.511719 
+0.460938 0.496094 0.519531 
+0.449219 0.476562 0.503906 
+0.464844 0.476562 0.503906 
+0.460938 0.480469 0.503906 
+0.457031 0.480469 0.507812 
+0.464844 0.492188 0.503906 
+0.464844 0.488281 0.507812 
+0.460938 0.488281 0.511719 
+0.464844 0.492188 0.519531 
+0.449219 0.472656 0.507812 
+0.464844 0.472656 0.507812 
+0.460938 0.472656 0.511719 
+0.457031 0.476562 0.511719 
+0.464844 0.472656 0.523438 
+0.464844 0.476562 0.519531 
+0.460938 0.480469 0.519531 
+0.464844 0.488281 0.523438 
+0.476562 0.480469 0.503906 
+0.476562 0.496094 0.503906 
+0.480469 0.492188 0.503906 
+0.480469 0.488281 0.507812 
+0.492188 0.496094 0.503906 
+0.488281 0.496094 0.507812 
+0.488281 0.492188 0.511719 
+0.492188 0.496094 0.519531 
+0.472656 0.480469 0.507812 
+0.472656 0.496094 0.507812 
+0.472656 0.492188 0.511719 
+0.476562 0.488281 0.511719 
+0.472656 0.496094 0.523438 
+0.476562 0.496094 0.519531 
+0.480469 0.492188 0.519531 
+0.488281 0.496094 0.523438 
+0.472656 0.476562 0.511719 
+0.472656 0.476562 0.527344 
+0.472656 0.480469 0.523438 
+0.476562 0.480469 0.519531 
+0.472656 0.492188 0.527344 
+0.476562 0.488281 0.527344 
+0.480469 0.488281 0.523438 
+0.488281 0.492188 0.527344 
+0.476562 0.480469 0.535156 
+0.476562 0.496094 0.535156 
+0.480469 0.492188 0.535156 
+0.480469 0.488281 0.539062 
+0.492188 0.496094 0.535156 
+0.488281 0.496094 0.539062 
+0.488281 0.492188 0.542969 
+0.492188 0.496094 0.550781 
+0.441406 0.449219 0.507812 
+0.441406 0.464844 0.507812 
+0.441406 0.460938 0.511719 
+0.445312 0.457031 0.511719 
+0.441406 0.464844 0.523438 
+0.445312 0.464844 0.519531 
+0.449219 0.460938 0.519531 
+0.457031 0.464844 0.523438 
+0.441406 0.480469 0.507812 
+0.441406 0.496094 0.507812 
+0.441406 0.492188 0.511719 
+0.445312 0.488281 0.511719 
+0.441406 0.496094 0.523438 
+0.445312 0.496094 0.519531 
+0.449219 0.492188 0.519531 
+0.457031 0.496094 0.523438 
+0.441406 0.476562 0.511719 
+0.441406 0.476562 0.527344 
+0.441406 0.480469 0.523438 
+0.445312 0.480469 0.519531 
+0.441406 0.492188 0.527344 
+0.445312 0.488281 0.527344 
+0.449219 0.488281 0.523438 
+0.457031 0.492188 0.527344 
+0.445312 0.472656 0.511719 
+0.445312 0.472656 0.527344 
+0.449219 0.472656 0.523438 
+0.449219 0.476562 0.519531 
+0.460938 0.472656 0.527344 
+0.457031 0.476562 0.527344 
+0.457031 0.480469 0.523438 
+0.460938 0.488281 0.527344 
+0.441406 0.480469 0.539062 
+0.441406 0.496094 0.539062 
+0.441406 0.492188 0.542969 
+0.445312 0.488281 0.542969 
+0.441406 0.496094 0.554688 
+0.445312 0.496094 0.550781 
+0.449219 0.492188 0.550781 
+0.457031 0.496094 0.554688 
+0.445312 0.480469 0.535156 
+0.445312 0.496094 0.535156 
+0.449219 0.492188 0.535156 
+0.449219 0.488281 0.539062 
+0.460938 0.496094 0.535156 
+0.457031 0.496094 0.539062 
+0.457031 0.492188 0.542969 
+0.460938 0.496094 0.550781 
+0.449219 0.476562 0.535156 
+0.464844 0.476562 0.535156 
+0.460938 0.480469 0.535156 
+0.457031 0.480469 0.539062 
+0.464844 0.492188 0.535156 
+0.464844 0.488281 0.539062 
+0.460938 0.488281 0.542969 
+0.464844 0.492188 0.550781 
+0.472656 0.480469 0.539062 
+0.472656 0.496094 0.539062 
+0.472656 0.492188 0.542969 
+0.476562 0.488281 0.542969 
+0.472656 0.496094 0.554688 
+0.476562 0.496094 0.550781 
+0.480469 0.492188 0.550781 
+0.488281 0.496094 0.554688 
+0.441406 0.445312 0.511719 
+0.441406 0.445312 0.527344 
+0.441406 0.449219 0.523438 
+0.445312 0.449219 0.519531 
+0.441406 0.460938 0.527344 
+0.445312 0.457031 0.527344 
+0.449219 0.457031 0.523438 
+0.457031 0.460938 0.527344 
+0.441406 0.445312 0.542969 
+0.441406 0.445312 0.558594 
+0.441406 0.449219 0.554688 
+0.445312 0.449219 0.550781 
+0.441406 0.460938 0.558594 
+0.445312 0.457031 0.558594 
+0.449219 0.457031 0.554688 
+0.457031 0.460938 0.558594 
+0.441406 0.449219 0.539062 
+0.441406 0.464844 0.539062 
+0.441406 0.460938 0.542969 
+0.445312 0.457031 0.542969 
+0.441406 0.464844 0.554688 
+0.445312 0.464844 0.550781 
+0.449219 0.460938 0.550781 
+0.457031 0.464844 0.554688 
+0.445312 0.449219 0.535156 
+0.445312 0.464844 0.535156 
+0.449219 0.460938 0.535156 
+0.449219 0.457031 0.539062 
+0.460938 0.464844 0.535156 
+0.457031 0.464844 0.539062 
+0.457031 0.460938 0.542969 
+0.460938 0.464844 0.550781 
+0.441406 0.476562 0.542969 
+0.441406 0.476562 0.558594 
+0.441406 0.480469 0.554688 
+0.445312 0.480469 0.550781 
+0.441406 0.492188 0.558594 
+0.445312 0.488281 0.558594 
+0.449219 0.488281 0.554688 
+0.457031 0.492188 0.558594 
+0.445312 0.472656 0.542969 
+0.445312 0.472656 0.558594 
+0.449219 0.472656 0.554688 
+0.449219 0.476562 0.550781 
+0.460938 0.472656 0.558594 
+0.457031 0.476562 0.558594 
+0.457031 0.480469 0.554688 
+0.460938 0.488281 0.558594 
+0.449219 0.472656 0.539062 
+0.464844 0.472656 0.539062 
+0.460938 0.472656 0.542969 
+0.457031 0.476562 0.542969 
+0.464844 0.472656 0.554688 
+0.464844 0.476562 0.550781 
+0.460938 0.480469 0.550781 
+0.464844 0.488281 0.554688 
+0.472656 0.476562 0.542969 
+0.472656 0.476562 0.558594 
+0.472656 0.480469 0.554688 
+0.476562 0.480469 0.550781 
+0.472656 0.492188 0.558594 
+0.476562 0.488281 0.558594 
+0.480469 0.488281 0.554688 
+0.488281 0.492188 0.558594 
+0.445312 0.449219 0.566406 
+0.445312 0.464844 0.566406 
+0.449219 0.460938 0.566406 
+0.449219 0.457031 0.570312 
+0.460938 0.464844 0.566406 
+0.457031 0.464844 0.570312 
+0.457031 0.460938 0.574219 
+0.460938 0.464844 0.582031 
+0.445312 0.480469 0.566406 
+0.445312 0.496094 0.566406 
+0.449219 0.492188 0.566406 
+0.449219 0.488281 0.570312 
+0.460938 0.496094 0.566406 
+0.457031 0.496094 0.570312 
+0.457031 0.492188 0.574219 
+0.460938 0.496094 0.582031 
+0.449219 0.476562 0.566406 
+0.464844 0.476562 0.566406 
+0.460938 0.480469 0.566406 
+0.457031 0.480469 0.570312 
+0.464844 0.492188 0.566406 
+0.464844 0.488281 0.570312 
+0.460938 0.488281 0.574219 
+0.464844 0.492188 0.582031 
+0.449219 0.472656 0.570312 
+0.464844 0.472656 0.570312 
+0.460938 0.472656 0.574219 
+0.457031 0.476562 0.574219 
+0.464844 0.472656 0.585938 
+0.464844 0.476562 0.582031 
+0.460938 0.480469 0.582031 
+0.464844 0.488281 0.585938 
+0.476562 0.480469 0.566406 
+0.476562 0.496094 0.566406 
+0.480469 0.492188 0.566406 
+0.480469 0.488281 0.570312 
+0.492188 0.496094 0.566406 
+0.488281 0.496094 0.570312 
+0.488281 0.492188 0.574219 
+0.492188 0.496094 0.582031 
+0.472656 0.480469 0.570312 
+0.472656 0.496094 0.570312 
+0.472656 0.492188 0.574219 
+0.476562 0.488281 0.574219 
+0.472656 0.496094 0.585938 
+0.476562 0.496094 0.582031 
+0.480469 0.492188 0.582031 
+0.488281 0.496094 0.585938 
+0.472656 0.476562 0.574219 
+0.472656 0.476562 0.589844 
+0.472656 0.480469 0.585938 
+0.476562 0.480469 0.582031 
+0.472656 0.492188 0.589844 
+0.476562 0.488281 0.589844 
+0.480469 0.488281 0.585938 
+0.488281 0.492188 0.589844 
+0.480469 0.484375 0.601562 
+0.480469 0.496094 0.601562 
+0.484375 0.492188 0.601562 
+0.492188 0.496094 0.601562 
+0.507812 0.398438 0.503906 
+0.519531 0.398438 0.503906 
+0.515625 0.398438 0.507812 
+0.519531 0.398438 0.515625 
+0.507812 0.417969 0.503906 
+0.507812 0.433594 0.503906 
+0.511719 0.429688 0.503906 
+0.511719 0.425781 0.507812 
+0.523438 0.433594 0.503906 
+0.519531 0.433594 0.507812 
+0.519531 0.429688 0.511719 
+0.523438 0.433594 0.519531 
+0.511719 0.414062 0.503906 
+0.527344 0.414062 0.503906 
+0.523438 0.417969 0.503906 
+0.519531 0.417969 0.507812 
+0.527344 0.429688 0.503906 
+0.527344 0.425781 0.507812 
+0.523438 0.425781 0.511719 
+0.527344 0.429688 0.519531 
+0.511719 0.410156 0.507812 
+0.527344 0.410156 0.507812 
+0.523438 0.410156 0.511719 
+0.519531 0.414062 0.511719 
+0.527344 0.410156 0.523438 
+0.527344 0.414062 0.519531 
+0.523438 0.417969 0.519531 
+0.527344 0.425781 0.523438 
+0.539062 0.417969 0.503906 
+0.539062 0.433594 0.503906 
+0.542969 0.429688 0.503906 
+0.542969 0.425781 0.507812 
+0.554688 0.433594 0.503906 
+0.550781 0.433594 0.507812 
+0.550781 0.429688 0.511719 
+0.554688 0.433594 0.519531 
+0.535156 0.417969 0.507812 
+0.535156 0.433594 0.507812 
+0.535156 0.429688 0.511719 
+0.539062 0.425781 0.511719 
+0.535156 0.433594 0.523438 
+0.539062 0.433594 0.519531 
+0.542969 0.429688 0.519531 
+0.550781 0.433594 0.523438 
+0.535156 0.414062 0.511719 
+0.535156 0.414062 0.527344 
+0.535156 0.417969 0.523438 
+0.539062 0.417969 0.519531 
+0.535156 0.429688 0.527344 
+0.539062 0.425781 0.527344 
+0.542969 0.425781 0.523438 
+0.550781 0.429688 0.527344 
+0.539062 0.417969 0.535156 
+0.539062 0.433594 0.535156 
+0.542969 0.429688 0.535156 
+0.542969 0.425781 0.539062 
+0.554688 0.433594 0.535156 
+0.550781 0.433594 0.539062 
+0.550781 0.429688 0.542969 
+0.554688 0.433594 0.550781 
+0.507812 0.449219 0.503906 
+0.507812 0.464844 0.503906 
+0.511719 0.460938 0.503906 
+0.511719 0.457031 0.507812 
+0.523438 0.464844 0.503906 
+0.519531 0.464844 0.507812 
+0.519531 0.460938 0.511719 
+0.523438 0.464844 0.519531 
+0.507812 0.480469 0.503906 
+0.507812 0.496094 0.503906 
+0.511719 0.492188 0.503906 
+0.511719 0.488281 0.507812 
+0.523438 0.496094 0.503906 
+0.519531 0.496094 0.507812 
+0.519531 0.492188 0.511719 
+0.523438 0.496094 0.519531 
+0.511719 0.476562 0.503906 
+0.527344 0.476562 0.503906 
+0.523438 0.480469 0.503906 
+0.519531 0.480469 0.507812 
+0.527344 0.492188 0.503906 
+0.527344 0.488281 0.507812 
+0.523438 0.488281 0.511719 
+0.527344 0.492188 0.519531 
+0.511719 0.472656 0.507812 
+0.527344 0.472656 0.507812 
+0.523438 0.472656 0.511719 
+0.519531 0.476562 0.511719 
+0.527344 0.472656 0.523438 
+0.527344 0.476562 0.519531 
+0.523438 0.480469 0.519531 
+0.527344 0.488281 0.523438 
+0.539062 0.480469 0.503906 
+0.539062 0.496094 0.503906 
+0.542969 0.492188 0.503906 
+0.542969 0.488281 0.507812 
+0.554688 0.496094 0.503906 
+0.550781 0.496094 0.507812 
+0.550781 0.492188 0.511719 
+0.554688 0.496094 0.519531 
+0.535156 0.480469 0.507812 
+0.535156 0.496094 0.507812 
+0.535156 0.492188 0.511719 
+0.539062 0.488281 0.511719 
+0.535156 0.496094 0.523438 
+0.539062 0.496094 0.519531 
+0.542969 0.492188 0.519531 
+0.550781 0.496094 0.523438 
+0.535156 0.476562 0.511719 
+0.535156 0.476562 0.527344 
+0.535156 0.480469 0.523438 
+0.539062 0.480469 0.519531 
+0.535156 0.492188 0.527344 
+0.539062 0.488281 0.527344 
+0.542969 0.488281 0.523438 
+0.550781 0.492188 0.527344 
+0.539062 0.480469 0.535156 
+0.539062 0.496094 0.535156 
+0.542969 0.492188 0.535156 
+0.542969 0.488281 0.539062 
+0.554688 0.496094 0.535156 
+0.550781 0.496094 0.539062 
+0.550781 0.492188 0.542969 
+0.554688 0.496094 0.550781 
+0.511719 0.445312 0.503906 
+0.527344 0.445312 0.503906 
+0.523438 0.449219 0.503906 
+0.519531 0.449219 0.507812 
+0.527344 0.460938 0.503906 
+0.527344 0.457031 0.507812 
+0.523438 0.457031 0.511719 
+0.527344 0.460938 0.519531 
+0.542969 0.445312 0.503906 
+0.558594 0.445312 0.503906 
+0.554688 0.449219 0.503906 
+0.550781 0.449219 0.507812 
+0.558594 0.460938 0.503906 
+0.558594 0.457031 0.507812 
+0.554688 0.457031 0.511719 
+0.558594 0.460938 0.519531 
+0.539062 0.449219 0.503906 
+0.539062 0.464844 0.503906 
+0.542969 0.460938 0.503906 
+0.542969 0.457031 0.507812 
+0.554688 0.464844 0.503906 
+0.550781 0.464844 0.507812 
+0.550781 0.460938 0.511719 
+0.554688 0.464844 0.519531 
+0.535156 0.449219 0.507812 
+0.535156 0.464844 0.507812 
+0.535156 0.460938 0.511719 
+0.539062 0.457031 0.511719 
+0.535156 0.464844 0.523438 
+0.539062 0.464844 0.519531 
+0.542969 0.460938 0.519531 
+0.550781 0.464844 0.523438 
+0.542969 0.476562 0.503906 
+0.558594 0.476562 0.503906 
+0.554688 0.480469 0.503906 
+0.550781 0.480469 0.507812 
+0.558594 0.492188 0.503906 
+0.558594 0.488281 0.507812 
+0.554688 0.488281 0.511719 
+0.558594 0.492188 0.519531 
+0.542969 0.472656 0.507812 
+0.558594 0.472656 0.507812 
+0.554688 0.472656 0.511719 
+0.550781 0.476562 0.511719 
+0.558594 0.472656 0.523438 
+0.558594 0.476562 0.519531 
+0.554688 0.480469 0.519531 
+0.558594 0.488281 0.523438 
+0.539062 0.472656 0.511719 
+0.539062 0.472656 0.527344 
+0.542969 0.472656 0.523438 
+0.542969 0.476562 0.519531 
+0.554688 0.472656 0.527344 
+0.550781 0.476562 0.527344 
+0.550781 0.480469 0.523438 
+0.554688 0.488281 0.527344 
+0.542969 0.476562 0.535156 
+0.558594 0.476562 0.535156 
+0.554688 0.480469 0.535156 
+0.550781 0.480469 0.539062 
+0.558594 0.492188 0.535156 
+0.558594 0.488281 0.539062 
+0.554688 0.488281 0.542969 
+0.558594 0.492188 0.550781 
+0.511719 0.441406 0.507812 
+0.527344 0.441406 0.507812 
+0.523438 0.441406 0.511719 
+0.519531 0.445312 0.511719 
+0.527344 0.441406 0.523438 
+0.527344 0.445312 0.519531 
+0.523438 0.449219 0.519531 
+0.527344 0.457031 0.523438 
+0.542969 0.441406 0.507812 
+0.558594 0.441406 0.507812 
+0.554688 0.441406 0.511719 
+0.550781 0.445312 0.511719 
+0.558594 0.441406 0.523438 
+0.558594 0.445312 0.519531 
+0.554688 0.449219 0.519531 
+0.558594 0.457031 0.523438 
+0.539062 0.441406 0.511719 
+0.539062 0.441406 0.527344 
+0.542969 0.441406 0.523438 
+0.542969 0.445312 0.519531 
+0.554688 0.441406 0.527344 
+0.550781 0.445312 0.527344 
+0.550781 0.449219 0.523438 
+0.554688 0.457031 0.527344 
+0.535156 0.445312 0.511719 
+0.535156 0.445312 0.527344 
+0.535156 0.449219 0.523438 
+0.539062 0.449219 0.519531 
+0.535156 0.460938 0.527344 
+0.539062 0.457031 0.527344 
+0.542969 0.457031 0.523438 
+0.550781 0.460938 0.527344 
+0.542969 0.441406 0.539062 
+0.558594 0.441406 0.539062 
+0.554688 0.441406 0.542969 
+0.550781 0.445312 0.542969 
+0.558594 0.441406 0.554688 
+0.558594 0.445312 0.550781 
+0.554688 0.449219 0.550781 
+0.558594 0.457031 0.554688 
+0.542969 0.445312 0.535156 
+0.558594 0.445312 0.535156 
+0.554688 0.449219 0.535156 
+0.550781 0.449219 0.539062 
+0.558594 0.460938 0.535156 
+0.558594 0.457031 0.539062 
+0.554688 0.457031 0.542969 
+0.558594 0.460938 0.550781 
+0.539062 0.449219 0.535156 
+0.539062 0.464844 0.535156 
+0.542969 0.460938 0.535156 
+0.542969 0.457031 0.539062 
+0.554688 0.464844 0.535156 
+0.550781 0.464844 0.539062 
+0.550781 0.460938 0.542969 
+0.554688 0.464844 0.550781 
+0.542969 0.472656 0.539062 
+0.558594 0.472656 0.539062 
+0.554688 0.472656 0.542969 
+0.550781 0.476562 0.542969 
+0.558594 0.472656 0.554688 
+0.558594 0.476562 0.550781 
+0.554688 0.480469 0.550781 
+0.558594 0.488281 0.554688 
+0.570312 0.449219 0.503906 
+0.570312 0.464844 0.503906 
+0.574219 0.460938 0.503906 
+0.574219 0.457031 0.507812 
+0.585938 0.464844 0.503906 
+0.582031 0.464844 0.507812 
+0.582031 0.460938 0.511719 
+0.585938 0.464844 0.519531 
+0.570312 0.480469 0.503906 
+0.570312 0.496094 0.503906 
+0.574219 0.492188 0.503906 
+0.574219 0.488281 0.507812 
+0.585938 0.496094 0.503906 
+0.582031 0.496094 0.507812 
+0.582031 0.492188 0.511719 
+0.585938 0.496094 0.519531 
+0.574219 0.476562 0.503906 
+0.589844 0.476562 0.503906 
+0.585938 0.480469 0.503906 
+0.582031 0.480469 0.507812 
+0.589844 0.492188 0.503906 
+0.589844 0.488281 0.507812 
+0.585938 0.488281 0.511719 
+0.589844 0.492188 0.519531 
+0.574219 0.472656 0.507812 
+0.589844 0.472656 0.507812 
+0.585938 0.472656 0.511719 
+0.582031 0.476562 0.511719 
+0.589844 0.472656 0.523438 
+0.589844 0.476562 0.519531 
+0.585938 0.480469 0.519531 
+0.589844 0.488281 0.523438 
+0.609375 0.488281 0.507812 
+0.609375 0.496094 0.507812 
+0.601562 0.484375 0.511719 
+0.601562 0.496094 0.511719 
+0.601562 0.492188 0.515625 
+0.601562 0.496094 0.523438 
+0.601562 0.480469 0.515625 
+0.601562 0.480469 0.527344 
+0.601562 0.484375 0.523438 
+0.601562 0.492188 0.527344 
+0.609375 0.488281 0.539062 
+0.609375 0.496094 0.539062 
+0.566406 0.449219 0.507812 
+0.566406 0.464844 0.507812 
+0.566406 0.460938 0.511719 
+0.570312 0.457031 0.511719 
+0.566406 0.464844 0.523438 
+0.570312 0.464844 0.519531 
+0.574219 0.460938 0.519531 
+0.582031 0.464844 0.523438 
+0.566406 0.480469 0.507812 
+0.566406 0.496094 0.507812 
+0.566406 0.492188 0.511719 
+0.570312 0.488281 0.511719 
+0.566406 0.496094 0.523438 
+0.570312 0.496094 0.519531 
+0.574219 0.492188 0.519531 
+0.582031 0.496094 0.523438 
+0.566406 0.476562 0.511719 
+0.566406 0.476562 0.527344 
+0.566406 0.480469 0.523438 
+0.570312 0.480469 0.519531 
+0.566406 0.492188 0.527344 
+0.570312 0.488281 0.527344 
+0.574219 0.488281 0.523438 
+0.582031 0.492188 0.527344 
+0.570312 0.472656 0.511719 
+0.570312 0.472656 0.527344 
+0.574219 0.472656 0.523438 
+0.574219 0.476562 0.519531 
+0.585938 0.472656 0.527344 
+0.582031 0.476562 0.527344 
+0.582031 0.480469 0.523438 
+0.585938 0.488281 0.527344 
+0.566406 0.480469 0.539062 
+0.566406 0.496094 0.539062 
+0.566406 0.492188 0.542969 
+0.570312 0.488281 0.542969 
+0.566406 0.496094 0.554688 
+0.570312 0.496094 0.550781 
+0.574219 0.492188 0.550781 
+0.582031 0.496094 0.554688 
+0.570312 0.480469 0.535156 
+0.570312 0.496094 0.535156 
+0.574219 0.492188 0.535156 
+0.574219 0.488281 0.539062 
+0.585938 0.496094 0.535156 
+0.582031 0.496094 0.539062 
+0.582031 0.492188 0.542969 
+0.585938 0.496094 0.550781 
+0.574219 0.476562 0.535156 
+0.589844 0.476562 0.535156 
+0.585938 0.480469 0.535156 
+0.582031 0.480469 0.539062 
+0.589844 0.492188 0.535156 
+0.589844 0.488281 0.539062 
+0.585938 0.488281 0.542969 
+0.589844 0.492188 0.550781 
+0.601562 0.484375 0.542969 
+0.601562 0.496094 0.542969 
+0.601562 0.492188 0.546875 
+0.601562 0.496094 0.554688 
+0.566406 0.445312 0.511719 
+0.566406 0.445312 0.527344 
+0.566406 0.449219 0.523438 
+0.570312 0.449219 0.519531 
+0.566406 0.460938 0.527344 
+0.570312 0.457031 0.527344 
+0.574219 0.457031 0.523438 
+0.582031 0.460938 0.527344 
+0.566406 0.445312 0.542969 
+0.566406 0.460938 0.558594 
+0.570312 0.449219 0.558594 
+0.566406 0.453125 0.554688 
+0.570312 0.453125 0.550781 
+0.574219 0.457031 0.558594 
+0.578125 0.457031 0.554688 
+0.566406 0.449219 0.539062 
+0.566406 0.464844 0.539062 
+0.566406 0.460938 0.542969 
+0.570312 0.457031 0.542969 
+0.566406 0.464844 0.554688 
+0.570312 0.464844 0.550781 
+0.574219 0.460938 0.550781 
+0.582031 0.464844 0.554688 
+0.570312 0.449219 0.535156 
+0.570312 0.464844 0.535156 
+0.574219 0.460938 0.535156 
+0.574219 0.457031 0.539062 
+0.585938 0.464844 0.535156 
+0.582031 0.464844 0.539062 
+0.582031 0.460938 0.542969 
+0.585938 0.464844 0.550781 
+0.566406 0.476562 0.542969 
+0.566406 0.476562 0.558594 
+0.566406 0.480469 0.554688 
+0.570312 0.480469 0.550781 
+0.566406 0.492188 0.558594 
+0.570312 0.488281 0.558594 
+0.574219 0.488281 0.554688 
+0.582031 0.492188 0.558594 
+0.570312 0.472656 0.542969 
+0.570312 0.472656 0.558594 
+0.574219 0.472656 0.554688 
+0.574219 0.476562 0.550781 
+0.585938 0.472656 0.558594 
+0.582031 0.476562 0.558594 
+0.582031 0.480469 0.554688 
+0.585938 0.488281 0.558594 
+0.574219 0.472656 0.539062 
+0.589844 0.472656 0.539062 
+0.585938 0.472656 0.542969 
+0.582031 0.476562 0.542969 
+0.589844 0.472656 0.554688 
+0.589844 0.476562 0.550781 
+0.585938 0.480469 0.550781 
+0.589844 0.488281 0.554688 
+0.601562 0.480469 0.546875 
+0.601562 0.480469 0.558594 
+0.601562 0.484375 0.554688 
+0.601562 0.492188 0.558594 
+0.503906 0.398438 0.507812 
+0.503906 0.398438 0.519531 
+0.507812 0.398438 0.515625 
+0.515625 0.398438 0.519531 
+0.503906 0.417969 0.507812 
+0.503906 0.433594 0.507812 
+0.503906 0.429688 0.511719 
+0.507812 0.425781 0.511719 
+0.503906 0.433594 0.523438 
+0.507812 0.433594 0.519531 
+0.511719 0.429688 0.519531 
+0.519531 0.433594 0.523438 
+0.503906 0.414062 0.511719 
+0.503906 0.414062 0.527344 
+0.503906 0.417969 0.523438 
+0.507812 0.417969 0.519531 
+0.503906 0.429688 0.527344 
+0.507812 0.425781 0.527344 
+0.511719 0.425781 0.523438 
+0.519531 0.429688 0.527344 
+0.507812 0.410156 0.511719 
+0.507812 0.410156 0.527344 
+0.511719 0.410156 0.523438 
+0.511719 0.414062 0.519531 
+0.523438 0.410156 0.527344 
+0.519531 0.414062 0.527344 
+0.519531 0.417969 0.523438 
+0.523438 0.425781 0.527344 
+0.503906 0.417969 0.539062 
+0.503906 0.433594 0.539062 
+0.503906 0.429688 0.542969 
+0.507812 0.425781 0.542969 
+0.503906 0.433594 0.554688 
+0.507812 0.433594 0.550781 
+0.511719 0.429688 0.550781 
+0.519531 0.433594 0.554688 
+0.507812 0.417969 0.535156 
+0.507812 0.433594 0.535156 
+0.511719 0.429688 0.535156 
+0.511719 0.425781 0.539062 
+0.523438 0.433594 0.535156 
+0.519531 0.433594 0.539062 
+0.519531 0.429688 0.542969 
+0.523438 0.433594 0.550781 
+0.511719 0.414062 0.535156 
+0.527344 0.414062 0.535156 
+0.523438 0.417969 0.535156 
+0.519531 0.417969 0.539062 
+0.527344 0.429688 0.535156 
+0.527344 0.425781 0.539062 
+0.523438 0.425781 0.542969 
+0.527344 0.429688 0.550781 
+0.535156 0.417969 0.539062 
+0.535156 0.433594 0.539062 
+0.535156 0.429688 0.542969 
+0.539062 0.425781 0.542969 
+0.535156 0.433594 0.554688 
+0.539062 0.433594 0.550781 
+0.542969 0.429688 0.550781 
+0.550781 0.433594 0.554688 
+0.503906 0.449219 0.507812 
+0.503906 0.464844 0.507812 
+0.503906 0.460938 0.511719 
+0.507812 0.457031 0.511719 
+0.503906 0.464844 0.523438 
+0.507812 0.464844 0.519531 
+0.511719 0.460938 0.519531 
+0.519531 0.464844 0.523438 
+0.503906 0.480469 0.507812 
+0.503906 0.496094 0.507812 
+0.503906 0.492188 0.511719 
+0.507812 0.488281 0.511719 
+0.503906 0.496094 0.523438 
+0.507812 0.496094 0.519531 
+0.511719 0.492188 0.519531 
+0.519531 0.496094 0.523438 
+0.503906 0.476562 0.511719 
+0.503906 0.476562 0.527344 
+0.503906 0.480469 0.523438 
+0.507812 0.480469 0.519531 
+0.503906 0.492188 0.527344 
+0.507812 0.488281 0.527344 
+0.511719 0.488281 0.523438 
+0.519531 0.492188 0.527344 
+0.507812 0.472656 0.511719 
+0.507812 0.472656 0.527344 
+0.511719 0.472656 0.523438 
+0.511719 0.476562 0.519531 
+0.523438 0.472656 0.527344 
+0.519531 0.476562 0.527344 
+0.519531 0.480469 0.523438 
+0.523438 0.488281 0.527344 
+0.503906 0.480469 0.539062 
+0.503906 0.496094 0.539062 
+0.503906 0.492188 0.542969 
+0.507812 0.488281 0.542969 
+0.503906 0.496094 0.554688 
+0.507812 0.496094 0.550781 
+0.511719 0.492188 0.550781 
+0.519531 0.496094 0.554688 
+0.507812 0.480469 0.535156 
+0.507812 0.496094 0.535156 
+0.511719 0.492188 0.535156 
+0.511719 0.488281 0.539062 
+0.523438 0.496094 0.535156 
+0.519531 0.496094 0.539062 
+0.519531 0.492188 0.542969 
+0.523438 0.496094 0.550781 
+0.511719 0.476562 0.535156 
+0.527344 0.476562 0.535156 
+0.523438 0.480469 0.535156 
+0.519531 0.480469 0.539062 
+0.527344 0.492188 0.535156 
+0.527344 0.488281 0.539062 
+0.523438 0.488281 0.542969 
+0.527344 0.492188 0.550781 
+0.535156 0.480469 0.539062 
+0.535156 0.496094 0.539062 
+0.535156 0.492188 0.542969 
+0.539062 0.488281 0.542969 
+0.535156 0.496094 0.554688 
+0.539062 0.496094 0.550781 
+0.542969 0.492188 0.550781 
+0.550781 0.496094 0.554688 
+0.503906 0.445312 0.511719 
+0.503906 0.445312 0.527344 
+0.503906 0.449219 0.523438 
+0.507812 0.449219 0.519531 
+0.503906 0.460938 0.527344 
+0.507812 0.457031 0.527344 
+0.511719 0.457031 0.523438 
+0.519531 0.460938 0.527344 
+0.503906 0.445312 0.542969 
+0.503906 0.445312 0.558594 
+0.503906 0.449219 0.554688 
+0.507812 0.449219 0.550781 
+0.503906 0.460938 0.558594 
+0.507812 0.457031 0.558594 
+0.511719 0.457031 0.554688 
+0.519531 0.460938 0.558594 
+0.503906 0.449219 0.539062 
+0.503906 0.464844 0.539062 
+0.503906 0.460938 0.542969 
+0.507812 0.457031 0.542969 
+0.503906 0.464844 0.554688 
+0.507812 0.464844 0.550781 
+0.511719 0.460938 0.550781 
+0.519531 0.464844 0.554688 
+0.507812 0.449219 0.535156 
+0.507812 0.464844 0.535156 
+0.511719 0.460938 0.535156 
+0.511719 0.457031 0.539062 
+0.523438 0.464844 0.535156 
+0.519531 0.464844 0.539062 
+0.519531 0.460938 0.542969 
+0.523438 0.464844 0.550781 
+0.503906 0.476562 0.542969 
+0.503906 0.476562 0.558594 
+0.503906 0.480469 0.554688 
+0.507812 0.480469 0.550781 
+0.503906 0.492188 0.558594 
+0.507812 0.488281 0.558594 
+0.511719 0.488281 0.554688 
+0.519531 0.492188 0.558594 
+0.507812 0.472656 0.542969 
+0.507812 0.472656 0.558594 
+0.511719 0.472656 0.554688 
+0.511719 0.476562 0.550781 
+0.523438 0.472656 0.558594 
+0.519531 0.476562 0.558594 
+0.519531 0.480469 0.554688 
+0.523438 0.488281 0.558594 
+0.511719 0.472656 0.539062 
+0.527344 0.472656 0.539062 
+0.523438 0.472656 0.542969 
+0.519531 0.476562 0.542969 
+0.527344 0.472656 0.554688 
+0.527344 0.476562 0.550781 
+0.523438 0.480469 0.550781 
+0.527344 0.488281 0.554688 
+0.535156 0.476562 0.542969 
+0.535156 0.476562 0.558594 
+0.535156 0.480469 0.554688 
+0.539062 0.480469 0.550781 
+0.535156 0.492188 0.558594 
+0.539062 0.488281 0.558594 
+0.542969 0.488281 0.554688 
+0.550781 0.492188 0.558594 
+0.507812 0.441406 0.511719 
+0.507812 0.441406 0.527344 
+0.511719 0.441406 0.523438 
+0.511719 0.445312 0.519531 
+0.523438 0.441406 0.527344 
+0.519531 0.445312 0.527344 
+0.519531 0.449219 0.523438 
+0.523438 0.457031 0.527344 
+0.507812 0.441406 0.542969 
+0.507812 0.441406 0.558594 
+0.511719 0.441406 0.554688 
+0.511719 0.445312 0.550781 
+0.523438 0.441406 0.558594 
+0.519531 0.445312 0.558594 
+0.519531 0.449219 0.554688 
+0.523438 0.457031 0.558594 
+0.511719 0.441406 0.539062 
+0.527344 0.441406 0.539062 
+0.523438 0.441406 0.542969 
+0.519531 0.445312 0.542969 
+0.527344 0.441406 0.554688 
+0.527344 0.445312 0.550781 
+0.523438 0.449219 0.550781 
+0.527344 0.457031 0.554688 
+0.511719 0.445312 0.535156 
+0.527344 0.445312 0.535156 
+0.523438 0.449219 0.535156 
+0.519531 0.449219 0.539062 
+0.527344 0.460938 0.535156 
+0.527344 0.457031 0.539062 
+0.523438 0.457031 0.542969 
+0.527344 0.460938 0.550781 
+0.539062 0.441406 0.542969 
+0.539062 0.441406 0.558594 
+0.542969 0.441406 0.554688 
+0.542969 0.445312 0.550781 
+0.554688 0.441406 0.558594 
+0.550781 0.445312 0.558594 
+0.550781 0.449219 0.554688 
+0.554688 0.457031 0.558594 
+0.535156 0.445312 0.542969 
+0.535156 0.445312 0.558594 
+0.535156 0.449219 0.554688 
+0.539062 0.449219 0.550781 
+0.535156 0.460938 0.558594 
+0.539062 0.457031 0.558594 
+0.542969 0.457031 0.554688 
+0.550781 0.460938 0.558594 
+0.535156 0.449219 0.539062 
+0.535156 0.464844 0.539062 
+0.535156 0.460938 0.542969 
+0.539062 0.457031 0.542969 
+0.535156 0.464844 0.554688 
+0.539062 0.464844 0.550781 
+0.542969 0.460938 0.550781 
+0.550781 0.464844 0.554688 
+0.539062 0.472656 0.542969 
+0.539062 0.472656 0.558594 
+0.542969 0.472656 0.554688 
+0.542969 0.476562 0.550781 
+0.554688 0.472656 0.558594 
+0.550781 0.476562 0.558594 
+0.550781 0.480469 0.554688 
+0.554688 0.488281 0.558594 
+0.503906 0.449219 0.570312 
+0.503906 0.464844 0.570312 
+0.503906 0.460938 0.574219 
+0.507812 0.457031 0.574219 
+0.503906 0.464844 0.585938 
+0.507812 0.464844 0.582031 
+0.511719 0.460938 0.582031 
+0.519531 0.464844 0.585938 
+0.503906 0.480469 0.570312 
+0.503906 0.496094 0.570312 
+0.503906 0.492188 0.574219 
+0.507812 0.488281 0.574219 
+0.503906 0.496094 0.585938 
+0.507812 0.496094 0.582031 
+0.511719 0.492188 0.582031 
+0.519531 0.496094 0.585938 
+0.503906 0.476562 0.574219 
+0.503906 0.476562 0.589844 
+0.503906 0.480469 0.585938 
+0.507812 0.480469 0.582031 
+0.503906 0.492188 0.589844 
+0.507812 0.488281 0.589844 
+0.511719 0.488281 0.585938 
+0.519531 0.492188 0.589844 
+0.507812 0.472656 0.574219 
+0.507812 0.472656 0.589844 
+0.511719 0.472656 0.585938 
+0.511719 0.476562 0.582031 
+0.523438 0.472656 0.589844 
+0.519531 0.476562 0.589844 
+0.519531 0.480469 0.585938 
+0.523438 0.488281 0.589844 
+0.507812 0.488281 0.609375 
+0.507812 0.496094 0.609375 
+0.511719 0.484375 0.601562 
+0.511719 0.496094 0.601562 
+0.515625 0.492188 0.601562 
+0.523438 0.496094 0.601562 
+0.515625 0.480469 0.601562 
+0.527344 0.480469 0.601562 
+0.523438 0.484375 0.601562 
+0.527344 0.492188 0.601562 
+0.539062 0.488281 0.609375 
+0.539062 0.496094 0.609375 
+0.507812 0.449219 0.566406 
+0.507812 0.464844 0.566406 
+0.511719 0.460938 0.566406 
+0.511719 0.457031 0.570312 
+0.523438 0.464844 0.566406 
+0.519531 0.464844 0.570312 
+0.519531 0.460938 0.574219 
+0.523438 0.464844 0.582031 
+0.507812 0.480469 0.566406 
+0.507812 0.496094 0.566406 
+0.511719 0.492188 0.566406 
+0.511719 0.488281 0.570312 
+0.523438 0.496094 0.566406 
+0.519531 0.496094 0.570312 
+0.519531 0.492188 0.574219 
+0.523438 0.496094 0.582031 
+0.511719 0.476562 0.566406 
+0.527344 0.476562 0.566406 
+0.523438 0.480469 0.566406 
+0.519531 0.480469 0.570312 
+0.527344 0.492188 0.566406 
+0.527344 0.488281 0.570312 
+0.523438 0.488281 0.574219 
+0.527344 0.492188 0.582031 
+0.511719 0.472656 0.570312 
+0.527344 0.472656 0.570312 
+0.523438 0.472656 0.574219 
+0.519531 0.476562 0.574219 
+0.527344 0.472656 0.585938 
+0.527344 0.476562 0.582031 
+0.523438 0.480469 0.582031 
+0.527344 0.488281 0.585938 
+0.539062 0.480469 0.566406 
+0.539062 0.496094 0.566406 
+0.542969 0.492188 0.566406 
+0.542969 0.488281 0.570312 
+0.554688 0.496094 0.566406 
+0.550781 0.496094 0.570312 
+0.550781 0.492188 0.574219 
+0.554688 0.496094 0.582031 
+0.535156 0.480469 0.570312 
+0.535156 0.496094 0.570312 
+0.535156 0.492188 0.574219 
+0.539062 0.488281 0.574219 
+0.535156 0.496094 0.585938 
+0.539062 0.496094 0.582031 
+0.542969 0.492188 0.582031 
+0.550781 0.496094 0.585938 
+0.535156 0.476562 0.574219 
+0.535156 0.476562 0.589844 
+0.535156 0.480469 0.585938 
+0.539062 0.480469 0.582031 
+0.535156 0.492188 0.589844 
+0.539062 0.488281 0.589844 
+0.542969 0.488281 0.585938 
+0.550781 0.492188 0.589844 
+0.542969 0.484375 0.601562 
+0.542969 0.496094 0.601562 
+0.546875 0.492188 0.601562 
+0.554688 0.496094 0.601562 
+0.511719 0.445312 0.566406 
+0.527344 0.445312 0.566406 
+0.523438 0.449219 0.566406 
+0.519531 0.449219 0.570312 
+0.527344 0.460938 0.566406 
+0.527344 0.457031 0.570312 
+0.523438 0.457031 0.574219 
+0.527344 0.460938 0.582031 
+0.542969 0.445312 0.566406 
+0.558594 0.460938 0.566406 
+0.558594 0.449219 0.570312 
+0.554688 0.453125 0.566406 
+0.550781 0.453125 0.570312 
+0.558594 0.457031 0.574219 
+0.554688 0.457031 0.578125 
+0.539062 0.449219 0.566406 
+0.539062 0.464844 0.566406 
+0.542969 0.460938 0.566406 
+0.542969 0.457031 0.570312 
+0.554688 0.464844 0.566406 
+0.550781 0.464844 0.570312 
+0.550781 0.460938 0.574219 
+0.554688 0.464844 0.582031 
+0.535156 0.449219 0.570312 
+0.535156 0.464844 0.570312 
+0.535156 0.460938 0.574219 
+0.539062 0.457031 0.574219 
+0.535156 0.464844 0.585938 
+0.539062 0.464844 0.582031 
+0.542969 0.460938 0.582031 
+0.550781 0.464844 0.585938 
+0.542969 0.476562 0.566406 
+0.558594 0.476562 0.566406 
+0.554688 0.480469 0.566406 
+0.550781 0.480469 0.570312 
+0.558594 0.492188 0.566406 
+0.558594 0.488281 0.570312 
+0.554688 0.488281 0.574219 
+0.558594 0.492188 0.582031 
+0.542969 0.472656 0.570312 
+0.558594 0.472656 0.570312 
+0.554688 0.472656 0.574219 
+0.550781 0.476562 0.574219 
+0.558594 0.472656 0.585938 
+0.558594 0.476562 0.582031 
+0.554688 0.480469 0.582031 
+0.558594 0.488281 0.585938 
+0.539062 0.472656 0.574219 
+0.539062 0.472656 0.589844 
+0.542969 0.472656 0.585938 
+0.542969 0.476562 0.582031 
+0.554688 0.472656 0.589844 
+0.550781 0.476562 0.589844 
+0.550781 0.480469 0.585938 
+0.554688 0.488281 0.589844 
+0.546875 0.480469 0.601562 
+0.558594 0.480469 0.601562 
+0.554688 0.484375 0.601562 
+0.558594 0.492188 0.601562 
+0.398438 0.507812 0.503906 
+0.398438 0.519531 0.503906 
+0.398438 0.515625 0.507812 
+0.398438 0.519531 0.515625 
+0.417969 0.507812 0.503906 
+0.433594 0.507812 0.503906 
+0.429688 0.511719 0.503906 
+0.425781 0.511719 0.507812 
+0.433594 0.523438 0.503906 
+0.433594 0.519531 0.507812 
+0.429688 0.519531 0.511719 
+0.433594 0.523438 0.519531 
+0.414062 0.511719 0.503906 
+0.414062 0.527344 0.503906 
+0.417969 0.523438 0.503906 
+0.417969 0.519531 0.507812 
+0.429688 0.527344 0.503906 
+0.425781 0.527344 0.507812 
+0.425781 0.523438 0.511719 
+0.429688 0.527344 0.519531 
+0.410156 0.511719 0.507812 
+0.410156 0.527344 0.507812 
+0.410156 0.523438 0.511719 
+0.414062 0.519531 0.511719 
+0.410156 0.527344 0.523438 
+0.414062 0.527344 0.519531 
+0.417969 0.523438 0.519531 
+0.425781 0.527344 0.523438 
+0.417969 0.539062 0.503906 
+0.433594 0.539062 0.503906 
+0.429688 0.542969 0.503906 
+0.425781 0.542969 0.507812 
+0.433594 0.554688 0.503906 
+0.433594 0.550781 0.507812 
+0.429688 0.550781 0.511719 
+0.433594 0.554688 0.519531 
+0.417969 0.535156 0.507812 
+0.433594 0.535156 0.507812 
+0.429688 0.535156 0.511719 
+0.425781 0.539062 0.511719 
+0.433594 0.535156 0.523438 
+0.433594 0.539062 0.519531 
+0.429688 0.542969 0.519531 
+0.433594 0.550781 0.523438 
+0.414062 0.535156 0.511719 
+0.414062 0.535156 0.527344 
+0.417969 0.535156 0.523438 
+0.417969 0.539062 0.519531 
+0.429688 0.535156 0.527344 
+0.425781 0.539062 0.527344 
+0.425781 0.542969 0.523438 
+0.429688 0.550781 0.527344 
+0.417969 0.539062 0.535156 
+0.433594 0.539062 0.535156 
+0.429688 0.542969 0.535156 
+0.425781 0.542969 0.539062 
+0.433594 0.554688 0.535156 
+0.433594 0.550781 0.539062 
+0.429688 0.550781 0.542969 
+0.433594 0.554688 0.550781 
+0.449219 0.507812 0.503906 
+0.464844 0.507812 0.503906 
+0.460938 0.511719 0.503906 
+0.457031 0.511719 0.507812 
+0.464844 0.523438 0.503906 
+0.464844 0.519531 0.507812 
+0.460938 0.519531 0.511719 
+0.464844 0.523438 0.519531 
+0.480469 0.507812 0.503906 
+0.496094 0.507812 0.503906 
+0.492188 0.511719 0.503906 
+0.488281 0.511719 0.507812 
+0.496094 0.523438 0.503906 
+0.496094 0.519531 0.507812 
+0.492188 0.519531 0.511719 
+0.496094 0.523438 0.519531 
+0.476562 0.511719 0.503906 
+0.476562 0.527344 0.503906 
+0.480469 0.523438 0.503906 
+0.480469 0.519531 0.507812 
+0.492188 0.527344 0.503906 
+0.488281 0.527344 0.507812 
+0.488281 0.523438 0.511719 
+0.492188 0.527344 0.519531 
+0.472656 0.511719 0.507812 
+0.472656 0.527344 0.507812 
+0.472656 0.523438 0.511719 
+0.476562 0.519531 0.511719 
+0.472656 0.527344 0.523438 
+0.476562 0.527344 0.519531 
+0.480469 0.523438 0.519531 
+0.488281 0.527344 0.523438 
+0.480469 0.539062 0.503906 
+0.496094 0.539062 0.503906 
+0.492188 0.542969 0.503906 
+0.488281 0.542969 0.507812 
+0.496094 0.554688 0.503906 
+0.496094 0.550781 0.507812 
+0.492188 0.550781 0.511719 
+0.496094 0.554688 0.519531 
+0.480469 0.535156 0.507812 
+0.496094 0.535156 0.507812 
+0.492188 0.535156 0.511719 
+0.488281 0.539062 0.511719 
+0.496094 0.535156 0.523438 
+0.496094 0.539062 0.519531 
+0.492188 0.542969 0.519531 
+0.496094 0.550781 0.523438 
+0.476562 0.535156 0.511719 
+0.476562 0.535156 0.527344 
+0.480469 0.535156 0.523438 
+0.480469 0.539062 0.519531 
+0.492188 0.535156 0.527344 
+0.488281 0.539062 0.527344 
+0.488281 0.542969 0.523438 
+0.492188 0.550781 0.527344 
+0.480469 0.539062 0.535156 
+0.496094 0.539062 0.535156 
+0.492188 0.542969 0.535156 
+0.488281 0.542969 0.539062 
+0.496094 0.554688 0.535156 
+0.496094 0.550781 0.539062 
+0.492188 0.550781 0.542969 
+0.496094 0.554688 0.550781 
+0.445312 0.511719 0.503906 
+0.445312 0.527344 0.503906 
+0.449219 0.523438 0.503906 
+0.449219 0.519531 0.507812 
+0.460938 0.527344 0.503906 
+0.457031 0.527344 0.507812 
+0.457031 0.523438 0.511719 
+0.460938 0.527344 0.519531 
+0.445312 0.542969 0.503906 
+0.445312 0.558594 0.503906 
+0.449219 0.554688 0.503906 
+0.449219 0.550781 0.507812 
+0.460938 0.558594 0.503906 
+0.457031 0.558594 0.507812 
+0.457031 0.554688 0.511719 
+0.460938 0.558594 0.519531 
+0.449219 0.539062 0.503906 
+0.464844 0.539062 0.503906 
+0.460938 0.542969 0.503906 
+0.457031 0.542969 0.507812 
+0.464844 0.554688 0.503906 
+0.464844 0.550781 0.507812 
+0.460938 0.550781 0.511719 
+0.464844 0.554688 0.519531 
+0.449219 0.535156 0.507812 
+0.464844 0.535156 0.507812 
+0.460938 0.535156 0.511719 
+0.457031 0.539062 0.511719 
+0.464844 0.535156 0.523438 
+0.464844 0.539062 0.519531 
+0.460938 0.542969 0.519531 
+0.464844 0.550781 0.523438 
+0.476562 0.542969 0.503906 
+0.476562 0.558594 0.503906 
+0.480469 0.554688 0.503906 
+0.480469 0.550781 0.507812 
+0.492188 0.558594 0.503906 
+0.488281 0.558594 0.507812 
+0.488281 0.554688 0.511719 
+0.492188 0.558594 0.519531 
+0.472656 0.542969 0.507812 
+0.472656 0.558594 0.507812 
+0.472656 0.554688 0.511719 
+0.476562 0.550781 0.511719 
+0.472656 0.558594 0.523438 
+0.476562 0.558594 0.519531 
+0.480469 0.554688 0.519531 
+0.488281 0.558594 0.523438 
+0.472656 0.539062 0.511719 
+0.472656 0.539062 0.527344 
+0.472656 0.542969 0.523438 
+0.476562 0.542969 0.519531 
+0.472656 0.554688 0.527344 
+0.476562 0.550781 0.527344 
+0.480469 0.550781 0.523438 
+0.488281 0.554688 0.527344 
+0.476562 0.542969 0.535156 
+0.476562 0.558594 0.535156 
+0.480469 0.554688 0.535156 
+0.480469 0.550781 0.539062 
+0.492188 0.558594 0.535156 
+0.488281 0.558594 0.539062 
+0.488281 0.554688 0.542969 
+0.492188 0.558594 0.550781 
+0.441406 0.511719 0.507812 
+0.441406 0.527344 0.507812 
+0.441406 0.523438 0.511719 
+0.445312 0.519531 0.511719 
+0.441406 0.527344 0.523438 
+0.445312 0.527344 0.519531 
+0.449219 0.523438 0.519531 
+0.457031 0.527344 0.523438 
+0.441406 0.542969 0.507812 
+0.441406 0.558594 0.507812 
+0.441406 0.554688 0.511719 
+0.445312 0.550781 0.511719 
+0.441406 0.558594 0.523438 
+0.445312 0.558594 0.519531 
+0.449219 0.554688 0.519531 
+0.457031 0.558594 0.523438 
+0.441406 0.539062 0.511719 
+0.441406 0.539062 0.527344 
+0.441406 0.542969 0.523438 
+0.445312 0.542969 0.519531 
+0.441406 0.554688 0.527344 
+0.445312 0.550781 0.527344 
+0.449219 0.550781 0.523438 
+0.457031 0.554688 0.527344 
+0.445312 0.535156 0.511719 
+0.445312 0.535156 0.527344 
+0.449219 0.535156 0.523438 
+0.449219 0.539062 0.519531 
+0.460938 0.535156 0.527344 
+0.457031 0.539062 0.527344 
+0.457031 0.542969 0.523438 
+0.460938 0.550781 0.527344 
+0.441406 0.542969 0.539062 
+0.441406 0.558594 0.539062 
+0.441406 0.554688 0.542969 
+0.445312 0.550781 0.542969 
+0.441406 0.558594 0.554688 
+0.445312 0.558594 0.550781 
+0.449219 0.554688 0.550781 
+0.457031 0.558594 0.554688 
+0.445312 0.542969 0.535156 
+0.445312 0.558594 0.535156 
+0.449219 0.554688 0.535156 
+0.449219 0.550781 0.539062 
+0.460938 0.558594 0.535156 
+0.457031 0.558594 0.539062 
+0.457031 0.554688 0.542969 
+0.460938 0.558594 0.550781 
+0.449219 0.539062 0.535156 
+0.464844 0.539062 0.535156 
+0.460938 0.542969 0.535156 
+0.457031 0.542969 0.539062 
+0.464844 0.554688 0.535156 
+0.464844 0.550781 0.539062 
+0.460938 0.550781 0.542969 
+0.464844 0.554688 0.550781 
+0.472656 0.542969 0.539062 
+0.472656 0.558594 0.539062 
+0.472656 0.554688 0.542969 
+0.476562 0.550781 0.542969 
+0.472656 0.558594 0.554688 
+0.476562 0.558594 0.550781 
+0.480469 0.554688 0.550781 
+0.488281 0.558594 0.554688 
+0.449219 0.570312 0.503906 
+0.464844 0.570312 0.503906 
+0.460938 0.574219 0.503906 
+0.457031 0.574219 0.507812 
+0.464844 0.585938 0.503906 
+0.464844 0.582031 0.507812 
+0.460938 0.582031 0.511719 
+0.464844 0.585938 0.519531 
+0.480469 0.570312 0.503906 
+0.496094 0.570312 0.503906 
+0.492188 0.574219 0.503906 
+0.488281 0.574219 0.507812 
+0.496094 0.585938 0.503906 
+0.496094 0.582031 0.507812 
+0.492188 0.582031 0.511719 
+0.496094 0.585938 0.519531 
+0.476562 0.574219 0.503906 
+0.476562 0.589844 0.503906 
+0.480469 0.585938 0.503906 
+0.480469 0.582031 0.507812 
+0.492188 0.589844 0.503906 
+0.488281 0.589844 0.507812 
+0.488281 0.585938 0.511719 
+0.492188 0.589844 0.519531 
+0.472656 0.574219 0.507812 
+0.472656 0.589844 0.507812 
+0.472656 0.585938 0.511719 
+0.476562 0.582031 0.511719 
+0.472656 0.589844 0.523438 
+0.476562 0.589844 0.519531 
+0.480469 0.585938 0.519531 
+0.488281 0.589844 0.523438 
+0.488281 0.609375 0.507812 
+0.496094 0.609375 0.507812 
+0.484375 0.601562 0.511719 
+0.496094 0.601562 0.511719 
+0.492188 0.601562 0.515625 
+0.496094 0.601562 0.523438 
+0.480469 0.601562 0.515625 
+0.480469 0.601562 0.527344 
+0.484375 0.601562 0.523438 
+0.492188 0.601562 0.527344 
+0.488281 0.609375 0.539062 
+0.496094 0.609375 0.539062 
+0.449219 0.566406 0.507812 
+0.464844 0.566406 0.507812 
+0.460938 0.566406 0.511719 
+0.457031 0.570312 0.511719 
+0.464844 0.566406 0.523438 
+0.464844 0.570312 0.519531 
+0.460938 0.574219 0.519531 
+0.464844 0.582031 0.523438 
+0.480469 0.566406 0.507812 
+0.496094 0.566406 0.507812 
+0.492188 0.566406 0.511719 
+0.488281 0.570312 0.511719 
+0.496094 0.566406 0.523438 
+0.496094 0.570312 0.519531 
+0.492188 0.574219 0.519531 
+0.496094 0.582031 0.523438 
+0.476562 0.566406 0.511719 
+0.476562 0.566406 0.527344 
+0.480469 0.566406 0.523438 
+0.480469 0.570312 0.519531 
+0.492188 0.566406 0.527344 
+0.488281 0.570312 0.527344 
+0.488281 0.574219 0.523438 
+0.492188 0.582031 0.527344 
+0.472656 0.570312 0.511719 
+0.472656 0.570312 0.527344 
+0.472656 0.574219 0.523438 
+0.476562 0.574219 0.519531 
+0.472656 0.585938 0.527344 
+0.476562 0.582031 0.527344 
+0.480469 0.582031 0.523438 
+0.488281 0.585938 0.527344 
+0.480469 0.566406 0.539062 
+0.496094 0.566406 0.539062 
+0.492188 0.566406 0.542969 
+0.488281 0.570312 0.542969 
+0.496094 0.566406 0.554688 
+0.496094 0.570312 0.550781 
+0.492188 0.574219 0.550781 
+0.496094 0.582031 0.554688 
+0.480469 0.570312 0.535156 
+0.496094 0.570312 0.535156 
+0.492188 0.574219 0.535156 
+0.488281 0.574219 0.539062 
+0.496094 0.585938 0.535156 
+0.496094 0.582031 0.539062 
+0.492188 0.582031 0.542969 
+0.496094 0.585938 0.550781 
+0.476562 0.574219 0.535156 
+0.476562 0.589844 0.535156 
+0.480469 0.585938 0.535156 
+0.480469 0.582031 0.539062 
+0.492188 0.589844 0.535156 
+0.488281 0.589844 0.539062 
+0.488281 0.585938 0.542969 
+0.492188 0.589844 0.550781 
+0.484375 0.601562 0.542969 
+0.496094 0.601562 0.542969 
+0.492188 0.601562 0.546875 
+0.496094 0.601562 0.554688 
+0.445312 0.566406 0.511719 
+0.445312 0.566406 0.527344 
+0.449219 0.566406 0.523438 
+0.449219 0.570312 0.519531 
+0.460938 0.566406 0.527344 
+0.457031 0.570312 0.527344 
+0.457031 0.574219 0.523438 
+0.460938 0.582031 0.527344 
+0.445312 0.566406 0.542969 
+0.460938 0.566406 0.558594 
+0.449219 0.570312 0.558594 
+0.453125 0.566406 0.554688 
+0.453125 0.570312 0.550781 
+0.457031 0.574219 0.558594 
+0.457031 0.578125 0.554688 
+0.449219 0.566406 0.539062 
+0.464844 0.566406 0.539062 
+0.460938 0.566406 0.542969 
+0.457031 0.570312 0.542969 
+0.464844 0.566406 0.554688 
+0.464844 0.570312 0.550781 
+0.460938 0.574219 0.550781 
+0.464844 0.582031 0.554688 
+0.449219 0.570312 0.535156 
+0.464844 0.570312 0.535156 
+0.460938 0.574219 0.535156 
+0.457031 0.574219 0.539062 
+0.464844 0.585938 0.535156 
+0.464844 0.582031 0.539062 
+0.460938 0.582031 0.542969 
+0.464844 0.585938 0.550781 
+0.476562 0.566406 0.542969 
+0.476562 0.566406 0.558594 
+0.480469 0.566406 0.554688 
+0.480469 0.570312 0.550781 
+0.492188 0.566406 0.558594 
+0.488281 0.570312 0.558594 
+0.488281 0.574219 0.554688 
+0.492188 0.582031 0.558594 
+0.472656 0.570312 0.542969 
+0.472656 0.570312 0.558594 
+0.472656 0.574219 0.554688 
+0.476562 0.574219 0.550781 
+0.472656 0.585938 0.558594 
+0.476562 0.582031 0.558594 
+0.480469 0.582031 0.554688 
+0.488281 0.585938 0.558594 
+0.472656 0.574219 0.539062 
+0.472656 0.589844 0.539062 
+0.472656 0.585938 0.542969 
+0.476562 0.582031 0.542969 
+0.472656 0.589844 0.554688 
+0.476562 0.589844 0.550781 
+0.480469 0.585938 0.550781 
+0.488281 0.589844 0.554688 
+0.480469 0.601562 0.546875 
+0.480469 0.601562 0.558594 
+0.484375 0.601562 0.554688 
+0.492188 0.601562 0.558594 
+0.398438 0.503906 0.507812 
+0.398438 0.503906 0.519531 
+0.398438 0.507812 0.515625 
+0.398438 0.515625 0.519531 
+0.417969 0.503906 0.507812 
+0.433594 0.503906 0.507812 
+0.429688 0.503906 0.511719 
+0.425781 0.507812 0.511719 
+0.433594 0.503906 0.523438 
+0.433594 0.507812 0.519531 
+0.429688 0.511719 0.519531 
+0.433594 0.519531 0.523438 
+0.414062 0.503906 0.511719 
+0.414062 0.503906 0.527344 
+0.417969 0.503906 0.523438 
+0.417969 0.507812 0.519531 
+0.429688 0.503906 0.527344 
+0.425781 0.507812 0.527344 
+0.425781 0.511719 0.523438 
+0.429688 0.519531 0.527344 
+0.410156 0.507812 0.511719 
+0.410156 0.507812 0.527344 
+0.410156 0.511719 0.523438 
+0.414062 0.511719 0.519531 
+0.410156 0.523438 0.527344 
+0.414062 0.519531 0.527344 
+0.417969 0.519531 0.523438 
+0.425781 0.523438 0.527344 
+0.417969 0.503906 0.539062 
+0.433594 0.503906 0.539062 
+0.429688 0.503906 0.542969 
+0.425781 0.507812 0.542969 
+0.433594 0.503906 0.554688 
+0.433594 0.507812 0.550781 
+0.429688 0.511719 0.550781 
+0.433594 0.519531 0.554688 
+0.417969 0.507812 0.535156 
+0.433594 0.507812 0.535156 
+0.429688 0.511719 0.535156 
+0.425781 0.511719 0.539062 
+0.433594 0.523438 0.535156 
+0.433594 0.519531 0.539062 
+0.429688 0.519531 0.542969 
+0.433594 0.523438 0.550781 
+0.414062 0.511719 0.535156 
+0.414062 0.527344 0.535156 
+0.417969 0.523438 0.535156 
+0.417969 0.519531 0.539062 
+0.429688 0.527344 0.535156 
+0.425781 0.527344 0.539062 
+0.425781 0.523438 0.542969 
+0.429688 0.527344 0.550781 
+0.417969 0.535156 0.539062 
+0.433594 0.535156 0.539062 
+0.429688 0.535156 0.542969 
+0.425781 0.539062 0.542969 
+0.433594 0.535156 0.554688 
+0.433594 0.539062 0.550781 
+0.429688 0.542969 0.550781 
+0.433594 0.550781 0.554688 
+0.449219 0.503906 0.507812 
+0.464844 0.503906 0.507812 
+0.460938 0.503906 0.511719 
+0.457031 0.507812 0.511719 
+0.464844 0.503906 0.523438 
+0.464844 0.507812 0.519531 
+0.460938 0.511719 0.519531 
+0.464844 0.519531 0.523438 
+0.480469 0.503906 0.507812 
+0.496094 0.503906 0.507812 
+0.492188 0.503906 0.511719 
+0.488281 0.507812 0.511719 
+0.496094 0.503906 0.523438 
+0.496094 0.507812 0.519531 
+0.492188 0.511719 0.519531 
+0.496094 0.519531 0.523438 
+0.476562 0.503906 0.511719 
+0.476562 0.503906 0.527344 
+0.480469 0.503906 0.523438 
+0.480469 0.507812 0.519531 
+0.492188 0.503906 0.527344 
+0.488281 0.507812 0.527344 
+0.488281 0.511719 0.523438 
+0.492188 0.519531 0.527344 
+0.472656 0.507812 0.511719 
+0.472656 0.507812 0.527344 
+0.472656 0.511719 0.523438 
+0.476562 0.511719 0.519531 
+0.472656 0.523438 0.527344 
+0.476562 0.519531 0.527344 
+0.480469 0.519531 0.523438 
+0.488281 0.523438 0.527344 
+0.480469 0.503906 0.539062 
+0.496094 0.503906 0.539062 
+0.492188 0.503906 0.542969 
+0.488281 0.507812 0.542969 
+0.496094 0.503906 0.554688 
+0.496094 0.507812 0.550781 
+0.492188 0.511719 0.550781 
+0.496094 0.519531 0.554688 
+0.480469 0.507812 0.535156 
+0.496094 0.507812 0.535156 
+0.492188 0.511719 0.535156 
+0.488281 0.511719 0.539062 
+0.496094 0.523438 0.535156 
+0.496094 0.519531 0.539062 
+0.492188 0.519531 0.542969 
+0.496094 0.523438 0.550781 
+0.476562 0.511719 0.535156 
+0.476562 0.527344 0.535156 
+0.480469 0.523438 0.535156 
+0.480469 0.519531 0.539062 
+0.492188 0.527344 0.535156 
+0.488281 0.527344 0.539062 
+0.488281 0.523438 0.542969 
+0.492188 0.527344 0.550781 
+0.480469 0.535156 0.539062 
+0.496094 0.535156 0.539062 
+0.492188 0.535156 0.542969 
+0.488281 0.539062 0.542969 
+0.496094 0.535156 0.554688 
+0.496094 0.539062 0.550781 
+0.492188 0.542969 0.550781 
+0.496094 0.550781 0.554688 
+0.445312 0.503906 0.511719 
+0.445312 0.503906 0.527344 
+0.449219 0.503906 0.523438 
+0.449219 0.507812 0.519531 
+0.460938 0.503906 0.527344 
+0.457031 0.507812 0.527344 
+0.457031 0.511719 0.523438 
+0.460938 0.519531 0.527344 
+0.445312 0.503906 0.542969 
+0.445312 0.503906 0.558594 
+0.449219 0.503906 0.554688 
+0.449219 0.507812 0.550781 
+0.460938 0.503906 0.558594 
+0.457031 0.507812 0.558594 
+0.457031 0.511719 0.554688 
+0.460938 0.519531 0.558594 
+0.449219 0.503906 0.539062 
+0.464844 0.503906 0.539062 
+0.460938 0.503906 0.542969 
+0.457031 0.507812 0.542969 
+0.464844 0.503906 0.554688 
+0.464844 0.507812 0.550781 
+0.460938 0.511719 0.550781 
+0.464844 0.519531 0.554688 
+0.449219 0.507812 0.535156 
+0.464844 0.507812 0.535156 
+0.460938 0.511719 0.535156 
+0.457031 0.511719 0.539062 
+0.464844 0.523438 0.535156 
+0.464844 0.519531 0.539062 
+0.460938 0.519531 0.542969 
+0.464844 0.523438 0.550781 
+0.476562 0.503906 0.542969 
+0.476562 0.503906 0.558594 
+0.480469 0.503906 0.554688 
+0.480469 0.507812 0.550781 
+0.492188 0.503906 0.558594 
+0.488281 0.507812 0.558594 
+0.488281 0.511719 0.554688 
+0.492188 0.519531 0.558594 
+0.472656 0.507812 0.542969 
+0.472656 0.507812 0.558594 
+0.472656 0.511719 0.554688 
+0.476562 0.511719 0.550781 
+0.472656 0.523438 0.558594 
+0.476562 0.519531 0.558594 
+0.480469 0.519531 0.554688 
+0.488281 0.523438 0.558594 
+0.472656 0.511719 0.539062 
+0.472656 0.527344 0.539062 
+0.472656 0.523438 0.542969 
+0.476562 0.519531 0.542969 
+0.472656 0.527344 0.554688 
+0.476562 0.527344 0.550781 
+0.480469 0.523438 0.550781 
+0.488281 0.527344 0.554688 
+0.476562 0.535156 0.542969 
+0.476562 0.535156 0.558594 
+0.480469 0.535156 0.554688 
+0.480469 0.539062 0.550781 
+0.492188 0.535156 0.558594 
+0.488281 0.539062 0.558594 
+0.488281 0.542969 0.554688 
+0.492188 0.550781 0.558594 
+0.441406 0.507812 0.511719 
+0.441406 0.507812 0.527344 
+0.441406 0.511719 0.523438 
+0.445312 0.511719 0.519531 
+0.441406 0.523438 0.527344 
+0.445312 0.519531 0.527344 
+0.449219 0.519531 0.523438 
+0.457031 0.523438 0.527344 
+0.441406 0.507812 0.542969 
+0.441406 0.507812 0.558594 
+0.441406 0.511719 0.554688 
+0.445312 0.511719 0.550781 
+0.441406 0.523438 0.558594 
+0.445312 0.519531 0.558594 
+0.449219 0.519531 0.554688 
+0.457031 0.523438 0.558594 
+0.441406 0.511719 0.539062 
+0.441406 0.527344 0.539062 
+0.441406 0.523438 0.542969 
+0.445312 0.519531 0.542969 
+0.441406 0.527344 0.554688 
+0.445312 0.527344 0.550781 
+0.449219 0.523438 0.550781 
+0.457031 0.527344 0.554688 
+0.445312 0.511719 0.535156 
+0.445312 0.527344 0.535156 
+0.449219 0.523438 0.535156 
+0.449219 0.519531 0.539062 
+0.460938 0.527344 0.535156 
+0.457031 0.527344 0.539062 
+0.457031 0.523438 0.542969 
+0.460938 0.527344 0.550781 
+0.441406 0.539062 0.542969 
+0.441406 0.539062 0.558594 
+0.441406 0.542969 0.554688 
+0.445312 0.542969 0.550781 
+0.441406 0.554688 0.558594 
+0.445312 0.550781 0.558594 
+0.449219 0.550781 0.554688 
+0.457031 0.554688 0.558594 
+0.445312 0.535156 0.542969 
+0.445312 0.535156 0.558594 
+0.449219 0.535156 0.554688 
+0.449219 0.539062 0.550781 
+0.460938 0.535156 0.558594 
+0.457031 0.539062 0.558594 
+0.457031 0.542969 0.554688 
+0.460938 0.550781 0.558594 
+0.449219 0.535156 0.539062 
+0.464844 0.535156 0.539062 
+0.460938 0.535156 0.542969 
+0.457031 0.539062 0.542969 
+0.464844 0.535156 0.554688 
+0.464844 0.539062 0.550781 
+0.460938 0.542969 0.550781 
+0.464844 0.550781 0.554688 
+0.472656 0.539062 0.542969 
+0.472656 0.539062 0.558594 
+0.472656 0.542969 0.554688 
+0.476562 0.542969 0.550781 
+0.472656 0.554688 0.558594 
+0.476562 0.550781 0.558594 
+0.480469 0.550781 0.554688 
+0.488281 0.554688 0.558594 
+0.449219 0.503906 0.570312 
+0.464844 0.503906 0.570312 
+0.460938 0.503906 0.574219 
+0.457031 0.507812 0.574219 
+0.464844 0.503906 0.585938 
+0.464844 0.507812 0.582031 
+0.460938 0.511719 0.582031 
+0.464844 0.519531 0.585938 
+0.480469 0.503906 0.570312 
+0.496094 0.503906 0.570312 
+0.492188 0.503906 0.574219 
+0.488281 0.507812 0.574219 
+0.496094 0.503906 0.585938 
+0.496094 0.507812 0.582031 
+0.492188 0.511719 0.582031 
+0.496094 0.519531 0.585938 
+0.476562 0.503906 0.574219 
+0.476562 0.503906 0.589844 
+0.480469 0.503906 0.585938 
+0.480469 0.507812 0.582031 
+0.492188 0.503906 0.589844 
+0.488281 0.507812 0.589844 
+0.488281 0.511719 0.585938 
+0.492188 0.519531 0.589844 
+0.472656 0.507812 0.574219 
+0.472656 0.507812 0.589844 
+0.472656 0.511719 0.585938 
+0.476562 0.511719 0.582031 
+0.472656 0.523438 0.589844 
+0.476562 0.519531 0.589844 
+0.480469 0.519531 0.585938 
+0.488281 0.523438 0.589844 
+0.488281 0.507812 0.609375 
+0.496094 0.507812 0.609375 
+0.484375 0.511719 0.601562 
+0.496094 0.511719 0.601562 
+0.492188 0.515625 0.601562 
+0.496094 0.523438 0.601562 
+0.480469 0.515625 0.601562 
+0.480469 0.527344 0.601562 
+0.484375 0.523438 0.601562 
+0.492188 0.527344 0.601562 
+0.488281 0.539062 0.609375 
+0.496094 0.539062 0.609375 
+0.449219 0.507812 0.566406 
+0.464844 0.507812 0.566406 
+0.460938 0.511719 0.566406 
+0.457031 0.511719 0.570312 
+0.464844 0.523438 0.566406 
+0.464844 0.519531 0.570312 
+0.460938 0.519531 0.574219 
+0.464844 0.523438 0.582031 
+0.480469 0.507812 0.566406 
+0.496094 0.507812 0.566406 
+0.492188 0.511719 0.566406 
+0.488281 0.511719 0.570312 
+0.496094 0.523438 0.566406 
+0.496094 0.519531 0.570312 
+0.492188 0.519531 0.574219 
+0.496094 0.523438 0.582031 
+0.476562 0.511719 0.566406 
+0.476562 0.527344 0.566406 
+0.480469 0.523438 0.566406 
+0.480469 0.519531 0.570312 
+0.492188 0.527344 0.566406 
+0.488281 0.527344 0.570312 
+0.488281 0.523438 0.574219 
+0.492188 0.527344 0.582031 
+0.472656 0.511719 0.570312 
+0.472656 0.527344 0.570312 
+0.472656 0.523438 0.574219 
+0.476562 0.519531 0.574219 
+0.472656 0.527344 0.585938 
+0.476562 0.527344 0.582031 
+0.480469 0.523438 0.582031 
+0.488281 0.527344 0.585938 
+0.480469 0.539062 0.566406 
+0.496094 0.539062 0.566406 
+0.492188 0.542969 0.566406 
+0.488281 0.542969 0.570312 
+0.496094 0.554688 0.566406 
+0.496094 0.550781 0.570312 
+0.492188 0.550781 0.574219 
+0.496094 0.554688 0.582031 
+0.480469 0.535156 0.570312 
+0.496094 0.535156 0.570312 
+0.492188 0.535156 0.574219 
+0.488281 0.539062 0.574219 
+0.496094 0.535156 0.585938 
+0.496094 0.539062 0.582031 
+0.492188 0.542969 0.582031 
+0.496094 0.550781 0.585938 
+0.476562 0.535156 0.574219 
+0.476562 0.535156 0.589844 
+0.480469 0.535156 0.585938 
+0.480469 0.539062 0.582031 
+0.492188 0.535156 0.589844 
+0.488281 0.539062 0.589844 
+0.488281 0.542969 0.585938 
+0.492188 0.550781 0.589844 
+0.484375 0.542969 0.601562 
+0.496094 0.542969 0.601562 
+0.492188 0.546875 0.601562 
+0.496094 0.554688 0.601562 
+0.445312 0.511719 0.566406 
+0.445312 0.527344 0.566406 
+0.449219 0.523438 0.566406 
+0.449219 0.519531 0.570312 
+0.460938 0.527344 0.566406 
+0.457031 0.527344 0.570312 
+0.457031 0.523438 0.574219 
+0.460938 0.527344 0.582031 
+0.445312 0.542969 0.566406 
+0.460938 0.558594 0.566406 
+0.449219 0.558594 0.570312 
+0.453125 0.554688 0.566406 
+0.453125 0.550781 0.570312 
+0.457031 0.558594 0.574219 
+0.457031 0.554688 0.578125 
+0.449219 0.539062 0.566406 
+0.464844 0.539062 0.566406 
+0.460938 0.542969 0.566406 
+0.457031 0.542969 0.570312 
+0.464844 0.554688 0.566406 
+0.464844 0.550781 0.570312 
+0.460938 0.550781 0.574219 
+0.464844 0.554688 0.582031 
+0.449219 0.535156 0.570312 
+0.464844 0.535156 0.570312 
+0.460938 0.535156 0.574219 
+0.457031 0.539062 0.574219 
+0.464844 0.535156 0.585938 
+0.464844 0.539062 0.582031 
+0.460938 0.542969 0.582031 
+0.464844 0.550781 0.585938 
+0.476562 0.542969 0.566406 
+0.476562 0.558594 0.566406 
+0.480469 0.554688 0.566406 
+0.480469 0.550781 0.570312 
+0.492188 0.558594 0.566406 
+0.488281 0.558594 0.570312 
+0.488281 0.554688 0.574219 
+0.492188 0.558594 0.582031 
+0.472656 0.542969 0.570312 
+0.472656 0.558594 0.570312 
+0.472656 0.554688 0.574219 
+0.476562 0.550781 0.574219 
+0.472656 0.558594 0.585938 
+0.476562 0.558594 0.582031 
+0.480469 0.554688 0.582031 
+0.488281 0.558594 0.585938 
+0.472656 0.539062 0.574219 
+0.472656 0.539062 0.589844 
+0.472656 0.542969 0.585938 
+0.476562 0.542969 0.582031 
+0.472656 0.554688 0.589844 
+0.476562 0.550781 0.589844 
+0.480469 0.550781 0.585938 
+0.488281 0.554688 0.589844 
+0.480469 0.546875 0.601562 
+0.480469 0.558594 0.601562 
+0.484375 0.554688 0.601562 
+0.492188 0.558594 0.601562 
+0.503906 0.429688 0.390625 
+0.511719 0.429688 0.390625 
+0.503906 0.421875 0.398438 
+0.511719 0.421875 0.398438 
+0.503906 0.429688 0.414062 
+0.503906 0.429688 0.425781 
+0.507812 0.429688 0.421875 
+0.515625 0.429688 0.425781 
+0.507812 0.429688 0.410156 
+0.519531 0.429688 0.410156 
+0.515625 0.429688 0.414062 
+0.519531 0.429688 0.421875 
+0.523438 0.421875 0.410156 
+0.523438 0.421875 0.417969 
+0.539062 0.429688 0.417969 
+0.535156 0.429688 0.425781 
+0.542969 0.429688 0.425781 
+0.503906 0.390625 0.429688 
+0.511719 0.390625 0.429688 
+0.503906 0.398438 0.421875 
+0.511719 0.398438 0.421875 
+0.503906 0.414062 0.429688 
+0.503906 0.425781 0.429688 
+0.507812 0.421875 0.429688 
+0.515625 0.425781 0.429688 
+0.507812 0.410156 0.429688 
+0.519531 0.410156 0.429688 
+0.515625 0.414062 0.429688 
+0.519531 0.421875 0.429688 
+0.523438 0.410156 0.421875 
+0.523438 0.417969 0.421875 
+0.539062 0.417969 0.429688 
+0.535156 0.425781 0.429688 
+0.542969 0.425781 0.429688 
+0.429688 0.503906 0.390625 
+0.429688 0.511719 0.390625 
+0.421875 0.503906 0.398438 
+0.421875 0.511719 0.398438 
+0.429688 0.503906 0.414062 
+0.429688 0.503906 0.425781 
+0.429688 0.507812 0.421875 
+0.429688 0.515625 0.425781 
+0.429688 0.507812 0.410156 
+0.429688 0.519531 0.410156 
+0.429688 0.515625 0.414062 
+0.429688 0.519531 0.421875 
+0.421875 0.523438 0.410156 
+0.421875 0.523438 0.417969 
+0.429688 0.539062 0.417969 
+0.429688 0.535156 0.425781 
+0.429688 0.542969 0.425781 
+0.390625 0.503906 0.429688 
+0.390625 0.511719 0.429688 
+0.398438 0.503906 0.421875 
+0.398438 0.511719 0.421875 
+0.414062 0.503906 0.429688 
+0.425781 0.503906 0.429688 
+0.421875 0.507812 0.429688 
+0.425781 0.515625 0.429688 
+0.410156 0.507812 0.429688 
+0.410156 0.519531 0.429688 
+0.414062 0.515625 0.429688 
+0.421875 0.519531 0.429688 
+0.410156 0.523438 0.421875 
+0.417969 0.523438 0.421875 
+0.417969 0.539062 0.429688 
+0.425781 0.535156 0.429688 
+0.425781 0.542969 0.429688 
+0.578125 0.570312 0.457031 
+0.574219 0.570312 0.464844 
+0.582031 0.570312 0.464844 
+0.574219 0.570312 0.484375 
+0.574219 0.570312 0.496094 
+0.578125 0.570312 0.492188 
+0.585938 0.570312 0.496094 
+0.578125 0.570312 0.480469 
+0.589844 0.570312 0.480469 
+0.585938 0.570312 0.484375 
+0.589844 0.570312 0.492188 
+0.582031 0.578125 0.476562 
+0.589844 0.578125 0.476562 
+0.609375 0.570312 0.488281 
+0.609375 0.570312 0.496094 
+0.601562 0.578125 0.488281 
+0.601562 0.578125 0.496094 
+0.570312 0.578125 0.457031 
+0.570312 0.574219 0.464844 
+0.570312 0.582031 0.464844 
+0.570312 0.574219 0.484375 
+0.570312 0.574219 0.496094 
+0.570312 0.578125 0.492188 
+0.570312 0.585938 0.496094 
+0.570312 0.578125 0.480469 
+0.570312 0.589844 0.480469 
+0.570312 0.585938 0.484375 
+0.570312 0.589844 0.492188 
+0.578125 0.582031 0.476562 
+0.578125 0.589844 0.476562 
+0.570312 0.609375 0.488281 
+0.570312 0.609375 0.496094 
+0.578125 0.601562 0.488281 
+0.578125 0.601562 0.496094 
+0.429688 0.390625 0.503906 
+0.429688 0.390625 0.511719 
+0.421875 0.398438 0.503906 
+0.421875 0.398438 0.511719 
+0.429688 0.414062 0.503906 
+0.429688 0.425781 0.503906 
+0.429688 0.421875 0.507812 
+0.429688 0.425781 0.515625 
+0.429688 0.410156 0.507812 
+0.429688 0.410156 0.519531 
+0.429688 0.414062 0.515625 
+0.429688 0.421875 0.519531 
+0.421875 0.410156 0.523438 
+0.421875 0.417969 0.523438 
+0.429688 0.417969 0.539062 
+0.429688 0.425781 0.535156 
+0.429688 0.425781 0.542969 
+0.390625 0.429688 0.503906 
+0.390625 0.429688 0.511719 
+0.398438 0.421875 0.503906 
+0.398438 0.421875 0.511719 
+0.414062 0.429688 0.503906 
+0.425781 0.429688 0.503906 
+0.421875 0.429688 0.507812 
+0.425781 0.429688 0.515625 
+0.410156 0.429688 0.507812 
+0.410156 0.429688 0.519531 
+0.414062 0.429688 0.515625 
+0.421875 0.429688 0.519531 
+0.410156 0.421875 0.523438 
+0.417969 0.421875 0.523438 
+0.417969 0.429688 0.539062 
+0.425781 0.429688 0.535156 
+0.425781 0.429688 0.542969 
+0.578125 0.457031 0.570312 
+0.574219 0.464844 0.570312 
+0.582031 0.464844 0.570312 
+0.574219 0.484375 0.570312 
+0.574219 0.496094 0.570312 
+0.578125 0.492188 0.570312 
+0.585938 0.496094 0.570312 
+0.578125 0.480469 0.570312 
+0.589844 0.480469 0.570312 
+0.585938 0.484375 0.570312 
+0.589844 0.492188 0.570312 
+0.582031 0.476562 0.578125 
+0.589844 0.476562 0.578125 
+0.609375 0.488281 0.570312 
+0.609375 0.496094 0.570312 
+0.601562 0.488281 0.578125 
+0.601562 0.496094 0.578125 
+0.570312 0.457031 0.578125 
+0.570312 0.464844 0.574219 
+0.570312 0.464844 0.582031 
+0.570312 0.484375 0.574219 
+0.570312 0.496094 0.574219 
+0.570312 0.492188 0.578125 
+0.570312 0.496094 0.585938 
+0.570312 0.480469 0.578125 
+0.570312 0.480469 0.589844 
+0.570312 0.484375 0.585938 
+0.570312 0.492188 0.589844 
+0.578125 0.476562 0.582031 
+0.578125 0.476562 0.589844 
+0.570312 0.488281 0.609375 
+0.570312 0.496094 0.609375 
+0.578125 0.488281 0.601562 
+0.578125 0.496094 0.601562 
+0.457031 0.578125 0.570312 
+0.464844 0.574219 0.570312 
+0.464844 0.582031 0.570312 
+0.484375 0.574219 0.570312 
+0.496094 0.574219 0.570312 
+0.492188 0.578125 0.570312 
+0.496094 0.585938 0.570312 
+0.480469 0.578125 0.570312 
+0.480469 0.589844 0.570312 
+0.484375 0.585938 0.570312 
+0.492188 0.589844 0.570312 
+0.476562 0.582031 0.578125 
+0.476562 0.589844 0.578125 
+0.488281 0.609375 0.570312 
+0.496094 0.609375 0.570312 
+0.488281 0.601562 0.578125 
+0.496094 0.601562 0.578125 
+0.457031 0.570312 0.578125 
+0.464844 0.570312 0.574219 
+0.464844 0.570312 0.582031 
+0.484375 0.570312 0.574219 
+0.496094 0.570312 0.574219 
+0.492188 0.570312 0.578125 
+0.496094 0.570312 0.585938 
+0.480469 0.570312 0.578125 
+0.480469 0.570312 0.589844 
+0.484375 0.570312 0.585938 
+0.492188 0.570312 0.589844 
+0.476562 0.578125 0.582031 
+0.476562 0.578125 0.589844 
+0.488281 0.570312 0.609375 
+0.496094 0.570312 0.609375 
+0.488281 0.578125 0.601562 
+0.496094 0.578125 0.601562 
+0.492188 0.421875 0.410156 
+0.492188 0.421875 0.417969 
+0.484375 0.429688 0.410156 
+0.484375 0.429688 0.417969 
+0.492188 0.472656 0.390625 
+0.492188 0.480469 0.390625 
+0.484375 0.472656 0.398438 
+0.484375 0.480469 0.398438 
+0.492188 0.476562 0.410156 
+0.492188 0.488281 0.410156 
+0.492188 0.484375 0.414062 
+0.492188 0.488281 0.421875 
+0.492188 0.441406 0.390625 
+0.492188 0.449219 0.390625 
+0.484375 0.441406 0.398438 
+0.484375 0.449219 0.398438 
+0.492188 0.441406 0.414062 
+0.492188 0.441406 0.425781 
+0.492188 0.445312 0.421875 
+0.492188 0.453125 0.425781 
+0.492188 0.445312 0.410156 
+0.492188 0.457031 0.410156 
+0.492188 0.453125 0.414062 
+0.492188 0.457031 0.421875 
+0.484375 0.460938 0.410156 
+0.484375 0.460938 0.417969 
+0.492188 0.472656 0.414062 
+0.492188 0.472656 0.425781 
+0.492188 0.476562 0.421875 
+0.492188 0.484375 0.425781 
+0.484375 0.441406 0.429688 
+0.484375 0.449219 0.429688 
+0.484375 0.472656 0.429688 
+0.484375 0.480469 0.429688 
+0.492188 0.445312 0.441406 
+0.492188 0.457031 0.441406 
+0.492188 0.453125 0.445312 
+0.492188 0.457031 0.453125 
+0.484375 0.460938 0.441406 
+0.484375 0.460938 0.449219 
+0.492188 0.476562 0.441406 
+0.492188 0.488281 0.441406 
+0.492188 0.484375 0.445312 
+0.492188 0.488281 0.453125 
+0.492188 0.472656 0.445312 
+0.492188 0.472656 0.457031 
+0.492188 0.476562 0.453125 
+0.492188 0.484375 0.457031 
+0.484375 0.472656 0.460938 
+0.484375 0.480469 0.460938 
+0.492188 0.476562 0.472656 
+0.492188 0.488281 0.472656 
+0.492188 0.484375 0.476562 
+0.492188 0.488281 0.484375 
+0.492188 0.410156 0.421875 
+0.492188 0.417969 0.421875 
+0.484375 0.410156 0.429688 
+0.484375 0.417969 0.429688 
+0.492188 0.390625 0.472656 
+0.492188 0.390625 0.480469 
+0.484375 0.398438 0.472656 
+0.484375 0.398438 0.480469 
+0.492188 0.410156 0.476562 
+0.492188 0.410156 0.488281 
+0.492188 0.414062 0.484375 
+0.492188 0.421875 0.488281 
+0.492188 0.390625 0.441406 
+0.492188 0.390625 0.449219 
+0.484375 0.398438 0.441406 
+0.484375 0.398438 0.449219 
+0.492188 0.414062 0.441406 
+0.492188 0.425781 0.441406 
+0.492188 0.421875 0.445312 
+0.492188 0.425781 0.453125 
+0.492188 0.410156 0.445312 
+0.492188 0.410156 0.457031 
+0.492188 0.414062 0.453125 
+0.492188 0.421875 0.457031 
+0.484375 0.410156 0.460938 
+0.484375 0.417969 0.460938 
+0.492188 0.414062 0.472656 
+0.492188 0.425781 0.472656 
+0.492188 0.421875 0.476562 
+0.492188 0.425781 0.484375 
+0.484375 0.429688 0.441406 
+0.484375 0.429688 0.449219 
+0.484375 0.429688 0.472656 
+0.484375 0.429688 0.480469 
+0.492188 0.441406 0.445312 
+0.492188 0.441406 0.457031 
+0.492188 0.445312 0.453125 
+0.492188 0.453125 0.457031 
+0.484375 0.441406 0.460938 
+0.484375 0.449219 0.460938 
+0.492188 0.441406 0.476562 
+0.492188 0.441406 0.488281 
+0.492188 0.445312 0.484375 
+0.492188 0.453125 0.488281 
+0.492188 0.445312 0.472656 
+0.492188 0.457031 0.472656 
+0.492188 0.453125 0.476562 
+0.492188 0.457031 0.484375 
+0.484375 0.460938 0.472656 
+0.484375 0.460938 0.480469 
+0.492188 0.472656 0.476562 
+0.492188 0.472656 0.488281 
+0.492188 0.476562 0.484375 
+0.492188 0.484375 0.488281 
+0.421875 0.492188 0.410156 
+0.421875 0.492188 0.417969 
+0.429688 0.484375 0.410156 
+0.429688 0.484375 0.417969 
+0.472656 0.492188 0.390625 
+0.480469 0.492188 0.390625 
+0.472656 0.484375 0.398438 
+0.480469 0.484375 0.398438 
+0.476562 0.492188 0.410156 
+0.488281 0.492188 0.410156 
+0.484375 0.492188 0.414062 
+0.488281 0.492188 0.421875 
+0.441406 0.492188 0.390625 
+0.449219 0.492188 0.390625 
+0.441406 0.484375 0.398438 
+0.449219 0.484375 0.398438 
+0.441406 0.492188 0.414062 
+0.441406 0.492188 0.425781 
+0.445312 0.492188 0.421875 
+0.453125 0.492188 0.425781 
+0.445312 0.492188 0.410156 
+0.457031 0.492188 0.410156 
+0.453125 0.492188 0.414062 
+0.457031 0.492188 0.421875 
+0.460938 0.484375 0.410156 
+0.460938 0.484375 0.417969 
+0.472656 0.492188 0.414062 
+0.472656 0.492188 0.425781 
+0.476562 0.492188 0.421875 
+0.484375 0.492188 0.425781 
+0.441406 0.484375 0.429688 
+0.449219 0.484375 0.429688 
+0.472656 0.484375 0.429688 
+0.480469 0.484375 0.429688 
+0.445312 0.492188 0.441406 
+0.457031 0.492188 0.441406 
+0.453125 0.492188 0.445312 
+0.457031 0.492188 0.453125 
+0.460938 0.484375 0.441406 
+0.460938 0.484375 0.449219 
+0.476562 0.492188 0.441406 
+0.488281 0.492188 0.441406 
+0.484375 0.492188 0.445312 
+0.488281 0.492188 0.453125 
+0.472656 0.492188 0.445312 
+0.472656 0.492188 0.457031 
+0.476562 0.492188 0.453125 
+0.484375 0.492188 0.457031 
+0.472656 0.484375 0.460938 
+0.480469 0.484375 0.460938 
+0.476562 0.492188 0.472656 
+0.488281 0.492188 0.472656 
+0.484375 0.492188 0.476562 
+0.488281 0.492188 0.484375 
+0.410156 0.492188 0.421875 
+0.417969 0.492188 0.421875 
+0.410156 0.484375 0.429688 
+0.417969 0.484375 0.429688 
+0.390625 0.492188 0.472656 
+0.390625 0.492188 0.480469 
+0.398438 0.484375 0.472656 
+0.398438 0.484375 0.480469 
+0.410156 0.492188 0.476562 
+0.410156 0.492188 0.488281 
+0.414062 0.492188 0.484375 
+0.421875 0.492188 0.488281 
+0.390625 0.492188 0.441406 
+0.390625 0.492188 0.449219 
+0.398438 0.484375 0.441406 
+0.398438 0.484375 0.449219 
+0.414062 0.492188 0.441406 
+0.425781 0.492188 0.441406 
+0.421875 0.492188 0.445312 
+0.425781 0.492188 0.453125 
+0.410156 0.492188 0.445312 
+0.410156 0.492188 0.457031 
+0.414062 0.492188 0.453125 
+0.421875 0.492188 0.457031 
+0.410156 0.484375 0.460938 
+0.417969 0.484375 0.460938 
+0.414062 0.492188 0.472656 
+0.425781 0.492188 0.472656 
+0.421875 0.492188 0.476562 
+0.425781 0.492188 0.484375 
+0.429688 0.484375 0.441406 
+0.429688 0.484375 0.449219 
+0.429688 0.484375 0.472656 
+0.429688 0.484375 0.480469 
+0.441406 0.492188 0.445312 
+0.441406 0.492188 0.457031 
+0.445312 0.492188 0.453125 
+0.453125 0.492188 0.457031 
+0.441406 0.484375 0.460938 
+0.449219 0.484375 0.460938 
+0.441406 0.492188 0.476562 
+0.441406 0.492188 0.488281 
+0.445312 0.492188 0.484375 
+0.453125 0.492188 0.488281 
+0.445312 0.492188 0.472656 
+0.457031 0.492188 0.472656 
+0.453125 0.492188 0.476562 
+0.457031 0.492188 0.484375 
+0.460938 0.484375 0.472656 
+0.460938 0.484375 0.480469 
+0.472656 0.492188 0.476562 
+0.472656 0.492188 0.488281 
+0.476562 0.492188 0.484375 
+0.484375 0.492188 0.488281 
+0.421875 0.410156 0.492188 
+0.421875 0.417969 0.492188 
+0.429688 0.410156 0.484375 
+0.429688 0.417969 0.484375 
+0.472656 0.390625 0.492188 
+0.480469 0.390625 0.492188 
+0.472656 0.398438 0.484375 
+0.480469 0.398438 0.484375 
+0.476562 0.410156 0.492188 
+0.488281 0.410156 0.492188 
+0.484375 0.414062 0.492188 
+0.488281 0.421875 0.492188 
+0.441406 0.390625 0.492188 
+0.449219 0.390625 0.492188 
+0.441406 0.398438 0.484375 
+0.449219 0.398438 0.484375 
+0.441406 0.414062 0.492188 
+0.441406 0.425781 0.492188 
+0.445312 0.421875 0.492188 
+0.453125 0.425781 0.492188 
+0.445312 0.410156 0.492188 
+0.457031 0.410156 0.492188 
+0.453125 0.414062 0.492188 
+0.457031 0.421875 0.492188 
+0.460938 0.410156 0.484375 
+0.460938 0.417969 0.484375 
+0.472656 0.414062 0.492188 
+0.472656 0.425781 0.492188 
+0.476562 0.421875 0.492188 
+0.484375 0.425781 0.492188 
+0.441406 0.429688 0.484375 
+0.449219 0.429688 0.484375 
+0.472656 0.429688 0.484375 
+0.480469 0.429688 0.484375 
+0.445312 0.441406 0.492188 
+0.457031 0.441406 0.492188 
+0.453125 0.445312 0.492188 
+0.457031 0.453125 0.492188 
+0.460938 0.441406 0.484375 
+0.460938 0.449219 0.484375 
+0.476562 0.441406 0.492188 
+0.488281 0.441406 0.492188 
+0.484375 0.445312 0.492188 
+0.488281 0.453125 0.492188 
+0.472656 0.445312 0.492188 
+0.472656 0.457031 0.492188 
+0.476562 0.453125 0.492188 
+0.484375 0.457031 0.492188 
+0.472656 0.460938 0.484375 
+0.480469 0.460938 0.484375 
+0.476562 0.472656 0.492188 
+0.488281 0.472656 0.492188 
+0.484375 0.476562 0.492188 
+0.488281 0.484375 0.492188 
+0.410156 0.421875 0.492188 
+0.417969 0.421875 0.492188 
+0.410156 0.429688 0.484375 
+0.417969 0.429688 0.484375 
+0.390625 0.472656 0.492188 
+0.390625 0.480469 0.492188 
+0.398438 0.472656 0.484375 
+0.398438 0.480469 0.484375 
+0.410156 0.476562 0.492188 
+0.410156 0.488281 0.492188 
+0.414062 0.484375 0.492188 
+0.421875 0.488281 0.492188 
+0.390625 0.441406 0.492188 
+0.390625 0.449219 0.492188 
+0.398438 0.441406 0.484375 
+0.398438 0.449219 0.484375 
+0.414062 0.441406 0.492188 
+0.425781 0.441406 0.492188 
+0.421875 0.445312 0.492188 
+0.425781 0.453125 0.492188 
+0.410156 0.445312 0.492188 
+0.410156 0.457031 0.492188 
+0.414062 0.453125 0.492188 
+0.421875 0.457031 0.492188 
+0.410156 0.460938 0.484375 
+0.417969 0.460938 0.484375 
+0.414062 0.472656 0.492188 
+0.425781 0.472656 0.492188 
+0.421875 0.476562 0.492188 
+0.425781 0.484375 0.492188 
+0.429688 0.441406 0.484375 
+0.429688 0.449219 0.484375 
+0.429688 0.472656 0.484375 
+0.429688 0.480469 0.484375 
+0.441406 0.445312 0.492188 
+0.441406 0.457031 0.492188 
+0.445312 0.453125 0.492188 
+0.453125 0.457031 0.492188 
+0.441406 0.460938 0.484375 
+0.449219 0.460938 0.484375 
+0.441406 0.476562 0.492188 
+0.441406 0.488281 0.492188 
+0.445312 0.484375 0.492188 
+0.453125 0.488281 0.492188 
+0.445312 0.472656 0.492188 
+0.457031 0.472656 0.492188 
+0.453125 0.476562 0.492188 
+0.457031 0.484375 0.492188 
+0.460938 0.472656 0.484375 
+0.460938 0.480469 0.484375 
+0.472656 0.476562 0.492188 
+0.472656 0.488281 0.492188 
+0.476562 0.484375 0.492188 
+0.484375 0.488281 0.492188 
+0.523438 0.472656 0.390625 
+0.523438 0.480469 0.390625 
+0.539062 0.480469 0.398438 
+0.539062 0.488281 0.398438 
+0.542969 0.484375 0.410156 
+0.554688 0.496094 0.421875 
+0.542969 0.496094 0.410156 
+0.546875 0.492188 0.414062 
+0.550781 0.480469 0.410156 
+0.558594 0.488281 0.417969 
+0.523438 0.441406 0.390625 
+0.523438 0.449219 0.390625 
+0.539062 0.449219 0.398438 
+0.539062 0.457031 0.398438 
+0.550781 0.441406 0.417969 
+0.558594 0.445312 0.425781 
+0.558594 0.453125 0.425781 
+0.550781 0.449219 0.410156 
+0.558594 0.457031 0.417969 
+0.542969 0.453125 0.410156 
+0.554688 0.464844 0.421875 
+0.542969 0.464844 0.410156 
+0.546875 0.460938 0.414062 
+0.546875 0.472656 0.414062 
+0.558594 0.472656 0.425781 
+0.554688 0.476562 0.421875 
+0.558594 0.484375 0.425781 
+0.570312 0.449219 0.429688 
+0.570312 0.457031 0.429688 
+0.570312 0.480469 0.429688 
+0.570312 0.488281 0.429688 
+0.574219 0.453125 0.441406 
+0.585938 0.464844 0.453125 
+0.574219 0.464844 0.441406 
+0.578125 0.460938 0.445312 
+0.574219 0.484375 0.441406 
+0.585938 0.496094 0.453125 
+0.574219 0.496094 0.441406 
+0.578125 0.492188 0.445312 
+0.582031 0.480469 0.441406 
+0.589844 0.488281 0.449219 
+0.578125 0.472656 0.445312 
+0.589844 0.472656 0.457031 
+0.585938 0.476562 0.453125 
+0.589844 0.484375 0.457031 
+0.601562 0.480469 0.460938 
+0.601562 0.488281 0.460938 
+0.609375 0.488281 0.476562 
+0.609375 0.496094 0.476562 
+0.582031 0.449219 0.441406 
+0.589844 0.457031 0.449219 
+0.523438 0.390625 0.472656 
+0.523438 0.390625 0.480469 
+0.539062 0.398438 0.480469 
+0.539062 0.398438 0.488281 
+0.542969 0.410156 0.484375 
+0.554688 0.421875 0.496094 
+0.542969 0.410156 0.496094 
+0.546875 0.414062 0.492188 
+0.550781 0.410156 0.480469 
+0.558594 0.417969 0.488281 
+0.523438 0.390625 0.441406 
+0.523438 0.390625 0.449219 
+0.539062 0.398438 0.449219 
+0.539062 0.398438 0.457031 
+0.550781 0.417969 0.441406 
+0.558594 0.425781 0.445312 
+0.558594 0.425781 0.453125 
+0.550781 0.410156 0.449219 
+0.558594 0.417969 0.457031 
+0.542969 0.410156 0.453125 
+0.554688 0.421875 0.464844 
+0.542969 0.410156 0.464844 
+0.546875 0.414062 0.460938 
+0.546875 0.414062 0.472656 
+0.558594 0.425781 0.472656 
+0.554688 0.421875 0.476562 
+0.558594 0.425781 0.484375 
+0.570312 0.429688 0.449219 
+0.570312 0.429688 0.457031 
+0.570312 0.429688 0.480469 
+0.570312 0.429688 0.488281 
+0.574219 0.441406 0.453125 
+0.585938 0.453125 0.464844 
+0.574219 0.441406 0.464844 
+0.578125 0.445312 0.460938 
+0.574219 0.441406 0.484375 
+0.585938 0.453125 0.496094 
+0.574219 0.441406 0.496094 
+0.578125 0.445312 0.492188 
+0.582031 0.441406 0.480469 
+0.589844 0.449219 0.488281 
+0.578125 0.445312 0.472656 
+0.589844 0.457031 0.472656 
+0.585938 0.453125 0.476562 
+0.589844 0.457031 0.484375 
+0.601562 0.460938 0.480469 
+0.601562 0.460938 0.488281 
+0.609375 0.476562 0.488281 
+0.609375 0.476562 0.496094 
+0.582031 0.441406 0.449219 
+0.589844 0.449219 0.457031 
+0.472656 0.523438 0.390625 
+0.480469 0.523438 0.390625 
+0.480469 0.539062 0.398438 
+0.488281 0.539062 0.398438 
+0.484375 0.542969 0.410156 
+0.496094 0.554688 0.421875 
+0.496094 0.542969 0.410156 
+0.492188 0.546875 0.414062 
+0.480469 0.550781 0.410156 
+0.488281 0.558594 0.417969 
+0.441406 0.523438 0.390625 
+0.449219 0.523438 0.390625 
+0.449219 0.539062 0.398438 
+0.457031 0.539062 0.398438 
+0.441406 0.550781 0.417969 
+0.445312 0.558594 0.425781 
+0.453125 0.558594 0.425781 
+0.449219 0.550781 0.410156 
+0.457031 0.558594 0.417969 
+0.453125 0.542969 0.410156 
+0.464844 0.554688 0.421875 
+0.464844 0.542969 0.410156 
+0.460938 0.546875 0.414062 
+0.472656 0.546875 0.414062 
+0.472656 0.558594 0.425781 
+0.476562 0.554688 0.421875 
+0.484375 0.558594 0.425781 
+0.449219 0.570312 0.429688 
+0.457031 0.570312 0.429688 
+0.480469 0.570312 0.429688 
+0.488281 0.570312 0.429688 
+0.453125 0.574219 0.441406 
+0.464844 0.585938 0.453125 
+0.464844 0.574219 0.441406 
+0.460938 0.578125 0.445312 
+0.484375 0.574219 0.441406 
+0.496094 0.585938 0.453125 
+0.496094 0.574219 0.441406 
+0.492188 0.578125 0.445312 
+0.480469 0.582031 0.441406 
+0.488281 0.589844 0.449219 
+0.472656 0.578125 0.445312 
+0.472656 0.589844 0.457031 
+0.476562 0.585938 0.453125 
+0.484375 0.589844 0.457031 
+0.480469 0.601562 0.460938 
+0.488281 0.601562 0.460938 
+0.488281 0.609375 0.476562 
+0.496094 0.609375 0.476562 
+0.449219 0.582031 0.441406 
+0.457031 0.589844 0.449219 
+0.390625 0.523438 0.472656 
+0.390625 0.523438 0.480469 
+0.398438 0.539062 0.480469 
+0.398438 0.539062 0.488281 
+0.410156 0.542969 0.484375 
+0.421875 0.554688 0.496094 
+0.410156 0.542969 0.496094 
+0.414062 0.546875 0.492188 
+0.410156 0.550781 0.480469 
+0.417969 0.558594 0.488281 
+0.390625 0.523438 0.441406 
+0.390625 0.523438 0.449219 
+0.398438 0.539062 0.449219 
+0.398438 0.539062 0.457031 
+0.417969 0.550781 0.441406 
+0.425781 0.558594 0.445312 
+0.425781 0.558594 0.453125 
+0.410156 0.550781 0.449219 
+0.417969 0.558594 0.457031 
+0.410156 0.542969 0.453125 
+0.421875 0.554688 0.464844 
+0.410156 0.542969 0.464844 
+0.414062 0.546875 0.460938 
+0.414062 0.546875 0.472656 
+0.425781 0.558594 0.472656 
+0.421875 0.554688 0.476562 
+0.425781 0.558594 0.484375 
+0.429688 0.570312 0.449219 
+0.429688 0.570312 0.457031 
+0.429688 0.570312 0.480469 
+0.429688 0.570312 0.488281 
+0.441406 0.574219 0.453125 
+0.453125 0.585938 0.464844 
+0.441406 0.574219 0.464844 
+0.445312 0.578125 0.460938 
+0.441406 0.574219 0.484375 
+0.453125 0.585938 0.496094 
+0.441406 0.574219 0.496094 
+0.445312 0.578125 0.492188 
+0.441406 0.582031 0.480469 
+0.449219 0.589844 0.488281 
+0.445312 0.578125 0.472656 
+0.457031 0.589844 0.472656 
+0.453125 0.585938 0.476562 
+0.457031 0.589844 0.484375 
+0.460938 0.601562 0.480469 
+0.460938 0.601562 0.488281 
+0.476562 0.609375 0.488281 
+0.476562 0.609375 0.496094 
+0.441406 0.582031 0.449219 
+0.449219 0.589844 0.457031 
+0.523438 0.503906 0.390625 
+0.523438 0.511719 0.390625 
+0.539062 0.511719 0.398438 
+0.539062 0.519531 0.398438 
+0.546875 0.503906 0.414062 
+0.558594 0.503906 0.425781 
+0.554688 0.507812 0.421875 
+0.558594 0.515625 0.425781 
+0.550781 0.511719 0.410156 
+0.558594 0.519531 0.417969 
+0.542969 0.515625 0.410156 
+0.554688 0.527344 0.421875 
+0.542969 0.527344 0.410156 
+0.546875 0.523438 0.414062 
+0.546875 0.535156 0.414062 
+0.558594 0.535156 0.425781 
+0.554688 0.539062 0.421875 
+0.558594 0.546875 0.425781 
+0.570312 0.511719 0.429688 
+0.570312 0.519531 0.429688 
+0.570312 0.542969 0.429688 
+0.570312 0.550781 0.429688 
+0.578125 0.503906 0.445312 
+0.589844 0.503906 0.457031 
+0.585938 0.507812 0.453125 
+0.589844 0.515625 0.457031 
+0.601562 0.511719 0.460938 
+0.601562 0.519531 0.460938 
+0.609375 0.519531 0.476562 
+0.609375 0.527344 0.476562 
+0.582031 0.511719 0.441406 
+0.589844 0.519531 0.449219 
+0.574219 0.515625 0.441406 
+0.585938 0.527344 0.453125 
+0.574219 0.527344 0.441406 
+0.578125 0.523438 0.445312 
+0.574219 0.546875 0.441406 
+0.578125 0.558594 0.445312 
+0.582031 0.554688 0.449219 
+0.582031 0.542969 0.441406 
+0.589844 0.550781 0.449219 
+0.578125 0.535156 0.445312 
+0.589844 0.535156 0.457031 
+0.585938 0.539062 0.453125 
+0.589844 0.546875 0.457031 
+0.601562 0.542969 0.460938 
+0.601562 0.550781 0.460938 
+0.609375 0.550781 0.476562 
+0.609375 0.558594 0.476562 
+0.550781 0.542969 0.410156 
+0.558594 0.550781 0.417969 
+0.503906 0.523438 0.390625 
+0.511719 0.523438 0.390625 
+0.511719 0.539062 0.398438 
+0.519531 0.539062 0.398438 
+0.503906 0.546875 0.414062 
+0.503906 0.558594 0.425781 
+0.507812 0.554688 0.421875 
+0.515625 0.558594 0.425781 
+0.511719 0.550781 0.410156 
+0.519531 0.558594 0.417969 
+0.515625 0.542969 0.410156 
+0.527344 0.554688 0.421875 
+0.527344 0.542969 0.410156 
+0.523438 0.546875 0.414062 
+0.535156 0.546875 0.414062 
+0.535156 0.558594 0.425781 
+0.539062 0.554688 0.421875 
+0.546875 0.558594 0.425781 
+0.511719 0.570312 0.429688 
+0.519531 0.570312 0.429688 
+0.542969 0.570312 0.429688 
+0.550781 0.570312 0.429688 
+0.503906 0.578125 0.445312 
+0.503906 0.589844 0.457031 
+0.507812 0.585938 0.453125 
+0.515625 0.589844 0.457031 
+0.511719 0.601562 0.460938 
+0.519531 0.601562 0.460938 
+0.519531 0.609375 0.476562 
+0.527344 0.609375 0.476562 
+0.511719 0.582031 0.441406 
+0.519531 0.589844 0.449219 
+0.515625 0.574219 0.441406 
+0.527344 0.585938 0.453125 
+0.527344 0.574219 0.441406 
+0.523438 0.578125 0.445312 
+0.546875 0.574219 0.441406 
+0.558594 0.578125 0.445312 
+0.554688 0.582031 0.449219 
+0.542969 0.582031 0.441406 
+0.550781 0.589844 0.449219 
+0.535156 0.578125 0.445312 
+0.535156 0.589844 0.457031 
+0.539062 0.585938 0.453125 
+0.546875 0.589844 0.457031 
+0.542969 0.601562 0.460938 
+0.550781 0.601562 0.460938 
+0.550781 0.609375 0.476562 
+0.558594 0.609375 0.476562 
+0.542969 0.550781 0.410156 
+0.550781 0.558594 0.417969 
+0.472656 0.390625 0.523438 
+0.480469 0.390625 0.523438 
+0.480469 0.398438 0.539062 
+0.488281 0.398438 0.539062 
+0.484375 0.410156 0.542969 
+0.496094 0.421875 0.554688 
+0.496094 0.410156 0.542969 
+0.492188 0.414062 0.546875 
+0.480469 0.410156 0.550781 
+0.488281 0.417969 0.558594 
+0.441406 0.390625 0.523438 
+0.449219 0.390625 0.523438 
+0.449219 0.398438 0.539062 
+0.457031 0.398438 0.539062 
+0.441406 0.417969 0.550781 
+0.445312 0.425781 0.558594 
+0.453125 0.425781 0.558594 
+0.449219 0.410156 0.550781 
+0.457031 0.417969 0.558594 
+0.453125 0.410156 0.542969 
+0.464844 0.421875 0.554688 
+0.464844 0.410156 0.542969 
+0.460938 0.414062 0.546875 
+0.472656 0.414062 0.546875 
+0.472656 0.425781 0.558594 
+0.476562 0.421875 0.554688 
+0.484375 0.425781 0.558594 
+0.449219 0.429688 0.570312 
+0.457031 0.429688 0.570312 
+0.480469 0.429688 0.570312 
+0.488281 0.429688 0.570312 
+0.453125 0.441406 0.574219 
+0.464844 0.453125 0.585938 
+0.464844 0.441406 0.574219 
+0.460938 0.445312 0.578125 
+0.484375 0.441406 0.574219 
+0.496094 0.453125 0.585938 
+0.496094 0.441406 0.574219 
+0.492188 0.445312 0.578125 
+0.480469 0.441406 0.582031 
+0.488281 0.449219 0.589844 
+0.472656 0.445312 0.578125 
+0.472656 0.457031 0.589844 
+0.476562 0.453125 0.585938 
+0.484375 0.457031 0.589844 
+0.480469 0.460938 0.601562 
+0.488281 0.460938 0.601562 
+0.488281 0.476562 0.609375 
+0.496094 0.476562 0.609375 
+0.449219 0.441406 0.582031 
+0.457031 0.449219 0.589844 
+0.390625 0.472656 0.523438 
+0.390625 0.480469 0.523438 
+0.398438 0.480469 0.539062 
+0.398438 0.488281 0.539062 
+0.410156 0.484375 0.542969 
+0.421875 0.496094 0.554688 
+0.410156 0.496094 0.542969 
+0.414062 0.492188 0.546875 
+0.410156 0.480469 0.550781 
+0.417969 0.488281 0.558594 
+0.390625 0.441406 0.523438 
+0.390625 0.449219 0.523438 
+0.398438 0.449219 0.539062 
+0.398438 0.457031 0.539062 
+0.417969 0.441406 0.550781 
+0.425781 0.445312 0.558594 
+0.425781 0.453125 0.558594 
+0.410156 0.449219 0.550781 
+0.417969 0.457031 0.558594 
+0.410156 0.453125 0.542969 
+0.421875 0.464844 0.554688 
+0.410156 0.464844 0.542969 
+0.414062 0.460938 0.546875 
+0.414062 0.472656 0.546875 
+0.425781 0.472656 0.558594 
+0.421875 0.476562 0.554688 
+0.425781 0.484375 0.558594 
+0.429688 0.449219 0.570312 
+0.429688 0.457031 0.570312 
+0.429688 0.480469 0.570312 
+0.429688 0.488281 0.570312 
+0.441406 0.453125 0.574219 
+0.453125 0.464844 0.585938 
+0.441406 0.464844 0.574219 
+0.445312 0.460938 0.578125 
+0.441406 0.484375 0.574219 
+0.453125 0.496094 0.585938 
+0.441406 0.496094 0.574219 
+0.445312 0.492188 0.578125 
+0.441406 0.480469 0.582031 
+0.449219 0.488281 0.589844 
+0.445312 0.472656 0.578125 
+0.457031 0.472656 0.589844 
+0.453125 0.476562 0.585938 
+0.457031 0.484375 0.589844 
+0.460938 0.480469 0.601562 
+0.460938 0.488281 0.601562 
+0.476562 0.488281 0.609375 
+0.476562 0.496094 0.609375 
+0.441406 0.449219 0.582031 
+0.449219 0.457031 0.589844 
+0.523438 0.390625 0.503906 
+0.523438 0.390625 0.511719 
+0.539062 0.398438 0.511719 
+0.539062 0.398438 0.519531 
+0.546875 0.414062 0.503906 
+0.558594 0.425781 0.503906 
+0.554688 0.421875 0.507812 
+0.558594 0.425781 0.515625 
+0.550781 0.410156 0.511719 
+0.558594 0.417969 0.519531 
+0.542969 0.410156 0.515625 
+0.554688 0.421875 0.527344 
+0.542969 0.410156 0.527344 
+0.546875 0.414062 0.523438 
+0.546875 0.414062 0.535156 
+0.558594 0.425781 0.535156 
+0.554688 0.421875 0.539062 
+0.558594 0.425781 0.546875 
+0.570312 0.429688 0.511719 
+0.570312 0.429688 0.519531 
+0.570312 0.429688 0.542969 
+0.570312 0.429688 0.550781 
+0.578125 0.445312 0.503906 
+0.589844 0.457031 0.503906 
+0.585938 0.453125 0.507812 
+0.589844 0.457031 0.515625 
+0.601562 0.460938 0.511719 
+0.601562 0.460938 0.519531 
+0.609375 0.476562 0.519531 
+0.609375 0.476562 0.527344 
+0.582031 0.441406 0.511719 
+0.589844 0.449219 0.519531 
+0.574219 0.441406 0.515625 
+0.585938 0.453125 0.527344 
+0.574219 0.441406 0.527344 
+0.578125 0.445312 0.523438 
+0.574219 0.441406 0.546875 
+0.578125 0.445312 0.558594 
+0.582031 0.449219 0.554688 
+0.582031 0.441406 0.542969 
+0.589844 0.449219 0.550781 
+0.578125 0.445312 0.535156 
+0.589844 0.457031 0.535156 
+0.585938 0.453125 0.539062 
+0.589844 0.457031 0.546875 
+0.601562 0.460938 0.542969 
+0.601562 0.460938 0.550781 
+0.609375 0.476562 0.550781 
+0.609375 0.476562 0.558594 
+0.550781 0.410156 0.542969 
+0.558594 0.417969 0.550781 
+0.503906 0.390625 0.523438 
+0.511719 0.390625 0.523438 
+0.511719 0.398438 0.539062 
+0.519531 0.398438 0.539062 
+0.503906 0.414062 0.546875 
+0.503906 0.425781 0.558594 
+0.507812 0.421875 0.554688 
+0.515625 0.425781 0.558594 
+0.511719 0.410156 0.550781 
+0.519531 0.417969 0.558594 
+0.515625 0.410156 0.542969 
+0.527344 0.421875 0.554688 
+0.527344 0.410156 0.542969 
+0.523438 0.414062 0.546875 
+0.535156 0.414062 0.546875 
+0.535156 0.425781 0.558594 
+0.539062 0.421875 0.554688 
+0.546875 0.425781 0.558594 
+0.511719 0.429688 0.570312 
+0.519531 0.429688 0.570312 
+0.542969 0.429688 0.570312 
+0.550781 0.429688 0.570312 
+0.503906 0.445312 0.578125 
+0.503906 0.457031 0.589844 
+0.507812 0.453125 0.585938 
+0.515625 0.457031 0.589844 
+0.511719 0.460938 0.601562 
+0.519531 0.460938 0.601562 
+0.519531 0.476562 0.609375 
+0.527344 0.476562 0.609375 
+0.511719 0.441406 0.582031 
+0.519531 0.449219 0.589844 
+0.515625 0.441406 0.574219 
+0.527344 0.453125 0.585938 
+0.527344 0.441406 0.574219 
+0.523438 0.445312 0.578125 
+0.546875 0.441406 0.574219 
+0.558594 0.445312 0.578125 
+0.554688 0.449219 0.582031 
+0.542969 0.441406 0.582031 
+0.550781 0.449219 0.589844 
+0.535156 0.445312 0.578125 
+0.535156 0.457031 0.589844 
+0.539062 0.453125 0.585938 
+0.546875 0.457031 0.589844 
+0.542969 0.460938 0.601562 
+0.550781 0.460938 0.601562 
+0.550781 0.476562 0.609375 
+0.558594 0.476562 0.609375 
+0.542969 0.410156 0.550781 
+0.550781 0.417969 0.558594 
+0.390625 0.523438 0.503906 
+0.390625 0.523438 0.511719 
+0.398438 0.539062 0.511719 
+0.398438 0.539062 0.519531 
+0.414062 0.546875 0.503906 
+0.425781 0.558594 0.503906 
+0.421875 0.554688 0.507812 
+0.425781 0.558594 0.515625 
+0.410156 0.550781 0.511719 
+0.417969 0.558594 0.519531 
+0.410156 0.542969 0.515625 
+0.421875 0.554688 0.527344 
+0.410156 0.542969 0.527344 
+0.414062 0.546875 0.523438 
+0.414062 0.546875 0.535156 
+0.425781 0.558594 0.535156 
+0.421875 0.554688 0.539062 
+0.425781 0.558594 0.546875 
+0.429688 0.570312 0.511719 
+0.429688 0.570312 0.519531 
+0.429688 0.570312 0.542969 
+0.429688 0.570312 0.550781 
+0.445312 0.578125 0.503906 
+0.457031 0.589844 0.503906 
+0.453125 0.585938 0.507812 
+0.457031 0.589844 0.515625 
+0.460938 0.601562 0.511719 
+0.460938 0.601562 0.519531 
+0.476562 0.609375 0.519531 
+0.476562 0.609375 0.527344 
+0.441406 0.582031 0.511719 
+0.449219 0.589844 0.519531 
+0.441406 0.574219 0.515625 
+0.453125 0.585938 0.527344 
+0.441406 0.574219 0.527344 
+0.445312 0.578125 0.523438 
+0.441406 0.574219 0.546875 
+0.445312 0.578125 0.558594 
+0.449219 0.582031 0.554688 
+0.441406 0.582031 0.542969 
+0.449219 0.589844 0.550781 
+0.445312 0.578125 0.535156 
+0.457031 0.589844 0.535156 
+0.453125 0.585938 0.539062 
+0.457031 0.589844 0.546875 
+0.460938 0.601562 0.542969 
+0.460938 0.601562 0.550781 
+0.476562 0.609375 0.550781 
+0.476562 0.609375 0.558594 
+0.410156 0.550781 0.542969 
+0.417969 0.558594 0.550781 
+0.390625 0.503906 0.523438 
+0.390625 0.511719 0.523438 
+0.398438 0.511719 0.539062 
+0.398438 0.519531 0.539062 
+0.414062 0.503906 0.546875 
+0.425781 0.503906 0.558594 
+0.421875 0.507812 0.554688 
+0.425781 0.515625 0.558594 
+0.410156 0.511719 0.550781 
+0.417969 0.519531 0.558594 
+0.410156 0.515625 0.542969 
+0.421875 0.527344 0.554688 
+0.410156 0.527344 0.542969 
+0.414062 0.523438 0.546875 
+0.414062 0.535156 0.546875 
+0.425781 0.535156 0.558594 
+0.421875 0.539062 0.554688 
+0.425781 0.546875 0.558594 
+0.429688 0.511719 0.570312 
+0.429688 0.519531 0.570312 
+0.429688 0.542969 0.570312 
+0.429688 0.550781 0.570312 
+0.445312 0.503906 0.578125 
+0.457031 0.503906 0.589844 
+0.453125 0.507812 0.585938 
+0.457031 0.515625 0.589844 
+0.460938 0.511719 0.601562 
+0.460938 0.519531 0.601562 
+0.476562 0.519531 0.609375 
+0.476562 0.527344 0.609375 
+0.441406 0.511719 0.582031 
+0.449219 0.519531 0.589844 
+0.441406 0.515625 0.574219 
+0.453125 0.527344 0.585938 
+0.441406 0.527344 0.574219 
+0.445312 0.523438 0.578125 
+0.441406 0.546875 0.574219 
+0.445312 0.558594 0.578125 
+0.449219 0.554688 0.582031 
+0.441406 0.542969 0.582031 
+0.449219 0.550781 0.589844 
+0.445312 0.535156 0.578125 
+0.457031 0.535156 0.589844 
+0.453125 0.539062 0.585938 
+0.457031 0.546875 0.589844 
+0.460938 0.542969 0.601562 
+0.460938 0.550781 0.601562 
+0.476562 0.550781 0.609375 
+0.476562 0.558594 0.609375 
+0.410156 0.542969 0.550781 
+0.417969 0.550781 0.558594 
+0.515625 0.511719 0.507812 
+0.527344 0.511719 0.507812 
+0.523438 0.515625 0.507812 
+0.527344 0.523438 0.507812 
+0.546875 0.511719 0.507812 
+0.558594 0.511719 0.507812 
+0.554688 0.515625 0.507812 
+0.558594 0.523438 0.507812 
+0.542969 0.515625 0.507812 
+0.542969 0.527344 0.507812 
+0.546875 0.523438 0.507812 
+0.554688 0.527344 0.507812 
+0.539062 0.519531 0.515625 
+0.539062 0.527344 0.515625 
+0.546875 0.542969 0.507812 
+0.558594 0.542969 0.507812 
+0.554688 0.546875 0.507812 
+0.558594 0.554688 0.507812 
+0.550781 0.539062 0.515625 
+0.558594 0.539062 0.515625 
+0.578125 0.511719 0.507812 
+0.589844 0.511719 0.507812 
+0.585938 0.515625 0.507812 
+0.589844 0.523438 0.507812 
+0.609375 0.519531 0.507812 
+0.609375 0.527344 0.507812 
+0.601562 0.519531 0.515625 
+0.601562 0.527344 0.515625 
+0.574219 0.515625 0.507812 
+0.574219 0.527344 0.507812 
+0.578125 0.523438 0.507812 
+0.585938 0.527344 0.507812 
+0.574219 0.546875 0.507812 
+0.574219 0.558594 0.507812 
+0.578125 0.554688 0.507812 
+0.585938 0.558594 0.507812 
+0.578125 0.542969 0.507812 
+0.589844 0.542969 0.507812 
+0.585938 0.546875 0.507812 
+0.589844 0.554688 0.507812 
+0.582031 0.539062 0.515625 
+0.589844 0.539062 0.515625 
+0.609375 0.550781 0.507812 
+0.609375 0.558594 0.507812 
+0.601562 0.550781 0.515625 
+0.601562 0.558594 0.515625 
+0.570312 0.519531 0.515625 
+0.570312 0.527344 0.515625 
+0.570312 0.550781 0.515625 
+0.570312 0.558594 0.515625 
+0.582031 0.578125 0.507812 
+0.589844 0.578125 0.507812 
+0.582031 0.570312 0.515625 
+0.589844 0.570312 0.515625 
+0.515625 0.507812 0.511719 
+0.527344 0.507812 0.511719 
+0.523438 0.507812 0.515625 
+0.527344 0.507812 0.523438 
+0.546875 0.507812 0.511719 
+0.558594 0.507812 0.511719 
+0.554688 0.507812 0.515625 
+0.558594 0.507812 0.523438 
+0.542969 0.507812 0.515625 
+0.542969 0.507812 0.527344 
+0.546875 0.507812 0.523438 
+0.554688 0.507812 0.527344 
+0.539062 0.515625 0.519531 
+0.539062 0.515625 0.527344 
+0.546875 0.507812 0.542969 
+0.558594 0.507812 0.542969 
+0.554688 0.507812 0.546875 
+0.558594 0.507812 0.554688 
+0.550781 0.515625 0.539062 
+0.558594 0.515625 0.539062 
+0.578125 0.507812 0.511719 
+0.589844 0.507812 0.511719 
+0.585938 0.507812 0.515625 
+0.589844 0.507812 0.523438 
+0.609375 0.507812 0.519531 
+0.609375 0.507812 0.527344 
+0.601562 0.515625 0.519531 
+0.601562 0.515625 0.527344 
+0.574219 0.507812 0.515625 
+0.574219 0.507812 0.527344 
+0.578125 0.507812 0.523438 
+0.585938 0.507812 0.527344 
+0.574219 0.507812 0.546875 
+0.574219 0.507812 0.558594 
+0.578125 0.507812 0.554688 
+0.585938 0.507812 0.558594 
+0.578125 0.507812 0.542969 
+0.589844 0.507812 0.542969 
+0.585938 0.507812 0.546875 
+0.589844 0.507812 0.554688 
+0.582031 0.515625 0.539062 
+0.589844 0.515625 0.539062 
+0.609375 0.507812 0.550781 
+0.609375 0.507812 0.558594 
+0.601562 0.515625 0.550781 
+0.601562 0.515625 0.558594 
+0.570312 0.515625 0.519531 
+0.570312 0.515625 0.527344 
+0.570312 0.515625 0.550781 
+0.570312 0.515625 0.558594 
+0.582031 0.507812 0.578125 
+0.589844 0.507812 0.578125 
+0.582031 0.515625 0.570312 
+0.589844 0.515625 0.570312 
+0.511719 0.515625 0.507812 
+0.511719 0.527344 0.507812 
+0.515625 0.523438 0.507812 
+0.523438 0.527344 0.507812 
+0.511719 0.546875 0.507812 
+0.511719 0.558594 0.507812 
+0.515625 0.554688 0.507812 
+0.523438 0.558594 0.507812 
+0.515625 0.542969 0.507812 
+0.527344 0.542969 0.507812 
+0.523438 0.546875 0.507812 
+0.527344 0.554688 0.507812 
+0.519531 0.539062 0.515625 
+0.527344 0.539062 0.515625 
+0.542969 0.546875 0.507812 
+0.542969 0.558594 0.507812 
+0.546875 0.554688 0.507812 
+0.554688 0.558594 0.507812 
+0.539062 0.550781 0.515625 
+0.539062 0.558594 0.515625 
+0.511719 0.578125 0.507812 
+0.511719 0.589844 0.507812 
+0.515625 0.585938 0.507812 
+0.523438 0.589844 0.507812 
+0.519531 0.609375 0.507812 
+0.527344 0.609375 0.507812 
+0.519531 0.601562 0.515625 
+0.527344 0.601562 0.515625 
+0.515625 0.574219 0.507812 
+0.527344 0.574219 0.507812 
+0.523438 0.578125 0.507812 
+0.527344 0.585938 0.507812 
+0.546875 0.574219 0.507812 
+0.558594 0.574219 0.507812 
+0.554688 0.578125 0.507812 
+0.558594 0.585938 0.507812 
+0.542969 0.578125 0.507812 
+0.542969 0.589844 0.507812 
+0.546875 0.585938 0.507812 
+0.554688 0.589844 0.507812 
+0.539062 0.582031 0.515625 
+0.539062 0.589844 0.515625 
+0.550781 0.609375 0.507812 
+0.558594 0.609375 0.507812 
+0.550781 0.601562 0.515625 
+0.558594 0.601562 0.515625 
+0.519531 0.570312 0.515625 
+0.527344 0.570312 0.515625 
+0.550781 0.570312 0.515625 
+0.558594 0.570312 0.515625 
+0.578125 0.582031 0.507812 
+0.578125 0.589844 0.507812 
+0.570312 0.582031 0.515625 
+0.570312 0.589844 0.515625 
+0.507812 0.515625 0.511719 
+0.507812 0.527344 0.511719 
+0.507812 0.523438 0.515625 
+0.507812 0.527344 0.523438 
+0.507812 0.546875 0.511719 
+0.507812 0.558594 0.511719 
+0.507812 0.554688 0.515625 
+0.507812 0.558594 0.523438 
+0.507812 0.542969 0.515625 
+0.507812 0.542969 0.527344 
+0.507812 0.546875 0.523438 
+0.507812 0.554688 0.527344 
+0.515625 0.539062 0.519531 
+0.515625 0.539062 0.527344 
+0.507812 0.546875 0.542969 
+0.507812 0.558594 0.542969 
+0.507812 0.554688 0.546875 
+0.507812 0.558594 0.554688 
+0.515625 0.550781 0.539062 
+0.515625 0.558594 0.539062 
+0.507812 0.578125 0.511719 
+0.507812 0.589844 0.511719 
+0.507812 0.585938 0.515625 
+0.507812 0.589844 0.523438 
+0.507812 0.609375 0.519531 
+0.507812 0.609375 0.527344 
+0.515625 0.601562 0.519531 
+0.515625 0.601562 0.527344 
+0.507812 0.574219 0.515625 
+0.507812 0.574219 0.527344 
+0.507812 0.578125 0.523438 
+0.507812 0.585938 0.527344 
+0.507812 0.574219 0.546875 
+0.507812 0.574219 0.558594 
+0.507812 0.578125 0.554688 
+0.507812 0.585938 0.558594 
+0.507812 0.578125 0.542969 
+0.507812 0.589844 0.542969 
+0.507812 0.585938 0.546875 
+0.507812 0.589844 0.554688 
+0.515625 0.582031 0.539062 
+0.515625 0.589844 0.539062 
+0.507812 0.609375 0.550781 
+0.507812 0.609375 0.558594 
+0.515625 0.601562 0.550781 
+0.515625 0.601562 0.558594 
+0.515625 0.570312 0.519531 
+0.515625 0.570312 0.527344 
+0.515625 0.570312 0.550781 
+0.515625 0.570312 0.558594 
+0.507812 0.582031 0.578125 
+0.507812 0.589844 0.578125 
+0.515625 0.582031 0.570312 
+0.515625 0.589844 0.570312 
+0.511719 0.507812 0.515625 
+0.511719 0.507812 0.527344 
+0.515625 0.507812 0.523438 
+0.523438 0.507812 0.527344 
+0.511719 0.507812 0.546875 
+0.511719 0.507812 0.558594 
+0.515625 0.507812 0.554688 
+0.523438 0.507812 0.558594 
+0.515625 0.507812 0.542969 
+0.527344 0.507812 0.542969 
+0.523438 0.507812 0.546875 
+0.527344 0.507812 0.554688 
+0.519531 0.515625 0.539062 
+0.527344 0.515625 0.539062 
+0.542969 0.507812 0.546875 
+0.542969 0.507812 0.558594 
+0.546875 0.507812 0.554688 
+0.554688 0.507812 0.558594 
+0.539062 0.515625 0.550781 
+0.539062 0.515625 0.558594 
+0.511719 0.507812 0.578125 
+0.511719 0.507812 0.589844 
+0.515625 0.507812 0.585938 
+0.523438 0.507812 0.589844 
+0.519531 0.507812 0.609375 
+0.527344 0.507812 0.609375 
+0.519531 0.515625 0.601562 
+0.527344 0.515625 0.601562 
+0.515625 0.507812 0.574219 
+0.527344 0.507812 0.574219 
+0.523438 0.507812 0.578125 
+0.527344 0.507812 0.585938 
+0.546875 0.507812 0.574219 
+0.558594 0.507812 0.574219 
+0.554688 0.507812 0.578125 
+0.558594 0.507812 0.585938 
+0.542969 0.507812 0.578125 
+0.542969 0.507812 0.589844 
+0.546875 0.507812 0.585938 
+0.554688 0.507812 0.589844 
+0.539062 0.515625 0.582031 
+0.539062 0.515625 0.589844 
+0.550781 0.507812 0.609375 
+0.558594 0.507812 0.609375 
+0.550781 0.515625 0.601562 
+0.558594 0.515625 0.601562 
+0.519531 0.515625 0.570312 
+0.527344 0.515625 0.570312 
+0.550781 0.515625 0.570312 
+0.558594 0.515625 0.570312 
+0.578125 0.507812 0.582031 
+0.578125 0.507812 0.589844 
+0.570312 0.515625 0.582031 
+0.570312 0.515625 0.589844 
+0.507812 0.511719 0.515625 
+0.507812 0.511719 0.527344 
+0.507812 0.515625 0.523438 
+0.507812 0.523438 0.527344 
+0.507812 0.511719 0.546875 
+0.507812 0.511719 0.558594 
+0.507812 0.515625 0.554688 
+0.507812 0.523438 0.558594 
+0.507812 0.515625 0.542969 
+0.507812 0.527344 0.542969 
+0.507812 0.523438 0.546875 
+0.507812 0.527344 0.554688 
+0.515625 0.519531 0.539062 
+0.515625 0.527344 0.539062 
+0.507812 0.542969 0.546875 
+0.507812 0.542969 0.558594 
+0.507812 0.546875 0.554688 
+0.507812 0.554688 0.558594 
+0.515625 0.539062 0.550781 
+0.515625 0.539062 0.558594 
+0.507812 0.511719 0.578125 
+0.507812 0.511719 0.589844 
+0.507812 0.515625 0.585938 
+0.507812 0.523438 0.589844 
+0.507812 0.519531 0.609375 
+0.507812 0.527344 0.609375 
+0.515625 0.519531 0.601562 
+0.515625 0.527344 0.601562 
+0.507812 0.515625 0.574219 
+0.507812 0.527344 0.574219 
+0.507812 0.523438 0.578125 
+0.507812 0.527344 0.585938 
+0.507812 0.546875 0.574219 
+0.507812 0.558594 0.574219 
+0.507812 0.554688 0.578125 
+0.507812 0.558594 0.585938 
+0.507812 0.542969 0.578125 
+0.507812 0.542969 0.589844 
+0.507812 0.546875 0.585938 
+0.507812 0.554688 0.589844 
+0.515625 0.539062 0.582031 
+0.515625 0.539062 0.589844 
+0.507812 0.550781 0.609375 
+0.507812 0.558594 0.609375 
+0.515625 0.550781 0.601562 
+0.515625 0.558594 0.601562 
+0.515625 0.519531 0.570312 
+0.515625 0.527344 0.570312 
+0.515625 0.550781 0.570312 
+0.515625 0.558594 0.570312 
+0.507812 0.578125 0.582031 
+0.507812 0.578125 0.589844 
+0.515625 0.570312 0.582031 
+0.515625 0.570312 0.589844 
@@ -116,5 +116,18 @@ int main()
         if ( &*it != ad[i] )
             cout << " Adresse verschieden fuer: " << i << endl;
 
+    // A node, which is spliced to another level and freed there, still belongs to the slab of its original level.
+    SlabArenaCL arena;
+    iList::LevelCont* l3= new iList::LevelCont( iList::Allocator( &arena, 1));
+    iList::LevelCont l4( iList::Allocator( &arena, 0));
+    l3->push_back( 1);
+    l4.splice( l4.end(), *l3);
+    delete l3;
+    arena.release_level( 1);
+    cout << "Slabs nach release_level mit verschobenem Element: " << arena.GetNumSlabs() << endl;
+    l4.clear();
+    arena.release_level( 1);
+    cout << "Slabs nach release_level ohne Elemente: " << arena.GetNumSlabs() << endl;
+
     return 0;
 }
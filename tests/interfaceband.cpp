@@ -0,0 +1,212 @@
+/// \file interfaceband.cpp
+/// \brief tests the band of tetras near the zero level of the level set function against the traversal of all tetras, the volume correction on the band and the cached smoothing operator
+/// \author LNM RWTH Aachen: Joerg Grande; SC RWTH Aachen:
+
+/*
+ * This file is part of DROPS.
+ *
+ * DROPS is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * DROPS is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with DROPS. If not, see <http://www.gnu.org/licenses/>.
+ *
+ *
+ * Copyright 2011 LNM/SC RWTH Aachen, Germany
+*/
+
+#include "geom/builder.h"
+#include "levelset/levelset.h"
+#include <iostream>
+#include <iomanip>
+#include <algorithm>
+
+using namespace DROPS;
+
+double sphere (const Point3DCL& p)
+{
+    return (p - Point3DCL( 0.5)).norm() - 0.3;
+}
+
+double sigmaf (const Point3DCL&, double) { return 1.; }
+
+void MarkInterface (MultiGridCL& mg)
+{
+    DROPS_FOR_TRIANG_TETRA( mg, -1, It)
+        if (std::fabs( sphere( GetBaryCenter( *It))) <= 1.5*std::pow( It->GetVolume(), 1.0/3.0))
+            It->SetRegRefMark();
+}
+
+/// \brief Checks, that all cut tetras are in the band.
+int TestCutTetras (const MultiGridCL& mg, const LevelsetP2CL& lset, const InterfaceBandCL& band)
+{
+    InterfaceTetraCL cut;
+    ColorClassesCL::ColorClassT tetras( band.GetTetras());
+    std::sort( tetras.begin(), tetras.end());
+    size_t num_cut= 0, num_tetra= 0, missing= 0;
+    DROPS_FOR_TRIANG_CONST_TETRA( mg, lset.Phi.GetLevel(), it) {
+        ++num_tetra;
+        cut.Init( *it, lset.Phi, lset.GetBndData());
+        if (cut.Intersects()) {
+            ++num_cut;
+            missing+= !std::binary_search( tetras.begin(), tetras.end(), &*it);
+        }
+    }
+    std::cout << "layers: " << band.GetLayers() << "\ttetras: " << num_tetra << "\tcut: " << num_cut
+              << "\tband: " << band.size() << "\tmissing: " << missing << std::endl;
+    return missing > 0 || band.size() >= num_tetra;
+}
+
+/// \brief Compares the volume, the surface force and the XFEM-numbering computed on the band with the traversal of all tetras.
+int TestConsumers (MultiGridCL& mg, LevelsetP2CL& lset, int layers)
+{
+    const Uint lvl= lset.Phi.GetLevel();
+    const double translations[3]= { 0., 1e-3, -0.2 };
+    const int    quads[3]= { 2, 3, -1 };
+
+    IdxDescCL vidx( vecP2_FE);
+    vidx.CreateNumbering( lvl, mg);
+    VecDescCL f_ref( &vidx), f( &vidx);
+    IdxDescCL pidx( P1X_FE);
+    pidx.CreateNumbering( lvl, mg, &lset.Phi, &lset.GetBndData());
+
+    double vol_ref[3][3];
+    lset.SetBandLayers( -1);
+    for (int i= 0; i < 3; ++i)
+        for (int j= 0; j < 3; ++j)
+            vol_ref[i][j]= lset.GetVolume( translations[i], quads[j]);
+    lset.AccumulateBndIntegral( f_ref);
+    pidx.UpdateXNumbering( mg, lset.Phi, lset.GetBndData());
+    std::vector<IdxT> xidx_ref;
+    for (IdxT i= 0; i < pidx.GetXidx().GetNumUnknownsStdFE(); ++i)
+        xidx_ref.push_back( pidx.GetXidx()[i]);
+    const IdxT num_ref= pidx.NumUnknowns();
+
+    lset.SetBandLayers( layers);
+    const InterfaceBandCL* band= lset.GetBand();
+    int ret= TestCutTetras( mg, lset, *band);
+    double err_vol= 0.;
+    for (int i= 0; i < 3; ++i)
+        for (int j= 0; j < 3; ++j)
+            err_vol= std::max( err_vol, std::fabs( lset.GetVolume( translations[i], quads[j]) - vol_ref[i][j]));
+    lset.AccumulateBndIntegral( f);
+    const double err_f= supnorm( VectorCL( f.Data - f_ref.Data));
+    pidx.UpdateXNumbering( mg, lset.Phi, lset.GetBndData(), band);
+    bool xidx_equal= num_ref == pidx.NumUnknowns();
+    for (IdxT i= 0; i < pidx.GetXidx().GetNumUnknownsStdFE(); ++i)
+        xidx_equal= xidx_equal && xidx_ref[i] == pidx.GetXidx()[i];
+    std::cout << "threads: " << omp_get_max_threads() << "\tvolume equal: " << (err_vol < 1e-14)
+              << "\tsurface force equal: " << (err_f < 1e-14) << "\tXFEM-numbering equal: " << xidx_equal
+              << "\textended dof: " << pidx.NumUnknowns() - pidx.GetXidx().GetNumUnknownsStdFE() << std::endl;
+    ret+= err_vol >= 1e-14 || err_f >= 1e-14 || !xidx_equal;
+
+    pidx.DeleteNumbering( mg);
+    vidx.DeleteNumbering( mg);
+    return ret;
+}
+
+/// \brief Checks, that the band is only recomputed, if the level set function or the multigrid changed.
+int TestCaching (MultiGridCL& mg, LevelsetP2CL& lset)
+{
+    lset.SetBandLayers( 1);
+    const InterfaceBandCL* band= lset.GetBand();
+    const bool valid= band->IsValid( mg, lset.Phi);
+    lset.Phi.Data+= 0.05;
+    const bool invalid_phi= !band->IsValid( mg, lset.Phi);
+    lset.GetBand();
+    const bool updated= band->IsValid( mg, lset.Phi);
+    lset.Phi.Data-= 0.05;
+    lset.GetBand();
+    mg.IncrementVersion();
+    const bool invalid_mg= !band->IsValid( mg, lset.Phi);
+    std::cout << "valid: " << valid << "\tinvalid after change of Phi: " << invalid_phi
+              << "\tupdated: " << updated << "\tinvalid after change of the multigrid: " << invalid_mg << std::endl;
+    return !(valid && invalid_phi && updated && invalid_mg);
+}
+
+/// \brief Shifts the level set function and corrects the volume with and without band. Both must restore the volume up to the tolerance.
+int TestAdjustVolume (LevelsetP2CL& lset)
+{
+    const double tol= 1e-9, shift= 0.01;
+    double dphi[2], err[2];
+    for (int layers= -1; layers < 2; layers+= 2) {
+        lset.SetBandLayers( -1);
+        const double vol= lset.GetVolume();
+        lset.Phi.Data+= shift;
+        lset.SetBandLayers( layers);
+        const int i= layers > 0;
+        dphi[i]= lset.AdjustVolume( vol, tol);
+        err[i]= std::fabs( lset.GetVolume( dphi[i]) - vol)/vol;
+        lset.Phi.Data-= shift;
+    }
+    std::cout << "volume correction: rel. error without / with band: " << (err[0] <= tol) << " / " << (err[1] <= tol)
+              << "\ttranslation without / with band: " << std::setprecision( 4) << dphi[0] << " / " << dphi[1] << std::endl;
+    return err[0] > tol || err[1] > tol || std::fabs( dphi[0] + shift) > 1e-3 || std::fabs( dphi[1] - dphi[0]) > 1e-6;
+}
+
+/// \brief Smooths the shifted level set function with the operator and the initial guess of the last smoothing; the result must coincide with the smoothing by a new level set object.
+int TestSmoothing (MultiGridCL& mg, const LsetBndDataCL& lsbnd, SurfaceTensionCL& sf)
+{
+    const double curvDiff= 1e-3;
+    LevelsetP2CL lset( mg, lsbnd, sf, 0, curvDiff);
+    lset.CreateNumbering( mg.GetLastLevel(), &lset.idx);
+    lset.Phi.SetIdx( &lset.idx);
+    double diff= 0.;
+    for (int step= 0; step < 4; ++step) {
+        if (step == 3) // the operator must be rebuilt
+            mg.IncrementVersion();
+        lset.Init( sphere);
+        lset.Phi.Data+= 0.01*step;
+        VectorCL smoothed( lset.Phi.Data);
+        lset.MaybeSmooth( smoothed);
+
+        LevelsetP2CL ref( mg, lsbnd, sf, 0, curvDiff);
+        ref.Phi.SetIdx( &lset.idx);
+        ref.Phi.Data= lset.Phi.Data;
+        VectorCL ref_smoothed( ref.Phi.Data);
+        ref.MaybeSmooth( ref_smoothed);
+        diff= std::max( diff, supnorm( VectorCL( smoothed - ref_smoothed)));
+    }
+    lset.DeleteNumbering( &lset.idx);
+    std::cout << "smoothing: equal to new operator: " << (diff < 1e-8) << std::endl;
+    return diff >= 1e-8;
+}
+
+int main ()
+{
+  try {
+    BrickBuilderCL brick( Point3DCL( 0.), 1.*std_basis<3>( 1), 1.*std_basis<3>( 2), 1.*std_basis<3>( 3), 6, 6, 6);
+    MultiGridCL mg( brick);
+    for (int i= 0; i < 2; ++i) {
+        MarkInterface( mg);
+        mg.Refine();
+    }
+
+    SurfaceTensionCL sf( sigmaf);
+    BndCondT bc[6]= { NoBC, NoBC, NoBC, NoBC, NoBC, NoBC };
+    LsetBndDataCL::bnd_val_fun bfun[6]= { 0,0,0,0,0,0 };
+    LsetBndDataCL lsbnd( 6, bc, bfun);
+    LevelsetP2CL lset( mg, lsbnd, sf);
+    lset.CreateNumbering( mg.GetLastLevel(), &lset.idx);
+    lset.Phi.SetIdx( &lset.idx);
+    lset.Init( sphere);
+
+    int ret= 0;
+    for (int layers= 0; layers < 3; ++layers) {
+        lset.SetSurfaceForce( layers == 1 ? SF_Const : SF_ImprovedLB);
+        ret+= TestConsumers( mg, lset, layers);
+    }
+    ret+= TestAdjustVolume( lset);
+    ret+= TestSmoothing( mg, lsbnd, sf);
+    ret+= TestCaching( mg, lset);
+    return ret;
+  }
+  catch (DROPSErrCL err) { err.handle(); }
+}
@@ -325,6 +325,83 @@ int TestRepair()
     return ret;
 }
 
+int TestRepairSet()
+{
+    BndDataCL<> bnd( 6);
+    BndDataCL<Point3DCL> vbnd( 6);
+    int ret= 0;
+    DROPS::BrickBuilderCL brick( DROPS::std_basis<3>( 0), DROPS::std_basis<3>( 1),
+                                 DROPS::std_basis<3>( 2), DROPS::std_basis<3>( 3),
+                                 2, 2, 2);
+    DROPS::MultiGridCL mg(brick);
+    for (DROPS::Uint i=0; i<3; ++i) {
+        MarkDrop( mg, mg.GetLastLevel());
+        mg.Refine();
+    }
+    std::cout << "\n-----------------------------------------------------------------"
+                 "\nTesting repair of several functions after a sequence of refinements and coarsenings:\n";
+    DROPS::IdxDescCL i0( P2_FE, Bnd), i1( P2_FE, Bnd), j0( P1_FE, Bnd), j1( P1_FE, Bnd), k0( vecP2_FE), k1( vecP2_FE);
+    i0.CreateNumbering( mg.GetLastLevel(), mg);
+    j0.CreateNumbering( mg.GetLastLevel(), mg);
+    k0.CreateNumbering( mg.GetLastLevel(), mg);
+    DROPS::VecDescCL v0( &i0), v1, w0( &j0), w1, u0( &k0), u1;
+    SetFun( v0, mg, f);
+    DROPS_FOR_TRIANG_VERTEX( mg, mg.GetLastLevel(), it) {
+        w0.Data[it->Unknowns( j0.GetIdx())]= g( it->GetCoord());
+        DoFHelperCL<Point3DCL, VectorCL>::set( u0.Data, it->Unknowns( k0.GetIdx()), MakePoint3D( f( it->GetCoord()), g( it->GetCoord()), 1.));
+    }
+    DROPS_FOR_TRIANG_EDGE( mg, mg.GetLastLevel(), it) {
+        const Point3DCL x= GetBaryCenter( *it);
+        DoFHelperCL<Point3DCL, VectorCL>::set( u0.Data, it->Unknowns( k0.GetIdx()), MakePoint3D( f( x), g( x), 1.));
+    }
+    RepairSetCL repair( mg, mg.GetLastLevel());
+    const size_t p2field= repair.push_back( v0, bnd),
+                 p1field= repair.push_back( w0, bnd),
+                 vecfield= repair.push_back( u0, vbnd);
+    i0.DeleteNumbering( mg);
+    j0.DeleteNumbering( mg);
+    k0.DeleteNumbering( mg);
+
+    for (DROPS::Uint i=0; i<5; ++i) {
+        if (i%2 == 0)
+            UnMarkDrop( mg, mg.GetLastLevel());
+        else
+            MarkDrop( mg, mg.GetLastLevel());
+        mg.Refine();
+    }
+    i1.CreateNumbering( mg.GetLastLevel(), mg);
+    v1.SetIdx( &i1);
+    repair.set_target( p2field, v1);
+    j1.CreateNumbering( mg.GetLastLevel(), mg);
+    w1.SetIdx( &j1);
+    repair.set_target( p1field, w1);
+    k1.CreateNumbering( mg.GetLastLevel(), mg);
+    u1.SetIdx( &k1);
+    repair.set_target( vecfield, u1);
+    repair.repair();
+
+    DROPS::P2EvalCL<double, BndCL, const VecDescCL > fun1( &v1, &Bnd, &mg);
+    ret+= CheckResult( fun1, f, NOISY, 1e-10);
+    double maxdiff= 0., vecmaxdiff= 0.;
+    DROPS_FOR_TRIANG_VERTEX( mg, mg.GetLastLevel(), it) {
+        maxdiff= std::max( maxdiff, std::abs( w1.Data[it->Unknowns( j1.GetIdx())] - g( it->GetCoord())));
+        vecmaxdiff= std::max( vecmaxdiff, (DoFHelperCL<Point3DCL, VectorCL>::get( u1.Data, it->Unknowns( k1.GetIdx()))
+            - MakePoint3D( f( it->GetCoord()), g( it->GetCoord()), 1.)).norm());
+    }
+    DROPS_FOR_TRIANG_EDGE( mg, mg.GetLastLevel(), it) {
+        const Point3DCL x= GetBaryCenter( *it);
+        vecmaxdiff= std::max( vecmaxdiff, (DoFHelperCL<Point3DCL, VectorCL>::get( u1.Data, it->Unknowns( k1.GetIdx()))
+            - MakePoint3D( f( x), g( x), 1.)).norm());
+    }
+    std::cout << "P1: maximale Differenz Vertices: " << maxdiff
+              << "\nvecP2: maximale Differenz: " << vecmaxdiff << '\n';
+    ret+= maxdiff > 1e-10 || vecmaxdiff > 1e-10;
+    i1.DeleteNumbering( mg);
+    j1.DeleteNumbering( mg);
+    k1.DeleteNumbering( mg);
+    return ret;
+}
+
 
 int TestInterpolateOld()
 {
@@ -390,6 +467,7 @@ int main ()
 
     int ret= TestRepairUniform();
     ret+= TestRepair();
+    ret+= TestRepairSet();
     // ret+= TestInterpolateOld();
     return ret + TestReMark();
   }
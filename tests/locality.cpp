@@ -0,0 +1,155 @@
+/// \file locality.cpp
+/// \brief tests the locality orderings (RCM, Morton, Hilbert) of the DoFs
+/// \author LNM RWTH Aachen: Joerg Grande; SC RWTH Aachen:
+
+/*
+ * This file is part of DROPS.
+ *
+ * DROPS is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * DROPS is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with DROPS. If not, see <http://www.gnu.org/licenses/>.
+ *
+ *
+ * Copyright 2011 LNM/SC RWTH Aachen, Germany
+*/
+
+#include "num/renumber.h"
+#include "geom/builder.h"
+#include "misc/problem.h"
+#include <iostream>
+
+using namespace DROPS;
+
+void MarkDrop (MultiGridCL& mg, int maxLevel)
+{
+    Point3DCL Mitte( 0.5);
+    DROPS_FOR_TRIANG_TETRA( mg, maxLevel, It) {
+        if ( (GetBaryCenter( *It) - Mitte).norm() <= std::max( 0.2, 1.5*std::pow( It->GetVolume(), 1.0/3.0)) )
+            It->SetRegRefMark();
+    }
+}
+
+// Mean distance |i - j| of the nonzeros (i,j); the space filling curves reduce it, not the bandwidth.
+double
+mean_distance (const MatrixCL& M)
+{
+    double d= 0.;
+    for (size_t i= 0; i < M.num_rows(); ++i)
+        for (size_t nz= M.row_beg( i); nz < M.row_beg( i + 1); ++nz)
+            d+= i > M.col_ind( nz) ? i - M.col_ind( nz) : M.col_ind( nz) - i;
+    return d/M.num_nonzeros();
+}
+
+size_t
+bandwidth (const MatrixCL& M)
+{
+    size_t bw= 0;
+    for (size_t i= 0; i < M.num_rows(); ++i)
+        for (size_t nz= M.row_beg( i); nz < M.row_beg( i + 1); ++nz)
+            bw= std::max( bw, i > M.col_ind( nz) ? i - M.col_ind( nz) : M.col_ind( nz) - i);
+    return bw;
+}
+
+// Sets up a vector and a matrix, the entries of which are determined by the positions of the DoFs.
+// After a renumbering, permuting the old objects must yield the newly assembled ones.
+void
+setup (const MultiGridCL& mg, const IdxDescCL& idx, VectorCL& v, MatrixCL& A)
+{
+    const Uint bs= idx.NumUnknownsVertex();
+    std::vector<Point3DCL> pos;
+    dof_block_positions( mg, idx, pos);
+    MatrixCL G;
+    dof_block_graph( mg, idx, G);
+
+    v.resize( idx.NumUnknowns());
+    MatrixBuilderCL Ab( &A, idx.NumUnknowns(), idx.NumUnknowns());
+    for (size_t i= 0; i < G.num_rows(); ++i)
+        for (Uint c= 0; c < bs; ++c) {
+            v[bs*i + c]= pos[i].norm() + c;
+            for (size_t nz= G.row_beg( i); nz < G.row_beg( i + 1); ++nz)
+                for (Uint d= 0; d < bs; ++d)
+                    Ab( bs*i + c, bs*G.col_ind( nz) + d)= pos[i][0] + 2.*pos[G.col_ind( nz)][1] + c + 10.*d;
+        }
+    Ab.Build();
+}
+
+double
+max_diff (const MatrixCL& A, const MatrixCL& B)
+{
+    if (A.num_rows() != B.num_rows() || A.num_nonzeros() != B.num_nonzeros())
+        return 1.;
+    double ret= 0.;
+    for (size_t i= 0; i < A.num_rows(); ++i)
+        for (size_t nz= A.row_beg( i); nz < A.row_beg( i + 1); ++nz)
+            ret= std::max( ret, std::fabs( A.val( nz) - B( i, A.col_ind( nz))));
+    return ret;
+}
+
+int TestOrdering (MultiGridCL& mg, FiniteElementT fe, LocalityOrderingT ordering, const char* name)
+{
+    IdxDescCL idx( fe);
+    idx.CreateNumbering( mg.GetLastLevel(), mg);
+    const Uint bs= idx.NumUnknownsVertex();
+
+    VectorCL v;
+    MatrixCL A;
+    setup( mg, idx, v, A);
+    MatrixCL G;
+    dof_block_graph( mg, idx, G);
+    const size_t bw_old= bandwidth( G);
+    const double md_old= mean_distance( G);
+
+    const PermutationT p= locality_numbering( mg, idx, ordering);
+    permute_Vector( v, p, bs);
+    A.permute_rows( p, bs);
+    A.permute_columns( p, bs);
+
+    // Is p a permutation?
+    std::vector<bool> hit( p.size(), false);
+    for (size_t i= 0; i < p.size(); ++i)
+        if (p[i] < p.size()) hit[p[i]]= true;
+    const bool is_perm= std::find( hit.begin(), hit.end(), false) == hit.end();
+
+    VectorCL v_new;
+    MatrixCL A_new;
+    setup( mg, idx, v_new, A_new);
+    dof_block_graph( mg, idx, G);
+    const size_t bw_new= bandwidth( G);
+    const double md_new= mean_distance( G);
+    const double err= std::max( supnorm( VectorCL( v - v_new)), max_diff( A, A_new));
+
+    std::cout << name << ": blocks: " << p.size() << "\tbandwidth: " << bw_old << " -> " << bw_new
+              << "\tmean distance: " << md_old << " -> " << md_new << "\terror: " << err << "\tpermutation: " << is_perm << '\n';
+    idx.DeleteNumbering( mg);
+    return err > 1e-12 || !is_perm || (ordering == RCMOrderingC && bw_new >= bw_old) || md_new >= md_old;
+}
+
+int main ()
+{
+  try {
+    BrickBuilderCL brick( Point3DCL( 0.), 1.*std_basis<3>( 1), 1.*std_basis<3>( 2), 1.*std_basis<3>( 3), 4, 4, 4);
+    MultiGridCL mg( brick);
+    for (int i= 0; i < 2; ++i) {
+        MarkDrop( mg, mg.GetLastLevel());
+        mg.Refine();
+    }
+    int ret= 0;
+    ret+= TestOrdering( mg, P2_FE,    RCMOrderingC,     "P2, RCM");
+    ret+= TestOrdering( mg, P2_FE,    MortonOrderingC,  "P2, Morton");
+    ret+= TestOrdering( mg, P2_FE,    HilbertOrderingC, "P2, Hilbert");
+    ret+= TestOrdering( mg, vecP2_FE, RCMOrderingC,     "vecP2, RCM");
+    ret+= TestOrdering( mg, vecP2_FE, HilbertOrderingC, "vecP2, Hilbert");
+    ret+= TestOrdering( mg, P1_FE,    locality_ordering_from_string( "Hilbert"), "P1, Hilbert");
+    return ret;
+  }
+  catch (DROPSErrCL err) { err.handle(); }
+}
@@ -279,11 +279,129 @@ void MemberApplyTest()
         << l[6] << '\n' << l[7] << '\n' << l[8] << '\n' << l[9] << std::endl;
 }
 
+// Compares the LocalNumbP1CL/LocalNumbP2CL read from the element-to-DoF map of idx with the ones computed from the simplices.
+template <class LocalNumbT>
+int CheckTetraDoFMap (const MultiGridCL& mg, const IdxDescCL& idx, const BndDataCL<>& bnd, Uint numdof)
+{
+    idx.BuildTetraDoFMap( mg, bnd);
+    const TetraDoFMapCL& map= idx.GetTetraDoFMap();
+    const BndDataCL<> bnd_copy( bnd); // same conditions, but no map
+    LocalNumbT n, n_ref;
+    int err= map.IsValid( &bnd) ? 0 : 1;
+    size_t num_dir= 0;
+    DROPS_FOR_TRIANG_CONST_TETRA( mg, idx.TriangLevel(), it) {
+        err+= map.GetRow( *it) == NoIdx;
+        err+= it->Unknowns.Exist( idx.GetIdx()); // the map does not use the system of idx
+        n.assign( *it, idx, bnd);
+        n_ref.assign( *it, idx, bnd_copy);
+        for (Uint i= 0; i < numdof; ++i) {
+            err+= n.num[i] != n_ref.num[i] || n.bc[i] != n_ref.bc[i] || n.bndnum[i] != n_ref.bndnum[i];
+            num_dir+= !n.WithUnknowns( i);
+        }
+    }
+    std::cout << "TetraDoFMap: tetras: " << map.NumTetra() << "	DoF per tetra: " << map.NumDoF()
+              << "	Dirichlet-DoF: " << num_dir << "	errors: " << err << '\n';
+    return err;
+}
+
+int TestTetraDoFMap ()
+{
+    BrickBuilderCL brick( Point3DCL( 0.), std_basis<3>( 1), std_basis<3>( 2), std_basis<3>( 3), 4, 4, 4);
+    MultiGridCL mg( brick);
+    MarkDrop( mg, mg.GetLastLevel());
+    mg.Refine();
+    const BndCondT bc[6]= { Dir0BC, Dir0BC, Nat0BC, Nat0BC, Dir0BC, Nat0BC };
+    const BndDataCL<> bnd( 6, bc);
+
+    IdxDescCL idx( P2_FE, bnd);
+    idx.CreateNumbering( mg.GetLastLevel(), mg);
+    int ret= CheckTetraDoFMap<LocalNumbP2CL>( mg, idx, bnd, 10);
+    ret+= CheckTetraDoFMap<LocalNumbP1CL>( mg, idx, bnd, 4);
+    // A new numbering invalidates the map.
+    idx.DeleteNumbering( mg);
+    ret+= idx.GetTetraDoFMap().IsValid( &bnd);
+    idx.CreateNumbering( mg.GetLastLevel(), mg);
+    ret+= CheckTetraDoFMap<LocalNumbP2CL>( mg, idx, bnd, 10);
+
+    IdxDescCL p1idx( P1_FE, bnd);
+    p1idx.CreateNumbering( mg.GetLastLevel(), mg);
+    ret+= CheckTetraDoFMap<LocalNumbP1CL>( mg, p1idx, bnd, 4);
+    return ret;
+}
+
+Point3DCL vel (const Point3DCL& p, double)
+{
+    return MakePoint3D( p[1]*p[1], std::sin( p[0]), p[0]*p[2] + 1.);
+}
+
+// Compares the local matrices of P2BatchDiscCL with the single-tetra setup by quadrature; the last batch is padded.
+int TestBatchKernels ()
+{
+    BrickBuilderCL brick( Point3DCL( 0.), std_basis<3>( 1), 2.*std_basis<3>( 2), 3.*std_basis<3>( 3), 2, 2, 1);
+    MultiGridCL mg( brick);
+    MarkDrop( mg, mg.GetLastLevel());
+    mg.Refine();
+
+    std::vector<const TetraCL*> tets;
+    DROPS_FOR_TRIANG_TETRA( mg, mg.GetLastLevel(), it)
+        tets.push_back( &*it);
+
+    typedef P2BatchDiscCL::LaneT LaneT;
+    const Uint B= P2BatchDiscCL::BatchC;
+    LaneT T[9], absdet, u[10][3], A[10][10], M[10][10], C[10][10];
+    SMatrixCL<3,3> TT;
+    double det;
+    Quad2CL<Point3DCL> Grad2[10], GradRef2[10];
+    Quad5CL<Point3DCL> Grad5[10], GradRef5[10];
+    P2DiscCL::GetGradientsOnRef( GradRef2);
+    P2DiscCL::GetGradientsOnRef( GradRef5);
+    LocalP2CL<Point3DCL> vel_loc;
+
+    double errA= 0., errM= 0., errC= 0.;
+    for (size_t first= 0; first < tets.size(); first+= B) {
+        const size_t lanes= std::min<size_t>( B, tets.size() - first);
+        for (Uint l= 0; l < B; ++l) {
+            const TetraCL& t= *tets[first + (l < lanes ? l : 0)];
+            GetTrafoTr( TT, det, t);
+            vel_loc.assign( t, vel, 0.);
+            for (Uint k= 0; k < 9; ++k)
+                T[k][l]= TT[k];
+            absdet[l]= std::fabs( det);
+            for (Uint d= 0; d < 10; ++d)
+                for (Uint c= 0; c < 3; ++c)
+                    u[d][c][l]= vel_loc[d][c];
+        }
+        P2BatchDiscCL::GetStiffness( T, absdet, A);
+        P2BatchDiscCL::GetMass( absdet, M);
+        P2BatchDiscCL::GetConvection( T, absdet, u, C);
+
+        for (Uint l= 0; l < lanes; ++l) {
+            const TetraCL& t= *tets[first + l];
+            GetTrafoTr( TT, det, t);
+            P2DiscCL::GetGradients( Grad2, GradRef2, TT);
+            P2DiscCL::GetGradients( Grad5, GradRef5, TT);
+            const Quad5CL<Point3DCL> vel5( LocalP2CL<Point3DCL>( t, vel, 0.));
+            for (Uint i= 0; i < 10; ++i)
+                for (Uint j= 0; j < 10; ++j) {
+                    errA= std::max( errA, std::fabs( A[i][j][l] - Quad2CL<>( dot( Grad2[i], Grad2[j])).quad( std::fabs( det))));
+                    errM= std::max( errM, std::fabs( M[i][j][l] - P2DiscCL::GetMass( i, j)*std::fabs( det)));
+                    errC= std::max( errC, std::fabs( C[i][j][l] - Quad5CL<>( dot( vel5, Grad5[j])).quadP2( i, std::fabs( det))));
+                }
+        }
+    }
+    std::cout << "P2BatchDiscCL: tetras: " << tets.size() << "\terror stiffness: " << errA
+              << "\terror mass: " << errM << "\terror convection: " << errC << '\n';
+    return errA > 1e-12 || errM > 1e-12 || errC > 1e-12;
+}
 
 int main ()
 {
   try {
     MemberApplyTest();
+    if (TestTetraDoFMap() != 0)
+        return 1;
+    if (TestBatchKernels() != 0)
+        return 1;
 
     DROPS::BrickBuilderCL brick(DROPS::std_basis<3>(0),
                                 DROPS::std_basis<3>(1),
@@ -0,0 +1,121 @@
+/// \file parrefine.cpp
+/// \brief tests the OpenMP-parallel refinement against the serial refinement
+/// \author LNM RWTH Aachen: Joerg Grande; SC RWTH Aachen:
+
+/*
+ * This file is part of DROPS.
+ *
+ * DROPS is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * DROPS is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with DROPS. If not, see <http://www.gnu.org/licenses/>.
+ *
+ *
+ * Copyright 2011 LNM/SC RWTH Aachen, Germany
+*/
+
+#include "geom/multigrid.h"
+#include "geom/builder.h"
+#include <iostream>
+#include <algorithm>
+
+using namespace DROPS;
+
+void MarkDrop (MultiGridCL& mg, bool refine)
+{
+    Point3DCL Mitte( 0.5);
+    DROPS_FOR_TRIANG_TETRA( mg, -1, It) {
+        if ( (GetBaryCenter( *It) - Mitte).norm() <= std::max( 0.2, 1.5*std::pow( It->GetVolume(), 1.0/3.0)) ) {
+            if (refine)
+                It->SetRegRefMark();
+            else
+                It->SetRemoveMark();
+        }
+    }
+}
+
+/// \brief Lexicographic order of points.
+class PointLessCL
+{
+  public:
+    bool operator() (const Point3DCL& a, const Point3DCL& b) const
+        { return std::lexicographical_compare( a.begin(), a.end(), b.begin(), b.end()); }
+};
+
+/// \brief Sorted barycenters of the simplices in [begin, end).
+template <class IteratorT>
+std::vector<Point3DCL> SortedBaryCenters (IteratorT begin, IteratorT end)
+{
+    std::vector<Point3DCL> ret;
+    for (; begin != end; ++begin)
+        ret.push_back( GetBaryCenter( *begin));
+    std::sort( ret.begin(), ret.end(), PointLessCL());
+    return ret;
+}
+
+/// \brief Compares the simplices of the two multigrids level by level and checks, that the ids of the vertices and tetras are unique.
+bool EqualTopology (const MultiGridCL& mg0, const MultiGridCL& mg1)
+{
+    if (mg0.GetLastLevel() != mg1.GetLastLevel())
+        return false;
+    std::vector<Ulint> vert_ids, tetra_ids;
+    for (Uint lvl= 0; lvl <= mg1.GetLastLevel(); ++lvl) {
+        if (SortedBaryCenters( mg0.GetVerticesBegin( lvl), mg0.GetVerticesEnd( lvl))
+            != SortedBaryCenters( mg1.GetVerticesBegin( lvl), mg1.GetVerticesEnd( lvl))
+            || SortedBaryCenters( mg0.GetEdgesBegin( lvl), mg0.GetEdgesEnd( lvl))
+            != SortedBaryCenters( mg1.GetEdgesBegin( lvl), mg1.GetEdgesEnd( lvl))
+            || SortedBaryCenters( mg0.GetFacesBegin( lvl), mg0.GetFacesEnd( lvl))
+            != SortedBaryCenters( mg1.GetFacesBegin( lvl), mg1.GetFacesEnd( lvl))
+            || SortedBaryCenters( mg0.GetTetrasBegin( lvl), mg0.GetTetrasEnd( lvl))
+            != SortedBaryCenters( mg1.GetTetrasBegin( lvl), mg1.GetTetrasEnd( lvl)))
+            return false;
+        for (MultiGridCL::const_VertexIterator it= mg1.GetVerticesBegin( lvl); it != mg1.GetVerticesEnd( lvl); ++it)
+            vert_ids.push_back( it->GetId().GetIdent());
+        for (MultiGridCL::const_TetraIterator it= mg1.GetTetrasBegin( lvl); it != mg1.GetTetrasEnd( lvl); ++it)
+            tetra_ids.push_back( it->GetId().GetIdent());
+    }
+    std::sort( vert_ids.begin(), vert_ids.end());
+    std::sort( tetra_ids.begin(), tetra_ids.end());
+    return std::adjacent_find( vert_ids.begin(), vert_ids.end()) == vert_ids.end()
+        && std::adjacent_find( tetra_ids.begin(), tetra_ids.end()) == tetra_ids.end();
+}
+
+int main ()
+{
+  try {
+    const int num_threads= std::max( 3, omp_get_max_threads());
+    BrickBuilderCL brick( Point3DCL( 0.), 1.*std_basis<3>( 1), 1.*std_basis<3>( 2), 1.*std_basis<3>( 3), 4, 4, 4);
+    MultiGridCL mg_serial( brick), mg_par( brick);
+
+    int ret= 0;
+    for (int i= 0; i < 7; ++i) {
+        const bool refine= i < 4;
+        MarkDrop( mg_serial, refine);
+        MarkDrop( mg_par, refine);
+        omp_set_num_threads( 1);
+        mg_serial.Refine();
+        omp_set_num_threads( num_threads);
+        TimerCL timer;
+        mg_par.Refine();
+        timer.Stop();
+
+        const bool sane= mg_par.IsSane( std::cout),
+                   equal= EqualTopology( mg_serial, mg_par);
+        std::cout << (refine ? "refinement" : "unrefinement") << ": levels: " << mg_par.GetLastLevel() + 1
+                  << "\ttetras: " << mg_par.GetTetras().size()
+                  << "\tsane: " << sane << "\tequal to serial: " << equal
+                  << "\ttime: " << timer.GetTime() << " seconds" << std::endl;
+        ret+= !sane || !equal;
+    }
+    return ret;
+  }
+  catch (DROPSErrCL err) { err.handle(); }
+}
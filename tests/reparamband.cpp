@@ -0,0 +1,213 @@
+/// \file reparamband.cpp
+/// \brief tests the narrow band reparametrization against the reparametrization of the whole domain, the fast iterative method against the fast marching method, the parallel exact initialization against the serial one and the kd-tree kept between reparametrizations against a new one
+/// \author LNM RWTH Aachen: Joerg Grande; SC RWTH Aachen:
+
+/*
+ * This file is part of DROPS.
+ *
+ * DROPS is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * DROPS is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with DROPS. If not, see <http://www.gnu.org/licenses/>.
+ *
+ *
+ * Copyright 2011 LNM/SC RWTH Aachen, Germany
+*/
+
+#include "geom/builder.h"
+#include "levelset/levelset.h"
+#include "levelset/fastmarch.h"
+#include <iostream>
+
+using namespace DROPS;
+
+double sphere (const Point3DCL& p)
+{
+    return (p - Point3DCL( 0.5)).norm() - 0.3;
+}
+
+/// \brief level set function with the zero level of sphere, which is not a distance function
+double disturbed_sphere (const Point3DCL& p)
+{
+    return sphere( p)*(1. + 2.*p[0]*p[0]);
+}
+
+Point3DCL center( 0.5); ///< center of moving_sphere
+
+/// \brief disturbed sphere around center
+double moving_sphere (const Point3DCL& p)
+{
+    return ((p - center).norm() - 0.3)*(1. + 2.*p[0]*p[0]);
+}
+
+double sigmaf (const Point3DCL&, double) { return 1.; }
+
+void MarkInterface (MultiGridCL& mg)
+{
+    DROPS_FOR_TRIANG_TETRA( mg, -1, It)
+        if (std::fabs( sphere( GetBaryCenter( *It))) <= 1.5*std::pow( It->GetVolume(), 1.0/3.0))
+            It->SetRegRefMark();
+}
+
+/// \brief Reparametrizes with and without narrow band. Inside the band, the values must coincide; outside, they must be +/-width.
+int TestReparam (LevelsetP2CL& lset, int method, double width, double tol= 1e-12)
+{
+    lset.Init( disturbed_sphere);
+    TimerCL timer;
+    lset.Reparam( method);
+    timer.Stop();
+    const double time_full= timer.GetTime();
+    const VectorCL phi_full( lset.Phi.Data);
+
+    lset.Init( disturbed_sphere);
+    timer.Reset();
+    lset.Reparam( method, /*periodic*/ false, width);
+    timer.Stop();
+    const double time_band= timer.GetTime();
+
+    double err= 0.;
+    size_t in_band= 0;
+    bool signs= true;
+    for (size_t i= 0; i < phi_full.size(); ++i) {
+        const double ref= std::min( std::fabs( phi_full[i]), width);
+        in_band+= ref < width;
+        err= std::max( err, std::fabs( std::fabs( lset.Phi.Data[i]) - ref));
+        signs= signs && (lset.Phi.Data[i] < 0.) == (phi_full[i] < 0.);
+    }
+    // The gradient of the reparametrized function is checked only inside the band; outside, phi is constant.
+    double maxGrad, minGrad;
+    lset.GetMaxMinGradPhi( maxGrad, minGrad, width);
+    std::cout << "method: " << method << "\tthreads: " << omp_get_max_threads() << "\tdof: " << phi_full.size()
+              << "\tin band: " << in_band << "\tequal in band: " << (err < tol) << "\tsigns equal: " << signs
+              << "\tgradient in band: " << minGrad << " " << maxGrad
+              << "\ttime: " << time_full << " / " << time_band << " seconds" << std::endl;
+    return err >= tol || !signs || in_band == 0 || in_band == phi_full.size();
+}
+
+/// \brief Maximal difference of the values of lset to the exact distance sphere.
+double ErrorToDistance (LevelsetP2CL& lset)
+{
+    const VectorCL phi( lset.Phi.Data);
+    lset.Init( sphere);
+    const double err= supnorm( VectorCL( phi - lset.Phi.Data));
+    lset.Phi.Data= phi;
+    return err;
+}
+
+/// \brief Compares the propagation by the FIM (method 2x) with the FMM (method 0x).
+/// The upwind neighbors of the FIM are determined by the values, those of the FMM by the order of acceptance; hence, the values differ by less than the error to the distance.
+/// The difference grows with the distance to the interface; inside the band of the given width, it must be small compared to the width.
+int TestFastIterative (LevelsetP2CL& lset, int init, double width)
+{
+    lset.Init( disturbed_sphere);
+    TimerCL timer;
+    lset.Reparam( init);
+    timer.Stop();
+    const double time_fmm= timer.GetTime();
+    const VectorCL phi_fmm( lset.Phi.Data);
+    const double err_fmm= ErrorToDistance( lset);
+
+    lset.Init( disturbed_sphere);
+    timer.Reset();
+    lset.Reparam( 20 + init);
+    timer.Stop();
+    const double time_fim= timer.GetTime();
+    const double err_fim= ErrorToDistance( lset);
+    const double diff= supnorm( VectorCL( lset.Phi.Data - phi_fmm));
+    double diff_band= 0.;
+    for (size_t i= 0; i < phi_fmm.size(); ++i)
+        if (std::fabs( phi_fmm[i]) < width)
+            diff_band= std::max( diff_band, std::fabs( lset.Phi.Data[i] - phi_fmm[i]));
+
+    std::cout << "FIM: method: " << 20 + init << "\tthreads: " << omp_get_max_threads()
+              << "\terror to distance: " << err_fim << " (FMM: " << err_fmm << ")\tdifference to FMM: " << diff
+              << "\tin band: " << diff_band
+              << "\ttime: " << time_fim << " / " << time_fmm << " seconds" << std::endl;
+    return err_fim > 1.1*err_fmm || diff > 0.25*err_fmm || diff_band > 0.1*width;
+}
+
+/// \brief The OpenMP-parallel exact initialization (method 3) must yield the same values as the serial one.
+int TestExactThreads (LevelsetP2CL& lset)
+{
+    const int num_threads= std::max( 3, omp_get_max_threads());
+    omp_set_num_threads( 1);
+    lset.Init( disturbed_sphere);
+    TimerCL timer;
+    lset.Reparam( 3);
+    timer.Stop();
+    const double time_serial= timer.GetTime();
+    const VectorCL phi_serial( lset.Phi.Data);
+
+    omp_set_num_threads( num_threads);
+    lset.Init( disturbed_sphere);
+    timer.Reset();
+    lset.Reparam( 3);
+    timer.Stop();
+    const double diff= supnorm( VectorCL( lset.Phi.Data - phi_serial));
+    std::cout << "exact initialization: threads: " << num_threads << "\tequal to serial: " << (diff == 0.)
+              << "\ttime: " << timer.GetTime() << " / " << time_serial << " seconds" << std::endl;
+    return diff != 0.;
+}
+
+/// \brief Reparametrizes a moving sphere by direct distances (method 13) with a kd-tree kept between the steps.
+/// In the narrow band, all points in a ball are searched; hence, the values must coincide with those computed with a new kd-tree.
+/// The search for the 100 nearest neighbors outside the band may choose different points with the same distance.
+/// The kept tree must be updated at least once.
+int TestFrontTree (MultiGridCL& mg, LevelsetP2CL& lset)
+{
+    FrontTreeCL tree;
+    double diff= 0.;
+    for (int step= 0; step < 6; ++step) {
+        center[0]= 0.5 + 0.002*step;
+        lset.Init( moving_sphere);
+        ReparamFactoryCL::GetReparam( mg, lset.Phi, 13, false, &lset.GetBndData(), 0, 0.1, &tree)->Perform();
+        const VectorCL phi_kept( lset.Phi.Data);
+        lset.Init( moving_sphere);
+        ReparamFactoryCL::GetReparam( mg, lset.Phi, 13, false, &lset.GetBndData(), 0, 0.1)->Perform();
+        diff= std::max( diff, supnorm( VectorCL( lset.Phi.Data - phi_kept)));
+    }
+    std::cout << "kd-tree: builds: " << tree.GetBuilds() << "\tupdates: " << tree.GetUpdates()
+              << "\tequal to new tree: " << (diff < 1e-12) << std::endl;
+    return diff >= 1e-12 || tree.GetUpdates() == 0;
+}
+
+int main ()
+{
+  try {
+    BrickBuilderCL brick( Point3DCL( 0.), 1.*std_basis<3>( 1), 1.*std_basis<3>( 2), 1.*std_basis<3>( 3), 8, 8, 8);
+    MultiGridCL mg( brick);
+    for (int i= 0; i < 2; ++i) {
+        MarkInterface( mg);
+        mg.Refine();
+    }
+
+    SurfaceTensionCL sf( sigmaf);
+    BndCondT bc[6]= { NoBC, NoBC, NoBC, NoBC, NoBC, NoBC };
+    LsetBndDataCL::bnd_val_fun bfun[6]= { 0,0,0,0,0,0 };
+    LsetBndDataCL lsbnd( 6, bc, bfun);
+    LevelsetP2CL lset( mg, lsbnd, sf);
+    lset.CreateNumbering( mg.GetLastLevel(), &lset.idx);
+    lset.Phi.SetIdx( &lset.idx);
+
+    int ret= 0;
+    const int methods[4]= { 0, 3, 10, 13 };
+    for (int i= 0; i < 4; ++i)
+        ret+= TestReparam( lset, methods[i], 0.04);
+    ret+= TestReparam( lset, 20, 0.04);
+    ret+= TestReparam( lset, 23, 0.04);
+    ret+= TestFastIterative( lset, 0, 0.04);
+    ret+= TestFastIterative( lset, 3, 0.04);
+    ret+= TestFrontTree( mg, lset);
+    ret+= TestExactThreads( lset);
+    return ret;
+  }
+  catch (DROPSErrCL err) { err.handle(); }
+}
@@ -0,0 +1,265 @@
+/// \file sparsemat.cpp
+/// \brief tests sparse matrix-matrix products, linear combinations and the transpose cache
+/// \author LNM RWTH Aachen: Joerg Grande; SC RWTH Aachen:
+
+/*
+ * This file is part of DROPS.
+ *
+ * DROPS is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * DROPS is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with DROPS. If not, see <http://www.gnu.org/licenses/>.
+ *
+ *
+ * Copyright 2009 LNM/SC RWTH Aachen, Germany
+*/
+
+#include "num/spmat.h"
+#include "num/MGsolver.h"
+#include <iostream>
+
+using namespace DROPS;
+
+// Builds a rows x cols matrix with a pseudo-random sparsity pattern.
+void
+random_matrix (MatrixCL& M, size_t rows, size_t cols, size_t seed)
+{
+    MatrixBuilderCL Mb( &M, rows, cols);
+    size_t s= seed;
+    for (size_t i= 0; i < rows; ++i)
+        for (size_t k= 0; k < 4; ++k) {
+            s= (1103515245*s + 12345) % 2147483648ul;
+            Mb( i, s % cols)+= 1.0 + (s % 7);
+        }
+    Mb.Build();
+}
+
+// Returns the maximal difference between the entries of M and the entries of the dense matrix D.
+double
+dense_diff (const MatrixCL& M, const std::valarray<double>& D)
+{
+    double ret= 0.;
+    for (size_t i= 0; i < M.num_rows(); ++i)
+        for (size_t j= 0; j < M.num_cols(); ++j)
+            ret= std::max( ret, std::fabs( M( i, j) - D[i*M.num_cols() + j]));
+    return ret;
+}
+
+std::valarray<double>
+dense_product (const MatrixCL& A, const MatrixCL& B)
+{
+    std::valarray<double> D( A.num_rows()*B.num_cols());
+    for (size_t i= 0; i < A.num_rows(); ++i)
+        for (size_t j= 0; j < B.num_cols(); ++j)
+            for (size_t k= 0; k < A.num_cols(); ++k)
+                D[i*B.num_cols() + j]+= A( i, k)*B( k, j);
+    return D;
+}
+
+int TestMatMul()
+{
+    MatrixCL A, B, C;
+    random_matrix( A, 30, 20, 1);
+    random_matrix( B, 20, 25, 2);
+    mat_mul( A, B, C);
+    const double err= dense_diff( C, dense_product( A, B));
+    std::cout << "mat_mul: nonzeros: " << C.num_nonzeros() << "\terror: " << err << '\n';
+
+    // Change the values only and reuse the pattern.
+    A*= 2.;
+    mat_mul( A, B, C, /*reuse_pattern*/ true);
+    const double err_reuse= dense_diff( C, dense_product( A, B));
+    std::cout << "mat_mul (reuse pattern): error: " << err_reuse << '\n';
+    return err > 1e-10 || err_reuse > 1e-10;
+}
+
+int TestGalerkin()
+{
+    MatrixCL A, P, C, Pt;
+    random_matrix( A, 40, 40, 3);
+    random_matrix( P, 40, 15, 4);
+    galerkin_product( P, A, C);
+    transpose( P, Pt);
+
+    // Compare with P^T*(A*P).
+    MatrixCL AP;
+    mat_mul( A, P, AP);
+    const double diff= dense_diff( C, dense_product( Pt, AP));
+    std::cout << "galerkin_product: nonzeros: " << C.num_nonzeros() << "\terror: " << diff << '\n';
+
+    VectorCL Dinv( 0.5, A.num_cols()), x( 1.0, P.num_cols());
+    MatrixCL B, S;
+    transpose( P, B);
+    BDinvBT( B, Dinv, S);
+    const double schur_diff= norm( VectorCL( S*x - B*VectorCL( Dinv*transp_mul( B, x))));
+    std::cout << "BDinvBT: error: " << schur_diff << '\n';
+    return diff > 1e-10 || schur_diff > 1e-10;
+}
+
+// Returns the maximal difference between C and a*A + b*B + c*D.
+double
+lincomb_diff (const MatrixCL& C, double a, const MatrixCL& A, double b, const MatrixCL& B, double c, const MatrixCL& D)
+{
+    double ret= 0.;
+    for (size_t i= 0; i < C.num_rows(); ++i)
+        for (size_t j= 0; j < C.num_cols(); ++j)
+            ret= std::max( ret, std::fabs( C( i, j) - a*A( i, j) - b*B( i, j) - c*D( i, j)));
+    return ret;
+}
+
+int TestLinComb()
+{
+    MatrixCL A, B, D, C;
+    random_matrix( A, 30, 30, 5);
+    random_matrix( B, 30, 30, 6);
+    random_matrix( D, 30, 30, 7);
+    C.LinComb( 2., A, -1., B);
+    const size_t pattern= C.PatternVersion();
+    double err= lincomb_diff( C, 2., A, -1., B, 0., D);
+
+    // Only the values of the operands change: The pattern of C is reused.
+    A*= 3.;
+    C.LinComb( 2., A, -1., B);
+    err= std::max( err, lincomb_diff( C, 2., A, -1., B, 0., D));
+    const bool reused= C.PatternVersion() == pattern;
+
+    // The pattern of an operand changes: The pattern of C is recomputed.
+    random_matrix( B, 30, 30, 8);
+    C.LinComb( 2., A, -1., B);
+    err= std::max( err, lincomb_diff( C, 2., A, -1., B, 0., D));
+    const bool recomputed= C.PatternVersion() != pattern;
+
+    // Assembling an operand again with an identical pattern keeps its pattern version.
+    const size_t pattern2= C.PatternVersion();
+    random_matrix( B, 30, 30, 8);
+    C.LinComb( 2., A, -1., B);
+    err= std::max( err, lincomb_diff( C, 2., A, -1., B, 0., D));
+    const bool reused2= C.PatternVersion() == pattern2;
+
+    C.LinComb( 1., A, 0.5, B, 4., D);
+    C.LinComb( 1., A, 0.5, B, 4., D);
+    err= std::max( err, lincomb_diff( C, 1., A, 0.5, B, 4., D));
+
+    // *this as operand
+    MatrixCL E( A);
+    E.LinComb( 1., E, 1., B);
+    err= std::max( err, lincomb_diff( E, 1., A, 1., B, 0., D));
+
+    std::cout << "LinComb: error: " << err << "\treused pattern: " << (reused && reused2)
+              << "\trecomputed pattern: " << recomputed << '\n';
+    return err > 1e-10 || !reused || !reused2 || !recomputed;
+}
+
+// Returns the maximal difference between transp_mul( A, x) and the product computed entry by entry.
+double
+transp_mul_diff (const MatrixCL& A, const VectorCL& x)
+{
+    const VectorCL y( transp_mul( A, x));
+    VectorCL z( A.num_cols());
+    for (size_t i= 0; i < A.num_rows(); ++i)
+        for (size_t nz= A.row_beg( i); nz < A.row_beg( i + 1); ++nz)
+            z[A.col_ind( nz)]+= A.val( nz)*x[i];
+    return supnorm( VectorCL( y - z));
+}
+
+int TestTransposeCache()
+{
+    MatrixCL B;
+    random_matrix( B, 20, 50, 9);
+    VectorCL x( B.num_rows());
+    for (size_t i= 0; i < x.size(); ++i)
+        x[i]= std::sin( double( i));
+    double err= transp_mul_diff( B, x); // without the transpose
+    B.KeepTranspose();
+    err= std::max( err, transp_mul_diff( B, x));
+    const size_t pattern= B.GetTranspose().PatternVersion();
+
+    // Only the values change: The pattern of the transpose is reused.
+    B*= -0.5;
+    err= std::max( err, transp_mul_diff( B, x));
+    const bool reused= B.GetTranspose().PatternVersion() == pattern;
+
+    random_matrix( B, 20, 60, 10);
+    err= std::max( err, transp_mul_diff( B, x));
+    std::cout << "transp_mul: error: " << err << "\treused pattern: " << reused << '\n';
+    return err > 1e-10 || !reused;
+}
+
+// Builds the 1D finite difference Laplacian on n interior points of (0,1) and the linear interpolation from (n-1)/2 points.
+void
+laplace_1d (size_t n, MatrixCL& A, MatrixCL* P)
+{
+    const double h= 1./(n + 1);
+    MatrixBuilderCL Ab( &A, n, n);
+    for (size_t i= 0; i < n; ++i) {
+        Ab( i, i)= 2./h;
+        if (i > 0)     Ab( i, i - 1)= -1./h;
+        if (i + 1 < n) Ab( i, i + 1)= -1./h;
+    }
+    Ab.Build();
+    if (P == 0)
+        return;
+    const size_t nc= (n - 1)/2;
+    MatrixBuilderCL Pb( P, n, nc);
+    for (size_t i= 0; i < nc; ++i) {
+        Pb( 2*i, i)=     0.5;
+        Pb( 2*i + 1, i)= 1.;
+        Pb( 2*i + 2, i)= 0.5;
+    }
+    Pb.Build();
+}
+
+// The Galerkin coarse matrices of linear interpolation coincide with the coarse Laplacians. Thus, the multigrid solver
+// with Galerkin coarse matrices and with empty assembled coarse matrices must behave as the one with assembled ones.
+int TestGalerkinMG()
+{
+    const size_t levels= 4;
+    MLMatrixCL A( levels), A_fine( levels), P( levels);
+    MLMatrixCL::iterator a= A.begin(), af= A_fine.begin(), p= P.begin();
+    for (size_t l= 0, n= 7; l < levels; ++l, ++a, ++af, ++p, n= 2*n + 1)
+        laplace_1d( n, *a, l == 0 ? 0 : &*p);
+    A_fine.GetFinest()= A.GetFinest();
+
+    SSORsmoothCL smoother( 1.);
+    SSORPcCL ssor( 1.);
+    PCG_SsorCL coarse( ssor, 500, 1e-12, true);
+    MGSolverCL<SSORsmoothCL, PCG_SsorCL> mg( smoother, coarse, 50, 1e-10), mg_galerkin( smoother, coarse, 50, 1e-10);
+    *mg.GetProlongation()= P;
+    *mg_galerkin.GetProlongation()= P;
+    mg_galerkin.SetGalerkin();
+
+    const VectorCL b( 1., A.num_rows());
+    VectorCL x( A.num_rows()), x_galerkin( A.num_rows());
+    mg.Solve( A, x, b);
+    mg_galerkin.Solve( A_fine, x_galerkin, b);
+    const int iter= mg.GetIter(), iter_galerkin= mg_galerkin.GetIter();
+    double err= supnorm( VectorCL( x - x_galerkin));
+
+    // New values with the same pattern: the coarse matrices are recomputed with their patterns.
+    for (a= A.begin(); a != A.end(); ++a)
+        *a*= 2.;
+    A_fine.GetFinest()*= 2.;
+    x= 0.; x_galerkin= 0.;
+    mg.Solve( A, x, b);
+    mg_galerkin.Solve( A_fine, x_galerkin, b);
+    err= std::max( err, supnorm( VectorCL( x - x_galerkin)));
+    std::cout << "MG: iterations: " << iter << "\tGalerkin MG: iterations: " << iter_galerkin
+              << "\tdifference: " << err << '\n';
+    return iter != iter_galerkin || mg_galerkin.GetIter() != mg.GetIter() || err > 1e-8;
+}
+
+int main()
+{
+  try {
+    return TestMatMul() + TestGalerkin() + TestLinComb() + TestTransposeCache() + TestGalerkinMG();
+  }
+  catch (DROPSErrCL err) { err.handle(); }
+}
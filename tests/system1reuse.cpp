@@ -0,0 +1,133 @@
+/// \file system1reuse.cpp
+/// \brief tests the update of the two-phase Stokes system on the tetras, on which the phases changed, against a new assembly
+/// \author LNM RWTH Aachen: Joerg Grande; SC RWTH Aachen:
+
+/*
+ * This file is part of DROPS.
+ *
+ * DROPS is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * DROPS is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with DROPS. If not, see <http://www.gnu.org/licenses/>.
+ *
+ *
+ * Copyright 2011 LNM/SC RWTH Aachen, Germany
+*/
+
+#include "geom/builder.h"
+#include "levelset/levelset.h"
+#include "stokes/instatstokes2phase.h"
+#include <iostream>
+
+using namespace DROPS;
+
+Point3DCL center( 0.5); ///< center of moving_sphere
+
+double moving_sphere (const Point3DCL& p)
+{
+    return (p - center).norm() - 0.3;
+}
+
+double sigmaf (const Point3DCL&, double) { return 1.; }
+
+Point3DCL shear (const Point3DCL& p, double) { return MakePoint3D( p[2], 0., 0.); }
+
+void MarkInterface (MultiGridCL& mg)
+{
+    DROPS_FOR_TRIANG_TETRA( mg, -1, It)
+        if (std::fabs( moving_sphere( GetBaryCenter( *It))) <= 1.5*std::pow( It->GetVolume(), 1.0/3.0))
+            It->SetRegRefMark();
+}
+
+/// \brief Maximal difference of the values of two matrices with the same sparsity pattern.
+double MatDiff (const MatrixCL& A, const MatrixCL& B)
+{
+    if (A.num_nonzeros() != B.num_nonzeros())
+        return 1e99;
+    double diff= 0.;
+    for (size_t i= 0; i < A.num_nonzeros(); ++i)
+        diff= std::max( diff, std::fabs( A.raw_val()[i] - B.raw_val()[i]));
+    return diff;
+}
+
+/// \brief Moves the sphere, such that the phases change on some tetras. The system assembled by SetupSystem1 with the same arguments as in the last step is updated; it must coincide with a new assembly.
+/// In the last step, the sphere does not move and no tetra is visited. The new assembly is done by Ref.
+int TestUpdate (InstatStokes2PhaseP2P1CL& Stokes, InstatStokes2PhaseP2P1CL& Ref, LevelsetP2CL& lset)
+{
+    MLIdxDescCL* vidx= &Stokes.vel_idx;
+    VelVecDescCL curv( vidx), b_new( vidx), curv_new( vidx);
+    MLMatDescCL A_new( vidx, vidx), M_new( vidx, vidx);
+    Stokes.b.SetIdx( vidx);
+    Stokes.A.SetIdx( vidx, vidx);
+    Stokes.M.SetIdx( vidx, vidx);
+
+    double diff= 0.;
+    for (int step= 0; step < 5; ++step) {
+        center[0]= 0.5 + 0.01*std::min( step, 3);
+        lset.Init( moving_sphere);
+        Stokes.SetupSystem1( &Stokes.A, &Stokes.M, &Stokes.b, &Stokes.b, &curv, lset, 0.5);
+        Ref.ClearMat(); // forget the last assembly
+        Ref.SetupSystem1( &A_new, &M_new, &b_new, &b_new, &curv_new, lset, 0.5);
+        const double d= std::max( std::max( MatDiff( Stokes.A.Data.GetFinest(), A_new.Data.GetFinest()),
+                                             MatDiff( Stokes.M.Data.GetFinest(), M_new.Data.GetFinest())),
+                                  std::max( supnorm( VectorCL( Stokes.b.Data - b_new.Data)),
+                                            supnorm( VectorCL( curv.Data - curv_new.Data))));
+        diff= std::max( diff, d);
+    }
+    std::cout << "threads: " << omp_get_max_threads() << "\tupdate equal to new assembly: " << (diff < 1e-10) << std::endl;
+    return diff >= 1e-10;
+}
+
+/// \brief The matrix B of SetupSystem2 keeps its transpose; transp_mul must coincide with the product with the explicit transpose.
+int TestTransposeB (InstatStokes2PhaseP2P1CL& Stokes, LevelsetP2CL& lset)
+{
+    Stokes.CreateNumberingPr( Stokes.GetMG().GetLastLevel(), &Stokes.pr_idx, 0, &lset);
+    MLMatDescCL B( &Stokes.pr_idx, &Stokes.vel_idx);
+    VecDescCL c( &Stokes.pr_idx);
+    Stokes.SetupSystem2( &B, &c, lset, 0.);
+    const MatrixCL& Bf= B.Data.GetFinest();
+    VectorCL p( Bf.num_rows());
+    for (size_t i= 0; i < p.size(); ++i)
+        p[i]= std::sin( double( i));
+    MatrixCL Bt;
+    transpose( Bf, Bt);
+    const double diff= supnorm( VectorCL( transp_mul( Bf, p) - Bt*p));
+    std::cout << "B keeps its transpose: " << Bf.KeepsTranspose() << "\ttransp_mul equal to B^T*p: " << (diff < 1e-12) << std::endl;
+    return !Bf.KeepsTranspose() || diff >= 1e-12;
+}
+
+int main ()
+{
+  try {
+    BrickBuilderCL brick( Point3DCL( 0.), 1.*std_basis<3>( 1), 1.*std_basis<3>( 2), 1.*std_basis<3>( 3), 6, 6, 6);
+    const BndCondT bc[6]= { DirBC, DirBC, DirBC, DirBC, DirBC, DirBC };
+    const StokesVelBndDataCL::bnd_val_fun bnd_fun[6]= { &shear, &shear, &shear, &shear, &shear, &shear };
+    const TwoPhaseFlowCoeffCL coeff( 1., 2., 1., 3., 1., MakePoint3D( 0., 0., -9.81));
+    const StokesBndDataCL bnd( 6, bc, bnd_fun);
+    InstatStokes2PhaseP2P1CL Stokes( brick, coeff, bnd);
+    MultiGridCL& mg= Stokes.GetMG();
+    InstatStokes2PhaseP2P1CL Ref( mg, coeff, bnd);
+    MarkInterface( mg);
+    mg.Refine();
+
+    SurfaceTensionCL sf( sigmaf);
+    BndCondT lsbc[6]= { NoBC, NoBC, NoBC, NoBC, NoBC, NoBC };
+    LsetBndDataCL::bnd_val_fun lsfun[6]= { 0,0,0,0,0,0 };
+    LsetBndDataCL lsbnd( 6, lsbc, lsfun);
+    LevelsetP2CL lset( mg, lsbnd, sf);
+    lset.CreateNumbering( mg.GetLastLevel(), &lset.idx);
+    lset.Phi.SetIdx( &lset.idx);
+    Stokes.CreateNumberingVel( mg.GetLastLevel(), &Stokes.vel_idx);
+
+    return TestUpdate( Stokes, Ref, lset) + TestTransposeB( Stokes, lset);
+  }
+  catch (DROPSErrCL err) { err.handle(); }
+}
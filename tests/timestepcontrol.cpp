@@ -0,0 +1,156 @@
+/// \file timestepcontrol.cpp
+/// \brief tests the acceptance, the rejection with rollback and the step size selection of TimeStepControlCL with a stub time discretization
+/// \author LNM RWTH Aachen: Joerg Grande; SC RWTH Aachen:
+
+/*
+ * This file is part of DROPS.
+ *
+ * DROPS is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * DROPS is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with DROPS. If not, see <http://www.gnu.org/licenses/>.
+ *
+ *
+ * Copyright 2011 LNM/SC RWTH Aachen, Germany
+*/
+
+#include "geom/builder.h"
+#include "levelset/coupling.h"
+#include <iostream>
+
+using namespace DROPS;
+
+double sphere (const Point3DCL& p)
+{
+    return (p - Point3DCL( 0.5)).norm() - 0.3;
+}
+
+double sigmaf (const Point3DCL&, double) { return 1.; }
+
+Point3DCL zero (const Point3DCL&, double) { return Point3DCL(); }
+
+/// \brief Time discretization, which increases v and phi by the time step plus jump_ and p by 1.
+/// After the increment, phi is shifted by mod_ like by the volume correction of LevelsetModifyCL.
+class StubSchemeCL : public TimeDisc2PhaseCL
+{
+  public:
+    double jump_, mod_;
+    int    updates_; ///< number of calls of Update
+
+    StubSchemeCL (StokesT& Stokes, LevelsetP2CL& ls, LevelsetModifyCL& lsetmod, double dt)
+      : TimeDisc2PhaseCL( Stokes, ls, lsetmod, dt), jump_( 0.), mod_( 0.), updates_( 0) {}
+
+    void SetCoupling (int iter, bool converged) { cplIter_= iter; cplConverged_= converged; }
+
+    void DoStep (int= -1) {
+        Stokes_.v.Data+= dt_ + jump_;
+        Stokes_.p.Data+= 1.;
+        LvlSet_.Phi.Data+= dt_ + jump_;
+        StoreUnmodifiedPhi();
+        LvlSet_.Phi.Data+= mod_;
+        Stokes_.v.t+= dt_;
+        Stokes_.p.t= LvlSet_.Phi.t= Stokes_.v.t;
+    }
+    void Update () { ++updates_; }
+};
+
+/// \brief Does one step; returns 1, if the step is not accepted/rejected as expected, if a rejected step is not rolled back,
+/// or if the next time step differs from dt_next. For dt_next == 0, the next time step must be smaller than the last one.
+int Step (TimeStepControlCL& control, StubSchemeCL& scheme, bool accept, double dt_next)
+{
+    StokesT& Stokes= scheme.GetStokes();
+    LevelsetP2CL& lset= scheme.GetLset();
+    const VectorCL v( Stokes.v.Data), p( Stokes.p.Data), phi( lset.Phi.Data);
+    const double t= scheme.GetTime();
+    const int updates= scheme.updates_;
+
+    control.InitStep();
+    const double dt= control.GetTimeStep();
+    scheme.DoStep();
+    const bool accepted= control.CommitStep();
+
+    bool ok= accepted == accept
+        && (dt_next == 0. ? control.GetTimeStep() < dt : std::fabs( control.GetTimeStep() - dt_next) <= 1e-12*dt_next);
+    if (!accepted)
+        ok= ok && supnorm( VectorCL( Stokes.v.Data - v)) == 0. && supnorm( VectorCL( Stokes.p.Data - p)) == 0.
+            && supnorm( VectorCL( lset.Phi.Data - phi)) == 0. && scheme.GetTime() == t && Stokes.p.t == t
+            && lset.Phi.t == t && scheme.updates_ == updates + 1;
+    else
+        ok= ok && std::fabs( scheme.GetTime() - t - dt) <= 1e-12;
+    std::cout << "dt: " << dt << "\taccepted: " << accepted << "\tok: " << ok << std::endl;
+    return !ok;
+}
+
+int TestStepControl (StubSchemeCL& scheme)
+{
+    const double tol= 1e-3, dt_min= 1e-3, dt_max= 0.05;
+    TimeStepControlCL control( scheme, 0.01, dt_min, dt_max, tol, /*cfl*/ 1e6, /*target_iter*/ 5);
+    int fail= 0;
+
+    // linear in time: accepted and doubled up to dt_max; the shift mod_ > tol is not part of the error estimate
+    scheme.mod_= 0.01;
+    fail+= Step( control, scheme, true, 0.02);
+    fail+= Step( control, scheme, true, 0.04);
+    fail+= Step( control, scheme, true, dt_max);
+    // large error: rejected, rolled back and reduced
+    scheme.jump_= 0.1;
+    fail+= Step( control, scheme, false, 0.);
+    // coupling iteration not converged: rejected, rolled back and at least halved
+    scheme.jump_= 0.;
+    scheme.SetCoupling( 10, false);
+    const double dt= control.GetTimeStep();
+    fail+= Step( control, scheme, false, 0.5*dt);
+    // too many coupling iterations: accepted and reduced by the ratio of the targeted and the needed iterations
+    scheme.SetCoupling( 10, true);
+    fail+= Step( control, scheme, true, 0.25*dt);
+    // large error with the minimal time step: accepted
+    scheme.SetCoupling( 1, true);
+    scheme.jump_= 0.1;
+    fail+= Step( control, scheme, false, 0.);
+    fail+= Step( control, scheme, true, 0.);
+    fail+= control.GetRejected() != 3;
+
+    std::cout << "step control: " << (fail == 0) << std::endl;
+    return fail != 0;
+}
+
+int main ()
+{
+  try {
+    BrickBuilderCL brick( Point3DCL( 0.), 1.*std_basis<3>( 1), 1.*std_basis<3>( 2), 1.*std_basis<3>( 3), 6, 6, 6);
+    const BndCondT bc[6]= { DirBC, DirBC, DirBC, DirBC, DirBC, DirBC };
+    const StokesVelBndDataCL::bnd_val_fun bnd_fun[6]= { &zero, &zero, &zero, &zero, &zero, &zero };
+    const TwoPhaseFlowCoeffCL coeff( 1., 2., 1., 3., 1., MakePoint3D( 0., 0., -9.81));
+    const StokesBndDataCL bnd( 6, bc, bnd_fun);
+    StokesT Stokes( brick, coeff, bnd);
+    MultiGridCL& mg= Stokes.GetMG();
+
+    SurfaceTensionCL sf( sigmaf);
+    BndCondT lsbc[6]= { NoBC, NoBC, NoBC, NoBC, NoBC, NoBC };
+    LsetBndDataCL::bnd_val_fun lsfun[6]= { 0,0,0,0,0,0 };
+    LsetBndDataCL lsbnd( 6, lsbc, lsfun);
+    LevelsetP2CL lset( mg, lsbnd, sf);
+    lset.CreateNumbering( mg.GetLastLevel(), &lset.idx);
+    lset.Phi.SetIdx( &lset.idx);
+    lset.Init( sphere);
+
+    Stokes.CreateNumberingVel( mg.GetLastLevel(), &Stokes.vel_idx);
+    Stokes.CreateNumberingPr ( mg.GetLastLevel(), &Stokes.pr_idx);
+    Stokes.v.SetIdx( &Stokes.vel_idx);
+    Stokes.p.SetIdx( &Stokes.pr_idx);
+    Stokes.b.SetIdx( &Stokes.vel_idx);
+
+    LevelsetModifyCL lsetmod( 0, 0, 0., 0., 0, 0.);
+    StubSchemeCL scheme( Stokes, lset, lsetmod, 0.01);
+    return TestStepControl( scheme);
+  }
+  catch (DROPSErrCL err) { err.handle(); }
+}
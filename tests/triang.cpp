@@ -25,6 +25,8 @@
 #include "misc/utils.h"
 #include "geom/multigrid.h"
 #include "geom/builder.h"
+#include <set>
+#include <map>
 
 using namespace DROPS;
 
@@ -106,6 +108,113 @@ New(DROPS::MultiGridCL&, const TriangVertexCL& vt, const TriangEdgeCL& et,
     return tmp;
 }
 
+// Compares the cached transformations with GetTrafoTr.
+double
+TrafoDiff (const MultiGridCL& mg, const TetraGeometryCL& geom)
+{
+    SMatrixCL<3,3> T, Tc;
+    double det, detc, ret= 0.;
+    DROPS_FOR_TRIANG_CONST_TETRA( mg, geom.GetLevel(), it) {
+        GetTrafoTr( T, det, *it);
+        geom.GetTrafoTr( Tc, detc, *it);
+        for (Uint k= 0; k < 9; ++k)
+            ret= std::max( ret, std::fabs( T[k] - Tc[k]));
+        ret= std::max( ret, std::fabs( det - detc));
+    }
+    return ret;
+}
+
+int TestTetraGeometry ()
+{
+    DROPS::BrickBuilderCL brick( Point3DCL( 0.), std_basis<3>( 1), std_basis<3>( 2), std_basis<3>( 3), 4, 4, 4);
+    DROPS::MultiGridCL mg( brick);
+    MarkDrop( mg, -1);
+    mg.Refine();
+
+    const TetraGeometryCL* geom= &mg.GetTetraGeometry();
+    double err= TrafoDiff( mg, *geom);
+    bool found= geom->NumTetra() == static_cast<size_t>( std::distance( mg.GetTriangTetraBegin(), mg.GetTriangTetraEnd()));
+    for (size_t i= 0; i < geom->NumTetra(); ++i)
+        found= found && geom->GetRow( geom->GetTetra( i)) == i;
+
+    // Changed coordinates must be detected.
+    mg.Scale( 0.5);
+    geom= &mg.GetTetraGeometry();
+    err= std::max( err, TrafoDiff( mg, *geom));
+
+    // A changed multigrid must be detected.
+    MarkDrop( mg, -1);
+    mg.Refine();
+    geom= &mg.GetTetraGeometry();
+    err= std::max( err, TrafoDiff( mg, *geom));
+    err= std::max( err, TrafoDiff( mg, mg.GetTetraGeometry( 0)));
+
+    std::cout << "TetraGeometryCL: tetras: " << geom->NumTetra() << "\terror: " << err
+              << "\trows found: " << found << std::endl;
+    return err > 1e-10 || !found;
+}
+
+// Checks, that each tetra has exactly one color and that no two tetras of the same color share a vertex.
+bool
+ColoringIsValid (const MultiGridCL& mg, const ColorClassesCL& colors)
+{
+    std::map<const TetraCL*, int> count;
+    for (ColorClassesCL::const_iterator cit= colors.begin(); cit != colors.end(); ++cit) {
+        std::set<const VertexCL*> verts;
+        for (ColorClassesCL::ColorClassT::const_iterator it= cit->begin(); it != cit->end(); ++it) {
+            ++count[*it];
+            for (Uint i= 0; i < 4; ++i)
+                if (!verts.insert( (*it)->GetVertex( i)).second)
+                    return false;
+        }
+    }
+    DROPS_FOR_TRIANG_CONST_TETRA( mg, -1, it)
+        if (count[&*it] != 1)
+            return false;
+    return count.size() == static_cast<size_t>( std::distance( mg.GetTriangTetraBegin(), mg.GetTriangTetraEnd()));
+}
+
+// Refines (ref == true) or coarsens the tetras in x < 0.25 by one level.
+void
+MarkLeft (MultiGridCL& mg, bool ref)
+{
+    DROPS_FOR_TRIANG_TETRA( mg, -1, it)
+        if (GetBaryCenter( *it)[0] < 0.25) {
+            if (ref && it->GetLevel() == 0)
+                it->SetRegRefMark();
+            if (!ref && it->GetLevel() == 1)
+                it->SetRemoveMark();
+        }
+}
+
+int TestColorClasses ()
+{
+    DROPS::BrickBuilderCL brick( Point3DCL( 0.), std_basis<3>( 1), std_basis<3>( 2), std_basis<3>( 3), 6, 6, 6);
+    DROPS::MultiGridCL mg( brick);
+    const BndCondCL bnd( 0);
+    MarkDrop( mg, -1);
+    mg.Refine();
+    const ColorClassesCL* colors= &mg.GetColorClasses( -1, 0, bnd);
+    bool valid= ColoringIsValid( mg, *colors);
+    const size_t num_tetra= colors->num_recolored();
+
+    // After the refinement, only the new tetras must be colored.
+    MarkLeft( mg, true);
+    mg.Refine();
+    colors= &mg.GetColorClasses( -1, 0, bnd);
+    valid= valid && ColoringIsValid( mg, *colors);
+    const bool incremental= mg.GetLastLevel() == 1 && colors->num_recolored() > 0
+        && colors->num_recolored() < static_cast<size_t>( std::distance( mg.GetTriangTetraBegin(), mg.GetTriangTetraEnd()));
+
+    // Coarsening: The parents, which were colored before, must not keep their old colors.
+    MarkLeft( mg, false);
+    mg.Refine();
+    colors= &mg.GetColorClasses( -1, 0, bnd);
+    valid= valid && ColoringIsValid( mg, *colors);
+
+    std::cout << "ColorClassesCL: tetras: " << num_tetra << "\tvalid: " << valid << "\tincremental: " << incremental << std::endl;
+    return !valid || !incremental;
+}
 
 int main ()
 {
@@ -115,22 +224,31 @@ int main ()
                                 DROPS::std_basis<3>(2),
                                 DROPS::std_basis<3>(3),
                                 30, 30, 30);
+    TimerCL time;
+    time.Start();
     DROPS::MultiGridCL mg( brick);
+    time.Stop();
+    std::cout << "build: " << time.GetTime() << " seconds" << std::endl;
     mg.SizeInfo( std::cout);
-    MarkDrop( mg, -1);
-    mg.Refine();
-    MarkDrop( mg, -1);
-    mg.Refine();
-    MarkDrop( mg, -1);
-    mg.Refine();
+    for (int i= 0; i < 3; ++i) {
+        MarkDrop( mg, -1);
+        time.Reset();
+        time.Start();
+        mg.Refine();
+        time.Stop();
+        std::cout << "refine: " << time.GetTime() << " seconds" << std::endl;
+    }
     mg.SizeInfo( std::cout);
+    std::cout << "tetra arena: " << mg.GetTetras().GetArena().GetNumChunks() << " chunks in "
+        << mg.GetTetras().GetArena().GetNumSlabs() << " slabs, "
+        << mg.GetTetras().GetArena().GetMemory()/1048576. << " MB" << std::endl;
 
     TriangVertexCL vt( mg);
     TriangEdgeCL et( mg);
     TriangFaceCL ft( mg);
     TriangTetraCL tt( mg);
 
-    TimerCL time;
+    time.Reset();
     time.Start();
     Uint q0= Old( mg);
     time.Stop();
@@ -156,6 +274,7 @@ int main ()
         << std::endl;
     time.Reset();
     std::cout << "tt.size: " << tt.size() << std::endl;
+    return TestTetraGeometry() + TestColorClasses();
   }
   catch (DROPS::DROPSErrCL err) { err.handle(); }
 }
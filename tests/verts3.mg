@@ -0,0 +1,2269 @@
+0 0 0 
+0.5 0 0 
+1 0 0 
+0 0.5 0 
+0.5 0.5 0 
+1 0.5 0 
+0 1 0 
+0.5 1 0 
+1 1 0 
+0 0 0.5 
+0.5 0 0.5 
+1 0 0.5 
+0 0.5 0.5 
+0.5 0.5 0.5 
+1 0.5 0.5 
+0 1 0.5 
+0.5 1 0.5 
+1 1 0.5 
+0 0 1 
+0.5 0 1 
+1 0 1 
+0 0.5 1 
+0.5 0.5 1 
+1 0.5 1 
+0 1 1 
+0.5 1 1 
+1 1 1 
+0.25 0 0 
+0.25 0.25 0 
+0.5 0.25 0 
+0.25 0.25 0.25 
+0.5 0.25 0.25 
+0.5 0.5 0.25 
+0.25 0 0.25 
+0.5 0 0.25 
+0.5 0.25 0.5 
+0 0.25 0 
+0.25 0.5 0 
+0.25 0.5 0.25 
+0 0.25 0.25 
+0 0.5 0.25 
+0.25 0.5 0.5 
+0 0 0.25 
+0.25 0 0.5 
+0.25 0.25 0.5 
+0 0.25 0.5 
+0.75 0 0 
+0.75 0.25 0 
+1 0.25 0 
+0.75 0.25 0.25 
+1 0.25 0.25 
+1 0.5 0.25 
+0.75 0 0.25 
+1 0 0.25 
+1 0.25 0.5 
+0.75 0.5 0 
+0.75 0.5 0.25 
+0.75 0.5 0.5 
+0.75 0 0.5 
+0.75 0.25 0.5 
+0.25 0.75 0 
+0.5 0.75 0 
+0.25 0.75 0.25 
+0.5 0.75 0.25 
+0.5 1 0.25 
+0.5 0.75 0.5 
+0 0.75 0 
+0.25 1 0 
+0.25 1 0.25 
+0 0.75 0.25 
+0 1 0.25 
+0.25 1 0.5 
+0.25 0.75 0.5 
+0 0.75 0.5 
+0.75 0.75 0 
+1 0.75 0 
+0.75 0.75 0.25 
+1 0.75 0.25 
+1 1 0.25 
+1 0.75 0.5 
+0.75 1 0 
+0.75 1 0.25 
+0.75 1 0.5 
+0.75 0.75 0.5 
+0.25 0.25 0.75 
+0.5 0.25 0.75 
+0.5 0.5 0.75 
+0.25 0 0.75 
+0.5 0 0.75 
+0.5 0.25 1 
+0.25 0.5 0.75 
+0 0.25 0.75 
+0 0.5 0.75 
+0.25 0.5 1 
+0 0 0.75 
+0.25 0 1 
+0.25 0.25 1 
+0 0.25 1 
+0.75 0.25 0.75 
+1 0.25 0.75 
+1 0.5 0.75 
+0.75 0 0.75 
+1 0 0.75 
+1 0.25 1 
+0.75 0.5 0.75 
+0.75 0.5 1 
+0.75 0 1 
+0.75 0.25 1 
+0.25 0.75 0.75 
+0.5 0.75 0.75 
+0.5 1 0.75 
+0.5 0.75 1 
+0.25 1 0.75 
+0 0.75 0.75 
+0 1 0.75 
+0.25 1 1 
+0.25 0.75 1 
+0 0.75 1 
+0.75 0.75 0.75 
+1 0.75 0.75 
+1 1 0.75 
+1 0.75 1 
+0.75 1 0.75 
+0.75 1 1 
+0.75 0.75 1 
+0.125 0 0 
+0.125 0.125 0 
+0.25 0.125 0 
+0.125 0.125 0.125 
+0.25 0.125 0.125 
+0.25 0.25 0.125 
+0.375 0 0 
+0.375 0.125 0 
+0.5 0.125 0 
+0.375 0.125 0.125 
+0.5 0.125 0.125 
+0.5 0.25 0.125 
+0.375 0.25 0 
+0.375 0.25 0.125 
+0.375 0.25 0.25 
+0.375 0.375 0 
+0.5 0.375 0 
+0.375 0.375 0.125 
+0.5 0.375 0.125 
+0.5 0.5 0.125 
+0.5 0.375 0.25 
+0.375 0.375 0.25 
+0.375 0.375 0.375 
+0.5 0.375 0.375 
+0.5 0.5 0.375 
+0.125 0 0.125 
+0.25 0 0.125 
+0.25 0.125 0.25 
+0.375 0 0.125 
+0.5 0 0.125 
+0.5 0.125 0.25 
+0.375 0 0.25 
+0.375 0.125 0.25 
+0.375 0 0.375 
+0.5 0 0.375 
+0.375 0.125 0.375 
+0.5 0.125 0.375 
+0.5 0.125 0.5 
+0.5 0.25 0.375 
+0.375 0.25 0.375 
+0.5 0.375 0.5 
+0 0.125 0 
+0.125 0.25 0 
+0.125 0.25 0.125 
+0 0.375 0 
+0.125 0.375 0 
+0.125 0.5 0 
+0.125 0.375 0.125 
+0.125 0.5 0.125 
+0.25 0.5 0.125 
+0.25 0.375 0 
+0.25 0.375 0.125 
+0.25 0.375 0.25 
+0.375 0.5 0 
+0.375 0.5 0.125 
+0.375 0.5 0.25 
+0.375 0.5 0.375 
+0 0.125 0.125 
+0 0.25 0.125 
+0.125 0.25 0.25 
+0 0.375 0.125 
+0 0.5 0.125 
+0.125 0.5 0.25 
+0 0.375 0.25 
+0.125 0.375 0.25 
+0 0.375 0.375 
+0 0.5 0.375 
+0.125 0.375 0.375 
+0.125 0.5 0.375 
+0.125 0.5 0.5 
+0.25 0.5 0.375 
+0.25 0.375 0.375 
+0.375 0.5 0.5 
+0 0 0.125 
+0.125 0 0.25 
+0.125 0.125 0.25 
+0 0 0.375 
+0.125 0 0.375 
+0.125 0 0.5 
+0.125 0.125 0.375 
+0.125 0.125 0.5 
+0.25 0.125 0.5 
+0.25 0 0.375 
+0.25 0.125 0.375 
+0.25 0.25 0.375 
+0.375 0 0.5 
+0.375 0.125 0.5 
+0.375 0.25 0.5 
+0.375 0.375 0.5 
+0 0.125 0.25 
+0 0.125 0.375 
+0 0.125 0.5 
+0.125 0.25 0.5 
+0 0.25 0.375 
+0.125 0.25 0.375 
+0 0.375 0.5 
+0.125 0.375 0.5 
+0.25 0.375 0.5 
+0.625 0 0 
+0.625 0.125 0 
+0.75 0.125 0 
+0.625 0.125 0.125 
+0.75 0.125 0.125 
+0.75 0.25 0.125 
+0.875 0 0 
+0.875 0.125 0 
+1 0.125 0 
+0.875 0.125 0.125 
+1 0.125 0.125 
+1 0.25 0.125 
+0.875 0.25 0 
+0.875 0.25 0.125 
+0.875 0.25 0.25 
+0.875 0.375 0 
+1 0.375 0 
+0.875 0.375 0.125 
+1 0.375 0.125 
+1 0.5 0.125 
+1 0.375 0.25 
+0.875 0.375 0.25 
+0.875 0.375 0.375 
+1 0.375 0.375 
+1 0.5 0.375 
+0.625 0 0.125 
+0.75 0 0.125 
+0.75 0.125 0.25 
+0.875 0 0.125 
+1 0 0.125 
+1 0.125 0.25 
+0.875 0 0.25 
+0.875 0.125 0.25 
+0.875 0 0.375 
+1 0 0.375 
+0.875 0.125 0.375 
+1 0.125 0.375 
+1 0.125 0.5 
+1 0.25 0.375 
+0.875 0.25 0.375 
+1 0.375 0.5 
+0.625 0.25 0 
+0.625 0.25 0.125 
+0.625 0.375 0 
+0.625 0.5 0 
+0.625 0.375 0.125 
+0.625 0.5 0.125 
+0.75 0.5 0.125 
+0.75 0.375 0 
+0.75 0.375 0.125 
+0.75 0.375 0.25 
+0.875 0.5 0 
+0.875 0.5 0.125 
+0.875 0.5 0.25 
+0.875 0.5 0.375 
+0.625 0.25 0.25 
+0.625 0.5 0.25 
+0.625 0.375 0.25 
+0.625 0.375 0.375 
+0.625 0.5 0.375 
+0.625 0.5 0.5 
+0.75 0.5 0.375 
+0.75 0.375 0.375 
+0.875 0.5 0.5 
+0.625 0 0.25 
+0.625 0.125 0.25 
+0.625 0 0.375 
+0.625 0 0.5 
+0.625 0.125 0.375 
+0.625 0.125 0.5 
+0.75 0.125 0.5 
+0.75 0 0.375 
+0.75 0.125 0.375 
+0.75 0.25 0.375 
+0.875 0 0.5 
+0.875 0.125 0.5 
+0.875 0.25 0.5 
+0.875 0.375 0.5 
+0.625 0.25 0.5 
+0.625 0.25 0.375 
+0.625 0.375 0.5 
+0.75 0.375 0.5 
+0.125 0.625 0 
+0.25 0.625 0 
+0.125 0.625 0.125 
+0.25 0.625 0.125 
+0.25 0.75 0.125 
+0.375 0.625 0 
+0.5 0.625 0 
+0.375 0.625 0.125 
+0.5 0.625 0.125 
+0.5 0.75 0.125 
+0.375 0.75 0 
+0.375 0.75 0.125 
+0.375 0.75 0.25 
+0.375 0.875 0 
+0.5 0.875 0 
+0.375 0.875 0.125 
+0.5 0.875 0.125 
+0.5 1 0.125 
+0.5 0.875 0.25 
+0.375 0.875 0.25 
+0.375 0.875 0.375 
+0.5 0.875 0.375 
+0.5 1 0.375 
+0.25 0.625 0.25 
+0.5 0.625 0.25 
+0.375 0.625 0.25 
+0.375 0.625 0.375 
+0.5 0.625 0.375 
+0.5 0.625 0.5 
+0.5 0.75 0.375 
+0.375 0.75 0.375 
+0.5 0.875 0.5 
+0 0.625 0 
+0.125 0.75 0 
+0.125 0.75 0.125 
+0 0.875 0 
+0.125 0.875 0 
+0.125 1 0 
+0.125 0.875 0.125 
+0.125 1 0.125 
+0.25 1 0.125 
+0.25 0.875 0 
+0.25 0.875 0.125 
+0.25 0.875 0.25 
+0.375 1 0 
+0.375 1 0.125 
+0.375 1 0.25 
+0.375 1 0.375 
+0 0.625 0.125 
+0 0.75 0.125 
+0.125 0.75 0.25 
+0 0.875 0.125 
+0 1 0.125 
+0.125 1 0.25 
+0 0.875 0.25 
+0.125 0.875 0.25 
+0 0.875 0.375 
+0 1 0.375 
+0.125 0.875 0.375 
+0.125 1 0.375 
+0.125 1 0.5 
+0.25 1 0.375 
+0.25 0.875 0.375 
+0.375 1 0.5 
+0.125 0.625 0.25 
+0.125 0.625 0.375 
+0.125 0.625 0.5 
+0.25 0.625 0.5 
+0.25 0.625 0.375 
+0.25 0.75 0.375 
+0.375 0.625 0.5 
+0.375 0.75 0.5 
+0.375 0.875 0.5 
+0 0.625 0.25 
+0 0.625 0.375 
+0 0.625 0.5 
+0.125 0.75 0.5 
+0 0.75 0.375 
+0.125 0.75 0.375 
+0 0.875 0.5 
+0.125 0.875 0.5 
+0.25 0.875 0.5 
+0.625 0.625 0 
+0.75 0.625 0 
+0.625 0.625 0.125 
+0.75 0.625 0.125 
+0.75 0.75 0.125 
+0.875 0.625 0 
+1 0.625 0 
+0.875 0.625 0.125 
+1 0.625 0.125 
+1 0.75 0.125 
+0.875 0.75 0 
+0.875 0.75 0.125 
+0.875 0.75 0.25 
+0.875 0.875 0 
+1 0.875 0 
+0.875 0.875 0.125 
+1 0.875 0.125 
+1 1 0.125 
+1 0.875 0.25 
+0.875 0.875 0.25 
+0.875 0.875 0.375 
+1 0.875 0.375 
+1 1 0.375 
+0.75 0.625 0.25 
+1 0.625 0.25 
+0.875 0.625 0.25 
+0.875 0.625 0.375 
+1 0.625 0.375 
+1 0.625 0.5 
+1 0.75 0.375 
+0.875 0.75 0.375 
+1 0.875 0.5 
+0.625 0.75 0 
+0.625 0.75 0.125 
+0.625 0.875 0 
+0.625 1 0 
+0.625 0.875 0.125 
+0.625 1 0.125 
+0.75 1 0.125 
+0.75 0.875 0 
+0.75 0.875 0.125 
+0.75 0.875 0.25 
+0.875 1 0 
+0.875 1 0.125 
+0.875 1 0.25 
+0.875 1 0.375 
+0.625 0.75 0.25 
+0.625 1 0.25 
+0.625 0.875 0.25 
+0.625 0.875 0.375 
+0.625 1 0.375 
+0.625 1 0.5 
+0.75 1 0.375 
+0.75 0.875 0.375 
+0.875 1 0.5 
+0.625 0.625 0.25 
+0.625 0.625 0.375 
+0.625 0.625 0.5 
+0.75 0.625 0.5 
+0.75 0.625 0.375 
+0.75 0.75 0.375 
+0.875 0.625 0.5 
+0.875 0.75 0.5 
+0.875 0.875 0.5 
+0.625 0.75 0.5 
+0.625 0.75 0.375 
+0.625 0.875 0.5 
+0.75 0.875 0.5 
+0.125 0.125 0.625 
+0.25 0.125 0.625 
+0.25 0.25 0.625 
+0.375 0.125 0.625 
+0.5 0.125 0.625 
+0.5 0.25 0.625 
+0.375 0.25 0.625 
+0.375 0.25 0.75 
+0.375 0.375 0.625 
+0.5 0.375 0.625 
+0.5 0.5 0.625 
+0.5 0.375 0.75 
+0.375 0.375 0.75 
+0.375 0.375 0.875 
+0.5 0.375 0.875 
+0.5 0.5 0.875 
+0.125 0 0.625 
+0.25 0 0.625 
+0.25 0.125 0.75 
+0.375 0 0.625 
+0.5 0 0.625 
+0.5 0.125 0.75 
+0.375 0 0.75 
+0.375 0.125 0.75 
+0.375 0 0.875 
+0.5 0 0.875 
+0.375 0.125 0.875 
+0.5 0.125 0.875 
+0.5 0.125 1 
+0.5 0.25 0.875 
+0.375 0.25 0.875 
+0.5 0.375 1 
+0.125 0.25 0.625 
+0.125 0.375 0.625 
+0.125 0.5 0.625 
+0.25 0.5 0.625 
+0.25 0.375 0.625 
+0.25 0.375 0.75 
+0.375 0.5 0.625 
+0.375 0.5 0.75 
+0.375 0.5 0.875 
+0 0.125 0.625 
+0 0.25 0.625 
+0.125 0.25 0.75 
+0 0.375 0.625 
+0 0.5 0.625 
+0.125 0.5 0.75 
+0 0.375 0.75 
+0.125 0.375 0.75 
+0 0.375 0.875 
+0 0.5 0.875 
+0.125 0.375 0.875 
+0.125 0.5 0.875 
+0.125 0.5 1 
+0.25 0.5 0.875 
+0.25 0.375 0.875 
+0.375 0.5 1 
+0 0 0.625 
+0.125 0 0.75 
+0.125 0.125 0.75 
+0 0 0.875 
+0.125 0 0.875 
+0.125 0 1 
+0.125 0.125 0.875 
+0.125 0.125 1 
+0.25 0.125 1 
+0.25 0 0.875 
+0.25 0.125 0.875 
+0.25 0.25 0.875 
+0.375 0 1 
+0.375 0.125 1 
+0.375 0.25 1 
+0.375 0.375 1 
+0 0.125 0.75 
+0 0.125 0.875 
+0 0.125 1 
+0.125 0.25 1 
+0 0.25 0.875 
+0.125 0.25 0.875 
+0 0.375 1 
+0.125 0.375 1 
+0.25 0.375 1 
+0.625 0.125 0.625 
+0.75 0.125 0.625 
+0.75 0.25 0.625 
+0.875 0.125 0.625 
+1 0.125 0.625 
+1 0.25 0.625 
+0.875 0.25 0.625 
+0.875 0.25 0.75 
+0.875 0.375 0.625 
+1 0.375 0.625 
+1 0.5 0.625 
+1 0.375 0.75 
+0.875 0.375 0.75 
+0.875 0.375 0.875 
+1 0.375 0.875 
+1 0.5 0.875 
+0.625 0 0.625 
+0.75 0 0.625 
+0.75 0.125 0.75 
+0.875 0 0.625 
+1 0 0.625 
+1 0.125 0.75 
+0.875 0 0.75 
+0.875 0.125 0.75 
+0.875 0 0.875 
+1 0 0.875 
+0.875 0.125 0.875 
+1 0.125 0.875 
+1 0.125 1 
+1 0.25 0.875 
+0.875 0.25 0.875 
+1 0.375 1 
+0.625 0.25 0.625 
+0.625 0.375 0.625 
+0.625 0.5 0.625 
+0.75 0.5 0.625 
+0.75 0.375 0.625 
+0.75 0.375 0.75 
+0.875 0.5 0.625 
+0.875 0.5 0.75 
+0.875 0.5 0.875 
+0.625 0.25 0.75 
+0.625 0.5 0.75 
+0.625 0.375 0.75 
+0.625 0.375 0.875 
+0.625 0.5 0.875 
+0.625 0.5 1 
+0.75 0.5 0.875 
+0.75 0.375 0.875 
+0.875 0.5 1 
+0.625 0 0.75 
+0.625 0.125 0.75 
+0.625 0 0.875 
+0.625 0 1 
+0.625 0.125 0.875 
+0.625 0.125 1 
+0.75 0.125 1 
+0.75 0 0.875 
+0.75 0.125 0.875 
+0.75 0.25 0.875 
+0.875 0 1 
+0.875 0.125 1 
+0.875 0.25 1 
+0.875 0.375 1 
+0.625 0.25 1 
+0.625 0.25 0.875 
+0.625 0.375 1 
+0.75 0.375 1 
+0.125 0.625 0.625 
+0.25 0.625 0.625 
+0.25 0.75 0.625 
+0.375 0.625 0.625 
+0.5 0.625 0.625 
+0.5 0.75 0.625 
+0.375 0.75 0.625 
+0.375 0.75 0.75 
+0.375 0.875 0.625 
+0.5 0.875 0.625 
+0.5 1 0.625 
+0.5 0.875 0.75 
+0.375 0.875 0.75 
+0.375 0.875 0.875 
+0.5 0.875 0.875 
+0.5 1 0.875 
+0.25 0.625 0.75 
+0.5 0.625 0.75 
+0.375 0.625 0.75 
+0.375 0.625 0.875 
+0.5 0.625 0.875 
+0.5 0.625 1 
+0.5 0.75 0.875 
+0.375 0.75 0.875 
+0.5 0.875 1 
+0.125 0.75 0.625 
+0.125 0.875 0.625 
+0.125 1 0.625 
+0.25 1 0.625 
+0.25 0.875 0.625 
+0.25 0.875 0.75 
+0.375 1 0.625 
+0.375 1 0.75 
+0.375 1 0.875 
+0 0.625 0.625 
+0 0.75 0.625 
+0.125 0.75 0.75 
+0 0.875 0.625 
+0 1 0.625 
+0.125 1 0.75 
+0 0.875 0.75 
+0.125 0.875 0.75 
+0 0.875 0.875 
+0 1 0.875 
+0.125 0.875 0.875 
+0.125 1 0.875 
+0.125 1 1 
+0.25 1 0.875 
+0.25 0.875 0.875 
+0.375 1 1 
+0.125 0.625 0.75 
+0.125 0.625 0.875 
+0.125 0.625 1 
+0.25 0.625 1 
+0.25 0.625 0.875 
+0.25 0.75 0.875 
+0.375 0.625 1 
+0.375 0.75 1 
+0.375 0.875 1 
+0 0.625 0.75 
+0 0.625 0.875 
+0 0.625 1 
+0.125 0.75 1 
+0 0.75 0.875 
+0.125 0.75 0.875 
+0 0.875 1 
+0.125 0.875 1 
+0.25 0.875 1 
+0.625 0.625 0.625 
+0.75 0.625 0.625 
+0.75 0.75 0.625 
+0.875 0.625 0.625 
+1 0.625 0.625 
+1 0.75 0.625 
+0.875 0.75 0.625 
+0.875 0.75 0.75 
+0.875 0.875 0.625 
+1 0.875 0.625 
+1 1 0.625 
+1 0.875 0.75 
+0.875 0.875 0.75 
+0.875 0.875 0.875 
+1 0.875 0.875 
+1 1 0.875 
+0.75 0.625 0.75 
+1 0.625 0.75 
+0.875 0.625 0.75 
+0.875 0.625 0.875 
+1 0.625 0.875 
+1 0.625 1 
+1 0.75 0.875 
+0.875 0.75 0.875 
+1 0.875 1 
+0.625 0.75 0.625 
+0.625 0.875 0.625 
+0.625 1 0.625 
+0.75 1 0.625 
+0.75 0.875 0.625 
+0.75 0.875 0.75 
+0.875 1 0.625 
+0.875 1 0.75 
+0.875 1 0.875 
+0.625 0.75 0.75 
+0.625 1 0.75 
+0.625 0.875 0.75 
+0.625 0.875 0.875 
+0.625 1 0.875 
+0.625 1 1 
+0.75 1 0.875 
+0.75 0.875 0.875 
+0.875 1 1 
+0.625 0.625 0.75 
+0.625 0.625 0.875 
+0.625 0.625 1 
+0.75 0.625 1 
+0.75 0.625 0.875 
+0.75 0.75 0.875 
+0.875 0.625 1 
+0.875 0.75 1 
+0.875 0.875 1 
+0.625 0.75 1 
+0.625 0.75 0.875 
+0.625 0.875 1 
+0.75 0.875 1 
+0.5 0.4375 0.375 
+0.5 0.4375 0.4375 
+0.5 0.5 0.4375 
+0.5 0.375 0.4375 
+0.5 0.4375 0.5 
+0.4375 0.5 0.375 
+0.4375 0.5 0.4375 
+0.375 0.5 0.4375 
+0.4375 0.5 0.5 
+0.4375 0.375 0.5 
+0.4375 0.4375 0.5 
+0.375 0.4375 0.5 
+0.5625 0.4375 0.4375 
+0.5625 0.5 0.4375 
+0.5625 0.5 0.5 
+0.5625 0.4375 0.5 
+0.4375 0.5625 0.4375 
+0.5 0.5625 0.4375 
+0.5 0.5625 0.5 
+0.4375 0.5625 0.5 
+0.5625 0.5625 0.4375 
+0.5625 0.5625 0.5 
+0.625 0.5625 0.5 
+0.5625 0.625 0.5 
+0.4375 0.4375 0.5625 
+0.5 0.4375 0.5625 
+0.5 0.5 0.5625 
+0.4375 0.5 0.5625 
+0.5625 0.4375 0.5625 
+0.5625 0.5 0.5625 
+0.625 0.5 0.5625 
+0.5625 0.5 0.625 
+0.4375 0.5625 0.5625 
+0.5 0.5625 0.5625 
+0.5 0.625 0.5625 
+0.5 0.5625 0.625 
+0.4375 0.375 0.25 
+0.375 0.375 0.3125 
+0.5 0.375 0.3125 
+0.4375 0.375 0.3125 
+0.4375 0.375 0.375 
+0.4375 0.4375 0.3125 
+0.5 0.4375 0.3125 
+0.4375 0.4375 0.375 
+0.4375 0.4375 0.4375 
+0.4375 0.25 0.375 
+0.375 0.3125 0.375 
+0.5 0.3125 0.375 
+0.4375 0.3125 0.375 
+0.4375 0.3125 0.4375 
+0.5 0.3125 0.4375 
+0.4375 0.375 0.4375 
+0.375 0.4375 0.25 
+0.375 0.5 0.3125 
+0.375 0.4375 0.3125 
+0.375 0.4375 0.375 
+0.4375 0.5 0.3125 
+0.25 0.4375 0.375 
+0.3125 0.375 0.375 
+0.3125 0.5 0.375 
+0.3125 0.4375 0.375 
+0.3125 0.4375 0.4375 
+0.3125 0.5 0.4375 
+0.375 0.4375 0.4375 
+0.375 0.25 0.4375 
+0.375 0.3125 0.5 
+0.375 0.3125 0.4375 
+0.375 0.375 0.4375 
+0.4375 0.3125 0.5 
+0.25 0.375 0.4375 
+0.3125 0.375 0.5 
+0.3125 0.375 0.4375 
+0.3125 0.4375 0.5 
+0.5625 0.375 0.375 
+0.5625 0.4375 0.3125 
+0.5625 0.5 0.375 
+0.5625 0.4375 0.375 
+0.625 0.4375 0.375 
+0.625 0.5 0.4375 
+0.625 0.4375 0.4375 
+0.5625 0.3125 0.4375 
+0.5625 0.375 0.5 
+0.5625 0.375 0.4375 
+0.625 0.375 0.4375 
+0.625 0.4375 0.5 
+0.375 0.5625 0.375 
+0.4375 0.5625 0.3125 
+0.5 0.5625 0.375 
+0.4375 0.5625 0.375 
+0.4375 0.625 0.375 
+0.5 0.625 0.4375 
+0.4375 0.625 0.4375 
+0.3125 0.5625 0.4375 
+0.375 0.5625 0.5 
+0.375 0.5625 0.4375 
+0.375 0.625 0.4375 
+0.4375 0.625 0.5 
+0.5625 0.5625 0.375 
+0.625 0.5625 0.375 
+0.625 0.5625 0.4375 
+0.625 0.625 0.4375 
+0.6875 0.5625 0.4375 
+0.6875 0.5625 0.5 
+0.6875 0.625 0.5 
+0.5625 0.625 0.375 
+0.5625 0.625 0.4375 
+0.5625 0.6875 0.4375 
+0.5625 0.6875 0.5 
+0.625 0.6875 0.5 
+0.375 0.375 0.5625 
+0.4375 0.3125 0.5625 
+0.5 0.375 0.5625 
+0.4375 0.375 0.5625 
+0.4375 0.375 0.625 
+0.5 0.4375 0.625 
+0.4375 0.4375 0.625 
+0.3125 0.4375 0.5625 
+0.375 0.5 0.5625 
+0.375 0.4375 0.5625 
+0.375 0.4375 0.625 
+0.4375 0.5 0.625 
+0.5625 0.375 0.5625 
+0.625 0.375 0.5625 
+0.625 0.4375 0.5625 
+0.625 0.4375 0.625 
+0.6875 0.4375 0.5625 
+0.6875 0.5 0.5625 
+0.6875 0.5 0.625 
+0.5625 0.375 0.625 
+0.5625 0.4375 0.625 
+0.5625 0.4375 0.6875 
+0.5625 0.5 0.6875 
+0.625 0.5 0.6875 
+0.375 0.5625 0.5625 
+0.375 0.625 0.5625 
+0.4375 0.625 0.5625 
+0.4375 0.625 0.625 
+0.4375 0.6875 0.5625 
+0.5 0.6875 0.5625 
+0.5 0.6875 0.625 
+0.375 0.5625 0.625 
+0.4375 0.5625 0.625 
+0.4375 0.5625 0.6875 
+0.5 0.5625 0.6875 
+0.5 0.625 0.6875 
+0.5625 0.5625 0.5625 
+0.625 0.5625 0.5625 
+0.625 0.625 0.5625 
+0.6875 0.5625 0.5625 
+0.75 0.625 0.5625 
+0.6875 0.625 0.5625 
+0.6875 0.625 0.625 
+0.625 0.5625 0.625 
+0.75 0.5625 0.625 
+0.6875 0.5625 0.625 
+0.5625 0.625 0.5625 
+0.5625 0.6875 0.5625 
+0.625 0.75 0.5625 
+0.625 0.6875 0.5625 
+0.625 0.6875 0.625 
+0.5625 0.625 0.625 
+0.5625 0.75 0.625 
+0.5625 0.6875 0.625 
+0.5625 0.5625 0.625 
+0.5625 0.5625 0.6875 
+0.625 0.5625 0.75 
+0.625 0.5625 0.6875 
+0.625 0.625 0.6875 
+0.5625 0.625 0.75 
+0.5625 0.625 0.6875 
+0.5 0.4375 0.25 
+0.375 0.3125 0.25 
+0.375 0.3125 0.3125 
+0.4375 0.3125 0.3125 
+0.5 0.5 0.3125 
+0.5 0.25 0.4375 
+0.375 0.25 0.3125 
+0.5 0.3125 0.5 
+0.4375 0.5 0.25 
+0.3125 0.375 0.25 
+0.3125 0.375 0.3125 
+0.3125 0.4375 0.3125 
+0.25 0.5 0.4375 
+0.25 0.375 0.3125 
+0.3125 0.5 0.5 
+0.4375 0.25 0.5 
+0.3125 0.25 0.375 
+0.3125 0.3125 0.375 
+0.3125 0.3125 0.4375 
+0.25 0.4375 0.5 
+0.25 0.3125 0.375 
+0.5625 0.5 0.3125 
+0.6875 0.4375 0.4375 
+0.6875 0.5 0.4375 
+0.6875 0.5 0.5 
+0.5625 0.3125 0.5 
+0.6875 0.4375 0.5 
+0.5 0.5625 0.3125 
+0.4375 0.6875 0.4375 
+0.5 0.6875 0.4375 
+0.5 0.6875 0.5 
+0.3125 0.5625 0.5 
+0.4375 0.6875 0.5 
+0.5625 0.5625 0.3125 
+0.75 0.5625 0.5 
+0.5625 0.75 0.5 
+0.5 0.3125 0.5625 
+0.4375 0.4375 0.6875 
+0.5 0.4375 0.6875 
+0.5 0.5 0.6875 
+0.3125 0.5 0.5625 
+0.4375 0.5 0.6875 
+0.5625 0.3125 0.5625 
+0.75 0.5 0.5625 
+0.5625 0.5 0.75 
+0.3125 0.5625 0.5625 
+0.5 0.75 0.5625 
+0.5 0.5625 0.75 
+0.6875 0.6875 0.5625 
+0.75 0.6875 0.625 
+0.6875 0.6875 0.625 
+0.6875 0.5625 0.6875 
+0.75 0.625 0.6875 
+0.6875 0.625 0.6875 
+0.6875 0.75 0.625 
+0.5625 0.6875 0.6875 
+0.625 0.75 0.6875 
+0.625 0.6875 0.6875 
+0.6875 0.625 0.75 
+0.625 0.6875 0.75 
+0.5 0.4375 0.40625 
+0.53125 0.4375 0.40625 
+0.53125 0.4375 0.4375 
+0.5 0.46875 0.375 
+0.5 0.46875 0.40625 
+0.5 0.5 0.40625 
+0.53125 0.46875 0.40625 
+0.53125 0.5 0.40625 
+0.53125 0.5 0.4375 
+0.5 0.46875 0.4375 
+0.53125 0.46875 0.4375 
+0.5625 0.46875 0.4375 
+0.5 0.46875 0.46875 
+0.5 0.5 0.46875 
+0.53125 0.46875 0.46875 
+0.53125 0.5 0.46875 
+0.53125 0.5 0.5 
+0.5625 0.5 0.46875 
+0.5625 0.46875 0.46875 
+0.59375 0.46875 0.46875 
+0.59375 0.5 0.46875 
+0.59375 0.5 0.5 
+0.5 0.40625 0.4375 
+0.53125 0.40625 0.4375 
+0.5 0.375 0.46875 
+0.5 0.40625 0.46875 
+0.5 0.40625 0.5 
+0.53125 0.40625 0.46875 
+0.53125 0.40625 0.5 
+0.53125 0.4375 0.5 
+0.5 0.4375 0.46875 
+0.53125 0.4375 0.46875 
+0.5625 0.4375 0.46875 
+0.5 0.46875 0.5 
+0.53125 0.46875 0.5 
+0.5625 0.46875 0.5 
+0.59375 0.46875 0.5 
+0.4375 0.5 0.40625 
+0.4375 0.53125 0.40625 
+0.4375 0.53125 0.4375 
+0.46875 0.5 0.375 
+0.46875 0.5 0.40625 
+0.46875 0.53125 0.40625 
+0.5 0.53125 0.40625 
+0.5 0.53125 0.4375 
+0.46875 0.5 0.4375 
+0.46875 0.53125 0.4375 
+0.46875 0.5625 0.4375 
+0.46875 0.5 0.46875 
+0.46875 0.53125 0.46875 
+0.5 0.53125 0.46875 
+0.5 0.53125 0.5 
+0.5 0.5625 0.46875 
+0.46875 0.5625 0.46875 
+0.46875 0.59375 0.46875 
+0.5 0.59375 0.46875 
+0.5 0.59375 0.5 
+0.40625 0.5 0.4375 
+0.40625 0.53125 0.4375 
+0.375 0.5 0.46875 
+0.40625 0.5 0.46875 
+0.40625 0.5 0.5 
+0.40625 0.53125 0.46875 
+0.40625 0.53125 0.5 
+0.4375 0.53125 0.5 
+0.4375 0.5 0.46875 
+0.4375 0.53125 0.46875 
+0.4375 0.5625 0.46875 
+0.46875 0.5 0.5 
+0.46875 0.53125 0.5 
+0.46875 0.5625 0.5 
+0.46875 0.59375 0.5 
+0.53125 0.53125 0.40625 
+0.53125 0.53125 0.4375 
+0.5625 0.53125 0.4375 
+0.53125 0.53125 0.46875 
+0.53125 0.53125 0.5 
+0.5625 0.53125 0.5 
+0.5625 0.53125 0.46875 
+0.5625 0.5625 0.46875 
+0.59375 0.53125 0.46875 
+0.59375 0.53125 0.5 
+0.625 0.53125 0.5 
+0.59375 0.5625 0.5 
+0.59375 0.5625 0.46875 
+0.53125 0.5625 0.4375 
+0.53125 0.5625 0.5 
+0.53125 0.5625 0.46875 
+0.53125 0.59375 0.46875 
+0.53125 0.59375 0.5 
+0.53125 0.625 0.5 
+0.5625 0.59375 0.5 
+0.5625 0.59375 0.46875 
+0.4375 0.40625 0.5 
+0.4375 0.40625 0.53125 
+0.4375 0.4375 0.53125 
+0.46875 0.375 0.5 
+0.46875 0.40625 0.5 
+0.46875 0.40625 0.53125 
+0.5 0.40625 0.53125 
+0.5 0.4375 0.53125 
+0.46875 0.4375 0.5 
+0.46875 0.4375 0.53125 
+0.46875 0.4375 0.5625 
+0.46875 0.46875 0.5 
+0.46875 0.46875 0.53125 
+0.5 0.46875 0.53125 
+0.5 0.5 0.53125 
+0.5 0.46875 0.5625 
+0.46875 0.46875 0.5625 
+0.46875 0.46875 0.59375 
+0.5 0.46875 0.59375 
+0.5 0.5 0.59375 
+0.40625 0.4375 0.5 
+0.40625 0.4375 0.53125 
+0.375 0.46875 0.5 
+0.40625 0.46875 0.5 
+0.40625 0.46875 0.53125 
+0.40625 0.5 0.53125 
+0.4375 0.5 0.53125 
+0.4375 0.46875 0.5 
+0.4375 0.46875 0.53125 
+0.4375 0.46875 0.5625 
+0.46875 0.5 0.53125 
+0.46875 0.5 0.5625 
+0.46875 0.5 0.59375 
+0.53125 0.40625 0.53125 
+0.53125 0.4375 0.53125 
+0.5625 0.4375 0.53125 
+0.53125 0.46875 0.53125 
+0.53125 0.5 0.53125 
+0.5625 0.5 0.53125 
+0.5625 0.46875 0.53125 
+0.5625 0.46875 0.5625 
+0.59375 0.46875 0.53125 
+0.59375 0.5 0.53125 
+0.625 0.5 0.53125 
+0.59375 0.5 0.5625 
+0.59375 0.46875 0.5625 
+0.53125 0.4375 0.5625 
+0.53125 0.5 0.5625 
+0.53125 0.46875 0.5625 
+0.53125 0.46875 0.59375 
+0.53125 0.5 0.59375 
+0.53125 0.5 0.625 
+0.5625 0.5 0.59375 
+0.5625 0.46875 0.59375 
+0.40625 0.53125 0.53125 
+0.4375 0.53125 0.53125 
+0.4375 0.5625 0.53125 
+0.46875 0.53125 0.53125 
+0.5 0.53125 0.53125 
+0.5 0.5625 0.53125 
+0.46875 0.5625 0.53125 
+0.46875 0.5625 0.5625 
+0.46875 0.59375 0.53125 
+0.5 0.59375 0.53125 
+0.5 0.625 0.53125 
+0.5 0.59375 0.5625 
+0.46875 0.59375 0.5625 
+0.4375 0.53125 0.5625 
+0.5 0.53125 0.5625 
+0.46875 0.53125 0.5625 
+0.46875 0.53125 0.59375 
+0.5 0.53125 0.59375 
+0.5 0.53125 0.625 
+0.5 0.5625 0.59375 
+0.46875 0.5625 0.59375 
+0.5 0.40625 0.375 
+0.5 0.40625 0.40625 
+0.53125 0.40625 0.40625 
+0.5 0.375 0.40625 
+0.40625 0.5 0.375 
+0.40625 0.5 0.40625 
+0.40625 0.53125 0.40625 
+0.375 0.5 0.40625 
+0.59375 0.59375 0.46875 
+0.59375 0.59375 0.5 
+0.625 0.59375 0.5 
+0.59375 0.625 0.5 
+0.40625 0.375 0.5 
+0.40625 0.40625 0.5 
+0.40625 0.40625 0.53125 
+0.375 0.40625 0.5 
+0.59375 0.46875 0.59375 
+0.59375 0.5 0.59375 
+0.625 0.5 0.59375 
+0.59375 0.5 0.625 
+0.46875 0.59375 0.59375 
+0.5 0.59375 0.59375 
+0.5 0.625 0.59375 
+0.5 0.59375 0.625 
+0.4375 0.40625 0.375 
+0.46875 0.375 0.375 
+0.46875 0.40625 0.375 
+0.46875 0.4375 0.375 
+0.46875 0.46875 0.375 
+0.4375 0.4375 0.40625 
+0.46875 0.40625 0.40625 
+0.46875 0.4375 0.40625 
+0.46875 0.4375 0.4375 
+0.46875 0.46875 0.40625 
+0.46875 0.46875 0.4375 
+0.46875 0.46875 0.46875 
+0.4375 0.375 0.40625 
+0.46875 0.375 0.40625 
+0.46875 0.375 0.4375 
+0.46875 0.375 0.46875 
+0.4375 0.40625 0.4375 
+0.46875 0.40625 0.4375 
+0.46875 0.40625 0.46875 
+0.46875 0.4375 0.46875 
+0.40625 0.4375 0.375 
+0.375 0.46875 0.375 
+0.40625 0.46875 0.375 
+0.4375 0.46875 0.375 
+0.40625 0.46875 0.40625 
+0.4375 0.46875 0.40625 
+0.4375 0.46875 0.4375 
+0.375 0.4375 0.40625 
+0.375 0.46875 0.40625 
+0.375 0.46875 0.4375 
+0.375 0.46875 0.46875 
+0.40625 0.4375 0.4375 
+0.40625 0.46875 0.4375 
+0.40625 0.46875 0.46875 
+0.4375 0.46875 0.46875 
+0.40625 0.375 0.4375 
+0.375 0.375 0.46875 
+0.40625 0.375 0.46875 
+0.4375 0.375 0.46875 
+0.40625 0.40625 0.46875 
+0.4375 0.40625 0.46875 
+0.4375 0.4375 0.46875 
+0.375 0.40625 0.4375 
+0.375 0.40625 0.46875 
+0.375 0.4375 0.46875 
+0.40625 0.4375 0.46875 
+0.53125 0.4375 0.375 
+0.53125 0.46875 0.375 
+0.53125 0.5 0.375 
+0.5625 0.46875 0.375 
+0.5625 0.4375 0.40625 
+0.5625 0.5 0.40625 
+0.5625 0.46875 0.40625 
+0.59375 0.46875 0.40625 
+0.59375 0.5 0.4375 
+0.59375 0.46875 0.4375 
+0.625 0.5 0.46875 
+0.59375 0.4375 0.4375 
+0.625 0.46875 0.4375 
+0.625 0.46875 0.46875 
+0.53125 0.375 0.4375 
+0.53125 0.375 0.46875 
+0.53125 0.375 0.5 
+0.5625 0.375 0.46875 
+0.5625 0.40625 0.4375 
+0.5625 0.40625 0.5 
+0.5625 0.40625 0.46875 
+0.59375 0.40625 0.46875 
+0.59375 0.4375 0.5 
+0.59375 0.4375 0.46875 
+0.625 0.46875 0.5 
+0.625 0.4375 0.46875 
+0.4375 0.53125 0.375 
+0.46875 0.53125 0.375 
+0.5 0.53125 0.375 
+0.46875 0.5625 0.375 
+0.4375 0.5625 0.40625 
+0.5 0.5625 0.40625 
+0.46875 0.5625 0.40625 
+0.46875 0.59375 0.40625 
+0.5 0.59375 0.4375 
+0.46875 0.59375 0.4375 
+0.5 0.625 0.46875 
+0.4375 0.59375 0.4375 
+0.46875 0.625 0.4375 
+0.46875 0.625 0.46875 
+0.375 0.53125 0.4375 
+0.375 0.53125 0.46875 
+0.375 0.53125 0.5 
+0.375 0.5625 0.46875 
+0.40625 0.5625 0.4375 
+0.40625 0.5625 0.5 
+0.40625 0.5625 0.46875 
+0.40625 0.59375 0.46875 
+0.4375 0.59375 0.5 
+0.4375 0.59375 0.46875 
+0.46875 0.625 0.5 
+0.4375 0.625 0.46875 
+0.5625 0.53125 0.40625 
+0.59375 0.53125 0.40625 
+0.625 0.53125 0.4375 
+0.59375 0.53125 0.4375 
+0.59375 0.5625 0.4375 
+0.625 0.53125 0.46875 
+0.625 0.5625 0.46875 
+0.53125 0.53125 0.375 
+0.5625 0.53125 0.375 
+0.5625 0.5625 0.40625 
+0.53125 0.5625 0.40625 
+0.53125 0.59375 0.40625 
+0.53125 0.625 0.4375 
+0.53125 0.59375 0.4375 
+0.5625 0.59375 0.4375 
+0.53125 0.625 0.46875 
+0.5625 0.625 0.46875 
+0.53125 0.5625 0.375 
+0.4375 0.375 0.53125 
+0.46875 0.375 0.53125 
+0.5 0.375 0.53125 
+0.46875 0.375 0.5625 
+0.4375 0.40625 0.5625 
+0.5 0.40625 0.5625 
+0.46875 0.40625 0.5625 
+0.46875 0.40625 0.59375 
+0.5 0.4375 0.59375 
+0.46875 0.4375 0.59375 
+0.5 0.46875 0.625 
+0.4375 0.4375 0.59375 
+0.46875 0.4375 0.625 
+0.46875 0.46875 0.625 
+0.375 0.4375 0.53125 
+0.375 0.46875 0.53125 
+0.375 0.5 0.53125 
+0.375 0.46875 0.5625 
+0.40625 0.4375 0.5625 
+0.40625 0.5 0.5625 
+0.40625 0.46875 0.5625 
+0.40625 0.46875 0.59375 
+0.4375 0.5 0.59375 
+0.4375 0.46875 0.59375 
+0.46875 0.5 0.625 
+0.4375 0.46875 0.625 
+0.5625 0.40625 0.53125 
+0.59375 0.40625 0.53125 
+0.625 0.4375 0.53125 
+0.59375 0.4375 0.53125 
+0.59375 0.4375 0.5625 
+0.625 0.46875 0.53125 
+0.625 0.46875 0.5625 
+0.53125 0.375 0.53125 
+0.5625 0.375 0.53125 
+0.5625 0.40625 0.5625 
+0.53125 0.40625 0.5625 
+0.53125 0.40625 0.59375 
+0.53125 0.4375 0.625 
+0.53125 0.4375 0.59375 
+0.5625 0.4375 0.59375 
+0.53125 0.46875 0.625 
+0.5625 0.46875 0.625 
+0.53125 0.375 0.5625 
+0.40625 0.5625 0.53125 
+0.40625 0.59375 0.53125 
+0.4375 0.625 0.53125 
+0.4375 0.59375 0.53125 
+0.4375 0.59375 0.5625 
+0.46875 0.625 0.53125 
+0.46875 0.625 0.5625 
+0.375 0.53125 0.53125 
+0.375 0.5625 0.53125 
+0.40625 0.5625 0.5625 
+0.40625 0.53125 0.5625 
+0.40625 0.53125 0.59375 
+0.4375 0.53125 0.625 
+0.4375 0.53125 0.59375 
+0.4375 0.5625 0.59375 
+0.46875 0.53125 0.625 
+0.46875 0.5625 0.625 
+0.375 0.53125 0.5625 
+0.53125 0.53125 0.53125 
+0.5625 0.53125 0.53125 
+0.5625 0.5625 0.53125 
+0.59375 0.53125 0.53125 
+0.625 0.53125 0.53125 
+0.625 0.5625 0.53125 
+0.59375 0.5625 0.53125 
+0.59375 0.5625 0.5625 
+0.59375 0.59375 0.53125 
+0.625 0.59375 0.53125 
+0.625 0.625 0.53125 
+0.625 0.59375 0.5625 
+0.5625 0.53125 0.5625 
+0.625 0.53125 0.5625 
+0.59375 0.53125 0.5625 
+0.59375 0.53125 0.59375 
+0.625 0.53125 0.59375 
+0.625 0.53125 0.625 
+0.625 0.5625 0.59375 
+0.53125 0.5625 0.53125 
+0.53125 0.59375 0.53125 
+0.53125 0.625 0.53125 
+0.5625 0.625 0.53125 
+0.5625 0.59375 0.53125 
+0.5625 0.59375 0.5625 
+0.59375 0.625 0.53125 
+0.59375 0.625 0.5625 
+0.53125 0.5625 0.5625 
+0.53125 0.625 0.5625 
+0.53125 0.59375 0.5625 
+0.53125 0.59375 0.59375 
+0.53125 0.625 0.59375 
+0.53125 0.625 0.625 
+0.5625 0.625 0.59375 
+0.53125 0.53125 0.5625 
+0.53125 0.53125 0.59375 
+0.53125 0.53125 0.625 
+0.5625 0.53125 0.625 
+0.5625 0.53125 0.59375 
+0.5625 0.5625 0.59375 
+0.59375 0.53125 0.625 
+0.59375 0.5625 0.625 
+0.53125 0.5625 0.625 
+0.53125 0.5625 0.59375 
+0.53125 0.59375 0.625 
+0.5625 0.59375 0.625 
+0.515625 0.46875 0.40625 
+0.515625 0.5 0.40625 
+0.5 0.484375 0.40625 
+0.515625 0.484375 0.40625 
+0.53125 0.484375 0.40625 
+0.5 0.484375 0.421875 
+0.5 0.5 0.421875 
+0.515625 0.484375 0.421875 
+0.515625 0.5 0.421875 
+0.515625 0.5 0.4375 
+0.53125 0.5 0.421875 
+0.53125 0.484375 0.421875 
+0.546875 0.484375 0.421875 
+0.546875 0.5 0.421875 
+0.546875 0.5 0.4375 
+0.5 0.453125 0.40625 
+0.515625 0.453125 0.40625 
+0.5 0.4375 0.421875 
+0.5 0.453125 0.421875 
+0.5 0.453125 0.4375 
+0.515625 0.453125 0.421875 
+0.515625 0.453125 0.4375 
+0.515625 0.46875 0.4375 
+0.5 0.46875 0.421875 
+0.515625 0.46875 0.421875 
+0.53125 0.46875 0.421875 
+0.5 0.484375 0.4375 
+0.515625 0.484375 0.4375 
+0.53125 0.484375 0.4375 
+0.546875 0.484375 0.4375 
+0.515625 0.4375 0.40625 
+0.53125 0.453125 0.40625 
+0.515625 0.4375 0.421875 
+0.515625 0.4375 0.4375 
+0.53125 0.453125 0.4375 
+0.53125 0.4375 0.421875 
+0.53125 0.453125 0.421875 
+0.546875 0.4375 0.4375 
+0.546875 0.453125 0.421875 
+0.546875 0.453125 0.4375 
+0.5625 0.453125 0.4375 
+0.546875 0.46875 0.4375 
+0.546875 0.46875 0.421875 
+0.5625 0.484375 0.4375 
+0.5 0.453125 0.453125 
+0.5 0.46875 0.453125 
+0.515625 0.453125 0.453125 
+0.515625 0.46875 0.453125 
+0.515625 0.46875 0.46875 
+0.5 0.484375 0.453125 
+0.5 0.5 0.453125 
+0.515625 0.484375 0.453125 
+0.515625 0.5 0.453125 
+0.515625 0.5 0.46875 
+0.5 0.484375 0.46875 
+0.515625 0.484375 0.46875 
+0.53125 0.484375 0.46875 
+0.5 0.484375 0.484375 
+0.5 0.5 0.484375 
+0.515625 0.484375 0.484375 
+0.515625 0.5 0.484375 
+0.515625 0.5 0.5 
+0.53125 0.5 0.484375 
+0.53125 0.484375 0.484375 
+0.546875 0.484375 0.484375 
+0.546875 0.5 0.484375 
+0.546875 0.5 0.5 
+0.53125 0.46875 0.453125 
+0.53125 0.5 0.453125 
+0.53125 0.484375 0.453125 
+0.546875 0.484375 0.453125 
+0.546875 0.5 0.453125 
+0.5625 0.5 0.453125 
+0.546875 0.5 0.46875 
+0.546875 0.484375 0.46875 
+0.5625 0.5 0.484375 
+0.53125 0.453125 0.453125 
+0.546875 0.453125 0.453125 
+0.5625 0.453125 0.453125 
+0.5625 0.46875 0.453125 
+0.546875 0.46875 0.453125 
+0.546875 0.46875 0.46875 
+0.5625 0.484375 0.453125 
+0.5625 0.484375 0.46875 
+0.5625 0.484375 0.484375 
+0.578125 0.453125 0.453125 
+0.578125 0.46875 0.453125 
+0.578125 0.46875 0.46875 
+0.578125 0.484375 0.453125 
+0.578125 0.5 0.453125 
+0.578125 0.5 0.46875 
+0.578125 0.484375 0.46875 
+0.59375 0.484375 0.46875 
+0.578125 0.484375 0.484375 
+0.578125 0.5 0.484375 
+0.578125 0.5 0.5 
+0.59375 0.5 0.484375 
+0.59375 0.484375 0.484375 
+0.515625 0.40625 0.46875 
+0.515625 0.40625 0.5 
+0.5 0.40625 0.484375 
+0.515625 0.40625 0.484375 
+0.53125 0.40625 0.484375 
+0.5 0.421875 0.484375 
+0.5 0.421875 0.5 
+0.515625 0.421875 0.484375 
+0.515625 0.421875 0.5 
+0.515625 0.4375 0.5 
+0.53125 0.421875 0.5 
+0.53125 0.421875 0.484375 
+0.546875 0.421875 0.484375 
+0.546875 0.421875 0.5 
+0.546875 0.4375 0.5 
+0.5 0.40625 0.453125 
+0.515625 0.40625 0.453125 
+0.5 0.421875 0.4375 
+0.5 0.421875 0.453125 
+0.5 0.4375 0.453125 
+0.515625 0.421875 0.453125 
+0.515625 0.4375 0.453125 
+0.515625 0.4375 0.46875 
+0.5 0.421875 0.46875 
+0.515625 0.421875 0.46875 
+0.53125 0.421875 0.46875 
+0.5 0.4375 0.484375 
+0.515625 0.4375 0.484375 
+0.53125 0.4375 0.484375 
+0.546875 0.4375 0.484375 
+0.515625 0.40625 0.4375 
+0.53125 0.40625 0.453125 
+0.515625 0.421875 0.4375 
+0.53125 0.4375 0.453125 
+0.53125 0.421875 0.4375 
+0.53125 0.421875 0.453125 
+0.546875 0.421875 0.453125 
+0.546875 0.4375 0.453125 
+0.5625 0.4375 0.453125 
+0.546875 0.4375 0.46875 
+0.546875 0.421875 0.46875 
+0.5625 0.4375 0.484375 
+0.5 0.453125 0.46875 
+0.515625 0.453125 0.46875 
+0.5 0.453125 0.484375 
+0.5 0.453125 0.5 
+0.515625 0.453125 0.484375 
+0.515625 0.453125 0.5 
+0.515625 0.46875 0.5 
+0.5 0.46875 0.484375 
+0.515625 0.46875 0.484375 
+0.53125 0.46875 0.484375 
+0.5 0.484375 0.5 
+0.515625 0.484375 0.5 
+0.53125 0.484375 0.5 
+0.546875 0.484375 0.5 
+0.53125 0.453125 0.46875 
+0.53125 0.453125 0.5 
+0.53125 0.453125 0.484375 
+0.546875 0.453125 0.484375 
+0.546875 0.453125 0.5 
+0.5625 0.453125 0.5 
+0.546875 0.46875 0.5 
+0.546875 0.46875 0.484375 
+0.5625 0.484375 0.5 
+0.5625 0.453125 0.46875 
+0.546875 0.453125 0.46875 
+0.5625 0.453125 0.484375 
+0.5625 0.46875 0.484375 
+0.578125 0.453125 0.46875 
+0.578125 0.453125 0.484375 
+0.578125 0.453125 0.5 
+0.578125 0.46875 0.5 
+0.578125 0.46875 0.484375 
+0.59375 0.46875 0.484375 
+0.578125 0.484375 0.5 
+0.59375 0.484375 0.5 
+0.46875 0.515625 0.40625 
+0.5 0.515625 0.40625 
+0.484375 0.5 0.40625 
+0.484375 0.515625 0.40625 
+0.484375 0.53125 0.40625 
+0.484375 0.5 0.421875 
+0.484375 0.515625 0.421875 
+0.5 0.515625 0.421875 
+0.5 0.515625 0.4375 
+0.5 0.53125 0.421875 
+0.484375 0.53125 0.421875 
+0.484375 0.546875 0.421875 
+0.5 0.546875 0.421875 
+0.5 0.546875 0.4375 
+0.453125 0.5 0.40625 
+0.453125 0.515625 0.40625 
+0.4375 0.5 0.421875 
+0.453125 0.5 0.421875 
+0.453125 0.5 0.4375 
+0.453125 0.515625 0.421875 
+0.453125 0.515625 0.4375 
+0.46875 0.515625 0.4375 
+0.46875 0.5 0.421875 
+0.46875 0.515625 0.421875 
+0.46875 0.53125 0.421875 
+0.484375 0.5 0.4375 
+0.484375 0.515625 0.4375 
+0.484375 0.53125 0.4375 
+0.484375 0.546875 0.4375 
+0.4375 0.515625 0.40625 
+0.453125 0.53125 0.40625 
+0.4375 0.515625 0.421875 
+0.4375 0.515625 0.4375 
+0.453125 0.53125 0.4375 
+0.4375 0.53125 0.421875 
+0.453125 0.53125 0.421875 
+0.4375 0.546875 0.4375 
+0.453125 0.546875 0.421875 
+0.453125 0.546875 0.4375 
+0.453125 0.5625 0.4375 
+0.46875 0.546875 0.4375 
+0.46875 0.546875 0.421875 
+0.484375 0.5625 0.4375 
+0.453125 0.5 0.453125 
+0.46875 0.5 0.453125 
+0.453125 0.515625 0.453125 
+0.46875 0.515625 0.453125 
+0.46875 0.515625 0.46875 
+0.484375 0.5 0.453125 
+0.484375 0.515625 0.453125 
+0.5 0.515625 0.453125 
+0.5 0.515625 0.46875 
+0.484375 0.5 0.46875 
+0.484375 0.515625 0.46875 
+0.484375 0.53125 0.46875 
+0.484375 0.5 0.484375 
+0.484375 0.515625 0.484375 
+0.5 0.515625 0.484375 
+0.5 0.515625 0.5 
+0.5 0.53125 0.484375 
+0.484375 0.53125 0.484375 
+0.484375 0.546875 0.484375 
+0.5 0.546875 0.484375 
+0.5 0.546875 0.5 
+0.46875 0.53125 0.453125 
+0.5 0.53125 0.453125 
+0.484375 0.53125 0.453125 
+0.484375 0.546875 0.453125 
+0.5 0.546875 0.453125 
+0.5 0.5625 0.453125 
+0.5 0.546875 0.46875 
+0.484375 0.546875 0.46875 
+0.5 0.5625 0.484375 
+0.453125 0.53125 0.453125 
+0.453125 0.546875 0.453125 
+0.453125 0.5625 0.453125 
+0.46875 0.5625 0.453125 
+0.46875 0.546875 0.453125 
+0.46875 0.546875 0.46875 
+0.484375 0.5625 0.453125 
+0.484375 0.5625 0.46875 
+0.484375 0.5625 0.484375 
+0.453125 0.578125 0.453125 
+0.46875 0.578125 0.453125 
+0.46875 0.578125 0.46875 
+0.484375 0.578125 0.453125 
+0.5 0.578125 0.453125 
+0.5 0.578125 0.46875 
+0.484375 0.578125 0.46875 
+0.484375 0.59375 0.46875 
+0.484375 0.578125 0.484375 
+0.5 0.578125 0.484375 
+0.5 0.578125 0.5 
+0.5 0.59375 0.484375 
+0.484375 0.59375 0.484375 
+0.40625 0.515625 0.46875 
+0.40625 0.515625 0.5 
+0.40625 0.5 0.484375 
+0.40625 0.515625 0.484375 
+0.40625 0.53125 0.484375 
+0.421875 0.5 0.484375 
+0.421875 0.5 0.5 
+0.421875 0.515625 0.484375 
+0.421875 0.515625 0.5 
+0.4375 0.515625 0.5 
+0.421875 0.53125 0.5 
+0.421875 0.53125 0.484375 
+0.421875 0.546875 0.484375 
+0.421875 0.546875 0.5 
+0.4375 0.546875 0.5 
+0.40625 0.5 0.453125 
+0.40625 0.515625 0.453125 
+0.421875 0.5 0.4375 
+0.421875 0.5 0.453125 
+0.4375 0.5 0.453125 
+0.421875 0.515625 0.453125 
+0.4375 0.515625 0.453125 
+0.4375 0.515625 0.46875 
+0.421875 0.5 0.46875 
+0.421875 0.515625 0.46875 
+0.421875 0.53125 0.46875 
+0.4375 0.5 0.484375 
+0.4375 0.515625 0.484375 
+0.4375 0.53125 0.484375 
+0.4375 0.546875 0.484375 
+0.40625 0.515625 0.4375 
+0.40625 0.53125 0.453125 
+0.421875 0.515625 0.4375 
+0.4375 0.53125 0.453125 
+0.421875 0.53125 0.4375 
+0.421875 0.53125 0.453125 
+0.421875 0.546875 0.453125 
+0.4375 0.546875 0.453125 
+0.4375 0.5625 0.453125 
+0.4375 0.546875 0.46875 
+0.421875 0.546875 0.46875 
+0.4375 0.5625 0.484375 
+0.453125 0.5 0.46875 
+0.453125 0.515625 0.46875 
+0.453125 0.5 0.484375 
+0.453125 0.5 0.5 
+0.453125 0.515625 0.484375 
+0.453125 0.515625 0.5 
+0.46875 0.515625 0.5 
+0.46875 0.5 0.484375 
+0.46875 0.515625 0.484375 
+0.46875 0.53125 0.484375 
+0.484375 0.5 0.5 
+0.484375 0.515625 0.5 
+0.484375 0.53125 0.5 
+0.484375 0.546875 0.5 
+0.453125 0.53125 0.46875 
+0.453125 0.53125 0.5 
+0.453125 0.53125 0.484375 
+0.453125 0.546875 0.484375 
+0.453125 0.546875 0.5 
+0.453125 0.5625 0.5 
+0.46875 0.546875 0.5 
+0.46875 0.546875 0.484375 
+0.484375 0.5625 0.5 
+0.453125 0.5625 0.46875 
+0.453125 0.546875 0.46875 
+0.453125 0.5625 0.484375 
+0.46875 0.5625 0.484375 
+0.453125 0.578125 0.46875 
+0.453125 0.578125 0.484375 
+0.453125 0.578125 0.5 
+0.46875 0.578125 0.5 
+0.46875 0.578125 0.484375 
+0.46875 0.59375 0.484375 
+0.484375 0.578125 0.5 
+0.484375 0.59375 0.5 
+0.515625 0.515625 0.40625 
+0.53125 0.515625 0.40625 
+0.515625 0.515625 0.421875 
+0.515625 0.515625 0.4375 
+0.53125 0.515625 0.4375 
+0.53125 0.515625 0.421875 
+0.53125 0.53125 0.421875 
+0.546875 0.515625 0.421875 
+0.546875 0.515625 0.4375 
+0.5625 0.515625 0.4375 
+0.546875 0.53125 0.4375 
+0.546875 0.53125 0.421875 
+0.546875 0.546875 0.421875 
+0.546875 0.546875 0.4375 
+0.5625 0.546875 0.4375 
+0.515625 0.515625 0.453125 
+0.515625 0.515625 0.46875 
+0.53125 0.515625 0.46875 
+0.515625 0.515625 0.484375 
+0.515625 0.515625 0.5 
+0.53125 0.515625 0.5 
+0.53125 0.515625 0.484375 
+0.53125 0.53125 0.484375 
+0.546875 0.515625 0.484375 
+0.546875 0.515625 0.5 
+0.5625 0.515625 0.5 
+0.546875 0.53125 0.5 
+0.546875 0.53125 0.484375 
+0.546875 0.546875 0.484375 
+0.546875 0.546875 0.5 
+0.5625 0.546875 0.5 
+0.53125 0.515625 0.453125 
+0.546875 0.515625 0.453125 
+0.5625 0.515625 0.453125 
+0.5625 0.515625 0.46875 
+0.546875 0.515625 0.46875 
+0.546875 0.53125 0.46875 
+0.5625 0.515625 0.484375 
+0.5625 0.53125 0.484375 
+0.5625 0.546875 0.484375 
+0.53125 0.53125 0.453125 
+0.5625 0.53125 0.453125 
+0.546875 0.53125 0.453125 
+0.546875 0.546875 0.453125 
+0.5625 0.546875 0.453125 
+0.5625 0.5625 0.453125 
+0.5625 0.546875 0.46875 
+0.546875 0.546875 0.46875 
+0.5625 0.5625 0.484375 
+0.578125 0.515625 0.453125 
+0.578125 0.515625 0.46875 
+0.59375 0.515625 0.46875 
+0.578125 0.515625 0.484375 
+0.578125 0.515625 0.5 
+0.59375 0.515625 0.5 
+0.59375 0.515625 0.484375 
+0.59375 0.53125 0.484375 
+0.578125 0.53125 0.46875 
+0.578125 0.53125 0.5 
+0.578125 0.53125 0.484375 
+0.578125 0.546875 0.484375 
+0.578125 0.546875 0.5 
+0.578125 0.5625 0.5 
+0.59375 0.546875 0.5 
+0.59375 0.546875 0.484375 
+0.578125 0.53125 0.453125 
+0.578125 0.546875 0.453125 
+0.578125 0.5625 0.46875 
+0.578125 0.546875 0.46875 
+0.59375 0.546875 0.46875 
+0.578125 0.5625 0.484375 
+0.59375 0.5625 0.484375 
+0.515625 0.53125 0.40625 
+0.515625 0.53125 0.4375 
+0.515625 0.53125 0.421875 
+0.515625 0.546875 0.421875 
+0.515625 0.546875 0.4375 
+0.515625 0.5625 0.4375 
+0.53125 0.546875 0.4375 
+0.53125 0.546875 0.421875 
+0.546875 0.5625 0.4375 
+0.515625 0.53125 0.46875 
+0.515625 0.53125 0.5 
+0.515625 0.53125 0.484375 
+0.515625 0.546875 0.484375 
+0.515625 0.546875 0.5 
+0.515625 0.5625 0.5 
+0.53125 0.546875 0.5 
+0.53125 0.546875 0.484375 
+0.546875 0.5625 0.5 
+0.515625 0.53125 0.453125 
+0.515625 0.546875 0.453125 
+0.515625 0.5625 0.453125 
+0.515625 0.5625 0.46875 
+0.515625 0.546875 0.46875 
+0.53125 0.546875 0.46875 
+0.515625 0.5625 0.484375 
+0.53125 0.5625 0.484375 
+0.546875 0.5625 0.484375 
+0.53125 0.5625 0.453125 
+0.53125 0.546875 0.453125 
+0.546875 0.5625 0.453125 
+0.546875 0.5625 0.46875 
+0.515625 0.578125 0.453125 
+0.515625 0.578125 0.46875 
+0.515625 0.59375 0.46875 
+0.515625 0.578125 0.484375 
+0.515625 0.578125 0.5 
+0.515625 0.59375 0.5 
+0.515625 0.59375 0.484375 
+0.53125 0.59375 0.484375 
+0.53125 0.578125 0.46875 
+0.53125 0.578125 0.5 
+0.53125 0.578125 0.484375 
+0.546875 0.578125 0.484375 
+0.546875 0.578125 0.5 
+0.5625 0.578125 0.5 
+0.546875 0.59375 0.5 
+0.546875 0.59375 0.484375 
+0.53125 0.578125 0.453125 
+0.546875 0.578125 0.453125 
+0.5625 0.578125 0.46875 
+0.546875 0.578125 0.46875 
+0.546875 0.59375 0.46875 
+0.5625 0.578125 0.484375 
+0.5625 0.59375 0.484375 
+0.46875 0.40625 0.515625 
+0.5 0.40625 0.515625 
+0.484375 0.40625 0.5 
+0.484375 0.40625 0.515625 
+0.484375 0.40625 0.53125 
+0.484375 0.421875 0.5 
+0.484375 0.421875 0.515625 
+0.5 0.421875 0.515625 
+0.5 0.4375 0.515625 
+0.5 0.421875 0.53125 
+0.484375 0.421875 0.53125 
+0.484375 0.421875 0.546875 
+0.5 0.421875 0.546875 
+0.5 0.4375 0.546875 
+0.453125 0.40625 0.5 
+0.453125 0.40625 0.515625 
+0.4375 0.421875 0.5 
+0.453125 0.421875 0.5 
+0.453125 0.4375 0.5 
+0.453125 0.421875 0.515625 
+0.453125 0.4375 0.515625 
+0.46875 0.4375 0.515625 
+0.46875 0.421875 0.5 
+0.46875 0.421875 0.515625 
+0.46875 0.421875 0.53125 
+0.484375 0.4375 0.5 
+0.484375 0.4375 0.515625 
+0.484375 0.4375 0.53125 
+0.484375 0.4375 0.546875 
+0.4375 0.40625 0.515625 
+0.453125 0.40625 0.53125 
+0.4375 0.421875 0.515625 
+0.4375 0.4375 0.515625 
+0.453125 0.4375 0.53125 
+0.4375 0.421875 0.53125 
+0.453125 0.421875 0.53125 
+0.4375 0.4375 0.546875 
+0.453125 0.421875 0.546875 
+0.453125 0.4375 0.546875 
+0.453125 0.4375 0.5625 
+0.46875 0.4375 0.546875 
+0.46875 0.421875 0.546875 
+0.484375 0.4375 0.5625 
+0.453125 0.453125 0.5 
+0.46875 0.453125 0.5 
+0.453125 0.453125 0.515625 
+0.46875 0.453125 0.515625 
+0.46875 0.46875 0.515625 
+0.484375 0.453125 0.5 
+0.484375 0.453125 0.515625 
+0.5 0.453125 0.515625 
+0.5 0.46875 0.515625 
+0.484375 0.46875 0.5 
+0.484375 0.46875 0.515625 
+0.484375 0.46875 0.53125 
+0.484375 0.484375 0.5 
+0.484375 0.484375 0.515625 
+0.5 0.484375 0.515625 
+0.5 0.5 0.515625 
+0.5 0.484375 0.53125 
+0.484375 0.484375 0.53125 
+0.484375 0.484375 0.546875 
+0.5 0.484375 0.546875 
+0.5 0.5 0.546875 
+0.46875 0.453125 0.53125 
+0.5 0.453125 0.53125 
+0.484375 0.453125 0.53125 
+0.484375 0.453125 0.546875 
+0.5 0.453125 0.546875 
+0.5 0.453125 0.5625 
+0.5 0.46875 0.546875 
+0.484375 0.46875 0.546875 
+0.5 0.484375 0.5625 
+0.453125 0.453125 0.53125 
+0.453125 0.453125 0.546875 
+0.453125 0.453125 0.5625 
+0.46875 0.453125 0.5625 
+0.46875 0.453125 0.546875 
+0.46875 0.46875 0.546875 
+0.484375 0.453125 0.5625 
+0.484375 0.46875 0.5625 
+0.484375 0.484375 0.5625 
+0.453125 0.453125 0.578125 
+0.46875 0.453125 0.578125 
+0.46875 0.46875 0.578125 
+0.484375 0.453125 0.578125 
+0.5 0.453125 0.578125 
+0.5 0.46875 0.578125 
+0.484375 0.46875 0.578125 
+0.484375 0.46875 0.59375 
+0.484375 0.484375 0.578125 
+0.5 0.484375 0.578125 
+0.5 0.5 0.578125 
+0.5 0.484375 0.59375 
+0.484375 0.484375 0.59375 
+0.40625 0.46875 0.515625 
+0.40625 0.5 0.515625 
+0.40625 0.484375 0.5 
+0.40625 0.484375 0.515625 
+0.40625 0.484375 0.53125 
+0.421875 0.484375 0.5 
+0.421875 0.484375 0.515625 
+0.421875 0.5 0.515625 
+0.4375 0.5 0.515625 
+0.421875 0.5 0.53125 
+0.421875 0.484375 0.53125 
+0.421875 0.484375 0.546875 
+0.421875 0.5 0.546875 
+0.4375 0.5 0.546875 
+0.40625 0.453125 0.5 
+0.40625 0.453125 0.515625 
+0.421875 0.4375 0.5 
+0.421875 0.453125 0.5 
+0.4375 0.453125 0.5 
+0.421875 0.453125 0.515625 
+0.4375 0.453125 0.515625 
+0.4375 0.46875 0.515625 
+0.421875 0.46875 0.5 
+0.421875 0.46875 0.515625 
+0.421875 0.46875 0.53125 
+0.4375 0.484375 0.5 
+0.4375 0.484375 0.515625 
+0.4375 0.484375 0.53125 
+0.4375 0.484375 0.546875 
+0.40625 0.4375 0.515625 
+0.40625 0.453125 0.53125 
+0.421875 0.4375 0.515625 
+0.4375 0.453125 0.53125 
+0.421875 0.4375 0.53125 
+0.421875 0.453125 0.53125 
+0.421875 0.453125 0.546875 
+0.4375 0.453125 0.546875 
+0.4375 0.453125 0.5625 
+0.4375 0.46875 0.546875 
+0.421875 0.46875 0.546875 
+0.4375 0.484375 0.5625 
+0.453125 0.46875 0.5 
+0.453125 0.46875 0.515625 
+0.453125 0.484375 0.5 
+0.453125 0.484375 0.515625 
+0.453125 0.5 0.515625 
+0.46875 0.5 0.515625 
+0.46875 0.484375 0.5 
+0.46875 0.484375 0.515625 
+0.46875 0.484375 0.53125 
+0.484375 0.5 0.515625 
+0.484375 0.5 0.53125 
+0.484375 0.5 0.546875 
+0.453125 0.46875 0.53125 
+0.453125 0.5 0.53125 
+0.453125 0.484375 0.53125 
+0.453125 0.484375 0.546875 
+0.453125 0.5 0.546875 
+0.453125 0.5 0.5625 
+0.46875 0.5 0.546875 
+0.46875 0.484375 0.546875 
+0.484375 0.5 0.5625 
+0.453125 0.46875 0.5625 
+0.453125 0.46875 0.546875 
+0.453125 0.484375 0.5625 
+0.46875 0.484375 0.5625 
+0.453125 0.46875 0.578125 
+0.453125 0.484375 0.578125 
+0.453125 0.5 0.578125 
+0.46875 0.5 0.578125 
+0.46875 0.484375 0.578125 
+0.46875 0.484375 0.59375 
+0.484375 0.5 0.578125 
+0.484375 0.5 0.59375 
+0.515625 0.40625 0.515625 
+0.53125 0.40625 0.515625 
+0.515625 0.421875 0.515625 
+0.515625 0.4375 0.515625 
+0.53125 0.4375 0.515625 
+0.53125 0.421875 0.515625 
+0.53125 0.421875 0.53125 
+0.546875 0.421875 0.515625 
+0.546875 0.4375 0.515625 
+0.5625 0.4375 0.515625 
+0.546875 0.4375 0.53125 
+0.546875 0.421875 0.53125 
+0.546875 0.421875 0.546875 
+0.546875 0.4375 0.546875 
+0.5625 0.4375 0.546875 
+0.515625 0.453125 0.515625 
+0.515625 0.46875 0.515625 
+0.53125 0.46875 0.515625 
+0.515625 0.484375 0.515625 
+0.515625 0.5 0.515625 
+0.53125 0.5 0.515625 
+0.53125 0.484375 0.515625 
+0.53125 0.484375 0.53125 
+0.546875 0.484375 0.515625 
+0.546875 0.5 0.515625 
+0.5625 0.5 0.515625 
+0.546875 0.5 0.53125 
+0.546875 0.484375 0.53125 
+0.546875 0.484375 0.546875 
+0.546875 0.5 0.546875 
+0.5625 0.5 0.546875 
+0.53125 0.453125 0.515625 
+0.546875 0.453125 0.515625 
+0.5625 0.453125 0.515625 
+0.5625 0.46875 0.515625 
+0.546875 0.46875 0.515625 
+0.546875 0.46875 0.53125 
+0.5625 0.484375 0.515625 
+0.5625 0.484375 0.53125 
+0.5625 0.484375 0.546875 
+0.53125 0.453125 0.53125 
+0.5625 0.453125 0.53125 
+0.546875 0.453125 0.53125 
+0.546875 0.453125 0.546875 
+0.5625 0.453125 0.546875 
+0.5625 0.453125 0.5625 
+0.5625 0.46875 0.546875 
+0.546875 0.46875 0.546875 
+0.5625 0.484375 0.5625 
+0.578125 0.453125 0.515625 
+0.578125 0.46875 0.515625 
+0.59375 0.46875 0.515625 
+0.578125 0.484375 0.515625 
+0.578125 0.5 0.515625 
+0.59375 0.5 0.515625 
+0.59375 0.484375 0.515625 
+0.59375 0.484375 0.53125 
+0.578125 0.46875 0.53125 
+0.578125 0.5 0.53125 
+0.578125 0.484375 0.53125 
+0.578125 0.484375 0.546875 
+0.578125 0.5 0.546875 
+0.578125 0.5 0.5625 
+0.59375 0.5 0.546875 
+0.59375 0.484375 0.546875 
+0.578125 0.453125 0.53125 
+0.578125 0.453125 0.546875 
+0.578125 0.46875 0.5625 
+0.578125 0.46875 0.546875 
+0.59375 0.46875 0.546875 
+0.578125 0.484375 0.5625 
+0.59375 0.484375 0.5625 
+0.515625 0.40625 0.53125 
+0.515625 0.4375 0.53125 
+0.515625 0.421875 0.53125 
+0.515625 0.421875 0.546875 
+0.515625 0.4375 0.546875 
+0.515625 0.4375 0.5625 
+0.53125 0.4375 0.546875 
+0.53125 0.421875 0.546875 
+0.546875 0.4375 0.5625 
+0.515625 0.46875 0.53125 
+0.515625 0.5 0.53125 
+0.515625 0.484375 0.53125 
+0.515625 0.484375 0.546875 
+0.515625 0.5 0.546875 
+0.515625 0.5 0.5625 
+0.53125 0.5 0.546875 
+0.53125 0.484375 0.546875 
+0.546875 0.5 0.5625 
+0.515625 0.453125 0.53125 
+0.515625 0.453125 0.546875 
+0.515625 0.453125 0.5625 
+0.515625 0.46875 0.5625 
+0.515625 0.46875 0.546875 
+0.53125 0.46875 0.546875 
+0.515625 0.484375 0.5625 
+0.53125 0.484375 0.5625 
+0.546875 0.484375 0.5625 
+0.53125 0.453125 0.5625 
+0.53125 0.453125 0.546875 
+0.546875 0.453125 0.5625 
+0.546875 0.46875 0.5625 
+0.515625 0.453125 0.578125 
+0.515625 0.46875 0.578125 
+0.515625 0.46875 0.59375 
+0.515625 0.484375 0.578125 
+0.515625 0.5 0.578125 
+0.515625 0.5 0.59375 
+0.515625 0.484375 0.59375 
+0.53125 0.484375 0.59375 
+0.53125 0.46875 0.578125 
+0.53125 0.5 0.578125 
+0.53125 0.484375 0.578125 
+0.546875 0.484375 0.578125 
+0.546875 0.5 0.578125 
+0.5625 0.5 0.578125 
+0.546875 0.5 0.59375 
+0.546875 0.484375 0.59375 
+0.53125 0.453125 0.578125 
+0.546875 0.453125 0.578125 
+0.5625 0.46875 0.578125 
+0.546875 0.46875 0.578125 
+0.546875 0.46875 0.59375 
+0.5625 0.484375 0.578125 
+0.5625 0.484375 0.59375 
+0.40625 0.515625 0.515625 
+0.40625 0.53125 0.515625 
+0.421875 0.515625 0.515625 
+0.4375 0.515625 0.515625 
+0.4375 0.53125 0.515625 
+0.421875 0.53125 0.515625 
+0.421875 0.53125 0.53125 
+0.421875 0.546875 0.515625 
+0.4375 0.546875 0.515625 
+0.4375 0.5625 0.515625 
+0.4375 0.546875 0.53125 
+0.421875 0.546875 0.53125 
+0.421875 0.546875 0.546875 
+0.4375 0.546875 0.546875 
+0.4375 0.5625 0.546875 
+0.453125 0.515625 0.515625 
+0.46875 0.515625 0.515625 
+0.46875 0.53125 0.515625 
+0.484375 0.515625 0.515625 
+0.5 0.515625 0.515625 
+0.5 0.53125 0.515625 
+0.484375 0.53125 0.515625 
+0.484375 0.53125 0.53125 
+0.484375 0.546875 0.515625 
+0.5 0.546875 0.515625 
+0.5 0.5625 0.515625 
+0.5 0.546875 0.53125 
+0.484375 0.546875 0.53125 
+0.484375 0.546875 0.546875 
+0.5 0.546875 0.546875 
+0.5 0.5625 0.546875 
+0.453125 0.53125 0.515625 
+0.453125 0.546875 0.515625 
+0.453125 0.5625 0.515625 
+0.46875 0.5625 0.515625 
+0.46875 0.546875 0.515625 
+0.46875 0.546875 0.53125 
+0.484375 0.5625 0.515625 
+0.484375 0.5625 0.53125 
+0.484375 0.5625 0.546875 
+0.453125 0.53125 0.53125 
+0.453125 0.5625 0.53125 
+0.453125 0.546875 0.53125 
+0.453125 0.546875 0.546875 
+0.453125 0.5625 0.546875 
+0.453125 0.5625 0.5625 
+0.46875 0.5625 0.546875 
+0.46875 0.546875 0.546875 
+0.484375 0.5625 0.5625 
+0.453125 0.578125 0.515625 
+0.46875 0.578125 0.515625 
+0.46875 0.59375 0.515625 
+0.484375 0.578125 0.515625 
+0.5 0.578125 0.515625 
+0.5 0.59375 0.515625 
+0.484375 0.59375 0.515625 
+0.484375 0.59375 0.53125 
+0.46875 0.578125 0.53125 
+0.5 0.578125 0.53125 
+0.484375 0.578125 0.53125 
+0.484375 0.578125 0.546875 
+0.5 0.578125 0.546875 
+0.5 0.578125 0.5625 
+0.5 0.59375 0.546875 
+0.484375 0.59375 0.546875 
+0.453125 0.578125 0.53125 
+0.453125 0.578125 0.546875 
+0.46875 0.578125 0.5625 
+0.46875 0.578125 0.546875 
+0.46875 0.59375 0.546875 
+0.484375 0.578125 0.5625 
+0.484375 0.59375 0.5625 
+0.40625 0.515625 0.53125 
+0.4375 0.515625 0.53125 
+0.421875 0.515625 0.53125 
+0.421875 0.515625 0.546875 
+0.4375 0.515625 0.546875 
+0.4375 0.515625 0.5625 
+0.4375 0.53125 0.546875 
+0.421875 0.53125 0.546875 
+0.4375 0.546875 0.5625 
+0.46875 0.515625 0.53125 
+0.5 0.515625 0.53125 
+0.484375 0.515625 0.53125 
+0.484375 0.515625 0.546875 
+0.5 0.515625 0.546875 
+0.5 0.515625 0.5625 
+0.5 0.53125 0.546875 
+0.484375 0.53125 0.546875 
+0.5 0.546875 0.5625 
+0.453125 0.515625 0.53125 
+0.453125 0.515625 0.546875 
+0.453125 0.515625 0.5625 
+0.46875 0.515625 0.5625 
+0.46875 0.515625 0.546875 
+0.46875 0.53125 0.546875 
+0.484375 0.515625 0.5625 
+0.484375 0.53125 0.5625 
+0.484375 0.546875 0.5625 
+0.453125 0.53125 0.5625 
+0.453125 0.53125 0.546875 
+0.453125 0.546875 0.5625 
+0.46875 0.546875 0.5625 
+0.453125 0.515625 0.578125 
+0.46875 0.515625 0.578125 
+0.46875 0.515625 0.59375 
+0.484375 0.515625 0.578125 
+0.5 0.515625 0.578125 
+0.5 0.515625 0.59375 
+0.484375 0.515625 0.59375 
+0.484375 0.53125 0.59375 
+0.46875 0.53125 0.578125 
+0.5 0.53125 0.578125 
+0.484375 0.53125 0.578125 
+0.484375 0.546875 0.578125 
+0.5 0.546875 0.578125 
+0.5 0.5625 0.578125 
+0.5 0.546875 0.59375 
+0.484375 0.546875 0.59375 
+0.453125 0.53125 0.578125 
+0.453125 0.546875 0.578125 
+0.46875 0.5625 0.578125 
+0.46875 0.546875 0.578125 
+0.46875 0.546875 0.59375 
+0.484375 0.5625 0.578125 
+0.484375 0.5625 0.59375 
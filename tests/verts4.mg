@@ -0,0 +1,9629 @@
+0 0 0 
+0.5 0 0 
+1 0 0 
+0 0.5 0 
+0.5 0.5 0 
+1 0.5 0 
+0 1 0 
+0.5 1 0 
+1 1 0 
+0 0 0.5 
+0.5 0 0.5 
+1 0 0.5 
+0 0.5 0.5 
+0.5 0.5 0.5 
+1 0.5 0.5 
+0 1 0.5 
+0.5 1 0.5 
+1 1 0.5 
+0 0 1 
+0.5 0 1 
+1 0 1 
+0 0.5 1 
+0.5 0.5 1 
+1 0.5 1 
+0 1 1 
+0.5 1 1 
+1 1 1 
+0.25 0 0 
+0.25 0.25 0 
+0.5 0.25 0 
+0.25 0.25 0.25 
+0.5 0.25 0.25 
+0.5 0.5 0.25 
+0.25 0 0.25 
+0.5 0 0.25 
+0.5 0.25 0.5 
+0 0.25 0 
+0.25 0.5 0 
+0.25 0.5 0.25 
+0 0.25 0.25 
+0 0.5 0.25 
+0.25 0.5 0.5 
+0 0 0.25 
+0.25 0 0.5 
+0.25 0.25 0.5 
+0 0.25 0.5 
+0.75 0 0 
+0.75 0.25 0 
+1 0.25 0 
+0.75 0.25 0.25 
+1 0.25 0.25 
+1 0.5 0.25 
+0.75 0 0.25 
+1 0 0.25 
+1 0.25 0.5 
+0.75 0.5 0 
+0.75 0.5 0.25 
+0.75 0.5 0.5 
+0.75 0 0.5 
+0.75 0.25 0.5 
+0.25 0.75 0 
+0.5 0.75 0 
+0.25 0.75 0.25 
+0.5 0.75 0.25 
+0.5 1 0.25 
+0.5 0.75 0.5 
+0 0.75 0 
+0.25 1 0 
+0.25 1 0.25 
+0 0.75 0.25 
+0 1 0.25 
+0.25 1 0.5 
+0.25 0.75 0.5 
+0 0.75 0.5 
+0.75 0.75 0 
+1 0.75 0 
+0.75 0.75 0.25 
+1 0.75 0.25 
+1 1 0.25 
+1 0.75 0.5 
+0.75 1 0 
+0.75 1 0.25 
+0.75 1 0.5 
+0.75 0.75 0.5 
+0.25 0.25 0.75 
+0.5 0.25 0.75 
+0.5 0.5 0.75 
+0.25 0 0.75 
+0.5 0 0.75 
+0.5 0.25 1 
+0.25 0.5 0.75 
+0 0.25 0.75 
+0 0.5 0.75 
+0.25 0.5 1 
+0 0 0.75 
+0.25 0 1 
+0.25 0.25 1 
+0 0.25 1 
+0.75 0.25 0.75 
+1 0.25 0.75 
+1 0.5 0.75 
+0.75 0 0.75 
+1 0 0.75 
+1 0.25 1 
+0.75 0.5 0.75 
+0.75 0.5 1 
+0.75 0 1 
+0.75 0.25 1 
+0.25 0.75 0.75 
+0.5 0.75 0.75 
+0.5 1 0.75 
+0.5 0.75 1 
+0.25 1 0.75 
+0 0.75 0.75 
+0 1 0.75 
+0.25 1 1 
+0.25 0.75 1 
+0 0.75 1 
+0.75 0.75 0.75 
+1 0.75 0.75 
+1 1 0.75 
+1 0.75 1 
+0.75 1 0.75 
+0.75 1 1 
+0.75 0.75 1 
+0.125 0 0 
+0.125 0.125 0 
+0.25 0.125 0 
+0.125 0.125 0.125 
+0.25 0.125 0.125 
+0.25 0.25 0.125 
+0.375 0 0 
+0.375 0.125 0 
+0.5 0.125 0 
+0.375 0.125 0.125 
+0.5 0.125 0.125 
+0.5 0.25 0.125 
+0.375 0.25 0 
+0.375 0.25 0.125 
+0.375 0.25 0.25 
+0.375 0.375 0 
+0.5 0.375 0 
+0.375 0.375 0.125 
+0.5 0.375 0.125 
+0.5 0.5 0.125 
+0.5 0.375 0.25 
+0.375 0.375 0.25 
+0.375 0.375 0.375 
+0.5 0.375 0.375 
+0.5 0.5 0.375 
+0.125 0 0.125 
+0.25 0 0.125 
+0.25 0.125 0.25 
+0.375 0 0.125 
+0.5 0 0.125 
+0.5 0.125 0.25 
+0.375 0 0.25 
+0.375 0.125 0.25 
+0.375 0 0.375 
+0.5 0 0.375 
+0.375 0.125 0.375 
+0.5 0.125 0.375 
+0.5 0.125 0.5 
+0.5 0.25 0.375 
+0.375 0.25 0.375 
+0.5 0.375 0.5 
+0 0.125 0 
+0.125 0.25 0 
+0.125 0.25 0.125 
+0 0.375 0 
+0.125 0.375 0 
+0.125 0.5 0 
+0.125 0.375 0.125 
+0.125 0.5 0.125 
+0.25 0.5 0.125 
+0.25 0.375 0 
+0.25 0.375 0.125 
+0.25 0.375 0.25 
+0.375 0.5 0 
+0.375 0.5 0.125 
+0.375 0.5 0.25 
+0.375 0.5 0.375 
+0 0.125 0.125 
+0 0.25 0.125 
+0.125 0.25 0.25 
+0 0.375 0.125 
+0 0.5 0.125 
+0.125 0.5 0.25 
+0 0.375 0.25 
+0.125 0.375 0.25 
+0 0.375 0.375 
+0 0.5 0.375 
+0.125 0.375 0.375 
+0.125 0.5 0.375 
+0.125 0.5 0.5 
+0.25 0.5 0.375 
+0.25 0.375 0.375 
+0.375 0.5 0.5 
+0 0 0.125 
+0.125 0 0.25 
+0.125 0.125 0.25 
+0 0 0.375 
+0.125 0 0.375 
+0.125 0 0.5 
+0.125 0.125 0.375 
+0.125 0.125 0.5 
+0.25 0.125 0.5 
+0.25 0 0.375 
+0.25 0.125 0.375 
+0.25 0.25 0.375 
+0.375 0 0.5 
+0.375 0.125 0.5 
+0.375 0.25 0.5 
+0.375 0.375 0.5 
+0 0.125 0.25 
+0 0.125 0.375 
+0 0.125 0.5 
+0.125 0.25 0.5 
+0 0.25 0.375 
+0.125 0.25 0.375 
+0 0.375 0.5 
+0.125 0.375 0.5 
+0.25 0.375 0.5 
+0.625 0 0 
+0.625 0.125 0 
+0.75 0.125 0 
+0.625 0.125 0.125 
+0.75 0.125 0.125 
+0.75 0.25 0.125 
+0.875 0 0 
+0.875 0.125 0 
+1 0.125 0 
+0.875 0.125 0.125 
+1 0.125 0.125 
+1 0.25 0.125 
+0.875 0.25 0 
+0.875 0.25 0.125 
+0.875 0.25 0.25 
+0.875 0.375 0 
+1 0.375 0 
+0.875 0.375 0.125 
+1 0.375 0.125 
+1 0.5 0.125 
+1 0.375 0.25 
+0.875 0.375 0.25 
+0.875 0.375 0.375 
+1 0.375 0.375 
+1 0.5 0.375 
+0.625 0 0.125 
+0.75 0 0.125 
+0.75 0.125 0.25 
+0.875 0 0.125 
+1 0 0.125 
+1 0.125 0.25 
+0.875 0 0.25 
+0.875 0.125 0.25 
+0.875 0 0.375 
+1 0 0.375 
+0.875 0.125 0.375 
+1 0.125 0.375 
+1 0.125 0.5 
+1 0.25 0.375 
+0.875 0.25 0.375 
+1 0.375 0.5 
+0.625 0.25 0 
+0.625 0.25 0.125 
+0.625 0.375 0 
+0.625 0.5 0 
+0.625 0.375 0.125 
+0.625 0.5 0.125 
+0.75 0.5 0.125 
+0.75 0.375 0 
+0.75 0.375 0.125 
+0.75 0.375 0.25 
+0.875 0.5 0 
+0.875 0.5 0.125 
+0.875 0.5 0.25 
+0.875 0.5 0.375 
+0.625 0.25 0.25 
+0.625 0.5 0.25 
+0.625 0.375 0.25 
+0.625 0.375 0.375 
+0.625 0.5 0.375 
+0.625 0.5 0.5 
+0.75 0.5 0.375 
+0.75 0.375 0.375 
+0.875 0.5 0.5 
+0.625 0 0.25 
+0.625 0.125 0.25 
+0.625 0 0.375 
+0.625 0 0.5 
+0.625 0.125 0.375 
+0.625 0.125 0.5 
+0.75 0.125 0.5 
+0.75 0 0.375 
+0.75 0.125 0.375 
+0.75 0.25 0.375 
+0.875 0 0.5 
+0.875 0.125 0.5 
+0.875 0.25 0.5 
+0.875 0.375 0.5 
+0.625 0.25 0.5 
+0.625 0.25 0.375 
+0.625 0.375 0.5 
+0.75 0.375 0.5 
+0.125 0.625 0 
+0.25 0.625 0 
+0.125 0.625 0.125 
+0.25 0.625 0.125 
+0.25 0.75 0.125 
+0.375 0.625 0 
+0.5 0.625 0 
+0.375 0.625 0.125 
+0.5 0.625 0.125 
+0.5 0.75 0.125 
+0.375 0.75 0 
+0.375 0.75 0.125 
+0.375 0.75 0.25 
+0.375 0.875 0 
+0.5 0.875 0 
+0.375 0.875 0.125 
+0.5 0.875 0.125 
+0.5 1 0.125 
+0.5 0.875 0.25 
+0.375 0.875 0.25 
+0.375 0.875 0.375 
+0.5 0.875 0.375 
+0.5 1 0.375 
+0.25 0.625 0.25 
+0.5 0.625 0.25 
+0.375 0.625 0.25 
+0.375 0.625 0.375 
+0.5 0.625 0.375 
+0.5 0.625 0.5 
+0.5 0.75 0.375 
+0.375 0.75 0.375 
+0.5 0.875 0.5 
+0 0.625 0 
+0.125 0.75 0 
+0.125 0.75 0.125 
+0 0.875 0 
+0.125 0.875 0 
+0.125 1 0 
+0.125 0.875 0.125 
+0.125 1 0.125 
+0.25 1 0.125 
+0.25 0.875 0 
+0.25 0.875 0.125 
+0.25 0.875 0.25 
+0.375 1 0 
+0.375 1 0.125 
+0.375 1 0.25 
+0.375 1 0.375 
+0 0.625 0.125 
+0 0.75 0.125 
+0.125 0.75 0.25 
+0 0.875 0.125 
+0 1 0.125 
+0.125 1 0.25 
+0 0.875 0.25 
+0.125 0.875 0.25 
+0 0.875 0.375 
+0 1 0.375 
+0.125 0.875 0.375 
+0.125 1 0.375 
+0.125 1 0.5 
+0.25 1 0.375 
+0.25 0.875 0.375 
+0.375 1 0.5 
+0.125 0.625 0.25 
+0.125 0.625 0.375 
+0.125 0.625 0.5 
+0.25 0.625 0.5 
+0.25 0.625 0.375 
+0.25 0.75 0.375 
+0.375 0.625 0.5 
+0.375 0.75 0.5 
+0.375 0.875 0.5 
+0 0.625 0.25 
+0 0.625 0.375 
+0 0.625 0.5 
+0.125 0.75 0.5 
+0 0.75 0.375 
+0.125 0.75 0.375 
+0 0.875 0.5 
+0.125 0.875 0.5 
+0.25 0.875 0.5 
+0.625 0.625 0 
+0.75 0.625 0 
+0.625 0.625 0.125 
+0.75 0.625 0.125 
+0.75 0.75 0.125 
+0.875 0.625 0 
+1 0.625 0 
+0.875 0.625 0.125 
+1 0.625 0.125 
+1 0.75 0.125 
+0.875 0.75 0 
+0.875 0.75 0.125 
+0.875 0.75 0.25 
+0.875 0.875 0 
+1 0.875 0 
+0.875 0.875 0.125 
+1 0.875 0.125 
+1 1 0.125 
+1 0.875 0.25 
+0.875 0.875 0.25 
+0.875 0.875 0.375 
+1 0.875 0.375 
+1 1 0.375 
+0.75 0.625 0.25 
+1 0.625 0.25 
+0.875 0.625 0.25 
+0.875 0.625 0.375 
+1 0.625 0.375 
+1 0.625 0.5 
+1 0.75 0.375 
+0.875 0.75 0.375 
+1 0.875 0.5 
+0.625 0.75 0 
+0.625 0.75 0.125 
+0.625 0.875 0 
+0.625 1 0 
+0.625 0.875 0.125 
+0.625 1 0.125 
+0.75 1 0.125 
+0.75 0.875 0 
+0.75 0.875 0.125 
+0.75 0.875 0.25 
+0.875 1 0 
+0.875 1 0.125 
+0.875 1 0.25 
+0.875 1 0.375 
+0.625 0.75 0.25 
+0.625 1 0.25 
+0.625 0.875 0.25 
+0.625 0.875 0.375 
+0.625 1 0.375 
+0.625 1 0.5 
+0.75 1 0.375 
+0.75 0.875 0.375 
+0.875 1 0.5 
+0.625 0.625 0.25 
+0.625 0.625 0.375 
+0.625 0.625 0.5 
+0.75 0.625 0.5 
+0.75 0.625 0.375 
+0.75 0.75 0.375 
+0.875 0.625 0.5 
+0.875 0.75 0.5 
+0.875 0.875 0.5 
+0.625 0.75 0.5 
+0.625 0.75 0.375 
+0.625 0.875 0.5 
+0.75 0.875 0.5 
+0.125 0.125 0.625 
+0.25 0.125 0.625 
+0.25 0.25 0.625 
+0.375 0.125 0.625 
+0.5 0.125 0.625 
+0.5 0.25 0.625 
+0.375 0.25 0.625 
+0.375 0.25 0.75 
+0.375 0.375 0.625 
+0.5 0.375 0.625 
+0.5 0.5 0.625 
+0.5 0.375 0.75 
+0.375 0.375 0.75 
+0.375 0.375 0.875 
+0.5 0.375 0.875 
+0.5 0.5 0.875 
+0.125 0 0.625 
+0.25 0 0.625 
+0.25 0.125 0.75 
+0.375 0 0.625 
+0.5 0 0.625 
+0.5 0.125 0.75 
+0.375 0 0.75 
+0.375 0.125 0.75 
+0.375 0 0.875 
+0.5 0 0.875 
+0.375 0.125 0.875 
+0.5 0.125 0.875 
+0.5 0.125 1 
+0.5 0.25 0.875 
+0.375 0.25 0.875 
+0.5 0.375 1 
+0.125 0.25 0.625 
+0.125 0.375 0.625 
+0.125 0.5 0.625 
+0.25 0.5 0.625 
+0.25 0.375 0.625 
+0.25 0.375 0.75 
+0.375 0.5 0.625 
+0.375 0.5 0.75 
+0.375 0.5 0.875 
+0 0.125 0.625 
+0 0.25 0.625 
+0.125 0.25 0.75 
+0 0.375 0.625 
+0 0.5 0.625 
+0.125 0.5 0.75 
+0 0.375 0.75 
+0.125 0.375 0.75 
+0 0.375 0.875 
+0 0.5 0.875 
+0.125 0.375 0.875 
+0.125 0.5 0.875 
+0.125 0.5 1 
+0.25 0.5 0.875 
+0.25 0.375 0.875 
+0.375 0.5 1 
+0 0 0.625 
+0.125 0 0.75 
+0.125 0.125 0.75 
+0 0 0.875 
+0.125 0 0.875 
+0.125 0 1 
+0.125 0.125 0.875 
+0.125 0.125 1 
+0.25 0.125 1 
+0.25 0 0.875 
+0.25 0.125 0.875 
+0.25 0.25 0.875 
+0.375 0 1 
+0.375 0.125 1 
+0.375 0.25 1 
+0.375 0.375 1 
+0 0.125 0.75 
+0 0.125 0.875 
+0 0.125 1 
+0.125 0.25 1 
+0 0.25 0.875 
+0.125 0.25 0.875 
+0 0.375 1 
+0.125 0.375 1 
+0.25 0.375 1 
+0.625 0.125 0.625 
+0.75 0.125 0.625 
+0.75 0.25 0.625 
+0.875 0.125 0.625 
+1 0.125 0.625 
+1 0.25 0.625 
+0.875 0.25 0.625 
+0.875 0.25 0.75 
+0.875 0.375 0.625 
+1 0.375 0.625 
+1 0.5 0.625 
+1 0.375 0.75 
+0.875 0.375 0.75 
+0.875 0.375 0.875 
+1 0.375 0.875 
+1 0.5 0.875 
+0.625 0 0.625 
+0.75 0 0.625 
+0.75 0.125 0.75 
+0.875 0 0.625 
+1 0 0.625 
+1 0.125 0.75 
+0.875 0 0.75 
+0.875 0.125 0.75 
+0.875 0 0.875 
+1 0 0.875 
+0.875 0.125 0.875 
+1 0.125 0.875 
+1 0.125 1 
+1 0.25 0.875 
+0.875 0.25 0.875 
+1 0.375 1 
+0.625 0.25 0.625 
+0.625 0.375 0.625 
+0.625 0.5 0.625 
+0.75 0.5 0.625 
+0.75 0.375 0.625 
+0.75 0.375 0.75 
+0.875 0.5 0.625 
+0.875 0.5 0.75 
+0.875 0.5 0.875 
+0.625 0.25 0.75 
+0.625 0.5 0.75 
+0.625 0.375 0.75 
+0.625 0.375 0.875 
+0.625 0.5 0.875 
+0.625 0.5 1 
+0.75 0.5 0.875 
+0.75 0.375 0.875 
+0.875 0.5 1 
+0.625 0 0.75 
+0.625 0.125 0.75 
+0.625 0 0.875 
+0.625 0 1 
+0.625 0.125 0.875 
+0.625 0.125 1 
+0.75 0.125 1 
+0.75 0 0.875 
+0.75 0.125 0.875 
+0.75 0.25 0.875 
+0.875 0 1 
+0.875 0.125 1 
+0.875 0.25 1 
+0.875 0.375 1 
+0.625 0.25 1 
+0.625 0.25 0.875 
+0.625 0.375 1 
+0.75 0.375 1 
+0.125 0.625 0.625 
+0.25 0.625 0.625 
+0.25 0.75 0.625 
+0.375 0.625 0.625 
+0.5 0.625 0.625 
+0.5 0.75 0.625 
+0.375 0.75 0.625 
+0.375 0.75 0.75 
+0.375 0.875 0.625 
+0.5 0.875 0.625 
+0.5 1 0.625 
+0.5 0.875 0.75 
+0.375 0.875 0.75 
+0.375 0.875 0.875 
+0.5 0.875 0.875 
+0.5 1 0.875 
+0.25 0.625 0.75 
+0.5 0.625 0.75 
+0.375 0.625 0.75 
+0.375 0.625 0.875 
+0.5 0.625 0.875 
+0.5 0.625 1 
+0.5 0.75 0.875 
+0.375 0.75 0.875 
+0.5 0.875 1 
+0.125 0.75 0.625 
+0.125 0.875 0.625 
+0.125 1 0.625 
+0.25 1 0.625 
+0.25 0.875 0.625 
+0.25 0.875 0.75 
+0.375 1 0.625 
+0.375 1 0.75 
+0.375 1 0.875 
+0 0.625 0.625 
+0 0.75 0.625 
+0.125 0.75 0.75 
+0 0.875 0.625 
+0 1 0.625 
+0.125 1 0.75 
+0 0.875 0.75 
+0.125 0.875 0.75 
+0 0.875 0.875 
+0 1 0.875 
+0.125 0.875 0.875 
+0.125 1 0.875 
+0.125 1 1 
+0.25 1 0.875 
+0.25 0.875 0.875 
+0.375 1 1 
+0.125 0.625 0.75 
+0.125 0.625 0.875 
+0.125 0.625 1 
+0.25 0.625 1 
+0.25 0.625 0.875 
+0.25 0.75 0.875 
+0.375 0.625 1 
+0.375 0.75 1 
+0.375 0.875 1 
+0 0.625 0.75 
+0 0.625 0.875 
+0 0.625 1 
+0.125 0.75 1 
+0 0.75 0.875 
+0.125 0.75 0.875 
+0 0.875 1 
+0.125 0.875 1 
+0.25 0.875 1 
+0.625 0.625 0.625 
+0.75 0.625 0.625 
+0.75 0.75 0.625 
+0.875 0.625 0.625 
+1 0.625 0.625 
+1 0.75 0.625 
+0.875 0.75 0.625 
+0.875 0.75 0.75 
+0.875 0.875 0.625 
+1 0.875 0.625 
+1 1 0.625 
+1 0.875 0.75 
+0.875 0.875 0.75 
+0.875 0.875 0.875 
+1 0.875 0.875 
+1 1 0.875 
+0.75 0.625 0.75 
+1 0.625 0.75 
+0.875 0.625 0.75 
+0.875 0.625 0.875 
+1 0.625 0.875 
+1 0.625 1 
+1 0.75 0.875 
+0.875 0.75 0.875 
+1 0.875 1 
+0.625 0.75 0.625 
+0.625 0.875 0.625 
+0.625 1 0.625 
+0.75 1 0.625 
+0.75 0.875 0.625 
+0.75 0.875 0.75 
+0.875 1 0.625 
+0.875 1 0.75 
+0.875 1 0.875 
+0.625 0.75 0.75 
+0.625 1 0.75 
+0.625 0.875 0.75 
+0.625 0.875 0.875 
+0.625 1 0.875 
+0.625 1 1 
+0.75 1 0.875 
+0.75 0.875 0.875 
+0.875 1 1 
+0.625 0.625 0.75 
+0.625 0.625 0.875 
+0.625 0.625 1 
+0.75 0.625 1 
+0.75 0.625 0.875 
+0.75 0.75 0.875 
+0.875 0.625 1 
+0.875 0.75 1 
+0.875 0.875 1 
+0.625 0.75 1 
+0.625 0.75 0.875 
+0.625 0.875 1 
+0.75 0.875 1 
+0.5 0.4375 0.375 
+0.5 0.4375 0.4375 
+0.5 0.5 0.4375 
+0.5 0.375 0.4375 
+0.5 0.4375 0.5 
+0.4375 0.5 0.375 
+0.4375 0.5 0.4375 
+0.375 0.5 0.4375 
+0.4375 0.5 0.5 
+0.4375 0.375 0.5 
+0.4375 0.4375 0.5 
+0.375 0.4375 0.5 
+0.5625 0.4375 0.4375 
+0.5625 0.5 0.4375 
+0.5625 0.5 0.5 
+0.5625 0.4375 0.5 
+0.4375 0.5625 0.4375 
+0.5 0.5625 0.4375 
+0.5 0.5625 0.5 
+0.4375 0.5625 0.5 
+0.5625 0.5625 0.4375 
+0.5625 0.5625 0.5 
+0.625 0.5625 0.5 
+0.5625 0.625 0.5 
+0.4375 0.4375 0.5625 
+0.5 0.4375 0.5625 
+0.5 0.5 0.5625 
+0.4375 0.5 0.5625 
+0.5625 0.4375 0.5625 
+0.5625 0.5 0.5625 
+0.625 0.5 0.5625 
+0.5625 0.5 0.625 
+0.4375 0.5625 0.5625 
+0.5 0.5625 0.5625 
+0.5 0.625 0.5625 
+0.5 0.5625 0.625 
+0.4375 0.375 0.25 
+0.375 0.375 0.3125 
+0.5 0.375 0.3125 
+0.4375 0.375 0.3125 
+0.4375 0.375 0.375 
+0.4375 0.4375 0.3125 
+0.5 0.4375 0.3125 
+0.4375 0.4375 0.375 
+0.4375 0.4375 0.4375 
+0.4375 0.25 0.375 
+0.375 0.3125 0.375 
+0.5 0.3125 0.375 
+0.4375 0.3125 0.375 
+0.4375 0.3125 0.4375 
+0.5 0.3125 0.4375 
+0.4375 0.375 0.4375 
+0.375 0.4375 0.25 
+0.375 0.5 0.3125 
+0.375 0.4375 0.3125 
+0.375 0.4375 0.375 
+0.4375 0.5 0.3125 
+0.25 0.4375 0.375 
+0.3125 0.375 0.375 
+0.3125 0.5 0.375 
+0.3125 0.4375 0.375 
+0.3125 0.4375 0.4375 
+0.3125 0.5 0.4375 
+0.375 0.4375 0.4375 
+0.375 0.25 0.4375 
+0.375 0.3125 0.5 
+0.375 0.3125 0.4375 
+0.375 0.375 0.4375 
+0.4375 0.3125 0.5 
+0.25 0.375 0.4375 
+0.3125 0.375 0.5 
+0.3125 0.375 0.4375 
+0.3125 0.4375 0.5 
+0.5625 0.375 0.375 
+0.5625 0.4375 0.3125 
+0.5625 0.5 0.375 
+0.5625 0.4375 0.375 
+0.625 0.4375 0.375 
+0.625 0.5 0.4375 
+0.625 0.4375 0.4375 
+0.5625 0.3125 0.4375 
+0.5625 0.375 0.5 
+0.5625 0.375 0.4375 
+0.625 0.375 0.4375 
+0.625 0.4375 0.5 
+0.375 0.5625 0.375 
+0.4375 0.5625 0.3125 
+0.5 0.5625 0.375 
+0.4375 0.5625 0.375 
+0.4375 0.625 0.375 
+0.5 0.625 0.4375 
+0.4375 0.625 0.4375 
+0.3125 0.5625 0.4375 
+0.375 0.5625 0.5 
+0.375 0.5625 0.4375 
+0.375 0.625 0.4375 
+0.4375 0.625 0.5 
+0.5625 0.5625 0.375 
+0.625 0.5625 0.375 
+0.625 0.5625 0.4375 
+0.625 0.625 0.4375 
+0.6875 0.5625 0.4375 
+0.6875 0.5625 0.5 
+0.6875 0.625 0.5 
+0.5625 0.625 0.375 
+0.5625 0.625 0.4375 
+0.5625 0.6875 0.4375 
+0.5625 0.6875 0.5 
+0.625 0.6875 0.5 
+0.375 0.375 0.5625 
+0.4375 0.3125 0.5625 
+0.5 0.375 0.5625 
+0.4375 0.375 0.5625 
+0.4375 0.375 0.625 
+0.5 0.4375 0.625 
+0.4375 0.4375 0.625 
+0.3125 0.4375 0.5625 
+0.375 0.5 0.5625 
+0.375 0.4375 0.5625 
+0.375 0.4375 0.625 
+0.4375 0.5 0.625 
+0.5625 0.375 0.5625 
+0.625 0.375 0.5625 
+0.625 0.4375 0.5625 
+0.625 0.4375 0.625 
+0.6875 0.4375 0.5625 
+0.6875 0.5 0.5625 
+0.6875 0.5 0.625 
+0.5625 0.375 0.625 
+0.5625 0.4375 0.625 
+0.5625 0.4375 0.6875 
+0.5625 0.5 0.6875 
+0.625 0.5 0.6875 
+0.375 0.5625 0.5625 
+0.375 0.625 0.5625 
+0.4375 0.625 0.5625 
+0.4375 0.625 0.625 
+0.4375 0.6875 0.5625 
+0.5 0.6875 0.5625 
+0.5 0.6875 0.625 
+0.375 0.5625 0.625 
+0.4375 0.5625 0.625 
+0.4375 0.5625 0.6875 
+0.5 0.5625 0.6875 
+0.5 0.625 0.6875 
+0.5625 0.5625 0.5625 
+0.625 0.5625 0.5625 
+0.625 0.625 0.5625 
+0.6875 0.5625 0.5625 
+0.75 0.625 0.5625 
+0.6875 0.625 0.5625 
+0.6875 0.625 0.625 
+0.625 0.5625 0.625 
+0.75 0.5625 0.625 
+0.6875 0.5625 0.625 
+0.5625 0.625 0.5625 
+0.5625 0.6875 0.5625 
+0.625 0.75 0.5625 
+0.625 0.6875 0.5625 
+0.625 0.6875 0.625 
+0.5625 0.625 0.625 
+0.5625 0.75 0.625 
+0.5625 0.6875 0.625 
+0.5625 0.5625 0.625 
+0.5625 0.5625 0.6875 
+0.625 0.5625 0.75 
+0.625 0.5625 0.6875 
+0.625 0.625 0.6875 
+0.5625 0.625 0.75 
+0.5625 0.625 0.6875 
+0.5 0.4375 0.25 
+0.375 0.3125 0.25 
+0.375 0.3125 0.3125 
+0.4375 0.3125 0.3125 
+0.5 0.5 0.3125 
+0.5 0.25 0.4375 
+0.375 0.25 0.3125 
+0.5 0.3125 0.5 
+0.4375 0.5 0.25 
+0.3125 0.375 0.25 
+0.3125 0.375 0.3125 
+0.3125 0.4375 0.3125 
+0.25 0.5 0.4375 
+0.25 0.375 0.3125 
+0.3125 0.5 0.5 
+0.4375 0.25 0.5 
+0.3125 0.25 0.375 
+0.3125 0.3125 0.375 
+0.3125 0.3125 0.4375 
+0.25 0.4375 0.5 
+0.25 0.3125 0.375 
+0.5625 0.5 0.3125 
+0.6875 0.4375 0.4375 
+0.6875 0.5 0.4375 
+0.6875 0.5 0.5 
+0.5625 0.3125 0.5 
+0.6875 0.4375 0.5 
+0.5 0.5625 0.3125 
+0.4375 0.6875 0.4375 
+0.5 0.6875 0.4375 
+0.5 0.6875 0.5 
+0.3125 0.5625 0.5 
+0.4375 0.6875 0.5 
+0.5625 0.5625 0.3125 
+0.75 0.5625 0.5 
+0.5625 0.75 0.5 
+0.5 0.3125 0.5625 
+0.4375 0.4375 0.6875 
+0.5 0.4375 0.6875 
+0.5 0.5 0.6875 
+0.3125 0.5 0.5625 
+0.4375 0.5 0.6875 
+0.5625 0.3125 0.5625 
+0.75 0.5 0.5625 
+0.5625 0.5 0.75 
+0.3125 0.5625 0.5625 
+0.5 0.75 0.5625 
+0.5 0.5625 0.75 
+0.6875 0.6875 0.5625 
+0.75 0.6875 0.625 
+0.6875 0.6875 0.625 
+0.6875 0.5625 0.6875 
+0.75 0.625 0.6875 
+0.6875 0.625 0.6875 
+0.6875 0.75 0.625 
+0.5625 0.6875 0.6875 
+0.625 0.75 0.6875 
+0.625 0.6875 0.6875 
+0.6875 0.625 0.75 
+0.625 0.6875 0.75 
+0.4375 0.25 0.25 
+0.5 0.3125 0.25 
+0.4375 0.3125 0.25 
+0.4375 0.4375 0.25 
+0.5 0.3125 0.3125 
+0.5 0.25 0.3125 
+0.4375 0.25 0.3125 
+0.4375 0.25 0.4375 
+0.25 0.4375 0.25 
+0.3125 0.5 0.25 
+0.3125 0.4375 0.25 
+0.3125 0.5 0.3125 
+0.25 0.5 0.3125 
+0.25 0.4375 0.3125 
+0.25 0.4375 0.4375 
+0.25 0.25 0.4375 
+0.3125 0.25 0.5 
+0.3125 0.25 0.4375 
+0.3125 0.3125 0.5 
+0.25 0.3125 0.5 
+0.25 0.3125 0.4375 
+0.5625 0.3125 0.3125 
+0.5625 0.375 0.3125 
+0.5625 0.3125 0.375 
+0.3125 0.5625 0.3125 
+0.375 0.5625 0.3125 
+0.3125 0.5625 0.375 
+0.6875 0.625 0.4375 
+0.6875 0.6875 0.4375 
+0.6875 0.6875 0.5 
+0.75 0.6875 0.5 
+0.625 0.6875 0.4375 
+0.6875 0.75 0.5 
+0.3125 0.3125 0.5625 
+0.375 0.3125 0.5625 
+0.3125 0.375 0.5625 
+0.6875 0.4375 0.625 
+0.6875 0.4375 0.6875 
+0.6875 0.5 0.6875 
+0.75 0.5 0.6875 
+0.625 0.4375 0.6875 
+0.6875 0.5 0.75 
+0.4375 0.6875 0.625 
+0.4375 0.6875 0.6875 
+0.5 0.6875 0.6875 
+0.5 0.75 0.6875 
+0.4375 0.625 0.6875 
+0.5 0.6875 0.75 
+0.75 0.5625 0.5625 
+0.75 0.6875 0.5625 
+0.75 0.75 0.5625 
+0.75 0.5625 0.6875 
+0.75 0.5625 0.75 
+0.5625 0.75 0.5625 
+0.6875 0.75 0.5625 
+0.5625 0.75 0.6875 
+0.5625 0.75 0.75 
+0.5625 0.5625 0.75 
+0.6875 0.5625 0.75 
+0.5625 0.6875 0.75 
+0.5 0.4375 0.40625 
+0.53125 0.4375 0.40625 
+0.53125 0.4375 0.4375 
+0.5 0.46875 0.375 
+0.5 0.46875 0.40625 
+0.5 0.5 0.40625 
+0.53125 0.46875 0.40625 
+0.53125 0.5 0.40625 
+0.53125 0.5 0.4375 
+0.5 0.46875 0.4375 
+0.53125 0.46875 0.4375 
+0.5625 0.46875 0.4375 
+0.5 0.46875 0.46875 
+0.5 0.5 0.46875 
+0.53125 0.46875 0.46875 
+0.53125 0.5 0.46875 
+0.53125 0.5 0.5 
+0.5625 0.5 0.46875 
+0.5625 0.46875 0.46875 
+0.59375 0.46875 0.46875 
+0.59375 0.5 0.46875 
+0.59375 0.5 0.5 
+0.5 0.40625 0.4375 
+0.53125 0.40625 0.4375 
+0.5 0.375 0.46875 
+0.5 0.40625 0.46875 
+0.5 0.40625 0.5 
+0.53125 0.40625 0.46875 
+0.53125 0.40625 0.5 
+0.53125 0.4375 0.5 
+0.5 0.4375 0.46875 
+0.53125 0.4375 0.46875 
+0.5625 0.4375 0.46875 
+0.5 0.46875 0.5 
+0.53125 0.46875 0.5 
+0.5625 0.46875 0.5 
+0.59375 0.46875 0.5 
+0.4375 0.5 0.40625 
+0.4375 0.53125 0.40625 
+0.4375 0.53125 0.4375 
+0.46875 0.5 0.375 
+0.46875 0.5 0.40625 
+0.46875 0.53125 0.40625 
+0.5 0.53125 0.40625 
+0.5 0.53125 0.4375 
+0.46875 0.5 0.4375 
+0.46875 0.53125 0.4375 
+0.46875 0.5625 0.4375 
+0.46875 0.5 0.46875 
+0.46875 0.53125 0.46875 
+0.5 0.53125 0.46875 
+0.5 0.53125 0.5 
+0.5 0.5625 0.46875 
+0.46875 0.5625 0.46875 
+0.46875 0.59375 0.46875 
+0.5 0.59375 0.46875 
+0.5 0.59375 0.5 
+0.40625 0.5 0.4375 
+0.40625 0.53125 0.4375 
+0.375 0.5 0.46875 
+0.40625 0.5 0.46875 
+0.40625 0.5 0.5 
+0.40625 0.53125 0.46875 
+0.40625 0.53125 0.5 
+0.4375 0.53125 0.5 
+0.4375 0.5 0.46875 
+0.4375 0.53125 0.46875 
+0.4375 0.5625 0.46875 
+0.46875 0.5 0.5 
+0.46875 0.53125 0.5 
+0.46875 0.5625 0.5 
+0.46875 0.59375 0.5 
+0.53125 0.53125 0.40625 
+0.53125 0.53125 0.4375 
+0.5625 0.53125 0.4375 
+0.53125 0.53125 0.46875 
+0.53125 0.53125 0.5 
+0.5625 0.53125 0.5 
+0.5625 0.53125 0.46875 
+0.5625 0.5625 0.46875 
+0.59375 0.53125 0.46875 
+0.59375 0.53125 0.5 
+0.625 0.53125 0.5 
+0.59375 0.5625 0.5 
+0.59375 0.5625 0.46875 
+0.53125 0.5625 0.4375 
+0.53125 0.5625 0.5 
+0.53125 0.5625 0.46875 
+0.53125 0.59375 0.46875 
+0.53125 0.59375 0.5 
+0.53125 0.625 0.5 
+0.5625 0.59375 0.5 
+0.5625 0.59375 0.46875 
+0.4375 0.40625 0.5 
+0.4375 0.40625 0.53125 
+0.4375 0.4375 0.53125 
+0.46875 0.375 0.5 
+0.46875 0.40625 0.5 
+0.46875 0.40625 0.53125 
+0.5 0.40625 0.53125 
+0.5 0.4375 0.53125 
+0.46875 0.4375 0.5 
+0.46875 0.4375 0.53125 
+0.46875 0.4375 0.5625 
+0.46875 0.46875 0.5 
+0.46875 0.46875 0.53125 
+0.5 0.46875 0.53125 
+0.5 0.5 0.53125 
+0.5 0.46875 0.5625 
+0.46875 0.46875 0.5625 
+0.46875 0.46875 0.59375 
+0.5 0.46875 0.59375 
+0.5 0.5 0.59375 
+0.40625 0.4375 0.5 
+0.40625 0.4375 0.53125 
+0.375 0.46875 0.5 
+0.40625 0.46875 0.5 
+0.40625 0.46875 0.53125 
+0.40625 0.5 0.53125 
+0.4375 0.5 0.53125 
+0.4375 0.46875 0.5 
+0.4375 0.46875 0.53125 
+0.4375 0.46875 0.5625 
+0.46875 0.5 0.53125 
+0.46875 0.5 0.5625 
+0.46875 0.5 0.59375 
+0.53125 0.40625 0.53125 
+0.53125 0.4375 0.53125 
+0.5625 0.4375 0.53125 
+0.53125 0.46875 0.53125 
+0.53125 0.5 0.53125 
+0.5625 0.5 0.53125 
+0.5625 0.46875 0.53125 
+0.5625 0.46875 0.5625 
+0.59375 0.46875 0.53125 
+0.59375 0.5 0.53125 
+0.625 0.5 0.53125 
+0.59375 0.5 0.5625 
+0.59375 0.46875 0.5625 
+0.53125 0.4375 0.5625 
+0.53125 0.5 0.5625 
+0.53125 0.46875 0.5625 
+0.53125 0.46875 0.59375 
+0.53125 0.5 0.59375 
+0.53125 0.5 0.625 
+0.5625 0.5 0.59375 
+0.5625 0.46875 0.59375 
+0.40625 0.53125 0.53125 
+0.4375 0.53125 0.53125 
+0.4375 0.5625 0.53125 
+0.46875 0.53125 0.53125 
+0.5 0.53125 0.53125 
+0.5 0.5625 0.53125 
+0.46875 0.5625 0.53125 
+0.46875 0.5625 0.5625 
+0.46875 0.59375 0.53125 
+0.5 0.59375 0.53125 
+0.5 0.625 0.53125 
+0.5 0.59375 0.5625 
+0.46875 0.59375 0.5625 
+0.4375 0.53125 0.5625 
+0.5 0.53125 0.5625 
+0.46875 0.53125 0.5625 
+0.46875 0.53125 0.59375 
+0.5 0.53125 0.59375 
+0.5 0.53125 0.625 
+0.5 0.5625 0.59375 
+0.46875 0.5625 0.59375 
+0.5 0.40625 0.375 
+0.5 0.40625 0.40625 
+0.53125 0.40625 0.40625 
+0.5 0.375 0.40625 
+0.40625 0.5 0.375 
+0.40625 0.5 0.40625 
+0.40625 0.53125 0.40625 
+0.375 0.5 0.40625 
+0.59375 0.59375 0.46875 
+0.59375 0.59375 0.5 
+0.625 0.59375 0.5 
+0.59375 0.625 0.5 
+0.40625 0.375 0.5 
+0.40625 0.40625 0.5 
+0.40625 0.40625 0.53125 
+0.375 0.40625 0.5 
+0.59375 0.46875 0.59375 
+0.59375 0.5 0.59375 
+0.625 0.5 0.59375 
+0.59375 0.5 0.625 
+0.46875 0.59375 0.59375 
+0.5 0.59375 0.59375 
+0.5 0.625 0.59375 
+0.5 0.59375 0.625 
+0.4375 0.40625 0.375 
+0.46875 0.375 0.375 
+0.46875 0.40625 0.375 
+0.46875 0.4375 0.375 
+0.46875 0.46875 0.375 
+0.4375 0.4375 0.40625 
+0.46875 0.40625 0.40625 
+0.46875 0.4375 0.40625 
+0.46875 0.4375 0.4375 
+0.46875 0.46875 0.40625 
+0.46875 0.46875 0.4375 
+0.46875 0.46875 0.46875 
+0.4375 0.375 0.40625 
+0.46875 0.375 0.40625 
+0.46875 0.375 0.4375 
+0.46875 0.375 0.46875 
+0.4375 0.40625 0.4375 
+0.46875 0.40625 0.4375 
+0.46875 0.40625 0.46875 
+0.46875 0.4375 0.46875 
+0.40625 0.4375 0.375 
+0.375 0.46875 0.375 
+0.40625 0.46875 0.375 
+0.4375 0.46875 0.375 
+0.40625 0.46875 0.40625 
+0.4375 0.46875 0.40625 
+0.4375 0.46875 0.4375 
+0.375 0.4375 0.40625 
+0.375 0.46875 0.40625 
+0.375 0.46875 0.4375 
+0.375 0.46875 0.46875 
+0.40625 0.4375 0.4375 
+0.40625 0.46875 0.4375 
+0.40625 0.46875 0.46875 
+0.4375 0.46875 0.46875 
+0.40625 0.375 0.4375 
+0.375 0.375 0.46875 
+0.40625 0.375 0.46875 
+0.4375 0.375 0.46875 
+0.40625 0.40625 0.46875 
+0.4375 0.40625 0.46875 
+0.4375 0.4375 0.46875 
+0.375 0.40625 0.4375 
+0.375 0.40625 0.46875 
+0.375 0.4375 0.46875 
+0.40625 0.4375 0.46875 
+0.53125 0.4375 0.375 
+0.53125 0.46875 0.375 
+0.53125 0.5 0.375 
+0.5625 0.46875 0.375 
+0.5625 0.4375 0.40625 
+0.5625 0.5 0.40625 
+0.5625 0.46875 0.40625 
+0.59375 0.46875 0.40625 
+0.59375 0.5 0.4375 
+0.59375 0.46875 0.4375 
+0.625 0.5 0.46875 
+0.59375 0.4375 0.4375 
+0.625 0.46875 0.4375 
+0.625 0.46875 0.46875 
+0.53125 0.375 0.4375 
+0.53125 0.375 0.46875 
+0.53125 0.375 0.5 
+0.5625 0.375 0.46875 
+0.5625 0.40625 0.4375 
+0.5625 0.40625 0.5 
+0.5625 0.40625 0.46875 
+0.59375 0.40625 0.46875 
+0.59375 0.4375 0.5 
+0.59375 0.4375 0.46875 
+0.625 0.46875 0.5 
+0.625 0.4375 0.46875 
+0.4375 0.53125 0.375 
+0.46875 0.53125 0.375 
+0.5 0.53125 0.375 
+0.46875 0.5625 0.375 
+0.4375 0.5625 0.40625 
+0.5 0.5625 0.40625 
+0.46875 0.5625 0.40625 
+0.46875 0.59375 0.40625 
+0.5 0.59375 0.4375 
+0.46875 0.59375 0.4375 
+0.5 0.625 0.46875 
+0.4375 0.59375 0.4375 
+0.46875 0.625 0.4375 
+0.46875 0.625 0.46875 
+0.375 0.53125 0.4375 
+0.375 0.53125 0.46875 
+0.375 0.53125 0.5 
+0.375 0.5625 0.46875 
+0.40625 0.5625 0.4375 
+0.40625 0.5625 0.5 
+0.40625 0.5625 0.46875 
+0.40625 0.59375 0.46875 
+0.4375 0.59375 0.5 
+0.4375 0.59375 0.46875 
+0.46875 0.625 0.5 
+0.4375 0.625 0.46875 
+0.5625 0.53125 0.40625 
+0.59375 0.53125 0.40625 
+0.625 0.53125 0.4375 
+0.59375 0.53125 0.4375 
+0.59375 0.5625 0.4375 
+0.625 0.53125 0.46875 
+0.625 0.5625 0.46875 
+0.53125 0.53125 0.375 
+0.5625 0.53125 0.375 
+0.5625 0.5625 0.40625 
+0.53125 0.5625 0.40625 
+0.53125 0.59375 0.40625 
+0.53125 0.625 0.4375 
+0.53125 0.59375 0.4375 
+0.5625 0.59375 0.4375 
+0.53125 0.625 0.46875 
+0.5625 0.625 0.46875 
+0.53125 0.5625 0.375 
+0.4375 0.375 0.53125 
+0.46875 0.375 0.53125 
+0.5 0.375 0.53125 
+0.46875 0.375 0.5625 
+0.4375 0.40625 0.5625 
+0.5 0.40625 0.5625 
+0.46875 0.40625 0.5625 
+0.46875 0.40625 0.59375 
+0.5 0.4375 0.59375 
+0.46875 0.4375 0.59375 
+0.5 0.46875 0.625 
+0.4375 0.4375 0.59375 
+0.46875 0.4375 0.625 
+0.46875 0.46875 0.625 
+0.375 0.4375 0.53125 
+0.375 0.46875 0.53125 
+0.375 0.5 0.53125 
+0.375 0.46875 0.5625 
+0.40625 0.4375 0.5625 
+0.40625 0.5 0.5625 
+0.40625 0.46875 0.5625 
+0.40625 0.46875 0.59375 
+0.4375 0.5 0.59375 
+0.4375 0.46875 0.59375 
+0.46875 0.5 0.625 
+0.4375 0.46875 0.625 
+0.5625 0.40625 0.53125 
+0.59375 0.40625 0.53125 
+0.625 0.4375 0.53125 
+0.59375 0.4375 0.53125 
+0.59375 0.4375 0.5625 
+0.625 0.46875 0.53125 
+0.625 0.46875 0.5625 
+0.53125 0.375 0.53125 
+0.5625 0.375 0.53125 
+0.5625 0.40625 0.5625 
+0.53125 0.40625 0.5625 
+0.53125 0.40625 0.59375 
+0.53125 0.4375 0.625 
+0.53125 0.4375 0.59375 
+0.5625 0.4375 0.59375 
+0.53125 0.46875 0.625 
+0.5625 0.46875 0.625 
+0.53125 0.375 0.5625 
+0.40625 0.5625 0.53125 
+0.40625 0.59375 0.53125 
+0.4375 0.625 0.53125 
+0.4375 0.59375 0.53125 
+0.4375 0.59375 0.5625 
+0.46875 0.625 0.53125 
+0.46875 0.625 0.5625 
+0.375 0.53125 0.53125 
+0.375 0.5625 0.53125 
+0.40625 0.5625 0.5625 
+0.40625 0.53125 0.5625 
+0.40625 0.53125 0.59375 
+0.4375 0.53125 0.625 
+0.4375 0.53125 0.59375 
+0.4375 0.5625 0.59375 
+0.46875 0.53125 0.625 
+0.46875 0.5625 0.625 
+0.375 0.53125 0.5625 
+0.53125 0.53125 0.53125 
+0.5625 0.53125 0.53125 
+0.5625 0.5625 0.53125 
+0.59375 0.53125 0.53125 
+0.625 0.53125 0.53125 
+0.625 0.5625 0.53125 
+0.59375 0.5625 0.53125 
+0.59375 0.5625 0.5625 
+0.59375 0.59375 0.53125 
+0.625 0.59375 0.53125 
+0.625 0.625 0.53125 
+0.625 0.59375 0.5625 
+0.5625 0.53125 0.5625 
+0.625 0.53125 0.5625 
+0.59375 0.53125 0.5625 
+0.59375 0.53125 0.59375 
+0.625 0.53125 0.59375 
+0.625 0.53125 0.625 
+0.625 0.5625 0.59375 
+0.53125 0.5625 0.53125 
+0.53125 0.59375 0.53125 
+0.53125 0.625 0.53125 
+0.5625 0.625 0.53125 
+0.5625 0.59375 0.53125 
+0.5625 0.59375 0.5625 
+0.59375 0.625 0.53125 
+0.59375 0.625 0.5625 
+0.53125 0.5625 0.5625 
+0.53125 0.625 0.5625 
+0.53125 0.59375 0.5625 
+0.53125 0.59375 0.59375 
+0.53125 0.625 0.59375 
+0.53125 0.625 0.625 
+0.5625 0.625 0.59375 
+0.53125 0.53125 0.5625 
+0.53125 0.53125 0.59375 
+0.53125 0.53125 0.625 
+0.5625 0.53125 0.625 
+0.5625 0.53125 0.59375 
+0.5625 0.5625 0.59375 
+0.59375 0.53125 0.625 
+0.59375 0.5625 0.625 
+0.53125 0.5625 0.625 
+0.53125 0.5625 0.59375 
+0.53125 0.59375 0.625 
+0.5625 0.59375 0.625 
+0.4375 0.40625 0.3125 
+0.5 0.40625 0.3125 
+0.46875 0.4375 0.3125 
+0.5 0.375 0.34375 
+0.46875 0.40625 0.34375 
+0.5 0.40625 0.34375 
+0.5 0.4375 0.34375 
+0.46875 0.4375 0.34375 
+0.46875 0.46875 0.34375 
+0.5 0.46875 0.34375 
+0.4375 0.375 0.34375 
+0.4375 0.40625 0.34375 
+0.4375 0.4375 0.34375 
+0.4375 0.40625 0.40625 
+0.4375 0.3125 0.40625 
+0.5 0.3125 0.40625 
+0.46875 0.3125 0.4375 
+0.5 0.34375 0.375 
+0.46875 0.34375 0.40625 
+0.5 0.34375 0.40625 
+0.5 0.34375 0.4375 
+0.46875 0.34375 0.4375 
+0.46875 0.34375 0.46875 
+0.5 0.34375 0.46875 
+0.4375 0.34375 0.375 
+0.4375 0.34375 0.40625 
+0.4375 0.34375 0.4375 
+0.40625 0.4375 0.3125 
+0.40625 0.5 0.3125 
+0.4375 0.46875 0.3125 
+0.375 0.5 0.34375 
+0.40625 0.46875 0.34375 
+0.40625 0.5 0.34375 
+0.4375 0.5 0.34375 
+0.4375 0.46875 0.34375 
+0.46875 0.5 0.34375 
+0.375 0.4375 0.34375 
+0.40625 0.4375 0.34375 
+0.40625 0.4375 0.40625 
+0.3125 0.4375 0.40625 
+0.3125 0.5 0.40625 
+0.3125 0.46875 0.4375 
+0.34375 0.5 0.375 
+0.34375 0.46875 0.40625 
+0.34375 0.5 0.40625 
+0.34375 0.5 0.4375 
+0.34375 0.46875 0.4375 
+0.34375 0.46875 0.46875 
+0.34375 0.5 0.46875 
+0.34375 0.4375 0.375 
+0.34375 0.4375 0.40625 
+0.34375 0.4375 0.4375 
+0.40625 0.3125 0.4375 
+0.40625 0.3125 0.5 
+0.4375 0.3125 0.46875 
+0.375 0.34375 0.5 
+0.40625 0.34375 0.46875 
+0.40625 0.34375 0.5 
+0.4375 0.34375 0.5 
+0.4375 0.34375 0.46875 
+0.46875 0.34375 0.5 
+0.375 0.34375 0.4375 
+0.40625 0.34375 0.4375 
+0.40625 0.40625 0.4375 
+0.3125 0.40625 0.4375 
+0.3125 0.40625 0.5 
+0.3125 0.4375 0.46875 
+0.34375 0.375 0.5 
+0.34375 0.40625 0.46875 
+0.34375 0.40625 0.5 
+0.34375 0.4375 0.5 
+0.34375 0.4375 0.46875 
+0.34375 0.46875 0.5 
+0.34375 0.375 0.4375 
+0.34375 0.40625 0.4375 
+0.53125 0.40625 0.34375 
+0.53125 0.40625 0.375 
+0.53125 0.4375 0.34375 
+0.53125 0.46875 0.34375 
+0.53125 0.375 0.375 
+0.5625 0.40625 0.375 
+0.59375 0.5 0.40625 
+0.5625 0.40625 0.40625 
+0.59375 0.40625 0.40625 
+0.59375 0.4375 0.40625 
+0.53125 0.34375 0.40625 
+0.53125 0.375 0.40625 
+0.53125 0.34375 0.4375 
+0.53125 0.34375 0.46875 
+0.5625 0.375 0.40625 
+0.59375 0.40625 0.5 
+0.59375 0.40625 0.4375 
+0.40625 0.53125 0.34375 
+0.40625 0.53125 0.375 
+0.4375 0.53125 0.34375 
+0.46875 0.53125 0.34375 
+0.375 0.53125 0.375 
+0.40625 0.5625 0.375 
+0.5 0.59375 0.40625 
+0.40625 0.5625 0.40625 
+0.40625 0.59375 0.40625 
+0.4375 0.59375 0.40625 
+0.34375 0.53125 0.40625 
+0.375 0.53125 0.40625 
+0.34375 0.53125 0.4375 
+0.34375 0.53125 0.46875 
+0.375 0.5625 0.40625 
+0.40625 0.59375 0.4375 
+0.625 0.59375 0.46875 
+0.59375 0.5625 0.40625 
+0.59375 0.59375 0.40625 
+0.625 0.59375 0.4375 
+0.59375 0.59375 0.4375 
+0.625 0.625 0.46875 
+0.65625 0.53125 0.46875 
+0.65625 0.5625 0.46875 
+0.65625 0.59375 0.46875 
+0.59375 0.625 0.46875 
+0.5625 0.59375 0.40625 
+0.59375 0.625 0.4375 
+0.53125 0.65625 0.46875 
+0.5625 0.65625 0.46875 
+0.59375 0.65625 0.46875 
+0.40625 0.34375 0.53125 
+0.40625 0.375 0.53125 
+0.4375 0.34375 0.53125 
+0.46875 0.34375 0.53125 
+0.375 0.375 0.53125 
+0.40625 0.375 0.5625 
+0.40625 0.40625 0.5625 
+0.40625 0.40625 0.59375 
+0.4375 0.40625 0.59375 
+0.34375 0.40625 0.53125 
+0.375 0.40625 0.53125 
+0.34375 0.4375 0.53125 
+0.34375 0.46875 0.53125 
+0.375 0.40625 0.5625 
+0.40625 0.4375 0.59375 
+0.625 0.46875 0.59375 
+0.59375 0.40625 0.5625 
+0.625 0.4375 0.59375 
+0.65625 0.46875 0.53125 
+0.65625 0.46875 0.5625 
+0.65625 0.46875 0.59375 
+0.5625 0.5625 0.65625 
+0.625 0.5625 0.65625 
+0.59375 0.5625 0.65625 
+0.53125 0.5625 0.65625 
+0.53125 0.5625 0.6875 
+0.53125 0.59375 0.65625 
+0.5625 0.59375 0.6875 
+0.5625 0.625 0.65625 
+0.5625 0.59375 0.65625 
+0.5 0.46875 0.3125 
+0.5 0.5 0.34375 
+0.5 0.3125 0.46875 
+0.5 0.34375 0.5 
+0.46875 0.5 0.3125 
+0.3125 0.5 0.46875 
+0.34375 0.5 0.5 
+0.46875 0.3125 0.5 
+0.3125 0.46875 0.5 
+0.53125 0.5 0.34375 
+0.65625 0.46875 0.46875 
+0.65625 0.5 0.46875 
+0.65625 0.5 0.5 
+0.53125 0.34375 0.5 
+0.65625 0.46875 0.5 
+0.5 0.53125 0.34375 
+0.46875 0.65625 0.46875 
+0.5 0.65625 0.46875 
+0.5 0.65625 0.5 
+0.34375 0.53125 0.5 
+0.46875 0.65625 0.5 
+0.53125 0.53125 0.34375 
+0.6875 0.53125 0.5 
+0.53125 0.6875 0.5 
+0.5 0.34375 0.53125 
+0.46875 0.46875 0.65625 
+0.5 0.46875 0.65625 
+0.5 0.5 0.65625 
+0.34375 0.5 0.53125 
+0.46875 0.5 0.65625 
+0.53125 0.34375 0.53125 
+0.6875 0.5 0.53125 
+0.53125 0.5 0.6875 
+0.34375 0.53125 0.53125 
+0.5 0.6875 0.53125 
+0.5 0.53125 0.6875 
+0.5 0.40625 0.59375 
+0.59375 0.46875 0.625 
+0.5625 0.40625 0.59375 
+0.59375 0.40625 0.59375 
+0.59375 0.4375 0.625 
+0.59375 0.4375 0.59375 
+0.625 0.46875 0.625 
+0.53125 0.46875 0.65625 
+0.53125 0.5 0.65625 
+0.5625 0.5 0.65625 
+0.5625 0.46875 0.65625 
+0.59375 0.46875 0.65625 
+0.59375 0.5 0.65625 
+0.625 0.5 0.65625 
+0.59375 0.5 0.6875 
+0.40625 0.59375 0.5 
+0.46875 0.625 0.59375 
+0.40625 0.59375 0.5625 
+0.40625 0.59375 0.59375 
+0.4375 0.625 0.59375 
+0.4375 0.59375 0.59375 
+0.46875 0.625 0.625 
+0.46875 0.65625 0.53125 
+0.5 0.65625 0.53125 
+0.5 0.65625 0.5625 
+0.46875 0.65625 0.5625 
+0.46875 0.65625 0.59375 
+0.5 0.65625 0.59375 
+0.5 0.65625 0.625 
+0.5 0.6875 0.59375 
+0.40625 0.5 0.59375 
+0.46875 0.59375 0.625 
+0.40625 0.5625 0.59375 
+0.4375 0.59375 0.625 
+0.46875 0.53125 0.65625 
+0.5 0.53125 0.65625 
+0.5 0.5625 0.65625 
+0.46875 0.5625 0.65625 
+0.46875 0.59375 0.65625 
+0.5 0.59375 0.65625 
+0.5 0.625 0.65625 
+0.5 0.59375 0.6875 
+0.59375 0.59375 0.5625 
+0.65625 0.53125 0.5 
+0.65625 0.5625 0.5 
+0.65625 0.53125 0.53125 
+0.65625 0.5625 0.53125 
+0.6875 0.5625 0.53125 
+0.65625 0.59375 0.5 
+0.65625 0.625 0.5 
+0.65625 0.59375 0.53125 
+0.6875 0.59375 0.5 
+0.6875 0.59375 0.5625 
+0.65625 0.5625 0.5625 
+0.65625 0.625 0.5625 
+0.65625 0.59375 0.5625 
+0.59375 0.5625 0.59375 
+0.65625 0.5 0.53125 
+0.65625 0.5 0.5625 
+0.65625 0.53125 0.5625 
+0.6875 0.53125 0.5625 
+0.65625 0.5 0.59375 
+0.65625 0.5 0.625 
+0.65625 0.53125 0.59375 
+0.6875 0.5 0.59375 
+0.6875 0.5625 0.59375 
+0.65625 0.5625 0.625 
+0.65625 0.5625 0.59375 
+0.53125 0.65625 0.5 
+0.5625 0.65625 0.5 
+0.53125 0.65625 0.53125 
+0.5625 0.65625 0.53125 
+0.5625 0.6875 0.53125 
+0.59375 0.65625 0.5 
+0.625 0.65625 0.5 
+0.59375 0.65625 0.53125 
+0.59375 0.6875 0.5 
+0.59375 0.6875 0.5625 
+0.5625 0.65625 0.5625 
+0.625 0.65625 0.5625 
+0.59375 0.65625 0.5625 
+0.5625 0.59375 0.59375 
+0.53125 0.65625 0.5625 
+0.53125 0.6875 0.5625 
+0.53125 0.65625 0.59375 
+0.5625 0.6875 0.59375 
+0.5625 0.65625 0.625 
+0.5625 0.65625 0.59375 
+0.53125 0.53125 0.65625 
+0.5625 0.53125 0.65625 
+0.5625 0.53125 0.6875 
+0.59375 0.53125 0.65625 
+0.59375 0.5625 0.6875 
+0.515625 0.46875 0.40625 
+0.515625 0.5 0.40625 
+0.5 0.484375 0.40625 
+0.515625 0.484375 0.40625 
+0.53125 0.484375 0.40625 
+0.5 0.484375 0.421875 
+0.5 0.5 0.421875 
+0.515625 0.484375 0.421875 
+0.515625 0.5 0.421875 
+0.515625 0.5 0.4375 
+0.53125 0.5 0.421875 
+0.53125 0.484375 0.421875 
+0.546875 0.484375 0.421875 
+0.546875 0.5 0.421875 
+0.546875 0.5 0.4375 
+0.5 0.453125 0.40625 
+0.515625 0.453125 0.40625 
+0.5 0.4375 0.421875 
+0.5 0.453125 0.421875 
+0.5 0.453125 0.4375 
+0.515625 0.453125 0.421875 
+0.515625 0.453125 0.4375 
+0.515625 0.46875 0.4375 
+0.5 0.46875 0.421875 
+0.515625 0.46875 0.421875 
+0.53125 0.46875 0.421875 
+0.5 0.484375 0.4375 
+0.515625 0.484375 0.4375 
+0.53125 0.484375 0.4375 
+0.546875 0.484375 0.4375 
+0.515625 0.4375 0.40625 
+0.53125 0.453125 0.40625 
+0.515625 0.4375 0.421875 
+0.515625 0.4375 0.4375 
+0.53125 0.453125 0.4375 
+0.53125 0.4375 0.421875 
+0.53125 0.453125 0.421875 
+0.546875 0.4375 0.4375 
+0.546875 0.453125 0.421875 
+0.546875 0.453125 0.4375 
+0.5625 0.453125 0.4375 
+0.546875 0.46875 0.4375 
+0.546875 0.46875 0.421875 
+0.5625 0.484375 0.4375 
+0.5 0.453125 0.453125 
+0.5 0.46875 0.453125 
+0.515625 0.453125 0.453125 
+0.515625 0.46875 0.453125 
+0.515625 0.46875 0.46875 
+0.5 0.484375 0.453125 
+0.5 0.5 0.453125 
+0.515625 0.484375 0.453125 
+0.515625 0.5 0.453125 
+0.515625 0.5 0.46875 
+0.5 0.484375 0.46875 
+0.515625 0.484375 0.46875 
+0.53125 0.484375 0.46875 
+0.5 0.484375 0.484375 
+0.5 0.5 0.484375 
+0.515625 0.484375 0.484375 
+0.515625 0.5 0.484375 
+0.515625 0.5 0.5 
+0.53125 0.5 0.484375 
+0.53125 0.484375 0.484375 
+0.546875 0.484375 0.484375 
+0.546875 0.5 0.484375 
+0.546875 0.5 0.5 
+0.53125 0.46875 0.453125 
+0.53125 0.5 0.453125 
+0.53125 0.484375 0.453125 
+0.546875 0.484375 0.453125 
+0.546875 0.5 0.453125 
+0.5625 0.5 0.453125 
+0.546875 0.5 0.46875 
+0.546875 0.484375 0.46875 
+0.5625 0.5 0.484375 
+0.53125 0.453125 0.453125 
+0.546875 0.453125 0.453125 
+0.5625 0.453125 0.453125 
+0.5625 0.46875 0.453125 
+0.546875 0.46875 0.453125 
+0.546875 0.46875 0.46875 
+0.5625 0.484375 0.453125 
+0.5625 0.484375 0.46875 
+0.5625 0.484375 0.484375 
+0.578125 0.453125 0.453125 
+0.578125 0.46875 0.453125 
+0.578125 0.46875 0.46875 
+0.578125 0.484375 0.453125 
+0.578125 0.5 0.453125 
+0.578125 0.5 0.46875 
+0.578125 0.484375 0.46875 
+0.59375 0.484375 0.46875 
+0.578125 0.484375 0.484375 
+0.578125 0.5 0.484375 
+0.578125 0.5 0.5 
+0.59375 0.5 0.484375 
+0.59375 0.484375 0.484375 
+0.515625 0.40625 0.46875 
+0.515625 0.40625 0.5 
+0.5 0.40625 0.484375 
+0.515625 0.40625 0.484375 
+0.53125 0.40625 0.484375 
+0.5 0.421875 0.484375 
+0.5 0.421875 0.5 
+0.515625 0.421875 0.484375 
+0.515625 0.421875 0.5 
+0.515625 0.4375 0.5 
+0.53125 0.421875 0.5 
+0.53125 0.421875 0.484375 
+0.546875 0.421875 0.484375 
+0.546875 0.421875 0.5 
+0.546875 0.4375 0.5 
+0.5 0.40625 0.453125 
+0.515625 0.40625 0.453125 
+0.5 0.421875 0.4375 
+0.5 0.421875 0.453125 
+0.5 0.4375 0.453125 
+0.515625 0.421875 0.453125 
+0.515625 0.4375 0.453125 
+0.515625 0.4375 0.46875 
+0.5 0.421875 0.46875 
+0.515625 0.421875 0.46875 
+0.53125 0.421875 0.46875 
+0.5 0.4375 0.484375 
+0.515625 0.4375 0.484375 
+0.53125 0.4375 0.484375 
+0.546875 0.4375 0.484375 
+0.515625 0.40625 0.4375 
+0.53125 0.40625 0.453125 
+0.515625 0.421875 0.4375 
+0.53125 0.4375 0.453125 
+0.53125 0.421875 0.4375 
+0.53125 0.421875 0.453125 
+0.546875 0.421875 0.453125 
+0.546875 0.4375 0.453125 
+0.5625 0.4375 0.453125 
+0.546875 0.4375 0.46875 
+0.546875 0.421875 0.46875 
+0.5625 0.4375 0.484375 
+0.5 0.453125 0.46875 
+0.515625 0.453125 0.46875 
+0.5 0.453125 0.484375 
+0.5 0.453125 0.5 
+0.515625 0.453125 0.484375 
+0.515625 0.453125 0.5 
+0.515625 0.46875 0.5 
+0.5 0.46875 0.484375 
+0.515625 0.46875 0.484375 
+0.53125 0.46875 0.484375 
+0.5 0.484375 0.5 
+0.515625 0.484375 0.5 
+0.53125 0.484375 0.5 
+0.546875 0.484375 0.5 
+0.53125 0.453125 0.46875 
+0.53125 0.453125 0.5 
+0.53125 0.453125 0.484375 
+0.546875 0.453125 0.484375 
+0.546875 0.453125 0.5 
+0.5625 0.453125 0.5 
+0.546875 0.46875 0.5 
+0.546875 0.46875 0.484375 
+0.5625 0.484375 0.5 
+0.5625 0.453125 0.46875 
+0.546875 0.453125 0.46875 
+0.5625 0.453125 0.484375 
+0.5625 0.46875 0.484375 
+0.578125 0.453125 0.46875 
+0.578125 0.453125 0.484375 
+0.578125 0.453125 0.5 
+0.578125 0.46875 0.5 
+0.578125 0.46875 0.484375 
+0.59375 0.46875 0.484375 
+0.578125 0.484375 0.5 
+0.59375 0.484375 0.5 
+0.46875 0.515625 0.40625 
+0.5 0.515625 0.40625 
+0.484375 0.5 0.40625 
+0.484375 0.515625 0.40625 
+0.484375 0.53125 0.40625 
+0.484375 0.5 0.421875 
+0.484375 0.515625 0.421875 
+0.5 0.515625 0.421875 
+0.5 0.515625 0.4375 
+0.5 0.53125 0.421875 
+0.484375 0.53125 0.421875 
+0.484375 0.546875 0.421875 
+0.5 0.546875 0.421875 
+0.5 0.546875 0.4375 
+0.453125 0.5 0.40625 
+0.453125 0.515625 0.40625 
+0.4375 0.5 0.421875 
+0.453125 0.5 0.421875 
+0.453125 0.5 0.4375 
+0.453125 0.515625 0.421875 
+0.453125 0.515625 0.4375 
+0.46875 0.515625 0.4375 
+0.46875 0.5 0.421875 
+0.46875 0.515625 0.421875 
+0.46875 0.53125 0.421875 
+0.484375 0.5 0.4375 
+0.484375 0.515625 0.4375 
+0.484375 0.53125 0.4375 
+0.484375 0.546875 0.4375 
+0.4375 0.515625 0.40625 
+0.453125 0.53125 0.40625 
+0.4375 0.515625 0.421875 
+0.4375 0.515625 0.4375 
+0.453125 0.53125 0.4375 
+0.4375 0.53125 0.421875 
+0.453125 0.53125 0.421875 
+0.4375 0.546875 0.4375 
+0.453125 0.546875 0.421875 
+0.453125 0.546875 0.4375 
+0.453125 0.5625 0.4375 
+0.46875 0.546875 0.4375 
+0.46875 0.546875 0.421875 
+0.484375 0.5625 0.4375 
+0.453125 0.5 0.453125 
+0.46875 0.5 0.453125 
+0.453125 0.515625 0.453125 
+0.46875 0.515625 0.453125 
+0.46875 0.515625 0.46875 
+0.484375 0.5 0.453125 
+0.484375 0.515625 0.453125 
+0.5 0.515625 0.453125 
+0.5 0.515625 0.46875 
+0.484375 0.5 0.46875 
+0.484375 0.515625 0.46875 
+0.484375 0.53125 0.46875 
+0.484375 0.5 0.484375 
+0.484375 0.515625 0.484375 
+0.5 0.515625 0.484375 
+0.5 0.515625 0.5 
+0.5 0.53125 0.484375 
+0.484375 0.53125 0.484375 
+0.484375 0.546875 0.484375 
+0.5 0.546875 0.484375 
+0.5 0.546875 0.5 
+0.46875 0.53125 0.453125 
+0.5 0.53125 0.453125 
+0.484375 0.53125 0.453125 
+0.484375 0.546875 0.453125 
+0.5 0.546875 0.453125 
+0.5 0.5625 0.453125 
+0.5 0.546875 0.46875 
+0.484375 0.546875 0.46875 
+0.5 0.5625 0.484375 
+0.453125 0.53125 0.453125 
+0.453125 0.546875 0.453125 
+0.453125 0.5625 0.453125 
+0.46875 0.5625 0.453125 
+0.46875 0.546875 0.453125 
+0.46875 0.546875 0.46875 
+0.484375 0.5625 0.453125 
+0.484375 0.5625 0.46875 
+0.484375 0.5625 0.484375 
+0.453125 0.578125 0.453125 
+0.46875 0.578125 0.453125 
+0.46875 0.578125 0.46875 
+0.484375 0.578125 0.453125 
+0.5 0.578125 0.453125 
+0.5 0.578125 0.46875 
+0.484375 0.578125 0.46875 
+0.484375 0.59375 0.46875 
+0.484375 0.578125 0.484375 
+0.5 0.578125 0.484375 
+0.5 0.578125 0.5 
+0.5 0.59375 0.484375 
+0.484375 0.59375 0.484375 
+0.40625 0.515625 0.46875 
+0.40625 0.515625 0.5 
+0.40625 0.5 0.484375 
+0.40625 0.515625 0.484375 
+0.40625 0.53125 0.484375 
+0.421875 0.5 0.484375 
+0.421875 0.5 0.5 
+0.421875 0.515625 0.484375 
+0.421875 0.515625 0.5 
+0.4375 0.515625 0.5 
+0.421875 0.53125 0.5 
+0.421875 0.53125 0.484375 
+0.421875 0.546875 0.484375 
+0.421875 0.546875 0.5 
+0.4375 0.546875 0.5 
+0.40625 0.5 0.453125 
+0.40625 0.515625 0.453125 
+0.421875 0.5 0.4375 
+0.421875 0.5 0.453125 
+0.4375 0.5 0.453125 
+0.421875 0.515625 0.453125 
+0.4375 0.515625 0.453125 
+0.4375 0.515625 0.46875 
+0.421875 0.5 0.46875 
+0.421875 0.515625 0.46875 
+0.421875 0.53125 0.46875 
+0.4375 0.5 0.484375 
+0.4375 0.515625 0.484375 
+0.4375 0.53125 0.484375 
+0.4375 0.546875 0.484375 
+0.40625 0.515625 0.4375 
+0.40625 0.53125 0.453125 
+0.421875 0.515625 0.4375 
+0.4375 0.53125 0.453125 
+0.421875 0.53125 0.4375 
+0.421875 0.53125 0.453125 
+0.421875 0.546875 0.453125 
+0.4375 0.546875 0.453125 
+0.4375 0.5625 0.453125 
+0.4375 0.546875 0.46875 
+0.421875 0.546875 0.46875 
+0.4375 0.5625 0.484375 
+0.453125 0.5 0.46875 
+0.453125 0.515625 0.46875 
+0.453125 0.5 0.484375 
+0.453125 0.5 0.5 
+0.453125 0.515625 0.484375 
+0.453125 0.515625 0.5 
+0.46875 0.515625 0.5 
+0.46875 0.5 0.484375 
+0.46875 0.515625 0.484375 
+0.46875 0.53125 0.484375 
+0.484375 0.5 0.5 
+0.484375 0.515625 0.5 
+0.484375 0.53125 0.5 
+0.484375 0.546875 0.5 
+0.453125 0.53125 0.46875 
+0.453125 0.53125 0.5 
+0.453125 0.53125 0.484375 
+0.453125 0.546875 0.484375 
+0.453125 0.546875 0.5 
+0.453125 0.5625 0.5 
+0.46875 0.546875 0.5 
+0.46875 0.546875 0.484375 
+0.484375 0.5625 0.5 
+0.453125 0.5625 0.46875 
+0.453125 0.546875 0.46875 
+0.453125 0.5625 0.484375 
+0.46875 0.5625 0.484375 
+0.453125 0.578125 0.46875 
+0.453125 0.578125 0.484375 
+0.453125 0.578125 0.5 
+0.46875 0.578125 0.5 
+0.46875 0.578125 0.484375 
+0.46875 0.59375 0.484375 
+0.484375 0.578125 0.5 
+0.484375 0.59375 0.5 
+0.515625 0.515625 0.40625 
+0.53125 0.515625 0.40625 
+0.515625 0.515625 0.421875 
+0.515625 0.515625 0.4375 
+0.53125 0.515625 0.4375 
+0.53125 0.515625 0.421875 
+0.53125 0.53125 0.421875 
+0.546875 0.515625 0.421875 
+0.546875 0.515625 0.4375 
+0.5625 0.515625 0.4375 
+0.546875 0.53125 0.4375 
+0.546875 0.53125 0.421875 
+0.546875 0.546875 0.421875 
+0.546875 0.546875 0.4375 
+0.5625 0.546875 0.4375 
+0.515625 0.515625 0.453125 
+0.515625 0.515625 0.46875 
+0.53125 0.515625 0.46875 
+0.515625 0.515625 0.484375 
+0.515625 0.515625 0.5 
+0.53125 0.515625 0.5 
+0.53125 0.515625 0.484375 
+0.53125 0.53125 0.484375 
+0.546875 0.515625 0.484375 
+0.546875 0.515625 0.5 
+0.5625 0.515625 0.5 
+0.546875 0.53125 0.5 
+0.546875 0.53125 0.484375 
+0.546875 0.546875 0.484375 
+0.546875 0.546875 0.5 
+0.5625 0.546875 0.5 
+0.53125 0.515625 0.453125 
+0.546875 0.515625 0.453125 
+0.5625 0.515625 0.453125 
+0.5625 0.515625 0.46875 
+0.546875 0.515625 0.46875 
+0.546875 0.53125 0.46875 
+0.5625 0.515625 0.484375 
+0.5625 0.53125 0.484375 
+0.5625 0.546875 0.484375 
+0.53125 0.53125 0.453125 
+0.5625 0.53125 0.453125 
+0.546875 0.53125 0.453125 
+0.546875 0.546875 0.453125 
+0.5625 0.546875 0.453125 
+0.5625 0.5625 0.453125 
+0.5625 0.546875 0.46875 
+0.546875 0.546875 0.46875 
+0.5625 0.5625 0.484375 
+0.578125 0.515625 0.453125 
+0.578125 0.515625 0.46875 
+0.59375 0.515625 0.46875 
+0.578125 0.515625 0.484375 
+0.578125 0.515625 0.5 
+0.59375 0.515625 0.5 
+0.59375 0.515625 0.484375 
+0.59375 0.53125 0.484375 
+0.578125 0.53125 0.46875 
+0.578125 0.53125 0.5 
+0.578125 0.53125 0.484375 
+0.578125 0.546875 0.484375 
+0.578125 0.546875 0.5 
+0.578125 0.5625 0.5 
+0.59375 0.546875 0.5 
+0.59375 0.546875 0.484375 
+0.578125 0.53125 0.453125 
+0.578125 0.546875 0.453125 
+0.578125 0.5625 0.46875 
+0.578125 0.546875 0.46875 
+0.59375 0.546875 0.46875 
+0.578125 0.5625 0.484375 
+0.59375 0.5625 0.484375 
+0.515625 0.53125 0.40625 
+0.515625 0.53125 0.4375 
+0.515625 0.53125 0.421875 
+0.515625 0.546875 0.421875 
+0.515625 0.546875 0.4375 
+0.515625 0.5625 0.4375 
+0.53125 0.546875 0.4375 
+0.53125 0.546875 0.421875 
+0.546875 0.5625 0.4375 
+0.515625 0.53125 0.46875 
+0.515625 0.53125 0.5 
+0.515625 0.53125 0.484375 
+0.515625 0.546875 0.484375 
+0.515625 0.546875 0.5 
+0.515625 0.5625 0.5 
+0.53125 0.546875 0.5 
+0.53125 0.546875 0.484375 
+0.546875 0.5625 0.5 
+0.515625 0.53125 0.453125 
+0.515625 0.546875 0.453125 
+0.515625 0.5625 0.453125 
+0.515625 0.5625 0.46875 
+0.515625 0.546875 0.46875 
+0.53125 0.546875 0.46875 
+0.515625 0.5625 0.484375 
+0.53125 0.5625 0.484375 
+0.546875 0.5625 0.484375 
+0.53125 0.5625 0.453125 
+0.53125 0.546875 0.453125 
+0.546875 0.5625 0.453125 
+0.546875 0.5625 0.46875 
+0.515625 0.578125 0.453125 
+0.515625 0.578125 0.46875 
+0.515625 0.59375 0.46875 
+0.515625 0.578125 0.484375 
+0.515625 0.578125 0.5 
+0.515625 0.59375 0.5 
+0.515625 0.59375 0.484375 
+0.53125 0.59375 0.484375 
+0.53125 0.578125 0.46875 
+0.53125 0.578125 0.5 
+0.53125 0.578125 0.484375 
+0.546875 0.578125 0.484375 
+0.546875 0.578125 0.5 
+0.5625 0.578125 0.5 
+0.546875 0.59375 0.5 
+0.546875 0.59375 0.484375 
+0.53125 0.578125 0.453125 
+0.546875 0.578125 0.453125 
+0.5625 0.578125 0.46875 
+0.546875 0.578125 0.46875 
+0.546875 0.59375 0.46875 
+0.5625 0.578125 0.484375 
+0.5625 0.59375 0.484375 
+0.46875 0.40625 0.515625 
+0.5 0.40625 0.515625 
+0.484375 0.40625 0.5 
+0.484375 0.40625 0.515625 
+0.484375 0.40625 0.53125 
+0.484375 0.421875 0.5 
+0.484375 0.421875 0.515625 
+0.5 0.421875 0.515625 
+0.5 0.4375 0.515625 
+0.5 0.421875 0.53125 
+0.484375 0.421875 0.53125 
+0.484375 0.421875 0.546875 
+0.5 0.421875 0.546875 
+0.5 0.4375 0.546875 
+0.453125 0.40625 0.5 
+0.453125 0.40625 0.515625 
+0.4375 0.421875 0.5 
+0.453125 0.421875 0.5 
+0.453125 0.4375 0.5 
+0.453125 0.421875 0.515625 
+0.453125 0.4375 0.515625 
+0.46875 0.4375 0.515625 
+0.46875 0.421875 0.5 
+0.46875 0.421875 0.515625 
+0.46875 0.421875 0.53125 
+0.484375 0.4375 0.5 
+0.484375 0.4375 0.515625 
+0.484375 0.4375 0.53125 
+0.484375 0.4375 0.546875 
+0.4375 0.40625 0.515625 
+0.453125 0.40625 0.53125 
+0.4375 0.421875 0.515625 
+0.4375 0.4375 0.515625 
+0.453125 0.4375 0.53125 
+0.4375 0.421875 0.53125 
+0.453125 0.421875 0.53125 
+0.4375 0.4375 0.546875 
+0.453125 0.421875 0.546875 
+0.453125 0.4375 0.546875 
+0.453125 0.4375 0.5625 
+0.46875 0.4375 0.546875 
+0.46875 0.421875 0.546875 
+0.484375 0.4375 0.5625 
+0.453125 0.453125 0.5 
+0.46875 0.453125 0.5 
+0.453125 0.453125 0.515625 
+0.46875 0.453125 0.515625 
+0.46875 0.46875 0.515625 
+0.484375 0.453125 0.5 
+0.484375 0.453125 0.515625 
+0.5 0.453125 0.515625 
+0.5 0.46875 0.515625 
+0.484375 0.46875 0.5 
+0.484375 0.46875 0.515625 
+0.484375 0.46875 0.53125 
+0.484375 0.484375 0.5 
+0.484375 0.484375 0.515625 
+0.5 0.484375 0.515625 
+0.5 0.5 0.515625 
+0.5 0.484375 0.53125 
+0.484375 0.484375 0.53125 
+0.484375 0.484375 0.546875 
+0.5 0.484375 0.546875 
+0.5 0.5 0.546875 
+0.46875 0.453125 0.53125 
+0.5 0.453125 0.53125 
+0.484375 0.453125 0.53125 
+0.484375 0.453125 0.546875 
+0.5 0.453125 0.546875 
+0.5 0.453125 0.5625 
+0.5 0.46875 0.546875 
+0.484375 0.46875 0.546875 
+0.5 0.484375 0.5625 
+0.453125 0.453125 0.53125 
+0.453125 0.453125 0.546875 
+0.453125 0.453125 0.5625 
+0.46875 0.453125 0.5625 
+0.46875 0.453125 0.546875 
+0.46875 0.46875 0.546875 
+0.484375 0.453125 0.5625 
+0.484375 0.46875 0.5625 
+0.484375 0.484375 0.5625 
+0.453125 0.453125 0.578125 
+0.46875 0.453125 0.578125 
+0.46875 0.46875 0.578125 
+0.484375 0.453125 0.578125 
+0.5 0.453125 0.578125 
+0.5 0.46875 0.578125 
+0.484375 0.46875 0.578125 
+0.484375 0.46875 0.59375 
+0.484375 0.484375 0.578125 
+0.5 0.484375 0.578125 
+0.5 0.5 0.578125 
+0.5 0.484375 0.59375 
+0.484375 0.484375 0.59375 
+0.40625 0.46875 0.515625 
+0.40625 0.5 0.515625 
+0.40625 0.484375 0.5 
+0.40625 0.484375 0.515625 
+0.40625 0.484375 0.53125 
+0.421875 0.484375 0.5 
+0.421875 0.484375 0.515625 
+0.421875 0.5 0.515625 
+0.4375 0.5 0.515625 
+0.421875 0.5 0.53125 
+0.421875 0.484375 0.53125 
+0.421875 0.484375 0.546875 
+0.421875 0.5 0.546875 
+0.4375 0.5 0.546875 
+0.40625 0.453125 0.5 
+0.40625 0.453125 0.515625 
+0.421875 0.4375 0.5 
+0.421875 0.453125 0.5 
+0.4375 0.453125 0.5 
+0.421875 0.453125 0.515625 
+0.4375 0.453125 0.515625 
+0.4375 0.46875 0.515625 
+0.421875 0.46875 0.5 
+0.421875 0.46875 0.515625 
+0.421875 0.46875 0.53125 
+0.4375 0.484375 0.5 
+0.4375 0.484375 0.515625 
+0.4375 0.484375 0.53125 
+0.4375 0.484375 0.546875 
+0.40625 0.4375 0.515625 
+0.40625 0.453125 0.53125 
+0.421875 0.4375 0.515625 
+0.4375 0.453125 0.53125 
+0.421875 0.4375 0.53125 
+0.421875 0.453125 0.53125 
+0.421875 0.453125 0.546875 
+0.4375 0.453125 0.546875 
+0.4375 0.453125 0.5625 
+0.4375 0.46875 0.546875 
+0.421875 0.46875 0.546875 
+0.4375 0.484375 0.5625 
+0.453125 0.46875 0.5 
+0.453125 0.46875 0.515625 
+0.453125 0.484375 0.5 
+0.453125 0.484375 0.515625 
+0.453125 0.5 0.515625 
+0.46875 0.5 0.515625 
+0.46875 0.484375 0.5 
+0.46875 0.484375 0.515625 
+0.46875 0.484375 0.53125 
+0.484375 0.5 0.515625 
+0.484375 0.5 0.53125 
+0.484375 0.5 0.546875 
+0.453125 0.46875 0.53125 
+0.453125 0.5 0.53125 
+0.453125 0.484375 0.53125 
+0.453125 0.484375 0.546875 
+0.453125 0.5 0.546875 
+0.453125 0.5 0.5625 
+0.46875 0.5 0.546875 
+0.46875 0.484375 0.546875 
+0.484375 0.5 0.5625 
+0.453125 0.46875 0.5625 
+0.453125 0.46875 0.546875 
+0.453125 0.484375 0.5625 
+0.46875 0.484375 0.5625 
+0.453125 0.46875 0.578125 
+0.453125 0.484375 0.578125 
+0.453125 0.5 0.578125 
+0.46875 0.5 0.578125 
+0.46875 0.484375 0.578125 
+0.46875 0.484375 0.59375 
+0.484375 0.5 0.578125 
+0.484375 0.5 0.59375 
+0.515625 0.40625 0.515625 
+0.53125 0.40625 0.515625 
+0.515625 0.421875 0.515625 
+0.515625 0.4375 0.515625 
+0.53125 0.4375 0.515625 
+0.53125 0.421875 0.515625 
+0.53125 0.421875 0.53125 
+0.546875 0.421875 0.515625 
+0.546875 0.4375 0.515625 
+0.5625 0.4375 0.515625 
+0.546875 0.4375 0.53125 
+0.546875 0.421875 0.53125 
+0.546875 0.421875 0.546875 
+0.546875 0.4375 0.546875 
+0.5625 0.4375 0.546875 
+0.515625 0.453125 0.515625 
+0.515625 0.46875 0.515625 
+0.53125 0.46875 0.515625 
+0.515625 0.484375 0.515625 
+0.515625 0.5 0.515625 
+0.53125 0.5 0.515625 
+0.53125 0.484375 0.515625 
+0.53125 0.484375 0.53125 
+0.546875 0.484375 0.515625 
+0.546875 0.5 0.515625 
+0.5625 0.5 0.515625 
+0.546875 0.5 0.53125 
+0.546875 0.484375 0.53125 
+0.546875 0.484375 0.546875 
+0.546875 0.5 0.546875 
+0.5625 0.5 0.546875 
+0.53125 0.453125 0.515625 
+0.546875 0.453125 0.515625 
+0.5625 0.453125 0.515625 
+0.5625 0.46875 0.515625 
+0.546875 0.46875 0.515625 
+0.546875 0.46875 0.53125 
+0.5625 0.484375 0.515625 
+0.5625 0.484375 0.53125 
+0.5625 0.484375 0.546875 
+0.53125 0.453125 0.53125 
+0.5625 0.453125 0.53125 
+0.546875 0.453125 0.53125 
+0.546875 0.453125 0.546875 
+0.5625 0.453125 0.546875 
+0.5625 0.453125 0.5625 
+0.5625 0.46875 0.546875 
+0.546875 0.46875 0.546875 
+0.5625 0.484375 0.5625 
+0.578125 0.453125 0.515625 
+0.578125 0.46875 0.515625 
+0.59375 0.46875 0.515625 
+0.578125 0.484375 0.515625 
+0.578125 0.5 0.515625 
+0.59375 0.5 0.515625 
+0.59375 0.484375 0.515625 
+0.59375 0.484375 0.53125 
+0.578125 0.46875 0.53125 
+0.578125 0.5 0.53125 
+0.578125 0.484375 0.53125 
+0.578125 0.484375 0.546875 
+0.578125 0.5 0.546875 
+0.578125 0.5 0.5625 
+0.59375 0.5 0.546875 
+0.59375 0.484375 0.546875 
+0.578125 0.453125 0.53125 
+0.578125 0.453125 0.546875 
+0.578125 0.46875 0.5625 
+0.578125 0.46875 0.546875 
+0.59375 0.46875 0.546875 
+0.578125 0.484375 0.5625 
+0.59375 0.484375 0.5625 
+0.515625 0.40625 0.53125 
+0.515625 0.4375 0.53125 
+0.515625 0.421875 0.53125 
+0.515625 0.421875 0.546875 
+0.515625 0.4375 0.546875 
+0.515625 0.4375 0.5625 
+0.53125 0.4375 0.546875 
+0.53125 0.421875 0.546875 
+0.546875 0.4375 0.5625 
+0.515625 0.46875 0.53125 
+0.515625 0.5 0.53125 
+0.515625 0.484375 0.53125 
+0.515625 0.484375 0.546875 
+0.515625 0.5 0.546875 
+0.515625 0.5 0.5625 
+0.53125 0.5 0.546875 
+0.53125 0.484375 0.546875 
+0.546875 0.5 0.5625 
+0.515625 0.453125 0.53125 
+0.515625 0.453125 0.546875 
+0.515625 0.453125 0.5625 
+0.515625 0.46875 0.5625 
+0.515625 0.46875 0.546875 
+0.53125 0.46875 0.546875 
+0.515625 0.484375 0.5625 
+0.53125 0.484375 0.5625 
+0.546875 0.484375 0.5625 
+0.53125 0.453125 0.5625 
+0.53125 0.453125 0.546875 
+0.546875 0.453125 0.5625 
+0.546875 0.46875 0.5625 
+0.515625 0.453125 0.578125 
+0.515625 0.46875 0.578125 
+0.515625 0.46875 0.59375 
+0.515625 0.484375 0.578125 
+0.515625 0.5 0.578125 
+0.515625 0.5 0.59375 
+0.515625 0.484375 0.59375 
+0.53125 0.484375 0.59375 
+0.53125 0.46875 0.578125 
+0.53125 0.5 0.578125 
+0.53125 0.484375 0.578125 
+0.546875 0.484375 0.578125 
+0.546875 0.5 0.578125 
+0.5625 0.5 0.578125 
+0.546875 0.5 0.59375 
+0.546875 0.484375 0.59375 
+0.53125 0.453125 0.578125 
+0.546875 0.453125 0.578125 
+0.5625 0.46875 0.578125 
+0.546875 0.46875 0.578125 
+0.546875 0.46875 0.59375 
+0.5625 0.484375 0.578125 
+0.5625 0.484375 0.59375 
+0.40625 0.515625 0.515625 
+0.40625 0.53125 0.515625 
+0.421875 0.515625 0.515625 
+0.4375 0.515625 0.515625 
+0.4375 0.53125 0.515625 
+0.421875 0.53125 0.515625 
+0.421875 0.53125 0.53125 
+0.421875 0.546875 0.515625 
+0.4375 0.546875 0.515625 
+0.4375 0.5625 0.515625 
+0.4375 0.546875 0.53125 
+0.421875 0.546875 0.53125 
+0.421875 0.546875 0.546875 
+0.4375 0.546875 0.546875 
+0.4375 0.5625 0.546875 
+0.453125 0.515625 0.515625 
+0.46875 0.515625 0.515625 
+0.46875 0.53125 0.515625 
+0.484375 0.515625 0.515625 
+0.5 0.515625 0.515625 
+0.5 0.53125 0.515625 
+0.484375 0.53125 0.515625 
+0.484375 0.53125 0.53125 
+0.484375 0.546875 0.515625 
+0.5 0.546875 0.515625 
+0.5 0.5625 0.515625 
+0.5 0.546875 0.53125 
+0.484375 0.546875 0.53125 
+0.484375 0.546875 0.546875 
+0.5 0.546875 0.546875 
+0.5 0.5625 0.546875 
+0.453125 0.53125 0.515625 
+0.453125 0.546875 0.515625 
+0.453125 0.5625 0.515625 
+0.46875 0.5625 0.515625 
+0.46875 0.546875 0.515625 
+0.46875 0.546875 0.53125 
+0.484375 0.5625 0.515625 
+0.484375 0.5625 0.53125 
+0.484375 0.5625 0.546875 
+0.453125 0.53125 0.53125 
+0.453125 0.5625 0.53125 
+0.453125 0.546875 0.53125 
+0.453125 0.546875 0.546875 
+0.453125 0.5625 0.546875 
+0.453125 0.5625 0.5625 
+0.46875 0.5625 0.546875 
+0.46875 0.546875 0.546875 
+0.484375 0.5625 0.5625 
+0.453125 0.578125 0.515625 
+0.46875 0.578125 0.515625 
+0.46875 0.59375 0.515625 
+0.484375 0.578125 0.515625 
+0.5 0.578125 0.515625 
+0.5 0.59375 0.515625 
+0.484375 0.59375 0.515625 
+0.484375 0.59375 0.53125 
+0.46875 0.578125 0.53125 
+0.5 0.578125 0.53125 
+0.484375 0.578125 0.53125 
+0.484375 0.578125 0.546875 
+0.5 0.578125 0.546875 
+0.5 0.578125 0.5625 
+0.5 0.59375 0.546875 
+0.484375 0.59375 0.546875 
+0.453125 0.578125 0.53125 
+0.453125 0.578125 0.546875 
+0.46875 0.578125 0.5625 
+0.46875 0.578125 0.546875 
+0.46875 0.59375 0.546875 
+0.484375 0.578125 0.5625 
+0.484375 0.59375 0.5625 
+0.40625 0.515625 0.53125 
+0.4375 0.515625 0.53125 
+0.421875 0.515625 0.53125 
+0.421875 0.515625 0.546875 
+0.4375 0.515625 0.546875 
+0.4375 0.515625 0.5625 
+0.4375 0.53125 0.546875 
+0.421875 0.53125 0.546875 
+0.4375 0.546875 0.5625 
+0.46875 0.515625 0.53125 
+0.5 0.515625 0.53125 
+0.484375 0.515625 0.53125 
+0.484375 0.515625 0.546875 
+0.5 0.515625 0.546875 
+0.5 0.515625 0.5625 
+0.5 0.53125 0.546875 
+0.484375 0.53125 0.546875 
+0.5 0.546875 0.5625 
+0.453125 0.515625 0.53125 
+0.453125 0.515625 0.546875 
+0.453125 0.515625 0.5625 
+0.46875 0.515625 0.5625 
+0.46875 0.515625 0.546875 
+0.46875 0.53125 0.546875 
+0.484375 0.515625 0.5625 
+0.484375 0.53125 0.5625 
+0.484375 0.546875 0.5625 
+0.453125 0.53125 0.5625 
+0.453125 0.53125 0.546875 
+0.453125 0.546875 0.5625 
+0.46875 0.546875 0.5625 
+0.453125 0.515625 0.578125 
+0.46875 0.515625 0.578125 
+0.46875 0.515625 0.59375 
+0.484375 0.515625 0.578125 
+0.5 0.515625 0.578125 
+0.5 0.515625 0.59375 
+0.484375 0.515625 0.59375 
+0.484375 0.53125 0.59375 
+0.46875 0.53125 0.578125 
+0.5 0.53125 0.578125 
+0.484375 0.53125 0.578125 
+0.484375 0.546875 0.578125 
+0.5 0.546875 0.578125 
+0.5 0.5625 0.578125 
+0.5 0.546875 0.59375 
+0.484375 0.546875 0.59375 
+0.453125 0.53125 0.578125 
+0.453125 0.546875 0.578125 
+0.46875 0.5625 0.578125 
+0.46875 0.546875 0.578125 
+0.46875 0.546875 0.59375 
+0.484375 0.5625 0.578125 
+0.484375 0.5625 0.59375 
+0.5 0.453125 0.375 
+0.5 0.453125 0.390625 
+0.5 0.46875 0.390625 
+0.515625 0.453125 0.390625 
+0.515625 0.46875 0.390625 
+0.5 0.484375 0.375 
+0.5 0.484375 0.390625 
+0.5 0.5 0.390625 
+0.515625 0.484375 0.390625 
+0.515625 0.5 0.390625 
+0.5 0.4375 0.390625 
+0.515625 0.4375 0.390625 
+0.546875 0.4375 0.421875 
+0.609375 0.484375 0.484375 
+0.609375 0.5 0.484375 
+0.609375 0.5 0.5 
+0.5 0.375 0.453125 
+0.5 0.390625 0.453125 
+0.5 0.390625 0.46875 
+0.515625 0.390625 0.453125 
+0.515625 0.390625 0.46875 
+0.5 0.375 0.484375 
+0.5 0.390625 0.484375 
+0.5 0.390625 0.5 
+0.515625 0.390625 0.484375 
+0.515625 0.390625 0.5 
+0.5 0.390625 0.4375 
+0.515625 0.390625 0.4375 
+0.546875 0.421875 0.4375 
+0.609375 0.484375 0.5 
+0.453125 0.5 0.375 
+0.453125 0.5 0.390625 
+0.46875 0.5 0.390625 
+0.453125 0.515625 0.390625 
+0.46875 0.515625 0.390625 
+0.484375 0.5 0.375 
+0.484375 0.5 0.390625 
+0.484375 0.515625 0.390625 
+0.5 0.515625 0.390625 
+0.4375 0.5 0.390625 
+0.4375 0.515625 0.390625 
+0.4375 0.546875 0.421875 
+0.484375 0.609375 0.484375 
+0.5 0.609375 0.484375 
+0.5 0.609375 0.5 
+0.375 0.5 0.453125 
+0.390625 0.5 0.453125 
+0.390625 0.5 0.46875 
+0.390625 0.515625 0.453125 
+0.390625 0.515625 0.46875 
+0.375 0.5 0.484375 
+0.390625 0.5 0.484375 
+0.390625 0.5 0.5 
+0.390625 0.515625 0.484375 
+0.390625 0.515625 0.5 
+0.390625 0.5 0.4375 
+0.390625 0.515625 0.4375 
+0.421875 0.546875 0.4375 
+0.484375 0.609375 0.5 
+0.515625 0.515625 0.390625 
+0.609375 0.515625 0.484375 
+0.609375 0.515625 0.5 
+0.625 0.515625 0.5 
+0.609375 0.53125 0.5 
+0.609375 0.53125 0.484375 
+0.609375 0.546875 0.484375 
+0.609375 0.546875 0.5 
+0.625 0.546875 0.5 
+0.609375 0.5625 0.5 
+0.578125 0.5625 0.453125 
+0.609375 0.5625 0.484375 
+0.515625 0.609375 0.484375 
+0.515625 0.609375 0.5 
+0.515625 0.625 0.5 
+0.53125 0.609375 0.5 
+0.53125 0.609375 0.484375 
+0.546875 0.609375 0.484375 
+0.546875 0.609375 0.5 
+0.546875 0.625 0.5 
+0.5625 0.609375 0.5 
+0.5625 0.578125 0.453125 
+0.5625 0.609375 0.484375 
+0.453125 0.375 0.5 
+0.453125 0.390625 0.5 
+0.46875 0.390625 0.5 
+0.453125 0.390625 0.515625 
+0.46875 0.390625 0.515625 
+0.484375 0.375 0.5 
+0.484375 0.390625 0.5 
+0.484375 0.390625 0.515625 
+0.5 0.390625 0.515625 
+0.4375 0.390625 0.5 
+0.4375 0.390625 0.515625 
+0.4375 0.421875 0.546875 
+0.484375 0.484375 0.609375 
+0.5 0.484375 0.609375 
+0.5 0.5 0.609375 
+0.375 0.453125 0.5 
+0.390625 0.453125 0.5 
+0.390625 0.46875 0.5 
+0.390625 0.453125 0.515625 
+0.390625 0.46875 0.515625 
+0.375 0.484375 0.5 
+0.390625 0.484375 0.5 
+0.390625 0.484375 0.515625 
+0.390625 0.5 0.515625 
+0.390625 0.4375 0.5 
+0.390625 0.4375 0.515625 
+0.421875 0.4375 0.546875 
+0.484375 0.5 0.609375 
+0.515625 0.390625 0.515625 
+0.609375 0.484375 0.515625 
+0.609375 0.5 0.515625 
+0.625 0.5 0.515625 
+0.609375 0.5 0.53125 
+0.609375 0.484375 0.53125 
+0.609375 0.484375 0.546875 
+0.609375 0.5 0.546875 
+0.625 0.5 0.546875 
+0.609375 0.5 0.5625 
+0.578125 0.453125 0.5625 
+0.609375 0.484375 0.5625 
+0.515625 0.484375 0.609375 
+0.515625 0.5 0.609375 
+0.515625 0.5 0.625 
+0.53125 0.5 0.609375 
+0.53125 0.484375 0.609375 
+0.546875 0.484375 0.609375 
+0.546875 0.5 0.609375 
+0.546875 0.5 0.625 
+0.5625 0.5 0.609375 
+0.5625 0.453125 0.578125 
+0.5625 0.484375 0.609375 
+0.390625 0.515625 0.515625 
+0.484375 0.609375 0.515625 
+0.5 0.609375 0.515625 
+0.5 0.625 0.515625 
+0.5 0.609375 0.53125 
+0.484375 0.609375 0.53125 
+0.484375 0.609375 0.546875 
+0.5 0.609375 0.546875 
+0.5 0.625 0.546875 
+0.5 0.609375 0.5625 
+0.453125 0.578125 0.5625 
+0.484375 0.609375 0.5625 
+0.484375 0.515625 0.609375 
+0.5 0.515625 0.609375 
+0.5 0.515625 0.625 
+0.5 0.53125 0.609375 
+0.484375 0.53125 0.609375 
+0.484375 0.546875 0.609375 
+0.5 0.546875 0.609375 
+0.5 0.546875 0.625 
+0.5 0.5625 0.609375 
+0.453125 0.5625 0.578125 
+0.484375 0.5625 0.609375 
+0.515625 0.40625 0.40625 
+0.5 0.421875 0.40625 
+0.515625 0.421875 0.40625 
+0.53125 0.421875 0.40625 
+0.5 0.421875 0.421875 
+0.515625 0.421875 0.421875 
+0.53125 0.421875 0.421875 
+0.546875 0.421875 0.421875 
+0.5 0.40625 0.421875 
+0.515625 0.40625 0.421875 
+0.53125 0.40625 0.421875 
+0.40625 0.515625 0.40625 
+0.421875 0.5 0.40625 
+0.421875 0.515625 0.40625 
+0.421875 0.53125 0.40625 
+0.421875 0.5 0.421875 
+0.421875 0.515625 0.421875 
+0.421875 0.53125 0.421875 
+0.421875 0.546875 0.421875 
+0.40625 0.5 0.421875 
+0.40625 0.515625 0.421875 
+0.40625 0.53125 0.421875 
+0.578125 0.578125 0.453125 
+0.578125 0.578125 0.46875 
+0.59375 0.578125 0.46875 
+0.578125 0.578125 0.484375 
+0.578125 0.578125 0.5 
+0.59375 0.578125 0.5 
+0.59375 0.578125 0.484375 
+0.59375 0.59375 0.484375 
+0.578125 0.59375 0.46875 
+0.578125 0.59375 0.5 
+0.578125 0.59375 0.484375 
+0.40625 0.40625 0.515625 
+0.421875 0.40625 0.5 
+0.421875 0.40625 0.515625 
+0.421875 0.40625 0.53125 
+0.421875 0.421875 0.5 
+0.421875 0.421875 0.515625 
+0.421875 0.421875 0.53125 
+0.421875 0.421875 0.546875 
+0.40625 0.421875 0.5 
+0.40625 0.421875 0.515625 
+0.40625 0.421875 0.53125 
+0.578125 0.453125 0.578125 
+0.578125 0.46875 0.578125 
+0.59375 0.46875 0.578125 
+0.578125 0.484375 0.578125 
+0.578125 0.5 0.578125 
+0.59375 0.5 0.578125 
+0.59375 0.484375 0.578125 
+0.59375 0.484375 0.59375 
+0.578125 0.46875 0.59375 
+0.578125 0.5 0.59375 
+0.578125 0.484375 0.59375 
+0.453125 0.578125 0.578125 
+0.46875 0.578125 0.578125 
+0.46875 0.59375 0.578125 
+0.484375 0.578125 0.578125 
+0.5 0.578125 0.578125 
+0.5 0.59375 0.578125 
+0.484375 0.59375 0.578125 
+0.484375 0.59375 0.59375 
+0.46875 0.578125 0.59375 
+0.5 0.578125 0.59375 
+0.484375 0.578125 0.59375 
+0.484375 0.40625 0.40625 
+0.484375 0.421875 0.40625 
+0.484375 0.421875 0.421875 
+0.46875 0.4375 0.390625 
+0.46875 0.421875 0.40625 
+0.484375 0.4375 0.375 
+0.484375 0.4375 0.390625 
+0.484375 0.4375 0.40625 
+0.484375 0.4375 0.421875 
+0.46875 0.4375 0.421875 
+0.484375 0.4375 0.4375 
+0.46875 0.46875 0.390625 
+0.484375 0.453125 0.390625 
+0.484375 0.46875 0.375 
+0.484375 0.46875 0.390625 
+0.484375 0.46875 0.40625 
+0.484375 0.484375 0.390625 
+0.484375 0.484375 0.40625 
+0.484375 0.484375 0.421875 
+0.46875 0.453125 0.40625 
+0.484375 0.453125 0.40625 
+0.484375 0.453125 0.421875 
+0.484375 0.46875 0.421875 
+0.453125 0.4375 0.4375 
+0.453125 0.453125 0.4375 
+0.46875 0.453125 0.4375 
+0.46875 0.453125 0.421875 
+0.46875 0.46875 0.421875 
+0.484375 0.453125 0.4375 
+0.484375 0.46875 0.4375 
+0.484375 0.484375 0.4375 
+0.453125 0.453125 0.453125 
+0.46875 0.453125 0.453125 
+0.46875 0.46875 0.453125 
+0.484375 0.453125 0.453125 
+0.484375 0.46875 0.453125 
+0.484375 0.46875 0.46875 
+0.484375 0.484375 0.453125 
+0.484375 0.484375 0.46875 
+0.484375 0.484375 0.484375 
+0.484375 0.40625 0.421875 
+0.46875 0.390625 0.4375 
+0.46875 0.40625 0.421875 
+0.484375 0.375 0.4375 
+0.484375 0.390625 0.4375 
+0.484375 0.40625 0.4375 
+0.484375 0.421875 0.4375 
+0.46875 0.421875 0.4375 
+0.46875 0.390625 0.46875 
+0.484375 0.390625 0.453125 
+0.484375 0.375 0.46875 
+0.484375 0.390625 0.46875 
+0.484375 0.40625 0.46875 
+0.484375 0.390625 0.484375 
+0.484375 0.40625 0.484375 
+0.484375 0.421875 0.484375 
+0.46875 0.40625 0.453125 
+0.484375 0.40625 0.453125 
+0.484375 0.421875 0.453125 
+0.484375 0.421875 0.46875 
+0.453125 0.4375 0.453125 
+0.46875 0.4375 0.453125 
+0.46875 0.421875 0.453125 
+0.46875 0.421875 0.46875 
+0.484375 0.4375 0.453125 
+0.484375 0.4375 0.46875 
+0.484375 0.4375 0.484375 
+0.46875 0.453125 0.46875 
+0.484375 0.453125 0.46875 
+0.484375 0.453125 0.484375 
+0.484375 0.46875 0.484375 
+0.40625 0.484375 0.40625 
+0.421875 0.484375 0.40625 
+0.421875 0.484375 0.421875 
+0.4375 0.46875 0.390625 
+0.421875 0.46875 0.40625 
+0.4375 0.484375 0.375 
+0.4375 0.484375 0.390625 
+0.4375 0.484375 0.40625 
+0.4375 0.484375 0.421875 
+0.4375 0.46875 0.421875 
+0.4375 0.484375 0.4375 
+0.453125 0.484375 0.390625 
+0.46875 0.484375 0.375 
+0.46875 0.484375 0.390625 
+0.46875 0.484375 0.40625 
+0.453125 0.46875 0.40625 
+0.453125 0.484375 0.40625 
+0.453125 0.484375 0.421875 
+0.46875 0.484375 0.421875 
+0.4375 0.453125 0.4375 
+0.453125 0.46875 0.4375 
+0.453125 0.46875 0.421875 
+0.453125 0.484375 0.4375 
+0.46875 0.484375 0.4375 
+0.453125 0.46875 0.453125 
+0.453125 0.484375 0.453125 
+0.46875 0.484375 0.453125 
+0.46875 0.484375 0.46875 
+0.40625 0.484375 0.421875 
+0.390625 0.46875 0.4375 
+0.40625 0.46875 0.421875 
+0.375 0.484375 0.4375 
+0.390625 0.484375 0.4375 
+0.40625 0.484375 0.4375 
+0.421875 0.484375 0.4375 
+0.421875 0.46875 0.4375 
+0.390625 0.46875 0.46875 
+0.390625 0.484375 0.453125 
+0.375 0.484375 0.46875 
+0.390625 0.484375 0.46875 
+0.40625 0.484375 0.46875 
+0.390625 0.484375 0.484375 
+0.40625 0.484375 0.484375 
+0.421875 0.484375 0.484375 
+0.40625 0.46875 0.453125 
+0.40625 0.484375 0.453125 
+0.421875 0.484375 0.453125 
+0.421875 0.484375 0.46875 
+0.4375 0.453125 0.453125 
+0.4375 0.46875 0.453125 
+0.421875 0.46875 0.453125 
+0.421875 0.46875 0.46875 
+0.4375 0.484375 0.453125 
+0.4375 0.484375 0.46875 
+0.4375 0.484375 0.484375 
+0.453125 0.46875 0.46875 
+0.453125 0.484375 0.46875 
+0.453125 0.484375 0.484375 
+0.46875 0.484375 0.484375 
+0.40625 0.40625 0.484375 
+0.421875 0.40625 0.484375 
+0.421875 0.421875 0.484375 
+0.4375 0.390625 0.46875 
+0.421875 0.40625 0.46875 
+0.4375 0.375 0.484375 
+0.4375 0.390625 0.484375 
+0.4375 0.40625 0.484375 
+0.4375 0.421875 0.484375 
+0.4375 0.421875 0.46875 
+0.4375 0.4375 0.484375 
+0.453125 0.390625 0.484375 
+0.46875 0.375 0.484375 
+0.46875 0.390625 0.484375 
+0.46875 0.40625 0.484375 
+0.453125 0.40625 0.46875 
+0.453125 0.40625 0.484375 
+0.453125 0.421875 0.484375 
+0.46875 0.421875 0.484375 
+0.4375 0.4375 0.453125 
+0.453125 0.4375 0.46875 
+0.453125 0.421875 0.46875 
+0.453125 0.4375 0.484375 
+0.46875 0.4375 0.484375 
+0.453125 0.453125 0.46875 
+0.453125 0.453125 0.484375 
+0.46875 0.453125 0.484375 
+0.46875 0.46875 0.484375 
+0.40625 0.421875 0.484375 
+0.390625 0.4375 0.46875 
+0.40625 0.421875 0.46875 
+0.375 0.4375 0.484375 
+0.390625 0.4375 0.484375 
+0.40625 0.4375 0.484375 
+0.421875 0.4375 0.484375 
+0.421875 0.4375 0.46875 
+0.390625 0.453125 0.484375 
+0.375 0.46875 0.484375 
+0.390625 0.46875 0.484375 
+0.40625 0.46875 0.484375 
+0.40625 0.453125 0.46875 
+0.40625 0.453125 0.484375 
+0.421875 0.453125 0.484375 
+0.421875 0.46875 0.484375 
+0.4375 0.453125 0.46875 
+0.421875 0.453125 0.46875 
+0.4375 0.453125 0.484375 
+0.4375 0.46875 0.484375 
+0.453125 0.46875 0.484375 
+0.515625 0.4375 0.375 
+0.53125 0.4375 0.390625 
+0.546875 0.4375 0.40625 
+0.5625 0.4375 0.421875 
+0.515625 0.46875 0.375 
+0.53125 0.46875 0.390625 
+0.515625 0.5 0.375 
+0.53125 0.5 0.390625 
+0.53125 0.484375 0.390625 
+0.546875 0.484375 0.390625 
+0.546875 0.5 0.40625 
+0.546875 0.484375 0.40625 
+0.5625 0.5 0.421875 
+0.53125 0.453125 0.390625 
+0.546875 0.453125 0.390625 
+0.546875 0.46875 0.40625 
+0.5625 0.484375 0.40625 
+0.5625 0.484375 0.421875 
+0.5625 0.453125 0.40625 
+0.546875 0.453125 0.40625 
+0.5625 0.453125 0.421875 
+0.5625 0.46875 0.421875 
+0.578125 0.484375 0.421875 
+0.578125 0.5 0.4375 
+0.578125 0.453125 0.421875 
+0.578125 0.453125 0.4375 
+0.578125 0.46875 0.4375 
+0.578125 0.484375 0.4375 
+0.59375 0.484375 0.4375 
+0.59375 0.46875 0.453125 
+0.59375 0.5 0.453125 
+0.59375 0.484375 0.453125 
+0.609375 0.484375 0.453125 
+0.609375 0.5 0.46875 
+0.609375 0.484375 0.46875 
+0.625 0.5 0.484375 
+0.578125 0.4375 0.4375 
+0.59375 0.453125 0.4375 
+0.59375 0.453125 0.453125 
+0.515625 0.375 0.4375 
+0.53125 0.390625 0.4375 
+0.546875 0.40625 0.4375 
+0.5625 0.421875 0.4375 
+0.515625 0.375 0.46875 
+0.53125 0.390625 0.46875 
+0.515625 0.375 0.5 
+0.53125 0.390625 0.5 
+0.53125 0.390625 0.484375 
+0.546875 0.390625 0.484375 
+0.546875 0.40625 0.5 
+0.546875 0.40625 0.484375 
+0.5625 0.421875 0.5 
+0.53125 0.390625 0.453125 
+0.546875 0.390625 0.453125 
+0.546875 0.40625 0.46875 
+0.5625 0.40625 0.484375 
+0.5625 0.421875 0.484375 
+0.5625 0.40625 0.453125 
+0.546875 0.40625 0.453125 
+0.5625 0.421875 0.453125 
+0.5625 0.421875 0.46875 
+0.578125 0.421875 0.484375 
+0.578125 0.4375 0.5 
+0.578125 0.421875 0.453125 
+0.578125 0.4375 0.453125 
+0.578125 0.4375 0.46875 
+0.578125 0.4375 0.484375 
+0.59375 0.4375 0.484375 
+0.59375 0.453125 0.46875 
+0.59375 0.453125 0.5 
+0.59375 0.453125 0.484375 
+0.609375 0.453125 0.484375 
+0.609375 0.46875 0.5 
+0.609375 0.46875 0.484375 
+0.625 0.484375 0.5 
+0.59375 0.4375 0.453125 
+0.4375 0.515625 0.375 
+0.4375 0.53125 0.390625 
+0.4375 0.546875 0.40625 
+0.4375 0.5625 0.421875 
+0.46875 0.515625 0.375 
+0.46875 0.53125 0.390625 
+0.5 0.515625 0.375 
+0.5 0.53125 0.390625 
+0.484375 0.53125 0.390625 
+0.484375 0.546875 0.390625 
+0.5 0.546875 0.40625 
+0.484375 0.546875 0.40625 
+0.5 0.5625 0.421875 
+0.453125 0.53125 0.390625 
+0.453125 0.546875 0.390625 
+0.46875 0.546875 0.40625 
+0.484375 0.5625 0.40625 
+0.484375 0.5625 0.421875 
+0.453125 0.5625 0.40625 
+0.453125 0.546875 0.40625 
+0.453125 0.5625 0.421875 
+0.46875 0.5625 0.421875 
+0.484375 0.578125 0.421875 
+0.5 0.578125 0.4375 
+0.453125 0.578125 0.421875 
+0.453125 0.578125 0.4375 
+0.46875 0.578125 0.4375 
+0.484375 0.578125 0.4375 
+0.484375 0.59375 0.4375 
+0.46875 0.59375 0.453125 
+0.5 0.59375 0.453125 
+0.484375 0.59375 0.453125 
+0.484375 0.609375 0.453125 
+0.5 0.609375 0.46875 
+0.484375 0.609375 0.46875 
+0.5 0.625 0.484375 
+0.4375 0.578125 0.4375 
+0.453125 0.59375 0.4375 
+0.453125 0.59375 0.453125 
+0.375 0.515625 0.4375 
+0.390625 0.53125 0.4375 
+0.40625 0.546875 0.4375 
+0.421875 0.5625 0.4375 
+0.375 0.515625 0.46875 
+0.390625 0.53125 0.46875 
+0.375 0.515625 0.5 
+0.390625 0.53125 0.5 
+0.390625 0.53125 0.484375 
+0.390625 0.546875 0.484375 
+0.40625 0.546875 0.5 
+0.40625 0.546875 0.484375 
+0.421875 0.5625 0.5 
+0.390625 0.53125 0.453125 
+0.390625 0.546875 0.453125 
+0.40625 0.546875 0.46875 
+0.40625 0.5625 0.484375 
+0.421875 0.5625 0.484375 
+0.40625 0.5625 0.453125 
+0.40625 0.546875 0.453125 
+0.421875 0.5625 0.453125 
+0.421875 0.5625 0.46875 
+0.421875 0.578125 0.484375 
+0.4375 0.578125 0.5 
+0.421875 0.578125 0.453125 
+0.4375 0.578125 0.453125 
+0.4375 0.578125 0.46875 
+0.4375 0.578125 0.484375 
+0.4375 0.59375 0.484375 
+0.453125 0.59375 0.46875 
+0.453125 0.59375 0.5 
+0.453125 0.59375 0.484375 
+0.453125 0.609375 0.484375 
+0.46875 0.609375 0.5 
+0.46875 0.609375 0.484375 
+0.4375 0.59375 0.453125 
+0.53125 0.515625 0.390625 
+0.546875 0.515625 0.390625 
+0.5625 0.515625 0.40625 
+0.546875 0.515625 0.40625 
+0.546875 0.53125 0.40625 
+0.5625 0.515625 0.421875 
+0.5625 0.53125 0.421875 
+0.5625 0.546875 0.421875 
+0.578125 0.515625 0.421875 
+0.578125 0.515625 0.4375 
+0.59375 0.515625 0.4375 
+0.578125 0.53125 0.4375 
+0.578125 0.546875 0.421875 
+0.578125 0.546875 0.4375 
+0.578125 0.5625 0.4375 
+0.59375 0.546875 0.4375 
+0.59375 0.515625 0.453125 
+0.609375 0.515625 0.453125 
+0.609375 0.515625 0.46875 
+0.609375 0.53125 0.46875 
+0.625 0.53125 0.484375 
+0.59375 0.53125 0.453125 
+0.609375 0.546875 0.453125 
+0.609375 0.546875 0.46875 
+0.625 0.5625 0.484375 
+0.59375 0.5625 0.453125 
+0.59375 0.546875 0.453125 
+0.609375 0.5625 0.46875 
+0.5625 0.546875 0.40625 
+0.546875 0.546875 0.40625 
+0.5625 0.5625 0.421875 
+0.515625 0.53125 0.390625 
+0.515625 0.546875 0.390625 
+0.515625 0.5625 0.40625 
+0.515625 0.546875 0.40625 
+0.53125 0.546875 0.40625 
+0.515625 0.5625 0.421875 
+0.53125 0.5625 0.421875 
+0.546875 0.5625 0.421875 
+0.515625 0.578125 0.421875 
+0.515625 0.578125 0.4375 
+0.515625 0.59375 0.4375 
+0.53125 0.578125 0.4375 
+0.546875 0.578125 0.421875 
+0.546875 0.578125 0.4375 
+0.5625 0.578125 0.4375 
+0.546875 0.59375 0.4375 
+0.515625 0.59375 0.453125 
+0.515625 0.609375 0.453125 
+0.515625 0.609375 0.46875 
+0.53125 0.609375 0.46875 
+0.53125 0.625 0.484375 
+0.53125 0.59375 0.453125 
+0.546875 0.609375 0.453125 
+0.546875 0.609375 0.46875 
+0.5625 0.625 0.484375 
+0.5625 0.59375 0.453125 
+0.546875 0.59375 0.453125 
+0.5625 0.609375 0.46875 
+0.546875 0.5625 0.40625 
+0.4375 0.375 0.515625 
+0.4375 0.390625 0.53125 
+0.4375 0.40625 0.546875 
+0.4375 0.421875 0.5625 
+0.46875 0.375 0.515625 
+0.46875 0.390625 0.53125 
+0.5 0.375 0.515625 
+0.5 0.390625 0.53125 
+0.484375 0.390625 0.53125 
+0.484375 0.390625 0.546875 
+0.5 0.40625 0.546875 
+0.484375 0.40625 0.546875 
+0.5 0.421875 0.5625 
+0.453125 0.390625 0.53125 
+0.453125 0.390625 0.546875 
+0.46875 0.40625 0.546875 
+0.484375 0.40625 0.5625 
+0.484375 0.421875 0.5625 
+0.453125 0.40625 0.5625 
+0.453125 0.40625 0.546875 
+0.453125 0.421875 0.5625 
+0.46875 0.421875 0.5625 
+0.484375 0.421875 0.578125 
+0.5 0.4375 0.578125 
+0.453125 0.421875 0.578125 
+0.453125 0.4375 0.578125 
+0.46875 0.4375 0.578125 
+0.484375 0.4375 0.578125 
+0.484375 0.4375 0.59375 
+0.46875 0.453125 0.59375 
+0.5 0.453125 0.59375 
+0.484375 0.453125 0.59375 
+0.484375 0.453125 0.609375 
+0.5 0.46875 0.609375 
+0.484375 0.46875 0.609375 
+0.5 0.484375 0.625 
+0.4375 0.4375 0.578125 
+0.453125 0.4375 0.59375 
+0.453125 0.453125 0.59375 
+0.375 0.4375 0.515625 
+0.390625 0.4375 0.53125 
+0.40625 0.4375 0.546875 
+0.421875 0.4375 0.5625 
+0.375 0.46875 0.515625 
+0.390625 0.46875 0.53125 
+0.375 0.5 0.515625 
+0.390625 0.5 0.53125 
+0.390625 0.484375 0.53125 
+0.390625 0.484375 0.546875 
+0.40625 0.5 0.546875 
+0.40625 0.484375 0.546875 
+0.421875 0.5 0.5625 
+0.390625 0.453125 0.53125 
+0.390625 0.453125 0.546875 
+0.40625 0.46875 0.546875 
+0.40625 0.484375 0.5625 
+0.421875 0.484375 0.5625 
+0.40625 0.453125 0.5625 
+0.40625 0.453125 0.546875 
+0.421875 0.453125 0.5625 
+0.421875 0.46875 0.5625 
+0.421875 0.484375 0.578125 
+0.4375 0.5 0.578125 
+0.421875 0.453125 0.578125 
+0.4375 0.453125 0.578125 
+0.4375 0.46875 0.578125 
+0.4375 0.484375 0.578125 
+0.4375 0.484375 0.59375 
+0.453125 0.46875 0.59375 
+0.453125 0.5 0.59375 
+0.453125 0.484375 0.59375 
+0.453125 0.484375 0.609375 
+0.46875 0.5 0.609375 
+0.46875 0.484375 0.609375 
+0.4375 0.453125 0.59375 
+0.53125 0.390625 0.515625 
+0.546875 0.390625 0.515625 
+0.5625 0.40625 0.515625 
+0.546875 0.40625 0.515625 
+0.546875 0.40625 0.53125 
+0.5625 0.421875 0.515625 
+0.5625 0.421875 0.53125 
+0.5625 0.421875 0.546875 
+0.578125 0.421875 0.515625 
+0.578125 0.4375 0.515625 
+0.59375 0.4375 0.515625 
+0.578125 0.4375 0.53125 
+0.578125 0.421875 0.546875 
+0.578125 0.4375 0.546875 
+0.578125 0.4375 0.5625 
+0.59375 0.4375 0.546875 
+0.59375 0.453125 0.515625 
+0.609375 0.453125 0.515625 
+0.609375 0.46875 0.515625 
+0.609375 0.46875 0.53125 
+0.625 0.484375 0.53125 
+0.59375 0.453125 0.53125 
+0.609375 0.453125 0.546875 
+0.609375 0.46875 0.546875 
+0.625 0.484375 0.5625 
+0.59375 0.453125 0.5625 
+0.59375 0.453125 0.546875 
+0.609375 0.46875 0.5625 
+0.5625 0.40625 0.546875 
+0.546875 0.40625 0.546875 
+0.5625 0.421875 0.5625 
+0.515625 0.390625 0.53125 
+0.515625 0.390625 0.546875 
+0.515625 0.40625 0.5625 
+0.515625 0.40625 0.546875 
+0.53125 0.40625 0.546875 
+0.515625 0.421875 0.5625 
+0.53125 0.421875 0.5625 
+0.546875 0.421875 0.5625 
+0.515625 0.421875 0.578125 
+0.515625 0.4375 0.578125 
+0.515625 0.4375 0.59375 
+0.53125 0.4375 0.578125 
+0.546875 0.421875 0.578125 
+0.546875 0.4375 0.578125 
+0.5625 0.4375 0.578125 
+0.546875 0.4375 0.59375 
+0.515625 0.453125 0.59375 
+0.515625 0.453125 0.609375 
+0.515625 0.46875 0.609375 
+0.53125 0.46875 0.609375 
+0.53125 0.484375 0.625 
+0.53125 0.453125 0.59375 
+0.546875 0.453125 0.609375 
+0.546875 0.46875 0.609375 
+0.5625 0.484375 0.625 
+0.5625 0.453125 0.59375 
+0.546875 0.453125 0.59375 
+0.5625 0.46875 0.609375 
+0.546875 0.40625 0.5625 
+0.390625 0.53125 0.515625 
+0.390625 0.546875 0.515625 
+0.40625 0.5625 0.515625 
+0.40625 0.546875 0.515625 
+0.40625 0.546875 0.53125 
+0.421875 0.5625 0.515625 
+0.421875 0.5625 0.53125 
+0.421875 0.5625 0.546875 
+0.421875 0.578125 0.515625 
+0.4375 0.578125 0.515625 
+0.4375 0.59375 0.515625 
+0.4375 0.578125 0.53125 
+0.4375 0.578125 0.546875 
+0.4375 0.59375 0.546875 
+0.453125 0.59375 0.515625 
+0.453125 0.609375 0.515625 
+0.46875 0.609375 0.515625 
+0.46875 0.609375 0.53125 
+0.453125 0.59375 0.53125 
+0.453125 0.609375 0.546875 
+0.46875 0.609375 0.546875 
+0.453125 0.59375 0.546875 
+0.40625 0.546875 0.546875 
+0.390625 0.515625 0.53125 
+0.390625 0.515625 0.546875 
+0.40625 0.515625 0.5625 
+0.40625 0.515625 0.546875 
+0.40625 0.53125 0.546875 
+0.421875 0.515625 0.5625 
+0.421875 0.53125 0.5625 
+0.421875 0.546875 0.5625 
+0.4375 0.515625 0.578125 
+0.4375 0.53125 0.578125 
+0.4375 0.546875 0.578125 
+0.4375 0.546875 0.59375 
+0.453125 0.515625 0.59375 
+0.453125 0.515625 0.609375 
+0.46875 0.515625 0.609375 
+0.46875 0.53125 0.609375 
+0.453125 0.53125 0.59375 
+0.453125 0.546875 0.609375 
+0.46875 0.546875 0.609375 
+0.453125 0.546875 0.59375 
+0.515625 0.515625 0.515625 
+0.53125 0.515625 0.515625 
+0.53125 0.53125 0.515625 
+0.546875 0.515625 0.515625 
+0.5625 0.515625 0.515625 
+0.5625 0.53125 0.515625 
+0.546875 0.53125 0.515625 
+0.546875 0.53125 0.53125 
+0.546875 0.546875 0.515625 
+0.5625 0.546875 0.515625 
+0.5625 0.5625 0.515625 
+0.5625 0.546875 0.53125 
+0.546875 0.546875 0.53125 
+0.546875 0.546875 0.546875 
+0.5625 0.546875 0.546875 
+0.578125 0.515625 0.515625 
+0.59375 0.515625 0.515625 
+0.59375 0.53125 0.515625 
+0.609375 0.515625 0.515625 
+0.609375 0.53125 0.515625 
+0.609375 0.53125 0.53125 
+0.609375 0.546875 0.515625 
+0.578125 0.53125 0.515625 
+0.578125 0.546875 0.515625 
+0.578125 0.5625 0.515625 
+0.59375 0.5625 0.515625 
+0.59375 0.546875 0.515625 
+0.59375 0.546875 0.53125 
+0.609375 0.5625 0.515625 
+0.609375 0.5625 0.53125 
+0.578125 0.53125 0.53125 
+0.578125 0.546875 0.53125 
+0.578125 0.578125 0.515625 
+0.59375 0.578125 0.515625 
+0.59375 0.59375 0.515625 
+0.53125 0.515625 0.53125 
+0.5625 0.515625 0.53125 
+0.546875 0.515625 0.53125 
+0.546875 0.515625 0.546875 
+0.5625 0.515625 0.546875 
+0.5625 0.515625 0.5625 
+0.5625 0.53125 0.546875 
+0.546875 0.53125 0.546875 
+0.59375 0.515625 0.53125 
+0.609375 0.515625 0.53125 
+0.609375 0.515625 0.546875 
+0.578125 0.515625 0.53125 
+0.578125 0.515625 0.546875 
+0.578125 0.515625 0.5625 
+0.59375 0.515625 0.5625 
+0.59375 0.515625 0.546875 
+0.59375 0.53125 0.546875 
+0.609375 0.515625 0.5625 
+0.609375 0.53125 0.5625 
+0.578125 0.53125 0.546875 
+0.578125 0.515625 0.578125 
+0.59375 0.515625 0.578125 
+0.59375 0.515625 0.59375 
+0.515625 0.53125 0.515625 
+0.515625 0.546875 0.515625 
+0.515625 0.5625 0.515625 
+0.53125 0.5625 0.515625 
+0.53125 0.546875 0.515625 
+0.53125 0.546875 0.53125 
+0.546875 0.5625 0.515625 
+0.546875 0.5625 0.53125 
+0.546875 0.5625 0.546875 
+0.515625 0.578125 0.515625 
+0.515625 0.59375 0.515625 
+0.53125 0.59375 0.515625 
+0.515625 0.609375 0.515625 
+0.53125 0.609375 0.515625 
+0.53125 0.609375 0.53125 
+0.546875 0.609375 0.515625 
+0.53125 0.578125 0.515625 
+0.546875 0.578125 0.515625 
+0.5625 0.578125 0.515625 
+0.5625 0.59375 0.515625 
+0.546875 0.59375 0.515625 
+0.546875 0.59375 0.53125 
+0.5625 0.609375 0.515625 
+0.5625 0.609375 0.53125 
+0.53125 0.578125 0.53125 
+0.546875 0.578125 0.53125 
+0.578125 0.59375 0.515625 
+0.515625 0.53125 0.53125 
+0.515625 0.5625 0.53125 
+0.515625 0.546875 0.53125 
+0.515625 0.546875 0.546875 
+0.515625 0.5625 0.546875 
+0.515625 0.5625 0.5625 
+0.53125 0.5625 0.546875 
+0.53125 0.546875 0.546875 
+0.515625 0.59375 0.53125 
+0.515625 0.609375 0.53125 
+0.515625 0.609375 0.546875 
+0.515625 0.578125 0.53125 
+0.515625 0.578125 0.546875 
+0.515625 0.578125 0.5625 
+0.515625 0.59375 0.5625 
+0.515625 0.59375 0.546875 
+0.53125 0.59375 0.546875 
+0.515625 0.609375 0.5625 
+0.53125 0.609375 0.5625 
+0.53125 0.578125 0.546875 
+0.515625 0.578125 0.578125 
+0.515625 0.59375 0.578125 
+0.515625 0.59375 0.59375 
+0.515625 0.515625 0.53125 
+0.515625 0.515625 0.546875 
+0.515625 0.515625 0.5625 
+0.53125 0.515625 0.5625 
+0.53125 0.515625 0.546875 
+0.53125 0.53125 0.546875 
+0.546875 0.515625 0.5625 
+0.546875 0.53125 0.5625 
+0.546875 0.546875 0.5625 
+0.515625 0.515625 0.578125 
+0.515625 0.515625 0.59375 
+0.53125 0.515625 0.59375 
+0.515625 0.515625 0.609375 
+0.53125 0.515625 0.625 
+0.53125 0.515625 0.609375 
+0.53125 0.53125 0.609375 
+0.546875 0.515625 0.609375 
+0.5625 0.515625 0.625 
+0.53125 0.515625 0.578125 
+0.546875 0.515625 0.578125 
+0.5625 0.515625 0.578125 
+0.5625 0.515625 0.59375 
+0.546875 0.515625 0.59375 
+0.546875 0.53125 0.59375 
+0.5625 0.515625 0.609375 
+0.5625 0.53125 0.609375 
+0.53125 0.53125 0.578125 
+0.546875 0.53125 0.578125 
+0.578125 0.515625 0.59375 
+0.515625 0.53125 0.5625 
+0.515625 0.53125 0.546875 
+0.515625 0.546875 0.5625 
+0.53125 0.546875 0.5625 
+0.515625 0.53125 0.59375 
+0.515625 0.53125 0.625 
+0.515625 0.53125 0.609375 
+0.515625 0.546875 0.609375 
+0.515625 0.5625 0.625 
+0.515625 0.53125 0.578125 
+0.515625 0.546875 0.578125 
+0.515625 0.5625 0.578125 
+0.515625 0.5625 0.59375 
+0.515625 0.546875 0.59375 
+0.53125 0.546875 0.59375 
+0.515625 0.5625 0.609375 
+0.53125 0.5625 0.609375 
+0.53125 0.5625 0.578125 
+0.53125 0.546875 0.578125 
+0.515625 0.578125 0.59375 
+0.53125 0.578125 0.59375 
+0.453125 0.59375 0.5625 
+0.46875 0.609375 0.5625 
+0.40625 0.5625 0.546875 
+0.421875 0.578125 0.546875 
+0.421875 0.5625 0.5625 
+0.4375 0.578125 0.5625 
+0.484375 0.625 0.5 
+0.484375 0.625 0.53125 
+0.484375 0.625 0.5625 
+0.421875 0.515625 0.578125 
+0.4375 0.515625 0.59375 
+0.453125 0.5625 0.59375 
+0.46875 0.5625 0.609375 
+0.40625 0.546875 0.5625 
+0.421875 0.546875 0.578125 
+0.4375 0.5625 0.578125 
+0.484375 0.5 0.625 
+0.484375 0.53125 0.625 
+0.484375 0.5625 0.625 
+0.5625 0.5625 0.546875 
+0.578125 0.5625 0.53125 
+0.59375 0.578125 0.53125 
+0.625 0.53125 0.515625 
+0.625 0.5625 0.515625 
+0.5625 0.546875 0.5625 
+0.578125 0.53125 0.5625 
+0.59375 0.53125 0.578125 
+0.625 0.515625 0.53125 
+0.625 0.515625 0.5625 
+0.5625 0.578125 0.53125 
+0.578125 0.59375 0.53125 
+0.53125 0.625 0.515625 
+0.5625 0.625 0.515625 
+0.546875 0.5625 0.5625 
+0.53125 0.578125 0.5625 
+0.53125 0.59375 0.578125 
+0.515625 0.625 0.53125 
+0.515625 0.625 0.5625 
+0.5625 0.53125 0.578125 
+0.578125 0.53125 0.59375 
+0.5 0.476562 0.40625 
+0.5 0.476562 0.414062 
+0.5 0.484375 0.414062 
+0.507812 0.476562 0.414062 
+0.507812 0.484375 0.414062 
+0.507812 0.484375 0.421875 
+0.5 0.492188 0.40625 
+0.5 0.492188 0.414062 
+0.5 0.5 0.414062 
+0.507812 0.492188 0.414062 
+0.507812 0.5 0.414062 
+0.507812 0.5 0.421875 
+0.5 0.492188 0.421875 
+0.507812 0.492188 0.421875 
+0.515625 0.492188 0.421875 
+0.5 0.492188 0.429688 
+0.5 0.5 0.429688 
+0.507812 0.492188 0.429688 
+0.507812 0.5 0.429688 
+0.507812 0.5 0.4375 
+0.515625 0.5 0.429688 
+0.515625 0.492188 0.429688 
+0.523438 0.492188 0.429688 
+0.523438 0.5 0.429688 
+0.523438 0.5 0.4375 
+0.507812 0.476562 0.40625 
+0.507812 0.484375 0.40625 
+0.515625 0.484375 0.414062 
+0.507812 0.492188 0.40625 
+0.507812 0.5 0.40625 
+0.515625 0.5 0.414062 
+0.515625 0.492188 0.40625 
+0.515625 0.492188 0.414062 
+0.523438 0.492188 0.40625 
+0.523438 0.5 0.40625 
+0.523438 0.492188 0.414062 
+0.523438 0.5 0.414062 
+0.53125 0.5 0.414062 
+0.523438 0.5 0.421875 
+0.523438 0.492188 0.421875 
+0.53125 0.5 0.429688 
+0.507812 0.46875 0.40625 
+0.515625 0.476562 0.40625 
+0.515625 0.476562 0.414062 
+0.523438 0.46875 0.40625 
+0.523438 0.476562 0.40625 
+0.53125 0.476562 0.40625 
+0.523438 0.476562 0.414062 
+0.53125 0.476562 0.414062 
+0.53125 0.484375 0.414062 
+0.523438 0.484375 0.40625 
+0.523438 0.484375 0.414062 
+0.523438 0.484375 0.421875 
+0.53125 0.492188 0.40625 
+0.53125 0.492188 0.414062 
+0.53125 0.492188 0.421875 
+0.53125 0.492188 0.429688 
+0.539062 0.476562 0.414062 
+0.539062 0.484375 0.414062 
+0.539062 0.484375 0.421875 
+0.539062 0.492188 0.414062 
+0.539062 0.5 0.414062 
+0.539062 0.5 0.421875 
+0.539062 0.492188 0.421875 
+0.546875 0.492188 0.421875 
+0.539062 0.492188 0.429688 
+0.539062 0.5 0.429688 
+0.539062 0.5 0.4375 
+0.546875 0.5 0.429688 
+0.546875 0.492188 0.429688 
+0.554688 0.492188 0.429688 
+0.554688 0.5 0.429688 
+0.554688 0.5 0.4375 
+0.5 0.4375 0.414062 
+0.5 0.445312 0.414062 
+0.5 0.445312 0.421875 
+0.507812 0.445312 0.414062 
+0.507812 0.445312 0.421875 
+0.507812 0.453125 0.421875 
+0.5 0.4375 0.429688 
+0.5 0.445312 0.429688 
+0.5 0.445312 0.4375 
+0.507812 0.445312 0.429688 
+0.507812 0.445312 0.4375 
+0.507812 0.453125 0.4375 
+0.5 0.453125 0.429688 
+0.507812 0.453125 0.429688 
+0.515625 0.453125 0.429688 
+0.5 0.460938 0.429688 
+0.5 0.460938 0.4375 
+0.507812 0.460938 0.429688 
+0.507812 0.460938 0.4375 
+0.507812 0.46875 0.4375 
+0.515625 0.460938 0.4375 
+0.515625 0.460938 0.429688 
+0.523438 0.460938 0.429688 
+0.523438 0.460938 0.4375 
+0.523438 0.46875 0.4375 
+0.5 0.445312 0.40625 
+0.5 0.453125 0.414062 
+0.507812 0.453125 0.414062 
+0.5 0.460938 0.40625 
+0.5 0.460938 0.414062 
+0.5 0.46875 0.414062 
+0.507812 0.460938 0.414062 
+0.507812 0.46875 0.414062 
+0.507812 0.46875 0.421875 
+0.5 0.460938 0.421875 
+0.507812 0.460938 0.421875 
+0.515625 0.460938 0.421875 
+0.5 0.46875 0.429688 
+0.507812 0.46875 0.429688 
+0.515625 0.46875 0.429688 
+0.523438 0.46875 0.429688 
+0.507812 0.453125 0.40625 
+0.515625 0.453125 0.414062 
+0.507812 0.460938 0.40625 
+0.515625 0.46875 0.414062 
+0.515625 0.460938 0.40625 
+0.515625 0.460938 0.414062 
+0.523438 0.460938 0.40625 
+0.523438 0.460938 0.414062 
+0.523438 0.46875 0.414062 
+0.53125 0.46875 0.414062 
+0.523438 0.46875 0.421875 
+0.523438 0.460938 0.421875 
+0.53125 0.46875 0.429688 
+0.5 0.476562 0.421875 
+0.507812 0.476562 0.421875 
+0.5 0.476562 0.429688 
+0.5 0.476562 0.4375 
+0.507812 0.476562 0.429688 
+0.507812 0.476562 0.4375 
+0.507812 0.484375 0.4375 
+0.5 0.484375 0.429688 
+0.507812 0.484375 0.429688 
+0.515625 0.484375 0.429688 
+0.5 0.492188 0.4375 
+0.507812 0.492188 0.4375 
+0.515625 0.492188 0.4375 
+0.523438 0.492188 0.4375 
+0.515625 0.476562 0.421875 
+0.515625 0.476562 0.4375 
+0.515625 0.476562 0.429688 
+0.523438 0.476562 0.429688 
+0.523438 0.476562 0.4375 
+0.53125 0.476562 0.4375 
+0.523438 0.484375 0.4375 
+0.523438 0.484375 0.429688 
+0.53125 0.492188 0.4375 
+0.53125 0.476562 0.421875 
+0.523438 0.476562 0.421875 
+0.53125 0.476562 0.429688 
+0.53125 0.484375 0.429688 
+0.539062 0.476562 0.421875 
+0.539062 0.476562 0.429688 
+0.539062 0.476562 0.4375 
+0.539062 0.484375 0.4375 
+0.539062 0.484375 0.429688 
+0.546875 0.484375 0.429688 
+0.539062 0.492188 0.4375 
+0.546875 0.492188 0.4375 
+0.554688 0.492188 0.4375 
+0.507812 0.4375 0.421875 
+0.515625 0.445312 0.421875 
+0.507812 0.4375 0.429688 
+0.507812 0.4375 0.4375 
+0.515625 0.445312 0.4375 
+0.515625 0.4375 0.429688 
+0.515625 0.445312 0.429688 
+0.523438 0.4375 0.429688 
+0.523438 0.4375 0.4375 
+0.523438 0.445312 0.429688 
+0.523438 0.445312 0.4375 
+0.53125 0.445312 0.4375 
+0.523438 0.453125 0.4375 
+0.523438 0.453125 0.429688 
+0.53125 0.460938 0.4375 
+0.53125 0.445312 0.421875 
+0.523438 0.4375 0.421875 
+0.523438 0.445312 0.421875 
+0.523438 0.453125 0.421875 
+0.53125 0.4375 0.429688 
+0.53125 0.445312 0.429688 
+0.53125 0.453125 0.429688 
+0.53125 0.460938 0.429688 
+0.53125 0.453125 0.414062 
+0.53125 0.460938 0.40625 
+0.53125 0.460938 0.414062 
+0.53125 0.460938 0.421875 
+0.539062 0.4375 0.4375 
+0.539062 0.445312 0.429688 
+0.539062 0.445312 0.4375 
+0.546875 0.445312 0.4375 
+0.546875 0.453125 0.429688 
+0.554688 0.453125 0.4375 
+0.554688 0.460938 0.429688 
+0.554688 0.460938 0.4375 
+0.5625 0.460938 0.4375 
+0.539062 0.445312 0.421875 
+0.539062 0.453125 0.421875 
+0.539062 0.453125 0.4375 
+0.539062 0.453125 0.429688 
+0.539062 0.460938 0.429688 
+0.539062 0.460938 0.4375 
+0.539062 0.46875 0.4375 
+0.546875 0.460938 0.4375 
+0.546875 0.460938 0.429688 
+0.554688 0.46875 0.4375 
+0.539062 0.460938 0.414062 
+0.539062 0.46875 0.414062 
+0.539062 0.46875 0.421875 
+0.539062 0.460938 0.421875 
+0.546875 0.460938 0.421875 
+0.539062 0.46875 0.429688 
+0.546875 0.46875 0.429688 
+0.476562 0.53125 0.453125 
+0.476562 0.53125 0.460938 
+0.484375 0.53125 0.460938 
+0.476562 0.539062 0.460938 
+0.484375 0.539062 0.460938 
+0.484375 0.539062 0.46875 
+0.476562 0.539062 0.453125 
+0.484375 0.539062 0.453125 
+0.484375 0.546875 0.460938 
+0.492188 0.53125 0.460938 
+0.492188 0.53125 0.46875 
+0.492188 0.539062 0.460938 
+0.492188 0.539062 0.46875 
+0.5 0.539062 0.46875 
+0.492188 0.546875 0.46875 
+0.492188 0.546875 0.460938 
+0.492188 0.554688 0.460938 
+0.492188 0.554688 0.46875 
+0.5 0.554688 0.46875 
+0.476562 0.53125 0.46875 
+0.476562 0.539062 0.46875 
+0.476562 0.539062 0.476562 
+0.484375 0.539062 0.476562 
+0.484375 0.546875 0.476562 
+0.492188 0.539062 0.476562 
+0.5 0.539062 0.476562 
+0.5 0.546875 0.476562 
+0.492188 0.546875 0.476562 
+0.492188 0.546875 0.484375 
+0.492188 0.554688 0.476562 
+0.5 0.554688 0.476562 
+0.5 0.5625 0.476562 
+0.5 0.554688 0.484375 
+0.492188 0.554688 0.484375 
+0.492188 0.554688 0.492188 
+0.5 0.554688 0.492188 
+0.5 0.5625 0.492188 
+0.4375 0.507812 0.4375 
+0.445312 0.507812 0.4375 
+0.445312 0.515625 0.4375 
+0.445312 0.507812 0.445312 
+0.445312 0.515625 0.445312 
+0.453125 0.515625 0.445312 
+0.4375 0.523438 0.4375 
+0.445312 0.523438 0.4375 
+0.445312 0.53125 0.4375 
+0.445312 0.523438 0.445312 
+0.445312 0.53125 0.445312 
+0.453125 0.53125 0.445312 
+0.453125 0.523438 0.4375 
+0.453125 0.523438 0.445312 
+0.453125 0.523438 0.453125 
+0.460938 0.523438 0.4375 
+0.460938 0.53125 0.4375 
+0.460938 0.523438 0.445312 
+0.460938 0.53125 0.445312 
+0.46875 0.53125 0.445312 
+0.460938 0.53125 0.453125 
+0.460938 0.523438 0.453125 
+0.460938 0.523438 0.460938 
+0.460938 0.53125 0.460938 
+0.46875 0.53125 0.460938 
+0.4375 0.539062 0.4375 
+0.445312 0.539062 0.4375 
+0.445312 0.546875 0.4375 
+0.445312 0.539062 0.445312 
+0.445312 0.546875 0.445312 
+0.453125 0.546875 0.445312 
+0.4375 0.554688 0.4375 
+0.445312 0.554688 0.4375 
+0.445312 0.5625 0.4375 
+0.445312 0.554688 0.445312 
+0.445312 0.5625 0.445312 
+0.453125 0.5625 0.445312 
+0.453125 0.554688 0.4375 
+0.453125 0.554688 0.445312 
+0.453125 0.554688 0.453125 
+0.460938 0.554688 0.4375 
+0.460938 0.5625 0.4375 
+0.460938 0.554688 0.445312 
+0.460938 0.5625 0.445312 
+0.46875 0.5625 0.445312 
+0.460938 0.5625 0.453125 
+0.460938 0.554688 0.453125 
+0.460938 0.554688 0.460938 
+0.460938 0.5625 0.460938 
+0.46875 0.5625 0.460938 
+0.453125 0.539062 0.4375 
+0.453125 0.539062 0.445312 
+0.460938 0.539062 0.4375 
+0.46875 0.539062 0.4375 
+0.460938 0.539062 0.445312 
+0.46875 0.539062 0.445312 
+0.46875 0.546875 0.445312 
+0.460938 0.546875 0.4375 
+0.460938 0.546875 0.445312 
+0.460938 0.546875 0.453125 
+0.46875 0.554688 0.4375 
+0.46875 0.554688 0.445312 
+0.46875 0.554688 0.453125 
+0.46875 0.554688 0.460938 
+0.453125 0.539062 0.453125 
+0.46875 0.539062 0.453125 
+0.460938 0.539062 0.453125 
+0.460938 0.539062 0.460938 
+0.46875 0.539062 0.460938 
+0.46875 0.539062 0.46875 
+0.46875 0.546875 0.460938 
+0.460938 0.546875 0.460938 
+0.46875 0.554688 0.46875 
+0.476562 0.539062 0.4375 
+0.476562 0.546875 0.4375 
+0.476562 0.539062 0.445312 
+0.476562 0.546875 0.445312 
+0.484375 0.546875 0.445312 
+0.476562 0.554688 0.4375 
+0.476562 0.5625 0.4375 
+0.476562 0.554688 0.445312 
+0.476562 0.5625 0.445312 
+0.484375 0.5625 0.445312 
+0.484375 0.554688 0.4375 
+0.484375 0.554688 0.445312 
+0.484375 0.554688 0.453125 
+0.492188 0.554688 0.4375 
+0.492188 0.5625 0.4375 
+0.492188 0.554688 0.445312 
+0.492188 0.5625 0.445312 
+0.5 0.5625 0.445312 
+0.492188 0.5625 0.453125 
+0.492188 0.554688 0.453125 
+0.492188 0.5625 0.460938 
+0.5 0.5625 0.460938 
+0.476562 0.546875 0.453125 
+0.476562 0.5625 0.453125 
+0.476562 0.554688 0.453125 
+0.476562 0.554688 0.460938 
+0.476562 0.5625 0.460938 
+0.476562 0.5625 0.46875 
+0.484375 0.5625 0.460938 
+0.484375 0.554688 0.460938 
+0.492188 0.5625 0.46875 
+0.476562 0.546875 0.46875 
+0.476562 0.546875 0.460938 
+0.476562 0.554688 0.46875 
+0.484375 0.554688 0.46875 
+0.476562 0.546875 0.476562 
+0.476562 0.554688 0.476562 
+0.476562 0.5625 0.476562 
+0.484375 0.5625 0.476562 
+0.484375 0.554688 0.476562 
+0.484375 0.554688 0.484375 
+0.492188 0.5625 0.476562 
+0.492188 0.5625 0.484375 
+0.492188 0.5625 0.492188 
+0.445312 0.570312 0.445312 
+0.453125 0.570312 0.445312 
+0.453125 0.570312 0.453125 
+0.460938 0.570312 0.445312 
+0.46875 0.570312 0.445312 
+0.46875 0.570312 0.453125 
+0.460938 0.570312 0.453125 
+0.460938 0.578125 0.453125 
+0.460938 0.570312 0.460938 
+0.46875 0.570312 0.460938 
+0.46875 0.570312 0.46875 
+0.46875 0.578125 0.460938 
+0.460938 0.578125 0.460938 
+0.460938 0.585938 0.460938 
+0.46875 0.585938 0.460938 
+0.46875 0.585938 0.46875 
+0.476562 0.570312 0.445312 
+0.484375 0.570312 0.445312 
+0.484375 0.570312 0.453125 
+0.492188 0.570312 0.445312 
+0.5 0.570312 0.445312 
+0.5 0.570312 0.453125 
+0.492188 0.570312 0.453125 
+0.492188 0.578125 0.453125 
+0.492188 0.570312 0.460938 
+0.5 0.570312 0.460938 
+0.5 0.570312 0.46875 
+0.5 0.578125 0.460938 
+0.492188 0.578125 0.460938 
+0.492188 0.585938 0.460938 
+0.5 0.585938 0.460938 
+0.5 0.585938 0.46875 
+0.476562 0.570312 0.453125 
+0.476562 0.570312 0.460938 
+0.476562 0.570312 0.46875 
+0.484375 0.570312 0.46875 
+0.484375 0.570312 0.460938 
+0.484375 0.578125 0.460938 
+0.492188 0.570312 0.46875 
+0.492188 0.578125 0.46875 
+0.492188 0.585938 0.46875 
+0.476562 0.578125 0.453125 
+0.476562 0.578125 0.46875 
+0.476562 0.578125 0.460938 
+0.476562 0.585938 0.460938 
+0.476562 0.585938 0.46875 
+0.476562 0.59375 0.46875 
+0.484375 0.585938 0.46875 
+0.484375 0.585938 0.460938 
+0.492188 0.59375 0.46875 
+0.476562 0.570312 0.476562 
+0.484375 0.570312 0.476562 
+0.484375 0.570312 0.484375 
+0.492188 0.570312 0.476562 
+0.5 0.570312 0.476562 
+0.5 0.570312 0.484375 
+0.492188 0.570312 0.484375 
+0.492188 0.578125 0.484375 
+0.492188 0.570312 0.492188 
+0.5 0.570312 0.492188 
+0.5 0.570312 0.5 
+0.5 0.578125 0.492188 
+0.492188 0.578125 0.492188 
+0.492188 0.585938 0.492188 
+0.5 0.585938 0.492188 
+0.5 0.585938 0.5 
+0.484375 0.578125 0.476562 
+0.5 0.578125 0.476562 
+0.492188 0.578125 0.476562 
+0.492188 0.585938 0.476562 
+0.5 0.585938 0.476562 
+0.5 0.59375 0.476562 
+0.5 0.585938 0.484375 
+0.492188 0.585938 0.484375 
+0.5 0.59375 0.492188 
+0.476562 0.578125 0.476562 
+0.476562 0.585938 0.476562 
+0.476562 0.59375 0.476562 
+0.484375 0.59375 0.476562 
+0.554688 0.46875 0.429688 
+0.546875 0.476562 0.421875 
+0.546875 0.476562 0.4375 
+0.546875 0.476562 0.429688 
+0.554688 0.476562 0.429688 
+0.554688 0.476562 0.4375 
+0.5625 0.476562 0.4375 
+0.554688 0.484375 0.4375 
+0.554688 0.484375 0.429688 
+0.5625 0.492188 0.4375 
+0.5 0.445312 0.445312 
+0.5 0.453125 0.445312 
+0.507812 0.445312 0.445312 
+0.507812 0.453125 0.445312 
+0.507812 0.453125 0.453125 
+0.5 0.460938 0.445312 
+0.5 0.46875 0.445312 
+0.507812 0.460938 0.445312 
+0.507812 0.46875 0.445312 
+0.507812 0.46875 0.453125 
+0.5 0.460938 0.453125 
+0.507812 0.460938 0.453125 
+0.515625 0.460938 0.453125 
+0.5 0.460938 0.460938 
+0.5 0.46875 0.460938 
+0.507812 0.460938 0.460938 
+0.507812 0.46875 0.460938 
+0.507812 0.46875 0.46875 
+0.515625 0.46875 0.460938 
+0.515625 0.460938 0.460938 
+0.523438 0.460938 0.460938 
+0.523438 0.46875 0.460938 
+0.523438 0.46875 0.46875 
+0.5 0.476562 0.445312 
+0.5 0.484375 0.445312 
+0.507812 0.476562 0.445312 
+0.507812 0.484375 0.445312 
+0.507812 0.484375 0.453125 
+0.5 0.492188 0.445312 
+0.5 0.5 0.445312 
+0.507812 0.492188 0.445312 
+0.507812 0.5 0.445312 
+0.507812 0.5 0.453125 
+0.5 0.492188 0.453125 
+0.507812 0.492188 0.453125 
+0.515625 0.492188 0.453125 
+0.5 0.492188 0.460938 
+0.5 0.5 0.460938 
+0.507812 0.492188 0.460938 
+0.507812 0.5 0.460938 
+0.507812 0.5 0.46875 
+0.515625 0.5 0.460938 
+0.515625 0.492188 0.460938 
+0.523438 0.492188 0.460938 
+0.523438 0.5 0.460938 
+0.523438 0.5 0.46875 
+0.5 0.476562 0.453125 
+0.507812 0.476562 0.453125 
+0.5 0.476562 0.460938 
+0.5 0.476562 0.46875 
+0.507812 0.476562 0.460938 
+0.507812 0.476562 0.46875 
+0.507812 0.484375 0.46875 
+0.5 0.484375 0.460938 
+0.507812 0.484375 0.460938 
+0.515625 0.484375 0.460938 
+0.5 0.492188 0.46875 
+0.507812 0.492188 0.46875 
+0.515625 0.492188 0.46875 
+0.523438 0.492188 0.46875 
+0.515625 0.476562 0.453125 
+0.515625 0.476562 0.46875 
+0.515625 0.476562 0.460938 
+0.523438 0.476562 0.460938 
+0.523438 0.476562 0.46875 
+0.53125 0.476562 0.46875 
+0.523438 0.484375 0.46875 
+0.523438 0.484375 0.460938 
+0.53125 0.492188 0.46875 
+0.5 0.476562 0.476562 
+0.5 0.484375 0.476562 
+0.507812 0.476562 0.476562 
+0.507812 0.484375 0.476562 
+0.507812 0.484375 0.484375 
+0.5 0.492188 0.476562 
+0.5 0.5 0.476562 
+0.507812 0.492188 0.476562 
+0.507812 0.5 0.476562 
+0.507812 0.5 0.484375 
+0.5 0.492188 0.484375 
+0.507812 0.492188 0.484375 
+0.515625 0.492188 0.484375 
+0.5 0.492188 0.492188 
+0.5 0.5 0.492188 
+0.507812 0.492188 0.492188 
+0.507812 0.5 0.492188 
+0.507812 0.5 0.5 
+0.515625 0.5 0.492188 
+0.515625 0.492188 0.492188 
+0.523438 0.492188 0.492188 
+0.523438 0.5 0.492188 
+0.523438 0.5 0.5 
+0.515625 0.484375 0.476562 
+0.515625 0.5 0.476562 
+0.515625 0.492188 0.476562 
+0.523438 0.492188 0.476562 
+0.523438 0.5 0.476562 
+0.53125 0.5 0.476562 
+0.523438 0.5 0.484375 
+0.523438 0.492188 0.484375 
+0.53125 0.5 0.492188 
+0.515625 0.476562 0.476562 
+0.523438 0.476562 0.476562 
+0.53125 0.476562 0.476562 
+0.53125 0.484375 0.476562 
+0.523438 0.484375 0.476562 
+0.523438 0.484375 0.484375 
+0.53125 0.492188 0.476562 
+0.53125 0.492188 0.484375 
+0.53125 0.492188 0.492188 
+0.539062 0.476562 0.476562 
+0.539062 0.484375 0.476562 
+0.539062 0.484375 0.484375 
+0.539062 0.492188 0.476562 
+0.539062 0.5 0.476562 
+0.539062 0.5 0.484375 
+0.539062 0.492188 0.484375 
+0.546875 0.492188 0.484375 
+0.539062 0.492188 0.492188 
+0.539062 0.5 0.492188 
+0.539062 0.5 0.5 
+0.546875 0.5 0.492188 
+0.546875 0.492188 0.492188 
+0.554688 0.492188 0.492188 
+0.554688 0.5 0.492188 
+0.554688 0.5 0.5 
+0.515625 0.453125 0.445312 
+0.515625 0.46875 0.445312 
+0.515625 0.460938 0.445312 
+0.523438 0.460938 0.445312 
+0.523438 0.46875 0.445312 
+0.53125 0.46875 0.445312 
+0.523438 0.46875 0.453125 
+0.523438 0.460938 0.453125 
+0.53125 0.46875 0.460938 
+0.515625 0.484375 0.445312 
+0.515625 0.5 0.445312 
+0.515625 0.492188 0.445312 
+0.523438 0.492188 0.445312 
+0.523438 0.5 0.445312 
+0.53125 0.5 0.445312 
+0.523438 0.5 0.453125 
+0.523438 0.492188 0.453125 
+0.53125 0.5 0.460938 
+0.515625 0.476562 0.445312 
+0.523438 0.476562 0.445312 
+0.53125 0.476562 0.445312 
+0.53125 0.484375 0.445312 
+0.523438 0.484375 0.445312 
+0.523438 0.484375 0.453125 
+0.53125 0.492188 0.445312 
+0.53125 0.492188 0.453125 
+0.53125 0.492188 0.460938 
+0.53125 0.476562 0.453125 
+0.523438 0.476562 0.453125 
+0.53125 0.476562 0.460938 
+0.53125 0.484375 0.460938 
+0.539062 0.476562 0.445312 
+0.539062 0.484375 0.445312 
+0.546875 0.484375 0.445312 
+0.539062 0.492188 0.445312 
+0.539062 0.5 0.445312 
+0.546875 0.5 0.445312 
+0.546875 0.492188 0.445312 
+0.546875 0.492188 0.453125 
+0.554688 0.492188 0.445312 
+0.554688 0.5 0.445312 
+0.5625 0.5 0.445312 
+0.554688 0.5 0.453125 
+0.554688 0.492188 0.453125 
+0.554688 0.492188 0.460938 
+0.554688 0.5 0.460938 
+0.5625 0.5 0.460938 
+0.539062 0.484375 0.453125 
+0.539062 0.5 0.453125 
+0.539062 0.492188 0.453125 
+0.539062 0.492188 0.460938 
+0.539062 0.5 0.460938 
+0.539062 0.5 0.46875 
+0.546875 0.5 0.460938 
+0.546875 0.492188 0.460938 
+0.554688 0.5 0.46875 
+0.539062 0.476562 0.453125 
+0.539062 0.476562 0.460938 
+0.539062 0.476562 0.46875 
+0.539062 0.484375 0.46875 
+0.539062 0.484375 0.460938 
+0.546875 0.484375 0.460938 
+0.539062 0.492188 0.46875 
+0.546875 0.492188 0.46875 
+0.554688 0.492188 0.46875 
+0.546875 0.484375 0.476562 
+0.546875 0.5 0.476562 
+0.546875 0.492188 0.476562 
+0.554688 0.492188 0.476562 
+0.554688 0.5 0.476562 
+0.5625 0.5 0.476562 
+0.554688 0.5 0.484375 
+0.554688 0.492188 0.484375 
+0.5625 0.5 0.492188 
+0.515625 0.445312 0.445312 
+0.523438 0.445312 0.445312 
+0.53125 0.445312 0.445312 
+0.53125 0.453125 0.445312 
+0.523438 0.453125 0.445312 
+0.523438 0.453125 0.453125 
+0.53125 0.460938 0.445312 
+0.53125 0.460938 0.453125 
+0.53125 0.460938 0.460938 
+0.539062 0.445312 0.445312 
+0.546875 0.445312 0.445312 
+0.546875 0.453125 0.445312 
+0.554688 0.4375 0.4375 
+0.554688 0.445312 0.4375 
+0.5625 0.445312 0.4375 
+0.554688 0.445312 0.445312 
+0.5625 0.445312 0.445312 
+0.5625 0.453125 0.445312 
+0.554688 0.453125 0.445312 
+0.554688 0.453125 0.453125 
+0.554688 0.460938 0.445312 
+0.5625 0.460938 0.445312 
+0.5625 0.46875 0.445312 
+0.5625 0.460938 0.453125 
+0.554688 0.460938 0.453125 
+0.554688 0.460938 0.460938 
+0.5625 0.460938 0.460938 
+0.5625 0.46875 0.460938 
+0.539062 0.453125 0.445312 
+0.539062 0.460938 0.445312 
+0.539062 0.46875 0.445312 
+0.546875 0.46875 0.445312 
+0.546875 0.460938 0.445312 
+0.546875 0.460938 0.453125 
+0.554688 0.46875 0.445312 
+0.554688 0.46875 0.453125 
+0.554688 0.46875 0.460938 
+0.539062 0.453125 0.453125 
+0.539062 0.46875 0.453125 
+0.539062 0.460938 0.453125 
+0.539062 0.460938 0.460938 
+0.539062 0.46875 0.460938 
+0.539062 0.46875 0.46875 
+0.546875 0.46875 0.460938 
+0.546875 0.460938 0.460938 
+0.554688 0.46875 0.46875 
+0.546875 0.476562 0.445312 
+0.554688 0.476562 0.445312 
+0.5625 0.476562 0.445312 
+0.5625 0.484375 0.445312 
+0.554688 0.484375 0.445312 
+0.554688 0.484375 0.453125 
+0.5625 0.492188 0.445312 
+0.5625 0.492188 0.453125 
+0.5625 0.492188 0.460938 
+0.546875 0.476562 0.453125 
+0.5625 0.476562 0.453125 
+0.554688 0.476562 0.453125 
+0.554688 0.476562 0.460938 
+0.5625 0.476562 0.460938 
+0.5625 0.476562 0.46875 
+0.5625 0.484375 0.460938 
+0.554688 0.484375 0.460938 
+0.5625 0.492188 0.46875 
+0.546875 0.476562 0.46875 
+0.546875 0.476562 0.460938 
+0.554688 0.476562 0.46875 
+0.554688 0.484375 0.46875 
+0.546875 0.476562 0.476562 
+0.554688 0.476562 0.476562 
+0.5625 0.476562 0.476562 
+0.5625 0.484375 0.476562 
+0.554688 0.484375 0.476562 
+0.554688 0.484375 0.484375 
+0.5625 0.492188 0.476562 
+0.5625 0.492188 0.484375 
+0.5625 0.492188 0.492188 
+0.570312 0.445312 0.445312 
+0.570312 0.453125 0.445312 
+0.570312 0.453125 0.453125 
+0.570312 0.460938 0.445312 
+0.570312 0.46875 0.445312 
+0.570312 0.46875 0.453125 
+0.570312 0.460938 0.453125 
+0.578125 0.460938 0.453125 
+0.570312 0.460938 0.460938 
+0.570312 0.46875 0.460938 
+0.570312 0.46875 0.46875 
+0.578125 0.46875 0.460938 
+0.578125 0.460938 0.460938 
+0.585938 0.460938 0.460938 
+0.585938 0.46875 0.460938 
+0.585938 0.46875 0.46875 
+0.570312 0.476562 0.445312 
+0.570312 0.484375 0.445312 
+0.570312 0.484375 0.453125 
+0.570312 0.492188 0.445312 
+0.570312 0.5 0.445312 
+0.570312 0.5 0.453125 
+0.570312 0.492188 0.453125 
+0.578125 0.492188 0.453125 
+0.570312 0.492188 0.460938 
+0.570312 0.5 0.460938 
+0.570312 0.5 0.46875 
+0.578125 0.5 0.460938 
+0.578125 0.492188 0.460938 
+0.585938 0.492188 0.460938 
+0.585938 0.5 0.460938 
+0.585938 0.5 0.46875 
+0.570312 0.476562 0.453125 
+0.570312 0.476562 0.460938 
+0.570312 0.476562 0.46875 
+0.570312 0.484375 0.46875 
+0.570312 0.484375 0.460938 
+0.578125 0.484375 0.460938 
+0.570312 0.492188 0.46875 
+0.578125 0.492188 0.46875 
+0.585938 0.492188 0.46875 
+0.578125 0.476562 0.453125 
+0.578125 0.476562 0.46875 
+0.578125 0.476562 0.460938 
+0.585938 0.476562 0.460938 
+0.585938 0.476562 0.46875 
+0.59375 0.476562 0.46875 
+0.585938 0.484375 0.46875 
+0.585938 0.484375 0.460938 
+0.59375 0.492188 0.46875 
+0.570312 0.476562 0.476562 
+0.570312 0.484375 0.476562 
+0.570312 0.484375 0.484375 
+0.570312 0.492188 0.476562 
+0.570312 0.5 0.476562 
+0.570312 0.5 0.484375 
+0.570312 0.492188 0.484375 
+0.578125 0.492188 0.484375 
+0.570312 0.492188 0.492188 
+0.570312 0.5 0.492188 
+0.578125 0.5 0.492188 
+0.578125 0.492188 0.492188 
+0.585938 0.492188 0.492188 
+0.585938 0.5 0.492188 
+0.578125 0.484375 0.476562 
+0.578125 0.5 0.476562 
+0.578125 0.492188 0.476562 
+0.585938 0.492188 0.476562 
+0.585938 0.5 0.476562 
+0.59375 0.5 0.476562 
+0.585938 0.5 0.484375 
+0.585938 0.492188 0.484375 
+0.59375 0.5 0.492188 
+0.578125 0.476562 0.476562 
+0.585938 0.476562 0.476562 
+0.59375 0.476562 0.476562 
+0.59375 0.484375 0.476562 
+0.585938 0.484375 0.476562 
+0.585938 0.484375 0.484375 
+0.59375 0.492188 0.476562 
+0.59375 0.492188 0.484375 
+0.453125 0.53125 0.414062 
+0.460938 0.53125 0.414062 
+0.460938 0.53125 0.421875 
+0.460938 0.539062 0.414062 
+0.460938 0.539062 0.421875 
+0.46875 0.539062 0.421875 
+0.453125 0.539062 0.421875 
+0.460938 0.546875 0.421875 
+0.460938 0.53125 0.429688 
+0.46875 0.53125 0.429688 
+0.460938 0.539062 0.429688 
+0.46875 0.539062 0.429688 
+0.46875 0.546875 0.429688 
+0.460938 0.546875 0.429688 
+0.460938 0.554688 0.429688 
+0.46875 0.554688 0.429688 
+0.46875 0.53125 0.414062 
+0.46875 0.539062 0.414062 
+0.476562 0.539062 0.414062 
+0.476562 0.539062 0.421875 
+0.476562 0.546875 0.421875 
+0.476562 0.539062 0.429688 
+0.476562 0.546875 0.429688 
+0.484375 0.546875 0.429688 
+0.476562 0.554688 0.429688 
+0.484375 0.554688 0.429688 
+0.492188 0.554688 0.429688 
+0.445312 0.5 0.4375 
+0.445312 0.5 0.445312 
+0.453125 0.5 0.445312 
+0.453125 0.507812 0.445312 
+0.453125 0.507812 0.453125 
+0.460938 0.5 0.4375 
+0.460938 0.5 0.445312 
+0.46875 0.5 0.445312 
+0.460938 0.507812 0.445312 
+0.46875 0.507812 0.445312 
+0.46875 0.507812 0.453125 
+0.460938 0.5 0.453125 
+0.460938 0.507812 0.453125 
+0.460938 0.515625 0.453125 
+0.460938 0.5 0.460938 
+0.46875 0.5 0.460938 
+0.460938 0.507812 0.460938 
+0.46875 0.507812 0.460938 
+0.46875 0.507812 0.46875 
+0.46875 0.515625 0.460938 
+0.460938 0.515625 0.460938 
+0.46875 0.523438 0.460938 
+0.46875 0.523438 0.46875 
+0.476562 0.5 0.4375 
+0.476562 0.5 0.445312 
+0.484375 0.5 0.445312 
+0.476562 0.507812 0.445312 
+0.484375 0.507812 0.445312 
+0.484375 0.507812 0.453125 
+0.492188 0.5 0.4375 
+0.492188 0.5 0.445312 
+0.492188 0.507812 0.445312 
+0.5 0.507812 0.445312 
+0.5 0.507812 0.453125 
+0.492188 0.5 0.453125 
+0.492188 0.507812 0.453125 
+0.492188 0.515625 0.453125 
+0.492188 0.5 0.460938 
+0.492188 0.507812 0.460938 
+0.5 0.507812 0.460938 
+0.5 0.507812 0.46875 
+0.5 0.515625 0.460938 
+0.492188 0.515625 0.460938 
+0.492188 0.523438 0.460938 
+0.5 0.523438 0.460938 
+0.5 0.523438 0.46875 
+0.476562 0.5 0.453125 
+0.476562 0.507812 0.453125 
+0.476562 0.5 0.460938 
+0.476562 0.5 0.46875 
+0.476562 0.507812 0.460938 
+0.476562 0.507812 0.46875 
+0.484375 0.507812 0.46875 
+0.484375 0.5 0.460938 
+0.484375 0.507812 0.460938 
+0.484375 0.515625 0.460938 
+0.492188 0.5 0.46875 
+0.492188 0.507812 0.46875 
+0.492188 0.515625 0.46875 
+0.492188 0.523438 0.46875 
+0.476562 0.515625 0.453125 
+0.476562 0.515625 0.46875 
+0.476562 0.515625 0.460938 
+0.476562 0.523438 0.460938 
+0.476562 0.523438 0.46875 
+0.484375 0.523438 0.46875 
+0.484375 0.523438 0.460938 
+0.476562 0.5 0.476562 
+0.484375 0.5 0.476562 
+0.476562 0.507812 0.476562 
+0.484375 0.507812 0.476562 
+0.484375 0.507812 0.484375 
+0.492188 0.5 0.476562 
+0.492188 0.507812 0.476562 
+0.5 0.507812 0.476562 
+0.5 0.507812 0.484375 
+0.492188 0.5 0.484375 
+0.492188 0.507812 0.484375 
+0.492188 0.515625 0.484375 
+0.492188 0.5 0.492188 
+0.492188 0.507812 0.492188 
+0.5 0.507812 0.492188 
+0.5 0.507812 0.5 
+0.5 0.515625 0.492188 
+0.492188 0.515625 0.492188 
+0.492188 0.523438 0.492188 
+0.5 0.523438 0.492188 
+0.5 0.523438 0.5 
+0.484375 0.515625 0.476562 
+0.5 0.515625 0.476562 
+0.492188 0.515625 0.476562 
+0.492188 0.523438 0.476562 
+0.5 0.523438 0.476562 
+0.5 0.53125 0.476562 
+0.5 0.523438 0.484375 
+0.492188 0.523438 0.484375 
+0.5 0.53125 0.492188 
+0.476562 0.515625 0.476562 
+0.476562 0.523438 0.476562 
+0.476562 0.53125 0.476562 
+0.484375 0.53125 0.476562 
+0.484375 0.523438 0.476562 
+0.484375 0.523438 0.484375 
+0.492188 0.53125 0.476562 
+0.492188 0.53125 0.484375 
+0.492188 0.53125 0.492188 
+0.484375 0.539062 0.484375 
+0.5 0.539062 0.484375 
+0.492188 0.539062 0.484375 
+0.492188 0.539062 0.492188 
+0.5 0.539062 0.492188 
+0.5 0.539062 0.5 
+0.5 0.546875 0.492188 
+0.492188 0.546875 0.492188 
+0.5 0.554688 0.5 
+0.453125 0.507812 0.4375 
+0.460938 0.507812 0.4375 
+0.46875 0.507812 0.4375 
+0.46875 0.515625 0.445312 
+0.460938 0.515625 0.4375 
+0.460938 0.515625 0.445312 
+0.46875 0.523438 0.4375 
+0.46875 0.523438 0.445312 
+0.46875 0.523438 0.453125 
+0.476562 0.507812 0.4375 
+0.484375 0.507812 0.4375 
+0.484375 0.515625 0.445312 
+0.492188 0.507812 0.4375 
+0.5 0.507812 0.4375 
+0.5 0.515625 0.445312 
+0.492188 0.515625 0.4375 
+0.492188 0.515625 0.445312 
+0.492188 0.523438 0.4375 
+0.5 0.523438 0.4375 
+0.492188 0.523438 0.445312 
+0.5 0.523438 0.445312 
+0.5 0.53125 0.445312 
+0.5 0.523438 0.453125 
+0.492188 0.523438 0.453125 
+0.5 0.53125 0.460938 
+0.476562 0.515625 0.4375 
+0.476562 0.515625 0.445312 
+0.476562 0.523438 0.4375 
+0.476562 0.53125 0.4375 
+0.476562 0.523438 0.445312 
+0.476562 0.53125 0.445312 
+0.484375 0.53125 0.445312 
+0.484375 0.523438 0.4375 
+0.484375 0.523438 0.445312 
+0.484375 0.523438 0.453125 
+0.492188 0.53125 0.4375 
+0.492188 0.53125 0.445312 
+0.492188 0.53125 0.453125 
+0.476562 0.523438 0.453125 
+0.484375 0.539062 0.4375 
+0.484375 0.539062 0.445312 
+0.492188 0.539062 0.4375 
+0.5 0.539062 0.4375 
+0.492188 0.539062 0.445312 
+0.5 0.539062 0.445312 
+0.5 0.546875 0.445312 
+0.492188 0.546875 0.4375 
+0.492188 0.546875 0.445312 
+0.492188 0.546875 0.453125 
+0.5 0.554688 0.4375 
+0.5 0.554688 0.445312 
+0.5 0.554688 0.453125 
+0.5 0.554688 0.460938 
+0.5 0.539062 0.453125 
+0.492188 0.539062 0.453125 
+0.5 0.539062 0.460938 
+0.5 0.546875 0.460938 
+0.59375 0.492188 0.492188 
+0.5 0.40625 0.476562 
+0.5 0.414062 0.476562 
+0.5 0.414062 0.484375 
+0.507812 0.414062 0.476562 
+0.507812 0.414062 0.484375 
+0.507812 0.421875 0.484375 
+0.5 0.40625 0.492188 
+0.5 0.414062 0.492188 
+0.507812 0.414062 0.492188 
+0.507812 0.414062 0.5 
+0.507812 0.421875 0.5 
+0.5 0.421875 0.492188 
+0.507812 0.421875 0.492188 
+0.515625 0.421875 0.492188 
+0.5 0.429688 0.492188 
+0.507812 0.429688 0.492188 
+0.507812 0.429688 0.5 
+0.507812 0.4375 0.5 
+0.515625 0.429688 0.5 
+0.515625 0.429688 0.492188 
+0.523438 0.429688 0.492188 
+0.523438 0.429688 0.5 
+0.523438 0.4375 0.5 
+0.507812 0.40625 0.476562 
+0.507812 0.40625 0.484375 
+0.515625 0.414062 0.484375 
+0.507812 0.40625 0.492188 
+0.507812 0.40625 0.5 
+0.515625 0.414062 0.5 
+0.515625 0.40625 0.492188 
+0.515625 0.414062 0.492188 
+0.523438 0.40625 0.492188 
+0.523438 0.40625 0.5 
+0.523438 0.414062 0.492188 
+0.523438 0.414062 0.5 
+0.53125 0.414062 0.5 
+0.523438 0.421875 0.5 
+0.523438 0.421875 0.492188 
+0.53125 0.429688 0.5 
+0.507812 0.40625 0.46875 
+0.515625 0.40625 0.476562 
+0.515625 0.414062 0.476562 
+0.523438 0.40625 0.46875 
+0.523438 0.40625 0.476562 
+0.53125 0.40625 0.476562 
+0.523438 0.414062 0.476562 
+0.53125 0.414062 0.476562 
+0.53125 0.414062 0.484375 
+0.523438 0.40625 0.484375 
+0.523438 0.414062 0.484375 
+0.523438 0.421875 0.484375 
+0.53125 0.40625 0.492188 
+0.53125 0.414062 0.492188 
+0.53125 0.421875 0.492188 
+0.53125 0.429688 0.492188 
+0.539062 0.414062 0.476562 
+0.539062 0.414062 0.484375 
+0.539062 0.421875 0.484375 
+0.539062 0.414062 0.492188 
+0.539062 0.414062 0.5 
+0.539062 0.421875 0.5 
+0.539062 0.421875 0.492188 
+0.546875 0.421875 0.492188 
+0.539062 0.429688 0.492188 
+0.539062 0.429688 0.5 
+0.539062 0.4375 0.5 
+0.546875 0.429688 0.5 
+0.546875 0.429688 0.492188 
+0.554688 0.429688 0.492188 
+0.554688 0.429688 0.5 
+0.554688 0.4375 0.5 
+0.5 0.414062 0.4375 
+0.5 0.414062 0.445312 
+0.5 0.421875 0.445312 
+0.507812 0.414062 0.445312 
+0.507812 0.421875 0.445312 
+0.507812 0.421875 0.453125 
+0.5 0.429688 0.4375 
+0.5 0.429688 0.445312 
+0.5 0.4375 0.445312 
+0.507812 0.429688 0.445312 
+0.507812 0.4375 0.445312 
+0.507812 0.4375 0.453125 
+0.5 0.429688 0.453125 
+0.507812 0.429688 0.453125 
+0.515625 0.429688 0.453125 
+0.5 0.429688 0.460938 
+0.5 0.4375 0.460938 
+0.507812 0.429688 0.460938 
+0.507812 0.4375 0.460938 
+0.507812 0.4375 0.46875 
+0.515625 0.4375 0.460938 
+0.515625 0.429688 0.460938 
+0.523438 0.429688 0.460938 
+0.523438 0.4375 0.460938 
+0.523438 0.4375 0.46875 
+0.5 0.40625 0.445312 
+0.5 0.414062 0.453125 
+0.507812 0.414062 0.453125 
+0.5 0.40625 0.460938 
+0.5 0.414062 0.460938 
+0.5 0.414062 0.46875 
+0.507812 0.414062 0.460938 
+0.507812 0.414062 0.46875 
+0.507812 0.421875 0.46875 
+0.5 0.421875 0.460938 
+0.507812 0.421875 0.460938 
+0.515625 0.421875 0.460938 
+0.5 0.429688 0.46875 
+0.507812 0.429688 0.46875 
+0.515625 0.429688 0.46875 
+0.523438 0.429688 0.46875 
+0.507812 0.40625 0.453125 
+0.515625 0.414062 0.453125 
+0.507812 0.40625 0.460938 
+0.515625 0.414062 0.46875 
+0.515625 0.40625 0.460938 
+0.515625 0.414062 0.460938 
+0.523438 0.40625 0.460938 
+0.523438 0.414062 0.460938 
+0.523438 0.414062 0.46875 
+0.53125 0.414062 0.46875 
+0.523438 0.421875 0.46875 
+0.523438 0.421875 0.460938 
+0.53125 0.429688 0.46875 
+0.5 0.421875 0.476562 
+0.507812 0.421875 0.476562 
+0.5 0.429688 0.476562 
+0.5 0.4375 0.476562 
+0.507812 0.429688 0.476562 
+0.507812 0.4375 0.476562 
+0.507812 0.4375 0.484375 
+0.5 0.429688 0.484375 
+0.507812 0.429688 0.484375 
+0.515625 0.429688 0.484375 
+0.5 0.4375 0.492188 
+0.507812 0.4375 0.492188 
+0.515625 0.4375 0.492188 
+0.523438 0.4375 0.492188 
+0.515625 0.421875 0.476562 
+0.515625 0.4375 0.476562 
+0.515625 0.429688 0.476562 
+0.523438 0.429688 0.476562 
+0.523438 0.4375 0.476562 
+0.53125 0.4375 0.476562 
+0.523438 0.4375 0.484375 
+0.523438 0.429688 0.484375 
+0.53125 0.4375 0.492188 
+0.53125 0.421875 0.476562 
+0.523438 0.421875 0.476562 
+0.53125 0.429688 0.476562 
+0.53125 0.429688 0.484375 
+0.539062 0.421875 0.476562 
+0.539062 0.429688 0.476562 
+0.539062 0.4375 0.476562 
+0.539062 0.4375 0.484375 
+0.539062 0.429688 0.484375 
+0.546875 0.429688 0.484375 
+0.539062 0.4375 0.492188 
+0.546875 0.4375 0.492188 
+0.554688 0.4375 0.492188 
+0.507812 0.421875 0.4375 
+0.515625 0.421875 0.445312 
+0.507812 0.429688 0.4375 
+0.515625 0.4375 0.445312 
+0.515625 0.429688 0.4375 
+0.515625 0.429688 0.445312 
+0.523438 0.429688 0.4375 
+0.523438 0.429688 0.445312 
+0.523438 0.4375 0.445312 
+0.53125 0.4375 0.445312 
+0.523438 0.4375 0.453125 
+0.523438 0.429688 0.453125 
+0.53125 0.4375 0.460938 
+0.53125 0.421875 0.445312 
+0.523438 0.421875 0.4375 
+0.523438 0.421875 0.445312 
+0.523438 0.421875 0.453125 
+0.53125 0.429688 0.4375 
+0.53125 0.429688 0.445312 
+0.53125 0.429688 0.453125 
+0.53125 0.429688 0.460938 
+0.53125 0.414062 0.453125 
+0.53125 0.40625 0.460938 
+0.53125 0.414062 0.460938 
+0.53125 0.421875 0.460938 
+0.539062 0.429688 0.445312 
+0.539062 0.4375 0.445312 
+0.546875 0.4375 0.445312 
+0.546875 0.429688 0.453125 
+0.554688 0.4375 0.453125 
+0.554688 0.429688 0.460938 
+0.554688 0.4375 0.460938 
+0.5625 0.4375 0.460938 
+0.539062 0.421875 0.445312 
+0.539062 0.421875 0.453125 
+0.539062 0.4375 0.453125 
+0.539062 0.429688 0.453125 
+0.539062 0.429688 0.460938 
+0.539062 0.4375 0.460938 
+0.539062 0.4375 0.46875 
+0.546875 0.4375 0.460938 
+0.546875 0.429688 0.460938 
+0.554688 0.4375 0.46875 
+0.539062 0.414062 0.460938 
+0.539062 0.414062 0.46875 
+0.539062 0.421875 0.46875 
+0.539062 0.421875 0.460938 
+0.546875 0.421875 0.460938 
+0.414062 0.539062 0.460938 
+0.414062 0.539062 0.46875 
+0.421875 0.539062 0.46875 
+0.421875 0.539062 0.460938 
+0.421875 0.546875 0.460938 
+0.429688 0.539062 0.46875 
+0.429688 0.546875 0.46875 
+0.429688 0.554688 0.46875 
+0.421875 0.546875 0.476562 
+0.4375 0.546875 0.476562 
+0.429688 0.546875 0.476562 
+0.429688 0.554688 0.476562 
+0.4375 0.554688 0.476562 
+0.4375 0.5625 0.476562 
+0.4375 0.554688 0.484375 
+0.429688 0.554688 0.484375 
+0.4375 0.5625 0.492188 
+0.445312 0.5 0.453125 
+0.445312 0.507812 0.453125 
+0.445312 0.5 0.460938 
+0.445312 0.5 0.46875 
+0.445312 0.507812 0.460938 
+0.445312 0.507812 0.46875 
+0.453125 0.507812 0.46875 
+0.453125 0.5 0.460938 
+0.453125 0.507812 0.460938 
+0.453125 0.515625 0.460938 
+0.460938 0.5 0.46875 
+0.460938 0.507812 0.46875 
+0.460938 0.515625 0.46875 
+0.460938 0.523438 0.46875 
+0.445312 0.5 0.476562 
+0.445312 0.5 0.484375 
+0.445312 0.507812 0.476562 
+0.445312 0.507812 0.484375 
+0.453125 0.507812 0.484375 
+0.445312 0.5 0.492188 
+0.445312 0.507812 0.492188 
+0.445312 0.507812 0.5 
+0.453125 0.507812 0.5 
+0.453125 0.5 0.492188 
+0.453125 0.507812 0.492188 
+0.453125 0.515625 0.492188 
+0.460938 0.5 0.492188 
+0.460938 0.507812 0.492188 
+0.460938 0.507812 0.5 
+0.46875 0.507812 0.5 
+0.460938 0.515625 0.5 
+0.460938 0.515625 0.492188 
+0.460938 0.523438 0.492188 
+0.460938 0.523438 0.5 
+0.46875 0.523438 0.5 
+0.453125 0.5 0.476562 
+0.453125 0.507812 0.476562 
+0.460938 0.5 0.476562 
+0.46875 0.5 0.476562 
+0.460938 0.507812 0.476562 
+0.46875 0.507812 0.476562 
+0.46875 0.507812 0.484375 
+0.460938 0.5 0.484375 
+0.460938 0.507812 0.484375 
+0.460938 0.515625 0.484375 
+0.46875 0.5 0.492188 
+0.46875 0.507812 0.492188 
+0.46875 0.515625 0.492188 
+0.46875 0.523438 0.492188 
+0.453125 0.515625 0.476562 
+0.46875 0.515625 0.476562 
+0.460938 0.515625 0.476562 
+0.460938 0.523438 0.476562 
+0.46875 0.523438 0.476562 
+0.46875 0.53125 0.476562 
+0.46875 0.523438 0.484375 
+0.460938 0.523438 0.484375 
+0.46875 0.53125 0.492188 
+0.476562 0.5 0.484375 
+0.476562 0.507812 0.484375 
+0.476562 0.5 0.492188 
+0.476562 0.507812 0.492188 
+0.476562 0.507812 0.5 
+0.484375 0.507812 0.5 
+0.484375 0.5 0.492188 
+0.484375 0.507812 0.492188 
+0.484375 0.515625 0.492188 
+0.492188 0.507812 0.5 
+0.492188 0.515625 0.5 
+0.492188 0.523438 0.5 
+0.476562 0.515625 0.484375 
+0.476562 0.515625 0.5 
+0.476562 0.515625 0.492188 
+0.476562 0.523438 0.492188 
+0.476562 0.523438 0.5 
+0.476562 0.53125 0.5 
+0.484375 0.523438 0.5 
+0.484375 0.523438 0.492188 
+0.492188 0.53125 0.5 
+0.476562 0.53125 0.484375 
+0.476562 0.523438 0.484375 
+0.476562 0.53125 0.492188 
+0.484375 0.53125 0.492188 
+0.476562 0.539062 0.484375 
+0.476562 0.539062 0.492188 
+0.476562 0.539062 0.5 
+0.484375 0.539062 0.5 
+0.484375 0.539062 0.492188 
+0.484375 0.546875 0.492188 
+0.492188 0.539062 0.5 
+0.492188 0.546875 0.5 
+0.492188 0.554688 0.5 
+0.445312 0.515625 0.453125 
+0.445312 0.515625 0.46875 
+0.445312 0.515625 0.460938 
+0.445312 0.523438 0.460938 
+0.445312 0.523438 0.46875 
+0.445312 0.53125 0.46875 
+0.453125 0.523438 0.46875 
+0.453125 0.523438 0.460938 
+0.460938 0.53125 0.46875 
+0.445312 0.515625 0.484375 
+0.445312 0.515625 0.5 
+0.445312 0.515625 0.492188 
+0.445312 0.523438 0.492188 
+0.445312 0.523438 0.5 
+0.445312 0.53125 0.5 
+0.453125 0.523438 0.5 
+0.453125 0.523438 0.492188 
+0.460938 0.53125 0.5 
+0.445312 0.515625 0.476562 
+0.445312 0.523438 0.476562 
+0.445312 0.53125 0.476562 
+0.445312 0.53125 0.484375 
+0.445312 0.523438 0.484375 
+0.453125 0.523438 0.484375 
+0.445312 0.53125 0.492188 
+0.453125 0.53125 0.492188 
+0.460938 0.53125 0.492188 
+0.453125 0.53125 0.476562 
+0.453125 0.523438 0.476562 
+0.460938 0.53125 0.476562 
+0.460938 0.53125 0.484375 
+0.445312 0.539062 0.476562 
+0.445312 0.539062 0.484375 
+0.445312 0.546875 0.484375 
+0.445312 0.539062 0.492188 
+0.445312 0.539062 0.5 
+0.445312 0.546875 0.5 
+0.445312 0.546875 0.492188 
+0.453125 0.546875 0.492188 
+0.445312 0.554688 0.492188 
+0.445312 0.554688 0.5 
+0.445312 0.5625 0.5 
+0.453125 0.554688 0.5 
+0.453125 0.554688 0.492188 
+0.460938 0.554688 0.492188 
+0.460938 0.554688 0.5 
+0.460938 0.5625 0.5 
+0.453125 0.539062 0.484375 
+0.453125 0.539062 0.5 
+0.453125 0.539062 0.492188 
+0.460938 0.539062 0.492188 
+0.460938 0.539062 0.5 
+0.46875 0.539062 0.5 
+0.460938 0.546875 0.5 
+0.460938 0.546875 0.492188 
+0.46875 0.554688 0.5 
+0.539062 0.429688 0.46875 
+0.546875 0.429688 0.46875 
+0.554688 0.429688 0.46875 
+0.546875 0.421875 0.476562 
+0.546875 0.4375 0.476562 
+0.546875 0.429688 0.476562 
+0.554688 0.429688 0.476562 
+0.554688 0.4375 0.476562 
+0.5625 0.4375 0.476562 
+0.554688 0.4375 0.484375 
+0.554688 0.429688 0.484375 
+0.5625 0.4375 0.492188 
+0.5 0.445312 0.453125 
+0.507812 0.445312 0.453125 
+0.5 0.445312 0.460938 
+0.5 0.445312 0.46875 
+0.507812 0.445312 0.460938 
+0.507812 0.445312 0.46875 
+0.507812 0.453125 0.46875 
+0.5 0.453125 0.460938 
+0.507812 0.453125 0.460938 
+0.515625 0.453125 0.460938 
+0.5 0.460938 0.46875 
+0.507812 0.460938 0.46875 
+0.515625 0.460938 0.46875 
+0.523438 0.460938 0.46875 
+0.5 0.445312 0.476562 
+0.5 0.445312 0.484375 
+0.507812 0.445312 0.476562 
+0.507812 0.445312 0.484375 
+0.507812 0.453125 0.484375 
+0.5 0.445312 0.492188 
+0.5 0.445312 0.5 
+0.507812 0.445312 0.492188 
+0.507812 0.445312 0.5 
+0.507812 0.453125 0.5 
+0.5 0.453125 0.492188 
+0.507812 0.453125 0.492188 
+0.515625 0.453125 0.492188 
+0.5 0.460938 0.492188 
+0.5 0.460938 0.5 
+0.507812 0.460938 0.492188 
+0.507812 0.460938 0.5 
+0.507812 0.46875 0.5 
+0.515625 0.460938 0.5 
+0.515625 0.460938 0.492188 
+0.523438 0.460938 0.492188 
+0.523438 0.460938 0.5 
+0.523438 0.46875 0.5 
+0.5 0.453125 0.476562 
+0.507812 0.453125 0.476562 
+0.5 0.460938 0.476562 
+0.5 0.46875 0.476562 
+0.507812 0.460938 0.476562 
+0.507812 0.46875 0.476562 
+0.507812 0.46875 0.484375 
+0.5 0.460938 0.484375 
+0.507812 0.460938 0.484375 
+0.515625 0.460938 0.484375 
+0.5 0.46875 0.492188 
+0.507812 0.46875 0.492188 
+0.515625 0.46875 0.492188 
+0.523438 0.46875 0.492188 
+0.515625 0.453125 0.476562 
+0.515625 0.46875 0.476562 
+0.515625 0.460938 0.476562 
+0.523438 0.460938 0.476562 
+0.523438 0.46875 0.476562 
+0.53125 0.46875 0.476562 
+0.523438 0.46875 0.484375 
+0.523438 0.460938 0.484375 
+0.53125 0.46875 0.492188 
+0.5 0.476562 0.484375 
+0.507812 0.476562 0.484375 
+0.5 0.476562 0.492188 
+0.5 0.476562 0.5 
+0.507812 0.476562 0.492188 
+0.507812 0.476562 0.5 
+0.507812 0.484375 0.5 
+0.5 0.484375 0.492188 
+0.507812 0.484375 0.492188 
+0.515625 0.484375 0.492188 
+0.5 0.492188 0.5 
+0.507812 0.492188 0.5 
+0.515625 0.492188 0.5 
+0.523438 0.492188 0.5 
+0.515625 0.476562 0.484375 
+0.515625 0.476562 0.5 
+0.515625 0.476562 0.492188 
+0.523438 0.476562 0.492188 
+0.523438 0.476562 0.5 
+0.53125 0.476562 0.5 
+0.523438 0.484375 0.5 
+0.523438 0.484375 0.492188 
+0.53125 0.492188 0.5 
+0.53125 0.476562 0.484375 
+0.523438 0.476562 0.484375 
+0.53125 0.476562 0.492188 
+0.53125 0.484375 0.492188 
+0.539062 0.476562 0.484375 
+0.539062 0.476562 0.492188 
+0.539062 0.476562 0.5 
+0.539062 0.484375 0.5 
+0.539062 0.484375 0.492188 
+0.546875 0.484375 0.492188 
+0.539062 0.492188 0.5 
+0.546875 0.492188 0.5 
+0.554688 0.492188 0.5 
+0.515625 0.445312 0.453125 
+0.515625 0.445312 0.46875 
+0.515625 0.445312 0.460938 
+0.523438 0.445312 0.460938 
+0.523438 0.445312 0.46875 
+0.53125 0.445312 0.46875 
+0.523438 0.453125 0.46875 
+0.523438 0.453125 0.460938 
+0.53125 0.460938 0.46875 
+0.515625 0.445312 0.484375 
+0.515625 0.445312 0.5 
+0.515625 0.445312 0.492188 
+0.523438 0.445312 0.492188 
+0.523438 0.445312 0.5 
+0.53125 0.445312 0.5 
+0.523438 0.453125 0.5 
+0.523438 0.453125 0.492188 
+0.53125 0.460938 0.5 
+0.515625 0.445312 0.476562 
+0.523438 0.445312 0.476562 
+0.53125 0.445312 0.476562 
+0.53125 0.445312 0.484375 
+0.523438 0.445312 0.484375 
+0.523438 0.453125 0.484375 
+0.53125 0.445312 0.492188 
+0.53125 0.453125 0.492188 
+0.53125 0.460938 0.492188 
+0.53125 0.453125 0.476562 
+0.523438 0.453125 0.476562 
+0.53125 0.460938 0.476562 
+0.53125 0.460938 0.484375 
+0.539062 0.445312 0.476562 
+0.539062 0.445312 0.484375 
+0.546875 0.445312 0.484375 
+0.539062 0.445312 0.492188 
+0.539062 0.445312 0.5 
+0.546875 0.445312 0.5 
+0.546875 0.445312 0.492188 
+0.546875 0.453125 0.492188 
+0.554688 0.445312 0.492188 
+0.554688 0.445312 0.5 
+0.554688 0.453125 0.5 
+0.554688 0.453125 0.492188 
+0.554688 0.460938 0.492188 
+0.554688 0.460938 0.5 
+0.539062 0.453125 0.484375 
+0.539062 0.453125 0.5 
+0.539062 0.453125 0.492188 
+0.539062 0.460938 0.492188 
+0.539062 0.460938 0.5 
+0.539062 0.46875 0.5 
+0.546875 0.460938 0.5 
+0.546875 0.460938 0.492188 
+0.554688 0.46875 0.5 
+0.539062 0.453125 0.476562 
+0.539062 0.460938 0.476562 
+0.539062 0.46875 0.476562 
+0.539062 0.46875 0.484375 
+0.539062 0.460938 0.484375 
+0.546875 0.460938 0.484375 
+0.585938 0.46875 0.484375 
+0.585938 0.46875 0.492188 
+0.59375 0.46875 0.492188 
+0.585938 0.476562 0.492188 
+0.59375 0.476562 0.492188 
+0.585938 0.476562 0.484375 
+0.59375 0.476562 0.484375 
+0.59375 0.484375 0.492188 
+0.578125 0.476562 0.484375 
+0.585938 0.484375 0.492188 
+0.476562 0.5 0.40625 
+0.476562 0.5 0.414062 
+0.484375 0.5 0.414062 
+0.476562 0.507812 0.414062 
+0.484375 0.507812 0.414062 
+0.484375 0.507812 0.421875 
+0.492188 0.5 0.40625 
+0.492188 0.5 0.414062 
+0.492188 0.507812 0.414062 
+0.5 0.507812 0.414062 
+0.5 0.507812 0.421875 
+0.492188 0.5 0.421875 
+0.492188 0.507812 0.421875 
+0.492188 0.515625 0.421875 
+0.492188 0.5 0.429688 
+0.492188 0.507812 0.429688 
+0.5 0.507812 0.429688 
+0.5 0.515625 0.429688 
+0.492188 0.515625 0.429688 
+0.492188 0.523438 0.429688 
+0.5 0.523438 0.429688 
+0.476562 0.507812 0.40625 
+0.484375 0.507812 0.40625 
+0.484375 0.515625 0.414062 
+0.492188 0.507812 0.40625 
+0.5 0.507812 0.40625 
+0.5 0.515625 0.414062 
+0.492188 0.515625 0.40625 
+0.492188 0.515625 0.414062 
+0.492188 0.523438 0.40625 
+0.5 0.523438 0.40625 
+0.492188 0.523438 0.414062 
+0.5 0.523438 0.414062 
+0.5 0.53125 0.414062 
+0.5 0.523438 0.421875 
+0.492188 0.523438 0.421875 
+0.5 0.53125 0.429688 
+0.46875 0.507812 0.40625 
+0.476562 0.515625 0.40625 
+0.476562 0.515625 0.414062 
+0.46875 0.523438 0.40625 
+0.476562 0.523438 0.40625 
+0.476562 0.53125 0.40625 
+0.476562 0.523438 0.414062 
+0.476562 0.53125 0.414062 
+0.484375 0.53125 0.414062 
+0.484375 0.523438 0.40625 
+0.484375 0.523438 0.414062 
+0.484375 0.523438 0.421875 
+0.492188 0.53125 0.40625 
+0.492188 0.53125 0.414062 
+0.492188 0.53125 0.421875 
+0.492188 0.53125 0.429688 
+0.484375 0.539062 0.414062 
+0.484375 0.539062 0.421875 
+0.492188 0.539062 0.414062 
+0.5 0.539062 0.414062 
+0.5 0.539062 0.421875 
+0.492188 0.539062 0.421875 
+0.492188 0.546875 0.421875 
+0.492188 0.539062 0.429688 
+0.5 0.539062 0.429688 
+0.5 0.546875 0.429688 
+0.492188 0.546875 0.429688 
+0.5 0.554688 0.429688 
+0.4375 0.5 0.414062 
+0.445312 0.5 0.414062 
+0.445312 0.5 0.421875 
+0.445312 0.507812 0.414062 
+0.445312 0.507812 0.421875 
+0.453125 0.507812 0.421875 
+0.4375 0.5 0.429688 
+0.445312 0.5 0.429688 
+0.445312 0.507812 0.429688 
+0.453125 0.5 0.429688 
+0.453125 0.507812 0.429688 
+0.453125 0.515625 0.429688 
+0.460938 0.5 0.429688 
+0.460938 0.507812 0.429688 
+0.460938 0.515625 0.429688 
+0.460938 0.523438 0.429688 
+0.445312 0.5 0.40625 
+0.453125 0.5 0.414062 
+0.453125 0.507812 0.414062 
+0.460938 0.5 0.40625 
+0.460938 0.5 0.414062 
+0.46875 0.5 0.414062 
+0.460938 0.507812 0.414062 
+0.46875 0.507812 0.414062 
+0.46875 0.507812 0.421875 
+0.460938 0.5 0.421875 
+0.460938 0.507812 0.421875 
+0.460938 0.515625 0.421875 
+0.46875 0.5 0.429688 
+0.46875 0.507812 0.429688 
+0.46875 0.515625 0.429688 
+0.46875 0.523438 0.429688 
+0.453125 0.507812 0.40625 
+0.453125 0.515625 0.414062 
+0.460938 0.507812 0.40625 
+0.46875 0.515625 0.414062 
+0.460938 0.515625 0.40625 
+0.460938 0.515625 0.414062 
+0.460938 0.523438 0.40625 
+0.460938 0.523438 0.414062 
+0.46875 0.523438 0.414062 
+0.46875 0.523438 0.421875 
+0.460938 0.523438 0.421875 
+0.476562 0.5 0.421875 
+0.476562 0.507812 0.421875 
+0.476562 0.5 0.429688 
+0.476562 0.507812 0.429688 
+0.484375 0.5 0.429688 
+0.484375 0.507812 0.429688 
+0.484375 0.515625 0.429688 
+0.476562 0.515625 0.421875 
+0.476562 0.515625 0.429688 
+0.476562 0.523438 0.429688 
+0.484375 0.523438 0.429688 
+0.476562 0.53125 0.421875 
+0.476562 0.523438 0.421875 
+0.476562 0.53125 0.429688 
+0.484375 0.53125 0.429688 
+0.484375 0.539062 0.429688 
+0.4375 0.507812 0.421875 
+0.445312 0.515625 0.421875 
+0.4375 0.507812 0.429688 
+0.4375 0.515625 0.429688 
+0.445312 0.515625 0.429688 
+0.4375 0.523438 0.429688 
+0.445312 0.523438 0.429688 
+0.453125 0.523438 0.429688 
+0.445312 0.53125 0.421875 
+0.4375 0.523438 0.421875 
+0.445312 0.523438 0.421875 
+0.453125 0.523438 0.421875 
+0.4375 0.53125 0.429688 
+0.445312 0.53125 0.429688 
+0.453125 0.53125 0.429688 
+0.460938 0.53125 0.40625 
+0.445312 0.539062 0.429688 
+0.453125 0.546875 0.429688 
+0.445312 0.539062 0.421875 
+0.453125 0.539062 0.429688 
+0.539062 0.46875 0.492188 
+0.546875 0.46875 0.492188 
+0.554688 0.46875 0.492188 
+0.546875 0.476562 0.484375 
+0.546875 0.476562 0.5 
+0.546875 0.476562 0.492188 
+0.554688 0.476562 0.492188 
+0.554688 0.476562 0.5 
+0.554688 0.484375 0.5 
+0.554688 0.484375 0.492188 
+0.53125 0.445312 0.453125 
+0.523438 0.445312 0.453125 
+0.53125 0.445312 0.460938 
+0.53125 0.453125 0.460938 
+0.546875 0.445312 0.453125 
+0.554688 0.4375 0.445312 
+0.5625 0.4375 0.445312 
+0.5625 0.445312 0.453125 
+0.554688 0.445312 0.453125 
+0.554688 0.445312 0.460938 
+0.5625 0.445312 0.460938 
+0.5625 0.445312 0.46875 
+0.5625 0.453125 0.460938 
+0.554688 0.453125 0.460938 
+0.5625 0.460938 0.46875 
+0.539062 0.445312 0.453125 
+0.539062 0.445312 0.460938 
+0.539062 0.445312 0.46875 
+0.546875 0.445312 0.46875 
+0.546875 0.445312 0.460938 
+0.546875 0.453125 0.460938 
+0.554688 0.445312 0.46875 
+0.554688 0.453125 0.46875 
+0.554688 0.460938 0.46875 
+0.539062 0.453125 0.46875 
+0.539062 0.453125 0.460938 
+0.539062 0.460938 0.46875 
+0.546875 0.460938 0.46875 
+0.546875 0.445312 0.476562 
+0.554688 0.445312 0.476562 
+0.5625 0.445312 0.476562 
+0.5625 0.445312 0.484375 
+0.554688 0.445312 0.484375 
+0.554688 0.453125 0.484375 
+0.5625 0.445312 0.492188 
+0.5625 0.453125 0.492188 
+0.5625 0.460938 0.492188 
+0.546875 0.453125 0.476562 
+0.5625 0.453125 0.476562 
+0.554688 0.453125 0.476562 
+0.554688 0.460938 0.476562 
+0.5625 0.460938 0.476562 
+0.5625 0.46875 0.476562 
+0.5625 0.460938 0.484375 
+0.554688 0.460938 0.484375 
+0.5625 0.46875 0.492188 
+0.546875 0.46875 0.476562 
+0.546875 0.460938 0.476562 
+0.554688 0.46875 0.476562 
+0.554688 0.46875 0.484375 
+0.5625 0.476562 0.484375 
+0.554688 0.476562 0.484375 
+0.5625 0.476562 0.492188 
+0.5625 0.484375 0.492188 
+0.570312 0.445312 0.453125 
+0.570312 0.445312 0.460938 
+0.570312 0.445312 0.46875 
+0.570312 0.453125 0.46875 
+0.570312 0.453125 0.460938 
+0.578125 0.453125 0.460938 
+0.570312 0.460938 0.46875 
+0.578125 0.460938 0.46875 
+0.585938 0.460938 0.46875 
+0.570312 0.445312 0.476562 
+0.570312 0.445312 0.484375 
+0.570312 0.453125 0.484375 
+0.570312 0.445312 0.492188 
+0.570312 0.453125 0.492188 
+0.578125 0.453125 0.492188 
+0.570312 0.460938 0.492188 
+0.578125 0.460938 0.492188 
+0.585938 0.460938 0.492188 
+0.570312 0.453125 0.476562 
+0.570312 0.460938 0.476562 
+0.570312 0.46875 0.476562 
+0.570312 0.46875 0.484375 
+0.570312 0.460938 0.484375 
+0.578125 0.460938 0.484375 
+0.570312 0.46875 0.492188 
+0.578125 0.46875 0.492188 
+0.578125 0.453125 0.476562 
+0.578125 0.46875 0.476562 
+0.578125 0.460938 0.476562 
+0.585938 0.460938 0.476562 
+0.585938 0.46875 0.476562 
+0.59375 0.46875 0.476562 
+0.585938 0.460938 0.484375 
+0.570312 0.476562 0.484375 
+0.570312 0.476562 0.492188 
+0.570312 0.484375 0.492188 
+0.578125 0.484375 0.492188 
+0.578125 0.476562 0.492188 
+0.476562 0.59375 0.484375 
+0.476562 0.585938 0.484375 
+0.476562 0.59375 0.492188 
+0.484375 0.59375 0.492188 
+0.507812 0.507812 0.414062 
+0.507812 0.507812 0.421875 
+0.515625 0.507812 0.421875 
+0.507812 0.507812 0.429688 
+0.515625 0.507812 0.429688 
+0.515625 0.515625 0.429688 
+0.523438 0.507812 0.429688 
+0.523438 0.515625 0.429688 
+0.523438 0.523438 0.429688 
+0.515625 0.507812 0.414062 
+0.523438 0.507812 0.414062 
+0.53125 0.507812 0.414062 
+0.53125 0.507812 0.421875 
+0.523438 0.507812 0.421875 
+0.523438 0.515625 0.421875 
+0.53125 0.507812 0.429688 
+0.53125 0.515625 0.429688 
+0.53125 0.523438 0.429688 
+0.507812 0.507812 0.40625 
+0.515625 0.507812 0.40625 
+0.515625 0.515625 0.414062 
+0.523438 0.507812 0.40625 
+0.53125 0.507812 0.40625 
+0.53125 0.515625 0.414062 
+0.523438 0.515625 0.40625 
+0.523438 0.515625 0.414062 
+0.523438 0.523438 0.40625 
+0.53125 0.523438 0.40625 
+0.523438 0.523438 0.414062 
+0.53125 0.523438 0.414062 
+0.53125 0.53125 0.414062 
+0.53125 0.523438 0.421875 
+0.523438 0.523438 0.421875 
+0.53125 0.53125 0.429688 
+0.539062 0.507812 0.414062 
+0.539062 0.507812 0.421875 
+0.546875 0.507812 0.421875 
+0.539062 0.507812 0.429688 
+0.546875 0.507812 0.429688 
+0.546875 0.515625 0.429688 
+0.554688 0.507812 0.429688 
+0.554688 0.515625 0.429688 
+0.554688 0.523438 0.429688 
+0.539062 0.515625 0.421875 
+0.539062 0.515625 0.429688 
+0.539062 0.523438 0.429688 
+0.546875 0.523438 0.429688 
+0.539062 0.515625 0.414062 
+0.539062 0.523438 0.414062 
+0.539062 0.53125 0.414062 
+0.539062 0.53125 0.421875 
+0.539062 0.523438 0.421875 
+0.546875 0.523438 0.421875 
+0.539062 0.53125 0.429688 
+0.546875 0.53125 0.429688 
+0.554688 0.53125 0.429688 
+0.539062 0.539062 0.414062 
+0.539062 0.539062 0.421875 
+0.546875 0.539062 0.421875 
+0.539062 0.539062 0.429688 
+0.546875 0.539062 0.429688 
+0.546875 0.546875 0.429688 
+0.554688 0.539062 0.429688 
+0.554688 0.546875 0.429688 
+0.554688 0.554688 0.429688 
+0.507812 0.507812 0.453125 
+0.507812 0.507812 0.460938 
+0.507812 0.507812 0.46875 
+0.515625 0.507812 0.46875 
+0.515625 0.507812 0.460938 
+0.515625 0.515625 0.460938 
+0.523438 0.507812 0.46875 
+0.523438 0.515625 0.46875 
+0.523438 0.523438 0.46875 
+0.507812 0.507812 0.476562 
+0.507812 0.507812 0.484375 
+0.515625 0.507812 0.484375 
+0.507812 0.507812 0.492188 
+0.507812 0.507812 0.5 
+0.515625 0.507812 0.5 
+0.515625 0.507812 0.492188 
+0.515625 0.515625 0.492188 
+0.523438 0.507812 0.492188 
+0.523438 0.507812 0.5 
+0.53125 0.507812 0.5 
+0.523438 0.515625 0.5 
+0.523438 0.515625 0.492188 
+0.523438 0.523438 0.492188 
+0.523438 0.523438 0.5 
+0.53125 0.523438 0.5 
+0.515625 0.507812 0.476562 
+0.523438 0.507812 0.476562 
+0.53125 0.507812 0.476562 
+0.53125 0.507812 0.484375 
+0.523438 0.507812 0.484375 
+0.523438 0.515625 0.484375 
+0.53125 0.507812 0.492188 
+0.53125 0.515625 0.492188 
+0.53125 0.523438 0.492188 
+0.515625 0.515625 0.476562 
+0.53125 0.515625 0.476562 
+0.523438 0.515625 0.476562 
+0.523438 0.523438 0.476562 
+0.53125 0.523438 0.476562 
+0.53125 0.53125 0.476562 
+0.53125 0.523438 0.484375 
+0.523438 0.523438 0.484375 
+0.53125 0.53125 0.492188 
+0.539062 0.507812 0.484375 
+0.539062 0.507812 0.492188 
+0.539062 0.507812 0.5 
+0.546875 0.507812 0.5 
+0.546875 0.507812 0.492188 
+0.546875 0.515625 0.492188 
+0.554688 0.507812 0.5 
+0.554688 0.515625 0.5 
+0.554688 0.523438 0.5 
+0.539062 0.515625 0.484375 
+0.539062 0.515625 0.5 
+0.539062 0.515625 0.492188 
+0.539062 0.523438 0.492188 
+0.539062 0.523438 0.5 
+0.539062 0.53125 0.5 
+0.546875 0.523438 0.5 
+0.546875 0.523438 0.492188 
+0.554688 0.53125 0.5 
+0.539062 0.53125 0.484375 
+0.539062 0.523438 0.484375 
+0.539062 0.53125 0.492188 
+0.546875 0.53125 0.492188 
+0.539062 0.539062 0.484375 
+0.539062 0.539062 0.492188 
+0.539062 0.539062 0.5 
+0.546875 0.539062 0.5 
+0.546875 0.539062 0.492188 
+0.546875 0.546875 0.492188 
+0.554688 0.539062 0.5 
+0.554688 0.546875 0.5 
+0.554688 0.554688 0.5 
+0.570312 0.507812 0.445312 
+0.570312 0.507812 0.453125 
+0.578125 0.507812 0.453125 
+0.570312 0.507812 0.460938 
+0.570312 0.507812 0.46875 
+0.578125 0.507812 0.46875 
+0.578125 0.507812 0.460938 
+0.578125 0.515625 0.460938 
+0.585938 0.507812 0.460938 
+0.585938 0.507812 0.46875 
+0.59375 0.507812 0.46875 
+0.585938 0.515625 0.46875 
+0.585938 0.515625 0.460938 
+0.585938 0.523438 0.460938 
+0.585938 0.523438 0.46875 
+0.59375 0.523438 0.46875 
+0.570312 0.507812 0.476562 
+0.570312 0.507812 0.484375 
+0.578125 0.507812 0.484375 
+0.570312 0.507812 0.492188 
+0.570312 0.507812 0.5 
+0.578125 0.507812 0.5 
+0.578125 0.507812 0.492188 
+0.578125 0.515625 0.492188 
+0.585938 0.507812 0.492188 
+0.585938 0.507812 0.5 
+0.59375 0.507812 0.5 
+0.585938 0.515625 0.5 
+0.585938 0.515625 0.492188 
+0.585938 0.523438 0.492188 
+0.585938 0.523438 0.5 
+0.59375 0.523438 0.5 
+0.578125 0.507812 0.476562 
+0.585938 0.507812 0.476562 
+0.59375 0.507812 0.476562 
+0.59375 0.507812 0.484375 
+0.585938 0.507812 0.484375 
+0.585938 0.515625 0.484375 
+0.59375 0.507812 0.492188 
+0.59375 0.515625 0.492188 
+0.59375 0.523438 0.492188 
+0.578125 0.515625 0.476562 
+0.59375 0.515625 0.476562 
+0.585938 0.515625 0.476562 
+0.585938 0.523438 0.476562 
+0.59375 0.523438 0.476562 
+0.59375 0.53125 0.476562 
+0.59375 0.523438 0.484375 
+0.585938 0.523438 0.484375 
+0.59375 0.53125 0.492188 
+0.570312 0.515625 0.453125 
+0.570312 0.515625 0.46875 
+0.570312 0.515625 0.460938 
+0.570312 0.523438 0.460938 
+0.570312 0.523438 0.46875 
+0.570312 0.53125 0.46875 
+0.578125 0.523438 0.46875 
+0.578125 0.523438 0.460938 
+0.585938 0.53125 0.46875 
+0.570312 0.515625 0.484375 
+0.570312 0.515625 0.5 
+0.570312 0.515625 0.492188 
+0.570312 0.523438 0.492188 
+0.570312 0.523438 0.5 
+0.570312 0.53125 0.5 
+0.578125 0.523438 0.5 
+0.578125 0.523438 0.492188 
+0.585938 0.53125 0.5 
+0.570312 0.515625 0.476562 
+0.570312 0.523438 0.476562 
+0.570312 0.53125 0.476562 
+0.570312 0.53125 0.484375 
+0.570312 0.523438 0.484375 
+0.578125 0.523438 0.484375 
+0.570312 0.53125 0.492188 
+0.578125 0.53125 0.492188 
+0.585938 0.53125 0.492188 
+0.578125 0.53125 0.476562 
+0.578125 0.523438 0.476562 
+0.585938 0.53125 0.476562 
+0.585938 0.53125 0.484375 
+0.570312 0.539062 0.476562 
+0.570312 0.539062 0.484375 
+0.570312 0.546875 0.484375 
+0.570312 0.539062 0.492188 
+0.570312 0.539062 0.5 
+0.570312 0.546875 0.5 
+0.570312 0.546875 0.492188 
+0.578125 0.546875 0.492188 
+0.570312 0.554688 0.492188 
+0.570312 0.554688 0.5 
+0.570312 0.5625 0.5 
+0.578125 0.554688 0.5 
+0.578125 0.554688 0.492188 
+0.585938 0.554688 0.492188 
+0.585938 0.554688 0.5 
+0.585938 0.5625 0.5 
+0.578125 0.539062 0.484375 
+0.578125 0.539062 0.5 
+0.578125 0.539062 0.492188 
+0.585938 0.539062 0.492188 
+0.585938 0.539062 0.5 
+0.59375 0.539062 0.5 
+0.585938 0.546875 0.5 
+0.585938 0.546875 0.492188 
+0.59375 0.554688 0.5 
+0.578125 0.539062 0.476562 
+0.585938 0.539062 0.476562 
+0.59375 0.539062 0.476562 
+0.59375 0.539062 0.484375 
+0.585938 0.539062 0.484375 
+0.585938 0.546875 0.484375 
+0.59375 0.539062 0.492188 
+0.59375 0.546875 0.492188 
+0.570312 0.515625 0.445312 
+0.570312 0.523438 0.445312 
+0.570312 0.53125 0.445312 
+0.570312 0.53125 0.453125 
+0.570312 0.523438 0.453125 
+0.578125 0.523438 0.453125 
+0.570312 0.53125 0.460938 
+0.578125 0.53125 0.460938 
+0.585938 0.53125 0.460938 
+0.570312 0.539062 0.445312 
+0.570312 0.546875 0.453125 
+0.570312 0.554688 0.460938 
+0.570312 0.5625 0.46875 
+0.570312 0.539062 0.453125 
+0.570312 0.539062 0.460938 
+0.570312 0.539062 0.46875 
+0.570312 0.546875 0.46875 
+0.570312 0.546875 0.460938 
+0.578125 0.546875 0.460938 
+0.570312 0.554688 0.46875 
+0.578125 0.554688 0.46875 
+0.578125 0.554688 0.460938 
+0.578125 0.539062 0.453125 
+0.578125 0.539062 0.46875 
+0.578125 0.539062 0.460938 
+0.585938 0.539062 0.460938 
+0.585938 0.539062 0.46875 
+0.59375 0.539062 0.46875 
+0.585938 0.546875 0.46875 
+0.570312 0.546875 0.476562 
+0.570312 0.554688 0.476562 
+0.570312 0.5625 0.476562 
+0.570312 0.5625 0.484375 
+0.570312 0.554688 0.484375 
+0.578125 0.554688 0.484375 
+0.570312 0.5625 0.492188 
+0.578125 0.5625 0.492188 
+0.578125 0.546875 0.476562 
+0.578125 0.5625 0.476562 
+0.578125 0.554688 0.476562 
+0.507812 0.515625 0.421875 
+0.507812 0.515625 0.4375 
+0.507812 0.515625 0.429688 
+0.507812 0.523438 0.429688 
+0.507812 0.523438 0.4375 
+0.507812 0.53125 0.4375 
+0.515625 0.523438 0.4375 
+0.515625 0.523438 0.429688 
+0.523438 0.53125 0.4375 
+0.507812 0.515625 0.414062 
+0.507812 0.523438 0.414062 
+0.507812 0.53125 0.414062 
+0.507812 0.53125 0.421875 
+0.507812 0.523438 0.421875 
+0.515625 0.523438 0.421875 
+0.507812 0.53125 0.429688 
+0.515625 0.53125 0.429688 
+0.523438 0.53125 0.429688 
+0.507812 0.515625 0.40625 
+0.507812 0.523438 0.40625 
+0.507812 0.53125 0.40625 
+0.515625 0.53125 0.414062 
+0.515625 0.523438 0.40625 
+0.515625 0.523438 0.414062 
+0.523438 0.53125 0.40625 
+0.523438 0.53125 0.414062 
+0.523438 0.53125 0.421875 
+0.507812 0.539062 0.414062 
+0.507812 0.539062 0.421875 
+0.507812 0.546875 0.421875 
+0.507812 0.539062 0.429688 
+0.507812 0.539062 0.4375 
+0.507812 0.546875 0.4375 
+0.507812 0.546875 0.429688 
+0.515625 0.546875 0.429688 
+0.507812 0.554688 0.429688 
+0.507812 0.554688 0.4375 
+0.507812 0.5625 0.4375 
+0.515625 0.554688 0.4375 
+0.515625 0.554688 0.429688 
+0.523438 0.554688 0.429688 
+0.523438 0.554688 0.4375 
+0.523438 0.5625 0.4375 
+0.515625 0.539062 0.421875 
+0.515625 0.539062 0.4375 
+0.515625 0.539062 0.429688 
+0.523438 0.539062 0.429688 
+0.523438 0.539062 0.4375 
+0.53125 0.539062 0.4375 
+0.523438 0.546875 0.4375 
+0.523438 0.546875 0.429688 
+0.53125 0.554688 0.4375 
+0.515625 0.539062 0.414062 
+0.523438 0.539062 0.414062 
+0.53125 0.539062 0.414062 
+0.53125 0.539062 0.421875 
+0.523438 0.539062 0.421875 
+0.523438 0.546875 0.421875 
+0.53125 0.539062 0.429688 
+0.53125 0.546875 0.429688 
+0.53125 0.554688 0.429688 
+0.539062 0.546875 0.421875 
+0.539062 0.546875 0.4375 
+0.539062 0.546875 0.429688 
+0.539062 0.554688 0.429688 
+0.539062 0.554688 0.4375 
+0.539062 0.5625 0.4375 
+0.546875 0.554688 0.4375 
+0.546875 0.554688 0.429688 
+0.554688 0.5625 0.4375 
+0.507812 0.515625 0.453125 
+0.507812 0.515625 0.46875 
+0.507812 0.515625 0.460938 
+0.507812 0.523438 0.460938 
+0.507812 0.523438 0.46875 
+0.507812 0.53125 0.46875 
+0.515625 0.523438 0.46875 
+0.515625 0.523438 0.460938 
+0.523438 0.53125 0.46875 
+0.507812 0.515625 0.484375 
+0.507812 0.515625 0.5 
+0.507812 0.515625 0.492188 
+0.507812 0.523438 0.492188 
+0.507812 0.523438 0.5 
+0.507812 0.53125 0.5 
+0.515625 0.523438 0.5 
+0.515625 0.523438 0.492188 
+0.523438 0.53125 0.5 
+0.507812 0.515625 0.476562 
+0.507812 0.523438 0.476562 
+0.507812 0.53125 0.476562 
+0.507812 0.53125 0.484375 
+0.507812 0.523438 0.484375 
+0.515625 0.523438 0.484375 
+0.507812 0.53125 0.492188 
+0.515625 0.53125 0.492188 
+0.523438 0.53125 0.492188 
+0.515625 0.53125 0.476562 
+0.515625 0.523438 0.476562 
+0.523438 0.53125 0.476562 
+0.523438 0.53125 0.484375 
+0.507812 0.539062 0.476562 
+0.507812 0.539062 0.484375 
+0.507812 0.546875 0.484375 
+0.507812 0.539062 0.492188 
+0.507812 0.539062 0.5 
+0.507812 0.546875 0.5 
+0.507812 0.546875 0.492188 
+0.515625 0.546875 0.492188 
+0.507812 0.554688 0.492188 
+0.507812 0.554688 0.5 
+0.507812 0.5625 0.5 
+0.515625 0.554688 0.5 
+0.515625 0.554688 0.492188 
+0.523438 0.554688 0.492188 
+0.523438 0.554688 0.5 
+0.523438 0.5625 0.5 
+0.515625 0.539062 0.484375 
+0.515625 0.539062 0.5 
+0.515625 0.539062 0.492188 
+0.523438 0.539062 0.492188 
+0.523438 0.539062 0.5 
+0.53125 0.539062 0.5 
+0.523438 0.546875 0.5 
+0.523438 0.546875 0.492188 
+0.53125 0.554688 0.5 
+0.515625 0.539062 0.476562 
+0.523438 0.539062 0.476562 
+0.53125 0.539062 0.476562 
+0.53125 0.539062 0.484375 
+0.523438 0.539062 0.484375 
+0.523438 0.546875 0.484375 
+0.53125 0.539062 0.492188 
+0.53125 0.546875 0.492188 
+0.53125 0.554688 0.492188 
+0.539062 0.546875 0.484375 
+0.539062 0.546875 0.5 
+0.539062 0.546875 0.492188 
+0.539062 0.554688 0.492188 
+0.539062 0.554688 0.5 
+0.539062 0.5625 0.5 
+0.546875 0.554688 0.5 
+0.546875 0.554688 0.492188 
+0.554688 0.5625 0.5 
+0.507812 0.515625 0.445312 
+0.507812 0.523438 0.445312 
+0.507812 0.53125 0.445312 
+0.507812 0.53125 0.453125 
+0.507812 0.523438 0.453125 
+0.515625 0.523438 0.453125 
+0.507812 0.53125 0.460938 
+0.515625 0.53125 0.460938 
+0.523438 0.53125 0.460938 
+0.507812 0.539062 0.445312 
+0.507812 0.546875 0.445312 
+0.507812 0.546875 0.453125 
+0.507812 0.554688 0.445312 
+0.507812 0.5625 0.445312 
+0.507812 0.5625 0.453125 
+0.507812 0.554688 0.453125 
+0.515625 0.554688 0.453125 
+0.507812 0.554688 0.460938 
+0.507812 0.5625 0.460938 
+0.507812 0.5625 0.46875 
+0.515625 0.5625 0.460938 
+0.515625 0.554688 0.460938 
+0.523438 0.554688 0.460938 
+0.523438 0.5625 0.460938 
+0.523438 0.5625 0.46875 
+0.507812 0.539062 0.453125 
+0.507812 0.539062 0.460938 
+0.507812 0.539062 0.46875 
+0.507812 0.546875 0.46875 
+0.507812 0.546875 0.460938 
+0.515625 0.546875 0.460938 
+0.507812 0.554688 0.46875 
+0.515625 0.554688 0.46875 
+0.523438 0.554688 0.46875 
+0.515625 0.539062 0.453125 
+0.515625 0.539062 0.46875 
+0.515625 0.539062 0.460938 
+0.523438 0.539062 0.460938 
+0.523438 0.539062 0.46875 
+0.53125 0.539062 0.46875 
+0.523438 0.546875 0.46875 
+0.523438 0.546875 0.460938 
+0.53125 0.554688 0.46875 
+0.507812 0.546875 0.476562 
+0.507812 0.554688 0.476562 
+0.507812 0.5625 0.476562 
+0.507812 0.5625 0.484375 
+0.507812 0.554688 0.484375 
+0.515625 0.554688 0.484375 
+0.507812 0.5625 0.492188 
+0.515625 0.5625 0.492188 
+0.523438 0.5625 0.492188 
+0.515625 0.546875 0.476562 
+0.515625 0.5625 0.476562 
+0.515625 0.554688 0.476562 
+0.523438 0.554688 0.476562 
+0.523438 0.5625 0.476562 
+0.53125 0.5625 0.476562 
+0.523438 0.5625 0.484375 
+0.523438 0.554688 0.484375 
+0.53125 0.5625 0.492188 
+0.53125 0.546875 0.476562 
+0.523438 0.546875 0.476562 
+0.53125 0.554688 0.476562 
+0.53125 0.554688 0.484375 
+0.539062 0.546875 0.476562 
+0.539062 0.554688 0.476562 
+0.539062 0.5625 0.476562 
+0.539062 0.5625 0.484375 
+0.539062 0.554688 0.484375 
+0.546875 0.554688 0.484375 
+0.539062 0.5625 0.492188 
+0.546875 0.5625 0.492188 
+0.554688 0.5625 0.492188 
+0.515625 0.53125 0.445312 
+0.515625 0.523438 0.445312 
+0.523438 0.53125 0.445312 
+0.523438 0.53125 0.453125 
+0.515625 0.546875 0.445312 
+0.515625 0.5625 0.445312 
+0.515625 0.554688 0.445312 
+0.523438 0.554688 0.445312 
+0.523438 0.5625 0.445312 
+0.53125 0.5625 0.445312 
+0.523438 0.5625 0.453125 
+0.523438 0.554688 0.453125 
+0.53125 0.5625 0.460938 
+0.515625 0.539062 0.445312 
+0.523438 0.539062 0.445312 
+0.53125 0.539062 0.445312 
+0.53125 0.546875 0.445312 
+0.523438 0.546875 0.445312 
+0.523438 0.546875 0.453125 
+0.53125 0.554688 0.445312 
+0.53125 0.554688 0.453125 
+0.53125 0.554688 0.460938 
+0.53125 0.539062 0.453125 
+0.523438 0.539062 0.453125 
+0.53125 0.539062 0.460938 
+0.53125 0.546875 0.460938 
+0.539062 0.546875 0.445312 
+0.539062 0.554688 0.445312 
+0.539062 0.5625 0.445312 
+0.546875 0.5625 0.445312 
+0.546875 0.554688 0.445312 
+0.546875 0.554688 0.453125 
+0.554688 0.5625 0.445312 
+0.554688 0.5625 0.453125 
+0.554688 0.5625 0.460938 
+0.539062 0.546875 0.453125 
+0.539062 0.5625 0.453125 
+0.539062 0.554688 0.453125 
+0.539062 0.554688 0.460938 
+0.539062 0.5625 0.460938 
+0.539062 0.5625 0.46875 
+0.546875 0.5625 0.460938 
+0.546875 0.554688 0.460938 
+0.554688 0.5625 0.46875 
+0.539062 0.546875 0.46875 
+0.539062 0.546875 0.460938 
+0.539062 0.554688 0.46875 
+0.546875 0.554688 0.46875 
+0.546875 0.5625 0.476562 
+0.546875 0.554688 0.476562 
+0.554688 0.5625 0.476562 
+0.554688 0.5625 0.484375 
+0.507812 0.570312 0.445312 
+0.507812 0.570312 0.453125 
+0.507812 0.578125 0.453125 
+0.507812 0.570312 0.460938 
+0.507812 0.570312 0.46875 
+0.507812 0.578125 0.46875 
+0.507812 0.578125 0.460938 
+0.515625 0.578125 0.460938 
+0.507812 0.585938 0.460938 
+0.507812 0.585938 0.46875 
+0.507812 0.59375 0.46875 
+0.515625 0.585938 0.46875 
+0.515625 0.585938 0.460938 
+0.523438 0.585938 0.460938 
+0.523438 0.585938 0.46875 
+0.523438 0.59375 0.46875 
+0.507812 0.570312 0.476562 
+0.507812 0.570312 0.484375 
+0.507812 0.578125 0.484375 
+0.507812 0.570312 0.492188 
+0.507812 0.570312 0.5 
+0.507812 0.578125 0.5 
+0.507812 0.578125 0.492188 
+0.515625 0.578125 0.492188 
+0.507812 0.585938 0.492188 
+0.507812 0.585938 0.5 
+0.507812 0.59375 0.5 
+0.515625 0.585938 0.5 
+0.515625 0.585938 0.492188 
+0.523438 0.585938 0.492188 
+0.523438 0.585938 0.5 
+0.523438 0.59375 0.5 
+0.507812 0.578125 0.476562 
+0.507812 0.585938 0.476562 
+0.507812 0.59375 0.476562 
+0.507812 0.59375 0.484375 
+0.507812 0.585938 0.484375 
+0.515625 0.585938 0.484375 
+0.507812 0.59375 0.492188 
+0.515625 0.59375 0.492188 
+0.523438 0.59375 0.492188 
+0.515625 0.578125 0.476562 
+0.515625 0.59375 0.476562 
+0.515625 0.585938 0.476562 
+0.523438 0.585938 0.476562 
+0.523438 0.59375 0.476562 
+0.53125 0.59375 0.476562 
+0.523438 0.59375 0.484375 
+0.523438 0.585938 0.484375 
+0.53125 0.59375 0.492188 
+0.515625 0.570312 0.453125 
+0.515625 0.570312 0.46875 
+0.515625 0.570312 0.460938 
+0.523438 0.570312 0.460938 
+0.523438 0.570312 0.46875 
+0.523438 0.578125 0.46875 
+0.523438 0.578125 0.460938 
+0.515625 0.570312 0.484375 
+0.515625 0.570312 0.5 
+0.515625 0.570312 0.492188 
+0.523438 0.570312 0.492188 
+0.523438 0.570312 0.5 
+0.53125 0.570312 0.5 
+0.523438 0.578125 0.5 
+0.523438 0.578125 0.492188 
+0.53125 0.585938 0.5 
+0.515625 0.570312 0.476562 
+0.523438 0.570312 0.476562 
+0.53125 0.570312 0.476562 
+0.53125 0.570312 0.484375 
+0.523438 0.570312 0.484375 
+0.523438 0.578125 0.484375 
+0.53125 0.570312 0.492188 
+0.53125 0.578125 0.492188 
+0.53125 0.585938 0.492188 
+0.53125 0.578125 0.476562 
+0.523438 0.578125 0.476562 
+0.53125 0.585938 0.476562 
+0.53125 0.585938 0.484375 
+0.539062 0.570312 0.484375 
+0.546875 0.570312 0.484375 
+0.539062 0.570312 0.492188 
+0.539062 0.570312 0.5 
+0.546875 0.570312 0.5 
+0.546875 0.570312 0.492188 
+0.546875 0.578125 0.492188 
+0.554688 0.570312 0.492188 
+0.554688 0.570312 0.5 
+0.5625 0.570312 0.5 
+0.554688 0.578125 0.5 
+0.554688 0.578125 0.492188 
+0.554688 0.585938 0.5 
+0.5625 0.585938 0.5 
+0.539062 0.578125 0.484375 
+0.539062 0.578125 0.5 
+0.539062 0.578125 0.492188 
+0.539062 0.585938 0.492188 
+0.539062 0.585938 0.5 
+0.539062 0.59375 0.5 
+0.546875 0.585938 0.5 
+0.546875 0.585938 0.492188 
+0.554688 0.59375 0.5 
+0.539062 0.59375 0.484375 
+0.539062 0.585938 0.484375 
+0.539062 0.59375 0.492188 
+0.546875 0.59375 0.492188 
+0.515625 0.570312 0.445312 
+0.523438 0.570312 0.445312 
+0.53125 0.570312 0.445312 
+0.53125 0.570312 0.453125 
+0.523438 0.570312 0.453125 
+0.523438 0.578125 0.453125 
+0.53125 0.570312 0.460938 
+0.53125 0.578125 0.460938 
+0.53125 0.585938 0.460938 
+0.539062 0.570312 0.445312 
+0.546875 0.570312 0.453125 
+0.554688 0.570312 0.460938 
+0.5625 0.570312 0.46875 
+0.539062 0.570312 0.453125 
+0.539062 0.570312 0.460938 
+0.546875 0.570312 0.46875 
+0.546875 0.570312 0.460938 
+0.546875 0.578125 0.460938 
+0.554688 0.570312 0.46875 
+0.554688 0.578125 0.460938 
+0.539062 0.578125 0.453125 
+0.539062 0.578125 0.460938 
+0.539062 0.585938 0.460938 
+0.546875 0.570312 0.476562 
+0.554688 0.570312 0.476562 
+0.5625 0.570312 0.476562 
+0.5625 0.570312 0.484375 
+0.554688 0.570312 0.484375 
+0.5625 0.570312 0.492188 
+0.5625 0.578125 0.492188 
+0.5625 0.492188 0.570312 
+0.5625 0.492188 0.578125 
+0.546875 0.476562 0.578125 
+0.5625 0.476562 0.578125 
+0.554688 0.476562 0.578125 
+0.421875 0.515625 0.507812 
+0.429688 0.515625 0.507812 
+0.429688 0.523438 0.507812 
+0.429688 0.523438 0.515625 
+0.414062 0.515625 0.507812 
+0.414062 0.523438 0.507812 
+0.414062 0.53125 0.507812 
+0.421875 0.53125 0.507812 
+0.421875 0.523438 0.507812 
+0.421875 0.523438 0.515625 
+0.429688 0.53125 0.507812 
+0.429688 0.53125 0.515625 
+0.429688 0.53125 0.523438 
+0.40625 0.515625 0.507812 
+0.40625 0.523438 0.507812 
+0.40625 0.53125 0.507812 
+0.414062 0.53125 0.515625 
+0.40625 0.523438 0.515625 
+0.414062 0.523438 0.515625 
+0.40625 0.53125 0.523438 
+0.414062 0.53125 0.523438 
+0.421875 0.53125 0.523438 
+0.414062 0.539062 0.507812 
+0.421875 0.539062 0.507812 
+0.421875 0.546875 0.507812 
+0.429688 0.539062 0.507812 
+0.429688 0.546875 0.507812 
+0.429688 0.546875 0.515625 
+0.429688 0.554688 0.507812 
+0.429688 0.554688 0.515625 
+0.429688 0.554688 0.523438 
+0.421875 0.539062 0.515625 
+0.429688 0.539062 0.515625 
+0.429688 0.539062 0.523438 
+0.429688 0.546875 0.523438 
+0.414062 0.539062 0.515625 
+0.414062 0.539062 0.523438 
+0.414062 0.539062 0.53125 
+0.421875 0.539062 0.53125 
+0.421875 0.539062 0.523438 
+0.421875 0.546875 0.523438 
+0.429688 0.539062 0.53125 
+0.429688 0.546875 0.53125 
+0.429688 0.554688 0.53125 
+0.421875 0.546875 0.539062 
+0.429688 0.546875 0.539062 
+0.429688 0.554688 0.539062 
+0.429688 0.554688 0.546875 
+0.46875 0.515625 0.507812 
+0.460938 0.515625 0.507812 
+0.46875 0.523438 0.507812 
+0.46875 0.523438 0.515625 
+0.484375 0.515625 0.507812 
+0.5 0.515625 0.507812 
+0.492188 0.515625 0.507812 
+0.492188 0.523438 0.507812 
+0.5 0.523438 0.507812 
+0.5 0.53125 0.507812 
+0.5 0.523438 0.515625 
+0.492188 0.523438 0.515625 
+0.5 0.53125 0.523438 
+0.476562 0.515625 0.507812 
+0.476562 0.523438 0.507812 
+0.476562 0.53125 0.507812 
+0.484375 0.53125 0.507812 
+0.484375 0.523438 0.507812 
+0.484375 0.523438 0.515625 
+0.492188 0.53125 0.507812 
+0.492188 0.53125 0.515625 
+0.476562 0.53125 0.515625 
+0.476562 0.523438 0.515625 
+0.476562 0.53125 0.523438 
+0.484375 0.539062 0.507812 
+0.492188 0.539062 0.507812 
+0.5 0.539062 0.507812 
+0.5 0.546875 0.507812 
+0.492188 0.546875 0.507812 
+0.492188 0.546875 0.515625 
+0.5 0.554688 0.507812 
+0.5 0.554688 0.515625 
+0.5 0.554688 0.523438 
+0.5 0.539062 0.515625 
+0.492188 0.539062 0.515625 
+0.5 0.539062 0.523438 
+0.5 0.546875 0.523438 
+0.554688 0.578125 0.46875 
+0.554688 0.578125 0.476562 
+0.5625 0.578125 0.476562 
+0.546875 0.578125 0.476562 
+0.554688 0.578125 0.484375 
+0.554688 0.585938 0.492188 
+0.53125 0.570312 0.46875 
+0.539062 0.570312 0.46875 
+0.539062 0.578125 0.46875 
+0.539062 0.570312 0.476562 
+0.539062 0.578125 0.476562 
+0.53125 0.585938 0.46875 
+0.539062 0.585938 0.46875 
+0.539062 0.59375 0.46875 
+0.539062 0.585938 0.476562 
+0.539062 0.59375 0.476562 
+0.546875 0.585938 0.46875 
+0.546875 0.585938 0.484375 
+0.476562 0.40625 0.5 
+0.476562 0.414062 0.5 
+0.484375 0.414062 0.5 
+0.476562 0.414062 0.507812 
+0.484375 0.414062 0.507812 
+0.484375 0.421875 0.507812 
+0.492188 0.40625 0.5 
+0.492188 0.414062 0.5 
+0.5 0.414062 0.5 
+0.492188 0.414062 0.507812 
+0.5 0.414062 0.507812 
+0.5 0.421875 0.507812 
+0.492188 0.421875 0.5 
+0.492188 0.421875 0.507812 
+0.492188 0.421875 0.515625 
+0.492188 0.429688 0.5 
+0.5 0.429688 0.5 
+0.492188 0.429688 0.507812 
+0.5 0.429688 0.507812 
+0.5 0.4375 0.507812 
+0.5 0.429688 0.515625 
+0.492188 0.429688 0.515625 
+0.492188 0.429688 0.523438 
+0.5 0.429688 0.523438 
+0.5 0.4375 0.523438 
+0.476562 0.40625 0.507812 
+0.484375 0.40625 0.507812 
+0.484375 0.414062 0.515625 
+0.492188 0.40625 0.507812 
+0.5 0.40625 0.507812 
+0.5 0.414062 0.515625 
+0.492188 0.40625 0.515625 
+0.492188 0.414062 0.515625 
+0.492188 0.40625 0.523438 
+0.5 0.40625 0.523438 
+0.492188 0.414062 0.523438 
+0.5 0.414062 0.523438 
+0.5 0.414062 0.53125 
+0.5 0.421875 0.523438 
+0.492188 0.421875 0.523438 
+0.5 0.429688 0.53125 
+0.46875 0.40625 0.507812 
+0.476562 0.40625 0.515625 
+0.476562 0.414062 0.515625 
+0.46875 0.40625 0.523438 
+0.476562 0.40625 0.523438 
+0.476562 0.40625 0.53125 
+0.476562 0.414062 0.523438 
+0.476562 0.414062 0.53125 
+0.484375 0.414062 0.53125 
+0.484375 0.40625 0.523438 
+0.484375 0.414062 0.523438 
+0.484375 0.421875 0.523438 
+0.492188 0.40625 0.53125 
+0.492188 0.414062 0.53125 
+0.492188 0.421875 0.53125 
+0.492188 0.429688 0.53125 
+0.476562 0.414062 0.539062 
+0.484375 0.414062 0.539062 
+0.484375 0.421875 0.539062 
+0.492188 0.414062 0.539062 
+0.5 0.414062 0.539062 
+0.5 0.421875 0.539062 
+0.492188 0.421875 0.539062 
+0.492188 0.421875 0.546875 
+0.492188 0.429688 0.539062 
+0.5 0.429688 0.539062 
+0.5 0.4375 0.539062 
+0.5 0.429688 0.546875 
+0.492188 0.429688 0.546875 
+0.492188 0.429688 0.554688 
+0.5 0.429688 0.554688 
+0.5 0.4375 0.554688 
+0.4375 0.414062 0.5 
+0.445312 0.414062 0.5 
+0.445312 0.421875 0.5 
+0.445312 0.414062 0.507812 
+0.445312 0.421875 0.507812 
+0.453125 0.421875 0.507812 
+0.4375 0.429688 0.5 
+0.445312 0.429688 0.5 
+0.445312 0.4375 0.5 
+0.445312 0.429688 0.507812 
+0.445312 0.4375 0.507812 
+0.453125 0.4375 0.507812 
+0.453125 0.429688 0.5 
+0.453125 0.429688 0.507812 
+0.453125 0.429688 0.515625 
+0.460938 0.429688 0.5 
+0.460938 0.4375 0.5 
+0.460938 0.429688 0.507812 
+0.460938 0.4375 0.507812 
+0.46875 0.4375 0.507812 
+0.460938 0.4375 0.515625 
+0.460938 0.429688 0.515625 
+0.460938 0.429688 0.523438 
+0.460938 0.4375 0.523438 
+0.46875 0.4375 0.523438 
+0.445312 0.40625 0.5 
+0.453125 0.414062 0.5 
+0.453125 0.414062 0.507812 
+0.460938 0.40625 0.5 
+0.460938 0.414062 0.5 
+0.46875 0.414062 0.5 
+0.460938 0.414062 0.507812 
+0.46875 0.414062 0.507812 
+0.46875 0.421875 0.507812 
+0.460938 0.421875 0.5 
+0.460938 0.421875 0.507812 
+0.460938 0.421875 0.515625 
+0.46875 0.429688 0.5 
+0.46875 0.429688 0.507812 
+0.46875 0.429688 0.515625 
+0.46875 0.429688 0.523438 
+0.453125 0.40625 0.507812 
+0.453125 0.414062 0.515625 
+0.460938 0.40625 0.507812 
+0.46875 0.414062 0.515625 
+0.460938 0.40625 0.515625 
+0.460938 0.414062 0.515625 
+0.460938 0.40625 0.523438 
+0.460938 0.414062 0.523438 
+0.46875 0.414062 0.523438 
+0.46875 0.414062 0.53125 
+0.46875 0.421875 0.523438 
+0.460938 0.421875 0.523438 
+0.46875 0.429688 0.53125 
+0.476562 0.421875 0.5 
+0.476562 0.421875 0.507812 
+0.476562 0.429688 0.5 
+0.476562 0.4375 0.5 
+0.476562 0.429688 0.507812 
+0.476562 0.4375 0.507812 
+0.484375 0.4375 0.507812 
+0.484375 0.429688 0.5 
+0.484375 0.429688 0.507812 
+0.484375 0.429688 0.515625 
+0.492188 0.4375 0.5 
+0.492188 0.4375 0.507812 
+0.492188 0.4375 0.515625 
+0.492188 0.4375 0.523438 
+0.476562 0.421875 0.515625 
+0.476562 0.4375 0.515625 
+0.476562 0.429688 0.515625 
+0.476562 0.429688 0.523438 
+0.476562 0.4375 0.523438 
+0.476562 0.4375 0.53125 
+0.484375 0.4375 0.523438 
+0.484375 0.429688 0.523438 
+0.492188 0.4375 0.53125 
+0.476562 0.421875 0.53125 
+0.476562 0.421875 0.523438 
+0.476562 0.429688 0.53125 
+0.484375 0.429688 0.53125 
+0.476562 0.421875 0.539062 
+0.476562 0.429688 0.539062 
+0.476562 0.4375 0.539062 
+0.484375 0.4375 0.539062 
+0.484375 0.429688 0.539062 
+0.484375 0.429688 0.546875 
+0.492188 0.4375 0.539062 
+0.492188 0.4375 0.546875 
+0.492188 0.4375 0.554688 
+0.4375 0.421875 0.507812 
+0.445312 0.421875 0.515625 
+0.4375 0.429688 0.507812 
+0.4375 0.4375 0.507812 
+0.445312 0.4375 0.515625 
+0.4375 0.429688 0.515625 
+0.445312 0.429688 0.515625 
+0.4375 0.429688 0.523438 
+0.4375 0.4375 0.523438 
+0.445312 0.429688 0.523438 
+0.445312 0.4375 0.523438 
+0.445312 0.4375 0.53125 
+0.453125 0.4375 0.523438 
+0.453125 0.429688 0.523438 
+0.460938 0.4375 0.53125 
+0.445312 0.421875 0.53125 
+0.4375 0.421875 0.523438 
+0.445312 0.421875 0.523438 
+0.453125 0.421875 0.523438 
+0.4375 0.429688 0.53125 
+0.445312 0.429688 0.53125 
+0.453125 0.429688 0.53125 
+0.460938 0.429688 0.53125 
+0.453125 0.414062 0.53125 
+0.460938 0.40625 0.53125 
+0.460938 0.414062 0.53125 
+0.460938 0.421875 0.53125 
+0.4375 0.4375 0.539062 
+0.445312 0.429688 0.539062 
+0.445312 0.4375 0.539062 
+0.445312 0.4375 0.546875 
+0.453125 0.429688 0.546875 
+0.453125 0.4375 0.554688 
+0.460938 0.429688 0.554688 
+0.460938 0.4375 0.554688 
+0.460938 0.4375 0.5625 
+0.445312 0.421875 0.539062 
+0.453125 0.421875 0.539062 
+0.453125 0.4375 0.539062 
+0.539062 0.46875 0.53125 
+0.539062 0.46875 0.539062 
+0.546875 0.46875 0.539062 
+0.539062 0.476562 0.539062 
+0.546875 0.476562 0.539062 
+0.546875 0.476562 0.546875 
+0.554688 0.46875 0.53125 
+0.554688 0.46875 0.539062 
+0.5625 0.46875 0.539062 
+0.554688 0.476562 0.539062 
+0.5625 0.476562 0.539062 
+0.5625 0.476562 0.546875 
+0.554688 0.46875 0.546875 
+0.554688 0.476562 0.546875 
+0.554688 0.484375 0.546875 
+0.554688 0.46875 0.554688 
+0.5625 0.46875 0.554688 
+0.554688 0.476562 0.554688 
+0.5625 0.476562 0.554688 
+0.5625 0.476562 0.5625 
+0.5625 0.484375 0.554688 
+0.554688 0.484375 0.554688 
+0.554688 0.492188 0.554688 
+0.5625 0.492188 0.554688 
+0.5625 0.492188 0.5625 
+0.5625 0.445312 0.5 
+0.570312 0.445312 0.5 
+0.570312 0.453125 0.5 
+0.570312 0.445312 0.507812 
+0.570312 0.453125 0.507812 
+0.578125 0.453125 0.507812 
+0.5625 0.460938 0.5 
+0.570312 0.460938 0.5 
+0.570312 0.46875 0.5 
+0.570312 0.460938 0.507812 
+0.570312 0.46875 0.507812 
+0.578125 0.46875 0.507812 
+0.578125 0.460938 0.5 
+0.578125 0.460938 0.507812 
+0.578125 0.460938 0.515625 
+0.585938 0.460938 0.5 
+0.585938 0.46875 0.5 
+0.585938 0.460938 0.507812 
+0.585938 0.46875 0.507812 
+0.59375 0.46875 0.507812 
+0.585938 0.46875 0.515625 
+0.585938 0.460938 0.515625 
+0.585938 0.460938 0.523438 
+0.585938 0.46875 0.523438 
+0.59375 0.46875 0.523438 
+0.5625 0.476562 0.5 
+0.570312 0.476562 0.5 
+0.570312 0.484375 0.5 
+0.570312 0.476562 0.507812 
+0.570312 0.484375 0.507812 
+0.578125 0.484375 0.507812 
+0.5625 0.492188 0.5 
+0.570312 0.492188 0.5 
+0.570312 0.5 0.5 
+0.570312 0.492188 0.507812 
+0.570312 0.5 0.507812 
+0.578125 0.5 0.507812 
+0.578125 0.492188 0.5 
+0.578125 0.492188 0.507812 
+0.578125 0.492188 0.515625 
+0.585938 0.492188 0.5 
+0.585938 0.5 0.5 
+0.585938 0.492188 0.507812 
+0.585938 0.5 0.507812 
+0.59375 0.5 0.507812 
+0.585938 0.5 0.515625 
+0.585938 0.492188 0.515625 
+0.585938 0.492188 0.523438 
+0.585938 0.5 0.523438 
+0.59375 0.5 0.523438 
+0.578125 0.476562 0.5 
+0.578125 0.476562 0.507812 
+0.585938 0.476562 0.5 
+0.59375 0.476562 0.5 
+0.585938 0.476562 0.507812 
+0.59375 0.476562 0.507812 
+0.59375 0.484375 0.507812 
+0.585938 0.484375 0.5 
+0.585938 0.484375 0.507812 
+0.585938 0.484375 0.515625 
+0.59375 0.492188 0.5 
+0.59375 0.492188 0.507812 
+0.59375 0.492188 0.515625 
+0.59375 0.492188 0.523438 
+0.578125 0.476562 0.515625 
+0.59375 0.476562 0.515625 
+0.585938 0.476562 0.515625 
+0.585938 0.476562 0.523438 
+0.59375 0.476562 0.523438 
+0.59375 0.476562 0.53125 
+0.59375 0.484375 0.523438 
+0.585938 0.484375 0.523438 
+0.59375 0.492188 0.53125 
+0.5625 0.445312 0.507812 
+0.5625 0.453125 0.507812 
+0.570312 0.453125 0.515625 
+0.5625 0.460938 0.507812 
+0.5625 0.46875 0.507812 
+0.570312 0.46875 0.515625 
+0.5625 0.460938 0.515625 
+0.570312 0.460938 0.515625 
+0.5625 0.460938 0.523438 
+0.5625 0.46875 0.523438 
+0.570312 0.460938 0.523438 
+0.570312 0.46875 0.523438 
+0.570312 0.46875 0.53125 
+0.578125 0.46875 0.523438 
+0.578125 0.460938 0.523438 
+0.585938 0.46875 0.53125 
+0.5625 0.476562 0.507812 
+0.5625 0.484375 0.507812 
+0.570312 0.484375 0.515625 
+0.5625 0.492188 0.507812 
+0.5625 0.5 0.507812 
+0.570312 0.5 0.515625 
+0.5625 0.492188 0.515625 
+0.570312 0.492188 0.515625 
+0.5625 0.492188 0.523438 
+0.5625 0.5 0.523438 
+0.570312 0.492188 0.523438 
+0.570312 0.5 0.523438 
+0.570312 0.5 0.53125 
+0.578125 0.5 0.523438 
+0.578125 0.492188 0.523438 
+0.585938 0.5 0.53125 
+0.5625 0.476562 0.515625 
+0.570312 0.476562 0.515625 
+0.5625 0.476562 0.523438 
+0.5625 0.476562 0.53125 
+0.570312 0.476562 0.523438 
+0.570312 0.476562 0.53125 
+0.570312 0.484375 0.53125 
+0.5625 0.484375 0.523438 
+0.570312 0.484375 0.523438 
+0.578125 0.484375 0.523438 
+0.5625 0.492188 0.53125 
+0.570312 0.492188 0.53125 
+0.578125 0.492188 0.53125 
+0.585938 0.492188 0.53125 
+0.578125 0.476562 0.53125 
+0.578125 0.476562 0.523438 
+0.585938 0.476562 0.53125 
+0.585938 0.484375 0.53125 
+0.5625 0.484375 0.539062 
+0.570312 0.476562 0.539062 
+0.570312 0.484375 0.539062 
+0.570312 0.484375 0.546875 
+0.5625 0.492188 0.539062 
+0.5625 0.5 0.539062 
+0.570312 0.492188 0.539062 
+0.570312 0.5 0.539062 
+0.570312 0.5 0.546875 
+0.5625 0.492188 0.546875 
+0.570312 0.492188 0.546875 
+0.578125 0.492188 0.546875 
+0.5625 0.5 0.554688 
+0.570312 0.492188 0.554688 
+0.570312 0.5 0.554688 
+0.570312 0.5 0.5625 
+0.578125 0.5 0.554688 
+0.578125 0.492188 0.554688 
+0.585938 0.492188 0.554688 
+0.585938 0.5 0.554688 
+0.585938 0.5 0.5625 
+0.578125 0.484375 0.539062 
+0.578125 0.5 0.539062 
+0.578125 0.492188 0.539062 
+0.585938 0.492188 0.539062 
+0.585938 0.5 0.539062 
+0.59375 0.5 0.539062 
+0.585938 0.5 0.546875 
+0.585938 0.492188 0.546875 
+0.59375 0.5 0.554688 
+0.578125 0.476562 0.539062 
+0.585938 0.476562 0.539062 
+0.59375 0.476562 0.539062 
+0.59375 0.484375 0.539062 
+0.585938 0.484375 0.539062 
+0.585938 0.484375 0.546875 
+0.59375 0.492188 0.539062 
+0.59375 0.492188 0.546875 
+0.5625 0.4375 0.507812 
+0.5625 0.445312 0.515625 
+0.570312 0.445312 0.515625 
+0.5625 0.4375 0.523438 
+0.5625 0.445312 0.523438 
+0.5625 0.445312 0.53125 
+0.570312 0.445312 0.523438 
+0.570312 0.445312 0.53125 
+0.570312 0.453125 0.53125 
+0.5625 0.453125 0.523438 
+0.570312 0.453125 0.523438 
+0.578125 0.453125 0.523438 
+0.5625 0.460938 0.53125 
+0.570312 0.460938 0.53125 
+0.578125 0.460938 0.53125 
+0.585938 0.460938 0.53125 
+0.5625 0.4375 0.539062 
+0.5625 0.445312 0.539062 
+0.5625 0.445312 0.546875 
+0.570312 0.445312 0.539062 
+0.570312 0.453125 0.546875 
+0.5625 0.453125 0.554688 
+0.5625 0.460938 0.554688 
+0.5625 0.460938 0.5625 
+0.570312 0.460938 0.554688 
+0.570312 0.46875 0.5625 
+0.5625 0.453125 0.539062 
+0.570312 0.453125 0.539062 
+0.5625 0.460938 0.539062 
+0.570312 0.460938 0.539062 
+0.570312 0.46875 0.539062 
+0.570312 0.46875 0.546875 
+0.5625 0.460938 0.546875 
+0.570312 0.460938 0.546875 
+0.578125 0.460938 0.546875 
+0.570312 0.46875 0.554688 
+0.578125 0.46875 0.554688 
+0.578125 0.460938 0.554688 
+0.578125 0.453125 0.539062 
+0.578125 0.46875 0.539062 
+0.578125 0.460938 0.539062 
+0.585938 0.460938 0.539062 
+0.585938 0.46875 0.539062 
+0.59375 0.46875 0.539062 
+0.585938 0.46875 0.546875 
+0.570312 0.476562 0.546875 
+0.570312 0.476562 0.554688 
+0.570312 0.476562 0.5625 
+0.570312 0.484375 0.5625 
+0.570312 0.484375 0.554688 
+0.578125 0.484375 0.554688 
+0.570312 0.492188 0.5625 
+0.578125 0.492188 0.5625 
+0.484375 0.585938 0.476562 
+0.484375 0.585938 0.484375 
+0.492188 0.59375 0.476562 
+0.492188 0.59375 0.484375 
+0.492188 0.59375 0.492188 
+0.40625 0.5 0.476562 
+0.414062 0.5 0.476562 
+0.414062 0.5 0.484375 
+0.414062 0.507812 0.476562 
+0.414062 0.507812 0.484375 
+0.421875 0.507812 0.484375 
+0.40625 0.5 0.492188 
+0.414062 0.5 0.492188 
+0.414062 0.507812 0.492188 
+0.414062 0.507812 0.5 
+0.421875 0.507812 0.5 
+0.421875 0.5 0.492188 
+0.421875 0.507812 0.492188 
+0.421875 0.515625 0.492188 
+0.429688 0.5 0.492188 
+0.429688 0.507812 0.492188 
+0.429688 0.507812 0.5 
+0.4375 0.507812 0.5 
+0.429688 0.515625 0.5 
+0.429688 0.515625 0.492188 
+0.429688 0.523438 0.492188 
+0.429688 0.523438 0.5 
+0.4375 0.523438 0.5 
+0.40625 0.507812 0.476562 
+0.40625 0.507812 0.484375 
+0.414062 0.515625 0.484375 
+0.40625 0.507812 0.492188 
+0.40625 0.507812 0.5 
+0.414062 0.515625 0.5 
+0.40625 0.515625 0.492188 
+0.414062 0.515625 0.492188 
+0.40625 0.523438 0.492188 
+0.40625 0.523438 0.5 
+0.414062 0.523438 0.492188 
+0.414062 0.523438 0.5 
+0.414062 0.53125 0.5 
+0.421875 0.523438 0.5 
+0.421875 0.523438 0.492188 
+0.429688 0.53125 0.5 
+0.40625 0.507812 0.46875 
+0.40625 0.515625 0.476562 
+0.414062 0.515625 0.476562 
+0.40625 0.523438 0.46875 
+0.40625 0.523438 0.476562 
+0.40625 0.53125 0.476562 
+0.414062 0.523438 0.476562 
+0.414062 0.53125 0.476562 
+0.414062 0.53125 0.484375 
+0.40625 0.523438 0.484375 
+0.414062 0.523438 0.484375 
+0.421875 0.523438 0.484375 
+0.40625 0.53125 0.492188 
+0.414062 0.53125 0.492188 
+0.421875 0.53125 0.492188 
+0.429688 0.53125 0.492188 
+0.414062 0.539062 0.476562 
+0.414062 0.539062 0.484375 
+0.421875 0.539062 0.484375 
+0.414062 0.539062 0.492188 
+0.414062 0.539062 0.5 
+0.421875 0.539062 0.5 
+0.421875 0.539062 0.492188 
+0.421875 0.546875 0.492188 
+0.429688 0.539062 0.492188 
+0.429688 0.539062 0.5 
+0.4375 0.539062 0.5 
+0.429688 0.546875 0.5 
+0.429688 0.546875 0.492188 
+0.429688 0.554688 0.492188 
+0.429688 0.554688 0.5 
+0.4375 0.554688 0.5 
+0.414062 0.5 0.4375 
+0.414062 0.5 0.445312 
+0.421875 0.5 0.445312 
+0.414062 0.507812 0.445312 
+0.421875 0.507812 0.445312 
+0.421875 0.507812 0.453125 
+0.429688 0.5 0.4375 
+0.429688 0.5 0.445312 
+0.4375 0.5 0.445312 
+0.429688 0.507812 0.445312 
+0.4375 0.507812 0.445312 
+0.4375 0.507812 0.453125 
+0.429688 0.5 0.453125 
+0.429688 0.507812 0.453125 
+0.429688 0.515625 0.453125 
+0.429688 0.5 0.460938 
+0.4375 0.5 0.460938 
+0.429688 0.507812 0.460938 
+0.4375 0.507812 0.460938 
+0.4375 0.507812 0.46875 
+0.4375 0.515625 0.460938 
+0.429688 0.515625 0.460938 
+0.429688 0.523438 0.460938 
+0.4375 0.523438 0.460938 
+0.4375 0.523438 0.46875 
+0.40625 0.5 0.445312 
+0.414062 0.5 0.453125 
+0.414062 0.507812 0.453125 
+0.40625 0.5 0.460938 
+0.414062 0.5 0.460938 
+0.414062 0.5 0.46875 
+0.414062 0.507812 0.460938 
+0.414062 0.507812 0.46875 
+0.421875 0.507812 0.46875 
+0.421875 0.5 0.460938 
+0.421875 0.507812 0.460938 
+0.421875 0.515625 0.460938 
+0.429688 0.5 0.46875 
+0.429688 0.507812 0.46875 
+0.429688 0.515625 0.46875 
+0.429688 0.523438 0.46875 
+0.40625 0.507812 0.453125 
+0.414062 0.515625 0.453125 
+0.40625 0.507812 0.460938 
+0.414062 0.515625 0.46875 
+0.40625 0.515625 0.460938 
+0.414062 0.515625 0.460938 
+0.40625 0.523438 0.460938 
+0.414062 0.523438 0.460938 
+0.414062 0.523438 0.46875 
+0.414062 0.53125 0.46875 
+0.421875 0.523438 0.46875 
+0.421875 0.523438 0.460938 
+0.429688 0.53125 0.46875 
+0.421875 0.5 0.476562 
+0.421875 0.507812 0.476562 
+0.429688 0.5 0.476562 
+0.4375 0.5 0.476562 
+0.429688 0.507812 0.476562 
+0.4375 0.507812 0.476562 
+0.4375 0.507812 0.484375 
+0.429688 0.5 0.484375 
+0.429688 0.507812 0.484375 
+0.429688 0.515625 0.484375 
+0.4375 0.5 0.492188 
+0.4375 0.507812 0.492188 
+0.4375 0.515625 0.492188 
+0.4375 0.523438 0.492188 
+0.421875 0.515625 0.476562 
+0.4375 0.515625 0.476562 
+0.429688 0.515625 0.476562 
+0.429688 0.523438 0.476562 
+0.4375 0.523438 0.476562 
+0.4375 0.53125 0.476562 
+0.4375 0.523438 0.484375 
+0.429688 0.523438 0.484375 
+0.4375 0.53125 0.492188 
+0.421875 0.53125 0.476562 
+0.421875 0.523438 0.476562 
+0.429688 0.53125 0.476562 
+0.429688 0.53125 0.484375 
+0.421875 0.539062 0.476562 
+0.429688 0.539062 0.476562 
+0.4375 0.539062 0.476562 
+0.4375 0.539062 0.484375 
+0.429688 0.539062 0.484375 
+0.429688 0.546875 0.484375 
+0.4375 0.539062 0.492188 
+0.4375 0.546875 0.492188 
+0.4375 0.554688 0.492188 
+0.421875 0.507812 0.4375 
+0.421875 0.515625 0.445312 
+0.429688 0.507812 0.4375 
+0.4375 0.515625 0.445312 
+0.429688 0.515625 0.4375 
+0.429688 0.515625 0.445312 
+0.429688 0.523438 0.4375 
+0.429688 0.523438 0.445312 
+0.4375 0.523438 0.445312 
+0.4375 0.53125 0.445312 
+0.4375 0.523438 0.453125 
+0.429688 0.523438 0.453125 
+0.4375 0.53125 0.460938 
+0.421875 0.53125 0.445312 
+0.421875 0.523438 0.4375 
+0.421875 0.523438 0.445312 
+0.421875 0.523438 0.453125 
+0.429688 0.53125 0.4375 
+0.429688 0.53125 0.445312 
+0.429688 0.53125 0.453125 
+0.429688 0.53125 0.460938 
+0.414062 0.53125 0.453125 
+0.40625 0.53125 0.460938 
+0.414062 0.53125 0.460938 
+0.421875 0.53125 0.460938 
+0.429688 0.539062 0.445312 
+0.4375 0.539062 0.445312 
+0.4375 0.546875 0.445312 
+0.429688 0.546875 0.453125 
+0.4375 0.554688 0.453125 
+0.429688 0.554688 0.460938 
+0.4375 0.554688 0.460938 
+0.4375 0.5625 0.460938 
+0.421875 0.539062 0.445312 
+0.421875 0.539062 0.453125 
+0.4375 0.539062 0.453125 
+0.429688 0.539062 0.453125 
+0.429688 0.539062 0.460938 
+0.4375 0.539062 0.460938 
+0.4375 0.539062 0.46875 
+0.4375 0.546875 0.460938 
+0.429688 0.546875 0.460938 
+0.4375 0.554688 0.46875 
+0.492188 0.476562 0.578125 
+0.492188 0.476562 0.585938 
+0.5 0.476562 0.585938 
+0.5 0.476562 0.59375 
+0.5 0.484375 0.585938 
+0.492188 0.484375 0.585938 
+0.5 0.492188 0.59375 
+0.476562 0.476562 0.578125 
+0.476562 0.476562 0.585938 
+0.476562 0.476562 0.59375 
+0.484375 0.476562 0.59375 
+0.484375 0.476562 0.585938 
+0.484375 0.484375 0.585938 
+0.492188 0.476562 0.59375 
+0.492188 0.484375 0.59375 
+0.492188 0.492188 0.59375 
+0.40625 0.476562 0.5 
+0.414062 0.476562 0.5 
+0.414062 0.484375 0.5 
+0.414062 0.476562 0.507812 
+0.414062 0.484375 0.507812 
+0.421875 0.484375 0.507812 
+0.40625 0.492188 0.5 
+0.414062 0.492188 0.5 
+0.414062 0.492188 0.507812 
+0.421875 0.492188 0.5 
+0.421875 0.492188 0.507812 
+0.421875 0.492188 0.515625 
+0.429688 0.492188 0.5 
+0.429688 0.492188 0.507812 
+0.429688 0.492188 0.515625 
+0.429688 0.492188 0.523438 
+0.40625 0.476562 0.507812 
+0.40625 0.484375 0.507812 
+0.414062 0.484375 0.515625 
+0.40625 0.492188 0.507812 
+0.40625 0.492188 0.515625 
+0.414062 0.492188 0.515625 
+0.40625 0.492188 0.523438 
+0.414062 0.492188 0.523438 
+0.421875 0.492188 0.523438 
+0.40625 0.46875 0.507812 
+0.40625 0.476562 0.515625 
+0.414062 0.476562 0.515625 
+0.40625 0.46875 0.523438 
+0.40625 0.476562 0.523438 
+0.40625 0.476562 0.53125 
+0.414062 0.476562 0.523438 
+0.414062 0.476562 0.53125 
+0.414062 0.484375 0.53125 
+0.40625 0.484375 0.523438 
+0.414062 0.484375 0.523438 
+0.421875 0.484375 0.523438 
+0.40625 0.492188 0.53125 
+0.414062 0.492188 0.53125 
+0.421875 0.492188 0.53125 
+0.429688 0.492188 0.53125 
+0.414062 0.476562 0.539062 
+0.414062 0.484375 0.539062 
+0.421875 0.484375 0.539062 
+0.414062 0.492188 0.539062 
+0.421875 0.492188 0.539062 
+0.421875 0.492188 0.546875 
+0.429688 0.492188 0.539062 
+0.429688 0.492188 0.546875 
+0.429688 0.492188 0.554688 
+0.414062 0.4375 0.5 
+0.414062 0.445312 0.5 
+0.421875 0.445312 0.5 
+0.414062 0.445312 0.507812 
+0.421875 0.445312 0.507812 
+0.421875 0.453125 0.507812 
+0.429688 0.4375 0.5 
+0.429688 0.445312 0.5 
+0.4375 0.445312 0.5 
+0.429688 0.445312 0.507812 
+0.4375 0.445312 0.507812 
+0.4375 0.453125 0.507812 
+0.429688 0.453125 0.5 
+0.429688 0.453125 0.507812 
+0.429688 0.453125 0.515625 
+0.429688 0.460938 0.5 
+0.4375 0.460938 0.5 
+0.429688 0.460938 0.507812 
+0.4375 0.460938 0.507812 
+0.4375 0.46875 0.507812 
+0.4375 0.460938 0.515625 
+0.429688 0.460938 0.515625 
+0.429688 0.460938 0.523438 
+0.4375 0.460938 0.523438 
+0.4375 0.46875 0.523438 
+0.40625 0.445312 0.5 
+0.414062 0.453125 0.5 
+0.414062 0.453125 0.507812 
+0.40625 0.460938 0.5 
+0.414062 0.460938 0.5 
+0.414062 0.46875 0.5 
+0.414062 0.460938 0.507812 
+0.414062 0.46875 0.507812 
+0.421875 0.46875 0.507812 
+0.421875 0.460938 0.5 
+0.421875 0.460938 0.507812 
+0.421875 0.460938 0.515625 
+0.429688 0.46875 0.5 
+0.429688 0.46875 0.507812 
+0.429688 0.46875 0.515625 
+0.429688 0.46875 0.523438 
+0.40625 0.453125 0.507812 
+0.414062 0.453125 0.515625 
+0.40625 0.460938 0.507812 
+0.414062 0.46875 0.515625 
+0.40625 0.460938 0.515625 
+0.414062 0.460938 0.515625 
+0.40625 0.460938 0.523438 
+0.414062 0.460938 0.523438 
+0.414062 0.46875 0.523438 
+0.414062 0.46875 0.53125 
+0.421875 0.46875 0.523438 
+0.421875 0.460938 0.523438 
+0.429688 0.46875 0.53125 
+0.421875 0.476562 0.5 
+0.421875 0.476562 0.507812 
+0.429688 0.476562 0.5 
+0.4375 0.476562 0.5 
+0.429688 0.476562 0.507812 
+0.4375 0.476562 0.507812 
+0.4375 0.484375 0.507812 
+0.429688 0.484375 0.5 
+0.429688 0.484375 0.507812 
+0.429688 0.484375 0.515625 
+0.4375 0.492188 0.5 
+0.4375 0.492188 0.507812 
+0.4375 0.492188 0.515625 
+0.4375 0.492188 0.523438 
+0.421875 0.476562 0.515625 
+0.4375 0.476562 0.515625 
+0.429688 0.476562 0.515625 
+0.429688 0.476562 0.523438 
+0.4375 0.476562 0.523438 
+0.4375 0.476562 0.53125 
+0.4375 0.484375 0.523438 
+0.429688 0.484375 0.523438 
+0.4375 0.492188 0.53125 
+0.421875 0.476562 0.53125 
+0.421875 0.476562 0.523438 
+0.429688 0.476562 0.53125 
+0.429688 0.484375 0.53125 
+0.421875 0.476562 0.539062 
+0.429688 0.476562 0.539062 
+0.4375 0.476562 0.539062 
+0.4375 0.484375 0.539062 
+0.429688 0.484375 0.539062 
+0.429688 0.484375 0.546875 
+0.4375 0.492188 0.539062 
+0.4375 0.492188 0.546875 
+0.4375 0.492188 0.554688 
+0.421875 0.4375 0.507812 
+0.421875 0.445312 0.515625 
+0.429688 0.4375 0.507812 
+0.4375 0.445312 0.515625 
+0.429688 0.4375 0.515625 
+0.429688 0.445312 0.515625 
+0.429688 0.4375 0.523438 
+0.429688 0.445312 0.523438 
+0.4375 0.445312 0.523438 
+0.4375 0.445312 0.53125 
+0.4375 0.453125 0.523438 
+0.429688 0.453125 0.523438 
+0.4375 0.460938 0.53125 
+0.421875 0.445312 0.53125 
+0.421875 0.4375 0.523438 
+0.421875 0.445312 0.523438 
+0.421875 0.453125 0.523438 
+0.429688 0.4375 0.53125 
+0.429688 0.445312 0.53125 
+0.429688 0.453125 0.53125 
+0.429688 0.460938 0.53125 
+0.414062 0.453125 0.53125 
+0.40625 0.460938 0.53125 
+0.414062 0.460938 0.53125 
+0.421875 0.460938 0.53125 
+0.429688 0.445312 0.539062 
+0.4375 0.445312 0.539062 
+0.4375 0.445312 0.546875 
+0.429688 0.453125 0.546875 
+0.4375 0.453125 0.554688 
+0.429688 0.460938 0.554688 
+0.4375 0.460938 0.554688 
+0.4375 0.460938 0.5625 
+0.507812 0.507812 0.445312 
+0.515625 0.507812 0.445312 
+0.515625 0.507812 0.453125 
+0.523438 0.507812 0.445312 
+0.53125 0.507812 0.445312 
+0.53125 0.507812 0.453125 
+0.523438 0.507812 0.453125 
+0.523438 0.515625 0.453125 
+0.523438 0.507812 0.460938 
+0.53125 0.507812 0.460938 
+0.53125 0.507812 0.46875 
+0.53125 0.515625 0.460938 
+0.523438 0.515625 0.460938 
+0.523438 0.523438 0.460938 
+0.53125 0.523438 0.460938 
+0.53125 0.523438 0.46875 
+0.539062 0.507812 0.445312 
+0.546875 0.507812 0.445312 
+0.546875 0.507812 0.453125 
+0.554688 0.507812 0.445312 
+0.5625 0.507812 0.445312 
+0.5625 0.507812 0.453125 
+0.554688 0.507812 0.453125 
+0.554688 0.515625 0.453125 
+0.554688 0.507812 0.460938 
+0.5625 0.507812 0.460938 
+0.5625 0.507812 0.46875 
+0.5625 0.515625 0.460938 
+0.554688 0.515625 0.460938 
+0.554688 0.523438 0.460938 
+0.5625 0.523438 0.460938 
+0.5625 0.523438 0.46875 
+0.539062 0.507812 0.453125 
+0.539062 0.507812 0.460938 
+0.539062 0.507812 0.46875 
+0.546875 0.507812 0.46875 
+0.546875 0.507812 0.460938 
+0.546875 0.515625 0.460938 
+0.554688 0.507812 0.46875 
+0.554688 0.515625 0.46875 
+0.554688 0.523438 0.46875 
+0.539062 0.515625 0.453125 
+0.539062 0.515625 0.46875 
+0.539062 0.515625 0.460938 
+0.539062 0.523438 0.460938 
+0.539062 0.523438 0.46875 
+0.539062 0.53125 0.46875 
+0.546875 0.523438 0.46875 
+0.546875 0.523438 0.460938 
+0.554688 0.53125 0.46875 
+0.539062 0.507812 0.476562 
+0.546875 0.507812 0.476562 
+0.546875 0.507812 0.484375 
+0.554688 0.507812 0.476562 
+0.5625 0.507812 0.476562 
+0.5625 0.507812 0.484375 
+0.554688 0.507812 0.484375 
+0.554688 0.515625 0.484375 
+0.554688 0.507812 0.492188 
+0.5625 0.507812 0.492188 
+0.5625 0.507812 0.5 
+0.5625 0.515625 0.492188 
+0.554688 0.515625 0.492188 
+0.554688 0.523438 0.492188 
+0.5625 0.523438 0.492188 
+0.5625 0.523438 0.5 
+0.546875 0.515625 0.476562 
+0.5625 0.515625 0.476562 
+0.554688 0.515625 0.476562 
+0.554688 0.523438 0.476562 
+0.5625 0.523438 0.476562 
+0.5625 0.53125 0.476562 
+0.5625 0.523438 0.484375 
+0.554688 0.523438 0.484375 
+0.5625 0.53125 0.492188 
+0.539062 0.515625 0.476562 
+0.539062 0.523438 0.476562 
+0.539062 0.53125 0.476562 
+0.546875 0.53125 0.476562 
+0.546875 0.523438 0.476562 
+0.546875 0.523438 0.484375 
+0.554688 0.53125 0.476562 
+0.554688 0.53125 0.484375 
+0.554688 0.53125 0.492188 
+0.539062 0.539062 0.476562 
+0.546875 0.539062 0.476562 
+0.546875 0.539062 0.484375 
+0.554688 0.539062 0.476562 
+0.5625 0.539062 0.476562 
+0.5625 0.539062 0.484375 
+0.554688 0.539062 0.484375 
+0.554688 0.546875 0.484375 
+0.554688 0.539062 0.492188 
+0.5625 0.539062 0.492188 
+0.5625 0.539062 0.5 
+0.5625 0.546875 0.492188 
+0.554688 0.546875 0.492188 
+0.554688 0.554688 0.492188 
+0.5625 0.554688 0.492188 
+0.5625 0.554688 0.5 
+0.507812 0.507812 0.4375 
+0.515625 0.507812 0.4375 
+0.515625 0.515625 0.445312 
+0.523438 0.507812 0.4375 
+0.53125 0.507812 0.4375 
+0.53125 0.515625 0.445312 
+0.523438 0.515625 0.4375 
+0.523438 0.515625 0.445312 
+0.523438 0.523438 0.4375 
+0.53125 0.523438 0.4375 
+0.523438 0.523438 0.445312 
+0.53125 0.523438 0.445312 
+0.53125 0.53125 0.445312 
+0.53125 0.523438 0.453125 
+0.523438 0.523438 0.453125 
+0.53125 0.53125 0.460938 
+0.539062 0.507812 0.4375 
+0.546875 0.507812 0.4375 
+0.546875 0.515625 0.445312 
+0.554688 0.507812 0.4375 
+0.5625 0.507812 0.4375 
+0.5625 0.515625 0.445312 
+0.554688 0.515625 0.4375 
+0.554688 0.515625 0.445312 
+0.554688 0.523438 0.4375 
+0.5625 0.523438 0.4375 
+0.554688 0.523438 0.445312 
+0.5625 0.523438 0.445312 
+0.5625 0.53125 0.445312 
+0.5625 0.523438 0.453125 
+0.554688 0.523438 0.453125 
+0.5625 0.53125 0.460938 
+0.539062 0.515625 0.4375 
+0.539062 0.515625 0.445312 
+0.539062 0.523438 0.4375 
+0.539062 0.53125 0.4375 
+0.539062 0.523438 0.445312 
+0.539062 0.53125 0.445312 
+0.546875 0.53125 0.445312 
+0.546875 0.523438 0.4375 
+0.546875 0.523438 0.445312 
+0.546875 0.523438 0.453125 
+0.554688 0.53125 0.4375 
+0.554688 0.53125 0.445312 
+0.554688 0.53125 0.453125 
+0.554688 0.53125 0.460938 
+0.539062 0.53125 0.453125 
+0.539062 0.523438 0.453125 
+0.539062 0.53125 0.460938 
+0.546875 0.53125 0.460938 
+0.539062 0.539062 0.4375 
+0.546875 0.539062 0.4375 
+0.539062 0.539062 0.445312 
+0.546875 0.539062 0.445312 
+0.546875 0.546875 0.445312 
+0.554688 0.539062 0.4375 
+0.5625 0.539062 0.4375 
+0.554688 0.539062 0.445312 
+0.5625 0.539062 0.445312 
+0.5625 0.546875 0.445312 
+0.554688 0.546875 0.4375 
+0.554688 0.546875 0.445312 
+0.554688 0.546875 0.453125 
+0.554688 0.554688 0.4375 
+0.5625 0.554688 0.4375 
+0.554688 0.554688 0.445312 
+0.5625 0.554688 0.445312 
+0.5625 0.5625 0.445312 
+0.5625 0.554688 0.453125 
+0.554688 0.554688 0.453125 
+0.554688 0.554688 0.460938 
+0.5625 0.554688 0.460938 
+0.5625 0.5625 0.460938 
+0.546875 0.539062 0.453125 
+0.5625 0.539062 0.453125 
+0.554688 0.539062 0.453125 
+0.554688 0.539062 0.460938 
+0.5625 0.539062 0.460938 
+0.5625 0.539062 0.46875 
+0.5625 0.546875 0.460938 
+0.554688 0.546875 0.460938 
+0.5625 0.554688 0.46875 
+0.539062 0.539062 0.453125 
+0.539062 0.539062 0.460938 
+0.539062 0.539062 0.46875 
+0.546875 0.539062 0.46875 
+0.546875 0.539062 0.460938 
+0.546875 0.546875 0.460938 
+0.554688 0.539062 0.46875 
+0.554688 0.546875 0.46875 
+0.554688 0.554688 0.46875 
+0.546875 0.546875 0.476562 
+0.5625 0.546875 0.476562 
+0.554688 0.546875 0.476562 
+0.554688 0.554688 0.476562 
+0.5625 0.554688 0.476562 
+0.5625 0.5625 0.476562 
+0.5625 0.554688 0.484375 
+0.554688 0.554688 0.484375 
+0.5625 0.5625 0.492188 
+0.546875 0.476562 0.5625 
+0.546875 0.476562 0.554688 
+0.554688 0.476562 0.5625 
+0.554688 0.484375 0.5625 
+0.507812 0.445312 0.570312 
+0.507812 0.453125 0.570312 
+0.507812 0.453125 0.578125 
+0.507812 0.460938 0.570312 
+0.507812 0.46875 0.570312 
+0.507812 0.46875 0.578125 
+0.507812 0.460938 0.578125 
+0.515625 0.460938 0.578125 
+0.507812 0.460938 0.585938 
+0.507812 0.46875 0.585938 
+0.507812 0.46875 0.59375 
+0.515625 0.46875 0.585938 
+0.515625 0.460938 0.585938 
+0.523438 0.460938 0.585938 
+0.523438 0.46875 0.585938 
+0.523438 0.46875 0.59375 
+0.507812 0.476562 0.570312 
+0.507812 0.484375 0.570312 
+0.507812 0.484375 0.578125 
+0.507812 0.492188 0.570312 
+0.507812 0.5 0.570312 
+0.507812 0.5 0.578125 
+0.507812 0.492188 0.578125 
+0.515625 0.492188 0.578125 
+0.507812 0.492188 0.585938 
+0.507812 0.5 0.585938 
+0.507812 0.5 0.59375 
+0.515625 0.5 0.585938 
+0.515625 0.492188 0.585938 
+0.523438 0.492188 0.585938 
+0.523438 0.5 0.585938 
+0.523438 0.5 0.59375 
+0.507812 0.476562 0.578125 
+0.507812 0.476562 0.585938 
+0.507812 0.476562 0.59375 
+0.507812 0.484375 0.59375 
+0.507812 0.484375 0.585938 
+0.515625 0.484375 0.585938 
+0.507812 0.492188 0.59375 
+0.515625 0.492188 0.59375 
+0.523438 0.492188 0.59375 
+0.515625 0.476562 0.578125 
+0.515625 0.476562 0.59375 
+0.515625 0.476562 0.585938 
+0.523438 0.476562 0.585938 
+0.523438 0.476562 0.59375 
+0.53125 0.476562 0.59375 
+0.523438 0.484375 0.59375 
+0.523438 0.484375 0.585938 
+0.53125 0.492188 0.59375 
+0.515625 0.453125 0.570312 
+0.515625 0.46875 0.570312 
+0.515625 0.460938 0.570312 
+0.523438 0.460938 0.570312 
+0.523438 0.46875 0.570312 
+0.53125 0.46875 0.570312 
+0.523438 0.46875 0.578125 
+0.523438 0.460938 0.578125 
+0.53125 0.46875 0.585938 
+0.515625 0.484375 0.570312 
+0.515625 0.5 0.570312 
+0.515625 0.492188 0.570312 
+0.523438 0.492188 0.570312 
+0.523438 0.5 0.570312 
+0.53125 0.5 0.570312 
+0.523438 0.5 0.578125 
+0.523438 0.492188 0.578125 
+0.53125 0.5 0.585938 
+0.515625 0.476562 0.570312 
+0.523438 0.476562 0.570312 
+0.53125 0.476562 0.570312 
+0.53125 0.484375 0.570312 
+0.523438 0.484375 0.570312 
+0.523438 0.484375 0.578125 
+0.53125 0.492188 0.570312 
+0.53125 0.492188 0.578125 
+0.53125 0.492188 0.585938 
+0.53125 0.476562 0.578125 
+0.523438 0.476562 0.578125 
+0.53125 0.476562 0.585938 
+0.53125 0.484375 0.585938 
+0.539062 0.476562 0.570312 
+0.539062 0.484375 0.570312 
+0.546875 0.484375 0.570312 
+0.539062 0.492188 0.570312 
+0.539062 0.5 0.570312 
+0.546875 0.5 0.570312 
+0.546875 0.492188 0.570312 
+0.546875 0.492188 0.578125 
+0.554688 0.492188 0.570312 
+0.554688 0.5 0.570312 
+0.5625 0.5 0.570312 
+0.554688 0.5 0.578125 
+0.554688 0.492188 0.578125 
+0.554688 0.492188 0.585938 
+0.554688 0.5 0.585938 
+0.5625 0.5 0.585938 
+0.539062 0.484375 0.578125 
+0.539062 0.5 0.578125 
+0.539062 0.492188 0.578125 
+0.539062 0.492188 0.585938 
+0.539062 0.5 0.585938 
+0.539062 0.5 0.59375 
+0.546875 0.5 0.585938 
+0.546875 0.492188 0.585938 
+0.554688 0.5 0.59375 
+0.539062 0.476562 0.578125 
+0.539062 0.476562 0.585938 
+0.539062 0.476562 0.59375 
+0.539062 0.484375 0.59375 
+0.539062 0.484375 0.585938 
+0.546875 0.484375 0.585938 
+0.539062 0.492188 0.59375 
+0.546875 0.492188 0.59375 
+0.515625 0.445312 0.570312 
+0.523438 0.445312 0.570312 
+0.53125 0.445312 0.570312 
+0.53125 0.453125 0.570312 
+0.523438 0.453125 0.570312 
+0.523438 0.453125 0.578125 
+0.53125 0.460938 0.570312 
+0.53125 0.460938 0.578125 
+0.53125 0.460938 0.585938 
+0.539062 0.445312 0.570312 
+0.546875 0.453125 0.570312 
+0.554688 0.460938 0.570312 
+0.5625 0.46875 0.570312 
+0.539062 0.453125 0.570312 
+0.539062 0.460938 0.570312 
+0.539062 0.46875 0.570312 
+0.546875 0.46875 0.570312 
+0.546875 0.460938 0.570312 
+0.546875 0.460938 0.578125 
+0.554688 0.46875 0.570312 
+0.554688 0.46875 0.578125 
+0.554688 0.460938 0.578125 
+0.539062 0.453125 0.578125 
+0.539062 0.46875 0.578125 
+0.539062 0.460938 0.578125 
+0.539062 0.460938 0.585938 
+0.539062 0.46875 0.585938 
+0.539062 0.46875 0.59375 
+0.546875 0.46875 0.585938 
+0.546875 0.476562 0.570312 
+0.554688 0.476562 0.570312 
+0.5625 0.476562 0.570312 
+0.5625 0.484375 0.570312 
+0.554688 0.484375 0.570312 
+0.554688 0.484375 0.578125 
+0.453125 0.539062 0.476562 
+0.460938 0.539062 0.476562 
+0.46875 0.539062 0.476562 
+0.46875 0.539062 0.484375 
+0.460938 0.539062 0.484375 
+0.460938 0.546875 0.484375 
+0.46875 0.539062 0.492188 
+0.46875 0.546875 0.492188 
+0.46875 0.554688 0.492188 
+0.476562 0.546875 0.484375 
+0.476562 0.546875 0.492188 
+0.476562 0.554688 0.492188 
+0.484375 0.554688 0.492188 
+0.445312 0.53125 0.453125 
+0.445312 0.523438 0.453125 
+0.445312 0.53125 0.460938 
+0.453125 0.53125 0.460938 
+0.445312 0.546875 0.453125 
+0.4375 0.554688 0.445312 
+0.4375 0.5625 0.445312 
+0.445312 0.5625 0.453125 
+0.445312 0.554688 0.453125 
+0.445312 0.554688 0.460938 
+0.445312 0.5625 0.460938 
+0.445312 0.5625 0.46875 
+0.453125 0.5625 0.460938 
+0.453125 0.554688 0.460938 
+0.460938 0.5625 0.46875 
+0.445312 0.539062 0.453125 
+0.445312 0.539062 0.460938 
+0.445312 0.539062 0.46875 
+0.445312 0.546875 0.46875 
+0.445312 0.546875 0.460938 
+0.453125 0.546875 0.460938 
+0.445312 0.554688 0.46875 
+0.453125 0.554688 0.46875 
+0.460938 0.554688 0.46875 
+0.453125 0.539062 0.46875 
+0.453125 0.539062 0.460938 
+0.460938 0.539062 0.46875 
+0.460938 0.546875 0.46875 
+0.445312 0.546875 0.476562 
+0.445312 0.554688 0.476562 
+0.445312 0.5625 0.476562 
+0.445312 0.5625 0.484375 
+0.445312 0.554688 0.484375 
+0.453125 0.554688 0.484375 
+0.445312 0.5625 0.492188 
+0.453125 0.5625 0.492188 
+0.460938 0.5625 0.492188 
+0.453125 0.546875 0.476562 
+0.453125 0.5625 0.476562 
+0.453125 0.554688 0.476562 
+0.460938 0.554688 0.476562 
+0.460938 0.5625 0.476562 
+0.46875 0.5625 0.476562 
+0.460938 0.5625 0.484375 
+0.460938 0.554688 0.484375 
+0.46875 0.5625 0.492188 
+0.46875 0.546875 0.476562 
+0.460938 0.546875 0.476562 
+0.46875 0.554688 0.476562 
+0.46875 0.554688 0.484375 
+0.476562 0.5625 0.484375 
+0.476562 0.554688 0.484375 
+0.476562 0.5625 0.492188 
+0.484375 0.5625 0.492188 
+0.445312 0.570312 0.453125 
+0.445312 0.570312 0.460938 
+0.445312 0.570312 0.46875 
+0.453125 0.570312 0.46875 
+0.453125 0.570312 0.460938 
+0.453125 0.578125 0.460938 
+0.460938 0.570312 0.46875 
+0.460938 0.578125 0.46875 
+0.460938 0.585938 0.46875 
+0.445312 0.570312 0.476562 
+0.445312 0.570312 0.484375 
+0.453125 0.570312 0.484375 
+0.445312 0.570312 0.492188 
+0.445312 0.570312 0.5 
+0.453125 0.570312 0.5 
+0.453125 0.570312 0.492188 
+0.453125 0.578125 0.492188 
+0.460938 0.570312 0.492188 
+0.460938 0.570312 0.5 
+0.46875 0.570312 0.5 
+0.460938 0.578125 0.5 
+0.460938 0.578125 0.492188 
+0.460938 0.585938 0.492188 
+0.460938 0.585938 0.5 
+0.46875 0.585938 0.5 
+0.453125 0.570312 0.476562 
+0.460938 0.570312 0.476562 
+0.46875 0.570312 0.476562 
+0.46875 0.570312 0.484375 
+0.460938 0.570312 0.484375 
+0.460938 0.578125 0.484375 
+0.46875 0.570312 0.492188 
+0.46875 0.578125 0.492188 
+0.46875 0.585938 0.492188 
+0.453125 0.578125 0.476562 
+0.46875 0.578125 0.476562 
+0.460938 0.578125 0.476562 
+0.460938 0.585938 0.476562 
+0.46875 0.585938 0.476562 
+0.46875 0.59375 0.476562 
+0.46875 0.585938 0.484375 
+0.460938 0.585938 0.484375 
+0.46875 0.59375 0.492188 
+0.476562 0.570312 0.484375 
+0.476562 0.570312 0.492188 
+0.476562 0.570312 0.5 
+0.484375 0.570312 0.5 
+0.484375 0.570312 0.492188 
+0.484375 0.578125 0.492188 
+0.492188 0.570312 0.5 
+0.492188 0.578125 0.5 
+0.492188 0.585938 0.5 
+0.476562 0.578125 0.484375 
+0.476562 0.578125 0.5 
+0.476562 0.578125 0.492188 
+0.476562 0.585938 0.492188 
+0.476562 0.585938 0.5 
+0.476562 0.59375 0.5 
+0.484375 0.585938 0.5 
+0.484375 0.585938 0.492188 
+0.492188 0.59375 0.5 
+0.484375 0.523438 0.539062 
+0.484375 0.523438 0.546875 
+0.492188 0.53125 0.539062 
+0.492188 0.53125 0.546875 
+0.492188 0.53125 0.554688 
+0.484375 0.539062 0.546875 
+0.5 0.539062 0.546875 
+0.492188 0.539062 0.546875 
+0.492188 0.539062 0.554688 
+0.5 0.539062 0.554688 
+0.5 0.539062 0.5625 
+0.5 0.546875 0.554688 
+0.492188 0.546875 0.554688 
+0.5 0.554688 0.5625 
+0.445312 0.5 0.515625 
+0.445312 0.507812 0.515625 
+0.445312 0.5 0.523438 
+0.445312 0.507812 0.523438 
+0.445312 0.507812 0.53125 
+0.453125 0.507812 0.53125 
+0.453125 0.5 0.523438 
+0.453125 0.507812 0.523438 
+0.453125 0.515625 0.523438 
+0.460938 0.507812 0.53125 
+0.460938 0.515625 0.53125 
+0.460938 0.523438 0.53125 
+0.445312 0.5 0.546875 
+0.445312 0.507812 0.539062 
+0.445312 0.507812 0.546875 
+0.453125 0.507812 0.546875 
+0.445312 0.5 0.554688 
+0.445312 0.507812 0.554688 
+0.445312 0.507812 0.5625 
+0.453125 0.507812 0.5625 
+0.453125 0.5 0.554688 
+0.453125 0.507812 0.554688 
+0.453125 0.515625 0.554688 
+0.460938 0.507812 0.554688 
+0.460938 0.507812 0.5625 
+0.46875 0.507812 0.5625 
+0.460938 0.515625 0.5625 
+0.460938 0.515625 0.554688 
+0.460938 0.523438 0.554688 
+0.460938 0.523438 0.5625 
+0.46875 0.523438 0.5625 
+0.453125 0.507812 0.539062 
+0.460938 0.507812 0.539062 
+0.46875 0.507812 0.539062 
+0.46875 0.507812 0.546875 
+0.460938 0.507812 0.546875 
+0.460938 0.515625 0.546875 
+0.46875 0.507812 0.554688 
+0.46875 0.515625 0.554688 
+0.46875 0.523438 0.554688 
+0.453125 0.515625 0.539062 
+0.46875 0.515625 0.539062 
+0.460938 0.515625 0.539062 
+0.460938 0.523438 0.539062 
+0.46875 0.523438 0.539062 
+0.46875 0.53125 0.539062 
+0.46875 0.523438 0.546875 
+0.460938 0.523438 0.546875 
+0.46875 0.53125 0.554688 
+0.476562 0.507812 0.546875 
+0.476562 0.507812 0.554688 
+0.476562 0.507812 0.5625 
+0.484375 0.507812 0.5625 
+0.484375 0.507812 0.554688 
+0.484375 0.515625 0.554688 
+0.492188 0.507812 0.5625 
+0.492188 0.515625 0.5625 
+0.492188 0.523438 0.5625 
+0.476562 0.515625 0.546875 
+0.476562 0.515625 0.5625 
+0.476562 0.515625 0.554688 
+0.476562 0.523438 0.554688 
+0.476562 0.523438 0.5625 
+0.476562 0.53125 0.5625 
+0.484375 0.523438 0.5625 
+0.484375 0.523438 0.554688 
+0.492188 0.53125 0.5625 
+0.476562 0.53125 0.546875 
+0.476562 0.523438 0.546875 
+0.476562 0.53125 0.554688 
+0.484375 0.53125 0.554688 
+0.476562 0.539062 0.546875 
+0.476562 0.539062 0.554688 
+0.476562 0.539062 0.5625 
+0.484375 0.539062 0.5625 
+0.484375 0.539062 0.554688 
+0.484375 0.546875 0.554688 
+0.492188 0.539062 0.5625 
+0.492188 0.546875 0.5625 
+0.492188 0.554688 0.5625 
+0.445312 0.515625 0.53125 
+0.445312 0.515625 0.523438 
+0.445312 0.523438 0.53125 
+0.453125 0.523438 0.53125 
+0.445312 0.515625 0.546875 
+0.445312 0.515625 0.5625 
+0.445312 0.515625 0.554688 
+0.445312 0.523438 0.554688 
+0.445312 0.523438 0.5625 
+0.445312 0.53125 0.5625 
+0.453125 0.523438 0.5625 
+0.453125 0.523438 0.554688 
+0.460938 0.53125 0.5625 
+0.445312 0.515625 0.539062 
+0.445312 0.523438 0.539062 
+0.445312 0.53125 0.539062 
+0.445312 0.53125 0.546875 
+0.445312 0.523438 0.546875 
+0.453125 0.523438 0.546875 
+0.445312 0.53125 0.554688 
+0.453125 0.53125 0.554688 
+0.460938 0.53125 0.554688 
+0.453125 0.53125 0.539062 
+0.453125 0.523438 0.539062 
+0.460938 0.53125 0.539062 
+0.460938 0.53125 0.546875 
+0.445312 0.539062 0.546875 
+0.445312 0.539062 0.554688 
+0.445312 0.539062 0.5625 
+0.445312 0.546875 0.5625 
+0.445312 0.546875 0.554688 
+0.453125 0.546875 0.554688 
+0.445312 0.554688 0.5625 
+0.453125 0.554688 0.5625 
+0.460938 0.554688 0.5625 
+0.453125 0.539062 0.546875 
+0.453125 0.539062 0.5625 
+0.453125 0.539062 0.554688 
+0.460938 0.539062 0.554688 
+0.460938 0.539062 0.5625 
+0.46875 0.539062 0.5625 
+0.460938 0.546875 0.5625 
+0.460938 0.546875 0.554688 
+0.46875 0.554688 0.5625 
+0.46875 0.539062 0.546875 
+0.421875 0.445312 0.539062 
+0.421875 0.453125 0.539062 
+0.429688 0.453125 0.539062 
+0.429688 0.460938 0.539062 
+0.429688 0.460938 0.546875 
+0.414062 0.460938 0.539062 
+0.414062 0.46875 0.539062 
+0.421875 0.46875 0.539062 
+0.421875 0.460938 0.539062 
+0.421875 0.460938 0.546875 
+0.429688 0.46875 0.539062 
+0.429688 0.46875 0.546875 
+0.429688 0.46875 0.554688 
+0.421875 0.476562 0.546875 
+0.429688 0.476562 0.546875 
+0.429688 0.476562 0.554688 
+0.429688 0.484375 0.554688 
+0.445312 0.453125 0.5 
+0.445312 0.453125 0.507812 
+0.445312 0.460938 0.5 
+0.445312 0.46875 0.5 
+0.445312 0.460938 0.507812 
+0.445312 0.46875 0.507812 
+0.453125 0.46875 0.507812 
+0.453125 0.460938 0.5 
+0.453125 0.460938 0.507812 
+0.453125 0.460938 0.515625 
+0.460938 0.46875 0.5 
+0.460938 0.46875 0.507812 
+0.460938 0.46875 0.515625 
+0.460938 0.46875 0.523438 
+0.445312 0.476562 0.5 
+0.445312 0.484375 0.5 
+0.445312 0.476562 0.507812 
+0.445312 0.484375 0.507812 
+0.453125 0.484375 0.507812 
+0.445312 0.492188 0.5 
+0.445312 0.492188 0.507812 
+0.453125 0.492188 0.5 
+0.453125 0.492188 0.507812 
+0.453125 0.492188 0.515625 
+0.460938 0.492188 0.5 
+0.460938 0.492188 0.507812 
+0.460938 0.492188 0.515625 
+0.460938 0.492188 0.523438 
+0.453125 0.476562 0.5 
+0.453125 0.476562 0.507812 
+0.460938 0.476562 0.5 
+0.46875 0.476562 0.5 
+0.460938 0.476562 0.507812 
+0.46875 0.476562 0.507812 
+0.46875 0.484375 0.507812 
+0.460938 0.484375 0.5 
+0.460938 0.484375 0.507812 
+0.460938 0.484375 0.515625 
+0.46875 0.492188 0.5 
+0.46875 0.492188 0.507812 
+0.46875 0.492188 0.515625 
+0.46875 0.492188 0.523438 
+0.453125 0.476562 0.515625 
+0.46875 0.476562 0.515625 
+0.460938 0.476562 0.515625 
+0.460938 0.476562 0.523438 
+0.46875 0.476562 0.523438 
+0.46875 0.484375 0.523438 
+0.460938 0.484375 0.523438 
+0.476562 0.484375 0.5 
+0.476562 0.484375 0.507812 
+0.476562 0.492188 0.5 
+0.476562 0.492188 0.507812 
+0.484375 0.492188 0.5 
+0.484375 0.492188 0.507812 
+0.484375 0.492188 0.515625 
+0.476562 0.484375 0.515625 
+0.476562 0.492188 0.515625 
+0.476562 0.492188 0.523438 
+0.484375 0.492188 0.523438 
+0.476562 0.484375 0.53125 
+0.476562 0.484375 0.523438 
+0.476562 0.492188 0.53125 
+0.484375 0.492188 0.53125 
+0.484375 0.492188 0.539062 
+0.445312 0.46875 0.515625 
+0.445312 0.460938 0.515625 
+0.445312 0.46875 0.523438 
+0.453125 0.46875 0.523438 
+0.445312 0.484375 0.515625 
+0.445312 0.492188 0.515625 
+0.445312 0.492188 0.523438 
+0.453125 0.492188 0.523438 
+0.445312 0.476562 0.515625 
+0.445312 0.476562 0.523438 
+0.445312 0.484375 0.523438 
+0.453125 0.484375 0.523438 
+0.453125 0.476562 0.523438 
+0.445312 0.492188 0.546875 
+0.539062 0.476562 0.53125 
+0.539062 0.484375 0.53125 
+0.546875 0.484375 0.539062 
+0.539062 0.492188 0.53125 
+0.539062 0.5 0.53125 
+0.546875 0.5 0.539062 
+0.546875 0.492188 0.53125 
+0.546875 0.492188 0.539062 
+0.554688 0.492188 0.53125 
+0.554688 0.5 0.53125 
+0.554688 0.492188 0.539062 
+0.554688 0.5 0.539062 
+0.554688 0.5 0.546875 
+0.554688 0.492188 0.546875 
+0.515625 0.445312 0.507812 
+0.515625 0.453125 0.507812 
+0.523438 0.445312 0.507812 
+0.53125 0.445312 0.507812 
+0.53125 0.453125 0.507812 
+0.523438 0.453125 0.507812 
+0.523438 0.453125 0.515625 
+0.523438 0.460938 0.507812 
+0.53125 0.460938 0.507812 
+0.53125 0.46875 0.507812 
+0.53125 0.460938 0.515625 
+0.523438 0.460938 0.515625 
+0.53125 0.460938 0.523438 
+0.53125 0.46875 0.523438 
+0.539062 0.445312 0.507812 
+0.546875 0.445312 0.507812 
+0.546875 0.453125 0.507812 
+0.554688 0.445312 0.507812 
+0.554688 0.453125 0.507812 
+0.554688 0.453125 0.515625 
+0.554688 0.460938 0.507812 
+0.554688 0.460938 0.515625 
+0.554688 0.460938 0.523438 
+0.539062 0.453125 0.507812 
+0.539062 0.460938 0.507812 
+0.539062 0.46875 0.507812 
+0.546875 0.46875 0.507812 
+0.546875 0.460938 0.507812 
+0.546875 0.460938 0.515625 
+0.554688 0.46875 0.507812 
+0.554688 0.46875 0.515625 
+0.554688 0.46875 0.523438 
+0.539062 0.453125 0.515625 
+0.539062 0.46875 0.515625 
+0.539062 0.460938 0.515625 
+0.539062 0.460938 0.523438 
+0.539062 0.46875 0.523438 
+0.546875 0.46875 0.523438 
+0.546875 0.460938 0.523438 
+0.539062 0.476562 0.507812 
+0.546875 0.476562 0.507812 
+0.546875 0.484375 0.507812 
+0.554688 0.476562 0.507812 
+0.554688 0.484375 0.507812 
+0.554688 0.484375 0.515625 
+0.554688 0.492188 0.507812 
+0.554688 0.492188 0.515625 
+0.554688 0.492188 0.523438 
+0.546875 0.476562 0.515625 
+0.554688 0.476562 0.515625 
+0.554688 0.476562 0.523438 
+0.554688 0.484375 0.523438 
+0.539062 0.476562 0.515625 
+0.539062 0.476562 0.523438 
+0.546875 0.476562 0.53125 
+0.546875 0.476562 0.523438 
+0.546875 0.484375 0.523438 
+0.554688 0.476562 0.53125 
+0.554688 0.484375 0.53125 
+0.554688 0.484375 0.539062 
+0.515625 0.4375 0.507812 
+0.523438 0.4375 0.507812 
+0.53125 0.4375 0.507812 
+0.53125 0.445312 0.515625 
+0.523438 0.4375 0.515625 
+0.523438 0.445312 0.515625 
+0.53125 0.4375 0.523438 
+0.53125 0.445312 0.523438 
+0.53125 0.453125 0.523438 
+0.539062 0.4375 0.507812 
+0.546875 0.4375 0.507812 
+0.546875 0.445312 0.515625 
+0.554688 0.4375 0.507812 
+0.554688 0.4375 0.515625 
+0.554688 0.445312 0.515625 
+0.554688 0.4375 0.523438 
+0.554688 0.445312 0.523438 
+0.554688 0.453125 0.523438 
+0.539062 0.4375 0.515625 
+0.539062 0.445312 0.515625 
+0.539062 0.4375 0.523438 
+0.539062 0.4375 0.53125 
+0.539062 0.445312 0.523438 
+0.539062 0.445312 0.53125 
+0.546875 0.445312 0.53125 
+0.546875 0.4375 0.523438 
+0.546875 0.445312 0.523438 
+0.546875 0.453125 0.523438 
+0.554688 0.4375 0.53125 
+0.554688 0.445312 0.53125 
+0.554688 0.453125 0.53125 
+0.554688 0.460938 0.53125 
+0.539062 0.453125 0.53125 
+0.539062 0.453125 0.523438 
+0.539062 0.460938 0.53125 
+0.546875 0.460938 0.53125 
+0.546875 0.4375 0.539062 
+0.546875 0.445312 0.539062 
+0.554688 0.4375 0.539062 
+0.554688 0.445312 0.539062 
+0.554688 0.4375 0.546875 
+0.554688 0.445312 0.546875 
+0.554688 0.453125 0.546875 
+0.5625 0.4375 0.554688 
+0.5625 0.445312 0.554688 
+0.546875 0.453125 0.539062 
+0.554688 0.453125 0.539062 
+0.554688 0.460938 0.539062 
+0.554688 0.460938 0.546875 
+0.546875 0.460938 0.539062 
+0.476562 0.484375 0.578125 
+0.476562 0.492188 0.578125 
+0.476562 0.492188 0.585938 
+0.484375 0.492188 0.585938 
+0.476562 0.484375 0.59375 
+0.476562 0.484375 0.585938 
+0.476562 0.492188 0.59375 
+0.484375 0.492188 0.59375 
+0.507812 0.414062 0.507812 
+0.507812 0.421875 0.507812 
+0.515625 0.421875 0.507812 
+0.507812 0.429688 0.507812 
+0.515625 0.429688 0.507812 
+0.515625 0.429688 0.515625 
+0.523438 0.429688 0.507812 
+0.523438 0.429688 0.515625 
+0.523438 0.429688 0.523438 
+0.515625 0.414062 0.507812 
+0.523438 0.414062 0.507812 
+0.53125 0.414062 0.507812 
+0.53125 0.421875 0.507812 
+0.523438 0.421875 0.507812 
+0.523438 0.421875 0.515625 
+0.53125 0.429688 0.507812 
+0.53125 0.429688 0.515625 
+0.53125 0.429688 0.523438 
+0.507812 0.40625 0.507812 
+0.515625 0.40625 0.507812 
+0.515625 0.414062 0.515625 
+0.523438 0.40625 0.507812 
+0.53125 0.40625 0.507812 
+0.53125 0.414062 0.515625 
+0.523438 0.40625 0.515625 
+0.523438 0.414062 0.515625 
+0.523438 0.40625 0.523438 
+0.53125 0.40625 0.523438 
+0.523438 0.414062 0.523438 
+0.53125 0.414062 0.523438 
+0.53125 0.414062 0.53125 
+0.53125 0.421875 0.523438 
+0.523438 0.421875 0.523438 
+0.53125 0.429688 0.53125 
+0.539062 0.414062 0.507812 
+0.539062 0.421875 0.507812 
+0.546875 0.421875 0.507812 
+0.539062 0.429688 0.507812 
+0.546875 0.429688 0.507812 
+0.546875 0.429688 0.515625 
+0.554688 0.429688 0.507812 
+0.554688 0.429688 0.515625 
+0.554688 0.429688 0.523438 
+0.539062 0.421875 0.515625 
+0.539062 0.429688 0.515625 
+0.539062 0.429688 0.523438 
+0.546875 0.429688 0.523438 
+0.539062 0.414062 0.515625 
+0.539062 0.414062 0.523438 
+0.539062 0.414062 0.53125 
+0.539062 0.421875 0.53125 
+0.539062 0.421875 0.523438 
+0.546875 0.421875 0.523438 
+0.539062 0.429688 0.53125 
+0.546875 0.429688 0.53125 
+0.554688 0.429688 0.53125 
+0.539062 0.414062 0.539062 
+0.539062 0.421875 0.539062 
+0.546875 0.421875 0.539062 
+0.539062 0.429688 0.539062 
+0.546875 0.429688 0.539062 
+0.546875 0.429688 0.546875 
+0.554688 0.429688 0.539062 
+0.554688 0.429688 0.546875 
+0.554688 0.429688 0.554688 
+0.507812 0.453125 0.507812 
+0.507812 0.460938 0.507812 
+0.507812 0.46875 0.507812 
+0.515625 0.46875 0.507812 
+0.515625 0.460938 0.507812 
+0.515625 0.460938 0.515625 
+0.523438 0.46875 0.507812 
+0.523438 0.46875 0.515625 
+0.523438 0.46875 0.523438 
+0.507812 0.476562 0.507812 
+0.507812 0.484375 0.507812 
+0.515625 0.484375 0.507812 
+0.507812 0.492188 0.507812 
+0.507812 0.5 0.507812 
+0.515625 0.5 0.507812 
+0.515625 0.492188 0.507812 
+0.515625 0.492188 0.515625 
+0.523438 0.492188 0.507812 
+0.523438 0.5 0.507812 
+0.53125 0.5 0.507812 
+0.523438 0.5 0.515625 
+0.523438 0.492188 0.515625 
+0.523438 0.492188 0.523438 
+0.523438 0.5 0.523438 
+0.53125 0.5 0.523438 
+0.515625 0.476562 0.507812 
+0.523438 0.476562 0.507812 
+0.53125 0.476562 0.507812 
+0.53125 0.484375 0.507812 
+0.523438 0.484375 0.507812 
+0.523438 0.484375 0.515625 
+0.53125 0.492188 0.507812 
+0.53125 0.492188 0.515625 
+0.53125 0.492188 0.523438 
+0.515625 0.476562 0.515625 
+0.53125 0.476562 0.515625 
+0.523438 0.476562 0.515625 
+0.523438 0.476562 0.523438 
+0.53125 0.476562 0.523438 
+0.53125 0.484375 0.523438 
+0.523438 0.484375 0.523438 
+0.539062 0.484375 0.507812 
+0.539062 0.492188 0.507812 
+0.539062 0.5 0.507812 
+0.546875 0.5 0.507812 
+0.546875 0.492188 0.507812 
+0.546875 0.492188 0.515625 
+0.554688 0.5 0.507812 
+0.554688 0.5 0.515625 
+0.554688 0.5 0.523438 
+0.539062 0.484375 0.515625 
+0.539062 0.5 0.515625 
+0.539062 0.492188 0.515625 
+0.539062 0.492188 0.523438 
+0.539062 0.5 0.523438 
+0.546875 0.5 0.523438 
+0.546875 0.492188 0.523438 
+0.539062 0.484375 0.523438 
+0.578125 0.476562 0.546875 
+0.578125 0.476562 0.5625 
+0.578125 0.476562 0.554688 
+0.507812 0.421875 0.515625 
+0.507812 0.429688 0.515625 
+0.507812 0.429688 0.523438 
+0.515625 0.429688 0.523438 
+0.507812 0.414062 0.515625 
+0.507812 0.414062 0.523438 
+0.507812 0.414062 0.53125 
+0.507812 0.421875 0.53125 
+0.507812 0.421875 0.523438 
+0.515625 0.421875 0.523438 
+0.507812 0.429688 0.53125 
+0.515625 0.429688 0.53125 
+0.523438 0.429688 0.53125 
+0.507812 0.40625 0.515625 
+0.507812 0.40625 0.523438 
+0.507812 0.40625 0.53125 
+0.515625 0.414062 0.53125 
+0.515625 0.40625 0.523438 
+0.515625 0.414062 0.523438 
+0.523438 0.40625 0.53125 
+0.523438 0.414062 0.53125 
+0.523438 0.421875 0.53125 
+0.507812 0.414062 0.539062 
+0.507812 0.421875 0.539062 
+0.507812 0.421875 0.546875 
+0.507812 0.429688 0.539062 
+0.507812 0.429688 0.546875 
+0.515625 0.429688 0.546875 
+0.507812 0.429688 0.554688 
+0.515625 0.429688 0.554688 
+0.523438 0.429688 0.554688 
+0.515625 0.421875 0.539062 
+0.515625 0.429688 0.539062 
+0.523438 0.429688 0.539062 
+0.523438 0.429688 0.546875 
+0.515625 0.414062 0.539062 
+0.523438 0.414062 0.539062 
+0.53125 0.414062 0.539062 
+0.53125 0.421875 0.539062 
+0.523438 0.421875 0.539062 
+0.523438 0.421875 0.546875 
+0.53125 0.429688 0.539062 
+0.53125 0.429688 0.546875 
+0.53125 0.429688 0.554688 
+0.539062 0.421875 0.546875 
+0.539062 0.429688 0.546875 
+0.539062 0.429688 0.554688 
+0.546875 0.429688 0.554688 
+0.507812 0.46875 0.515625 
+0.507812 0.460938 0.515625 
+0.507812 0.46875 0.523438 
+0.515625 0.46875 0.523438 
+0.507812 0.484375 0.515625 
+0.507812 0.5 0.515625 
+0.507812 0.492188 0.515625 
+0.507812 0.492188 0.523438 
+0.507812 0.5 0.523438 
+0.507812 0.5 0.53125 
+0.515625 0.5 0.523438 
+0.515625 0.492188 0.523438 
+0.523438 0.5 0.53125 
+0.507812 0.476562 0.515625 
+0.507812 0.476562 0.523438 
+0.507812 0.476562 0.53125 
+0.507812 0.484375 0.53125 
+0.507812 0.484375 0.523438 
+0.515625 0.484375 0.523438 
+0.507812 0.492188 0.53125 
+0.515625 0.492188 0.53125 
+0.523438 0.492188 0.53125 
+0.515625 0.476562 0.53125 
+0.515625 0.476562 0.523438 
+0.523438 0.476562 0.53125 
+0.523438 0.484375 0.53125 
+0.507812 0.484375 0.539062 
+0.507812 0.492188 0.539062 
+0.507812 0.5 0.539062 
+0.507812 0.5 0.546875 
+0.507812 0.492188 0.546875 
+0.515625 0.492188 0.546875 
+0.507812 0.5 0.554688 
+0.515625 0.5 0.554688 
+0.523438 0.5 0.554688 
+0.515625 0.5 0.539062 
+0.515625 0.492188 0.539062 
+0.523438 0.5 0.539062 
+0.523438 0.5 0.546875 
+0.476562 0.546875 0.570312 
+0.476562 0.554688 0.570312 
+0.476562 0.5625 0.570312 
+0.484375 0.5625 0.570312 
+0.484375 0.554688 0.570312 
+0.484375 0.554688 0.578125 
+0.492188 0.5625 0.570312 
+0.492188 0.5625 0.578125 
+0.476562 0.546875 0.578125 
+0.476562 0.5625 0.578125 
+0.476562 0.554688 0.578125 
+0.476562 0.5625 0.546875 
+0.476562 0.5625 0.554688 
+0.484375 0.5625 0.554688 
+0.476562 0.570312 0.554688 
+0.484375 0.570312 0.554688 
+0.484375 0.570312 0.5625 
+0.476562 0.570312 0.546875 
+0.484375 0.570312 0.546875 
+0.484375 0.578125 0.554688 
+0.492188 0.5625 0.554688 
+0.492188 0.5625 0.5625 
+0.492188 0.570312 0.554688 
+0.492188 0.570312 0.5625 
+0.5 0.570312 0.5625 
+0.492188 0.578125 0.5625 
+0.492188 0.578125 0.554688 
+0.492188 0.585938 0.554688 
+0.5 0.585938 0.5625 
+0.46875 0.5625 0.539062 
+0.46875 0.570312 0.539062 
+0.46875 0.570312 0.546875 
+0.476562 0.570312 0.539062 
+0.476562 0.578125 0.546875 
+0.46875 0.5625 0.554688 
+0.46875 0.570312 0.554688 
+0.46875 0.570312 0.5625 
+0.476562 0.570312 0.5625 
+0.476562 0.578125 0.5625 
+0.46875 0.578125 0.554688 
+0.476562 0.578125 0.554688 
+0.46875 0.570312 0.53125 
+0.46875 0.578125 0.539062 
+0.476562 0.578125 0.539062 
+0.46875 0.585938 0.53125 
+0.46875 0.585938 0.539062 
+0.46875 0.59375 0.539062 
+0.476562 0.585938 0.539062 
+0.476562 0.59375 0.539062 
+0.46875 0.585938 0.546875 
+0.484375 0.585938 0.546875 
+0.414062 0.5 0.5 
+0.414062 0.5 0.507812 
+0.421875 0.5 0.507812 
+0.414062 0.507812 0.507812 
+0.421875 0.507812 0.507812 
+0.421875 0.507812 0.515625 
+0.429688 0.5 0.5 
+0.429688 0.5 0.507812 
+0.4375 0.5 0.507812 
+0.429688 0.507812 0.507812 
+0.4375 0.507812 0.507812 
+0.4375 0.507812 0.515625 
+0.429688 0.5 0.515625 
+0.429688 0.507812 0.515625 
+0.429688 0.515625 0.515625 
+0.429688 0.5 0.523438 
+0.4375 0.5 0.523438 
+0.429688 0.507812 0.523438 
+0.4375 0.507812 0.523438 
+0.4375 0.507812 0.53125 
+0.4375 0.515625 0.523438 
+0.429688 0.515625 0.523438 
+0.429688 0.523438 0.523438 
+0.4375 0.523438 0.523438 
+0.4375 0.523438 0.53125 
+0.40625 0.5 0.507812 
+0.414062 0.5 0.515625 
+0.414062 0.507812 0.515625 
+0.40625 0.5 0.523438 
+0.414062 0.5 0.523438 
+0.414062 0.5 0.53125 
+0.414062 0.507812 0.523438 
+0.414062 0.507812 0.53125 
+0.421875 0.507812 0.53125 
+0.421875 0.5 0.523438 
+0.421875 0.507812 0.523438 
+0.421875 0.515625 0.523438 
+0.429688 0.5 0.53125 
+0.429688 0.507812 0.53125 
+0.429688 0.515625 0.53125 
+0.429688 0.523438 0.53125 
+0.40625 0.507812 0.507812 
+0.40625 0.507812 0.515625 
+0.414062 0.515625 0.515625 
+0.40625 0.507812 0.523438 
+0.40625 0.507812 0.53125 
+0.414062 0.515625 0.53125 
+0.40625 0.515625 0.523438 
+0.414062 0.515625 0.523438 
+0.40625 0.523438 0.523438 
+0.40625 0.523438 0.53125 
+0.414062 0.523438 0.523438 
+0.414062 0.523438 0.53125 
+0.414062 0.53125 0.53125 
+0.421875 0.523438 0.53125 
+0.421875 0.523438 0.523438 
+0.429688 0.53125 0.53125 
+0.414062 0.5 0.539062 
+0.421875 0.5 0.539062 
+0.414062 0.507812 0.539062 
+0.421875 0.507812 0.539062 
+0.421875 0.507812 0.546875 
+0.429688 0.5 0.539062 
+0.4375 0.5 0.539062 
+0.429688 0.507812 0.539062 
+0.4375 0.507812 0.539062 
+0.4375 0.507812 0.546875 
+0.429688 0.5 0.546875 
+0.429688 0.507812 0.546875 
+0.429688 0.515625 0.546875 
+0.429688 0.5 0.554688 
+0.4375 0.5 0.554688 
+0.429688 0.507812 0.554688 
+0.4375 0.507812 0.554688 
+0.4375 0.507812 0.5625 
+0.4375 0.515625 0.554688 
+0.429688 0.515625 0.554688 
+0.429688 0.523438 0.554688 
+0.4375 0.523438 0.554688 
+0.4375 0.523438 0.5625 
+0.421875 0.515625 0.539062 
+0.4375 0.515625 0.539062 
+0.429688 0.515625 0.539062 
+0.429688 0.523438 0.539062 
+0.4375 0.523438 0.539062 
+0.4375 0.53125 0.539062 
+0.4375 0.523438 0.546875 
+0.429688 0.523438 0.546875 
+0.4375 0.53125 0.554688 
+0.414062 0.515625 0.539062 
+0.414062 0.523438 0.539062 
+0.414062 0.53125 0.539062 
+0.421875 0.53125 0.539062 
+0.421875 0.523438 0.539062 
+0.421875 0.523438 0.546875 
+0.429688 0.53125 0.539062 
+0.429688 0.53125 0.546875 
+0.429688 0.53125 0.554688 
+0.414062 0.539062 0.539062 
+0.421875 0.539062 0.539062 
+0.421875 0.539062 0.546875 
+0.429688 0.539062 0.539062 
+0.4375 0.539062 0.539062 
+0.4375 0.539062 0.546875 
+0.429688 0.539062 0.546875 
+0.429688 0.546875 0.546875 
+0.429688 0.539062 0.554688 
+0.4375 0.539062 0.554688 
+0.4375 0.539062 0.5625 
+0.4375 0.546875 0.554688 
+0.429688 0.546875 0.554688 
+0.429688 0.554688 0.554688 
+0.4375 0.554688 0.554688 
+0.4375 0.554688 0.5625 
+0.445312 0.5 0.5 
+0.445312 0.5 0.507812 
+0.453125 0.5 0.507812 
+0.445312 0.507812 0.507812 
+0.453125 0.507812 0.507812 
+0.453125 0.507812 0.515625 
+0.460938 0.5 0.5 
+0.460938 0.5 0.507812 
+0.46875 0.5 0.507812 
+0.460938 0.507812 0.507812 
+0.46875 0.507812 0.507812 
+0.46875 0.507812 0.515625 
+0.460938 0.5 0.515625 
+0.460938 0.507812 0.515625 
+0.460938 0.515625 0.515625 
+0.460938 0.5 0.523438 
+0.46875 0.5 0.523438 
+0.460938 0.507812 0.523438 
+0.46875 0.507812 0.523438 
+0.46875 0.507812 0.53125 
+0.46875 0.515625 0.523438 
+0.460938 0.515625 0.523438 
+0.460938 0.523438 0.523438 
+0.46875 0.523438 0.523438 
+0.46875 0.523438 0.53125 
+0.476562 0.5 0.5 
+0.476562 0.5 0.507812 
+0.484375 0.5 0.507812 
+0.476562 0.507812 0.507812 
+0.484375 0.507812 0.507812 
+0.484375 0.507812 0.515625 
+0.492188 0.5 0.5 
+0.492188 0.5 0.507812 
+0.5 0.5 0.507812 
+0.492188 0.507812 0.507812 
+0.5 0.507812 0.507812 
+0.5 0.507812 0.515625 
+0.492188 0.5 0.515625 
+0.492188 0.507812 0.515625 
+0.492188 0.515625 0.515625 
+0.492188 0.5 0.523438 
+0.5 0.5 0.523438 
+0.492188 0.507812 0.523438 
+0.5 0.507812 0.523438 
+0.5 0.507812 0.53125 
+0.5 0.515625 0.523438 
+0.492188 0.515625 0.523438 
+0.492188 0.523438 0.523438 
+0.5 0.523438 0.523438 
+0.5 0.523438 0.53125 
+0.476562 0.5 0.515625 
+0.476562 0.507812 0.515625 
+0.476562 0.5 0.523438 
+0.476562 0.5 0.53125 
+0.476562 0.507812 0.523438 
+0.476562 0.507812 0.53125 
+0.484375 0.507812 0.53125 
+0.484375 0.5 0.523438 
+0.484375 0.507812 0.523438 
+0.484375 0.515625 0.523438 
+0.492188 0.5 0.53125 
+0.492188 0.507812 0.53125 
+0.492188 0.515625 0.53125 
+0.492188 0.523438 0.53125 
+0.476562 0.515625 0.515625 
+0.476562 0.515625 0.53125 
+0.476562 0.515625 0.523438 
+0.476562 0.523438 0.523438 
+0.476562 0.523438 0.53125 
+0.476562 0.53125 0.53125 
+0.484375 0.523438 0.53125 
+0.484375 0.523438 0.523438 
+0.492188 0.53125 0.53125 
+0.476562 0.5 0.539062 
+0.484375 0.5 0.539062 
+0.476562 0.507812 0.539062 
+0.484375 0.507812 0.539062 
+0.484375 0.507812 0.546875 
+0.492188 0.5 0.539062 
+0.5 0.5 0.539062 
+0.492188 0.507812 0.539062 
+0.5 0.507812 0.539062 
+0.5 0.507812 0.546875 
+0.492188 0.5 0.546875 
+0.492188 0.507812 0.546875 
+0.492188 0.515625 0.546875 
+0.492188 0.5 0.554688 
+0.5 0.5 0.554688 
+0.492188 0.507812 0.554688 
+0.5 0.507812 0.554688 
+0.5 0.507812 0.5625 
+0.5 0.515625 0.554688 
+0.492188 0.515625 0.554688 
+0.492188 0.523438 0.554688 
+0.5 0.523438 0.554688 
+0.5 0.523438 0.5625 
+0.484375 0.515625 0.539062 
+0.5 0.515625 0.539062 
+0.492188 0.515625 0.539062 
+0.492188 0.523438 0.539062 
+0.5 0.523438 0.539062 
+0.5 0.53125 0.539062 
+0.5 0.523438 0.546875 
+0.492188 0.523438 0.546875 
+0.5 0.53125 0.554688 
+0.476562 0.515625 0.539062 
+0.476562 0.523438 0.539062 
+0.476562 0.53125 0.539062 
+0.484375 0.53125 0.539062 
+0.484375 0.445312 0.53125 
+0.492188 0.445312 0.53125 
+0.492188 0.453125 0.53125 
+0.492188 0.445312 0.539062 
+0.492188 0.453125 0.539062 
+0.5 0.453125 0.539062 
+0.484375 0.445312 0.539062 
+0.484375 0.453125 0.539062 
+0.492188 0.453125 0.546875 
+0.492188 0.460938 0.53125 
+0.5 0.460938 0.53125 
+0.492188 0.460938 0.539062 
+0.5 0.460938 0.539062 
+0.5 0.46875 0.539062 
+0.5 0.460938 0.546875 
+0.492188 0.460938 0.546875 
+0.492188 0.460938 0.554688 
+0.5 0.460938 0.554688 
+0.5 0.46875 0.554688 
+0.46875 0.445312 0.53125 
+0.476562 0.445312 0.53125 
+0.476562 0.453125 0.53125 
+0.476562 0.445312 0.539062 
+0.476562 0.453125 0.539062 
+0.46875 0.460938 0.53125 
+0.476562 0.460938 0.53125 
+0.476562 0.46875 0.53125 
+0.476562 0.460938 0.539062 
+0.476562 0.46875 0.539062 
+0.484375 0.46875 0.539062 
+0.484375 0.460938 0.53125 
+0.484375 0.460938 0.539062 
+0.484375 0.460938 0.546875 
+0.492188 0.46875 0.53125 
+0.492188 0.46875 0.539062 
+0.492188 0.46875 0.546875 
+0.492188 0.46875 0.554688 
+0.476562 0.476562 0.539062 
+0.484375 0.476562 0.539062 
+0.484375 0.476562 0.546875 
+0.492188 0.476562 0.539062 
+0.5 0.476562 0.539062 
+0.5 0.476562 0.546875 
+0.492188 0.476562 0.546875 
+0.492188 0.484375 0.546875 
+0.492188 0.476562 0.554688 
+0.5 0.476562 0.554688 
+0.5 0.476562 0.5625 
+0.5 0.484375 0.554688 
+0.492188 0.484375 0.554688 
+0.492188 0.492188 0.554688 
+0.5 0.492188 0.554688 
+0.5 0.492188 0.5625 
+0.445312 0.445312 0.507812 
+0.445312 0.445312 0.515625 
+0.453125 0.445312 0.515625 
+0.445312 0.445312 0.523438 
+0.445312 0.445312 0.53125 
+0.453125 0.445312 0.53125 
+0.453125 0.445312 0.523438 
+0.453125 0.453125 0.523438 
+0.460938 0.445312 0.523438 
+0.460938 0.445312 0.53125 
+0.460938 0.453125 0.53125 
+0.460938 0.453125 0.523438 
+0.460938 0.460938 0.523438 
+0.460938 0.460938 0.53125 
+0.445312 0.445312 0.539062 
+0.445312 0.445312 0.546875 
+0.453125 0.445312 0.546875 
+0.4375 0.4375 0.554688 
+0.445312 0.4375 0.554688 
+0.445312 0.4375 0.5625 
+0.445312 0.445312 0.554688 
+0.445312 0.445312 0.5625 
+0.453125 0.445312 0.5625 
+0.453125 0.445312 0.554688 
+0.453125 0.453125 0.554688 
+0.460938 0.445312 0.554688 
+0.460938 0.445312 0.5625 
+0.46875 0.445312 0.5625 
+0.460938 0.453125 0.5625 
+0.460938 0.453125 0.554688 
+0.460938 0.460938 0.554688 
+0.460938 0.460938 0.5625 
+0.46875 0.460938 0.5625 
+0.453125 0.445312 0.539062 
+0.460938 0.4375 0.539062 
+0.46875 0.4375 0.539062 
+0.460938 0.445312 0.539062 
+0.46875 0.445312 0.539062 
+0.46875 0.445312 0.546875 
+0.460938 0.4375 0.546875 
+0.460938 0.445312 0.546875 
+0.460938 0.453125 0.546875 
+0.46875 0.4375 0.554688 
+0.46875 0.445312 0.554688 
+0.46875 0.453125 0.554688 
+0.46875 0.460938 0.554688 
+0.453125 0.453125 0.539062 
+0.46875 0.453125 0.539062 
+0.460938 0.453125 0.539062 
+0.460938 0.460938 0.539062 
+0.46875 0.460938 0.539062 
+0.46875 0.46875 0.539062 
+0.46875 0.460938 0.546875 
+0.460938 0.460938 0.546875 
+0.46875 0.46875 0.554688 
+0.476562 0.4375 0.546875 
+0.476562 0.445312 0.546875 
+0.484375 0.445312 0.546875 
+0.476562 0.4375 0.554688 
+0.476562 0.4375 0.5625 
+0.476562 0.445312 0.554688 
+0.476562 0.445312 0.5625 
+0.484375 0.445312 0.5625 
+0.484375 0.4375 0.554688 
+0.484375 0.445312 0.554688 
+0.484375 0.453125 0.554688 
+0.492188 0.4375 0.5625 
+0.492188 0.445312 0.554688 
+0.492188 0.445312 0.5625 
+0.5 0.445312 0.5625 
+0.492188 0.453125 0.5625 
+0.492188 0.453125 0.554688 
+0.492188 0.460938 0.5625 
+0.5 0.460938 0.5625 
+0.476562 0.453125 0.546875 
+0.476562 0.453125 0.5625 
+0.476562 0.453125 0.554688 
+0.476562 0.460938 0.554688 
+0.476562 0.460938 0.5625 
+0.476562 0.46875 0.5625 
+0.484375 0.460938 0.5625 
+0.484375 0.460938 0.554688 
+0.492188 0.46875 0.5625 
+0.476562 0.46875 0.546875 
+0.476562 0.460938 0.546875 
+0.476562 0.46875 0.554688 
+0.484375 0.46875 0.554688 
+0.476562 0.476562 0.546875 
+0.476562 0.476562 0.554688 
+0.476562 0.476562 0.5625 
+0.484375 0.476562 0.5625 
+0.484375 0.476562 0.554688 
+0.484375 0.484375 0.554688 
+0.492188 0.476562 0.5625 
+0.492188 0.484375 0.5625 
+0.492188 0.492188 0.5625 
+0.445312 0.445312 0.570312 
+0.453125 0.445312 0.570312 
+0.453125 0.453125 0.570312 
+0.460938 0.445312 0.570312 
+0.46875 0.445312 0.570312 
+0.46875 0.453125 0.570312 
+0.460938 0.453125 0.570312 
+0.460938 0.453125 0.578125 
+0.460938 0.460938 0.570312 
+0.46875 0.460938 0.570312 
+0.46875 0.46875 0.570312 
+0.46875 0.460938 0.578125 
+0.460938 0.460938 0.578125 
+0.460938 0.460938 0.585938 
+0.46875 0.460938 0.585938 
+0.46875 0.46875 0.585938 
+0.476562 0.445312 0.570312 
+0.484375 0.445312 0.570312 
+0.484375 0.453125 0.570312 
+0.492188 0.445312 0.570312 
+0.5 0.445312 0.570312 
+0.5 0.453125 0.570312 
+0.492188 0.453125 0.570312 
+0.492188 0.453125 0.578125 
+0.492188 0.460938 0.570312 
+0.5 0.460938 0.570312 
+0.5 0.46875 0.570312 
+0.5 0.460938 0.578125 
+0.492188 0.460938 0.578125 
+0.492188 0.460938 0.585938 
+0.5 0.460938 0.585938 
+0.5 0.46875 0.585938 
+0.476562 0.453125 0.570312 
+0.476562 0.460938 0.570312 
+0.476562 0.46875 0.570312 
+0.484375 0.46875 0.570312 
+0.484375 0.460938 0.570312 
+0.484375 0.460938 0.578125 
+0.492188 0.46875 0.570312 
+0.492188 0.46875 0.578125 
+0.492188 0.46875 0.585938 
+0.476562 0.453125 0.578125 
+0.476562 0.46875 0.578125 
+0.476562 0.460938 0.578125 
+0.476562 0.460938 0.585938 
+0.476562 0.46875 0.585938 
+0.476562 0.46875 0.59375 
+0.484375 0.46875 0.585938 
+0.484375 0.460938 0.585938 
+0.492188 0.46875 0.59375 
+0.476562 0.476562 0.570312 
+0.484375 0.476562 0.570312 
+0.484375 0.484375 0.570312 
+0.492188 0.476562 0.570312 
+0.5 0.476562 0.570312 
+0.5 0.484375 0.570312 
+0.492188 0.484375 0.570312 
+0.492188 0.484375 0.578125 
+0.492188 0.492188 0.570312 
+0.5 0.492188 0.570312 
+0.5 0.5 0.570312 
+0.5 0.492188 0.578125 
+0.492188 0.492188 0.578125 
+0.492188 0.492188 0.585938 
+0.5 0.492188 0.585938 
+0.5 0.5 0.585938 
+0.484375 0.476562 0.578125 
+0.5 0.476562 0.578125 
+0.515625 0.484375 0.539062 
+0.523438 0.484375 0.539062 
+0.523438 0.484375 0.546875 
+0.523438 0.492188 0.539062 
+0.523438 0.492188 0.546875 
+0.53125 0.492188 0.546875 
+0.523438 0.492188 0.554688 
+0.53125 0.492188 0.554688 
+0.53125 0.5 0.554688 
+0.53125 0.476562 0.53125 
+0.53125 0.476562 0.539062 
+0.53125 0.484375 0.539062 
+0.539062 0.484375 0.539062 
+0.539062 0.484375 0.546875 
+0.53125 0.492188 0.53125 
+0.53125 0.492188 0.539062 
+0.53125 0.5 0.539062 
+0.539062 0.492188 0.539062 
+0.539062 0.5 0.539062 
+0.539062 0.5 0.546875 
+0.539062 0.492188 0.546875 
+0.546875 0.492188 0.546875 
+0.539062 0.492188 0.554688 
+0.539062 0.5 0.554688 
+0.539062 0.5 0.5625 
+0.546875 0.5 0.554688 
+0.546875 0.492188 0.554688 
+0.554688 0.5 0.554688 
+0.554688 0.5 0.5625 
+0.5 0.445312 0.507812 
+0.5 0.445312 0.515625 
+0.507812 0.445312 0.507812 
+0.507812 0.445312 0.515625 
+0.507812 0.453125 0.515625 
+0.5 0.445312 0.523438 
+0.5 0.445312 0.53125 
+0.507812 0.445312 0.523438 
+0.507812 0.445312 0.53125 
+0.507812 0.453125 0.53125 
+0.5 0.453125 0.523438 
+0.507812 0.453125 0.523438 
+0.515625 0.453125 0.523438 
+0.5 0.460938 0.523438 
+0.507812 0.460938 0.523438 
+0.507812 0.460938 0.53125 
+0.507812 0.46875 0.53125 
+0.515625 0.460938 0.53125 
+0.515625 0.460938 0.523438 
+0.523438 0.460938 0.523438 
+0.523438 0.460938 0.53125 
+0.523438 0.46875 0.53125 
+0.5 0.445312 0.539062 
+0.5 0.445312 0.546875 
+0.507812 0.445312 0.539062 
+0.507812 0.445312 0.546875 
+0.507812 0.453125 0.546875 
+0.5 0.445312 0.554688 
+0.507812 0.445312 0.554688 
+0.507812 0.445312 0.5625 
+0.507812 0.453125 0.5625 
+0.5 0.453125 0.554688 
+0.507812 0.453125 0.554688 
+0.515625 0.453125 0.554688 
+0.507812 0.460938 0.554688 
+0.507812 0.460938 0.5625 
+0.507812 0.46875 0.5625 
+0.515625 0.460938 0.5625 
+0.515625 0.460938 0.554688 
+0.523438 0.460938 0.554688 
+0.523438 0.460938 0.5625 
+0.523438 0.46875 0.5625 
+0.507812 0.453125 0.539062 
+0.507812 0.460938 0.539062 
+0.507812 0.46875 0.539062 
+0.507812 0.46875 0.546875 
+0.507812 0.460938 0.546875 
+0.515625 0.460938 0.546875 
+0.507812 0.46875 0.554688 
+0.515625 0.46875 0.554688 
+0.523438 0.46875 0.554688 
+0.515625 0.453125 0.539062 
+0.515625 0.46875 0.539062 
+0.515625 0.460938 0.539062 
+0.523438 0.460938 0.539062 
+0.523438 0.46875 0.539062 
+0.53125 0.46875 0.539062 
+0.523438 0.46875 0.546875 
+0.523438 0.460938 0.546875 
+0.53125 0.46875 0.554688 
+0.507812 0.476562 0.539062 
+0.507812 0.476562 0.546875 
+0.507812 0.484375 0.546875 
+0.507812 0.476562 0.554688 
+0.507812 0.476562 0.5625 
+0.507812 0.484375 0.5625 
+0.507812 0.484375 0.554688 
+0.515625 0.484375 0.554688 
+0.507812 0.492188 0.554688 
+0.507812 0.492188 0.5625 
+0.507812 0.5 0.5625 
+0.515625 0.492188 0.5625 
+0.515625 0.492188 0.554688 
+0.523438 0.492188 0.5625 
+0.523438 0.5 0.5625 
+0.515625 0.476562 0.546875 
+0.515625 0.476562 0.5625 
+0.515625 0.476562 0.554688 
+0.523438 0.476562 0.554688 
+0.523438 0.476562 0.5625 
+0.53125 0.476562 0.5625 
+0.523438 0.484375 0.5625 
+0.523438 0.484375 0.554688 
+0.53125 0.492188 0.5625 
+0.515625 0.476562 0.539062 
+0.523438 0.476562 0.539062 
+0.53125 0.476562 0.546875 
+0.523438 0.476562 0.546875 
+0.53125 0.476562 0.554688 
+0.53125 0.484375 0.554688 
+0.539062 0.476562 0.546875 
+0.539062 0.476562 0.554688 
+0.539062 0.476562 0.5625 
+0.539062 0.484375 0.5625 
+0.539062 0.484375 0.554688 
+0.546875 0.484375 0.554688 
+0.539062 0.492188 0.5625 
+0.546875 0.492188 0.5625 
+0.554688 0.492188 0.5625 
+0.507812 0.4375 0.507812 
+0.507812 0.4375 0.515625 
+0.515625 0.445312 0.515625 
+0.507812 0.4375 0.523438 
+0.507812 0.4375 0.53125 
+0.515625 0.445312 0.53125 
+0.515625 0.4375 0.523438 
+0.515625 0.445312 0.523438 
+0.523438 0.4375 0.523438 
+0.523438 0.4375 0.53125 
+0.523438 0.445312 0.523438 
+0.523438 0.445312 0.53125 
+0.53125 0.445312 0.53125 
+0.523438 0.453125 0.53125 
+0.523438 0.453125 0.523438 
+0.53125 0.460938 0.53125 
+0.507812 0.4375 0.539062 
+0.507812 0.4375 0.546875 
+0.515625 0.445312 0.546875 
+0.507812 0.4375 0.554688 
+0.507812 0.4375 0.5625 
+0.515625 0.445312 0.5625 
+0.515625 0.4375 0.554688 
+0.515625 0.445312 0.554688 
+0.523438 0.4375 0.554688 
+0.523438 0.4375 0.5625 
+0.523438 0.445312 0.554688 
+0.523438 0.445312 0.5625 
+0.53125 0.445312 0.5625 
+0.523438 0.453125 0.5625 
+0.523438 0.453125 0.554688 
+0.53125 0.460938 0.5625 
+0.515625 0.4375 0.539062 
+0.515625 0.445312 0.539062 
+0.523438 0.4375 0.539062 
+0.53125 0.4375 0.539062 
+0.523438 0.445312 0.539062 
+0.53125 0.445312 0.539062 
+0.53125 0.445312 0.546875 
+0.523438 0.4375 0.546875 
+0.523438 0.445312 0.546875 
+0.523438 0.453125 0.546875 
+0.53125 0.4375 0.554688 
+0.53125 0.445312 0.554688 
+0.53125 0.453125 0.554688 
+0.53125 0.460938 0.554688 
+0.53125 0.453125 0.539062 
+0.523438 0.453125 0.539062 
+0.53125 0.460938 0.539062 
+0.53125 0.460938 0.546875 
+0.539062 0.4375 0.539062 
+0.539062 0.4375 0.546875 
+0.539062 0.445312 0.539062 
+0.539062 0.445312 0.546875 
+0.546875 0.445312 0.546875 
+0.539062 0.4375 0.554688 
+0.539062 0.4375 0.5625 
+0.539062 0.445312 0.554688 
+0.539062 0.445312 0.5625 
+0.546875 0.445312 0.5625 
+0.546875 0.4375 0.554688 
+0.546875 0.445312 0.554688 
+0.546875 0.453125 0.554688 
+0.554688 0.4375 0.554688 
+0.554688 0.4375 0.5625 
+0.554688 0.445312 0.554688 
+0.554688 0.445312 0.5625 
+0.5625 0.445312 0.5625 
+0.554688 0.453125 0.5625 
+0.554688 0.453125 0.554688 
+0.554688 0.460938 0.554688 
+0.554688 0.460938 0.5625 
+0.539062 0.453125 0.546875 
+0.539062 0.453125 0.5625 
+0.539062 0.453125 0.554688 
+0.539062 0.460938 0.554688 
+0.539062 0.460938 0.5625 
+0.539062 0.46875 0.5625 
+0.546875 0.460938 0.5625 
+0.546875 0.460938 0.554688 
+0.554688 0.46875 0.5625 
+0.539062 0.453125 0.539062 
+0.539062 0.460938 0.539062 
+0.539062 0.46875 0.546875 
+0.539062 0.460938 0.546875 
+0.546875 0.460938 0.546875 
+0.539062 0.46875 0.554688 
+0.546875 0.46875 0.554688 
+0.445312 0.476562 0.53125 
+0.445312 0.484375 0.53125 
+0.445312 0.476562 0.539062 
+0.445312 0.484375 0.539062 
+0.453125 0.484375 0.539062 
+0.445312 0.492188 0.53125 
+0.445312 0.5 0.53125 
+0.445312 0.492188 0.539062 
+0.445312 0.5 0.539062 
+0.453125 0.5 0.539062 
+0.453125 0.492188 0.53125 
+0.453125 0.492188 0.539062 
+0.453125 0.492188 0.546875 
+0.460938 0.492188 0.53125 
+0.460938 0.5 0.53125 
+0.460938 0.492188 0.539062 
+0.460938 0.5 0.539062 
+0.46875 0.5 0.539062 
+0.460938 0.5 0.546875 
+0.460938 0.492188 0.546875 
+0.460938 0.492188 0.554688 
+0.460938 0.5 0.554688 
+0.46875 0.5 0.554688 
+0.445312 0.46875 0.53125 
+0.453125 0.476562 0.53125 
+0.453125 0.476562 0.539062 
+0.460938 0.46875 0.53125 
+0.460938 0.476562 0.53125 
+0.46875 0.476562 0.53125 
+0.460938 0.476562 0.539062 
+0.46875 0.476562 0.539062 
+0.46875 0.484375 0.539062 
+0.460938 0.484375 0.53125 
+0.460938 0.484375 0.539062 
+0.460938 0.484375 0.546875 
+0.46875 0.492188 0.53125 
+0.46875 0.492188 0.539062 
+0.46875 0.492188 0.546875 
+0.46875 0.492188 0.554688 
+0.476562 0.484375 0.539062 
+0.476562 0.484375 0.546875 
+0.476562 0.492188 0.539062 
+0.476562 0.5 0.546875 
+0.476562 0.492188 0.546875 
+0.484375 0.492188 0.546875 
+0.476562 0.492188 0.554688 
+0.476562 0.5 0.554688 
+0.476562 0.5 0.5625 
+0.484375 0.5 0.554688 
+0.484375 0.492188 0.554688 
+0.492188 0.5 0.5625 
+0.445312 0.453125 0.515625 
+0.445312 0.453125 0.53125 
+0.445312 0.453125 0.523438 
+0.445312 0.460938 0.523438 
+0.445312 0.460938 0.53125 
+0.453125 0.460938 0.53125 
+0.453125 0.460938 0.523438 
+0.445312 0.453125 0.546875 
+0.4375 0.445312 0.554688 
+0.4375 0.445312 0.5625 
+0.445312 0.453125 0.5625 
+0.445312 0.453125 0.554688 
+0.445312 0.460938 0.554688 
+0.445312 0.460938 0.5625 
+0.445312 0.46875 0.5625 
+0.453125 0.460938 0.5625 
+0.453125 0.460938 0.554688 
+0.460938 0.46875 0.5625 
+0.4375 0.453125 0.539062 
+0.445312 0.453125 0.539062 
+0.4375 0.460938 0.539062 
+0.4375 0.46875 0.539062 
+0.445312 0.460938 0.539062 
+0.445312 0.46875 0.539062 
+0.445312 0.46875 0.546875 
+0.4375 0.460938 0.546875 
+0.445312 0.460938 0.546875 
+0.453125 0.460938 0.546875 
+0.4375 0.46875 0.554688 
+0.445312 0.46875 0.554688 
+0.453125 0.46875 0.554688 
+0.460938 0.46875 0.554688 
+0.453125 0.46875 0.539062 
+0.453125 0.460938 0.539062 
+0.460938 0.46875 0.539062 
+0.460938 0.46875 0.546875 
+0.4375 0.476562 0.546875 
+0.445312 0.476562 0.546875 
+0.445312 0.484375 0.546875 
+0.4375 0.476562 0.554688 
+0.4375 0.476562 0.5625 
+0.445312 0.476562 0.554688 
+0.445312 0.476562 0.5625 
+0.445312 0.484375 0.5625 
+0.4375 0.484375 0.554688 
+0.445312 0.484375 0.554688 
+0.453125 0.484375 0.554688 
+0.4375 0.492188 0.5625 
+0.445312 0.492188 0.554688 
+0.445312 0.492188 0.5625 
+0.445312 0.5 0.5625 
+0.453125 0.492188 0.5625 
+0.453125 0.492188 0.554688 
+0.460938 0.492188 0.5625 
+0.460938 0.5 0.5625 
+0.453125 0.476562 0.546875 
+0.453125 0.476562 0.5625 
+0.453125 0.476562 0.554688 
+0.460938 0.476562 0.554688 
+0.460938 0.476562 0.5625 
+0.46875 0.476562 0.5625 
+0.460938 0.484375 0.5625 
+0.460938 0.484375 0.554688 
+0.46875 0.492188 0.5625 
+0.46875 0.476562 0.546875 
+0.460938 0.476562 0.546875 
+0.46875 0.476562 0.554688 
+0.46875 0.484375 0.554688 
+0.476562 0.484375 0.5625 
+0.476562 0.484375 0.554688 
+0.476562 0.492188 0.5625 
+0.484375 0.492188 0.5625 
+0.445312 0.453125 0.570312 
+0.445312 0.460938 0.570312 
+0.445312 0.46875 0.570312 
+0.453125 0.46875 0.570312 
+0.453125 0.460938 0.570312 
+0.453125 0.460938 0.578125 
+0.460938 0.46875 0.570312 
+0.460938 0.46875 0.578125 
+0.460938 0.46875 0.585938 
+0.445312 0.476562 0.570312 
+0.445312 0.484375 0.570312 
+0.453125 0.484375 0.570312 
+0.445312 0.492188 0.570312 
+0.445312 0.5 0.570312 
+0.453125 0.5 0.570312 
+0.453125 0.492188 0.570312 
+0.453125 0.492188 0.578125 
+0.460938 0.492188 0.570312 
+0.460938 0.5 0.570312 
+0.46875 0.5 0.570312 
+0.460938 0.5 0.578125 
+0.460938 0.492188 0.578125 
+0.460938 0.492188 0.585938 
+0.460938 0.5 0.585938 
+0.46875 0.5 0.585938 
+0.453125 0.476562 0.570312 
+0.460938 0.476562 0.570312 
+0.46875 0.476562 0.570312 
+0.46875 0.484375 0.570312 
+0.460938 0.484375 0.570312 
+0.460938 0.484375 0.578125 
+0.46875 0.492188 0.570312 
+0.46875 0.492188 0.578125 
+0.46875 0.492188 0.585938 
+0.453125 0.476562 0.578125 
+0.46875 0.476562 0.578125 
+0.460938 0.476562 0.578125 
+0.460938 0.476562 0.585938 
+0.46875 0.476562 0.585938 
+0.46875 0.476562 0.59375 
+0.46875 0.484375 0.585938 
+0.460938 0.484375 0.585938 
+0.46875 0.492188 0.59375 
+0.476562 0.484375 0.570312 
+0.476562 0.492188 0.570312 
+0.476562 0.5 0.570312 
+0.484375 0.5 0.570312 
+0.484375 0.492188 0.570312 
+0.484375 0.492188 0.578125 
+0.492188 0.5 0.570312 
+0.492188 0.5 0.578125 
+0.492188 0.5 0.585938 
+0.484375 0.53125 0.523438 
+0.492188 0.53125 0.523438 
+0.492188 0.539062 0.523438 
+0.492188 0.539062 0.53125 
+0.5 0.539062 0.53125 
+0.484375 0.539062 0.523438 
+0.484375 0.539062 0.53125 
+0.492188 0.546875 0.53125 
+0.484375 0.539062 0.515625 
+0.484375 0.546875 0.523438 
+0.492188 0.546875 0.523438 
+0.492188 0.554688 0.523438 
+0.492188 0.554688 0.53125 
+0.5 0.554688 0.53125 
+0.476562 0.539062 0.53125 
+0.476562 0.539062 0.539062 
+0.484375 0.539062 0.539062 
+0.484375 0.546875 0.539062 
+0.492188 0.539062 0.539062 
+0.5 0.539062 0.539062 
+0.5 0.546875 0.539062 
+0.492188 0.546875 0.539062 
+0.492188 0.546875 0.546875 
+0.492188 0.554688 0.539062 
+0.5 0.554688 0.539062 
+0.5 0.5625 0.539062 
+0.5 0.554688 0.546875 
+0.492188 0.554688 0.546875 
+0.492188 0.554688 0.554688 
+0.5 0.554688 0.554688 
+0.5 0.5625 0.554688 
+0.445312 0.515625 0.507812 
+0.453125 0.515625 0.507812 
+0.445312 0.523438 0.507812 
+0.445312 0.53125 0.507812 
+0.453125 0.53125 0.507812 
+0.453125 0.523438 0.507812 
+0.453125 0.523438 0.515625 
+0.460938 0.523438 0.507812 
+0.460938 0.53125 0.507812 
+0.46875 0.53125 0.507812 
+0.460938 0.53125 0.515625 
+0.460938 0.523438 0.515625 
+0.460938 0.53125 0.523438 
+0.46875 0.53125 0.523438 
+0.445312 0.539062 0.507812 
+0.445312 0.546875 0.507812 
+0.453125 0.546875 0.507812 
+0.445312 0.554688 0.507812 
+0.445312 0.5625 0.507812 
+0.453125 0.5625 0.507812 
+0.453125 0.554688 0.507812 
+0.453125 0.554688 0.515625 
+0.460938 0.554688 0.507812 
+0.460938 0.5625 0.507812 
+0.46875 0.5625 0.507812 
+0.460938 0.5625 0.515625 
+0.460938 0.554688 0.515625 
+0.460938 0.554688 0.523438 
+0.460938 0.5625 0.523438 
+0.46875 0.5625 0.523438 
+0.453125 0.539062 0.507812 
+0.460938 0.539062 0.507812 
+0.46875 0.539062 0.507812 
+0.46875 0.546875 0.507812 
+0.460938 0.546875 0.507812 
+0.460938 0.546875 0.515625 
+0.46875 0.554688 0.507812 
+0.46875 0.554688 0.515625 
+0.46875 0.554688 0.523438 
+0.453125 0.539062 0.515625 
+0.46875 0.539062 0.515625 
+0.460938 0.539062 0.515625 
+0.460938 0.539062 0.523438 
+0.46875 0.539062 0.523438 
+0.46875 0.539062 0.53125 
+0.46875 0.546875 0.523438 
+0.460938 0.546875 0.523438 
+0.46875 0.554688 0.53125 
+0.476562 0.546875 0.5 
+0.476562 0.539062 0.507812 
+0.476562 0.546875 0.507812 
+0.484375 0.546875 0.507812 
+0.476562 0.554688 0.5 
+0.476562 0.5625 0.5 
+0.476562 0.554688 0.507812 
+0.476562 0.5625 0.507812 
+0.484375 0.5625 0.507812 
+0.484375 0.554688 0.5 
+0.484375 0.554688 0.507812 
+0.484375 0.554688 0.515625 
+0.492188 0.5625 0.5 
+0.492188 0.554688 0.507812 
+0.492188 0.5625 0.507812 
+0.5 0.5625 0.507812 
+0.492188 0.5625 0.515625 
+0.492188 0.554688 0.515625 
+0.492188 0.5625 0.523438 
+0.5 0.5625 0.523438 
+0.476562 0.546875 0.515625 
+0.476562 0.5625 0.515625 
+0.476562 0.554688 0.515625 
+0.476562 0.554688 0.523438 
+0.476562 0.5625 0.523438 
+0.476562 0.5625 0.53125 
+0.484375 0.5625 0.523438 
+0.484375 0.554688 0.523438 
+0.492188 0.5625 0.53125 
+0.476562 0.539062 0.515625 
+0.476562 0.539062 0.523438 
+0.476562 0.546875 0.53125 
+0.476562 0.546875 0.523438 
+0.476562 0.554688 0.53125 
+0.484375 0.554688 0.53125 
+0.476562 0.546875 0.539062 
+0.476562 0.554688 0.539062 
+0.476562 0.5625 0.539062 
+0.484375 0.5625 0.539062 
+0.484375 0.554688 0.539062 
+0.484375 0.554688 0.546875 
+0.492188 0.5625 0.539062 
+0.492188 0.5625 0.546875 
+0.4375 0.515625 0.507812 
+0.445312 0.515625 0.515625 
+0.4375 0.523438 0.507812 
+0.4375 0.53125 0.507812 
+0.445312 0.53125 0.515625 
+0.4375 0.523438 0.515625 
+0.445312 0.523438 0.515625 
+0.4375 0.53125 0.523438 
+0.445312 0.523438 0.523438 
+0.445312 0.53125 0.523438 
+0.445312 0.53125 0.53125 
+0.453125 0.53125 0.523438 
+0.453125 0.523438 0.523438 
+0.460938 0.53125 0.53125 
+0.4375 0.539062 0.507812 
+0.4375 0.546875 0.507812 
+0.445312 0.546875 0.515625 
+0.4375 0.554688 0.507812 
+0.4375 0.5625 0.507812 
+0.445312 0.5625 0.515625 
+0.4375 0.554688 0.515625 
+0.445312 0.554688 0.515625 
+0.4375 0.554688 0.523438 
+0.4375 0.5625 0.523438 
+0.445312 0.554688 0.523438 
+0.445312 0.5625 0.523438 
+0.445312 0.5625 0.53125 
+0.453125 0.5625 0.523438 
+0.453125 0.554688 0.523438 
+0.460938 0.5625 0.53125 
+0.4375 0.539062 0.515625 
+0.445312 0.539062 0.515625 
+0.4375 0.539062 0.523438 
+0.4375 0.539062 0.53125 
+0.445312 0.539062 0.523438 
+0.445312 0.539062 0.53125 
+0.445312 0.546875 0.53125 
+0.4375 0.546875 0.523438 
+0.445312 0.546875 0.523438 
+0.453125 0.546875 0.523438 
+0.4375 0.554688 0.53125 
+0.445312 0.554688 0.53125 
+0.453125 0.554688 0.53125 
+0.460938 0.554688 0.53125 
+0.453125 0.539062 0.53125 
+0.453125 0.539062 0.523438 
+0.460938 0.539062 0.53125 
+0.460938 0.546875 0.53125 
+0.4375 0.546875 0.539062 
+0.445312 0.539062 0.539062 
+0.445312 0.546875 0.539062 
+0.445312 0.546875 0.546875 
+0.4375 0.554688 0.539062 
+0.4375 0.5625 0.539062 
+0.445312 0.554688 0.539062 
+0.445312 0.5625 0.539062 
+0.445312 0.5625 0.546875 
+0.4375 0.554688 0.546875 
+0.445312 0.554688 0.546875 
+0.453125 0.554688 0.546875 
+0.4375 0.5625 0.554688 
+0.445312 0.554688 0.554688 
+0.445312 0.5625 0.554688 
+0.445312 0.5625 0.5625 
+0.453125 0.5625 0.554688 
+0.453125 0.554688 0.554688 
+0.460938 0.554688 0.554688 
+0.460938 0.5625 0.554688 
+0.460938 0.5625 0.5625 
+0.453125 0.546875 0.539062 
+0.453125 0.5625 0.539062 
+0.453125 0.554688 0.539062 
+0.460938 0.554688 0.539062 
+0.460938 0.5625 0.539062 
+0.460938 0.5625 0.546875 
+0.460938 0.554688 0.546875 
+0.453125 0.539062 0.539062 
+0.460938 0.539062 0.539062 
+0.46875 0.539062 0.539062 
+0.46875 0.546875 0.539062 
+0.460938 0.546875 0.539062 
+0.460938 0.546875 0.546875 
+0.453125 0.429688 0.539062 
+0.460938 0.429688 0.539062 
+0.460938 0.429688 0.546875 
+0.460938 0.414062 0.539062 
+0.46875 0.414062 0.539062 
+0.46875 0.421875 0.539062 
+0.460938 0.421875 0.539062 
+0.460938 0.421875 0.546875 
+0.46875 0.429688 0.539062 
+0.46875 0.429688 0.546875 
+0.46875 0.429688 0.554688 
+0.476562 0.421875 0.546875 
+0.476562 0.429688 0.546875 
+0.476562 0.429688 0.554688 
+0.484375 0.429688 0.554688 
+0.445312 0.445312 0.5 
+0.453125 0.445312 0.5 
+0.453125 0.445312 0.507812 
+0.453125 0.453125 0.507812 
+0.460938 0.445312 0.5 
+0.46875 0.445312 0.5 
+0.460938 0.445312 0.507812 
+0.46875 0.445312 0.507812 
+0.46875 0.453125 0.507812 
+0.460938 0.453125 0.5 
+0.460938 0.453125 0.507812 
+0.460938 0.453125 0.515625 
+0.460938 0.460938 0.5 
+0.46875 0.460938 0.5 
+0.460938 0.460938 0.507812 
+0.46875 0.460938 0.507812 
+0.46875 0.46875 0.507812 
+0.46875 0.460938 0.515625 
+0.460938 0.460938 0.515625 
+0.46875 0.460938 0.523438 
+0.46875 0.46875 0.523438 
+0.476562 0.445312 0.5 
+0.484375 0.445312 0.5 
+0.476562 0.445312 0.507812 
+0.484375 0.445312 0.507812 
+0.484375 0.453125 0.507812 
+0.492188 0.445312 0.5 
+0.492188 0.445312 0.507812 
+0.5 0.453125 0.507812 
+0.492188 0.453125 0.5 
+0.492188 0.453125 0.507812 
+0.492188 0.453125 0.515625 
+0.492188 0.460938 0.5 
+0.492188 0.460938 0.507812 
+0.5 0.460938 0.507812 
+0.5 0.46875 0.507812 
+0.5 0.460938 0.515625 
+0.492188 0.460938 0.515625 
+0.492188 0.460938 0.523438 
+0.5 0.46875 0.523438 
+0.476562 0.453125 0.5 
+0.476562 0.453125 0.507812 
+0.476562 0.460938 0.5 
+0.476562 0.46875 0.5 
+0.476562 0.460938 0.507812 
+0.476562 0.46875 0.507812 
+0.484375 0.46875 0.507812 
+0.484375 0.460938 0.5 
+0.484375 0.460938 0.507812 
+0.484375 0.460938 0.515625 
+0.492188 0.46875 0.5 
+0.492188 0.46875 0.507812 
+0.492188 0.46875 0.515625 
+0.492188 0.46875 0.523438 
+0.476562 0.453125 0.515625 
+0.476562 0.46875 0.515625 
+0.476562 0.460938 0.515625 
+0.476562 0.460938 0.523438 
+0.476562 0.46875 0.523438 
+0.484375 0.46875 0.523438 
+0.484375 0.460938 0.523438 
+0.476562 0.476562 0.5 
+0.484375 0.476562 0.5 
+0.476562 0.476562 0.507812 
+0.484375 0.476562 0.507812 
+0.484375 0.484375 0.507812 
+0.492188 0.476562 0.5 
+0.492188 0.476562 0.507812 
+0.5 0.476562 0.507812 
+0.5 0.484375 0.507812 
+0.492188 0.484375 0.5 
+0.492188 0.484375 0.507812 
+0.492188 0.484375 0.515625 
+0.492188 0.492188 0.5 
+0.492188 0.492188 0.507812 
+0.5 0.492188 0.507812 
+0.5 0.492188 0.515625 
+0.492188 0.492188 0.515625 
+0.492188 0.492188 0.523438 
+0.5 0.492188 0.523438 
+0.484375 0.476562 0.515625 
+0.5 0.476562 0.515625 
+0.492188 0.476562 0.515625 
+0.492188 0.476562 0.523438 
+0.5 0.476562 0.523438 
+0.5 0.476562 0.53125 
+0.5 0.484375 0.523438 
+0.492188 0.484375 0.523438 
+0.5 0.492188 0.53125 
+0.476562 0.476562 0.515625 
+0.476562 0.476562 0.523438 
+0.476562 0.476562 0.53125 
+0.484375 0.476562 0.53125 
+0.484375 0.476562 0.523438 
+0.484375 0.484375 0.523438 
+0.492188 0.476562 0.53125 
+0.492188 0.484375 0.53125 
+0.492188 0.492188 0.53125 
+0.484375 0.484375 0.539062 
+0.5 0.484375 0.539062 
+0.492188 0.484375 0.539062 
+0.492188 0.492188 0.539062 
+0.5 0.492188 0.539062 
+0.5 0.492188 0.546875 
+0.492188 0.492188 0.546875 
+0.46875 0.445312 0.515625 
+0.460938 0.445312 0.515625 
+0.46875 0.445312 0.523438 
+0.46875 0.453125 0.523438 
+0.484375 0.445312 0.515625 
+0.492188 0.445312 0.515625 
+0.492188 0.445312 0.523438 
+0.492188 0.453125 0.523438 
+0.476562 0.445312 0.515625 
+0.476562 0.445312 0.523438 
+0.484375 0.445312 0.523438 
+0.484375 0.453125 0.523438 
+0.476562 0.453125 0.523438 
+0.492188 0.445312 0.546875 
+0.46875 0.554688 0.539062 
+0.46875 0.554688 0.546875 
+0.46875 0.554688 0.554688 
+0.476562 0.546875 0.546875 
+0.476562 0.554688 0.546875 
+0.476562 0.554688 0.554688 
+0.476562 0.5625 0.5625 
+0.484375 0.554688 0.554688 
+0.445312 0.570312 0.507812 
+0.453125 0.570312 0.507812 
+0.453125 0.578125 0.507812 
+0.460938 0.570312 0.507812 
+0.46875 0.570312 0.507812 
+0.46875 0.578125 0.507812 
+0.460938 0.578125 0.507812 
+0.460938 0.578125 0.515625 
+0.460938 0.585938 0.507812 
+0.46875 0.585938 0.507812 
+0.46875 0.59375 0.507812 
+0.46875 0.585938 0.515625 
+0.460938 0.585938 0.515625 
+0.460938 0.585938 0.523438 
+0.46875 0.585938 0.523438 
+0.46875 0.59375 0.523438 
+0.476562 0.570312 0.507812 
+0.484375 0.570312 0.507812 
+0.484375 0.578125 0.507812 
+0.492188 0.570312 0.507812 
+0.5 0.570312 0.507812 
+0.5 0.578125 0.507812 
+0.492188 0.578125 0.507812 
+0.492188 0.578125 0.515625 
+0.492188 0.585938 0.507812 
+0.5 0.585938 0.507812 
+0.5 0.59375 0.507812 
+0.5 0.585938 0.515625 
+0.492188 0.585938 0.515625 
+0.492188 0.585938 0.523438 
+0.5 0.585938 0.523438 
+0.5 0.59375 0.523438 
+0.476562 0.578125 0.507812 
+0.476562 0.585938 0.507812 
+0.476562 0.59375 0.507812 
+0.484375 0.59375 0.507812 
+0.484375 0.585938 0.507812 
+0.484375 0.585938 0.515625 
+0.492188 0.59375 0.507812 
+0.492188 0.59375 0.515625 
+0.492188 0.59375 0.523438 
+0.476562 0.578125 0.515625 
+0.476562 0.59375 0.515625 
+0.476562 0.585938 0.515625 
+0.476562 0.585938 0.523438 
+0.476562 0.59375 0.523438 
+0.476562 0.59375 0.53125 
+0.484375 0.59375 0.523438 
+0.484375 0.585938 0.523438 
+0.492188 0.59375 0.53125 
+0.453125 0.570312 0.515625 
+0.46875 0.570312 0.515625 
+0.460938 0.570312 0.515625 
+0.460938 0.570312 0.523438 
+0.46875 0.570312 0.523438 
+0.46875 0.578125 0.523438 
+0.460938 0.578125 0.523438 
+0.484375 0.570312 0.515625 
+0.5 0.570312 0.515625 
+0.492188 0.570312 0.515625 
+0.492188 0.570312 0.523438 
+0.5 0.570312 0.523438 
+0.5 0.570312 0.53125 
+0.5 0.578125 0.523438 
+0.492188 0.578125 0.523438 
+0.5 0.585938 0.53125 
+0.476562 0.570312 0.515625 
+0.476562 0.570312 0.523438 
+0.476562 0.570312 0.53125 
+0.484375 0.570312 0.53125 
+0.484375 0.570312 0.523438 
+0.484375 0.578125 0.523438 
+0.492188 0.570312 0.53125 
+0.492188 0.578125 0.53125 
+0.492188 0.585938 0.53125 
+0.476562 0.578125 0.53125 
+0.476562 0.578125 0.523438 
+0.476562 0.585938 0.53125 
+0.484375 0.585938 0.53125 
+0.484375 0.570312 0.539062 
+0.492188 0.570312 0.539062 
+0.5 0.570312 0.539062 
+0.5 0.570312 0.546875 
+0.492188 0.570312 0.546875 
+0.492188 0.578125 0.546875 
+0.5 0.570312 0.554688 
+0.5 0.578125 0.554688 
+0.5 0.585938 0.554688 
+0.484375 0.578125 0.539062 
+0.5 0.578125 0.539062 
+0.492188 0.578125 0.539062 
+0.492188 0.585938 0.539062 
+0.5 0.585938 0.539062 
+0.5 0.59375 0.539062 
+0.5 0.585938 0.546875 
+0.492188 0.585938 0.546875 
+0.5 0.59375 0.554688 
+0.484375 0.59375 0.539062 
+0.484375 0.585938 0.539062 
+0.492188 0.59375 0.539062 
+0.492188 0.59375 0.546875 
+0.445312 0.570312 0.515625 
+0.445312 0.570312 0.523438 
+0.445312 0.570312 0.53125 
+0.453125 0.570312 0.53125 
+0.453125 0.570312 0.523438 
+0.453125 0.578125 0.523438 
+0.460938 0.570312 0.53125 
+0.460938 0.578125 0.53125 
+0.460938 0.585938 0.53125 
+0.445312 0.570312 0.539062 
+0.453125 0.570312 0.546875 
+0.460938 0.570312 0.554688 
+0.453125 0.570312 0.539062 
+0.460938 0.570312 0.539062 
+0.460938 0.570312 0.546875 
+0.460938 0.578125 0.546875 
+0.460938 0.578125 0.554688 
+0.453125 0.578125 0.539062 
+0.460938 0.578125 0.539062 
+0.460938 0.585938 0.539062 
+0.460938 0.539062 0.546875 
+0.46875 0.539062 0.554688 
+0.46875 0.546875 0.554688 
+0.476562 0.546875 0.5625 
+0.476562 0.546875 0.554688 
+0.476562 0.554688 0.5625 
+0.484375 0.554688 0.5625 
+0.445312 0.507812 0.570312 
+0.453125 0.507812 0.570312 
+0.453125 0.507812 0.578125 
+0.460938 0.507812 0.570312 
+0.46875 0.507812 0.570312 
+0.46875 0.507812 0.578125 
+0.460938 0.507812 0.578125 
+0.460938 0.515625 0.578125 
+0.460938 0.507812 0.585938 
+0.46875 0.507812 0.585938 
+0.46875 0.507812 0.59375 
+0.46875 0.515625 0.585938 
+0.460938 0.515625 0.585938 
+0.460938 0.523438 0.585938 
+0.46875 0.523438 0.585938 
+0.46875 0.523438 0.59375 
+0.476562 0.507812 0.570312 
+0.484375 0.507812 0.570312 
+0.484375 0.507812 0.578125 
+0.492188 0.507812 0.570312 
+0.5 0.507812 0.570312 
+0.5 0.507812 0.578125 
+0.492188 0.507812 0.578125 
+0.492188 0.515625 0.578125 
+0.492188 0.507812 0.585938 
+0.5 0.507812 0.585938 
+0.5 0.507812 0.59375 
+0.5 0.515625 0.585938 
+0.492188 0.515625 0.585938 
+0.492188 0.523438 0.585938 
+0.5 0.523438 0.585938 
+0.5 0.523438 0.59375 
+0.476562 0.5 0.578125 
+0.476562 0.507812 0.578125 
+0.476562 0.5 0.585938 
+0.476562 0.5 0.59375 
+0.476562 0.507812 0.585938 
+0.476562 0.507812 0.59375 
+0.484375 0.507812 0.59375 
+0.484375 0.5 0.585938 
+0.484375 0.507812 0.585938 
+0.484375 0.515625 0.585938 
+0.492188 0.5 0.59375 
+0.492188 0.507812 0.59375 
+0.492188 0.515625 0.59375 
+0.492188 0.523438 0.59375 
+0.476562 0.515625 0.578125 
+0.476562 0.515625 0.59375 
+0.476562 0.515625 0.585938 
+0.476562 0.523438 0.585938 
+0.476562 0.523438 0.59375 
+0.476562 0.53125 0.59375 
+0.484375 0.523438 0.59375 
+0.484375 0.523438 0.585938 
+0.492188 0.53125 0.59375 
+0.453125 0.515625 0.570312 
+0.46875 0.515625 0.570312 
+0.460938 0.515625 0.570312 
+0.460938 0.523438 0.570312 
+0.46875 0.523438 0.570312 
+0.46875 0.53125 0.570312 
+0.46875 0.523438 0.578125 
+0.460938 0.523438 0.578125 
+0.46875 0.53125 0.585938 
+0.484375 0.515625 0.570312 
+0.5 0.515625 0.570312 
+0.492188 0.515625 0.570312 
+0.492188 0.523438 0.570312 
+0.5 0.523438 0.570312 
+0.5 0.53125 0.570312 
+0.5 0.523438 0.578125 
+0.492188 0.523438 0.578125 
+0.5 0.53125 0.585938 
+0.476562 0.515625 0.570312 
+0.476562 0.523438 0.570312 
+0.476562 0.53125 0.570312 
+0.484375 0.53125 0.570312 
+0.484375 0.523438 0.570312 
+0.484375 0.523438 0.578125 
+0.492188 0.53125 0.570312 
+0.492188 0.53125 0.578125 
+0.492188 0.53125 0.585938 
+0.476562 0.53125 0.578125 
+0.476562 0.523438 0.578125 
+0.476562 0.53125 0.585938 
+0.484375 0.53125 0.585938 
+0.476562 0.539062 0.570312 
+0.484375 0.539062 0.570312 
+0.484375 0.546875 0.570312 
+0.492188 0.539062 0.570312 
+0.5 0.539062 0.570312 
+0.5 0.546875 0.570312 
+0.492188 0.546875 0.570312 
+0.492188 0.546875 0.578125 
+0.492188 0.554688 0.570312 
+0.5 0.554688 0.570312 
+0.5 0.5625 0.570312 
+0.5 0.554688 0.578125 
+0.492188 0.554688 0.578125 
+0.492188 0.554688 0.585938 
+0.5 0.554688 0.585938 
+0.5 0.5625 0.585938 
+0.484375 0.539062 0.578125 
+0.5 0.539062 0.578125 
+0.492188 0.539062 0.578125 
+0.492188 0.539062 0.585938 
+0.5 0.539062 0.585938 
+0.5 0.539062 0.59375 
+0.5 0.546875 0.585938 
+0.492188 0.546875 0.585938 
+0.5 0.554688 0.59375 
+0.476562 0.539062 0.578125 
+0.476562 0.539062 0.585938 
+0.476562 0.539062 0.59375 
+0.484375 0.539062 0.59375 
+0.484375 0.539062 0.585938 
+0.484375 0.546875 0.585938 
+0.492188 0.539062 0.59375 
+0.492188 0.546875 0.59375 
+0.445312 0.515625 0.570312 
+0.445312 0.523438 0.570312 
+0.445312 0.53125 0.570312 
+0.453125 0.53125 0.570312 
+0.453125 0.523438 0.570312 
+0.453125 0.523438 0.578125 
+0.460938 0.53125 0.570312 
+0.460938 0.53125 0.578125 
+0.460938 0.53125 0.585938 
+0.445312 0.539062 0.570312 
+0.453125 0.546875 0.570312 
+0.460938 0.554688 0.570312 
+0.46875 0.5625 0.570312 
+0.453125 0.539062 0.570312 
+0.460938 0.539062 0.570312 
+0.46875 0.539062 0.570312 
+0.46875 0.546875 0.570312 
+0.460938 0.546875 0.570312 
+0.460938 0.546875 0.578125 
+0.46875 0.554688 0.570312 
+0.46875 0.554688 0.578125 
+0.460938 0.554688 0.578125 
+0.453125 0.539062 0.578125 
+0.46875 0.539062 0.578125 
+0.460938 0.539062 0.578125 
+0.460938 0.539062 0.585938 
+0.46875 0.539062 0.585938 
+0.46875 0.539062 0.59375 
+0.46875 0.546875 0.585938 
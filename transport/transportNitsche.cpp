@@ -23,6 +23,7 @@
 */
 #include "transport/transportNitsche.h"
 #include "transport/localsetups.cpp"
+#include "num/accumulator.h"
 #include <iostream>
 #include <fstream>
 namespace DROPS
@@ -48,32 +49,43 @@ void TransportP1XCL::Init (instat_scalar_fun_ptr cn, instat_scalar_fun_ptr cp, d
     const ExtIdxDescCL& Xidx= idx1.GetXidx();
     const ExtIdxDescCL& oldXidx= idx2.GetXidx();
 
-    DROPS_FOR_TRIANG_VERTEX( MG_, lvl, it) {    
-        if (it->Unknowns.Exist( ctidx)){
-           bool nPart = lset_.Data[it->Unknowns( lset_.RowIdx->GetIdx())] <= 0.;
+    const MultiGridCL::TriangVertexIteratorCL begin= MG_.GetTriangVertexBegin( lvl);
+    const size_t num_verts= std::distance( begin, MG_.GetTriangVertexEnd( lvl));
+#ifndef DROPS_WIN
+    size_t i;
+#else
+    int i;
+#endif
+#   pragma omp parallel for
+    for (i= 0; i < num_verts; ++i) {
+        const VertexCL& v= *(begin + i);
+        if (v.Unknowns.Exist( ctidx)){
+           bool nPart = lset_.Data[v.Unknowns( lset_.RowIdx->GetIdx())] <= 0.;
             if (nPart)
-                ct.Data[it->Unknowns( ctidx)]= H_*cn( it->GetCoord(), t);
+                ct.Data[v.Unknowns( ctidx)]= H_*cn( v.GetCoord(), t);
             else
-                ct.Data[it->Unknowns( ctidx)]= cp( it->GetCoord(), t);
-            if (Xidx[it->Unknowns(ctidx)]==NoIdx) continue; //no xfem-enrichment function on this vertex
+                ct.Data[v.Unknowns( ctidx)]= cp( v.GetCoord(), t);
+            if (Xidx[v.Unknowns(ctidx)]==NoIdx) continue; //no xfem-enrichment function on this vertex
 
             // xfem coefficients are set s.t. discontinuity is realized across
             // the interface
-            ct.Data[Xidx[it->Unknowns( ctidx)]]=cp( it->GetCoord(), t)- H_*cn( it->GetCoord(), t);
+            ct.Data[Xidx[v.Unknowns( ctidx)]]=cp( v.GetCoord(), t)- H_*cn( v.GetCoord(), t);
         }
     }
     // loop is called a second time, as  oldctidx and ctidx may differ
-    DROPS_FOR_TRIANG_VERTEX( MG_, lvl, it) {
-        if (it->Unknowns.Exist( oldctidx)){
-            bool nPart= oldlset_.Data[it->Unknowns( oldlset_.RowIdx->GetIdx())] <= 0.;
+#   pragma omp parallel for
+    for (i= 0; i < num_verts; ++i) {
+        const VertexCL& v= *(begin + i);
+        if (v.Unknowns.Exist( oldctidx)){
+            bool nPart= oldlset_.Data[v.Unknowns( oldlset_.RowIdx->GetIdx())] <= 0.;
             if (nPart)
-                oldct.Data[it->Unknowns( oldctidx)]= H_*cn( it->GetCoord(), t);
+                oldct.Data[v.Unknowns( oldctidx)]= H_*cn( v.GetCoord(), t);
             else
-                oldct.Data[it->Unknowns( oldctidx)]= cp( it->GetCoord(), t);
-            if (oldXidx[it->Unknowns(oldctidx)]==NoIdx) continue; //no xfem-enrichment function on this vertex
+                oldct.Data[v.Unknowns( oldctidx)]= cp( v.GetCoord(), t);
+            if (oldXidx[v.Unknowns(oldctidx)]==NoIdx) continue; //no xfem-enrichment function on this vertex
             // xfem coefficients are set s.t. discontinuity is realized across
             // the interface
-            oldct.Data[oldXidx[it->Unknowns( oldctidx)]]=cp( it->GetCoord(), t)- H_*cn( it->GetCoord(), t);
+            oldct.Data[oldXidx[v.Unknowns( oldctidx)]]=cp( v.GetCoord(), t)- H_*cn( v.GetCoord(), t);
         }
     }
 
@@ -94,11 +106,20 @@ void TransportP1XCL::TransformWithScaling (const VecDescCL& concin, VecDescCL& c
                ctidx= concin.RowIdx->GetIdx(); //concin and concout have same indices
     const IdxDescCL& idx1 = idx.GetFinest();
     const ExtIdxDescCL& Xidx= idx1.GetXidx();
-    double fac = 0.;
-    double ofac = 0.;
-    DROPS_FOR_TRIANG_VERTEX( MG_, lvl, it) {    
-        if (it->Unknowns.Exist( ctidx)){
-           bool nPart = lset_.Data[it->Unknowns( lset_.RowIdx->GetIdx())] <= 0.;
+    const MultiGridCL::TriangVertexIteratorCL begin= MG_.GetTriangVertexBegin( lvl);
+    const size_t num_verts= std::distance( begin, MG_.GetTriangVertexEnd( lvl));
+#ifndef DROPS_WIN
+    size_t i;
+#else
+    int i;
+#endif
+#   pragma omp parallel for
+    for (i= 0; i < num_verts; ++i) {
+        const VertexCL& v= *(begin + i);
+        if (v.Unknowns.Exist( ctidx)){
+           double fac = 0.;
+           double ofac = 0.;
+           bool nPart = lset_.Data[v.Unknowns( lset_.RowIdx->GetIdx())] <= 0.;
             if (nPart){
               fac = scalingn;
               ofac = scalingp;
@@ -108,11 +129,11 @@ void TransportP1XCL::TransformWithScaling (const VecDescCL& concin, VecDescCL& c
               ofac = scalingn;
             }
 
-            concout.Data[it->Unknowns( ctidx)]= fac * concin.Data[it->Unknowns( ctidx)];
-            if (Xidx[it->Unknowns(ctidx)]==NoIdx) 
+            concout.Data[v.Unknowns( ctidx)]= fac * concin.Data[v.Unknowns( ctidx)];
+            if (Xidx[v.Unknowns(ctidx)]==NoIdx) 
               continue; //no xfem-enrichment function on this vertex
             else
-              concout.Data[Xidx[it->Unknowns( ctidx)]] = ofac * concin.Data[Xidx[it->Unknowns( ctidx)]];
+              concout.Data[Xidx[v.Unknowns( ctidx)]] = ofac * concin.Data[Xidx[v.Unknowns( ctidx)]];
         }
     }
 }
@@ -121,21 +142,27 @@ void TransportP1XCL::TransformWithScaling (const VecDescCL& concin, VecDescCL& c
 /// Compute Mean Drop Concentration, i.e. mean 
 /// concentration in second phase (negative sign):
 /// integral over concentration / volume of second phase
-double TransportP1XCL::MeanDropConcentration()
+/// \brief Volume of the negative phase and integral of the concentration in it; used with reduce_tetras.
+class DropConcentrationReductionCL
 {
-    VecDescCL cn (&idx);
-    GetSolutionOnPart(cn, false, false);
-    double absdet;
+  private:
+    const VecDescCL& cn_;
+    const BndDataCL<>& Bnd_;
+    const VecDescCL& lset_;
     InterfaceTetraCL patch;
+    LocalP2CL<double> ones;
+
+  public:
+    double c_avrg, Volume;
 
-    double c_avrg= 0., Volume= 0.;
-    LocalP2CL<double> ones( 1.);
-    const Uint lvl= ct.GetLevel();
-    DROPS_FOR_TRIANG_TETRA( MG_, lvl, it) {
-        LocalP1CL<> lp1_cn( *it, cn, Bnd_);
+    DropConcentrationReductionCL (const VecDescCL& cn, const BndDataCL<>& Bnd, VecDescCL& lset)
+        : cn_( cn), Bnd_( Bnd), lset_( lset), ones( 1.), c_avrg( 0.), Volume( 0.) {}
+
+    void operator() (const TetraCL& t) {
+        LocalP1CL<> lp1_cn( t, cn_, Bnd_);
         LocalP2CL<> lp2_cn( lp1_cn );
-        absdet= std::abs( it->GetVolume()*6.);
-        patch.Init( *it, lset_,0.);
+        const double absdet= std::abs( t.GetVolume()*6.);
+        patch.Init( t, lset_,0.);
         for (int ch=0; ch<8; ++ch)
         {
             // compute volume and concentration
@@ -144,39 +171,54 @@ double TransportP1XCL::MeanDropConcentration()
             c_avrg+= patch.quad( lp2_cn, absdet, false);
         }
     }
-    c_avrg/= Volume;  
-    return c_avrg;
-}
-
+    void join (const DropConcentrationReductionCL& r) {
+        c_avrg+= r.c_avrg;
+        Volume+= r.Volume;
+    }
+};
 
-double TransportP1XCL::CheckSolution(instat_scalar_fun_ptr Lsgn, instat_scalar_fun_ptr Lsgp, double time)
+double TransportP1XCL::MeanDropConcentration()
 {
     VecDescCL cn (&idx);
     GetSolutionOnPart(cn, false, false);
-    VecDescCL cp (&idx);
-    GetSolutionOnPart(cp, true, false);
-  
-    double errl2p = 0, errl2n = 0;
-    double errl1p = 0, errl1n = 0;
+    DropConcentrationReductionCL red( cn, Bnd_, lset_);
+    reduce_tetras( MG_, ct.GetLevel(), red);
+    return red.c_avrg/red.Volume;
+}
+
+
+/// \brief L1- and L2-errors of the concentration in both phases; used with reduce_tetras.
+class SolutionErrorReductionCL
+{
+  private:
+    const VecDescCL& cn_;
+    const VecDescCL& cp_;
+    const BndDataCL<>& Bnd_;
+    const VecDescCL& lset_;
+    instat_scalar_fun_ptr Lsgn_, Lsgp_;
+    double time_;
     InterfaceTetraCL patch;
 
-    LocalP2CL<double> ones( 1.);
-    std::cout << "Difference to exact solution:" << std::endl;
+  public:
+    double errl2p, errl2n, errl1p, errl1n;
 
-    const Uint lvl= ct.GetLevel();
-    DROPS_FOR_TRIANG_TETRA( MG_, lvl, it)
-    {
-        LocalP2CL<double> lp2_soln (*it, Lsgn, time);
-        LocalP2CL<double> lp2_solp (*it, Lsgp, time);
-        LocalP1CL<double> lp1_p (*it, cp, Bnd_);
+    SolutionErrorReductionCL (const VecDescCL& cn, const VecDescCL& cp, const BndDataCL<>& Bnd, const VecDescCL& lset,
+        instat_scalar_fun_ptr Lsgn, instat_scalar_fun_ptr Lsgp, double time)
+        : cn_( cn), cp_( cp), Bnd_( Bnd), lset_( lset), Lsgn_( Lsgn), Lsgp_( Lsgp), time_( time),
+          errl2p( 0.), errl2n( 0.), errl1p( 0.), errl1n( 0.) {}
+
+    void operator() (const TetraCL& t) {
+        LocalP2CL<double> lp2_soln (t, Lsgn_, time_);
+        LocalP2CL<double> lp2_solp (t, Lsgp_, time_);
+        LocalP1CL<double> lp1_p (t, cp_, Bnd_);
         LocalP2CL<double> lp2_p (lp1_p);
-        LocalP1CL<double> lp1_n (*it, cn, Bnd_);
+        LocalP1CL<double> lp1_n (t, cn_, Bnd_);
         LocalP2CL<double> lp2_n (lp1_n);
         SMatrixCL<3,3> M;
         double det;
-        GetTrafoTr(M,det,*it);
+        GetTrafoTr(M,det,t);
         double absdet= std::fabs(det);
-        patch.Init( *it, lset_,0.);
+        patch.Init( t, lset_,0.);
         if (patch.Intersects()){
           patch.ComputeSubTets();
           Uint NumTets=patch.GetNumTetra(); //# of subtetras          
@@ -200,7 +242,7 @@ double TransportP1XCL::CheckSolution(instat_scalar_fun_ptr Lsgn, instat_scalar_f
               errl1p += q3_diffabs.quad(Vol);
             else
               errl1n += q3_diffabs.quad(Vol);
-            delete nodes;
+            delete[] nodes;
           }
           
         }
@@ -222,6 +264,26 @@ double TransportP1XCL::CheckSolution(instat_scalar_fun_ptr Lsgn, instat_scalar_f
             errl1n += q3_diffabs.quad(absdet);          
         }
     }
+    void join (const SolutionErrorReductionCL& r) {
+        errl2p+= r.errl2p;
+        errl2n+= r.errl2n;
+        errl1p+= r.errl1p;
+        errl1n+= r.errl1n;
+    }
+};
+
+double TransportP1XCL::CheckSolution(instat_scalar_fun_ptr Lsgn, instat_scalar_fun_ptr Lsgp, double time)
+{
+    VecDescCL cn (&idx);
+    GetSolutionOnPart(cn, false, false);
+    VecDescCL cp (&idx);
+    GetSolutionOnPart(cp, true, false);
+  
+    std::cout << "Difference to exact solution:" << std::endl;
+
+    SolutionErrorReductionCL red( cn, cp, Bnd_, lset_, Lsgn, Lsgp, time);
+    reduce_tetras( MG_, ct.GetLevel(), red);
+    const double errl2p= red.errl2p, errl2n= red.errl2n, errl1p= red.errl1p, errl1n= red.errl1n;
     double errl2 = std::sqrt(errl2n + errl2p);
     double errl1 = (errl1n + errl1p);
     std::cout << "errl2p = " << std::sqrt(errl2p) << "\t";
@@ -303,15 +365,10 @@ void TransportP1XCL::InitStep (VectorCL& rhs)
     SetupNitscheSystem( NA);
     rhs += cplM.Data + dt_*theta_*(b.Data + cplA.Data + cplC.Data);
 
-    MLMatrixCL L1, L2;
-    L1.LinComb( theta_, A.Data, theta_, C.Data);
+    L_.LinComb( 1., M.Data, dt_*theta_, A.Data, dt_*theta_, C.Data, dt_*theta_, NA.Data);
     A.Data.clear();
     C.Data.clear();
-    L2.LinComb( 1., L1, theta_, NA.Data);
     NA.Data.clear();
-    L1.clear();
-    L_.LinComb( 1., M.Data, dt_, L2);
-    L2.clear();
     M.Data.clear();
 }
 
@@ -336,6 +393,142 @@ void TransportP1XCL::CommitStep ()
 
 
 
+/// \brief Workspace of the (stabilized) transformed P1 finite element; each thread of scatter_tetras uses its own copy.
+class P1FEWorkspaceCL
+{
+  private:
+    double sdstab_;
+    P1FEGridfunctions p1feq_;
+    TransformedP1FiniteElement* plain_;
+    StabilizedTransformedP1FiniteElement* stab_;
+
+    void create () {
+        plain_= 0;
+        stab_= 0;
+        if (sdstab_)
+            stab_= new StabilizedTransformedP1FiniteElement( p1feq_, sdstab_);
+        else
+            plain_= new TransformedP1FiniteElement( p1feq_);
+    }
+    P1FEWorkspaceCL& operator= (const P1FEWorkspaceCL&); ///< not implemented
+
+  public:
+    P1FEWorkspaceCL (double sdstab) : sdstab_( sdstab) { create(); }
+    P1FEWorkspaceCL (const P1FEWorkspaceCL& w) : sdstab_( w.sdstab_) { create(); }
+    ~P1FEWorkspaceCL () { delete plain_; delete stab_; }
+
+    TransformedP1FiniteElement& fe () { return stab_ != 0 ? *stab_ : *plain_; }
+};
+
+/// \brief Accumulates the volume integrals of SetupInstatSystem for one tetra; used with scatter_tetras.
+class InstatSystemScatterCL
+{
+  private:
+    const IdxDescCL& RowIdx_;
+    const ExtIdxDescCL& Xidx_;
+    const BndDataCL<>& Bndt_;
+    const VecDescCL& lset_;
+    MatrixBuilderCL &A_, &M_, &C_;
+    VecDescCL *cplA_, *cplM_, *cplC_, *b_;
+    double time_;
+    GlobalConvDiffReacCoefficients global_cdcoef_;
+    P1FEWorkspaceCL fe_;
+    LocalNumbP1CL n;
+    ConvDiffElementMatrices elmats;
+    ConvDiffElementVectors elvecs;
+    InterfaceTetraCL cut;
+
+  public:
+    InstatSystemScatterCL (const IdxDescCL& RowIdx, const BndDataCL<>& Bndt, const VecDescCL& lset,
+        MatrixBuilderCL& A, MatrixBuilderCL& M, MatrixBuilderCL& C,
+        VecDescCL* cplA, VecDescCL* cplM, VecDescCL* cplC, VecDescCL* b, double time,
+        const GlobalConvDiffReacCoefficients& global_cdcoef, double sdstab)
+        : RowIdx_( RowIdx), Xidx_( RowIdx.GetXidx()), Bndt_( Bndt), lset_( lset), A_( A), M_( M), C_( C),
+          cplA_( cplA), cplM_( cplM), cplC_( cplC), b_( b), time_( time), global_cdcoef_( global_cdcoef), fe_( sdstab) {}
+
+    void operator() (const TetraCL& t);
+};
+
+void InstatSystemScatterCL::operator() (const TetraCL& t)
+{
+    TetraCL& tet= const_cast<TetraCL&>( t); // the local setups take non-const tetras
+    TransformedP1FiniteElement& transfp1fel= fe_.fe();
+    bool sign[4];
+
+    transfp1fel.SetTetra( tet);
+
+    n.assign( t, RowIdx_, Bndt_);
+    cut.Init( t, lset_,0.);
+    bool nocut=!cut.Intersects();
+
+    LocalConvDiffReacCoefficients local_cdcoef( global_cdcoef_, tet);
+    bool pPart= (cut.GetSign( 0) == 1);
+    transfp1fel.SetLocal( tet, local_cdcoef, pPart);
+    elmats.ResetAll();
+    elvecs.ResetAll();
+
+    ComputeRhsElementVector( elvecs.f, local_cdcoef, transfp1fel);
+
+    if (nocut) // tetra is not intersected by the interface
+    {
+        // couplings between standard basis functions
+        SetupLocalOnePhaseSystem (transfp1fel, elmats, local_cdcoef, pPart);
+    }
+    else{
+        // compute element matrix for standard basis functions and XFEM basis functions
+        SetupLocalOneInterfaceSystem(transfp1fel, cut, elmats, local_cdcoef);
+        SetupLocalTwoPhaseRhs(transfp1fel, cut, elvecs, local_cdcoef);
+        elmats.SetUnsignedAsSumOfSigned();
+    }
+
+    // assemble couplings between standard basis functions
+    for(int i= 0; i < 4; ++i)
+        if (n.WithUnknowns( i)){
+            for(int j= 0; j < 4; ++j)
+                if (n.WithUnknowns( j)) {
+                    M_( n.num[i], n.num[j])+= elmats.M[i][j];
+                    A_( n.num[i], n.num[j])+= elmats.A[i][j];
+                    C_( n.num[i], n.num[j])+= elmats.C[i][j];
+                }
+                 else if (cplM_ !=0) {
+                    const double val= Bndt_.GetBndFun( n.bndnum[j])( t.GetVertex( j)->GetCoord(), time_);
+                    cplM_->Data[n.num[i]]-= elmats.M[i][j]*val;
+                    cplA_->Data[n.num[i]]-= elmats.A[i][j]*val;
+                    cplC_->Data[n.num[i]]-= elmats.C[i][j]*val;
+                }
+            if (b_!=0) b_->Data[n.num[i]]+= elvecs.f[i];
+        }
+    if (nocut) return; // no XFEM basis functions
+    // assemble couplings between standard basis functions and XFEM basis functions
+    for(int i= 0; i < 4; ++i)
+        sign[i]= (cut.GetSign(i) == 1);
+    for(int i= 0; i < 4; ++i)
+        if(n.WithUnknowns(i)){
+            const IdxT xidx_i= Xidx_[n.num[i]];
+            for(int j= 0; j < 4; ++j)
+                if(n.WithUnknowns(j)){
+                    const IdxT xidx_j= Xidx_[n.num[j]];
+                    if (xidx_j!=NoIdx){
+                        M_( n.num[i], xidx_j)+= sign[j]? -elmats.M_n[i][j]: elmats.M_p[i][j];
+                        A_( n.num[i], xidx_j)+= sign[j]? -elmats.A_n[i][j]: elmats.A_p[i][j];
+                        C_( n.num[i], xidx_j)+= sign[j]? -elmats.C_n[i][j]: elmats.C_p[i][j];
+                    }
+                    if (xidx_i!=NoIdx){
+                        M_( xidx_i, n.num[j])+= sign[i]? -elmats.M_n[i][j]: elmats.M_p[i][j];
+                        A_( xidx_i, n.num[j])+= sign[i]? -elmats.A_n[i][j]: elmats.A_p[i][j];
+                        C_( xidx_i, n.num[j])+= sign[i]? -elmats.C_n[i][j]: elmats.C_p[i][j];
+                    }
+                    if ((xidx_i!=NoIdx) && (xidx_j!=NoIdx) && (sign[i]==sign[j])){
+                        M_( xidx_i, xidx_j)+= sign[j]? elmats.M_n[i][j]: elmats.M_p[i][j];
+                        A_( xidx_i, xidx_j)+= sign[j]? elmats.A_n[i][j]: elmats.A_p[i][j];
+                        C_( xidx_i, xidx_j)+= sign[j]? elmats.C_n[i][j]: elmats.C_p[i][j];
+                    }
+                }
+            if((xidx_i!=NoIdx) && (b_!=0))
+                b_->Data[xidx_i] +=sign[i] ?  - elvecs.f_n[i] :elvecs.f_p[i];
+        }
+}
+
 /// Setup of all volume integral - Bi- and Linearforms (not Nitsche yet, this is in SetupNitscheSystem)
 /**
  * - For one  level only \n
@@ -369,103 +562,15 @@ void TransportP1XCL::SetupInstatSystem(MatrixCL& matA, VecDescCL *cplA,
                     C(&matC, num_unks,  num_unks);// convection
 
     const Uint lvl= RowIdx.TriangLevel();
-    LocalNumbP1CL n;
-    bool sign[4];
+    RowIdx.BuildTetraDoFMap( MG_, Bndt_);
 
-    P1FEGridfunctions p1feq;
-
-    TransformedP1FiniteElement & transfp1fel = sdstab_? 
-        *new StabilizedTransformedP1FiniteElement (p1feq,sdstab_) : 
-        *new TransformedP1FiniteElement (p1feq);
-    
     GlobalConvDiffReacCoefficients global_cdcoef(D_,H_, GetVelocity() , c_, f_ ,time);
-	
-    ConvDiffElementMatrices elmats;
-    ConvDiffElementVectors elvecs;
-
-    DROPS_FOR_TRIANG_TETRA( MG_, lvl, sit) {
-
-        transfp1fel.SetTetra(*sit);
-
-        n.assign( *sit, RowIdx, Bndt_);
-        InterfaceTetraCL cut;
-        cut.Init( *sit, lset_,0.);
-        bool nocut=!cut.Intersects();
-
-        LocalConvDiffReacCoefficients local_cdcoef(global_cdcoef,*sit);
-        bool pPart= (cut.GetSign( 0) == 1);        
-        //transfp1fel.SetTetra(*sit);
-        transfp1fel.SetLocal(*sit,local_cdcoef,pPart);
-        elmats.ResetAll();
-        elvecs.ResetAll();
-
-        ComputeRhsElementVector( elvecs.f, local_cdcoef, transfp1fel); 
-
-        if (nocut) // tetra is not intersected by the interface
-        {
-            // couplings between standard basis functions
-            SetupLocalOnePhaseSystem (transfp1fel, elmats, local_cdcoef, pPart);
-        }
-        else{
-            // compute element matrix for standard basis functions and XFEM basis functions 
-            SetupLocalOneInterfaceSystem(transfp1fel, cut, elmats, local_cdcoef);
-            SetupLocalTwoPhaseRhs(transfp1fel, cut, elvecs, local_cdcoef);
-            elmats.SetUnsignedAsSumOfSigned(); 
-        }
-
-        // assemble couplings between standard basis functions
-        for(int i= 0; i < 4; ++i)
-            if (n.WithUnknowns( i)){
-                for(int j= 0; j < 4; ++j)
-                    if (n.WithUnknowns( j)) {
-                        M( n.num[i], n.num[j])+= elmats.M[i][j];
-                        A( n.num[i], n.num[j])+= elmats.A[i][j];
-                        C( n.num[i], n.num[j])+= elmats.C[i][j];
-                    }
-                     else if (cplM !=0) {
-                        const double val= Bndt_.GetBndFun( n.bndnum[j])( sit->GetVertex( j)->GetCoord(), time);
-                        cplM->Data[n.num[i]]-= elmats.M[i][j]*val;
-                        cplA->Data[n.num[i]]-= elmats.A[i][j]*val;
-                        cplC->Data[n.num[i]]-= elmats.C[i][j]*val;
-                    }
-                if (b!=0) b->Data[n.num[i]]+= elvecs.f[i];
-            }
-        if (nocut) continue; // no XFEM basis functions
-        // assemble couplings between standard basis functions and XFEM basis functions 
-        for(int i= 0; i < 4; ++i) 
-            sign[i]= (cut.GetSign(i) == 1);            
-        for(int i= 0; i < 4; ++i)
-            if(n.WithUnknowns(i)){
-                const IdxT xidx_i= Xidx[n.num[i]];
-                for(int j= 0; j < 4; ++j)
-                    if(n.WithUnknowns(j)){
-                        const IdxT xidx_j= Xidx[n.num[j]];
-                        if (xidx_j!=NoIdx){
-                            M( n.num[i], xidx_j)+= sign[j]? -elmats.M_n[i][j]: elmats.M_p[i][j];
-                            A( n.num[i], xidx_j)+= sign[j]? -elmats.A_n[i][j]: elmats.A_p[i][j];
-                            C( n.num[i], xidx_j)+= sign[j]? -elmats.C_n[i][j]: elmats.C_p[i][j];
-                        }
-                        if (xidx_i!=NoIdx){
-                            M( xidx_i, n.num[j])+= sign[i]? -elmats.M_n[i][j]: elmats.M_p[i][j];
-                            A( xidx_i, n.num[j])+= sign[i]? -elmats.A_n[i][j]: elmats.A_p[i][j];
-                            C( xidx_i, n.num[j])+= sign[i]? -elmats.C_n[i][j]: elmats.C_p[i][j];
-                        }
-                        if ((xidx_i!=NoIdx) && (xidx_j!=NoIdx) && (sign[i]==sign[j])){
-                            M( xidx_i, xidx_j)+= sign[j]? elmats.M_n[i][j]: elmats.M_p[i][j];
-                            A( xidx_i, xidx_j)+= sign[j]? elmats.A_n[i][j]: elmats.A_p[i][j];
-                            C( xidx_i, xidx_j)+= sign[j]? elmats.C_n[i][j]: elmats.C_p[i][j];
-                        }
-                    }  
-                if((xidx_i!=NoIdx) && (b!=0))
-                    b->Data[xidx_i] +=sign[i] ?  - elvecs.f_n[i] :elvecs.f_p[i];
-            }
-
-    }
+    InstatSystemScatterCL scatter( RowIdx, Bndt_, lset_, A, M, C, cplA, cplM, cplC, b, time, global_cdcoef, sdstab_);
+    scatter_tetras( MG_, lvl, RowIdx.GetMatchingFunction(), RowIdx.GetBndInfo(), scatter);
 
     A.Build();
     M.Build();
     C.Build();
-    delete &transfp1fel;
 }
 
 /// Setup of all volume integral - Bi- and Linearforms (not Nitsche yet, this is in SetupNitscheSystem)
@@ -496,14 +601,22 @@ void TransportP1XCL::GetSolutionOnPart( VecDescCL& ct_part, bool pPart, bool Is_
     cp= ct.Data; //
     // add extended part, s.t. all information (seen from one side) 
     // is available in terms of a P1 representation
-    for( MultiGridCL::const_TriangVertexIteratorCL it= mg.GetTriangVertexBegin(lvl),
-        end= mg.GetTriangVertexEnd(lvl); it != end; ++it)
+    const MultiGridCL::const_TriangVertexIteratorCL begin= mg.GetTriangVertexBegin( lvl);
+    const size_t num_verts= std::distance( begin, mg.GetTriangVertexEnd( lvl));
+#ifndef DROPS_WIN
+    size_t i;
+#else
+    int i;
+#endif
+#   pragma omp parallel for
+    for (i= 0; i < num_verts; ++i)
     {
-        if (!it->Unknowns.Exist( idxnum)) continue;
-        const IdxT nr= it->Unknowns(idxnum);
+        const VertexCL& v= *(begin + i);
+        if (!v.Unknowns.Exist( idxnum)) continue;
+        const IdxT nr= v.Unknowns(idxnum);
         if (Xidx[nr]==NoIdx) continue;
 
-        const bool sign= InterfaceTetraCL::Sign( lset_.Data[it->Unknowns(phiidx)]) == 1;
+        const bool sign= InterfaceTetraCL::Sign( lset_.Data[v.Unknowns(phiidx)]) == 1;
         if (pPart==sign) continue; // extended hat function ==0 on this part
         //different signs due to the definition of the xfem-enrichment functions
         if (pPart)
@@ -515,72 +628,82 @@ void TransportP1XCL::GetSolutionOnPart( VecDescCL& ct_part, bool pPart, bool Is_
     if (!Is_ct && (GetHenry(pPart)!=1.0)) cp/=GetHenry(pPart);
 }
 
+/// \brief Accumulates the Nitsche terms of SetupNitscheSystem for one tetra; used with scatter_tetras.
+class NitscheScatterCL
+{
+  private:
+    const IdxDescCL& RowIdx_;
+    const ExtIdxDescCL& Xidx_;
+    const BndDataCL<>& Bndt_;
+    const VecDescCL& lset_;
+    MatrixBuilderCL& A_;
+    const double* D_;
+    double H_, lambda_;
+    LocalNumbP1CL ln;
+    InterfaceTetraCL patch;
+    InterfaceTriangleCL triangle;
+
+  public:
+    NitscheScatterCL (const IdxDescCL& RowIdx, const BndDataCL<>& Bndt, const VecDescCL& lset,
+        MatrixBuilderCL& A, const double D[2], double H, double lambda)
+        : RowIdx_( RowIdx), Xidx_( RowIdx.GetXidx()), Bndt_( Bndt), lset_( lset), A_( A),
+          D_( D), H_( H), lambda_( lambda) {}
+
+    void operator() (const TetraCL& t);
+};
+
+void NitscheScatterCL::operator() (const TetraCL& t)
+{
+    double det, VolP, VolN, kappa[2], h;
+    int sign[4];
+
+    patch.Init( t, lset_,0.);
+    if (!patch.Intersects()) return;
+    triangle.Init( t, lset_,0.);
+    for(int i= 0; i < 4; ++i)
+        sign[i]= patch.GetSign(i);
+    ln.assign( t, RowIdx_, Bndt_);
+    Point3DCL G[4];
+    P1DiscCL::GetGradients( G, det, t);
+    const double h3= t.GetVolume()*6;
+    h= cbrt( h3);
+    VolP=VolN=0.;
+    patch.ComputeSubTets();
+    Uint NumTets=patch.GetNumTetra(); /// # of subtetras
+
+    for (Uint k=0; k< NumTets; ++k){
+        bool pPart= (k>=patch.GetNumNegTetra());
+        const SArrayCL<BaryCoordCL,4>& TT =  patch.GetTetra(k);
+        if (!IsRegBaryCoord(TT)) continue;
+        if (pPart) VolP+= VolFrac(TT);
+        else  VolN+= VolFrac(TT);
+    }
+    kappa[0]= VolP;
+    kappa[1]= 1.-kappa[0];
+    for (int ch= 0; ch < 8; ++ch)
+    {
+        triangle.ComputeForChild( ch);
+        for (int tri= 0; tri < triangle.GetNumTriangles(); ++tri) {
+            const BaryCoordCL * p = &triangle.GetBary( tri);
+            Quad5_2DCL<Point3DCL> n(triangle.GetNormal(), p);
+            SetupLocalNitscheSystem( p, Xidx_, n, G, ln, A_, triangle.GetAbsDet( tri), D_, H_, kappa, lambda_, h, sign);
+        }
+    } // Ende der for-Schleife ueber die Kinder
+}
+
 ///Assembles the Nitsche Bilinearform. Gathers the weighting functions and calls the Local NitscheSetup for each
 ///intersected tetrahedron
 void TransportP1XCL::SetupNitscheSystem( MatrixCL& matA, IdxDescCL& RowIdx/*, bool new_time */) const
 {
-    const ExtIdxDescCL& Xidx= RowIdx.GetXidx();
     matA.clear();
     const IdxT num_unks=  RowIdx.NumUnknowns();
     MatrixBuilderCL A(&matA, num_unks,  num_unks);
     const Uint lvl= RowIdx.TriangLevel();
-    LocalP1CL<Point3DCL> GradRef[10], Grad[10];
-    P2DiscCL::GetGradientsOnRef( GradRef);
-    LocalNumbP1CL ln;
-    SMatrixCL<3,3> T;
-    double det,VolP, VolN, kappa[2], h;
-    int sign[4]={0.};
-    const MultiGridCL& mg= this->GetMG();
-    BndDataCL<> Bndlset(mg.GetBnd().GetNumBndSeg());    
+    RowIdx.BuildTetraDoFMap( MG_, Bndt_);
+
+    NitscheScatterCL scatter( RowIdx, Bndt_, lset_, A, D_, H_, lambda_);
+    scatter_tetras( MG_, lvl, RowIdx.GetMatchingFunction(), RowIdx.GetBndInfo(), scatter);
 
-    DROPS_FOR_TRIANG_TETRA( MG_, /*default level*/lvl, it)
-    {
-        InterfaceTetraCL patch;
-        patch.Init( *it, lset_,0.);
-        InterfaceTriangleCL triangle;
-        triangle.Init( *it, lset_,0.);
-        if (!patch.Intersects()) continue;
-        for(int i= 0; i < 4; ++i)
-            sign[i]= patch.GetSign(i);
-        ln.assign( *it, RowIdx, Bndt_);
-        GetTrafoTr( T, det, *it);
-        P2DiscCL::GetGradients( Grad, GradRef, T); //TODO CL: kann weg!
-        Point3DCL G[4];
-        P1DiscCL::GetGradients( G, det, *it);
-        const double h3= it->GetVolume()*6;
-        h= cbrt( h3);
-        kappa[0]=kappa[1]=0.;
-        VolP=VolN=0.;
-//         LocalP2CL<> lp2_lset(*it, lset_, Bndlset);
-//         LocalP1CL<Point3DCL> lp1_grad_lset;
-//         lp1_grad_lset *=0.;
-//         for (int i=0; i<10; ++i)
-//             lp1_grad_lset+= lp2_lset[i]*Grad[i];
-//         LocalP2CL<Point3DCL> lp2_grad_lset(lp1_grad_lset);  
-        patch.ComputeSubTets();
-        Uint NumTets=patch.GetNumTetra(); /// # of subtetras
-
-        for (Uint k=0; k< NumTets; ++k){
-            bool pPart= (k>=patch.GetNumNegTetra());
-            const SArrayCL<BaryCoordCL,4>& TT =  patch.GetTetra(k);
-            if (!IsRegBaryCoord(TT)) continue;
-            if (pPart) VolP+= VolFrac(TT);
-            else  VolN+= VolFrac(TT);
-        }
-        kappa[0]= VolP;
-        kappa[1]= 1.-kappa[0];
-        for (int ch= 0; ch < 8; ++ch)
-        {
-            triangle.ComputeForChild( ch);
-            for (int t= 0; t < triangle.GetNumTriangles(); ++t) {
-                const BaryCoordCL * p = &triangle.GetBary( t);
-                //Quad5_2DCL<Point3DCL> n(lp2_grad_lset, p);
-                Quad5_2DCL<Point3DCL> n(triangle.GetNormal(), p);
-                //for (int i =0; i<Quad5_2DDataCL::NumNodesC; i++) if (n[i].norm()>1e-8) n[i]/= n[i].norm();
-                SetupLocalNitscheSystem( p, Xidx, n, G, ln, A, triangle.GetAbsDet( t), D_, H_, kappa, lambda_, h, sign/*, new_time*/);
-                }
-        } // Ende der for-Schleife ueber die Kinder
-    }
     A.Build();
 }
 
@@ -593,6 +716,152 @@ void TransportP1XCL::SetupNitscheSystem (MLMatDescCL& matA) const
         SetupNitscheSystem(*itA, *it);
 }
 
+/// \brief Accumulates the mixed mass matrix of SetupInstatMixedMassMatrix for one tetra; used with scatter_tetras.
+class MixedMassXScatterCL
+{
+  private:
+    const IdxDescCL& RowIdx_;
+    const ExtIdxDescCL& Xidx_;
+    const ExtIdxDescCL& oldXidx_;
+    const BndDataCL<>& Bndt_;
+    const VecDescCL& lset_;
+    const VecDescCL& oldlset_;
+    BndDataCL<> Bndlset;
+    MatrixBuilderCL& M_;
+    VecDescCL* cplM_;
+    double H_, time_;
+    GlobalConvDiffReacCoefficients global_cdcoef_;
+    P1FEWorkspaceCL fe_;
+    LocalNumbP1CL n;
+    InterfaceTetraCL cut, oldcut;
+
+  public:
+    MixedMassXScatterCL (const IdxDescCL& RowIdx, const IdxDescCL& ColIdx, const BndDataCL<>& Bndt,
+        const VecDescCL& lset, const VecDescCL& oldlset, Uint num_bnd_seg, MatrixBuilderCL& M, VecDescCL* cplM,
+        double H, double time, const GlobalConvDiffReacCoefficients& global_cdcoef, double sdstab)
+        : RowIdx_( RowIdx), Xidx_( RowIdx.GetXidx()), oldXidx_( ColIdx.GetXidx()), Bndt_( Bndt), lset_( lset),
+          oldlset_( oldlset), Bndlset( num_bnd_seg), M_( M), cplM_( cplM), H_( H), time_( time),
+          global_cdcoef_( global_cdcoef), fe_( sdstab) {}
+
+    void operator() (const TetraCL& t);
+};
+
+void MixedMassXScatterCL::operator() (const TetraCL& t)
+{
+    TetraCL& tet= const_cast<TetraCL&>( t); // the local setups take non-const tetras
+    TransformedP1FiniteElement& transfp1fel= fe_.fe();
+    bool sign[4], oldsign[4], no_newcut, no_oldcut;
+
+    n.assign( t, RowIdx_, Bndt_);
+    cut.Init( t, lset_,0.);
+    oldcut.Init( t, oldlset_,0.);
+    no_newcut=!cut.Intersects();
+    no_oldcut=!oldcut.Intersects();
+    
+    LocalConvDiffReacCoefficients local_cdcoef(global_cdcoef_,tet);
+    bool pPart_old= (oldcut.GetSign( 0) == 1);
+    bool pPart_new= (cut.GetSign( 0) == 1);
+    transfp1fel.SetLocal(tet,local_cdcoef,pPart_new);
+    
+    Elmat4x4 M_P1NEW_P1OLD,                   ///< (test FEM, shape FEM)
+        M_P1NEW_XOLD,                    ///< (test FEM, shape old XFEM) [at least old interface]
+        M_XNEW_P1OLD,                    ///< (test new XFEM, shape FEM) [at least new interface]
+        M_XNEW_XOLD;                     ///< (test new XFEM, shape old XFEM) [two interfaces]
+    
+    std::memset( M_P1NEW_P1OLD, 0, 4*4*sizeof(double));
+    std::memset( M_XNEW_XOLD  , 0, 4*4*sizeof(double));
+    std::memset( M_XNEW_P1OLD , 0, 4*4*sizeof(double));
+    std::memset( M_P1NEW_XOLD , 0, 4*4*sizeof(double));
+    
+    //  for debug purposes you should use this variant instead of the active one, s.t. only the method
+    //  SetupLocalTwoInterfacesMassMatrix is 
+    //  involved in the setup of cutted elements and not SetupLocalOneInterfaceMassMatrix (...) as well...
+    //  if(!no_oldcut||!no_newcut){ //new or old interface does not cut 
+    //    LocalP2CL<> lp2_oldlset(tet, oldlset_, Bndlset);
+    //    // couplings between XFEM basis functions wrt old and new interfaces
+    //    SetupLocalTwoInterfacesMassMatrix( cut, oldcut, M_P1NEW_P1OLD, M_P1NEW_XOLD, 
+    //                                       M_XNEW_P1OLD, M_XNEW_XOLD, transfp1fel, H_, lp2_oldlset);
+    //  }
+    //  else
+    //    SetupLocalOnePhaseMassMatrix ( M_P1NEW_P1OLD, transfp1fel, H_, pPart_new);
+      
+    if(no_oldcut){ //old interface does not cut 
+        if (no_newcut){ //new and old interface do not cut 
+            SetupLocalOnePhaseMassMatrix ( M_P1NEW_P1OLD, transfp1fel, H_, pPart_new);
+        }
+        else
+        { //new interface does cut, old does not 
+            Elmat4x4 M_XNEW_P1OLD_n, M_XNEW_P1OLD_p;
+            std::memset( M_XNEW_P1OLD_n,0, 4*4*sizeof(double));
+            std::memset( M_XNEW_P1OLD_p,0, 4*4*sizeof(double));
+            SetupLocalOneInterfaceMassMatrix( cut, /*cut_is_new_cut*/ true, 
+                                              M_XNEW_P1OLD_n, M_XNEW_P1OLD_p, 
+                                              transfp1fel, sign, H_, /*pPart_nocut*/ pPart_old);
+            for(int i= 0; i < 4; ++i){
+                for(int j= 0; j < 4; ++j){
+                    M_XNEW_P1OLD[i][j]= sign[i]? -M_XNEW_P1OLD_n[i][j] : M_XNEW_P1OLD_p[i][j];
+                    M_P1NEW_P1OLD[i][j]= M_XNEW_P1OLD_n[i][j] + M_XNEW_P1OLD_p[i][j];
+                }
+            }
+        }  
+    }
+    // the old interface cuts the tetra
+    else 
+    {
+        Elmat4x4 M_P1NEW_XOLD_n, M_P1NEW_XOLD_p;
+        std::memset( M_P1NEW_XOLD_n,0, 4*4*sizeof(double));
+        std::memset( M_P1NEW_XOLD_p,0, 4*4*sizeof(double));          
+        // couplings between standard basis functions and XFEM basis functions wrt old interface
+        if (no_newcut){
+            SetupLocalOneInterfaceMassMatrix( oldcut, /*cut_is_new_cut*/ false, 
+                                              M_P1NEW_XOLD_n,  M_P1NEW_XOLD_p, 
+                                              transfp1fel,oldsign, H_, /*pPart_nocut*/ pPart_new);
+            for(int i= 0; i < 4; ++i){
+                for(int j= 0; j < 4; ++j){
+                    M_P1NEW_P1OLD[i][j]= M_P1NEW_XOLD_n[i][j] +  M_P1NEW_XOLD_p[i][j];
+                    M_P1NEW_XOLD[i][j]= oldsign[j] ? - M_P1NEW_XOLD_n[i][j] :   M_P1NEW_XOLD_p[i][j];                    
+                }
+            }
+        }
+        // both interfaces cut the tetra
+        else {
+            LocalP2CL<> lp2_oldlset(tet, oldlset_, Bndlset);
+            // couplings between XFEM basis functions wrt old and new interfaces
+            SetupLocalTwoInterfacesMassMatrix( cut, oldcut, M_P1NEW_P1OLD, M_P1NEW_XOLD, 
+                                               M_XNEW_P1OLD, M_XNEW_XOLD, transfp1fel, 
+                                               H_, lp2_oldlset);
+        }
+    }
+    
+    
+    for(int i= 0; i < 4; ++i)
+        if (n.WithUnknowns( i)){
+            for(int j= 0; j < 4; ++j)
+                if (n.WithUnknowns( j)) {
+                    M_( n.num[i], n.num[j])+= M_P1NEW_P1OLD[i][j];
+                }
+                else if (cplM_!=0){
+                    const double val= Bndt_.GetBndFun( n.bndnum[j])( t.GetVertex( j)->GetCoord(), time_);
+                    cplM_->Data[n.num[i]]-= M_P1NEW_P1OLD[i][j]*val;
+                }
+        }
+    if (no_newcut && no_oldcut) return;
+    for(int i= 0; i < 4; ++i)
+        if(n.WithUnknowns(i)){
+            const IdxT xidx_i= Xidx_[n.num[i]];
+            for(int j= 0; j < 4; ++j)
+                if(n.WithUnknowns(j)){
+                    const IdxT xidx_j= oldXidx_[n.num[j]];
+                    if (xidx_j!=NoIdx) // at least old cuts
+                        M_( n.num[i], xidx_j)+= M_P1NEW_XOLD[i][j];
+                    if (xidx_i!=NoIdx) // at least new cuts
+                        M_( xidx_i, n.num[j])+= M_XNEW_P1OLD[i][j];
+                    if (xidx_i!=NoIdx && xidx_j!=NoIdx) //both cut
+                        M_( xidx_i, xidx_j)+= M_XNEW_XOLD[i][j];
+                }
+        }
+}
+
 /// Couplings between basis functions wrt old and new interfaces, s.t. Bilinearform-Applications
 /// M(uold,v) make sense also for the new time step (and the functions therein (like v))
 // This is only used as a matrix application. So actually there is no need to setting up the matrix!
@@ -602,137 +871,18 @@ void TransportP1XCL::SetupInstatMixedMassMatrix( MatrixCL& matM, VecDescCL* cplM
 {
     if (cplM!=0) cplM->Data= 0.;
     matM.clear();
-    const ExtIdxDescCL& Xidx= RowIdx.GetXidx();
-    const ExtIdxDescCL& oldXidx= ColIdx.GetXidx();
     const IdxT num_unks=  RowIdx.NumUnknowns(),
         num_cols=  ColIdx.NumUnknowns();
     MatrixBuilderCL M(&matM, num_unks,  num_cols);//mass matrix
-    const MultiGridCL& mg= this->GetMG();
-    BndDataCL<> Bndlset(mg.GetBnd().GetNumBndSeg());                
     const Uint lvl= RowIdx.TriangLevel();
-    LocalNumbP1CL n;
-    bool sign[4], oldsign[4], no_newcut, no_oldcut;
-    // The 16 products of the P1-shape-functions
-    
-    P1FEGridfunctions p1feq;
-    TransformedP1FiniteElement & transfp1fel = sdstab_? 
-        *new StabilizedTransformedP1FiniteElement (p1feq,sdstab_) : 
-        *new TransformedP1FiniteElement (p1feq);    
+    RowIdx.BuildTetraDoFMap( MG_, Bndt_);
+
     GlobalConvDiffReacCoefficients global_cdcoef(D_,H_, GetVelocity() , f_, c_, time);
-    
-    DROPS_FOR_TRIANG_TETRA( MG_, lvl, sit) { 
-        n.assign( *sit, RowIdx, Bndt_);
-        InterfaceTetraCL cut, oldcut;
-        cut.Init( *sit, lset_,0.);
-        oldcut.Init( *sit, oldlset_,0.);
-        no_newcut=!cut.Intersects();
-        no_oldcut=!oldcut.Intersects();
-        
-        LocalConvDiffReacCoefficients local_cdcoef(global_cdcoef,*sit);
-        bool pPart_old= (oldcut.GetSign( 0) == 1);
-        bool pPart_new= (cut.GetSign( 0) == 1);
-        transfp1fel.SetLocal(*sit,local_cdcoef,pPart_new);
-        
-        Elmat4x4 M_P1NEW_P1OLD,                   ///< (test FEM, shape FEM)
-            M_P1NEW_XOLD,                    ///< (test FEM, shape old XFEM) [at least old interface]
-            M_XNEW_P1OLD,                    ///< (test new XFEM, shape FEM) [at least new interface]
-            M_XNEW_XOLD;                     ///< (test new XFEM, shape old XFEM) [two interfaces]
-        
-        std::memset( M_P1NEW_P1OLD, 0, 4*4*sizeof(double));
-        std::memset( M_XNEW_XOLD  , 0, 4*4*sizeof(double));
-        std::memset( M_XNEW_P1OLD , 0, 4*4*sizeof(double));
-        std::memset( M_P1NEW_XOLD , 0, 4*4*sizeof(double));
-        
-        //  for debug purposes you should use this variant instead of the active one, s.t. only the method
-        //  SetupLocalTwoInterfacesMassMatrix is 
-        //  involved in the setup of cutted elements and not SetupLocalOneInterfaceMassMatrix (...) as well...
-        //  if(!no_oldcut||!no_newcut){ //new or old interface does not cut 
-        //    LocalP2CL<> lp2_oldlset(*sit, oldlset_, Bndlset);
-        //    // couplings between XFEM basis functions wrt old and new interfaces
-        //    SetupLocalTwoInterfacesMassMatrix( cut, oldcut, M_P1NEW_P1OLD, M_P1NEW_XOLD, 
-        //                                       M_XNEW_P1OLD, M_XNEW_XOLD, transfp1fel, H_, lp2_oldlset);
-        //  }
-        //  else
-        //    SetupLocalOnePhaseMassMatrix ( M_P1NEW_P1OLD, transfp1fel, H_, pPart_new);
-          
-        if(no_oldcut){ //old interface does not cut 
-            if (no_newcut){ //new and old interface do not cut 
-                SetupLocalOnePhaseMassMatrix ( M_P1NEW_P1OLD, transfp1fel, H_, pPart_new);
-            }
-            else
-            { //new interface does cut, old does not 
-                Elmat4x4 M_XNEW_P1OLD_n, M_XNEW_P1OLD_p;
-                std::memset( M_XNEW_P1OLD_n,0, 4*4*sizeof(double));
-                std::memset( M_XNEW_P1OLD_p,0, 4*4*sizeof(double));
-                SetupLocalOneInterfaceMassMatrix( cut, /*cut_is_new_cut*/ true, 
-                                                  M_XNEW_P1OLD_n, M_XNEW_P1OLD_p, 
-                                                  transfp1fel, sign, H_, /*pPart_nocut*/ pPart_old);
-                for(int i= 0; i < 4; ++i){
-                    for(int j= 0; j < 4; ++j){
-                        M_XNEW_P1OLD[i][j]= sign[i]? -M_XNEW_P1OLD_n[i][j] : M_XNEW_P1OLD_p[i][j];
-                        M_P1NEW_P1OLD[i][j]= M_XNEW_P1OLD_n[i][j] + M_XNEW_P1OLD_p[i][j];
-                    }
-                }
-            }  
-        }
-        // the old interface cuts the tetra
-        else 
-        {
-            Elmat4x4 M_P1NEW_XOLD_n, M_P1NEW_XOLD_p;
-            std::memset( M_P1NEW_XOLD_n,0, 4*4*sizeof(double));
-            std::memset( M_P1NEW_XOLD_p,0, 4*4*sizeof(double));          
-            // couplings between standard basis functions and XFEM basis functions wrt old interface
-            if (no_newcut){
-                SetupLocalOneInterfaceMassMatrix( oldcut, /*cut_is_new_cut*/ false, 
-                                                  M_P1NEW_XOLD_n,  M_P1NEW_XOLD_p, 
-                                                  transfp1fel,oldsign, H_, /*pPart_nocut*/ pPart_new);
-                for(int i= 0; i < 4; ++i){
-                    for(int j= 0; j < 4; ++j){
-                        M_P1NEW_P1OLD[i][j]= M_P1NEW_XOLD_n[i][j] +  M_P1NEW_XOLD_p[i][j];
-                        M_P1NEW_XOLD[i][j]= oldsign[j] ? - M_P1NEW_XOLD_n[i][j] :   M_P1NEW_XOLD_p[i][j];                    
-                    }
-                }
-            }
-            // both interfaces cut the tetra
-            else {
-                LocalP2CL<> lp2_oldlset(*sit, oldlset_, Bndlset);
-                // couplings between XFEM basis functions wrt old and new interfaces
-                SetupLocalTwoInterfacesMassMatrix( cut, oldcut, M_P1NEW_P1OLD, M_P1NEW_XOLD, 
-                                                   M_XNEW_P1OLD, M_XNEW_XOLD, transfp1fel, 
-                                                   H_, lp2_oldlset);
-            }
-        }
-        
-        
-        for(int i= 0; i < 4; ++i)
-            if (n.WithUnknowns( i)){
-                for(int j= 0; j < 4; ++j)
-                    if (n.WithUnknowns( j)) {
-                        M( n.num[i], n.num[j])+= M_P1NEW_P1OLD[i][j];
-                    }
-                    else if (cplM!=0){
-                        const double val= Bndt_.GetBndFun( n.bndnum[j])( sit->GetVertex( j)->GetCoord(), time);
-                        cplM->Data[n.num[i]]-= M_P1NEW_P1OLD[i][j]*val;
-                    }
-            }
-        if (no_newcut && no_oldcut) continue;
-        for(int i= 0; i < 4; ++i)
-            if(n.WithUnknowns(i)){
-                const IdxT xidx_i= Xidx[n.num[i]];
-                for(int j= 0; j < 4; ++j)
-                    if(n.WithUnknowns(j)){
-                        const IdxT xidx_j= oldXidx[n.num[j]];
-                        if (xidx_j!=NoIdx) // at least old cuts
-                            M( n.num[i], xidx_j)+= M_P1NEW_XOLD[i][j];
-                        if (xidx_i!=NoIdx) // at least new cuts
-                            M( xidx_i, n.num[j])+= M_XNEW_P1OLD[i][j];
-                        if (xidx_i!=NoIdx && xidx_j!=NoIdx) //both cut
-                            M( xidx_i, xidx_j)+= M_XNEW_XOLD[i][j];
-                    }
-            }
-    }
+    MixedMassXScatterCL scatter( RowIdx, ColIdx, Bndt_, lset_, oldlset_, MG_.GetBnd().GetNumBndSeg(), M, cplM,
+        H_, time, global_cdcoef, sdstab_);
+    scatter_tetras( MG_, lvl, RowIdx.GetMatchingFunction(), RowIdx.GetBndInfo(), scatter);
+
     M.Build();
-    delete &transfp1fel;
 }
 
 void TransportP1XCL::SetupInstatMixedMassMatrix(MLMatDescCL& matM, 
@@ -749,41 +899,58 @@ void TransportP1XCL::SetupInstatMixedMassMatrix(MLMatDescCL& matM,
 
 
 
-/// compute \f$ \left( \int_{\Gamma} [c_T]^2 dx \right)^{\frac12} \f$
-double TransportP1XCL::Interface_L2error() const
+/// \brief Squared L2-norm of the jump of an extended P1-function on the interface; used with reduce_tetras.
+class InterfaceJumpReductionCL
 {
-    const IdxDescCL &RowIdx = idx.GetFinest(); 
-    const ExtIdxDescCL& Xidx= RowIdx.GetXidx();
-    const Uint lvl= RowIdx.TriangLevel();
+  private:
+    const IdxDescCL& RowIdx_;
+    const ExtIdxDescCL& Xidx_;
+    const VectorCL& ct_;
+    const BndDataCL<>& Bndt_;
+    const VecDescCL& lset_;
     LocalNumbP1CL ln;
-    double err_sq=0.;
+    InterfaceTriangleCL triangle;
+    Quad5_2DCL<> p1[4];
 
-    DROPS_FOR_TRIANG_TETRA( MG_, /*default level*/lvl, it)
-    {
-        InterfaceTriangleCL triangle;
-        triangle.Init( *it, lset_,0.);
-        if (!triangle.Intersects()) continue;
-        ln.assign( *it, RowIdx, Bndt_); 
+  public:
+    double err_sq;
+
+    InterfaceJumpReductionCL (const IdxDescCL& RowIdx, const VectorCL& ct, const BndDataCL<>& Bndt, VecDescCL& lset)
+        : RowIdx_( RowIdx), Xidx_( RowIdx.GetXidx()), ct_( ct), Bndt_( Bndt), lset_( lset), err_sq( 0.) {}
+
+    void operator() (const TetraCL& t) {
+        triangle.Init( t, lset_,0.);
+        if (!triangle.Intersects()) return;
+        ln.assign( t, RowIdx_, Bndt_);
 
         for (int ch= 0; ch < 8; ++ch) {
             triangle.ComputeForChild( ch);
-            for (int t= 0; t < triangle.GetNumTriangles(); ++t) {
-                static Quad5_2DCL<>  p1[4]; 
-                Quad5_2DCL<>jump_on_Gamma;   
+            for (int tri= 0; tri < triangle.GetNumTriangles(); ++tri) {
+                Quad5_2DCL<>jump_on_Gamma;
                 jump_on_Gamma*=0.;
-                P1DiscCL::GetP1Basis( p1, &triangle.GetBary( t));
-                double det= triangle.GetAbsDet( t);
+                P1DiscCL::GetP1Basis( p1, &triangle.GetBary( tri));
+                double det= triangle.GetAbsDet( tri);
                 for(int i= 0; i < 4; ++i)
                     if(ln.WithUnknowns(i)){
-                    const IdxT xidx_i= Xidx[ln.num[i]];
+                    const IdxT xidx_i= Xidx_[ln.num[i]];
                     if (xidx_i!=NoIdx)
-                        jump_on_Gamma+= p1[i]*ct.Data[xidx_i];
-                    } 
-                err_sq+=  Quad5_2DCL<>(jump_on_Gamma*jump_on_Gamma).quad(det);             
+                        jump_on_Gamma+= p1[i]*ct_[xidx_i];
+                    }
+                err_sq+=  Quad5_2DCL<>(jump_on_Gamma*jump_on_Gamma).quad(det);
             }
         }
     }
-    return std::sqrt(err_sq); 
+    void join (const InterfaceJumpReductionCL& r) { err_sq+= r.err_sq; }
+};
+
+/// compute \f$ \left( \int_{\Gamma} [c_T]^2 dx \right)^{\frac12} \f$
+double TransportP1XCL::Interface_L2error() const
+{
+    const IdxDescCL &RowIdx = idx.GetFinest(); 
+    RowIdx.BuildTetraDoFMap( MG_, Bndt_);
+    InterfaceJumpReductionCL red( RowIdx, ct.Data, Bndt_, lset_);
+    reduce_tetras( MG_, RowIdx.TriangLevel(), red);
+    return std::sqrt( red.err_sq);
 }
 
 //*****************************************************************************